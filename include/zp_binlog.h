@@ -26,6 +26,10 @@ std::string NewFileName(const std::string name, const uint32_t current);
 // Find the nearest block start offset
 uint64_t BinlogBlockStart(uint64_t offset);
 
+// Bytes from one binlog position to a later one, negative if it's earlier
+int64_t BinlogDistance(uint32_t from_num, uint64_t from_offset,
+    uint32_t to_num, uint64_t to_offset);
+
 enum RecordType {
   kZeroType = 0,
   kFullType = 1,
@@ -110,10 +114,12 @@ public:
   Status Seek(uint64_t offset);
   Status Consume(uint64_t *size, std::string *item);
   void SkipNextBlock(uint64_t* size);
+  // Give back the read buffer when idle, checked out again when needed
+  void ReleaseBuffer();
 
 private:
   slash::SequentialFile *queue_;
-  char* const backing_store_;
+  std::string backing_store_;
   slash::Slice buffer_;
   int last_record_offset_;
   bool last_error_happened_;
@@ -0,0 +1,37 @@
+#ifndef ZP_BUFFER_POOL_H
+#define ZP_BUFFER_POOL_H
+#include <string>
+#include <vector>
+
+#include "slash/include/slash_mutex.h"
+
+/**
+ * ZPBufferPool
+ * Process wide pool of string buffers, in size classes of power of two
+ * from kBufferPoolMinSize to kBufferPoolMaxSize. Buffers are checked out
+ * only while in use, and at most kBufferPoolMaxFree of each class are kept
+ * after checked in, so that memory scale with the active users
+ */
+class ZPBufferPool {
+ public:
+  static ZPBufferPool* Global();
+
+  // Swap in an empty buffer with capacity no less than size
+  void Checkout(size_t size, std::string* buf);
+  // Swap in a buffer of exactly size bytes with any content, as scratch.
+  // Buffers keep their size in the pool, so it's zero filled only once
+  void CheckoutScratch(size_t size, std::string* buf);
+  // Swap out the buffer, leave buf empty
+  void Checkin(std::string* buf);
+
+ private:
+  ZPBufferPool();
+  slash::Mutex mutex_;
+  std::vector<std::vector<std::string> > free_;
+  void Take(size_t size, std::string* buf);
+
+  ZPBufferPool(const ZPBufferPool&);
+  void operator=(const ZPBufferPool&);
+};
+
+#endif
@@ -3,7 +3,9 @@
 
 #include <deque>
 #include <string>
+#include <vector>
 #include <memory>
+#include <functional>
 #include <unordered_map>
 
 #include "client.pb.h"
@@ -45,6 +47,18 @@ enum CmdFlags {
 };
 
 
+// Returned by Extract methods when there is no such thing
+const std::string kCmdEmptyArg = "";
+
+// What a request is about, extracted once when received,
+// table and key point into the request
+struct RequestContext {
+  const std::string* table;
+  const std::string* key;
+  size_t key_hash;
+  int partition_id;  // -1 if it's routed by key
+};
+
 class Cmd {
  public:
   Cmd(int flag) : flag_(flag) {}
@@ -57,14 +71,33 @@ class Cmd {
     return request->SerializeToString(log_raw);
   }
   virtual std::string name() const = 0;
-  virtual std::string ExtractTable(const google::protobuf::Message *request) const {
-    return "";
+  virtual const std::string& ExtractTable(const google::protobuf::Message *request) const {
+    return kCmdEmptyArg;
   }
   virtual int ExtractPartition(const google::protobuf::Message *request) const {
     return -1;
   }
-  virtual std::string ExtractKey(const google::protobuf::Message *request) const {
-    return "";
+  virtual const std::string& ExtractKey(const google::protobuf::Message *request) const {
+    return kCmdEmptyArg;
+  }
+  // All the keys to lock for a write of many keys on one partition,
+  // false if there is only the one from ExtractKey
+  virtual bool ExtractKeys(const google::protobuf::Message *request,
+      std::vector<std::string>* keys) const {
+    return false;
+  }
+  // Staleness the read could bear, NULL if it must be served by master
+  virtual const client::ReadStaleness* ExtractStaleness(
+      const google::protobuf::Message *request) const {
+    return NULL;
+  }
+
+  void ExtractContext(const google::protobuf::Message *request,
+      RequestContext* context) const {
+    context->table = &ExtractTable(request);
+    context->key = &ExtractKey(request);
+    context->key_hash = std::hash<std::string>()(*context->key);
+    context->partition_id = ExtractPartition(request);
   }
 
   bool is_write() const {
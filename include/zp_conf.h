@@ -97,6 +97,18 @@ class ZpConf {
     RWLock l(&rwlock_, false);
     return sync_send_thread_num_;
   }
+  int bgsave_thread_num() {
+    RWLock l(&rwlock_, false);
+    return bgsave_thread_num_;
+  }
+  int multikey_thread_num() {
+    RWLock l(&rwlock_, false);
+    return multikey_thread_num_;
+  }
+  int pipeline_thread_num() {
+    RWLock l(&rwlock_, false);
+    return pipeline_thread_num_;
+  }
   int max_background_flushes() {
     RWLock l(&rwlock_, false);
     return max_background_flushes_;
@@ -117,6 +129,10 @@ class ZpConf {
     RWLock l(&rwlock_, false);
     return db_max_write_buffer_;
   }
+  int db_read_cache_size() {
+    RWLock l(&rwlock_, false);
+    return db_read_cache_size_;
+  }
   int db_target_file_size_base() {
     RWLock l(&rwlock_, false);
     return db_target_file_size_base_;
@@ -129,6 +145,26 @@ class ZpConf {
     RWLock l(&rwlock_, false);
     return db_block_size_;
   }
+  int db_sync_speed() {
+    RWLock l(&rwlock_, false);
+    return db_sync_speed_;
+  }
+  int db_sync_parallel() {
+    RWLock l(&rwlock_, false);
+    return db_sync_parallel_;
+  }
+  bool db_sync_sst() {
+    RWLock l(&rwlock_, false);
+    return db_sync_sst_;
+  }
+  int bg_io_speed() {
+    RWLock l(&rwlock_, false);
+    return bg_io_speed_;
+  }
+  int bg_io_latency_target() {
+    RWLock l(&rwlock_, false);
+    return bg_io_latency_target_;
+  }
 
  private:
   // copy disallowded
@@ -153,16 +189,27 @@ class ZpConf {
   int data_thread_num_;
   int sync_recv_thread_num_;
   int sync_send_thread_num_;
+  int bgsave_thread_num_;
+  int multikey_thread_num_;
+  int pipeline_thread_num_;
   int max_background_flushes_;
   int max_background_compactions_;
 
   // DB
   int db_write_buffer_size_; //KB
   int db_max_write_buffer_; //KB
+  int db_read_cache_size_; //KB, of each partition
   int db_target_file_size_base_; //KB
   int db_max_open_files_;
   int db_block_size_; //KB
 
+  // DBSync
+  int db_sync_speed_; //MB
+  int db_sync_parallel_;
+  bool db_sync_sst_;  // export sst files instead of checkpoint
+  int bg_io_speed_; //MB
+  int bg_io_latency_target_; //us
+
   // Feature
   int slowlog_slower_than_;
 
@@ -43,7 +43,7 @@ const std::string MetaStateMsg[] = {
 // TODO DataPort is stall
 //const int kPortShiftDataCmd = 100;
 const int kPortShiftSync = 200;
-const int kPortShiftRsync = 300;
+const int kPortShiftRsync = 300;  // DBSync receiver
 
 // Meta port shift
 const int kMetaPortShiftCmd = 0;
@@ -53,7 +53,23 @@ const int kMetaPortShiftFY = 100;
 // TrySync Delay time := kRecoverSyncDelayCronCount * (kNodeCronInterval * kNodeCronWaitCount)
 const int kRecoverSyncDelayCronCount = 7;
 const int kTrySyncInterval = 3000;  // mili seconds
+const int kTrySyncBatchTimeout = 3000;  // mili seconds, for one master
+const int kTrySyncBatchPartitionTimeout = 20;  // mili seconds, more for each
+// Masters failed to answer MSYNC are sent SYNC only for so long
+const int kTrySyncNoBatchTime = 600;  // seconds
 const int kBinlogSendInterval = 2;
+// Binlog sender wait so long once a round of tasks has nothing to send,
+// should be much less than kBinlogHeartbeatInterval
+const int kBinlogSendIdleWait = 10;  // mili seconds
+// Min interval between two resync requests of the same partition
+const int kResyncRequestInterval = 1000;  // mili seconds
+// Idle binlog sender tell slave its binlog end at least every such interval
+const int kBinlogHeartbeatInterval = 1000;  // mili seconds
+// Slave in chain sync from master directly if heard nothing from
+// the one before it for so long
+const int kChainUpstreamTimeout = 10000;  // mili seconds
+// Binlog send rate is measured over such a window
+const int kBinlogSendRateWindow = 1000;  // mili seconds
 const int kBinlogTimeSlice = 10;    //should larger than kBinlogSendInterval
 const int kPingInterval = 3;
 const int kMetacmdInterval = 3;
@@ -69,6 +85,14 @@ const int kNodeCronWaitCount = 2;
 //const int kBinlogReceiverCronInterval = 1000;
 const int kBinlogReceiveBgWorkerFull = 100;
 
+// Binlog send flow control
+// Max number of binlog items one send task could have in flight
+const int kBinlogSendWindow = 128;
+// Slave grant credits back every kBinlogCreditBatch items consumed
+const int kBinlogCreditBatch = 32;
+// Restore the whole window if no credit granted in this time, in case ack lost
+const int kBinlogCreditTimeout = 10;  // seconds
+
 
 
 ////// Binlog related //////
@@ -79,11 +103,20 @@ const size_t kBlockSize = 64 * 1024;
 // Header is Type(1 byte), length (2 bytes)
 const size_t kHeaderSize = 1 + 3;
 
+// Buffer pool of binlog read, size classes are power of two between
+const size_t kBufferPoolMinSize = kBlockSize;
+const size_t kBufferPoolMaxSize = 4 * 1024 * 1024;
+const size_t kBufferPoolMaxFree = 64;  // free buffers kept for each class
+
 const std::string kBinlogPrefix = "binlog";
 const size_t kBinlogPrefixLen = 6;
 
 const std::string kManifest = "manifest";
 
+// Replication history of master terms, kept along with binlog
+const std::string kReplHistoryFile = "repl_history";
+const size_t kReplHistoryMaxTerms = 16;
+
 //#define SLAVE_ITEM_STAGE_ONE 1
 //#define SLAVE_ITEM_STAGE_TWO 2
 
@@ -107,9 +140,67 @@ const int kMaxBitOpInputBit = 21;
 // DBSync
 //const uint32_t kDBSyncMaxGap = 200;
 const uint32_t kDBSyncMaxGap = 1000;
-const std::string kDBSyncModule = "document";
 const uint32_t kDBSyncSpeedLimit = 126; //MBPS
 const std::string kBgsaveInfoFile = "info";
+const uint32_t kDBSyncMagic = 0x5a504453;  // "ZPDS"
+const int kDBSyncTimeout = 30000;  // mili seconds
+const int kDBSyncRetryTimes = 3;
+const size_t kDBSyncChunkSize = 1024 * 1024;
+const int kDBSyncWaitBgsaveInterval = 1000;  // mili seconds
+const uint64_t kSstExportFileSize = 256 * 1024 * 1024;
+const std::string kSstExportPrefix = "export_";
+// Suffix of the file being received, kept for resume after broken
+const std::string kDBSyncTmpSuffix = ".zpsync";
+
+// Background IO
+// Budget halve when foreground is slow, and grow back by
+// 1 / kIORateStepDivisor of bg_io_speed, but never below that
+const int kIORateStepDivisor = 20;
+// Foreground is slow if more than 1 / kIOSlowDivisor of the commands
+// exceed the latency target, that is p99
+const uint64_t kIOSlowDivisor = 100;
+const uint64_t kIOMinSamples = 100;  // judge foreground only with enough
+// Binlog send task charge only when it's so far behind
+const int64_t kIOCatchUpLag = 1024 * 1024;
+// Charge in batch of so many bytes at least
+const int64_t kIOChargeBatch = 1024 * 1024;
+// Purge only unlink, charge so many bytes for each file
+const int64_t kIOPurgeUnlinkCost = 64 * 1024;
+
+// Subscribe
+const int kSubscribeMaxRecords = 10000;
+const uint64_t kSubscribeMaxBytes = 4 * 1024 * 1024;  // of one response
+
+// Multi-key read with so many keys at least fan out its partitions
+// to multikey workers, smaller ones run inline
+const int kMultiKeyParallelMinKeys = 32;
+// Multi-key command forward keys of remote partitions to their masters
+const int kForwardTimeout = 1000;  // mili seconds
+const size_t kForwardMaxIdleConns = 8;  // kept for each peer
+// Acks to the same upstream go to the same one of so many threads,
+// so that an unreachable upstream only delay the ones sharing its thread
+const int kSyncAckThreadNum = 4;
+
+// Client connection, requests pipelined in one read are executed in order
+// and their responses written together
+const size_t kClientConnReadSize = 64 * 1024;  // of one read
+const size_t kClientConnMaxFrame = 64 * 1024 * 1024;
+// Stop executing more requests once so many response bytes are pending
+const size_t kClientConnMaxReply = 4 * 1024 * 1024;
+// Frame v2 begin with the magic, which is never the first byte of v1 length
+const char kFrameV2Magic = 'Z';
+const char kFrameV2Version = 2;
+const size_t kFrameV2HeaderSize = 16;
+// Unordered v2 requests run together at most
+const size_t kClientConnMaxInflight = 128;
+// Responses left by pipeline workers are written by the flusher
+const int kClientFlushEvents = 128;  // of one epoll_wait
+const int kClientFlushWait = 100;  // mili seconds, of one epoll_wait
+
+// Read cache
+const int kReadCacheShards = 16;
+// Values read from db, whose ttl is unknown, live so long at most
+const uint64_t kReadCacheMaxAge = 1000;  // mili seconds
 
 // Purge binlog
 const uint32_t kBinlogRemainMinCount = 3;
@@ -128,4 +219,7 @@ const std::string kMetaVersion = "##version";
 const int kNodeMetaTimeoutN = 10;
 const int kNodeMetaTimeoutM= 15;
 
+// Upper limit of master, slaves and learners of one partition
+const int kMaxReplicaNum = 8;
+
 #endif
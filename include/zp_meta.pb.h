@@ -1,84 +1,177 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: zp_meta.proto
 
-#ifndef PROTOBUF_zp_5fmeta_2eproto__INCLUDED
-#define PROTOBUF_zp_5fmeta_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_zp_5fmeta_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_zp_5fmeta_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_zp_5fmeta_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_zp_5fmeta_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_zp_5fmeta_2eproto;
 namespace ZPMeta {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_zp_5fmeta_2eproto();
-void protobuf_AssignDesc_zp_5fmeta_2eproto();
-void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-class Node;
-class NodeStatus;
-class Nodes;
-class MetaNodes;
-class Partitions;
-class TableName;
-class Table;
 class BasicCmdUnit;
-class SyncOffset;
+struct BasicCmdUnitDefaultTypeInternal;
+extern BasicCmdUnitDefaultTypeInternal _BasicCmdUnit_default_instance_;
 class MetaCmd;
-class MetaCmd_Ping;
-class MetaCmd_Pull;
-class MetaCmd_Init;
-class MetaCmd_SetMaster;
-class MetaCmd_AddSlave;
-class MetaCmd_RemoveSlave;
-class MetaCmd_DropTable;
+struct MetaCmdDefaultTypeInternal;
+extern MetaCmdDefaultTypeInternal _MetaCmd_default_instance_;
 class MetaCmdResponse;
+struct MetaCmdResponseDefaultTypeInternal;
+extern MetaCmdResponseDefaultTypeInternal _MetaCmdResponse_default_instance_;
+class MetaCmdResponse_ListMeta;
+struct MetaCmdResponse_ListMetaDefaultTypeInternal;
+extern MetaCmdResponse_ListMetaDefaultTypeInternal _MetaCmdResponse_ListMeta_default_instance_;
+class MetaCmdResponse_ListNode;
+struct MetaCmdResponse_ListNodeDefaultTypeInternal;
+extern MetaCmdResponse_ListNodeDefaultTypeInternal _MetaCmdResponse_ListNode_default_instance_;
+class MetaCmdResponse_ListTable;
+struct MetaCmdResponse_ListTableDefaultTypeInternal;
+extern MetaCmdResponse_ListTableDefaultTypeInternal _MetaCmdResponse_ListTable_default_instance_;
 class MetaCmdResponse_Ping;
+struct MetaCmdResponse_PingDefaultTypeInternal;
+extern MetaCmdResponse_PingDefaultTypeInternal _MetaCmdResponse_Ping_default_instance_;
 class MetaCmdResponse_Pull;
-class MetaCmdResponse_ListTable;
-class MetaCmdResponse_ListNode;
-class MetaCmdResponse_ListMeta;
+struct MetaCmdResponse_PullDefaultTypeInternal;
+extern MetaCmdResponse_PullDefaultTypeInternal _MetaCmdResponse_Pull_default_instance_;
+class MetaCmd_AddSlave;
+struct MetaCmd_AddSlaveDefaultTypeInternal;
+extern MetaCmd_AddSlaveDefaultTypeInternal _MetaCmd_AddSlave_default_instance_;
+class MetaCmd_DropTable;
+struct MetaCmd_DropTableDefaultTypeInternal;
+extern MetaCmd_DropTableDefaultTypeInternal _MetaCmd_DropTable_default_instance_;
+class MetaCmd_Init;
+struct MetaCmd_InitDefaultTypeInternal;
+extern MetaCmd_InitDefaultTypeInternal _MetaCmd_Init_default_instance_;
+class MetaCmd_Ping;
+struct MetaCmd_PingDefaultTypeInternal;
+extern MetaCmd_PingDefaultTypeInternal _MetaCmd_Ping_default_instance_;
+class MetaCmd_Pull;
+struct MetaCmd_PullDefaultTypeInternal;
+extern MetaCmd_PullDefaultTypeInternal _MetaCmd_Pull_default_instance_;
+class MetaCmd_RemoveSlave;
+struct MetaCmd_RemoveSlaveDefaultTypeInternal;
+extern MetaCmd_RemoveSlaveDefaultTypeInternal _MetaCmd_RemoveSlave_default_instance_;
+class MetaCmd_SetChain;
+struct MetaCmd_SetChainDefaultTypeInternal;
+extern MetaCmd_SetChainDefaultTypeInternal _MetaCmd_SetChain_default_instance_;
+class MetaCmd_SetMaster;
+struct MetaCmd_SetMasterDefaultTypeInternal;
+extern MetaCmd_SetMasterDefaultTypeInternal _MetaCmd_SetMaster_default_instance_;
+class MetaNodes;
+struct MetaNodesDefaultTypeInternal;
+extern MetaNodesDefaultTypeInternal _MetaNodes_default_instance_;
+class Node;
+struct NodeDefaultTypeInternal;
+extern NodeDefaultTypeInternal _Node_default_instance_;
+class NodeStatus;
+struct NodeStatusDefaultTypeInternal;
+extern NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
+class Nodes;
+struct NodesDefaultTypeInternal;
+extern NodesDefaultTypeInternal _Nodes_default_instance_;
+class Partitions;
+struct PartitionsDefaultTypeInternal;
+extern PartitionsDefaultTypeInternal _Partitions_default_instance_;
+class SyncOffset;
+struct SyncOffsetDefaultTypeInternal;
+extern SyncOffsetDefaultTypeInternal _SyncOffset_default_instance_;
+class Table;
+struct TableDefaultTypeInternal;
+extern TableDefaultTypeInternal _Table_default_instance_;
+class TableName;
+struct TableNameDefaultTypeInternal;
+extern TableNameDefaultTypeInternal _TableName_default_instance_;
+}  // namespace ZPMeta
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ZPMeta::BasicCmdUnit* Arena::CreateMaybeMessage<::ZPMeta::BasicCmdUnit>(Arena*);
+template<> ::ZPMeta::MetaCmd* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd>(Arena*);
+template<> ::ZPMeta::MetaCmdResponse* Arena::CreateMaybeMessage<::ZPMeta::MetaCmdResponse>(Arena*);
+template<> ::ZPMeta::MetaCmdResponse_ListMeta* Arena::CreateMaybeMessage<::ZPMeta::MetaCmdResponse_ListMeta>(Arena*);
+template<> ::ZPMeta::MetaCmdResponse_ListNode* Arena::CreateMaybeMessage<::ZPMeta::MetaCmdResponse_ListNode>(Arena*);
+template<> ::ZPMeta::MetaCmdResponse_ListTable* Arena::CreateMaybeMessage<::ZPMeta::MetaCmdResponse_ListTable>(Arena*);
+template<> ::ZPMeta::MetaCmdResponse_Ping* Arena::CreateMaybeMessage<::ZPMeta::MetaCmdResponse_Ping>(Arena*);
+template<> ::ZPMeta::MetaCmdResponse_Pull* Arena::CreateMaybeMessage<::ZPMeta::MetaCmdResponse_Pull>(Arena*);
+template<> ::ZPMeta::MetaCmd_AddSlave* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_AddSlave>(Arena*);
+template<> ::ZPMeta::MetaCmd_DropTable* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_DropTable>(Arena*);
+template<> ::ZPMeta::MetaCmd_Init* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_Init>(Arena*);
+template<> ::ZPMeta::MetaCmd_Ping* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_Ping>(Arena*);
+template<> ::ZPMeta::MetaCmd_Pull* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_Pull>(Arena*);
+template<> ::ZPMeta::MetaCmd_RemoveSlave* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_RemoveSlave>(Arena*);
+template<> ::ZPMeta::MetaCmd_SetChain* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_SetChain>(Arena*);
+template<> ::ZPMeta::MetaCmd_SetMaster* Arena::CreateMaybeMessage<::ZPMeta::MetaCmd_SetMaster>(Arena*);
+template<> ::ZPMeta::MetaNodes* Arena::CreateMaybeMessage<::ZPMeta::MetaNodes>(Arena*);
+template<> ::ZPMeta::Node* Arena::CreateMaybeMessage<::ZPMeta::Node>(Arena*);
+template<> ::ZPMeta::NodeStatus* Arena::CreateMaybeMessage<::ZPMeta::NodeStatus>(Arena*);
+template<> ::ZPMeta::Nodes* Arena::CreateMaybeMessage<::ZPMeta::Nodes>(Arena*);
+template<> ::ZPMeta::Partitions* Arena::CreateMaybeMessage<::ZPMeta::Partitions>(Arena*);
+template<> ::ZPMeta::SyncOffset* Arena::CreateMaybeMessage<::ZPMeta::SyncOffset>(Arena*);
+template<> ::ZPMeta::Table* Arena::CreateMaybeMessage<::ZPMeta::Table>(Arena*);
+template<> ::ZPMeta::TableName* Arena::CreateMaybeMessage<::ZPMeta::TableName>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ZPMeta {
 
-enum StatusCode {
+enum StatusCode : int {
   OK = 0,
   NOTFOUND = 1,
   ERROR = 2
 };
 bool StatusCode_IsValid(int value);
-const StatusCode StatusCode_MIN = OK;
-const StatusCode StatusCode_MAX = ERROR;
-const int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor();
-inline const ::std::string& StatusCode_Name(StatusCode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    StatusCode_descriptor(), value);
+constexpr StatusCode StatusCode_MIN = OK;
+constexpr StatusCode StatusCode_MAX = ERROR;
+constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
+template<typename T>
+inline const std::string& StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatusCode_descriptor(), enum_t_value);
 }
 inline bool StatusCode_Parse(
-    const ::std::string& name, StatusCode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<StatusCode>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
     StatusCode_descriptor(), name, value);
 }
-enum Type {
+enum Type : int {
   PING = 1,
   PULL = 2,
   INIT = 3,
@@ -89,1640 +182,3393 @@ enum Type {
   LISTNODE = 8,
   LISTMETA = 9,
   DROPTABLE = 10,
-  METASTATUS = 11
+  METASTATUS = 11,
+  SETCHAIN = 12
 };
 bool Type_IsValid(int value);
-const Type Type_MIN = PING;
-const Type Type_MAX = METASTATUS;
-const int Type_ARRAYSIZE = Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Type_descriptor();
-inline const ::std::string& Type_Name(Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Type_descriptor(), value);
+constexpr Type Type_MIN = PING;
+constexpr Type Type_MAX = SETCHAIN;
+constexpr int Type_ARRAYSIZE = Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor();
+template<typename T>
+inline const std::string& Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Type_descriptor(), enum_t_value);
 }
 inline bool Type_Parse(
-    const ::std::string& name, Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Type>(
     Type_descriptor(), name, value);
 }
-enum PState {
+enum PState : int {
   ACTIVE = 1,
   STUCK = 2
 };
 bool PState_IsValid(int value);
-const PState PState_MIN = ACTIVE;
-const PState PState_MAX = STUCK;
-const int PState_ARRAYSIZE = PState_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* PState_descriptor();
-inline const ::std::string& PState_Name(PState value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    PState_descriptor(), value);
+constexpr PState PState_MIN = ACTIVE;
+constexpr PState PState_MAX = STUCK;
+constexpr int PState_ARRAYSIZE = PState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PState_descriptor();
+template<typename T>
+inline const std::string& PState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PState_descriptor(), enum_t_value);
 }
 inline bool PState_Parse(
-    const ::std::string& name, PState* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<PState>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PState>(
     PState_descriptor(), name, value);
 }
 // ===================================================================
 
-class Node : public ::google::protobuf::Message {
+class Node final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.Node) */ {
  public:
-  Node();
-  virtual ~Node();
+  inline Node() : Node(nullptr) {}
+  ~Node() override;
+  explicit PROTOBUF_CONSTEXPR Node(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Node(const Node& from);
+  Node(Node&& from) noexcept
+    : Node() {
+    *this = ::std::move(from);
+  }
 
   inline Node& operator=(const Node& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Node& operator=(Node&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Node& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Node& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Node* internal_default_instance() {
+    return reinterpret_cast<const Node*>(
+               &_Node_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Node* other);
+  friend void swap(Node& a, Node& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Node* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Node* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Node* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Node* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Node>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Node& from);
-  void MergeFrom(const Node& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Node& from) {
+    Node::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Node* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.Node";
+  }
+  protected:
+  explicit Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIpFieldNumber = 1,
+    kPortFieldNumber = 2,
+  };
   // required string ip = 1;
-  inline bool has_ip() const;
-  inline void clear_ip();
-  static const int kIpFieldNumber = 1;
-  inline const ::std::string& ip() const;
-  inline void set_ip(const ::std::string& value);
-  inline void set_ip(const char* value);
-  inline void set_ip(const char* value, size_t size);
-  inline ::std::string* mutable_ip();
-  inline ::std::string* release_ip();
-  inline void set_allocated_ip(::std::string* ip);
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
   // required int32 port = 2;
-  inline bool has_port() const;
-  inline void clear_port();
-  static const int kPortFieldNumber = 2;
-  inline ::google::protobuf::int32 port() const;
-  inline void set_port(::google::protobuf::int32 value);
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.Node)
  private:
-  inline void set_has_ip();
-  inline void clear_has_ip();
-  inline void set_has_port();
-  inline void clear_has_port();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* ip_;
-  ::google::protobuf::int32 port_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static Node* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NodeStatus : public ::google::protobuf::Message {
+class NodeStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.NodeStatus) */ {
  public:
-  NodeStatus();
-  virtual ~NodeStatus();
+  inline NodeStatus() : NodeStatus(nullptr) {}
+  ~NodeStatus() override;
+  explicit PROTOBUF_CONSTEXPR NodeStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NodeStatus(const NodeStatus& from);
+  NodeStatus(NodeStatus&& from) noexcept
+    : NodeStatus() {
+    *this = ::std::move(from);
+  }
 
   inline NodeStatus& operator=(const NodeStatus& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline NodeStatus& operator=(NodeStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NodeStatus& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeStatus* internal_default_instance() {
+    return reinterpret_cast<const NodeStatus*>(
+               &_NodeStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(NodeStatus* other);
+  friend void swap(NodeStatus& a, NodeStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  NodeStatus* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  NodeStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NodeStatus& from);
-  void MergeFrom(const NodeStatus& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeStatus& from) {
+    NodeStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.NodeStatus";
+  }
+  protected:
+  explicit NodeStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNodeFieldNumber = 1,
+    kStatusFieldNumber = 2,
+  };
   // required .ZPMeta.Node node = 1;
-  inline bool has_node() const;
-  inline void clear_node();
-  static const int kNodeFieldNumber = 1;
-  inline const ::ZPMeta::Node& node() const;
-  inline ::ZPMeta::Node* mutable_node();
-  inline ::ZPMeta::Node* release_node();
-  inline void set_allocated_node(::ZPMeta::Node* node);
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::ZPMeta::Node& node() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Node* release_node();
+  ::ZPMeta::Node* mutable_node();
+  void set_allocated_node(::ZPMeta::Node* node);
+  private:
+  const ::ZPMeta::Node& _internal_node() const;
+  ::ZPMeta::Node* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::ZPMeta::Node* node);
+  ::ZPMeta::Node* unsafe_arena_release_node();
 
   // required int32 status = 2;
-  inline bool has_status() const;
-  inline void clear_status();
-  static const int kStatusFieldNumber = 2;
-  inline ::google::protobuf::int32 status() const;
-  inline void set_status(::google::protobuf::int32 value);
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  int32_t status() const;
+  void set_status(int32_t value);
+  private:
+  int32_t _internal_status() const;
+  void _internal_set_status(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.NodeStatus)
  private:
-  inline void set_has_node();
-  inline void clear_has_node();
-  inline void set_has_status();
-  inline void clear_has_status();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::Node* node_;
-  ::google::protobuf::int32 status_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static NodeStatus* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::Node* node_;
+    int32_t status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Nodes : public ::google::protobuf::Message {
+class Nodes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.Nodes) */ {
  public:
-  Nodes();
-  virtual ~Nodes();
+  inline Nodes() : Nodes(nullptr) {}
+  ~Nodes() override;
+  explicit PROTOBUF_CONSTEXPR Nodes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Nodes(const Nodes& from);
+  Nodes(Nodes&& from) noexcept
+    : Nodes() {
+    *this = ::std::move(from);
+  }
 
   inline Nodes& operator=(const Nodes& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Nodes& operator=(Nodes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Nodes& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Nodes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Nodes* internal_default_instance() {
+    return reinterpret_cast<const Nodes*>(
+               &_Nodes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(Nodes* other);
+  friend void swap(Nodes& a, Nodes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Nodes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Nodes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Nodes* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Nodes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Nodes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Nodes& from);
-  void MergeFrom(const Nodes& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Nodes& from) {
+    Nodes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Nodes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.Nodes";
+  }
+  protected:
+  explicit Nodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNodesFieldNumber = 1,
+  };
   // repeated .ZPMeta.NodeStatus nodes = 1;
-  inline int nodes_size() const;
-  inline void clear_nodes();
-  static const int kNodesFieldNumber = 1;
-  inline const ::ZPMeta::NodeStatus& nodes(int index) const;
-  inline ::ZPMeta::NodeStatus* mutable_nodes(int index);
-  inline ::ZPMeta::NodeStatus* add_nodes();
-  inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::NodeStatus >&
-      nodes() const;
-  inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::NodeStatus >*
+  int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
+  void clear_nodes();
+  ::ZPMeta::NodeStatus* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::NodeStatus >*
       mutable_nodes();
+  private:
+  const ::ZPMeta::NodeStatus& _internal_nodes(int index) const;
+  ::ZPMeta::NodeStatus* _internal_add_nodes();
+  public:
+  const ::ZPMeta::NodeStatus& nodes(int index) const;
+  ::ZPMeta::NodeStatus* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::NodeStatus >&
+      nodes() const;
 
   // @@protoc_insertion_point(class_scope:ZPMeta.Nodes)
  private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::ZPMeta::NodeStatus > nodes_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static Nodes* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::NodeStatus > nodes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaNodes : public ::google::protobuf::Message {
+class MetaNodes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaNodes) */ {
  public:
-  MetaNodes();
-  virtual ~MetaNodes();
+  inline MetaNodes() : MetaNodes(nullptr) {}
+  ~MetaNodes() override;
+  explicit PROTOBUF_CONSTEXPR MetaNodes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaNodes(const MetaNodes& from);
+  MetaNodes(MetaNodes&& from) noexcept
+    : MetaNodes() {
+    *this = ::std::move(from);
+  }
 
   inline MetaNodes& operator=(const MetaNodes& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaNodes& operator=(MetaNodes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaNodes& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaNodes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaNodes* internal_default_instance() {
+    return reinterpret_cast<const MetaNodes*>(
+               &_MetaNodes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(MetaNodes* other);
+  friend void swap(MetaNodes& a, MetaNodes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaNodes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaNodes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaNodes* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaNodes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaNodes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaNodes& from);
-  void MergeFrom(const MetaNodes& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaNodes& from) {
+    MetaNodes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaNodes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaNodes";
+  }
+  protected:
+  explicit MetaNodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFollowersFieldNumber = 1,
+    kLeaderFieldNumber = 2,
+  };
   // repeated .ZPMeta.Node followers = 1;
-  inline int followers_size() const;
-  inline void clear_followers();
-  static const int kFollowersFieldNumber = 1;
-  inline const ::ZPMeta::Node& followers(int index) const;
-  inline ::ZPMeta::Node* mutable_followers(int index);
-  inline ::ZPMeta::Node* add_followers();
-  inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >&
-      followers() const;
-  inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >*
+  int followers_size() const;
+  private:
+  int _internal_followers_size() const;
+  public:
+  void clear_followers();
+  ::ZPMeta::Node* mutable_followers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
       mutable_followers();
+  private:
+  const ::ZPMeta::Node& _internal_followers(int index) const;
+  ::ZPMeta::Node* _internal_add_followers();
+  public:
+  const ::ZPMeta::Node& followers(int index) const;
+  ::ZPMeta::Node* add_followers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
+      followers() const;
 
   // optional .ZPMeta.Node leader = 2;
-  inline bool has_leader() const;
-  inline void clear_leader();
-  static const int kLeaderFieldNumber = 2;
-  inline const ::ZPMeta::Node& leader() const;
-  inline ::ZPMeta::Node* mutable_leader();
-  inline ::ZPMeta::Node* release_leader();
-  inline void set_allocated_leader(::ZPMeta::Node* leader);
+  bool has_leader() const;
+  private:
+  bool _internal_has_leader() const;
+  public:
+  void clear_leader();
+  const ::ZPMeta::Node& leader() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Node* release_leader();
+  ::ZPMeta::Node* mutable_leader();
+  void set_allocated_leader(::ZPMeta::Node* leader);
+  private:
+  const ::ZPMeta::Node& _internal_leader() const;
+  ::ZPMeta::Node* _internal_mutable_leader();
+  public:
+  void unsafe_arena_set_allocated_leader(
+      ::ZPMeta::Node* leader);
+  ::ZPMeta::Node* unsafe_arena_release_leader();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaNodes)
  private:
-  inline void set_has_leader();
-  inline void clear_has_leader();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node > followers_;
-  ::ZPMeta::Node* leader_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaNodes* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node > followers_;
+    ::ZPMeta::Node* leader_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Partitions : public ::google::protobuf::Message {
+class Partitions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.Partitions) */ {
  public:
-  Partitions();
-  virtual ~Partitions();
+  inline Partitions() : Partitions(nullptr) {}
+  ~Partitions() override;
+  explicit PROTOBUF_CONSTEXPR Partitions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Partitions(const Partitions& from);
+  Partitions(Partitions&& from) noexcept
+    : Partitions() {
+    *this = ::std::move(from);
+  }
 
   inline Partitions& operator=(const Partitions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Partitions& operator=(Partitions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Partitions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Partitions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Partitions* internal_default_instance() {
+    return reinterpret_cast<const Partitions*>(
+               &_Partitions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(Partitions* other);
+  friend void swap(Partitions& a, Partitions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Partitions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Partitions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Partitions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Partitions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Partitions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Partitions& from);
-  void MergeFrom(const Partitions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Partitions& from) {
+    Partitions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Partitions* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.Partitions";
+  }
+  protected:
+  explicit Partitions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required int32 id = 1;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 1;
-  inline ::google::protobuf::int32 id() const;
-  inline void set_id(::google::protobuf::int32 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required .ZPMeta.PState state = 2;
-  inline bool has_state() const;
-  inline void clear_state();
-  static const int kStateFieldNumber = 2;
-  inline ::ZPMeta::PState state() const;
-  inline void set_state(::ZPMeta::PState value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // required .ZPMeta.Node master = 3;
-  inline bool has_master() const;
-  inline void clear_master();
-  static const int kMasterFieldNumber = 3;
-  inline const ::ZPMeta::Node& master() const;
-  inline ::ZPMeta::Node* mutable_master();
-  inline ::ZPMeta::Node* release_master();
-  inline void set_allocated_master(::ZPMeta::Node* master);
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
 
+  enum : int {
+    kSlavesFieldNumber = 4,
+    kLearnersFieldNumber = 6,
+    kMasterFieldNumber = 3,
+    kIdFieldNumber = 1,
+    kChainFieldNumber = 5,
+    kStateFieldNumber = 2,
+  };
   // repeated .ZPMeta.Node slaves = 4;
-  inline int slaves_size() const;
-  inline void clear_slaves();
-  static const int kSlavesFieldNumber = 4;
-  inline const ::ZPMeta::Node& slaves(int index) const;
-  inline ::ZPMeta::Node* mutable_slaves(int index);
-  inline ::ZPMeta::Node* add_slaves();
-  inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >&
-      slaves() const;
-  inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >*
+  int slaves_size() const;
+  private:
+  int _internal_slaves_size() const;
+  public:
+  void clear_slaves();
+  ::ZPMeta::Node* mutable_slaves(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
       mutable_slaves();
+  private:
+  const ::ZPMeta::Node& _internal_slaves(int index) const;
+  ::ZPMeta::Node* _internal_add_slaves();
+  public:
+  const ::ZPMeta::Node& slaves(int index) const;
+  ::ZPMeta::Node* add_slaves();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
+      slaves() const;
 
-  // @@protoc_insertion_point(class_scope:ZPMeta.Partitions)
- private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_state();
-  inline void clear_has_state();
-  inline void set_has_master();
-  inline void clear_has_master();
+  // repeated .ZPMeta.Node learners = 6;
+  int learners_size() const;
+  private:
+  int _internal_learners_size() const;
+  public:
+  void clear_learners();
+  ::ZPMeta::Node* mutable_learners(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
+      mutable_learners();
+  private:
+  const ::ZPMeta::Node& _internal_learners(int index) const;
+  ::ZPMeta::Node* _internal_add_learners();
+  public:
+  const ::ZPMeta::Node& learners(int index) const;
+  ::ZPMeta::Node* add_learners();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
+      learners() const;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // required .ZPMeta.Node master = 3;
+  bool has_master() const;
+  private:
+  bool _internal_has_master() const;
+  public:
+  void clear_master();
+  const ::ZPMeta::Node& master() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Node* release_master();
+  ::ZPMeta::Node* mutable_master();
+  void set_allocated_master(::ZPMeta::Node* master);
+  private:
+  const ::ZPMeta::Node& _internal_master() const;
+  ::ZPMeta::Node* _internal_mutable_master();
+  public:
+  void unsafe_arena_set_allocated_master(
+      ::ZPMeta::Node* master);
+  ::ZPMeta::Node* unsafe_arena_release_master();
 
-  ::google::protobuf::int32 id_;
-  int state_;
-  ::ZPMeta::Node* master_;
-  ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node > slaves_;
+  // required int32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  // optional bool chain = 5;
+  bool has_chain() const;
+  private:
+  bool _internal_has_chain() const;
+  public:
+  void clear_chain();
+  bool chain() const;
+  void set_chain(bool value);
+  private:
+  bool _internal_chain() const;
+  void _internal_set_chain(bool value);
+  public:
 
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
+  // required .ZPMeta.PState state = 2;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::ZPMeta::PState state() const;
+  void set_state(::ZPMeta::PState value);
+  private:
+  ::ZPMeta::PState _internal_state() const;
+  void _internal_set_state(::ZPMeta::PState value);
+  public:
 
-  void InitAsDefaultInstance();
-  static Partitions* default_instance_;
+  // @@protoc_insertion_point(class_scope:ZPMeta.Partitions)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node > slaves_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node > learners_;
+    ::ZPMeta::Node* master_;
+    int32_t id_;
+    bool chain_;
+    int state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TableName : public ::google::protobuf::Message {
+class TableName final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.TableName) */ {
  public:
-  TableName();
-  virtual ~TableName();
+  inline TableName() : TableName(nullptr) {}
+  ~TableName() override;
+  explicit PROTOBUF_CONSTEXPR TableName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TableName(const TableName& from);
+  TableName(TableName&& from) noexcept
+    : TableName() {
+    *this = ::std::move(from);
+  }
 
   inline TableName& operator=(const TableName& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline TableName& operator=(TableName&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TableName& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableName& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableName* internal_default_instance() {
+    return reinterpret_cast<const TableName*>(
+               &_TableName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(TableName* other);
+  friend void swap(TableName& a, TableName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  TableName* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TableName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableName>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TableName& from);
-  void MergeFrom(const TableName& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableName& from) {
+    TableName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableName* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.TableName";
+  }
+  protected:
+  explicit TableName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // repeated string name = 1;
-  inline int name_size() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name(int index) const;
-  inline ::std::string* mutable_name(int index);
-  inline void set_name(int index, const ::std::string& value);
-  inline void set_name(int index, const char* value);
-  inline void set_name(int index, const char* value, size_t size);
-  inline ::std::string* add_name();
-  inline void add_name(const ::std::string& value);
-  inline void add_name(const char* value);
-  inline void add_name(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& name() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_name();
+  int name_size() const;
+  private:
+  int _internal_name_size() const;
+  public:
+  void clear_name();
+  const std::string& name(int index) const;
+  std::string* mutable_name(int index);
+  void set_name(int index, const std::string& value);
+  void set_name(int index, std::string&& value);
+  void set_name(int index, const char* value);
+  void set_name(int index, const char* value, size_t size);
+  std::string* add_name();
+  void add_name(const std::string& value);
+  void add_name(std::string&& value);
+  void add_name(const char* value);
+  void add_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_name();
+  private:
+  const std::string& _internal_name(int index) const;
+  std::string* _internal_add_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.TableName)
  private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::std::string> name_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static TableName* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Table : public ::google::protobuf::Message {
+class Table final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.Table) */ {
  public:
-  Table();
-  virtual ~Table();
+  inline Table() : Table(nullptr) {}
+  ~Table() override;
+  explicit PROTOBUF_CONSTEXPR Table(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Table(const Table& from);
+  Table(Table&& from) noexcept
+    : Table() {
+    *this = ::std::move(from);
+  }
 
   inline Table& operator=(const Table& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Table& operator=(Table&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Table& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table* internal_default_instance() {
+    return reinterpret_cast<const Table*>(
+               &_Table_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(Table* other);
+  friend void swap(Table& a, Table& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Table* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Table* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Table& from);
-  void MergeFrom(const Table& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table& from) {
+    Table::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.Table";
+  }
+  protected:
+  explicit Table(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
+  enum : int {
+    kPartitionsFieldNumber = 2,
+    kNameFieldNumber = 1,
+  };
   // repeated .ZPMeta.Partitions partitions = 2;
-  inline int partitions_size() const;
-  inline void clear_partitions();
-  static const int kPartitionsFieldNumber = 2;
-  inline const ::ZPMeta::Partitions& partitions(int index) const;
-  inline ::ZPMeta::Partitions* mutable_partitions(int index);
-  inline ::ZPMeta::Partitions* add_partitions();
-  inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions >&
-      partitions() const;
-  inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions >*
+  int partitions_size() const;
+  private:
+  int _internal_partitions_size() const;
+  public:
+  void clear_partitions();
+  ::ZPMeta::Partitions* mutable_partitions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Partitions >*
       mutable_partitions();
+  private:
+  const ::ZPMeta::Partitions& _internal_partitions(int index) const;
+  ::ZPMeta::Partitions* _internal_add_partitions();
+  public:
+  const ::ZPMeta::Partitions& partitions(int index) const;
+  ::ZPMeta::Partitions* add_partitions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Partitions >&
+      partitions() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.Table)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions > partitions_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static Table* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Partitions > partitions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BasicCmdUnit : public ::google::protobuf::Message {
+class BasicCmdUnit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.BasicCmdUnit) */ {
  public:
-  BasicCmdUnit();
-  virtual ~BasicCmdUnit();
+  inline BasicCmdUnit() : BasicCmdUnit(nullptr) {}
+  ~BasicCmdUnit() override;
+  explicit PROTOBUF_CONSTEXPR BasicCmdUnit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BasicCmdUnit(const BasicCmdUnit& from);
+  BasicCmdUnit(BasicCmdUnit&& from) noexcept
+    : BasicCmdUnit() {
+    *this = ::std::move(from);
+  }
 
   inline BasicCmdUnit& operator=(const BasicCmdUnit& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline BasicCmdUnit& operator=(BasicCmdUnit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BasicCmdUnit& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BasicCmdUnit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BasicCmdUnit* internal_default_instance() {
+    return reinterpret_cast<const BasicCmdUnit*>(
+               &_BasicCmdUnit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(BasicCmdUnit* other);
+  friend void swap(BasicCmdUnit& a, BasicCmdUnit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BasicCmdUnit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BasicCmdUnit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  BasicCmdUnit* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  BasicCmdUnit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BasicCmdUnit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BasicCmdUnit& from);
-  void MergeFrom(const BasicCmdUnit& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BasicCmdUnit& from) {
+    BasicCmdUnit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BasicCmdUnit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.BasicCmdUnit";
+  }
+  protected:
+  explicit BasicCmdUnit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kNodeFieldNumber = 3,
+    kPartitionFieldNumber = 2,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // required int32 partition = 2;
-  inline bool has_partition() const;
-  inline void clear_partition();
-  static const int kPartitionFieldNumber = 2;
-  inline ::google::protobuf::int32 partition() const;
-  inline void set_partition(::google::protobuf::int32 value);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // required .ZPMeta.Node node = 3;
-  inline bool has_node() const;
-  inline void clear_node();
-  static const int kNodeFieldNumber = 3;
-  inline const ::ZPMeta::Node& node() const;
-  inline ::ZPMeta::Node* mutable_node();
-  inline ::ZPMeta::Node* release_node();
-  inline void set_allocated_node(::ZPMeta::Node* node);
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::ZPMeta::Node& node() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Node* release_node();
+  ::ZPMeta::Node* mutable_node();
+  void set_allocated_node(::ZPMeta::Node* node);
+  private:
+  const ::ZPMeta::Node& _internal_node() const;
+  ::ZPMeta::Node* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::ZPMeta::Node* node);
+  ::ZPMeta::Node* unsafe_arena_release_node();
+
+  // required int32 partition = 2;
+  bool has_partition() const;
+  private:
+  bool _internal_has_partition() const;
+  public:
+  void clear_partition();
+  int32_t partition() const;
+  void set_partition(int32_t value);
+  private:
+  int32_t _internal_partition() const;
+  void _internal_set_partition(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.BasicCmdUnit)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_partition();
-  inline void clear_has_partition();
-  inline void set_has_node();
-  inline void clear_has_node();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::ZPMeta::Node* node_;
-  ::google::protobuf::int32 partition_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static BasicCmdUnit* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::ZPMeta::Node* node_;
+    int32_t partition_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SyncOffset : public ::google::protobuf::Message {
+class SyncOffset final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.SyncOffset) */ {
  public:
-  SyncOffset();
-  virtual ~SyncOffset();
+  inline SyncOffset() : SyncOffset(nullptr) {}
+  ~SyncOffset() override;
+  explicit PROTOBUF_CONSTEXPR SyncOffset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SyncOffset(const SyncOffset& from);
+  SyncOffset(SyncOffset&& from) noexcept
+    : SyncOffset() {
+    *this = ::std::move(from);
+  }
 
   inline SyncOffset& operator=(const SyncOffset& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SyncOffset& operator=(SyncOffset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SyncOffset& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncOffset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncOffset* internal_default_instance() {
+    return reinterpret_cast<const SyncOffset*>(
+               &_SyncOffset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(SyncOffset* other);
+  friend void swap(SyncOffset& a, SyncOffset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncOffset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncOffset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SyncOffset* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SyncOffset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncOffset>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SyncOffset& from);
-  void MergeFrom(const SyncOffset& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncOffset& from) {
+    SyncOffset::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncOffset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.SyncOffset";
+  }
+  protected:
+  explicit SyncOffset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kPartitionFieldNumber = 2,
+    kFilenumFieldNumber = 3,
+    kOffsetFieldNumber = 4,
+  };
   // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
   // required int32 partition = 2;
-  inline bool has_partition() const;
-  inline void clear_partition();
-  static const int kPartitionFieldNumber = 2;
-  inline ::google::protobuf::int32 partition() const;
-  inline void set_partition(::google::protobuf::int32 value);
+  bool has_partition() const;
+  private:
+  bool _internal_has_partition() const;
+  public:
+  void clear_partition();
+  int32_t partition() const;
+  void set_partition(int32_t value);
+  private:
+  int32_t _internal_partition() const;
+  void _internal_set_partition(int32_t value);
+  public:
 
   // optional int32 filenum = 3;
-  inline bool has_filenum() const;
-  inline void clear_filenum();
-  static const int kFilenumFieldNumber = 3;
-  inline ::google::protobuf::int32 filenum() const;
-  inline void set_filenum(::google::protobuf::int32 value);
+  bool has_filenum() const;
+  private:
+  bool _internal_has_filenum() const;
+  public:
+  void clear_filenum();
+  int32_t filenum() const;
+  void set_filenum(int32_t value);
+  private:
+  int32_t _internal_filenum() const;
+  void _internal_set_filenum(int32_t value);
+  public:
 
   // optional int64 offset = 4;
-  inline bool has_offset() const;
-  inline void clear_offset();
-  static const int kOffsetFieldNumber = 4;
-  inline ::google::protobuf::int64 offset() const;
-  inline void set_offset(::google::protobuf::int64 value);
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.SyncOffset)
  private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_partition();
-  inline void clear_has_partition();
-  inline void set_has_filenum();
-  inline void clear_has_filenum();
-  inline void set_has_offset();
-  inline void clear_has_offset();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* table_name_;
-  ::google::protobuf::int32 partition_;
-  ::google::protobuf::int32 filenum_;
-  ::google::protobuf::int64 offset_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static SyncOffset* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int32_t partition_;
+    int32_t filenum_;
+    int64_t offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_Ping : public ::google::protobuf::Message {
+class MetaCmd_Ping final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.Ping) */ {
  public:
-  MetaCmd_Ping();
-  virtual ~MetaCmd_Ping();
+  inline MetaCmd_Ping() : MetaCmd_Ping(nullptr) {}
+  ~MetaCmd_Ping() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_Ping(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_Ping(const MetaCmd_Ping& from);
+  MetaCmd_Ping(MetaCmd_Ping&& from) noexcept
+    : MetaCmd_Ping() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_Ping& operator=(const MetaCmd_Ping& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_Ping& operator=(MetaCmd_Ping&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_Ping& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_Ping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_Ping* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_Ping*>(
+               &_MetaCmd_Ping_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(MetaCmd_Ping* other);
+  friend void swap(MetaCmd_Ping& a, MetaCmd_Ping& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_Ping* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_Ping* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_Ping* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_Ping* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_Ping>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_Ping& from);
-  void MergeFrom(const MetaCmd_Ping& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_Ping& from) {
+    MetaCmd_Ping::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_Ping* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.Ping";
+  }
+  protected:
+  explicit MetaCmd_Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 version = 1;
-  inline bool has_version() const;
-  inline void clear_version();
-  static const int kVersionFieldNumber = 1;
-  inline ::google::protobuf::int32 version() const;
-  inline void set_version(::google::protobuf::int32 value);
+  enum : int {
+    kOffsetFieldNumber = 3,
+    kNodeFieldNumber = 2,
+    kVersionFieldNumber = 1,
+  };
+  // repeated .ZPMeta.SyncOffset offset = 3;
+  int offset_size() const;
+  private:
+  int _internal_offset_size() const;
+  public:
+  void clear_offset();
+  ::ZPMeta::SyncOffset* mutable_offset(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::SyncOffset >*
+      mutable_offset();
+  private:
+  const ::ZPMeta::SyncOffset& _internal_offset(int index) const;
+  ::ZPMeta::SyncOffset* _internal_add_offset();
+  public:
+  const ::ZPMeta::SyncOffset& offset(int index) const;
+  ::ZPMeta::SyncOffset* add_offset();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::SyncOffset >&
+      offset() const;
 
   // required .ZPMeta.Node node = 2;
-  inline bool has_node() const;
-  inline void clear_node();
-  static const int kNodeFieldNumber = 2;
-  inline const ::ZPMeta::Node& node() const;
-  inline ::ZPMeta::Node* mutable_node();
-  inline ::ZPMeta::Node* release_node();
-  inline void set_allocated_node(::ZPMeta::Node* node);
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::ZPMeta::Node& node() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Node* release_node();
+  ::ZPMeta::Node* mutable_node();
+  void set_allocated_node(::ZPMeta::Node* node);
+  private:
+  const ::ZPMeta::Node& _internal_node() const;
+  ::ZPMeta::Node* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::ZPMeta::Node* node);
+  ::ZPMeta::Node* unsafe_arena_release_node();
 
-  // repeated .ZPMeta.SyncOffset offset = 3;
-  inline int offset_size() const;
-  inline void clear_offset();
-  static const int kOffsetFieldNumber = 3;
-  inline const ::ZPMeta::SyncOffset& offset(int index) const;
-  inline ::ZPMeta::SyncOffset* mutable_offset(int index);
-  inline ::ZPMeta::SyncOffset* add_offset();
-  inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::SyncOffset >&
-      offset() const;
-  inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::SyncOffset >*
-      mutable_offset();
+  // required int32 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Ping)
  private:
-  inline void set_has_version();
-  inline void clear_has_version();
-  inline void set_has_node();
-  inline void clear_has_node();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::Node* node_;
-  ::google::protobuf::RepeatedPtrField< ::ZPMeta::SyncOffset > offset_;
-  ::google::protobuf::int32 version_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmd_Ping* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::SyncOffset > offset_;
+    ::ZPMeta::Node* node_;
+    int32_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_Pull : public ::google::protobuf::Message {
+class MetaCmd_Pull final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.Pull) */ {
  public:
-  MetaCmd_Pull();
-  virtual ~MetaCmd_Pull();
+  inline MetaCmd_Pull() : MetaCmd_Pull(nullptr) {}
+  ~MetaCmd_Pull() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_Pull(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_Pull(const MetaCmd_Pull& from);
+  MetaCmd_Pull(MetaCmd_Pull&& from) noexcept
+    : MetaCmd_Pull() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_Pull& operator=(const MetaCmd_Pull& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_Pull& operator=(MetaCmd_Pull&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_Pull& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_Pull& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_Pull* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_Pull*>(
+               &_MetaCmd_Pull_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(MetaCmd_Pull* other);
+  friend void swap(MetaCmd_Pull& a, MetaCmd_Pull& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_Pull* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_Pull* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_Pull* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_Pull* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_Pull>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_Pull& from);
-  void MergeFrom(const MetaCmd_Pull& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_Pull& from) {
+    MetaCmd_Pull::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_Pull* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.Pull";
+  }
+  protected:
+  explicit MetaCmd_Pull(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .ZPMeta.Node node = 1;
-  inline bool has_node() const;
-  inline void clear_node();
-  static const int kNodeFieldNumber = 1;
-  inline const ::ZPMeta::Node& node() const;
-  inline ::ZPMeta::Node* mutable_node();
-  inline ::ZPMeta::Node* release_node();
-  inline void set_allocated_node(::ZPMeta::Node* node);
-
+  enum : int {
+    kNameFieldNumber = 2,
+    kNodeFieldNumber = 1,
+  };
   // optional string name = 2;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 2;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional .ZPMeta.Node node = 1;
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::ZPMeta::Node& node() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Node* release_node();
+  ::ZPMeta::Node* mutable_node();
+  void set_allocated_node(::ZPMeta::Node* node);
+  private:
+  const ::ZPMeta::Node& _internal_node() const;
+  ::ZPMeta::Node* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::ZPMeta::Node* node);
+  ::ZPMeta::Node* unsafe_arena_release_node();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Pull)
  private:
-  inline void set_has_node();
-  inline void clear_has_node();
-  inline void set_has_name();
-  inline void clear_has_name();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::Node* node_;
-  ::std::string* name_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmd_Pull* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::ZPMeta::Node* node_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_Init : public ::google::protobuf::Message {
+class MetaCmd_Init final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.Init) */ {
  public:
-  MetaCmd_Init();
-  virtual ~MetaCmd_Init();
+  inline MetaCmd_Init() : MetaCmd_Init(nullptr) {}
+  ~MetaCmd_Init() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_Init(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_Init(const MetaCmd_Init& from);
+  MetaCmd_Init(MetaCmd_Init&& from) noexcept
+    : MetaCmd_Init() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_Init& operator=(const MetaCmd_Init& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_Init& operator=(MetaCmd_Init&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_Init& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_Init& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_Init* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_Init*>(
+               &_MetaCmd_Init_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(MetaCmd_Init* other);
+  friend void swap(MetaCmd_Init& a, MetaCmd_Init& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_Init* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_Init* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_Init* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_Init* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_Init>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_Init& from);
-  void MergeFrom(const MetaCmd_Init& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_Init& from) {
+    MetaCmd_Init::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_Init* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.Init";
+  }
+  protected:
+  explicit MetaCmd_Init(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kNumFieldNumber = 2,
+    kLearnerNumFieldNumber = 4,
+    kReplicaNumFieldNumber = 3,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // required int32 num = 2;
-  inline bool has_num() const;
-  inline void clear_num();
-  static const int kNumFieldNumber = 2;
-  inline ::google::protobuf::int32 num() const;
-  inline void set_num(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Init)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_num();
-  inline void clear_has_num();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::google::protobuf::int32 num_;
+  bool has_num() const;
+  private:
+  bool _internal_has_num() const;
+  public:
+  void clear_num();
+  int32_t num() const;
+  void set_num(int32_t value);
+  private:
+  int32_t _internal_num() const;
+  void _internal_set_num(int32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional int32 learner_num = 4 [default = 0];
+  bool has_learner_num() const;
+  private:
+  bool _internal_has_learner_num() const;
+  public:
+  void clear_learner_num();
+  int32_t learner_num() const;
+  void set_learner_num(int32_t value);
+  private:
+  int32_t _internal_learner_num() const;
+  void _internal_set_learner_num(int32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
+  // optional int32 replica_num = 3 [default = 3];
+  bool has_replica_num() const;
+  private:
+  bool _internal_has_replica_num() const;
+  public:
+  void clear_replica_num();
+  int32_t replica_num() const;
+  void set_replica_num(int32_t value);
+  private:
+  int32_t _internal_replica_num() const;
+  void _internal_set_replica_num(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static MetaCmd_Init* default_instance_;
+  // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Init)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t num_;
+    int32_t learner_num_;
+    int32_t replica_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_SetMaster : public ::google::protobuf::Message {
+class MetaCmd_SetMaster final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.SetMaster) */ {
  public:
-  MetaCmd_SetMaster();
-  virtual ~MetaCmd_SetMaster();
+  inline MetaCmd_SetMaster() : MetaCmd_SetMaster(nullptr) {}
+  ~MetaCmd_SetMaster() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_SetMaster(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_SetMaster(const MetaCmd_SetMaster& from);
+  MetaCmd_SetMaster(MetaCmd_SetMaster&& from) noexcept
+    : MetaCmd_SetMaster() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_SetMaster& operator=(const MetaCmd_SetMaster& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_SetMaster& operator=(MetaCmd_SetMaster&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_SetMaster& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_SetMaster& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_SetMaster* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_SetMaster*>(
+               &_MetaCmd_SetMaster_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  void Swap(MetaCmd_SetMaster* other);
+  friend void swap(MetaCmd_SetMaster& a, MetaCmd_SetMaster& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_SetMaster* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_SetMaster* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_SetMaster* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_SetMaster* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_SetMaster>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_SetMaster& from);
-  void MergeFrom(const MetaCmd_SetMaster& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_SetMaster& from) {
+    MetaCmd_SetMaster::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_SetMaster* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.SetMaster";
+  }
+  protected:
+  explicit MetaCmd_SetMaster(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kBasicFieldNumber = 1,
+  };
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  inline bool has_basic() const;
-  inline void clear_basic();
-  static const int kBasicFieldNumber = 1;
-  inline const ::ZPMeta::BasicCmdUnit& basic() const;
-  inline ::ZPMeta::BasicCmdUnit* mutable_basic();
-  inline ::ZPMeta::BasicCmdUnit* release_basic();
-  inline void set_allocated_basic(::ZPMeta::BasicCmdUnit* basic);
+  bool has_basic() const;
+  private:
+  bool _internal_has_basic() const;
+  public:
+  void clear_basic();
+  const ::ZPMeta::BasicCmdUnit& basic() const;
+  PROTOBUF_NODISCARD ::ZPMeta::BasicCmdUnit* release_basic();
+  ::ZPMeta::BasicCmdUnit* mutable_basic();
+  void set_allocated_basic(::ZPMeta::BasicCmdUnit* basic);
+  private:
+  const ::ZPMeta::BasicCmdUnit& _internal_basic() const;
+  ::ZPMeta::BasicCmdUnit* _internal_mutable_basic();
+  public:
+  void unsafe_arena_set_allocated_basic(
+      ::ZPMeta::BasicCmdUnit* basic);
+  ::ZPMeta::BasicCmdUnit* unsafe_arena_release_basic();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.SetMaster)
  private:
-  inline void set_has_basic();
-  inline void clear_has_basic();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::BasicCmdUnit* basic_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmd_SetMaster* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::BasicCmdUnit* basic_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_AddSlave : public ::google::protobuf::Message {
+class MetaCmd_AddSlave final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.AddSlave) */ {
  public:
-  MetaCmd_AddSlave();
-  virtual ~MetaCmd_AddSlave();
+  inline MetaCmd_AddSlave() : MetaCmd_AddSlave(nullptr) {}
+  ~MetaCmd_AddSlave() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_AddSlave(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_AddSlave(const MetaCmd_AddSlave& from);
+  MetaCmd_AddSlave(MetaCmd_AddSlave&& from) noexcept
+    : MetaCmd_AddSlave() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_AddSlave& operator=(const MetaCmd_AddSlave& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_AddSlave& operator=(MetaCmd_AddSlave&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_AddSlave& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_AddSlave& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_AddSlave* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_AddSlave*>(
+               &_MetaCmd_AddSlave_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
 
-  void Swap(MetaCmd_AddSlave* other);
+  friend void swap(MetaCmd_AddSlave& a, MetaCmd_AddSlave& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_AddSlave* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_AddSlave* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_AddSlave* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_AddSlave* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_AddSlave>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_AddSlave& from);
-  void MergeFrom(const MetaCmd_AddSlave& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_AddSlave& from) {
+    MetaCmd_AddSlave::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_AddSlave* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.AddSlave";
+  }
+  protected:
+  explicit MetaCmd_AddSlave(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kBasicFieldNumber = 1,
+  };
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  inline bool has_basic() const;
-  inline void clear_basic();
-  static const int kBasicFieldNumber = 1;
-  inline const ::ZPMeta::BasicCmdUnit& basic() const;
-  inline ::ZPMeta::BasicCmdUnit* mutable_basic();
-  inline ::ZPMeta::BasicCmdUnit* release_basic();
-  inline void set_allocated_basic(::ZPMeta::BasicCmdUnit* basic);
+  bool has_basic() const;
+  private:
+  bool _internal_has_basic() const;
+  public:
+  void clear_basic();
+  const ::ZPMeta::BasicCmdUnit& basic() const;
+  PROTOBUF_NODISCARD ::ZPMeta::BasicCmdUnit* release_basic();
+  ::ZPMeta::BasicCmdUnit* mutable_basic();
+  void set_allocated_basic(::ZPMeta::BasicCmdUnit* basic);
+  private:
+  const ::ZPMeta::BasicCmdUnit& _internal_basic() const;
+  ::ZPMeta::BasicCmdUnit* _internal_mutable_basic();
+  public:
+  void unsafe_arena_set_allocated_basic(
+      ::ZPMeta::BasicCmdUnit* basic);
+  ::ZPMeta::BasicCmdUnit* unsafe_arena_release_basic();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.AddSlave)
  private:
-  inline void set_has_basic();
-  inline void clear_has_basic();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::BasicCmdUnit* basic_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmd_AddSlave* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::BasicCmdUnit* basic_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_RemoveSlave : public ::google::protobuf::Message {
+class MetaCmd_RemoveSlave final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.RemoveSlave) */ {
  public:
-  MetaCmd_RemoveSlave();
-  virtual ~MetaCmd_RemoveSlave();
+  inline MetaCmd_RemoveSlave() : MetaCmd_RemoveSlave(nullptr) {}
+  ~MetaCmd_RemoveSlave() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_RemoveSlave(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_RemoveSlave(const MetaCmd_RemoveSlave& from);
+  MetaCmd_RemoveSlave(MetaCmd_RemoveSlave&& from) noexcept
+    : MetaCmd_RemoveSlave() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_RemoveSlave& operator=(const MetaCmd_RemoveSlave& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_RemoveSlave& operator=(MetaCmd_RemoveSlave&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_RemoveSlave& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_RemoveSlave& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_RemoveSlave* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_RemoveSlave*>(
+               &_MetaCmd_RemoveSlave_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-  void Swap(MetaCmd_RemoveSlave* other);
+  friend void swap(MetaCmd_RemoveSlave& a, MetaCmd_RemoveSlave& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_RemoveSlave* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_RemoveSlave* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_RemoveSlave* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_RemoveSlave* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_RemoveSlave>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_RemoveSlave& from);
-  void MergeFrom(const MetaCmd_RemoveSlave& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_RemoveSlave& from) {
+    MetaCmd_RemoveSlave::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_RemoveSlave* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.RemoveSlave";
+  }
+  protected:
+  explicit MetaCmd_RemoveSlave(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kBasicFieldNumber = 1,
+  };
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  inline bool has_basic() const;
-  inline void clear_basic();
-  static const int kBasicFieldNumber = 1;
-  inline const ::ZPMeta::BasicCmdUnit& basic() const;
-  inline ::ZPMeta::BasicCmdUnit* mutable_basic();
-  inline ::ZPMeta::BasicCmdUnit* release_basic();
-  inline void set_allocated_basic(::ZPMeta::BasicCmdUnit* basic);
+  bool has_basic() const;
+  private:
+  bool _internal_has_basic() const;
+  public:
+  void clear_basic();
+  const ::ZPMeta::BasicCmdUnit& basic() const;
+  PROTOBUF_NODISCARD ::ZPMeta::BasicCmdUnit* release_basic();
+  ::ZPMeta::BasicCmdUnit* mutable_basic();
+  void set_allocated_basic(::ZPMeta::BasicCmdUnit* basic);
+  private:
+  const ::ZPMeta::BasicCmdUnit& _internal_basic() const;
+  ::ZPMeta::BasicCmdUnit* _internal_mutable_basic();
+  public:
+  void unsafe_arena_set_allocated_basic(
+      ::ZPMeta::BasicCmdUnit* basic);
+  ::ZPMeta::BasicCmdUnit* unsafe_arena_release_basic();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.RemoveSlave)
  private:
-  inline void set_has_basic();
-  inline void clear_has_basic();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::BasicCmdUnit* basic_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmd_RemoveSlave* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::BasicCmdUnit* basic_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd_DropTable : public ::google::protobuf::Message {
+class MetaCmd_DropTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.DropTable) */ {
  public:
-  MetaCmd_DropTable();
-  virtual ~MetaCmd_DropTable();
+  inline MetaCmd_DropTable() : MetaCmd_DropTable(nullptr) {}
+  ~MetaCmd_DropTable() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_DropTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd_DropTable(const MetaCmd_DropTable& from);
+  MetaCmd_DropTable(MetaCmd_DropTable&& from) noexcept
+    : MetaCmd_DropTable() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd_DropTable& operator=(const MetaCmd_DropTable& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd_DropTable& operator=(MetaCmd_DropTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd_DropTable& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_DropTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_DropTable* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_DropTable*>(
+               &_MetaCmd_DropTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
 
-  void Swap(MetaCmd_DropTable* other);
+  friend void swap(MetaCmd_DropTable& a, MetaCmd_DropTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_DropTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_DropTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd_DropTable* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd_DropTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_DropTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd_DropTable& from);
-  void MergeFrom(const MetaCmd_DropTable& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_DropTable& from) {
+    MetaCmd_DropTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_DropTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.DropTable";
+  }
+  protected:
+  explicit MetaCmd_DropTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.DropTable)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetaCmd_SetChain final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd.SetChain) */ {
+ public:
+  inline MetaCmd_SetChain() : MetaCmd_SetChain(nullptr) {}
+  ~MetaCmd_SetChain() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd_SetChain(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetaCmd_SetChain(const MetaCmd_SetChain& from);
+  MetaCmd_SetChain(MetaCmd_SetChain&& from) noexcept
+    : MetaCmd_SetChain() {
+    *this = ::std::move(from);
+  }
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  inline MetaCmd_SetChain& operator=(const MetaCmd_SetChain& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetaCmd_SetChain& operator=(MetaCmd_SetChain&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd_SetChain& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd_SetChain* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd_SetChain*>(
+               &_MetaCmd_SetChain_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(MetaCmd_SetChain& a, MetaCmd_SetChain& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd_SetChain* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd_SetChain* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetaCmd_SetChain* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd_SetChain>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetaCmd_SetChain& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd_SetChain& from) {
+    MetaCmd_SetChain::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd_SetChain* other);
 
-  ::std::string* name_;
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd.SetChain";
+  }
+  protected:
+  explicit MetaCmd_SetChain(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  void InitAsDefaultInstance();
-  static MetaCmd_DropTable* default_instance_;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOrderFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kPartitionFieldNumber = 2,
+    kEnableFieldNumber = 3,
+  };
+  // repeated .ZPMeta.Node order = 4;
+  int order_size() const;
+  private:
+  int _internal_order_size() const;
+  public:
+  void clear_order();
+  ::ZPMeta::Node* mutable_order(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
+      mutable_order();
+  private:
+  const ::ZPMeta::Node& _internal_order(int index) const;
+  ::ZPMeta::Node* _internal_add_order();
+  public:
+  const ::ZPMeta::Node& order(int index) const;
+  ::ZPMeta::Node* add_order();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
+      order() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required int32 partition = 2;
+  bool has_partition() const;
+  private:
+  bool _internal_has_partition() const;
+  public:
+  void clear_partition();
+  int32_t partition() const;
+  void set_partition(int32_t value);
+  private:
+  int32_t _internal_partition() const;
+  void _internal_set_partition(int32_t value);
+  public:
+
+  // required bool enable = 3;
+  bool has_enable() const;
+  private:
+  bool _internal_has_enable() const;
+  public:
+  void clear_enable();
+  bool enable() const;
+  void set_enable(bool value);
+  private:
+  bool _internal_enable() const;
+  void _internal_set_enable(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.SetChain)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node > order_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t partition_;
+    bool enable_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmd : public ::google::protobuf::Message {
+class MetaCmd final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmd) */ {
  public:
-  MetaCmd();
-  virtual ~MetaCmd();
+  inline MetaCmd() : MetaCmd(nullptr) {}
+  ~MetaCmd() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmd(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmd(const MetaCmd& from);
+  MetaCmd(MetaCmd&& from) noexcept
+    : MetaCmd() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmd& operator=(const MetaCmd& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmd& operator=(MetaCmd&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmd& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmd& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmd* internal_default_instance() {
+    return reinterpret_cast<const MetaCmd*>(
+               &_MetaCmd_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-  void Swap(MetaCmd* other);
+  friend void swap(MetaCmd& a, MetaCmd& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmd* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmd* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmd* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmd* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmd>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmd& from);
-  void MergeFrom(const MetaCmd& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmd& from) {
+    MetaCmd::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmd* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmd";
+  }
+  protected:
+  explicit MetaCmd(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1733,599 +3579,1160 @@ class MetaCmd : public ::google::protobuf::Message {
   typedef MetaCmd_AddSlave AddSlave;
   typedef MetaCmd_RemoveSlave RemoveSlave;
   typedef MetaCmd_DropTable DropTable;
+  typedef MetaCmd_SetChain SetChain;
 
   // accessors -------------------------------------------------------
 
-  // required .ZPMeta.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::ZPMeta::Type type() const;
-  inline void set_type(::ZPMeta::Type value);
-
+  enum : int {
+    kPingFieldNumber = 2,
+    kPullFieldNumber = 3,
+    kInitFieldNumber = 4,
+    kSetMasterFieldNumber = 5,
+    kAddSlaveFieldNumber = 6,
+    kRemoveSlaveFieldNumber = 7,
+    kDropTableFieldNumber = 8,
+    kSetChainFieldNumber = 9,
+    kTypeFieldNumber = 1,
+  };
   // optional .ZPMeta.MetaCmd.Ping ping = 2;
-  inline bool has_ping() const;
-  inline void clear_ping();
-  static const int kPingFieldNumber = 2;
-  inline const ::ZPMeta::MetaCmd_Ping& ping() const;
-  inline ::ZPMeta::MetaCmd_Ping* mutable_ping();
-  inline ::ZPMeta::MetaCmd_Ping* release_ping();
-  inline void set_allocated_ping(::ZPMeta::MetaCmd_Ping* ping);
+  bool has_ping() const;
+  private:
+  bool _internal_has_ping() const;
+  public:
+  void clear_ping();
+  const ::ZPMeta::MetaCmd_Ping& ping() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_Ping* release_ping();
+  ::ZPMeta::MetaCmd_Ping* mutable_ping();
+  void set_allocated_ping(::ZPMeta::MetaCmd_Ping* ping);
+  private:
+  const ::ZPMeta::MetaCmd_Ping& _internal_ping() const;
+  ::ZPMeta::MetaCmd_Ping* _internal_mutable_ping();
+  public:
+  void unsafe_arena_set_allocated_ping(
+      ::ZPMeta::MetaCmd_Ping* ping);
+  ::ZPMeta::MetaCmd_Ping* unsafe_arena_release_ping();
 
   // optional .ZPMeta.MetaCmd.Pull pull = 3;
-  inline bool has_pull() const;
-  inline void clear_pull();
-  static const int kPullFieldNumber = 3;
-  inline const ::ZPMeta::MetaCmd_Pull& pull() const;
-  inline ::ZPMeta::MetaCmd_Pull* mutable_pull();
-  inline ::ZPMeta::MetaCmd_Pull* release_pull();
-  inline void set_allocated_pull(::ZPMeta::MetaCmd_Pull* pull);
+  bool has_pull() const;
+  private:
+  bool _internal_has_pull() const;
+  public:
+  void clear_pull();
+  const ::ZPMeta::MetaCmd_Pull& pull() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_Pull* release_pull();
+  ::ZPMeta::MetaCmd_Pull* mutable_pull();
+  void set_allocated_pull(::ZPMeta::MetaCmd_Pull* pull);
+  private:
+  const ::ZPMeta::MetaCmd_Pull& _internal_pull() const;
+  ::ZPMeta::MetaCmd_Pull* _internal_mutable_pull();
+  public:
+  void unsafe_arena_set_allocated_pull(
+      ::ZPMeta::MetaCmd_Pull* pull);
+  ::ZPMeta::MetaCmd_Pull* unsafe_arena_release_pull();
 
   // optional .ZPMeta.MetaCmd.Init init = 4;
-  inline bool has_init() const;
-  inline void clear_init();
-  static const int kInitFieldNumber = 4;
-  inline const ::ZPMeta::MetaCmd_Init& init() const;
-  inline ::ZPMeta::MetaCmd_Init* mutable_init();
-  inline ::ZPMeta::MetaCmd_Init* release_init();
-  inline void set_allocated_init(::ZPMeta::MetaCmd_Init* init);
+  bool has_init() const;
+  private:
+  bool _internal_has_init() const;
+  public:
+  void clear_init();
+  const ::ZPMeta::MetaCmd_Init& init() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_Init* release_init();
+  ::ZPMeta::MetaCmd_Init* mutable_init();
+  void set_allocated_init(::ZPMeta::MetaCmd_Init* init);
+  private:
+  const ::ZPMeta::MetaCmd_Init& _internal_init() const;
+  ::ZPMeta::MetaCmd_Init* _internal_mutable_init();
+  public:
+  void unsafe_arena_set_allocated_init(
+      ::ZPMeta::MetaCmd_Init* init);
+  ::ZPMeta::MetaCmd_Init* unsafe_arena_release_init();
 
   // optional .ZPMeta.MetaCmd.SetMaster set_master = 5;
-  inline bool has_set_master() const;
-  inline void clear_set_master();
-  static const int kSetMasterFieldNumber = 5;
-  inline const ::ZPMeta::MetaCmd_SetMaster& set_master() const;
-  inline ::ZPMeta::MetaCmd_SetMaster* mutable_set_master();
-  inline ::ZPMeta::MetaCmd_SetMaster* release_set_master();
-  inline void set_allocated_set_master(::ZPMeta::MetaCmd_SetMaster* set_master);
+  bool has_set_master() const;
+  private:
+  bool _internal_has_set_master() const;
+  public:
+  void clear_set_master();
+  const ::ZPMeta::MetaCmd_SetMaster& set_master() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_SetMaster* release_set_master();
+  ::ZPMeta::MetaCmd_SetMaster* mutable_set_master();
+  void set_allocated_set_master(::ZPMeta::MetaCmd_SetMaster* set_master);
+  private:
+  const ::ZPMeta::MetaCmd_SetMaster& _internal_set_master() const;
+  ::ZPMeta::MetaCmd_SetMaster* _internal_mutable_set_master();
+  public:
+  void unsafe_arena_set_allocated_set_master(
+      ::ZPMeta::MetaCmd_SetMaster* set_master);
+  ::ZPMeta::MetaCmd_SetMaster* unsafe_arena_release_set_master();
 
   // optional .ZPMeta.MetaCmd.AddSlave add_slave = 6;
-  inline bool has_add_slave() const;
-  inline void clear_add_slave();
-  static const int kAddSlaveFieldNumber = 6;
-  inline const ::ZPMeta::MetaCmd_AddSlave& add_slave() const;
-  inline ::ZPMeta::MetaCmd_AddSlave* mutable_add_slave();
-  inline ::ZPMeta::MetaCmd_AddSlave* release_add_slave();
-  inline void set_allocated_add_slave(::ZPMeta::MetaCmd_AddSlave* add_slave);
+  bool has_add_slave() const;
+  private:
+  bool _internal_has_add_slave() const;
+  public:
+  void clear_add_slave();
+  const ::ZPMeta::MetaCmd_AddSlave& add_slave() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_AddSlave* release_add_slave();
+  ::ZPMeta::MetaCmd_AddSlave* mutable_add_slave();
+  void set_allocated_add_slave(::ZPMeta::MetaCmd_AddSlave* add_slave);
+  private:
+  const ::ZPMeta::MetaCmd_AddSlave& _internal_add_slave() const;
+  ::ZPMeta::MetaCmd_AddSlave* _internal_mutable_add_slave();
+  public:
+  void unsafe_arena_set_allocated_add_slave(
+      ::ZPMeta::MetaCmd_AddSlave* add_slave);
+  ::ZPMeta::MetaCmd_AddSlave* unsafe_arena_release_add_slave();
 
   // optional .ZPMeta.MetaCmd.RemoveSlave remove_slave = 7;
-  inline bool has_remove_slave() const;
-  inline void clear_remove_slave();
-  static const int kRemoveSlaveFieldNumber = 7;
-  inline const ::ZPMeta::MetaCmd_RemoveSlave& remove_slave() const;
-  inline ::ZPMeta::MetaCmd_RemoveSlave* mutable_remove_slave();
-  inline ::ZPMeta::MetaCmd_RemoveSlave* release_remove_slave();
-  inline void set_allocated_remove_slave(::ZPMeta::MetaCmd_RemoveSlave* remove_slave);
+  bool has_remove_slave() const;
+  private:
+  bool _internal_has_remove_slave() const;
+  public:
+  void clear_remove_slave();
+  const ::ZPMeta::MetaCmd_RemoveSlave& remove_slave() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_RemoveSlave* release_remove_slave();
+  ::ZPMeta::MetaCmd_RemoveSlave* mutable_remove_slave();
+  void set_allocated_remove_slave(::ZPMeta::MetaCmd_RemoveSlave* remove_slave);
+  private:
+  const ::ZPMeta::MetaCmd_RemoveSlave& _internal_remove_slave() const;
+  ::ZPMeta::MetaCmd_RemoveSlave* _internal_mutable_remove_slave();
+  public:
+  void unsafe_arena_set_allocated_remove_slave(
+      ::ZPMeta::MetaCmd_RemoveSlave* remove_slave);
+  ::ZPMeta::MetaCmd_RemoveSlave* unsafe_arena_release_remove_slave();
 
   // optional .ZPMeta.MetaCmd.DropTable drop_table = 8;
-  inline bool has_drop_table() const;
-  inline void clear_drop_table();
-  static const int kDropTableFieldNumber = 8;
-  inline const ::ZPMeta::MetaCmd_DropTable& drop_table() const;
-  inline ::ZPMeta::MetaCmd_DropTable* mutable_drop_table();
-  inline ::ZPMeta::MetaCmd_DropTable* release_drop_table();
-  inline void set_allocated_drop_table(::ZPMeta::MetaCmd_DropTable* drop_table);
+  bool has_drop_table() const;
+  private:
+  bool _internal_has_drop_table() const;
+  public:
+  void clear_drop_table();
+  const ::ZPMeta::MetaCmd_DropTable& drop_table() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_DropTable* release_drop_table();
+  ::ZPMeta::MetaCmd_DropTable* mutable_drop_table();
+  void set_allocated_drop_table(::ZPMeta::MetaCmd_DropTable* drop_table);
+  private:
+  const ::ZPMeta::MetaCmd_DropTable& _internal_drop_table() const;
+  ::ZPMeta::MetaCmd_DropTable* _internal_mutable_drop_table();
+  public:
+  void unsafe_arena_set_allocated_drop_table(
+      ::ZPMeta::MetaCmd_DropTable* drop_table);
+  ::ZPMeta::MetaCmd_DropTable* unsafe_arena_release_drop_table();
+
+  // optional .ZPMeta.MetaCmd.SetChain set_chain = 9;
+  bool has_set_chain() const;
+  private:
+  bool _internal_has_set_chain() const;
+  public:
+  void clear_set_chain();
+  const ::ZPMeta::MetaCmd_SetChain& set_chain() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmd_SetChain* release_set_chain();
+  ::ZPMeta::MetaCmd_SetChain* mutable_set_chain();
+  void set_allocated_set_chain(::ZPMeta::MetaCmd_SetChain* set_chain);
+  private:
+  const ::ZPMeta::MetaCmd_SetChain& _internal_set_chain() const;
+  ::ZPMeta::MetaCmd_SetChain* _internal_mutable_set_chain();
+  public:
+  void unsafe_arena_set_allocated_set_chain(
+      ::ZPMeta::MetaCmd_SetChain* set_chain);
+  ::ZPMeta::MetaCmd_SetChain* unsafe_arena_release_set_chain();
+
+  // required .ZPMeta.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::ZPMeta::Type type() const;
+  void set_type(::ZPMeta::Type value);
+  private:
+  ::ZPMeta::Type _internal_type() const;
+  void _internal_set_type(::ZPMeta::Type value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_ping();
-  inline void clear_has_ping();
-  inline void set_has_pull();
-  inline void clear_has_pull();
-  inline void set_has_init();
-  inline void clear_has_init();
-  inline void set_has_set_master();
-  inline void clear_has_set_master();
-  inline void set_has_add_slave();
-  inline void clear_has_add_slave();
-  inline void set_has_remove_slave();
-  inline void clear_has_remove_slave();
-  inline void set_has_drop_table();
-  inline void clear_has_drop_table();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::MetaCmd_Ping* ping_;
-  ::ZPMeta::MetaCmd_Pull* pull_;
-  ::ZPMeta::MetaCmd_Init* init_;
-  ::ZPMeta::MetaCmd_SetMaster* set_master_;
-  ::ZPMeta::MetaCmd_AddSlave* add_slave_;
-  ::ZPMeta::MetaCmd_RemoveSlave* remove_slave_;
-  ::ZPMeta::MetaCmd_DropTable* drop_table_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmd* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::MetaCmd_Ping* ping_;
+    ::ZPMeta::MetaCmd_Pull* pull_;
+    ::ZPMeta::MetaCmd_Init* init_;
+    ::ZPMeta::MetaCmd_SetMaster* set_master_;
+    ::ZPMeta::MetaCmd_AddSlave* add_slave_;
+    ::ZPMeta::MetaCmd_RemoveSlave* remove_slave_;
+    ::ZPMeta::MetaCmd_DropTable* drop_table_;
+    ::ZPMeta::MetaCmd_SetChain* set_chain_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmdResponse_Ping : public ::google::protobuf::Message {
+class MetaCmdResponse_Ping final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmdResponse.Ping) */ {
  public:
-  MetaCmdResponse_Ping();
-  virtual ~MetaCmdResponse_Ping();
+  inline MetaCmdResponse_Ping() : MetaCmdResponse_Ping(nullptr) {}
+  ~MetaCmdResponse_Ping() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmdResponse_Ping(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmdResponse_Ping(const MetaCmdResponse_Ping& from);
+  MetaCmdResponse_Ping(MetaCmdResponse_Ping&& from) noexcept
+    : MetaCmdResponse_Ping() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmdResponse_Ping& operator=(const MetaCmdResponse_Ping& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmdResponse_Ping& operator=(MetaCmdResponse_Ping&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmdResponse_Ping& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmdResponse_Ping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmdResponse_Ping* internal_default_instance() {
+    return reinterpret_cast<const MetaCmdResponse_Ping*>(
+               &_MetaCmdResponse_Ping_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-  void Swap(MetaCmdResponse_Ping* other);
+  friend void swap(MetaCmdResponse_Ping& a, MetaCmdResponse_Ping& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmdResponse_Ping* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmdResponse_Ping* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmdResponse_Ping* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmdResponse_Ping* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmdResponse_Ping>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmdResponse_Ping& from);
-  void MergeFrom(const MetaCmdResponse_Ping& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmdResponse_Ping& from) {
+    MetaCmdResponse_Ping::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmdResponse_Ping* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmdResponse.Ping";
+  }
+  protected:
+  explicit MetaCmdResponse_Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kVersionFieldNumber = 1,
+  };
   // required int32 version = 1;
-  inline bool has_version() const;
-  inline void clear_version();
-  static const int kVersionFieldNumber = 1;
-  inline ::google::protobuf::int32 version() const;
-  inline void set_version(::google::protobuf::int32 value);
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.Ping)
  private:
-  inline void set_has_version();
-  inline void clear_has_version();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 version_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmdResponse_Ping* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmdResponse_Pull : public ::google::protobuf::Message {
+class MetaCmdResponse_Pull final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmdResponse.Pull) */ {
  public:
-  MetaCmdResponse_Pull();
-  virtual ~MetaCmdResponse_Pull();
+  inline MetaCmdResponse_Pull() : MetaCmdResponse_Pull(nullptr) {}
+  ~MetaCmdResponse_Pull() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmdResponse_Pull(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmdResponse_Pull(const MetaCmdResponse_Pull& from);
+  MetaCmdResponse_Pull(MetaCmdResponse_Pull&& from) noexcept
+    : MetaCmdResponse_Pull() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmdResponse_Pull& operator=(const MetaCmdResponse_Pull& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmdResponse_Pull& operator=(MetaCmdResponse_Pull&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmdResponse_Pull& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmdResponse_Pull& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmdResponse_Pull* internal_default_instance() {
+    return reinterpret_cast<const MetaCmdResponse_Pull*>(
+               &_MetaCmdResponse_Pull_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-  void Swap(MetaCmdResponse_Pull* other);
+  friend void swap(MetaCmdResponse_Pull& a, MetaCmdResponse_Pull& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmdResponse_Pull* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmdResponse_Pull* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmdResponse_Pull* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmdResponse_Pull* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmdResponse_Pull>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmdResponse_Pull& from);
-  void MergeFrom(const MetaCmdResponse_Pull& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmdResponse_Pull& from) {
+    MetaCmdResponse_Pull::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmdResponse_Pull* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmdResponse.Pull";
+  }
+  protected:
+  explicit MetaCmdResponse_Pull(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 version = 1;
-  inline bool has_version() const;
-  inline void clear_version();
-  static const int kVersionFieldNumber = 1;
-  inline ::google::protobuf::int32 version() const;
-  inline void set_version(::google::protobuf::int32 value);
-
+  enum : int {
+    kInfoFieldNumber = 2,
+    kVersionFieldNumber = 1,
+  };
   // repeated .ZPMeta.Table info = 2;
-  inline int info_size() const;
-  inline void clear_info();
-  static const int kInfoFieldNumber = 2;
-  inline const ::ZPMeta::Table& info(int index) const;
-  inline ::ZPMeta::Table* mutable_info(int index);
-  inline ::ZPMeta::Table* add_info();
-  inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table >&
-      info() const;
-  inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table >*
+  int info_size() const;
+  private:
+  int _internal_info_size() const;
+  public:
+  void clear_info();
+  ::ZPMeta::Table* mutable_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Table >*
       mutable_info();
+  private:
+  const ::ZPMeta::Table& _internal_info(int index) const;
+  ::ZPMeta::Table* _internal_add_info();
+  public:
+  const ::ZPMeta::Table& info(int index) const;
+  ::ZPMeta::Table* add_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Table >&
+      info() const;
+
+  // required int32 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.Pull)
  private:
-  inline void set_has_version();
-  inline void clear_has_version();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table > info_;
-  ::google::protobuf::int32 version_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmdResponse_Pull* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Table > info_;
+    int32_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmdResponse_ListTable : public ::google::protobuf::Message {
+class MetaCmdResponse_ListTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmdResponse.ListTable) */ {
  public:
-  MetaCmdResponse_ListTable();
-  virtual ~MetaCmdResponse_ListTable();
+  inline MetaCmdResponse_ListTable() : MetaCmdResponse_ListTable(nullptr) {}
+  ~MetaCmdResponse_ListTable() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmdResponse_ListTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmdResponse_ListTable(const MetaCmdResponse_ListTable& from);
+  MetaCmdResponse_ListTable(MetaCmdResponse_ListTable&& from) noexcept
+    : MetaCmdResponse_ListTable() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmdResponse_ListTable& operator=(const MetaCmdResponse_ListTable& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmdResponse_ListTable& operator=(MetaCmdResponse_ListTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmdResponse_ListTable& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmdResponse_ListTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmdResponse_ListTable* internal_default_instance() {
+    return reinterpret_cast<const MetaCmdResponse_ListTable*>(
+               &_MetaCmdResponse_ListTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
 
-  void Swap(MetaCmdResponse_ListTable* other);
+  friend void swap(MetaCmdResponse_ListTable& a, MetaCmdResponse_ListTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmdResponse_ListTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmdResponse_ListTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmdResponse_ListTable* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmdResponse_ListTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmdResponse_ListTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmdResponse_ListTable& from);
-  void MergeFrom(const MetaCmdResponse_ListTable& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmdResponse_ListTable& from) {
+    MetaCmdResponse_ListTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmdResponse_ListTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmdResponse.ListTable";
+  }
+  protected:
+  explicit MetaCmdResponse_ListTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTablesFieldNumber = 1,
+  };
   // optional .ZPMeta.TableName tables = 1;
-  inline bool has_tables() const;
-  inline void clear_tables();
-  static const int kTablesFieldNumber = 1;
-  inline const ::ZPMeta::TableName& tables() const;
-  inline ::ZPMeta::TableName* mutable_tables();
-  inline ::ZPMeta::TableName* release_tables();
-  inline void set_allocated_tables(::ZPMeta::TableName* tables);
+  bool has_tables() const;
+  private:
+  bool _internal_has_tables() const;
+  public:
+  void clear_tables();
+  const ::ZPMeta::TableName& tables() const;
+  PROTOBUF_NODISCARD ::ZPMeta::TableName* release_tables();
+  ::ZPMeta::TableName* mutable_tables();
+  void set_allocated_tables(::ZPMeta::TableName* tables);
+  private:
+  const ::ZPMeta::TableName& _internal_tables() const;
+  ::ZPMeta::TableName* _internal_mutable_tables();
+  public:
+  void unsafe_arena_set_allocated_tables(
+      ::ZPMeta::TableName* tables);
+  ::ZPMeta::TableName* unsafe_arena_release_tables();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.ListTable)
  private:
-  inline void set_has_tables();
-  inline void clear_has_tables();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::TableName* tables_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmdResponse_ListTable* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::TableName* tables_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmdResponse_ListNode : public ::google::protobuf::Message {
+class MetaCmdResponse_ListNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmdResponse.ListNode) */ {
  public:
-  MetaCmdResponse_ListNode();
-  virtual ~MetaCmdResponse_ListNode();
+  inline MetaCmdResponse_ListNode() : MetaCmdResponse_ListNode(nullptr) {}
+  ~MetaCmdResponse_ListNode() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmdResponse_ListNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmdResponse_ListNode(const MetaCmdResponse_ListNode& from);
+  MetaCmdResponse_ListNode(MetaCmdResponse_ListNode&& from) noexcept
+    : MetaCmdResponse_ListNode() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmdResponse_ListNode& operator=(const MetaCmdResponse_ListNode& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmdResponse_ListNode& operator=(MetaCmdResponse_ListNode&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmdResponse_ListNode& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmdResponse_ListNode& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmdResponse_ListNode* internal_default_instance() {
+    return reinterpret_cast<const MetaCmdResponse_ListNode*>(
+               &_MetaCmdResponse_ListNode_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
 
-  void Swap(MetaCmdResponse_ListNode* other);
+  friend void swap(MetaCmdResponse_ListNode& a, MetaCmdResponse_ListNode& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmdResponse_ListNode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmdResponse_ListNode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmdResponse_ListNode* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmdResponse_ListNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmdResponse_ListNode>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmdResponse_ListNode& from);
-  void MergeFrom(const MetaCmdResponse_ListNode& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmdResponse_ListNode& from) {
+    MetaCmdResponse_ListNode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmdResponse_ListNode* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmdResponse.ListNode";
+  }
+  protected:
+  explicit MetaCmdResponse_ListNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNodesFieldNumber = 1,
+  };
   // optional .ZPMeta.Nodes nodes = 1;
-  inline bool has_nodes() const;
-  inline void clear_nodes();
-  static const int kNodesFieldNumber = 1;
-  inline const ::ZPMeta::Nodes& nodes() const;
-  inline ::ZPMeta::Nodes* mutable_nodes();
-  inline ::ZPMeta::Nodes* release_nodes();
-  inline void set_allocated_nodes(::ZPMeta::Nodes* nodes);
+  bool has_nodes() const;
+  private:
+  bool _internal_has_nodes() const;
+  public:
+  void clear_nodes();
+  const ::ZPMeta::Nodes& nodes() const;
+  PROTOBUF_NODISCARD ::ZPMeta::Nodes* release_nodes();
+  ::ZPMeta::Nodes* mutable_nodes();
+  void set_allocated_nodes(::ZPMeta::Nodes* nodes);
+  private:
+  const ::ZPMeta::Nodes& _internal_nodes() const;
+  ::ZPMeta::Nodes* _internal_mutable_nodes();
+  public:
+  void unsafe_arena_set_allocated_nodes(
+      ::ZPMeta::Nodes* nodes);
+  ::ZPMeta::Nodes* unsafe_arena_release_nodes();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.ListNode)
  private:
-  inline void set_has_nodes();
-  inline void clear_has_nodes();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::Nodes* nodes_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmdResponse_ListNode* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::Nodes* nodes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmdResponse_ListMeta : public ::google::protobuf::Message {
+class MetaCmdResponse_ListMeta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmdResponse.ListMeta) */ {
  public:
-  MetaCmdResponse_ListMeta();
-  virtual ~MetaCmdResponse_ListMeta();
+  inline MetaCmdResponse_ListMeta() : MetaCmdResponse_ListMeta(nullptr) {}
+  ~MetaCmdResponse_ListMeta() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmdResponse_ListMeta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmdResponse_ListMeta(const MetaCmdResponse_ListMeta& from);
+  MetaCmdResponse_ListMeta(MetaCmdResponse_ListMeta&& from) noexcept
+    : MetaCmdResponse_ListMeta() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmdResponse_ListMeta& operator=(const MetaCmdResponse_ListMeta& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmdResponse_ListMeta& operator=(MetaCmdResponse_ListMeta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmdResponse_ListMeta& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmdResponse_ListMeta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmdResponse_ListMeta* internal_default_instance() {
+    return reinterpret_cast<const MetaCmdResponse_ListMeta*>(
+               &_MetaCmdResponse_ListMeta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
 
-  void Swap(MetaCmdResponse_ListMeta* other);
+  friend void swap(MetaCmdResponse_ListMeta& a, MetaCmdResponse_ListMeta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmdResponse_ListMeta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmdResponse_ListMeta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmdResponse_ListMeta* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmdResponse_ListMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmdResponse_ListMeta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmdResponse_ListMeta& from);
-  void MergeFrom(const MetaCmdResponse_ListMeta& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmdResponse_ListMeta& from) {
+    MetaCmdResponse_ListMeta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmdResponse_ListMeta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmdResponse.ListMeta";
+  }
+  protected:
+  explicit MetaCmdResponse_ListMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNodesFieldNumber = 1,
+  };
   // required .ZPMeta.MetaNodes nodes = 1;
-  inline bool has_nodes() const;
-  inline void clear_nodes();
-  static const int kNodesFieldNumber = 1;
-  inline const ::ZPMeta::MetaNodes& nodes() const;
-  inline ::ZPMeta::MetaNodes* mutable_nodes();
-  inline ::ZPMeta::MetaNodes* release_nodes();
-  inline void set_allocated_nodes(::ZPMeta::MetaNodes* nodes);
+  bool has_nodes() const;
+  private:
+  bool _internal_has_nodes() const;
+  public:
+  void clear_nodes();
+  const ::ZPMeta::MetaNodes& nodes() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaNodes* release_nodes();
+  ::ZPMeta::MetaNodes* mutable_nodes();
+  void set_allocated_nodes(::ZPMeta::MetaNodes* nodes);
+  private:
+  const ::ZPMeta::MetaNodes& _internal_nodes() const;
+  ::ZPMeta::MetaNodes* _internal_mutable_nodes();
+  public:
+  void unsafe_arena_set_allocated_nodes(
+      ::ZPMeta::MetaNodes* nodes);
+  ::ZPMeta::MetaNodes* unsafe_arena_release_nodes();
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.ListMeta)
  private:
-  inline void set_has_nodes();
-  inline void clear_has_nodes();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::ZPMeta::MetaNodes* nodes_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmdResponse_ListMeta* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ZPMeta::MetaNodes* nodes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MetaCmdResponse : public ::google::protobuf::Message {
+class MetaCmdResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ZPMeta.MetaCmdResponse) */ {
  public:
-  MetaCmdResponse();
-  virtual ~MetaCmdResponse();
+  inline MetaCmdResponse() : MetaCmdResponse(nullptr) {}
+  ~MetaCmdResponse() override;
+  explicit PROTOBUF_CONSTEXPR MetaCmdResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MetaCmdResponse(const MetaCmdResponse& from);
+  MetaCmdResponse(MetaCmdResponse&& from) noexcept
+    : MetaCmdResponse() {
+    *this = ::std::move(from);
+  }
 
   inline MetaCmdResponse& operator=(const MetaCmdResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MetaCmdResponse& operator=(MetaCmdResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MetaCmdResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaCmdResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaCmdResponse* internal_default_instance() {
+    return reinterpret_cast<const MetaCmdResponse*>(
+               &_MetaCmdResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
 
-  void Swap(MetaCmdResponse* other);
+  friend void swap(MetaCmdResponse& a, MetaCmdResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaCmdResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaCmdResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MetaCmdResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MetaCmdResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaCmdResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MetaCmdResponse& from);
-  void MergeFrom(const MetaCmdResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaCmdResponse& from) {
+    MetaCmdResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaCmdResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ZPMeta.MetaCmdResponse";
+  }
+  protected:
+  explicit MetaCmdResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2337,214 +4744,280 @@ class MetaCmdResponse : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // required .ZPMeta.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::ZPMeta::Type type() const;
-  inline void set_type(::ZPMeta::Type value);
-
-  // required .ZPMeta.StatusCode code = 2;
-  inline bool has_code() const;
-  inline void clear_code();
-  static const int kCodeFieldNumber = 2;
-  inline ::ZPMeta::StatusCode code() const;
-  inline void set_code(::ZPMeta::StatusCode value);
-
+  enum : int {
+    kMsgFieldNumber = 3,
+    kPingFieldNumber = 4,
+    kPullFieldNumber = 5,
+    kListTableFieldNumber = 6,
+    kListNodeFieldNumber = 7,
+    kListMetaFieldNumber = 8,
+    kCodeFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
   // optional string msg = 3;
-  inline bool has_msg() const;
-  inline void clear_msg();
-  static const int kMsgFieldNumber = 3;
-  inline const ::std::string& msg() const;
-  inline void set_msg(const ::std::string& value);
-  inline void set_msg(const char* value);
-  inline void set_msg(const char* value, size_t size);
-  inline ::std::string* mutable_msg();
-  inline ::std::string* release_msg();
-  inline void set_allocated_msg(::std::string* msg);
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
 
   // optional .ZPMeta.MetaCmdResponse.Ping ping = 4;
-  inline bool has_ping() const;
-  inline void clear_ping();
-  static const int kPingFieldNumber = 4;
-  inline const ::ZPMeta::MetaCmdResponse_Ping& ping() const;
-  inline ::ZPMeta::MetaCmdResponse_Ping* mutable_ping();
-  inline ::ZPMeta::MetaCmdResponse_Ping* release_ping();
-  inline void set_allocated_ping(::ZPMeta::MetaCmdResponse_Ping* ping);
+  bool has_ping() const;
+  private:
+  bool _internal_has_ping() const;
+  public:
+  void clear_ping();
+  const ::ZPMeta::MetaCmdResponse_Ping& ping() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmdResponse_Ping* release_ping();
+  ::ZPMeta::MetaCmdResponse_Ping* mutable_ping();
+  void set_allocated_ping(::ZPMeta::MetaCmdResponse_Ping* ping);
+  private:
+  const ::ZPMeta::MetaCmdResponse_Ping& _internal_ping() const;
+  ::ZPMeta::MetaCmdResponse_Ping* _internal_mutable_ping();
+  public:
+  void unsafe_arena_set_allocated_ping(
+      ::ZPMeta::MetaCmdResponse_Ping* ping);
+  ::ZPMeta::MetaCmdResponse_Ping* unsafe_arena_release_ping();
 
   // optional .ZPMeta.MetaCmdResponse.Pull pull = 5;
-  inline bool has_pull() const;
-  inline void clear_pull();
-  static const int kPullFieldNumber = 5;
-  inline const ::ZPMeta::MetaCmdResponse_Pull& pull() const;
-  inline ::ZPMeta::MetaCmdResponse_Pull* mutable_pull();
-  inline ::ZPMeta::MetaCmdResponse_Pull* release_pull();
-  inline void set_allocated_pull(::ZPMeta::MetaCmdResponse_Pull* pull);
+  bool has_pull() const;
+  private:
+  bool _internal_has_pull() const;
+  public:
+  void clear_pull();
+  const ::ZPMeta::MetaCmdResponse_Pull& pull() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmdResponse_Pull* release_pull();
+  ::ZPMeta::MetaCmdResponse_Pull* mutable_pull();
+  void set_allocated_pull(::ZPMeta::MetaCmdResponse_Pull* pull);
+  private:
+  const ::ZPMeta::MetaCmdResponse_Pull& _internal_pull() const;
+  ::ZPMeta::MetaCmdResponse_Pull* _internal_mutable_pull();
+  public:
+  void unsafe_arena_set_allocated_pull(
+      ::ZPMeta::MetaCmdResponse_Pull* pull);
+  ::ZPMeta::MetaCmdResponse_Pull* unsafe_arena_release_pull();
 
   // optional .ZPMeta.MetaCmdResponse.ListTable list_table = 6;
-  inline bool has_list_table() const;
-  inline void clear_list_table();
-  static const int kListTableFieldNumber = 6;
-  inline const ::ZPMeta::MetaCmdResponse_ListTable& list_table() const;
-  inline ::ZPMeta::MetaCmdResponse_ListTable* mutable_list_table();
-  inline ::ZPMeta::MetaCmdResponse_ListTable* release_list_table();
-  inline void set_allocated_list_table(::ZPMeta::MetaCmdResponse_ListTable* list_table);
+  bool has_list_table() const;
+  private:
+  bool _internal_has_list_table() const;
+  public:
+  void clear_list_table();
+  const ::ZPMeta::MetaCmdResponse_ListTable& list_table() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmdResponse_ListTable* release_list_table();
+  ::ZPMeta::MetaCmdResponse_ListTable* mutable_list_table();
+  void set_allocated_list_table(::ZPMeta::MetaCmdResponse_ListTable* list_table);
+  private:
+  const ::ZPMeta::MetaCmdResponse_ListTable& _internal_list_table() const;
+  ::ZPMeta::MetaCmdResponse_ListTable* _internal_mutable_list_table();
+  public:
+  void unsafe_arena_set_allocated_list_table(
+      ::ZPMeta::MetaCmdResponse_ListTable* list_table);
+  ::ZPMeta::MetaCmdResponse_ListTable* unsafe_arena_release_list_table();
 
   // optional .ZPMeta.MetaCmdResponse.ListNode list_node = 7;
-  inline bool has_list_node() const;
-  inline void clear_list_node();
-  static const int kListNodeFieldNumber = 7;
-  inline const ::ZPMeta::MetaCmdResponse_ListNode& list_node() const;
-  inline ::ZPMeta::MetaCmdResponse_ListNode* mutable_list_node();
-  inline ::ZPMeta::MetaCmdResponse_ListNode* release_list_node();
-  inline void set_allocated_list_node(::ZPMeta::MetaCmdResponse_ListNode* list_node);
+  bool has_list_node() const;
+  private:
+  bool _internal_has_list_node() const;
+  public:
+  void clear_list_node();
+  const ::ZPMeta::MetaCmdResponse_ListNode& list_node() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmdResponse_ListNode* release_list_node();
+  ::ZPMeta::MetaCmdResponse_ListNode* mutable_list_node();
+  void set_allocated_list_node(::ZPMeta::MetaCmdResponse_ListNode* list_node);
+  private:
+  const ::ZPMeta::MetaCmdResponse_ListNode& _internal_list_node() const;
+  ::ZPMeta::MetaCmdResponse_ListNode* _internal_mutable_list_node();
+  public:
+  void unsafe_arena_set_allocated_list_node(
+      ::ZPMeta::MetaCmdResponse_ListNode* list_node);
+  ::ZPMeta::MetaCmdResponse_ListNode* unsafe_arena_release_list_node();
+
+  // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
+  bool has_list_meta() const;
+  private:
+  bool _internal_has_list_meta() const;
+  public:
+  void clear_list_meta();
+  const ::ZPMeta::MetaCmdResponse_ListMeta& list_meta() const;
+  PROTOBUF_NODISCARD ::ZPMeta::MetaCmdResponse_ListMeta* release_list_meta();
+  ::ZPMeta::MetaCmdResponse_ListMeta* mutable_list_meta();
+  void set_allocated_list_meta(::ZPMeta::MetaCmdResponse_ListMeta* list_meta);
+  private:
+  const ::ZPMeta::MetaCmdResponse_ListMeta& _internal_list_meta() const;
+  ::ZPMeta::MetaCmdResponse_ListMeta* _internal_mutable_list_meta();
+  public:
+  void unsafe_arena_set_allocated_list_meta(
+      ::ZPMeta::MetaCmdResponse_ListMeta* list_meta);
+  ::ZPMeta::MetaCmdResponse_ListMeta* unsafe_arena_release_list_meta();
+
+  // required .ZPMeta.StatusCode code = 2;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  ::ZPMeta::StatusCode code() const;
+  void set_code(::ZPMeta::StatusCode value);
+  private:
+  ::ZPMeta::StatusCode _internal_code() const;
+  void _internal_set_code(::ZPMeta::StatusCode value);
+  public:
 
-  // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
-  inline bool has_list_meta() const;
-  inline void clear_list_meta();
-  static const int kListMetaFieldNumber = 8;
-  inline const ::ZPMeta::MetaCmdResponse_ListMeta& list_meta() const;
-  inline ::ZPMeta::MetaCmdResponse_ListMeta* mutable_list_meta();
-  inline ::ZPMeta::MetaCmdResponse_ListMeta* release_list_meta();
-  inline void set_allocated_list_meta(::ZPMeta::MetaCmdResponse_ListMeta* list_meta);
+  // required .ZPMeta.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::ZPMeta::Type type() const;
+  void set_type(::ZPMeta::Type value);
+  private:
+  ::ZPMeta::Type _internal_type() const;
+  void _internal_set_type(::ZPMeta::Type value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_code();
-  inline void clear_has_code();
-  inline void set_has_msg();
-  inline void clear_has_msg();
-  inline void set_has_ping();
-  inline void clear_has_ping();
-  inline void set_has_pull();
-  inline void clear_has_pull();
-  inline void set_has_list_table();
-  inline void clear_has_list_table();
-  inline void set_has_list_node();
-  inline void clear_has_list_node();
-  inline void set_has_list_meta();
-  inline void clear_has_list_meta();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  int type_;
-  int code_;
-  ::std::string* msg_;
-  ::ZPMeta::MetaCmdResponse_Ping* ping_;
-  ::ZPMeta::MetaCmdResponse_Pull* pull_;
-  ::ZPMeta::MetaCmdResponse_ListTable* list_table_;
-  ::ZPMeta::MetaCmdResponse_ListNode* list_node_;
-  ::ZPMeta::MetaCmdResponse_ListMeta* list_meta_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
-
-  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
-  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
-  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
-
-  void InitAsDefaultInstance();
-  static MetaCmdResponse* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::ZPMeta::MetaCmdResponse_Ping* ping_;
+    ::ZPMeta::MetaCmdResponse_Pull* pull_;
+    ::ZPMeta::MetaCmdResponse_ListTable* list_table_;
+    ::ZPMeta::MetaCmdResponse_ListNode* list_node_;
+    ::ZPMeta::MetaCmdResponse_ListMeta* list_meta_;
+    int code_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_zp_5fmeta_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Node
 
 // required string ip = 1;
-inline bool Node::has_ip() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Node::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Node::set_has_ip() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Node::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Node::has_ip() const {
+  return _internal_has_ip();
 }
 inline void Node::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
-}
-inline const ::std::string& Node::ip() const {
-  return *ip_;
-}
-inline void Node::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
-}
-inline void Node::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
-}
-inline void Node::set_ip(const char* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Node::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
-}
-inline ::std::string* Node::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Node::ip() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.Node.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.Node.ip)
+}
+inline std::string* Node::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Node.ip)
+  return _s;
+}
+inline const std::string& Node::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void Node::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_ip() {
+  // @@protoc_insertion_point(field_release:ZPMeta.Node.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Node::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
-  } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.Node.ip)
 }
 
 // required int32 port = 2;
+inline bool Node::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool Node::has_port() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_port();
 }
-inline void Node::set_has_port() {
-  _has_bits_[0] |= 0x00000002u;
+inline void Node::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Node::clear_has_port() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t Node::_internal_port() const {
+  return _impl_.port_;
 }
-inline void Node::clear_port() {
-  port_ = 0;
-  clear_has_port();
+inline int32_t Node::port() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.Node.port)
+  return _internal_port();
 }
-inline ::google::protobuf::int32 Node::port() const {
-  return port_;
+inline void Node::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.port_ = value;
 }
-inline void Node::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
+inline void Node::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.Node.port)
 }
 
 // -------------------------------------------------------------------
@@ -2552,63 +5025,121 @@ inline void Node::set_port(::google::protobuf::int32 value) {
 // NodeStatus
 
 // required .ZPMeta.Node node = 1;
-inline bool NodeStatus::has_node() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool NodeStatus::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.node_ != nullptr);
+  return value;
 }
-inline void NodeStatus::set_has_node() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void NodeStatus::clear_has_node() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool NodeStatus::has_node() const {
+  return _internal_has_node();
 }
 inline void NodeStatus::clear_node() {
-  if (node_ != NULL) node_->::ZPMeta::Node::Clear();
-  clear_has_node();
+  if (_impl_.node_ != nullptr) _impl_.node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::Node& NodeStatus::_internal_node() const {
+  const ::ZPMeta::Node* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Node&>(
+      ::ZPMeta::_Node_default_instance_);
 }
 inline const ::ZPMeta::Node& NodeStatus::node() const {
-  return node_ != NULL ? *node_ : *default_instance_->node_;
+  // @@protoc_insertion_point(field_get:ZPMeta.NodeStatus.node)
+  return _internal_node();
 }
-inline ::ZPMeta::Node* NodeStatus::mutable_node() {
-  set_has_node();
-  if (node_ == NULL) node_ = new ::ZPMeta::Node;
-  return node_;
+inline void NodeStatus::unsafe_arena_set_allocated_node(
+    ::ZPMeta::Node* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
+  if (node) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.NodeStatus.node)
 }
 inline ::ZPMeta::Node* NodeStatus::release_node() {
-  clear_has_node();
-  ::ZPMeta::Node* temp = node_;
-  node_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::ZPMeta::Node* NodeStatus::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:ZPMeta.NodeStatus.node)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::Node* NodeStatus::_internal_mutable_node() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Node>(GetArenaForAllocation());
+    _impl_.node_ = p;
+  }
+  return _impl_.node_;
+}
+inline ::ZPMeta::Node* NodeStatus::mutable_node() {
+  ::ZPMeta::Node* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.NodeStatus.node)
+  return _msg;
+}
 inline void NodeStatus::set_allocated_node(::ZPMeta::Node* node) {
-  delete node_;
-  node_ = node;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
+  }
   if (node) {
-    set_has_node();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_node();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.NodeStatus.node)
 }
 
 // required int32 status = 2;
+inline bool NodeStatus::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool NodeStatus::has_status() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_status();
 }
-inline void NodeStatus::set_has_status() {
-  _has_bits_[0] |= 0x00000002u;
+inline void NodeStatus::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void NodeStatus::clear_has_status() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t NodeStatus::_internal_status() const {
+  return _impl_.status_;
 }
-inline void NodeStatus::clear_status() {
-  status_ = 0;
-  clear_has_status();
+inline int32_t NodeStatus::status() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.NodeStatus.status)
+  return _internal_status();
 }
-inline ::google::protobuf::int32 NodeStatus::status() const {
-  return status_;
+inline void NodeStatus::_internal_set_status(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_ = value;
 }
-inline void NodeStatus::set_status(::google::protobuf::int32 value) {
-  set_has_status();
-  status_ = value;
+inline void NodeStatus::set_status(int32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.NodeStatus.status)
 }
 
 // -------------------------------------------------------------------
@@ -2616,28 +5147,43 @@ inline void NodeStatus::set_status(::google::protobuf::int32 value) {
 // Nodes
 
 // repeated .ZPMeta.NodeStatus nodes = 1;
+inline int Nodes::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
 inline int Nodes::nodes_size() const {
-  return nodes_.size();
+  return _internal_nodes_size();
 }
 inline void Nodes::clear_nodes() {
-  nodes_.Clear();
+  _impl_.nodes_.Clear();
+}
+inline ::ZPMeta::NodeStatus* Nodes::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Nodes.nodes)
+  return _impl_.nodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::NodeStatus >*
+Nodes::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.Nodes.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::ZPMeta::NodeStatus& Nodes::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
 }
 inline const ::ZPMeta::NodeStatus& Nodes::nodes(int index) const {
-  return nodes_.Get(index);
+  // @@protoc_insertion_point(field_get:ZPMeta.Nodes.nodes)
+  return _internal_nodes(index);
 }
-inline ::ZPMeta::NodeStatus* Nodes::mutable_nodes(int index) {
-  return nodes_.Mutable(index);
+inline ::ZPMeta::NodeStatus* Nodes::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
 }
 inline ::ZPMeta::NodeStatus* Nodes::add_nodes() {
-  return nodes_.Add();
+  ::ZPMeta::NodeStatus* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:ZPMeta.Nodes.nodes)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::NodeStatus >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::NodeStatus >&
 Nodes::nodes() const {
-  return nodes_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::NodeStatus >*
-Nodes::mutable_nodes() {
-  return &nodes_;
+  // @@protoc_insertion_point(field_list:ZPMeta.Nodes.nodes)
+  return _impl_.nodes_;
 }
 
 // -------------------------------------------------------------------
@@ -2645,66 +5191,133 @@ Nodes::mutable_nodes() {
 // MetaNodes
 
 // repeated .ZPMeta.Node followers = 1;
+inline int MetaNodes::_internal_followers_size() const {
+  return _impl_.followers_.size();
+}
 inline int MetaNodes::followers_size() const {
-  return followers_.size();
+  return _internal_followers_size();
 }
 inline void MetaNodes::clear_followers() {
-  followers_.Clear();
+  _impl_.followers_.Clear();
+}
+inline ::ZPMeta::Node* MetaNodes::mutable_followers(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaNodes.followers)
+  return _impl_.followers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
+MetaNodes::mutable_followers() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.MetaNodes.followers)
+  return &_impl_.followers_;
+}
+inline const ::ZPMeta::Node& MetaNodes::_internal_followers(int index) const {
+  return _impl_.followers_.Get(index);
 }
 inline const ::ZPMeta::Node& MetaNodes::followers(int index) const {
-  return followers_.Get(index);
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaNodes.followers)
+  return _internal_followers(index);
 }
-inline ::ZPMeta::Node* MetaNodes::mutable_followers(int index) {
-  return followers_.Mutable(index);
+inline ::ZPMeta::Node* MetaNodes::_internal_add_followers() {
+  return _impl_.followers_.Add();
 }
 inline ::ZPMeta::Node* MetaNodes::add_followers() {
-  return followers_.Add();
+  ::ZPMeta::Node* _add = _internal_add_followers();
+  // @@protoc_insertion_point(field_add:ZPMeta.MetaNodes.followers)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
 MetaNodes::followers() const {
-  return followers_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >*
-MetaNodes::mutable_followers() {
-  return &followers_;
+  // @@protoc_insertion_point(field_list:ZPMeta.MetaNodes.followers)
+  return _impl_.followers_;
 }
 
 // optional .ZPMeta.Node leader = 2;
-inline bool MetaNodes::has_leader() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void MetaNodes::set_has_leader() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool MetaNodes::_internal_has_leader() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.leader_ != nullptr);
+  return value;
 }
-inline void MetaNodes::clear_has_leader() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool MetaNodes::has_leader() const {
+  return _internal_has_leader();
 }
 inline void MetaNodes::clear_leader() {
-  if (leader_ != NULL) leader_->::ZPMeta::Node::Clear();
-  clear_has_leader();
+  if (_impl_.leader_ != nullptr) _impl_.leader_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::Node& MetaNodes::_internal_leader() const {
+  const ::ZPMeta::Node* p = _impl_.leader_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Node&>(
+      ::ZPMeta::_Node_default_instance_);
 }
 inline const ::ZPMeta::Node& MetaNodes::leader() const {
-  return leader_ != NULL ? *leader_ : *default_instance_->leader_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaNodes.leader)
+  return _internal_leader();
 }
-inline ::ZPMeta::Node* MetaNodes::mutable_leader() {
-  set_has_leader();
-  if (leader_ == NULL) leader_ = new ::ZPMeta::Node;
-  return leader_;
+inline void MetaNodes::unsafe_arena_set_allocated_leader(
+    ::ZPMeta::Node* leader) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_);
+  }
+  _impl_.leader_ = leader;
+  if (leader) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaNodes.leader)
 }
 inline ::ZPMeta::Node* MetaNodes::release_leader() {
-  clear_has_leader();
-  ::ZPMeta::Node* temp = leader_;
-  leader_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.leader_;
+  _impl_.leader_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::Node* MetaNodes::unsafe_arena_release_leader() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaNodes.leader)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.leader_;
+  _impl_.leader_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::Node* MetaNodes::_internal_mutable_leader() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.leader_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Node>(GetArenaForAllocation());
+    _impl_.leader_ = p;
+  }
+  return _impl_.leader_;
+}
+inline ::ZPMeta::Node* MetaNodes::mutable_leader() {
+  ::ZPMeta::Node* _msg = _internal_mutable_leader();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaNodes.leader)
+  return _msg;
+}
 inline void MetaNodes::set_allocated_leader(::ZPMeta::Node* leader) {
-  delete leader_;
-  leader_ = leader;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.leader_;
+  }
   if (leader) {
-    set_has_leader();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(leader);
+    if (message_arena != submessage_arena) {
+      leader = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leader, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_leader();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.leader_ = leader;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaNodes.leader)
 }
 
 // -------------------------------------------------------------------
@@ -2712,111 +5325,258 @@ inline void MetaNodes::set_allocated_leader(::ZPMeta::Node* leader) {
 // Partitions
 
 // required int32 id = 1;
+inline bool Partitions::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool Partitions::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_id();
 }
-inline void Partitions::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline void Partitions::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Partitions::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t Partitions::_internal_id() const {
+  return _impl_.id_;
 }
-inline void Partitions::clear_id() {
-  id_ = 0;
-  clear_has_id();
+inline int32_t Partitions::id() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.Partitions.id)
+  return _internal_id();
 }
-inline ::google::protobuf::int32 Partitions::id() const {
-  return id_;
+inline void Partitions::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
 }
-inline void Partitions::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void Partitions::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.Partitions.id)
 }
 
 // required .ZPMeta.PState state = 2;
-inline bool Partitions::has_state() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Partitions::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Partitions::set_has_state() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Partitions::clear_has_state() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Partitions::has_state() const {
+  return _internal_has_state();
 }
 inline void Partitions::clear_state() {
-  state_ = 1;
-  clear_has_state();
+  _impl_.state_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::ZPMeta::PState Partitions::_internal_state() const {
+  return static_cast< ::ZPMeta::PState >(_impl_.state_);
 }
 inline ::ZPMeta::PState Partitions::state() const {
-  return static_cast< ::ZPMeta::PState >(state_);
+  // @@protoc_insertion_point(field_get:ZPMeta.Partitions.state)
+  return _internal_state();
 }
-inline void Partitions::set_state(::ZPMeta::PState value) {
+inline void Partitions::_internal_set_state(::ZPMeta::PState value) {
   assert(::ZPMeta::PState_IsValid(value));
-  set_has_state();
-  state_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.state_ = value;
+}
+inline void Partitions::set_state(::ZPMeta::PState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.Partitions.state)
 }
 
 // required .ZPMeta.Node master = 3;
-inline bool Partitions::has_master() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Partitions::set_has_master() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Partitions::_internal_has_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.master_ != nullptr);
+  return value;
 }
-inline void Partitions::clear_has_master() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool Partitions::has_master() const {
+  return _internal_has_master();
 }
 inline void Partitions::clear_master() {
-  if (master_ != NULL) master_->::ZPMeta::Node::Clear();
-  clear_has_master();
+  if (_impl_.master_ != nullptr) _impl_.master_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::Node& Partitions::_internal_master() const {
+  const ::ZPMeta::Node* p = _impl_.master_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Node&>(
+      ::ZPMeta::_Node_default_instance_);
 }
 inline const ::ZPMeta::Node& Partitions::master() const {
-  return master_ != NULL ? *master_ : *default_instance_->master_;
+  // @@protoc_insertion_point(field_get:ZPMeta.Partitions.master)
+  return _internal_master();
 }
-inline ::ZPMeta::Node* Partitions::mutable_master() {
-  set_has_master();
-  if (master_ == NULL) master_ = new ::ZPMeta::Node;
-  return master_;
+inline void Partitions::unsafe_arena_set_allocated_master(
+    ::ZPMeta::Node* master) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_);
+  }
+  _impl_.master_ = master;
+  if (master) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.Partitions.master)
 }
 inline ::ZPMeta::Node* Partitions::release_master() {
-  clear_has_master();
-  ::ZPMeta::Node* temp = master_;
-  master_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.master_;
+  _impl_.master_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::Node* Partitions::unsafe_arena_release_master() {
+  // @@protoc_insertion_point(field_release:ZPMeta.Partitions.master)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.master_;
+  _impl_.master_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::Node* Partitions::_internal_mutable_master() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.master_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Node>(GetArenaForAllocation());
+    _impl_.master_ = p;
+  }
+  return _impl_.master_;
+}
+inline ::ZPMeta::Node* Partitions::mutable_master() {
+  ::ZPMeta::Node* _msg = _internal_mutable_master();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Partitions.master)
+  return _msg;
+}
 inline void Partitions::set_allocated_master(::ZPMeta::Node* master) {
-  delete master_;
-  master_ = master;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.master_;
+  }
   if (master) {
-    set_has_master();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(master);
+    if (message_arena != submessage_arena) {
+      master = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, master, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_master();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.master_ = master;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.Partitions.master)
 }
 
 // repeated .ZPMeta.Node slaves = 4;
+inline int Partitions::_internal_slaves_size() const {
+  return _impl_.slaves_.size();
+}
 inline int Partitions::slaves_size() const {
-  return slaves_.size();
+  return _internal_slaves_size();
 }
 inline void Partitions::clear_slaves() {
-  slaves_.Clear();
+  _impl_.slaves_.Clear();
+}
+inline ::ZPMeta::Node* Partitions::mutable_slaves(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Partitions.slaves)
+  return _impl_.slaves_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
+Partitions::mutable_slaves() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.Partitions.slaves)
+  return &_impl_.slaves_;
+}
+inline const ::ZPMeta::Node& Partitions::_internal_slaves(int index) const {
+  return _impl_.slaves_.Get(index);
 }
 inline const ::ZPMeta::Node& Partitions::slaves(int index) const {
-  return slaves_.Get(index);
+  // @@protoc_insertion_point(field_get:ZPMeta.Partitions.slaves)
+  return _internal_slaves(index);
 }
-inline ::ZPMeta::Node* Partitions::mutable_slaves(int index) {
-  return slaves_.Mutable(index);
+inline ::ZPMeta::Node* Partitions::_internal_add_slaves() {
+  return _impl_.slaves_.Add();
 }
 inline ::ZPMeta::Node* Partitions::add_slaves() {
-  return slaves_.Add();
+  ::ZPMeta::Node* _add = _internal_add_slaves();
+  // @@protoc_insertion_point(field_add:ZPMeta.Partitions.slaves)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
 Partitions::slaves() const {
-  return slaves_;
+  // @@protoc_insertion_point(field_list:ZPMeta.Partitions.slaves)
+  return _impl_.slaves_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Node >*
-Partitions::mutable_slaves() {
-  return &slaves_;
+
+// optional bool chain = 5;
+inline bool Partitions::_internal_has_chain() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Partitions::has_chain() const {
+  return _internal_has_chain();
+}
+inline void Partitions::clear_chain() {
+  _impl_.chain_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Partitions::_internal_chain() const {
+  return _impl_.chain_;
+}
+inline bool Partitions::chain() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.Partitions.chain)
+  return _internal_chain();
+}
+inline void Partitions::_internal_set_chain(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.chain_ = value;
+}
+inline void Partitions::set_chain(bool value) {
+  _internal_set_chain(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.Partitions.chain)
+}
+
+// repeated .ZPMeta.Node learners = 6;
+inline int Partitions::_internal_learners_size() const {
+  return _impl_.learners_.size();
+}
+inline int Partitions::learners_size() const {
+  return _internal_learners_size();
+}
+inline void Partitions::clear_learners() {
+  _impl_.learners_.Clear();
+}
+inline ::ZPMeta::Node* Partitions::mutable_learners(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Partitions.learners)
+  return _impl_.learners_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
+Partitions::mutable_learners() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.Partitions.learners)
+  return &_impl_.learners_;
+}
+inline const ::ZPMeta::Node& Partitions::_internal_learners(int index) const {
+  return _impl_.learners_.Get(index);
+}
+inline const ::ZPMeta::Node& Partitions::learners(int index) const {
+  // @@protoc_insertion_point(field_get:ZPMeta.Partitions.learners)
+  return _internal_learners(index);
+}
+inline ::ZPMeta::Node* Partitions::_internal_add_learners() {
+  return _impl_.learners_.Add();
+}
+inline ::ZPMeta::Node* Partitions::add_learners() {
+  ::ZPMeta::Node* _add = _internal_add_learners();
+  // @@protoc_insertion_point(field_add:ZPMeta.Partitions.learners)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
+Partitions::learners() const {
+  // @@protoc_insertion_point(field_list:ZPMeta.Partitions.learners)
+  return _impl_.learners_;
 }
 
 // -------------------------------------------------------------------
@@ -2824,47 +5584,78 @@ Partitions::mutable_slaves() {
 // TableName
 
 // repeated string name = 1;
+inline int TableName::_internal_name_size() const {
+  return _impl_.name_.size();
+}
 inline int TableName::name_size() const {
-  return name_.size();
+  return _internal_name_size();
 }
 inline void TableName::clear_name() {
-  name_.Clear();
+  _impl_.name_.Clear();
+}
+inline std::string* TableName::add_name() {
+  std::string* _s = _internal_add_name();
+  // @@protoc_insertion_point(field_add_mutable:ZPMeta.TableName.name)
+  return _s;
+}
+inline const std::string& TableName::_internal_name(int index) const {
+  return _impl_.name_.Get(index);
+}
+inline const std::string& TableName::name(int index) const {
+  // @@protoc_insertion_point(field_get:ZPMeta.TableName.name)
+  return _internal_name(index);
 }
-inline const ::std::string& TableName::name(int index) const {
-  return name_.Get(index);
+inline std::string* TableName::mutable_name(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.TableName.name)
+  return _impl_.name_.Mutable(index);
 }
-inline ::std::string* TableName::mutable_name(int index) {
-  return name_.Mutable(index);
+inline void TableName::set_name(int index, const std::string& value) {
+  _impl_.name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.TableName.name)
 }
-inline void TableName::set_name(int index, const ::std::string& value) {
-  name_.Mutable(index)->assign(value);
+inline void TableName::set_name(int index, std::string&& value) {
+  _impl_.name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ZPMeta.TableName.name)
 }
 inline void TableName::set_name(int index, const char* value) {
-  name_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ZPMeta.TableName.name)
 }
 inline void TableName::set_name(int index, const char* value, size_t size) {
-  name_.Mutable(index)->assign(
+  _impl_.name_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ZPMeta.TableName.name)
 }
-inline ::std::string* TableName::add_name() {
-  return name_.Add();
+inline std::string* TableName::_internal_add_name() {
+  return _impl_.name_.Add();
 }
-inline void TableName::add_name(const ::std::string& value) {
-  name_.Add()->assign(value);
+inline void TableName::add_name(const std::string& value) {
+  _impl_.name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ZPMeta.TableName.name)
+}
+inline void TableName::add_name(std::string&& value) {
+  _impl_.name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ZPMeta.TableName.name)
 }
 inline void TableName::add_name(const char* value) {
-  name_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ZPMeta.TableName.name)
 }
 inline void TableName::add_name(const char* value, size_t size) {
-  name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ZPMeta.TableName.name)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 TableName::name() const {
-  return name_;
+  // @@protoc_insertion_point(field_list:ZPMeta.TableName.name)
+  return _impl_.name_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 TableName::mutable_name() {
-  return &name_;
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.TableName.name)
+  return &_impl_.name_;
 }
 
 // -------------------------------------------------------------------
@@ -2872,98 +5663,111 @@ TableName::mutable_name() {
 // Table
 
 // required string name = 1;
-inline bool Table::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Table::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Table::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Table::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Table::has_name() const {
+  return _internal_has_name();
 }
 inline void Table::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& Table::name() const {
-  return *name_;
-}
-inline void Table::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void Table::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void Table::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Table::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
-}
-inline ::std::string* Table::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Table::name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.Table.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Table::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.Table.name)
+}
+inline std::string* Table::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Table.name)
+  return _s;
+}
+inline const std::string& Table::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Table::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Table::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Table::release_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.Table.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Table::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Table::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.Table.name)
 }
 
 // repeated .ZPMeta.Partitions partitions = 2;
+inline int Table::_internal_partitions_size() const {
+  return _impl_.partitions_.size();
+}
 inline int Table::partitions_size() const {
-  return partitions_.size();
+  return _internal_partitions_size();
 }
 inline void Table::clear_partitions() {
-  partitions_.Clear();
+  _impl_.partitions_.Clear();
+}
+inline ::ZPMeta::Partitions* Table::mutable_partitions(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.Table.partitions)
+  return _impl_.partitions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Partitions >*
+Table::mutable_partitions() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.Table.partitions)
+  return &_impl_.partitions_;
+}
+inline const ::ZPMeta::Partitions& Table::_internal_partitions(int index) const {
+  return _impl_.partitions_.Get(index);
 }
 inline const ::ZPMeta::Partitions& Table::partitions(int index) const {
-  return partitions_.Get(index);
+  // @@protoc_insertion_point(field_get:ZPMeta.Table.partitions)
+  return _internal_partitions(index);
 }
-inline ::ZPMeta::Partitions* Table::mutable_partitions(int index) {
-  return partitions_.Mutable(index);
+inline ::ZPMeta::Partitions* Table::_internal_add_partitions() {
+  return _impl_.partitions_.Add();
 }
 inline ::ZPMeta::Partitions* Table::add_partitions() {
-  return partitions_.Add();
+  ::ZPMeta::Partitions* _add = _internal_add_partitions();
+  // @@protoc_insertion_point(field_add:ZPMeta.Table.partitions)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Partitions >&
 Table::partitions() const {
-  return partitions_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions >*
-Table::mutable_partitions() {
-  return &partitions_;
+  // @@protoc_insertion_point(field_list:ZPMeta.Table.partitions)
+  return _impl_.partitions_;
 }
 
 // -------------------------------------------------------------------
@@ -2971,133 +5775,189 @@ Table::mutable_partitions() {
 // BasicCmdUnit
 
 // required string name = 1;
-inline bool BasicCmdUnit::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool BasicCmdUnit::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void BasicCmdUnit::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void BasicCmdUnit::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool BasicCmdUnit::has_name() const {
+  return _internal_has_name();
 }
 inline void BasicCmdUnit::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& BasicCmdUnit::name() const {
-  return *name_;
-}
-inline void BasicCmdUnit::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void BasicCmdUnit::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void BasicCmdUnit::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* BasicCmdUnit::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
-}
-inline ::std::string* BasicCmdUnit::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BasicCmdUnit::name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.BasicCmdUnit.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BasicCmdUnit::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.BasicCmdUnit.name)
+}
+inline std::string* BasicCmdUnit::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.BasicCmdUnit.name)
+  return _s;
+}
+inline const std::string& BasicCmdUnit::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void BasicCmdUnit::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BasicCmdUnit::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BasicCmdUnit::release_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.BasicCmdUnit.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BasicCmdUnit::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void BasicCmdUnit::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.BasicCmdUnit.name)
 }
 
 // required int32 partition = 2;
+inline bool BasicCmdUnit::_internal_has_partition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool BasicCmdUnit::has_partition() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_partition();
 }
-inline void BasicCmdUnit::set_has_partition() {
-  _has_bits_[0] |= 0x00000002u;
+inline void BasicCmdUnit::clear_partition() {
+  _impl_.partition_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void BasicCmdUnit::clear_has_partition() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t BasicCmdUnit::_internal_partition() const {
+  return _impl_.partition_;
 }
-inline void BasicCmdUnit::clear_partition() {
-  partition_ = 0;
-  clear_has_partition();
+inline int32_t BasicCmdUnit::partition() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.BasicCmdUnit.partition)
+  return _internal_partition();
 }
-inline ::google::protobuf::int32 BasicCmdUnit::partition() const {
-  return partition_;
+inline void BasicCmdUnit::_internal_set_partition(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.partition_ = value;
 }
-inline void BasicCmdUnit::set_partition(::google::protobuf::int32 value) {
-  set_has_partition();
-  partition_ = value;
+inline void BasicCmdUnit::set_partition(int32_t value) {
+  _internal_set_partition(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.BasicCmdUnit.partition)
 }
 
 // required .ZPMeta.Node node = 3;
-inline bool BasicCmdUnit::has_node() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool BasicCmdUnit::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.node_ != nullptr);
+  return value;
 }
-inline void BasicCmdUnit::set_has_node() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void BasicCmdUnit::clear_has_node() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool BasicCmdUnit::has_node() const {
+  return _internal_has_node();
 }
 inline void BasicCmdUnit::clear_node() {
-  if (node_ != NULL) node_->::ZPMeta::Node::Clear();
-  clear_has_node();
+  if (_impl_.node_ != nullptr) _impl_.node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::ZPMeta::Node& BasicCmdUnit::_internal_node() const {
+  const ::ZPMeta::Node* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Node&>(
+      ::ZPMeta::_Node_default_instance_);
 }
 inline const ::ZPMeta::Node& BasicCmdUnit::node() const {
-  return node_ != NULL ? *node_ : *default_instance_->node_;
+  // @@protoc_insertion_point(field_get:ZPMeta.BasicCmdUnit.node)
+  return _internal_node();
 }
-inline ::ZPMeta::Node* BasicCmdUnit::mutable_node() {
-  set_has_node();
-  if (node_ == NULL) node_ = new ::ZPMeta::Node;
-  return node_;
+inline void BasicCmdUnit::unsafe_arena_set_allocated_node(
+    ::ZPMeta::Node* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
+  if (node) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.BasicCmdUnit.node)
 }
 inline ::ZPMeta::Node* BasicCmdUnit::release_node() {
-  clear_has_node();
-  ::ZPMeta::Node* temp = node_;
-  node_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::ZPMeta::Node* BasicCmdUnit::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:ZPMeta.BasicCmdUnit.node)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::Node* BasicCmdUnit::_internal_mutable_node() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Node>(GetArenaForAllocation());
+    _impl_.node_ = p;
+  }
+  return _impl_.node_;
+}
+inline ::ZPMeta::Node* BasicCmdUnit::mutable_node() {
+  ::ZPMeta::Node* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.BasicCmdUnit.node)
+  return _msg;
+}
 inline void BasicCmdUnit::set_allocated_node(::ZPMeta::Node* node) {
-  delete node_;
-  node_ = node;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
+  }
   if (node) {
-    set_has_node();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_node();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.BasicCmdUnit.node)
 }
 
 // -------------------------------------------------------------------
@@ -3105,139 +5965,155 @@ inline void BasicCmdUnit::set_allocated_node(::ZPMeta::Node* node) {
 // SyncOffset
 
 // required string table_name = 1;
-inline bool SyncOffset::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool SyncOffset::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void SyncOffset::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SyncOffset::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SyncOffset::has_table_name() const {
+  return _internal_has_table_name();
 }
 inline void SyncOffset::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
-}
-inline const ::std::string& SyncOffset::table_name() const {
-  return *table_name_;
-}
-inline void SyncOffset::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
-}
-inline void SyncOffset::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
-}
-inline void SyncOffset::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* SyncOffset::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
-}
-inline ::std::string* SyncOffset::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SyncOffset::table_name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.SyncOffset.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncOffset::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.SyncOffset.table_name)
+}
+inline std::string* SyncOffset::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.SyncOffset.table_name)
+  return _s;
+}
+inline const std::string& SyncOffset::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void SyncOffset::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncOffset::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncOffset::release_table_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.SyncOffset.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SyncOffset::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void SyncOffset::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.SyncOffset.table_name)
 }
 
 // required int32 partition = 2;
+inline bool SyncOffset::_internal_has_partition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool SyncOffset::has_partition() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_partition();
 }
-inline void SyncOffset::set_has_partition() {
-  _has_bits_[0] |= 0x00000002u;
+inline void SyncOffset::clear_partition() {
+  _impl_.partition_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void SyncOffset::clear_has_partition() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t SyncOffset::_internal_partition() const {
+  return _impl_.partition_;
 }
-inline void SyncOffset::clear_partition() {
-  partition_ = 0;
-  clear_has_partition();
+inline int32_t SyncOffset::partition() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.SyncOffset.partition)
+  return _internal_partition();
 }
-inline ::google::protobuf::int32 SyncOffset::partition() const {
-  return partition_;
+inline void SyncOffset::_internal_set_partition(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_ = value;
 }
-inline void SyncOffset::set_partition(::google::protobuf::int32 value) {
-  set_has_partition();
-  partition_ = value;
+inline void SyncOffset::set_partition(int32_t value) {
+  _internal_set_partition(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.SyncOffset.partition)
 }
 
 // optional int32 filenum = 3;
+inline bool SyncOffset::_internal_has_filenum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool SyncOffset::has_filenum() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_filenum();
 }
-inline void SyncOffset::set_has_filenum() {
-  _has_bits_[0] |= 0x00000004u;
+inline void SyncOffset::clear_filenum() {
+  _impl_.filenum_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void SyncOffset::clear_has_filenum() {
-  _has_bits_[0] &= ~0x00000004u;
+inline int32_t SyncOffset::_internal_filenum() const {
+  return _impl_.filenum_;
 }
-inline void SyncOffset::clear_filenum() {
-  filenum_ = 0;
-  clear_has_filenum();
+inline int32_t SyncOffset::filenum() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.SyncOffset.filenum)
+  return _internal_filenum();
 }
-inline ::google::protobuf::int32 SyncOffset::filenum() const {
-  return filenum_;
+inline void SyncOffset::_internal_set_filenum(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.filenum_ = value;
 }
-inline void SyncOffset::set_filenum(::google::protobuf::int32 value) {
-  set_has_filenum();
-  filenum_ = value;
+inline void SyncOffset::set_filenum(int32_t value) {
+  _internal_set_filenum(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.SyncOffset.filenum)
 }
 
 // optional int64 offset = 4;
+inline bool SyncOffset::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool SyncOffset::has_offset() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_offset();
 }
-inline void SyncOffset::set_has_offset() {
-  _has_bits_[0] |= 0x00000008u;
+inline void SyncOffset::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void SyncOffset::clear_has_offset() {
-  _has_bits_[0] &= ~0x00000008u;
+inline int64_t SyncOffset::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline void SyncOffset::clear_offset() {
-  offset_ = GOOGLE_LONGLONG(0);
-  clear_has_offset();
+inline int64_t SyncOffset::offset() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.SyncOffset.offset)
+  return _internal_offset();
 }
-inline ::google::protobuf::int64 SyncOffset::offset() const {
-  return offset_;
+inline void SyncOffset::_internal_set_offset(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.offset_ = value;
 }
-inline void SyncOffset::set_offset(::google::protobuf::int64 value) {
-  set_has_offset();
-  offset_ = value;
+inline void SyncOffset::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.SyncOffset.offset)
 }
 
 // -------------------------------------------------------------------
@@ -3245,200 +6121,323 @@ inline void SyncOffset::set_offset(::google::protobuf::int64 value) {
 // MetaCmd_Ping
 
 // required int32 version = 1;
+inline bool MetaCmd_Ping::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool MetaCmd_Ping::has_version() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_version();
 }
-inline void MetaCmd_Ping::set_has_version() {
-  _has_bits_[0] |= 0x00000001u;
+inline void MetaCmd_Ping::clear_version() {
+  _impl_.version_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void MetaCmd_Ping::clear_has_version() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t MetaCmd_Ping::_internal_version() const {
+  return _impl_.version_;
 }
-inline void MetaCmd_Ping::clear_version() {
-  version_ = 0;
-  clear_has_version();
+inline int32_t MetaCmd_Ping::version() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Ping.version)
+  return _internal_version();
 }
-inline ::google::protobuf::int32 MetaCmd_Ping::version() const {
-  return version_;
+inline void MetaCmd_Ping::_internal_set_version(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
 }
-inline void MetaCmd_Ping::set_version(::google::protobuf::int32 value) {
-  set_has_version();
-  version_ = value;
+inline void MetaCmd_Ping::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.Ping.version)
 }
 
 // required .ZPMeta.Node node = 2;
-inline bool MetaCmd_Ping::has_node() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void MetaCmd_Ping::set_has_node() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool MetaCmd_Ping::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.node_ != nullptr);
+  return value;
 }
-inline void MetaCmd_Ping::clear_has_node() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool MetaCmd_Ping::has_node() const {
+  return _internal_has_node();
 }
 inline void MetaCmd_Ping::clear_node() {
-  if (node_ != NULL) node_->::ZPMeta::Node::Clear();
-  clear_has_node();
+  if (_impl_.node_ != nullptr) _impl_.node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::Node& MetaCmd_Ping::_internal_node() const {
+  const ::ZPMeta::Node* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Node&>(
+      ::ZPMeta::_Node_default_instance_);
 }
 inline const ::ZPMeta::Node& MetaCmd_Ping::node() const {
-  return node_ != NULL ? *node_ : *default_instance_->node_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Ping.node)
+  return _internal_node();
 }
-inline ::ZPMeta::Node* MetaCmd_Ping::mutable_node() {
-  set_has_node();
-  if (node_ == NULL) node_ = new ::ZPMeta::Node;
-  return node_;
+inline void MetaCmd_Ping::unsafe_arena_set_allocated_node(
+    ::ZPMeta::Node* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
+  if (node) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.Ping.node)
 }
 inline ::ZPMeta::Node* MetaCmd_Ping::release_node() {
-  clear_has_node();
-  ::ZPMeta::Node* temp = node_;
-  node_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::Node* MetaCmd_Ping::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.Ping.node)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::Node* MetaCmd_Ping::_internal_mutable_node() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Node>(GetArenaForAllocation());
+    _impl_.node_ = p;
+  }
+  return _impl_.node_;
+}
+inline ::ZPMeta::Node* MetaCmd_Ping::mutable_node() {
+  ::ZPMeta::Node* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.Ping.node)
+  return _msg;
+}
 inline void MetaCmd_Ping::set_allocated_node(::ZPMeta::Node* node) {
-  delete node_;
-  node_ = node;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
+  }
   if (node) {
-    set_has_node();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_node();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.Ping.node)
 }
 
 // repeated .ZPMeta.SyncOffset offset = 3;
+inline int MetaCmd_Ping::_internal_offset_size() const {
+  return _impl_.offset_.size();
+}
 inline int MetaCmd_Ping::offset_size() const {
-  return offset_.size();
+  return _internal_offset_size();
 }
 inline void MetaCmd_Ping::clear_offset() {
-  offset_.Clear();
+  _impl_.offset_.Clear();
+}
+inline ::ZPMeta::SyncOffset* MetaCmd_Ping::mutable_offset(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.Ping.offset)
+  return _impl_.offset_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::SyncOffset >*
+MetaCmd_Ping::mutable_offset() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.MetaCmd.Ping.offset)
+  return &_impl_.offset_;
+}
+inline const ::ZPMeta::SyncOffset& MetaCmd_Ping::_internal_offset(int index) const {
+  return _impl_.offset_.Get(index);
 }
 inline const ::ZPMeta::SyncOffset& MetaCmd_Ping::offset(int index) const {
-  return offset_.Get(index);
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Ping.offset)
+  return _internal_offset(index);
 }
-inline ::ZPMeta::SyncOffset* MetaCmd_Ping::mutable_offset(int index) {
-  return offset_.Mutable(index);
+inline ::ZPMeta::SyncOffset* MetaCmd_Ping::_internal_add_offset() {
+  return _impl_.offset_.Add();
 }
 inline ::ZPMeta::SyncOffset* MetaCmd_Ping::add_offset() {
-  return offset_.Add();
+  ::ZPMeta::SyncOffset* _add = _internal_add_offset();
+  // @@protoc_insertion_point(field_add:ZPMeta.MetaCmd.Ping.offset)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::SyncOffset >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::SyncOffset >&
 MetaCmd_Ping::offset() const {
-  return offset_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::SyncOffset >*
-MetaCmd_Ping::mutable_offset() {
-  return &offset_;
+  // @@protoc_insertion_point(field_list:ZPMeta.MetaCmd.Ping.offset)
+  return _impl_.offset_;
 }
 
 // -------------------------------------------------------------------
 
 // MetaCmd_Pull
 
-// optional .ZPMeta.Node node = 1;
-inline bool MetaCmd_Pull::has_node() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd_Pull::set_has_node() {
-  _has_bits_[0] |= 0x00000001u;
+// optional .ZPMeta.Node node = 1;
+inline bool MetaCmd_Pull::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.node_ != nullptr);
+  return value;
 }
-inline void MetaCmd_Pull::clear_has_node() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd_Pull::has_node() const {
+  return _internal_has_node();
 }
 inline void MetaCmd_Pull::clear_node() {
-  if (node_ != NULL) node_->::ZPMeta::Node::Clear();
-  clear_has_node();
-}
-inline const ::ZPMeta::Node& MetaCmd_Pull::node() const {
-  return node_ != NULL ? *node_ : *default_instance_->node_;
+  if (_impl_.node_ != nullptr) _impl_.node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::ZPMeta::Node* MetaCmd_Pull::mutable_node() {
-  set_has_node();
-  if (node_ == NULL) node_ = new ::ZPMeta::Node;
-  return node_;
+inline const ::ZPMeta::Node& MetaCmd_Pull::_internal_node() const {
+  const ::ZPMeta::Node* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Node&>(
+      ::ZPMeta::_Node_default_instance_);
 }
-inline ::ZPMeta::Node* MetaCmd_Pull::release_node() {
-  clear_has_node();
-  ::ZPMeta::Node* temp = node_;
-  node_ = NULL;
-  return temp;
+inline const ::ZPMeta::Node& MetaCmd_Pull::node() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Pull.node)
+  return _internal_node();
 }
-inline void MetaCmd_Pull::set_allocated_node(::ZPMeta::Node* node) {
-  delete node_;
-  node_ = node;
+inline void MetaCmd_Pull::unsafe_arena_set_allocated_node(
+    ::ZPMeta::Node* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
   if (node) {
-    set_has_node();
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_node();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.Pull.node)
 }
-
-// optional string name = 2;
-inline bool MetaCmd_Pull::has_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void MetaCmd_Pull::set_has_name() {
-  _has_bits_[0] |= 0x00000002u;
+inline ::ZPMeta::Node* MetaCmd_Pull::release_node() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void MetaCmd_Pull::clear_has_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline ::ZPMeta::Node* MetaCmd_Pull::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.Pull.node)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+  return temp;
 }
-inline void MetaCmd_Pull::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+inline ::ZPMeta::Node* MetaCmd_Pull::_internal_mutable_node() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Node>(GetArenaForAllocation());
+    _impl_.node_ = p;
   }
-  clear_has_name();
+  return _impl_.node_;
 }
-inline const ::std::string& MetaCmd_Pull::name() const {
-  return *name_;
+inline ::ZPMeta::Node* MetaCmd_Pull::mutable_node() {
+  ::ZPMeta::Node* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.Pull.node)
+  return _msg;
 }
-inline void MetaCmd_Pull::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+inline void MetaCmd_Pull::set_allocated_node(::ZPMeta::Node* node) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
   }
-  name_->assign(value);
-}
-inline void MetaCmd_Pull::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  if (node) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  name_->assign(value);
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.Pull.node)
 }
-inline void MetaCmd_Pull::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional string name = 2;
+inline bool MetaCmd_Pull::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* MetaCmd_Pull::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline bool MetaCmd_Pull::has_name() const {
+  return _internal_has_name();
 }
-inline ::std::string* MetaCmd_Pull::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void MetaCmd_Pull::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaCmd_Pull::name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Pull.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaCmd_Pull::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.Pull.name)
+}
+inline std::string* MetaCmd_Pull::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.Pull.name)
+  return _s;
+}
+inline const std::string& MetaCmd_Pull::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetaCmd_Pull::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaCmd_Pull::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaCmd_Pull::release_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.Pull.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaCmd_Pull::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void MetaCmd_Pull::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.Pull.name)
 }
 
 // -------------------------------------------------------------------
@@ -3446,95 +6445,155 @@ inline void MetaCmd_Pull::set_allocated_name(::std::string* name) {
 // MetaCmd_Init
 
 // required string name = 1;
-inline bool MetaCmd_Init::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd_Init::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool MetaCmd_Init::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void MetaCmd_Init::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd_Init::has_name() const {
+  return _internal_has_name();
 }
 inline void MetaCmd_Init::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaCmd_Init::name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Init.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaCmd_Init::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.Init.name)
+}
+inline std::string* MetaCmd_Init::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.Init.name)
+  return _s;
+}
+inline const std::string& MetaCmd_Init::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetaCmd_Init::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaCmd_Init::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaCmd_Init::release_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.Init.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaCmd_Init::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  clear_has_name();
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.Init.name)
 }
-inline const ::std::string& MetaCmd_Init::name() const {
-  return *name_;
+
+// required int32 num = 2;
+inline bool MetaCmd_Init::_internal_has_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void MetaCmd_Init::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline bool MetaCmd_Init::has_num() const {
+  return _internal_has_num();
 }
-inline void MetaCmd_Init::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void MetaCmd_Init::clear_num() {
+  _impl_.num_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void MetaCmd_Init::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+inline int32_t MetaCmd_Init::_internal_num() const {
+  return _impl_.num_;
 }
-inline ::std::string* MetaCmd_Init::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline int32_t MetaCmd_Init::num() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Init.num)
+  return _internal_num();
 }
-inline ::std::string* MetaCmd_Init::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void MetaCmd_Init::_internal_set_num(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_ = value;
 }
-inline void MetaCmd_Init::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void MetaCmd_Init::set_num(int32_t value) {
+  _internal_set_num(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.Init.num)
 }
 
-// required int32 num = 2;
-inline bool MetaCmd_Init::has_num() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional int32 replica_num = 3 [default = 3];
+inline bool MetaCmd_Init::_internal_has_replica_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void MetaCmd_Init::set_has_num() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool MetaCmd_Init::has_replica_num() const {
+  return _internal_has_replica_num();
 }
-inline void MetaCmd_Init::clear_has_num() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void MetaCmd_Init::clear_replica_num() {
+  _impl_.replica_num_ = 3;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void MetaCmd_Init::clear_num() {
-  num_ = 0;
-  clear_has_num();
+inline int32_t MetaCmd_Init::_internal_replica_num() const {
+  return _impl_.replica_num_;
+}
+inline int32_t MetaCmd_Init::replica_num() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Init.replica_num)
+  return _internal_replica_num();
+}
+inline void MetaCmd_Init::_internal_set_replica_num(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.replica_num_ = value;
+}
+inline void MetaCmd_Init::set_replica_num(int32_t value) {
+  _internal_set_replica_num(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.Init.replica_num)
 }
-inline ::google::protobuf::int32 MetaCmd_Init::num() const {
-  return num_;
+
+// optional int32 learner_num = 4 [default = 0];
+inline bool MetaCmd_Init::_internal_has_learner_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MetaCmd_Init::has_learner_num() const {
+  return _internal_has_learner_num();
+}
+inline void MetaCmd_Init::clear_learner_num() {
+  _impl_.learner_num_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t MetaCmd_Init::_internal_learner_num() const {
+  return _impl_.learner_num_;
 }
-inline void MetaCmd_Init::set_num(::google::protobuf::int32 value) {
-  set_has_num();
-  num_ = value;
+inline int32_t MetaCmd_Init::learner_num() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.Init.learner_num)
+  return _internal_learner_num();
+}
+inline void MetaCmd_Init::_internal_set_learner_num(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.learner_num_ = value;
+}
+inline void MetaCmd_Init::set_learner_num(int32_t value) {
+  _internal_set_learner_num(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.Init.learner_num)
 }
 
 // -------------------------------------------------------------------
@@ -3542,41 +6601,93 @@ inline void MetaCmd_Init::set_num(::google::protobuf::int32 value) {
 // MetaCmd_SetMaster
 
 // required .ZPMeta.BasicCmdUnit basic = 1;
-inline bool MetaCmd_SetMaster::has_basic() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd_SetMaster::set_has_basic() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool MetaCmd_SetMaster::_internal_has_basic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.basic_ != nullptr);
+  return value;
 }
-inline void MetaCmd_SetMaster::clear_has_basic() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd_SetMaster::has_basic() const {
+  return _internal_has_basic();
 }
 inline void MetaCmd_SetMaster::clear_basic() {
-  if (basic_ != NULL) basic_->::ZPMeta::BasicCmdUnit::Clear();
-  clear_has_basic();
+  if (_impl_.basic_ != nullptr) _impl_.basic_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::BasicCmdUnit& MetaCmd_SetMaster::_internal_basic() const {
+  const ::ZPMeta::BasicCmdUnit* p = _impl_.basic_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::BasicCmdUnit&>(
+      ::ZPMeta::_BasicCmdUnit_default_instance_);
 }
 inline const ::ZPMeta::BasicCmdUnit& MetaCmd_SetMaster::basic() const {
-  return basic_ != NULL ? *basic_ : *default_instance_->basic_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.SetMaster.basic)
+  return _internal_basic();
 }
-inline ::ZPMeta::BasicCmdUnit* MetaCmd_SetMaster::mutable_basic() {
-  set_has_basic();
-  if (basic_ == NULL) basic_ = new ::ZPMeta::BasicCmdUnit;
-  return basic_;
+inline void MetaCmd_SetMaster::unsafe_arena_set_allocated_basic(
+    ::ZPMeta::BasicCmdUnit* basic) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.basic_);
+  }
+  _impl_.basic_ = basic;
+  if (basic) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.SetMaster.basic)
 }
 inline ::ZPMeta::BasicCmdUnit* MetaCmd_SetMaster::release_basic() {
-  clear_has_basic();
-  ::ZPMeta::BasicCmdUnit* temp = basic_;
-  basic_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::BasicCmdUnit* temp = _impl_.basic_;
+  _impl_.basic_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_SetMaster::unsafe_arena_release_basic() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.SetMaster.basic)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::BasicCmdUnit* temp = _impl_.basic_;
+  _impl_.basic_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_SetMaster::_internal_mutable_basic() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.basic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::BasicCmdUnit>(GetArenaForAllocation());
+    _impl_.basic_ = p;
+  }
+  return _impl_.basic_;
+}
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_SetMaster::mutable_basic() {
+  ::ZPMeta::BasicCmdUnit* _msg = _internal_mutable_basic();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.SetMaster.basic)
+  return _msg;
+}
 inline void MetaCmd_SetMaster::set_allocated_basic(::ZPMeta::BasicCmdUnit* basic) {
-  delete basic_;
-  basic_ = basic;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.basic_;
+  }
   if (basic) {
-    set_has_basic();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(basic);
+    if (message_arena != submessage_arena) {
+      basic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, basic, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_basic();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.basic_ = basic;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.SetMaster.basic)
 }
 
 // -------------------------------------------------------------------
@@ -3584,41 +6695,93 @@ inline void MetaCmd_SetMaster::set_allocated_basic(::ZPMeta::BasicCmdUnit* basic
 // MetaCmd_AddSlave
 
 // required .ZPMeta.BasicCmdUnit basic = 1;
-inline bool MetaCmd_AddSlave::has_basic() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd_AddSlave::set_has_basic() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool MetaCmd_AddSlave::_internal_has_basic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.basic_ != nullptr);
+  return value;
 }
-inline void MetaCmd_AddSlave::clear_has_basic() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd_AddSlave::has_basic() const {
+  return _internal_has_basic();
 }
 inline void MetaCmd_AddSlave::clear_basic() {
-  if (basic_ != NULL) basic_->::ZPMeta::BasicCmdUnit::Clear();
-  clear_has_basic();
+  if (_impl_.basic_ != nullptr) _impl_.basic_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::BasicCmdUnit& MetaCmd_AddSlave::_internal_basic() const {
+  const ::ZPMeta::BasicCmdUnit* p = _impl_.basic_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::BasicCmdUnit&>(
+      ::ZPMeta::_BasicCmdUnit_default_instance_);
 }
 inline const ::ZPMeta::BasicCmdUnit& MetaCmd_AddSlave::basic() const {
-  return basic_ != NULL ? *basic_ : *default_instance_->basic_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.AddSlave.basic)
+  return _internal_basic();
 }
-inline ::ZPMeta::BasicCmdUnit* MetaCmd_AddSlave::mutable_basic() {
-  set_has_basic();
-  if (basic_ == NULL) basic_ = new ::ZPMeta::BasicCmdUnit;
-  return basic_;
+inline void MetaCmd_AddSlave::unsafe_arena_set_allocated_basic(
+    ::ZPMeta::BasicCmdUnit* basic) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.basic_);
+  }
+  _impl_.basic_ = basic;
+  if (basic) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.AddSlave.basic)
 }
 inline ::ZPMeta::BasicCmdUnit* MetaCmd_AddSlave::release_basic() {
-  clear_has_basic();
-  ::ZPMeta::BasicCmdUnit* temp = basic_;
-  basic_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::BasicCmdUnit* temp = _impl_.basic_;
+  _impl_.basic_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_AddSlave::unsafe_arena_release_basic() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.AddSlave.basic)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::BasicCmdUnit* temp = _impl_.basic_;
+  _impl_.basic_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_AddSlave::_internal_mutable_basic() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.basic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::BasicCmdUnit>(GetArenaForAllocation());
+    _impl_.basic_ = p;
+  }
+  return _impl_.basic_;
+}
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_AddSlave::mutable_basic() {
+  ::ZPMeta::BasicCmdUnit* _msg = _internal_mutable_basic();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.AddSlave.basic)
+  return _msg;
+}
 inline void MetaCmd_AddSlave::set_allocated_basic(::ZPMeta::BasicCmdUnit* basic) {
-  delete basic_;
-  basic_ = basic;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.basic_;
+  }
   if (basic) {
-    set_has_basic();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(basic);
+    if (message_arena != submessage_arena) {
+      basic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, basic, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_basic();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.basic_ = basic;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.AddSlave.basic)
 }
 
 // -------------------------------------------------------------------
@@ -3626,41 +6789,93 @@ inline void MetaCmd_AddSlave::set_allocated_basic(::ZPMeta::BasicCmdUnit* basic)
 // MetaCmd_RemoveSlave
 
 // required .ZPMeta.BasicCmdUnit basic = 1;
-inline bool MetaCmd_RemoveSlave::has_basic() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd_RemoveSlave::set_has_basic() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool MetaCmd_RemoveSlave::_internal_has_basic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.basic_ != nullptr);
+  return value;
 }
-inline void MetaCmd_RemoveSlave::clear_has_basic() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd_RemoveSlave::has_basic() const {
+  return _internal_has_basic();
 }
 inline void MetaCmd_RemoveSlave::clear_basic() {
-  if (basic_ != NULL) basic_->::ZPMeta::BasicCmdUnit::Clear();
-  clear_has_basic();
+  if (_impl_.basic_ != nullptr) _impl_.basic_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::BasicCmdUnit& MetaCmd_RemoveSlave::_internal_basic() const {
+  const ::ZPMeta::BasicCmdUnit* p = _impl_.basic_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::BasicCmdUnit&>(
+      ::ZPMeta::_BasicCmdUnit_default_instance_);
 }
 inline const ::ZPMeta::BasicCmdUnit& MetaCmd_RemoveSlave::basic() const {
-  return basic_ != NULL ? *basic_ : *default_instance_->basic_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.RemoveSlave.basic)
+  return _internal_basic();
 }
-inline ::ZPMeta::BasicCmdUnit* MetaCmd_RemoveSlave::mutable_basic() {
-  set_has_basic();
-  if (basic_ == NULL) basic_ = new ::ZPMeta::BasicCmdUnit;
-  return basic_;
+inline void MetaCmd_RemoveSlave::unsafe_arena_set_allocated_basic(
+    ::ZPMeta::BasicCmdUnit* basic) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.basic_);
+  }
+  _impl_.basic_ = basic;
+  if (basic) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.RemoveSlave.basic)
 }
 inline ::ZPMeta::BasicCmdUnit* MetaCmd_RemoveSlave::release_basic() {
-  clear_has_basic();
-  ::ZPMeta::BasicCmdUnit* temp = basic_;
-  basic_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::BasicCmdUnit* temp = _impl_.basic_;
+  _impl_.basic_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_RemoveSlave::unsafe_arena_release_basic() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.RemoveSlave.basic)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::BasicCmdUnit* temp = _impl_.basic_;
+  _impl_.basic_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_RemoveSlave::_internal_mutable_basic() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.basic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::BasicCmdUnit>(GetArenaForAllocation());
+    _impl_.basic_ = p;
+  }
+  return _impl_.basic_;
+}
+inline ::ZPMeta::BasicCmdUnit* MetaCmd_RemoveSlave::mutable_basic() {
+  ::ZPMeta::BasicCmdUnit* _msg = _internal_mutable_basic();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.RemoveSlave.basic)
+  return _msg;
+}
 inline void MetaCmd_RemoveSlave::set_allocated_basic(::ZPMeta::BasicCmdUnit* basic) {
-  delete basic_;
-  basic_ = basic;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.basic_;
+  }
   if (basic) {
-    set_has_basic();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(basic);
+    if (message_arena != submessage_arena) {
+      basic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, basic, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_basic();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.basic_ = basic;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.RemoveSlave.basic)
 }
 
 // -------------------------------------------------------------------
@@ -3668,73 +6883,239 @@ inline void MetaCmd_RemoveSlave::set_allocated_basic(::ZPMeta::BasicCmdUnit* bas
 // MetaCmd_DropTable
 
 // required string name = 1;
-inline bool MetaCmd_DropTable::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd_DropTable::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool MetaCmd_DropTable::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void MetaCmd_DropTable::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd_DropTable::has_name() const {
+  return _internal_has_name();
 }
 inline void MetaCmd_DropTable::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaCmd_DropTable::name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.DropTable.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaCmd_DropTable::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.DropTable.name)
+}
+inline std::string* MetaCmd_DropTable::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.DropTable.name)
+  return _s;
+}
+inline const std::string& MetaCmd_DropTable::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetaCmd_DropTable::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaCmd_DropTable::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaCmd_DropTable::release_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.DropTable.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaCmd_DropTable::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  clear_has_name();
-}
-inline const ::std::string& MetaCmd_DropTable::name() const {
-  return *name_;
-}
-inline void MetaCmd_DropTable::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  name_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.DropTable.name)
 }
-inline void MetaCmd_DropTable::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+
+// -------------------------------------------------------------------
+
+// MetaCmd_SetChain
+
+// required string name = 1;
+inline bool MetaCmd_SetChain::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MetaCmd_SetChain::has_name() const {
+  return _internal_has_name();
+}
+inline void MetaCmd_SetChain::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaCmd_SetChain::name() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.SetChain.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaCmd_SetChain::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.SetChain.name)
+}
+inline std::string* MetaCmd_SetChain::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.SetChain.name)
+  return _s;
+}
+inline const std::string& MetaCmd_SetChain::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetaCmd_SetChain::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaCmd_SetChain::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaCmd_SetChain::release_name() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.SetChain.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaCmd_SetChain::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  name_->assign(value);
-}
-inline void MetaCmd_DropTable::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.SetChain.name)
 }
-inline ::std::string* MetaCmd_DropTable::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+
+// required int32 partition = 2;
+inline bool MetaCmd_SetChain::_internal_has_partition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::std::string* MetaCmd_DropTable::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline bool MetaCmd_SetChain::has_partition() const {
+  return _internal_has_partition();
 }
-inline void MetaCmd_DropTable::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void MetaCmd_SetChain::clear_partition() {
+  _impl_.partition_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t MetaCmd_SetChain::_internal_partition() const {
+  return _impl_.partition_;
+}
+inline int32_t MetaCmd_SetChain::partition() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.SetChain.partition)
+  return _internal_partition();
+}
+inline void MetaCmd_SetChain::_internal_set_partition(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_ = value;
+}
+inline void MetaCmd_SetChain::set_partition(int32_t value) {
+  _internal_set_partition(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.SetChain.partition)
+}
+
+// required bool enable = 3;
+inline bool MetaCmd_SetChain::_internal_has_enable() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MetaCmd_SetChain::has_enable() const {
+  return _internal_has_enable();
+}
+inline void MetaCmd_SetChain::clear_enable() {
+  _impl_.enable_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool MetaCmd_SetChain::_internal_enable() const {
+  return _impl_.enable_;
+}
+inline bool MetaCmd_SetChain::enable() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.SetChain.enable)
+  return _internal_enable();
+}
+inline void MetaCmd_SetChain::_internal_set_enable(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.enable_ = value;
+}
+inline void MetaCmd_SetChain::set_enable(bool value) {
+  _internal_set_enable(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.SetChain.enable)
+}
+
+// repeated .ZPMeta.Node order = 4;
+inline int MetaCmd_SetChain::_internal_order_size() const {
+  return _impl_.order_.size();
+}
+inline int MetaCmd_SetChain::order_size() const {
+  return _internal_order_size();
+}
+inline void MetaCmd_SetChain::clear_order() {
+  _impl_.order_.Clear();
+}
+inline ::ZPMeta::Node* MetaCmd_SetChain::mutable_order(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.SetChain.order)
+  return _impl_.order_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >*
+MetaCmd_SetChain::mutable_order() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.MetaCmd.SetChain.order)
+  return &_impl_.order_;
+}
+inline const ::ZPMeta::Node& MetaCmd_SetChain::_internal_order(int index) const {
+  return _impl_.order_.Get(index);
+}
+inline const ::ZPMeta::Node& MetaCmd_SetChain::order(int index) const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.SetChain.order)
+  return _internal_order(index);
+}
+inline ::ZPMeta::Node* MetaCmd_SetChain::_internal_add_order() {
+  return _impl_.order_.Add();
+}
+inline ::ZPMeta::Node* MetaCmd_SetChain::add_order() {
+  ::ZPMeta::Node* _add = _internal_add_order();
+  // @@protoc_insertion_point(field_add:ZPMeta.MetaCmd.SetChain.order)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Node >&
+MetaCmd_SetChain::order() const {
+  // @@protoc_insertion_point(field_list:ZPMeta.MetaCmd.SetChain.order)
+  return _impl_.order_;
 }
 
 // -------------------------------------------------------------------
@@ -3742,292 +7123,752 @@ inline void MetaCmd_DropTable::set_allocated_name(::std::string* name) {
 // MetaCmd
 
 // required .ZPMeta.Type type = 1;
-inline bool MetaCmd::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MetaCmd::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool MetaCmd::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void MetaCmd::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmd::has_type() const {
+  return _internal_has_type();
 }
 inline void MetaCmd::clear_type() {
-  type_ = 1;
-  clear_has_type();
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::ZPMeta::Type MetaCmd::_internal_type() const {
+  return static_cast< ::ZPMeta::Type >(_impl_.type_);
 }
 inline ::ZPMeta::Type MetaCmd::type() const {
-  return static_cast< ::ZPMeta::Type >(type_);
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.type)
+  return _internal_type();
 }
-inline void MetaCmd::set_type(::ZPMeta::Type value) {
+inline void MetaCmd::_internal_set_type(::ZPMeta::Type value) {
   assert(::ZPMeta::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.type_ = value;
+}
+inline void MetaCmd::set_type(::ZPMeta::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmd.type)
 }
 
 // optional .ZPMeta.MetaCmd.Ping ping = 2;
-inline bool MetaCmd::has_ping() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool MetaCmd::_internal_has_ping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ping_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_ping() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void MetaCmd::clear_has_ping() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool MetaCmd::has_ping() const {
+  return _internal_has_ping();
 }
 inline void MetaCmd::clear_ping() {
-  if (ping_ != NULL) ping_->::ZPMeta::MetaCmd_Ping::Clear();
-  clear_has_ping();
+  if (_impl_.ping_ != nullptr) _impl_.ping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::MetaCmd_Ping& MetaCmd::_internal_ping() const {
+  const ::ZPMeta::MetaCmd_Ping* p = _impl_.ping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_Ping&>(
+      ::ZPMeta::_MetaCmd_Ping_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_Ping& MetaCmd::ping() const {
-  return ping_ != NULL ? *ping_ : *default_instance_->ping_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.ping)
+  return _internal_ping();
 }
-inline ::ZPMeta::MetaCmd_Ping* MetaCmd::mutable_ping() {
-  set_has_ping();
-  if (ping_ == NULL) ping_ = new ::ZPMeta::MetaCmd_Ping;
-  return ping_;
+inline void MetaCmd::unsafe_arena_set_allocated_ping(
+    ::ZPMeta::MetaCmd_Ping* ping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ping_);
+  }
+  _impl_.ping_ = ping;
+  if (ping) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.ping)
 }
 inline ::ZPMeta::MetaCmd_Ping* MetaCmd::release_ping() {
-  clear_has_ping();
-  ::ZPMeta::MetaCmd_Ping* temp = ping_;
-  ping_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::MetaCmd_Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_Ping* MetaCmd::unsafe_arena_release_ping() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.ping)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::MetaCmd_Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmd_Ping* MetaCmd::_internal_mutable_ping() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.ping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_Ping>(GetArenaForAllocation());
+    _impl_.ping_ = p;
+  }
+  return _impl_.ping_;
+}
+inline ::ZPMeta::MetaCmd_Ping* MetaCmd::mutable_ping() {
+  ::ZPMeta::MetaCmd_Ping* _msg = _internal_mutable_ping();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.ping)
+  return _msg;
+}
 inline void MetaCmd::set_allocated_ping(::ZPMeta::MetaCmd_Ping* ping) {
-  delete ping_;
-  ping_ = ping;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ping_;
+  }
   if (ping) {
-    set_has_ping();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ping);
+    if (message_arena != submessage_arena) {
+      ping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_ping();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.ping_ = ping;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.ping)
 }
 
 // optional .ZPMeta.MetaCmd.Pull pull = 3;
-inline bool MetaCmd::has_pull() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool MetaCmd::_internal_has_pull() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pull_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_pull() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void MetaCmd::clear_has_pull() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool MetaCmd::has_pull() const {
+  return _internal_has_pull();
 }
 inline void MetaCmd::clear_pull() {
-  if (pull_ != NULL) pull_->::ZPMeta::MetaCmd_Pull::Clear();
-  clear_has_pull();
+  if (_impl_.pull_ != nullptr) _impl_.pull_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::ZPMeta::MetaCmd_Pull& MetaCmd::_internal_pull() const {
+  const ::ZPMeta::MetaCmd_Pull* p = _impl_.pull_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_Pull&>(
+      ::ZPMeta::_MetaCmd_Pull_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_Pull& MetaCmd::pull() const {
-  return pull_ != NULL ? *pull_ : *default_instance_->pull_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.pull)
+  return _internal_pull();
 }
-inline ::ZPMeta::MetaCmd_Pull* MetaCmd::mutable_pull() {
-  set_has_pull();
-  if (pull_ == NULL) pull_ = new ::ZPMeta::MetaCmd_Pull;
-  return pull_;
+inline void MetaCmd::unsafe_arena_set_allocated_pull(
+    ::ZPMeta::MetaCmd_Pull* pull) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pull_);
+  }
+  _impl_.pull_ = pull;
+  if (pull) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.pull)
 }
 inline ::ZPMeta::MetaCmd_Pull* MetaCmd::release_pull() {
-  clear_has_pull();
-  ::ZPMeta::MetaCmd_Pull* temp = pull_;
-  pull_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::MetaCmd_Pull* temp = _impl_.pull_;
+  _impl_.pull_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_Pull* MetaCmd::unsafe_arena_release_pull() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.pull)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::MetaCmd_Pull* temp = _impl_.pull_;
+  _impl_.pull_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmd_Pull* MetaCmd::_internal_mutable_pull() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.pull_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_Pull>(GetArenaForAllocation());
+    _impl_.pull_ = p;
+  }
+  return _impl_.pull_;
+}
+inline ::ZPMeta::MetaCmd_Pull* MetaCmd::mutable_pull() {
+  ::ZPMeta::MetaCmd_Pull* _msg = _internal_mutable_pull();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.pull)
+  return _msg;
+}
 inline void MetaCmd::set_allocated_pull(::ZPMeta::MetaCmd_Pull* pull) {
-  delete pull_;
-  pull_ = pull;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pull_;
+  }
   if (pull) {
-    set_has_pull();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pull);
+    if (message_arena != submessage_arena) {
+      pull = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pull, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_pull();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.pull_ = pull;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.pull)
 }
 
 // optional .ZPMeta.MetaCmd.Init init = 4;
-inline bool MetaCmd::has_init() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool MetaCmd::_internal_has_init() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.init_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_init() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void MetaCmd::clear_has_init() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool MetaCmd::has_init() const {
+  return _internal_has_init();
 }
 inline void MetaCmd::clear_init() {
-  if (init_ != NULL) init_->::ZPMeta::MetaCmd_Init::Clear();
-  clear_has_init();
+  if (_impl_.init_ != nullptr) _impl_.init_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::ZPMeta::MetaCmd_Init& MetaCmd::_internal_init() const {
+  const ::ZPMeta::MetaCmd_Init* p = _impl_.init_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_Init&>(
+      ::ZPMeta::_MetaCmd_Init_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_Init& MetaCmd::init() const {
-  return init_ != NULL ? *init_ : *default_instance_->init_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.init)
+  return _internal_init();
 }
-inline ::ZPMeta::MetaCmd_Init* MetaCmd::mutable_init() {
-  set_has_init();
-  if (init_ == NULL) init_ = new ::ZPMeta::MetaCmd_Init;
-  return init_;
+inline void MetaCmd::unsafe_arena_set_allocated_init(
+    ::ZPMeta::MetaCmd_Init* init) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.init_);
+  }
+  _impl_.init_ = init;
+  if (init) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.init)
 }
 inline ::ZPMeta::MetaCmd_Init* MetaCmd::release_init() {
-  clear_has_init();
-  ::ZPMeta::MetaCmd_Init* temp = init_;
-  init_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ZPMeta::MetaCmd_Init* temp = _impl_.init_;
+  _impl_.init_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_Init* MetaCmd::unsafe_arena_release_init() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.init)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ZPMeta::MetaCmd_Init* temp = _impl_.init_;
+  _impl_.init_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmd_Init* MetaCmd::_internal_mutable_init() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.init_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_Init>(GetArenaForAllocation());
+    _impl_.init_ = p;
+  }
+  return _impl_.init_;
+}
+inline ::ZPMeta::MetaCmd_Init* MetaCmd::mutable_init() {
+  ::ZPMeta::MetaCmd_Init* _msg = _internal_mutable_init();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.init)
+  return _msg;
+}
 inline void MetaCmd::set_allocated_init(::ZPMeta::MetaCmd_Init* init) {
-  delete init_;
-  init_ = init;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.init_;
+  }
   if (init) {
-    set_has_init();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(init);
+    if (message_arena != submessage_arena) {
+      init = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, init, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_init();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.init_ = init;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.init)
 }
 
 // optional .ZPMeta.MetaCmd.SetMaster set_master = 5;
-inline bool MetaCmd::has_set_master() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool MetaCmd::_internal_has_set_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.set_master_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_set_master() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void MetaCmd::clear_has_set_master() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool MetaCmd::has_set_master() const {
+  return _internal_has_set_master();
 }
 inline void MetaCmd::clear_set_master() {
-  if (set_master_ != NULL) set_master_->::ZPMeta::MetaCmd_SetMaster::Clear();
-  clear_has_set_master();
+  if (_impl_.set_master_ != nullptr) _impl_.set_master_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::ZPMeta::MetaCmd_SetMaster& MetaCmd::_internal_set_master() const {
+  const ::ZPMeta::MetaCmd_SetMaster* p = _impl_.set_master_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_SetMaster&>(
+      ::ZPMeta::_MetaCmd_SetMaster_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_SetMaster& MetaCmd::set_master() const {
-  return set_master_ != NULL ? *set_master_ : *default_instance_->set_master_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.set_master)
+  return _internal_set_master();
 }
-inline ::ZPMeta::MetaCmd_SetMaster* MetaCmd::mutable_set_master() {
-  set_has_set_master();
-  if (set_master_ == NULL) set_master_ = new ::ZPMeta::MetaCmd_SetMaster;
-  return set_master_;
+inline void MetaCmd::unsafe_arena_set_allocated_set_master(
+    ::ZPMeta::MetaCmd_SetMaster* set_master) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.set_master_);
+  }
+  _impl_.set_master_ = set_master;
+  if (set_master) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.set_master)
 }
 inline ::ZPMeta::MetaCmd_SetMaster* MetaCmd::release_set_master() {
-  clear_has_set_master();
-  ::ZPMeta::MetaCmd_SetMaster* temp = set_master_;
-  set_master_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ZPMeta::MetaCmd_SetMaster* temp = _impl_.set_master_;
+  _impl_.set_master_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_SetMaster* MetaCmd::unsafe_arena_release_set_master() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.set_master)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ZPMeta::MetaCmd_SetMaster* temp = _impl_.set_master_;
+  _impl_.set_master_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmd_SetMaster* MetaCmd::_internal_mutable_set_master() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.set_master_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_SetMaster>(GetArenaForAllocation());
+    _impl_.set_master_ = p;
+  }
+  return _impl_.set_master_;
+}
+inline ::ZPMeta::MetaCmd_SetMaster* MetaCmd::mutable_set_master() {
+  ::ZPMeta::MetaCmd_SetMaster* _msg = _internal_mutable_set_master();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.set_master)
+  return _msg;
+}
 inline void MetaCmd::set_allocated_set_master(::ZPMeta::MetaCmd_SetMaster* set_master) {
-  delete set_master_;
-  set_master_ = set_master;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.set_master_;
+  }
   if (set_master) {
-    set_has_set_master();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_master);
+    if (message_arena != submessage_arena) {
+      set_master = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_master, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_set_master();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.set_master_ = set_master;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.set_master)
 }
 
 // optional .ZPMeta.MetaCmd.AddSlave add_slave = 6;
-inline bool MetaCmd::has_add_slave() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool MetaCmd::_internal_has_add_slave() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.add_slave_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_add_slave() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void MetaCmd::clear_has_add_slave() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool MetaCmd::has_add_slave() const {
+  return _internal_has_add_slave();
 }
 inline void MetaCmd::clear_add_slave() {
-  if (add_slave_ != NULL) add_slave_->::ZPMeta::MetaCmd_AddSlave::Clear();
-  clear_has_add_slave();
+  if (_impl_.add_slave_ != nullptr) _impl_.add_slave_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::ZPMeta::MetaCmd_AddSlave& MetaCmd::_internal_add_slave() const {
+  const ::ZPMeta::MetaCmd_AddSlave* p = _impl_.add_slave_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_AddSlave&>(
+      ::ZPMeta::_MetaCmd_AddSlave_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_AddSlave& MetaCmd::add_slave() const {
-  return add_slave_ != NULL ? *add_slave_ : *default_instance_->add_slave_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.add_slave)
+  return _internal_add_slave();
 }
-inline ::ZPMeta::MetaCmd_AddSlave* MetaCmd::mutable_add_slave() {
-  set_has_add_slave();
-  if (add_slave_ == NULL) add_slave_ = new ::ZPMeta::MetaCmd_AddSlave;
-  return add_slave_;
+inline void MetaCmd::unsafe_arena_set_allocated_add_slave(
+    ::ZPMeta::MetaCmd_AddSlave* add_slave) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.add_slave_);
+  }
+  _impl_.add_slave_ = add_slave;
+  if (add_slave) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.add_slave)
 }
 inline ::ZPMeta::MetaCmd_AddSlave* MetaCmd::release_add_slave() {
-  clear_has_add_slave();
-  ::ZPMeta::MetaCmd_AddSlave* temp = add_slave_;
-  add_slave_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::ZPMeta::MetaCmd_AddSlave* temp = _impl_.add_slave_;
+  _impl_.add_slave_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_AddSlave* MetaCmd::unsafe_arena_release_add_slave() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.add_slave)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::ZPMeta::MetaCmd_AddSlave* temp = _impl_.add_slave_;
+  _impl_.add_slave_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmd_AddSlave* MetaCmd::_internal_mutable_add_slave() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.add_slave_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_AddSlave>(GetArenaForAllocation());
+    _impl_.add_slave_ = p;
+  }
+  return _impl_.add_slave_;
+}
+inline ::ZPMeta::MetaCmd_AddSlave* MetaCmd::mutable_add_slave() {
+  ::ZPMeta::MetaCmd_AddSlave* _msg = _internal_mutable_add_slave();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.add_slave)
+  return _msg;
+}
 inline void MetaCmd::set_allocated_add_slave(::ZPMeta::MetaCmd_AddSlave* add_slave) {
-  delete add_slave_;
-  add_slave_ = add_slave;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.add_slave_;
+  }
   if (add_slave) {
-    set_has_add_slave();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(add_slave);
+    if (message_arena != submessage_arena) {
+      add_slave = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, add_slave, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_add_slave();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.add_slave_ = add_slave;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.add_slave)
 }
 
 // optional .ZPMeta.MetaCmd.RemoveSlave remove_slave = 7;
-inline bool MetaCmd::has_remove_slave() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool MetaCmd::_internal_has_remove_slave() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.remove_slave_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_remove_slave() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void MetaCmd::clear_has_remove_slave() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool MetaCmd::has_remove_slave() const {
+  return _internal_has_remove_slave();
 }
 inline void MetaCmd::clear_remove_slave() {
-  if (remove_slave_ != NULL) remove_slave_->::ZPMeta::MetaCmd_RemoveSlave::Clear();
-  clear_has_remove_slave();
+  if (_impl_.remove_slave_ != nullptr) _impl_.remove_slave_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::ZPMeta::MetaCmd_RemoveSlave& MetaCmd::_internal_remove_slave() const {
+  const ::ZPMeta::MetaCmd_RemoveSlave* p = _impl_.remove_slave_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_RemoveSlave&>(
+      ::ZPMeta::_MetaCmd_RemoveSlave_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_RemoveSlave& MetaCmd::remove_slave() const {
-  return remove_slave_ != NULL ? *remove_slave_ : *default_instance_->remove_slave_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.remove_slave)
+  return _internal_remove_slave();
+}
+inline void MetaCmd::unsafe_arena_set_allocated_remove_slave(
+    ::ZPMeta::MetaCmd_RemoveSlave* remove_slave) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.remove_slave_);
+  }
+  _impl_.remove_slave_ = remove_slave;
+  if (remove_slave) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.remove_slave)
+}
+inline ::ZPMeta::MetaCmd_RemoveSlave* MetaCmd::release_remove_slave() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::ZPMeta::MetaCmd_RemoveSlave* temp = _impl_.remove_slave_;
+  _impl_.remove_slave_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_RemoveSlave* MetaCmd::unsafe_arena_release_remove_slave() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.remove_slave)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::ZPMeta::MetaCmd_RemoveSlave* temp = _impl_.remove_slave_;
+  _impl_.remove_slave_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_RemoveSlave* MetaCmd::_internal_mutable_remove_slave() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.remove_slave_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_RemoveSlave>(GetArenaForAllocation());
+    _impl_.remove_slave_ = p;
+  }
+  return _impl_.remove_slave_;
 }
 inline ::ZPMeta::MetaCmd_RemoveSlave* MetaCmd::mutable_remove_slave() {
-  set_has_remove_slave();
-  if (remove_slave_ == NULL) remove_slave_ = new ::ZPMeta::MetaCmd_RemoveSlave;
-  return remove_slave_;
-}
-inline ::ZPMeta::MetaCmd_RemoveSlave* MetaCmd::release_remove_slave() {
-  clear_has_remove_slave();
-  ::ZPMeta::MetaCmd_RemoveSlave* temp = remove_slave_;
-  remove_slave_ = NULL;
-  return temp;
+  ::ZPMeta::MetaCmd_RemoveSlave* _msg = _internal_mutable_remove_slave();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.remove_slave)
+  return _msg;
 }
 inline void MetaCmd::set_allocated_remove_slave(::ZPMeta::MetaCmd_RemoveSlave* remove_slave) {
-  delete remove_slave_;
-  remove_slave_ = remove_slave;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.remove_slave_;
+  }
   if (remove_slave) {
-    set_has_remove_slave();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(remove_slave);
+    if (message_arena != submessage_arena) {
+      remove_slave = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, remove_slave, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_remove_slave();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
+  _impl_.remove_slave_ = remove_slave;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.remove_slave)
 }
 
 // optional .ZPMeta.MetaCmd.DropTable drop_table = 8;
-inline bool MetaCmd::has_drop_table() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+inline bool MetaCmd::_internal_has_drop_table() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.drop_table_ != nullptr);
+  return value;
 }
-inline void MetaCmd::set_has_drop_table() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void MetaCmd::clear_has_drop_table() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool MetaCmd::has_drop_table() const {
+  return _internal_has_drop_table();
 }
 inline void MetaCmd::clear_drop_table() {
-  if (drop_table_ != NULL) drop_table_->::ZPMeta::MetaCmd_DropTable::Clear();
-  clear_has_drop_table();
+  if (_impl_.drop_table_ != nullptr) _impl_.drop_table_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::ZPMeta::MetaCmd_DropTable& MetaCmd::_internal_drop_table() const {
+  const ::ZPMeta::MetaCmd_DropTable* p = _impl_.drop_table_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_DropTable&>(
+      ::ZPMeta::_MetaCmd_DropTable_default_instance_);
 }
 inline const ::ZPMeta::MetaCmd_DropTable& MetaCmd::drop_table() const {
-  return drop_table_ != NULL ? *drop_table_ : *default_instance_->drop_table_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.drop_table)
+  return _internal_drop_table();
 }
-inline ::ZPMeta::MetaCmd_DropTable* MetaCmd::mutable_drop_table() {
-  set_has_drop_table();
-  if (drop_table_ == NULL) drop_table_ = new ::ZPMeta::MetaCmd_DropTable;
-  return drop_table_;
+inline void MetaCmd::unsafe_arena_set_allocated_drop_table(
+    ::ZPMeta::MetaCmd_DropTable* drop_table) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drop_table_);
+  }
+  _impl_.drop_table_ = drop_table;
+  if (drop_table) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.drop_table)
 }
 inline ::ZPMeta::MetaCmd_DropTable* MetaCmd::release_drop_table() {
-  clear_has_drop_table();
-  ::ZPMeta::MetaCmd_DropTable* temp = drop_table_;
-  drop_table_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::ZPMeta::MetaCmd_DropTable* temp = _impl_.drop_table_;
+  _impl_.drop_table_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_DropTable* MetaCmd::unsafe_arena_release_drop_table() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.drop_table)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::ZPMeta::MetaCmd_DropTable* temp = _impl_.drop_table_;
+  _impl_.drop_table_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmd_DropTable* MetaCmd::_internal_mutable_drop_table() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.drop_table_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_DropTable>(GetArenaForAllocation());
+    _impl_.drop_table_ = p;
+  }
+  return _impl_.drop_table_;
+}
+inline ::ZPMeta::MetaCmd_DropTable* MetaCmd::mutable_drop_table() {
+  ::ZPMeta::MetaCmd_DropTable* _msg = _internal_mutable_drop_table();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.drop_table)
+  return _msg;
+}
 inline void MetaCmd::set_allocated_drop_table(::ZPMeta::MetaCmd_DropTable* drop_table) {
-  delete drop_table_;
-  drop_table_ = drop_table;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drop_table_;
+  }
   if (drop_table) {
-    set_has_drop_table();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drop_table);
+    if (message_arena != submessage_arena) {
+      drop_table = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, drop_table, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.drop_table_ = drop_table;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.drop_table)
+}
+
+// optional .ZPMeta.MetaCmd.SetChain set_chain = 9;
+inline bool MetaCmd::_internal_has_set_chain() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.set_chain_ != nullptr);
+  return value;
+}
+inline bool MetaCmd::has_set_chain() const {
+  return _internal_has_set_chain();
+}
+inline void MetaCmd::clear_set_chain() {
+  if (_impl_.set_chain_ != nullptr) _impl_.set_chain_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::ZPMeta::MetaCmd_SetChain& MetaCmd::_internal_set_chain() const {
+  const ::ZPMeta::MetaCmd_SetChain* p = _impl_.set_chain_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmd_SetChain&>(
+      ::ZPMeta::_MetaCmd_SetChain_default_instance_);
+}
+inline const ::ZPMeta::MetaCmd_SetChain& MetaCmd::set_chain() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmd.set_chain)
+  return _internal_set_chain();
+}
+inline void MetaCmd::unsafe_arena_set_allocated_set_chain(
+    ::ZPMeta::MetaCmd_SetChain* set_chain) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.set_chain_);
+  }
+  _impl_.set_chain_ = set_chain;
+  if (set_chain) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmd.set_chain)
+}
+inline ::ZPMeta::MetaCmd_SetChain* MetaCmd::release_set_chain() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::ZPMeta::MetaCmd_SetChain* temp = _impl_.set_chain_;
+  _impl_.set_chain_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_SetChain* MetaCmd::unsafe_arena_release_set_chain() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmd.set_chain)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::ZPMeta::MetaCmd_SetChain* temp = _impl_.set_chain_;
+  _impl_.set_chain_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::MetaCmd_SetChain* MetaCmd::_internal_mutable_set_chain() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.set_chain_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmd_SetChain>(GetArenaForAllocation());
+    _impl_.set_chain_ = p;
+  }
+  return _impl_.set_chain_;
+}
+inline ::ZPMeta::MetaCmd_SetChain* MetaCmd::mutable_set_chain() {
+  ::ZPMeta::MetaCmd_SetChain* _msg = _internal_mutable_set_chain();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmd.set_chain)
+  return _msg;
+}
+inline void MetaCmd::set_allocated_set_chain(::ZPMeta::MetaCmd_SetChain* set_chain) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.set_chain_;
+  }
+  if (set_chain) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_chain);
+    if (message_arena != submessage_arena) {
+      set_chain = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_chain, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_drop_table();
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.set_chain_ = set_chain;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmd.set_chain)
 }
 
 // -------------------------------------------------------------------
@@ -4035,25 +7876,31 @@ inline void MetaCmd::set_allocated_drop_table(::ZPMeta::MetaCmd_DropTable* drop_
 // MetaCmdResponse_Ping
 
 // required int32 version = 1;
+inline bool MetaCmdResponse_Ping::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool MetaCmdResponse_Ping::has_version() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_version();
 }
-inline void MetaCmdResponse_Ping::set_has_version() {
-  _has_bits_[0] |= 0x00000001u;
+inline void MetaCmdResponse_Ping::clear_version() {
+  _impl_.version_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void MetaCmdResponse_Ping::clear_has_version() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t MetaCmdResponse_Ping::_internal_version() const {
+  return _impl_.version_;
 }
-inline void MetaCmdResponse_Ping::clear_version() {
-  version_ = 0;
-  clear_has_version();
+inline int32_t MetaCmdResponse_Ping::version() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.Ping.version)
+  return _internal_version();
 }
-inline ::google::protobuf::int32 MetaCmdResponse_Ping::version() const {
-  return version_;
+inline void MetaCmdResponse_Ping::_internal_set_version(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
 }
-inline void MetaCmdResponse_Ping::set_version(::google::protobuf::int32 value) {
-  set_has_version();
-  version_ = value;
+inline void MetaCmdResponse_Ping::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmdResponse.Ping.version)
 }
 
 // -------------------------------------------------------------------
@@ -4061,50 +7908,71 @@ inline void MetaCmdResponse_Ping::set_version(::google::protobuf::int32 value) {
 // MetaCmdResponse_Pull
 
 // required int32 version = 1;
+inline bool MetaCmdResponse_Pull::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool MetaCmdResponse_Pull::has_version() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_version();
 }
-inline void MetaCmdResponse_Pull::set_has_version() {
-  _has_bits_[0] |= 0x00000001u;
+inline void MetaCmdResponse_Pull::clear_version() {
+  _impl_.version_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void MetaCmdResponse_Pull::clear_has_version() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t MetaCmdResponse_Pull::_internal_version() const {
+  return _impl_.version_;
 }
-inline void MetaCmdResponse_Pull::clear_version() {
-  version_ = 0;
-  clear_has_version();
+inline int32_t MetaCmdResponse_Pull::version() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.Pull.version)
+  return _internal_version();
 }
-inline ::google::protobuf::int32 MetaCmdResponse_Pull::version() const {
-  return version_;
+inline void MetaCmdResponse_Pull::_internal_set_version(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
 }
-inline void MetaCmdResponse_Pull::set_version(::google::protobuf::int32 value) {
-  set_has_version();
-  version_ = value;
+inline void MetaCmdResponse_Pull::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmdResponse.Pull.version)
 }
 
 // repeated .ZPMeta.Table info = 2;
+inline int MetaCmdResponse_Pull::_internal_info_size() const {
+  return _impl_.info_.size();
+}
 inline int MetaCmdResponse_Pull::info_size() const {
-  return info_.size();
+  return _internal_info_size();
 }
 inline void MetaCmdResponse_Pull::clear_info() {
-  info_.Clear();
+  _impl_.info_.Clear();
+}
+inline ::ZPMeta::Table* MetaCmdResponse_Pull::mutable_info(int index) {
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.Pull.info)
+  return _impl_.info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Table >*
+MetaCmdResponse_Pull::mutable_info() {
+  // @@protoc_insertion_point(field_mutable_list:ZPMeta.MetaCmdResponse.Pull.info)
+  return &_impl_.info_;
+}
+inline const ::ZPMeta::Table& MetaCmdResponse_Pull::_internal_info(int index) const {
+  return _impl_.info_.Get(index);
 }
 inline const ::ZPMeta::Table& MetaCmdResponse_Pull::info(int index) const {
-  return info_.Get(index);
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.Pull.info)
+  return _internal_info(index);
 }
-inline ::ZPMeta::Table* MetaCmdResponse_Pull::mutable_info(int index) {
-  return info_.Mutable(index);
+inline ::ZPMeta::Table* MetaCmdResponse_Pull::_internal_add_info() {
+  return _impl_.info_.Add();
 }
 inline ::ZPMeta::Table* MetaCmdResponse_Pull::add_info() {
-  return info_.Add();
+  ::ZPMeta::Table* _add = _internal_add_info();
+  // @@protoc_insertion_point(field_add:ZPMeta.MetaCmdResponse.Pull.info)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ZPMeta::Table >&
 MetaCmdResponse_Pull::info() const {
-  return info_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table >*
-MetaCmdResponse_Pull::mutable_info() {
-  return &info_;
+  // @@protoc_insertion_point(field_list:ZPMeta.MetaCmdResponse.Pull.info)
+  return _impl_.info_;
 }
 
 // -------------------------------------------------------------------
@@ -4112,41 +7980,93 @@ MetaCmdResponse_Pull::mutable_info() {
 // MetaCmdResponse_ListTable
 
 // optional .ZPMeta.TableName tables = 1;
-inline bool MetaCmdResponse_ListTable::has_tables() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool MetaCmdResponse_ListTable::_internal_has_tables() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.tables_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse_ListTable::set_has_tables() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MetaCmdResponse_ListTable::clear_has_tables() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmdResponse_ListTable::has_tables() const {
+  return _internal_has_tables();
 }
 inline void MetaCmdResponse_ListTable::clear_tables() {
-  if (tables_ != NULL) tables_->::ZPMeta::TableName::Clear();
-  clear_has_tables();
+  if (_impl_.tables_ != nullptr) _impl_.tables_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::TableName& MetaCmdResponse_ListTable::_internal_tables() const {
+  const ::ZPMeta::TableName* p = _impl_.tables_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::TableName&>(
+      ::ZPMeta::_TableName_default_instance_);
 }
 inline const ::ZPMeta::TableName& MetaCmdResponse_ListTable::tables() const {
-  return tables_ != NULL ? *tables_ : *default_instance_->tables_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.ListTable.tables)
+  return _internal_tables();
 }
-inline ::ZPMeta::TableName* MetaCmdResponse_ListTable::mutable_tables() {
-  set_has_tables();
-  if (tables_ == NULL) tables_ = new ::ZPMeta::TableName;
-  return tables_;
+inline void MetaCmdResponse_ListTable::unsafe_arena_set_allocated_tables(
+    ::ZPMeta::TableName* tables) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.tables_);
+  }
+  _impl_.tables_ = tables;
+  if (tables) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.ListTable.tables)
 }
 inline ::ZPMeta::TableName* MetaCmdResponse_ListTable::release_tables() {
-  clear_has_tables();
-  ::ZPMeta::TableName* temp = tables_;
-  tables_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::TableName* temp = _impl_.tables_;
+  _impl_.tables_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::ZPMeta::TableName* MetaCmdResponse_ListTable::unsafe_arena_release_tables() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.ListTable.tables)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::TableName* temp = _impl_.tables_;
+  _impl_.tables_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::TableName* MetaCmdResponse_ListTable::_internal_mutable_tables() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.tables_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::TableName>(GetArenaForAllocation());
+    _impl_.tables_ = p;
+  }
+  return _impl_.tables_;
+}
+inline ::ZPMeta::TableName* MetaCmdResponse_ListTable::mutable_tables() {
+  ::ZPMeta::TableName* _msg = _internal_mutable_tables();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.ListTable.tables)
+  return _msg;
+}
 inline void MetaCmdResponse_ListTable::set_allocated_tables(::ZPMeta::TableName* tables) {
-  delete tables_;
-  tables_ = tables;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.tables_;
+  }
   if (tables) {
-    set_has_tables();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(tables);
+    if (message_arena != submessage_arena) {
+      tables = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tables, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_tables();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.tables_ = tables;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.ListTable.tables)
 }
 
 // -------------------------------------------------------------------
@@ -4154,41 +8074,93 @@ inline void MetaCmdResponse_ListTable::set_allocated_tables(::ZPMeta::TableName*
 // MetaCmdResponse_ListNode
 
 // optional .ZPMeta.Nodes nodes = 1;
-inline bool MetaCmdResponse_ListNode::has_nodes() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool MetaCmdResponse_ListNode::_internal_has_nodes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.nodes_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse_ListNode::set_has_nodes() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MetaCmdResponse_ListNode::clear_has_nodes() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmdResponse_ListNode::has_nodes() const {
+  return _internal_has_nodes();
 }
 inline void MetaCmdResponse_ListNode::clear_nodes() {
-  if (nodes_ != NULL) nodes_->::ZPMeta::Nodes::Clear();
-  clear_has_nodes();
+  if (_impl_.nodes_ != nullptr) _impl_.nodes_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::Nodes& MetaCmdResponse_ListNode::_internal_nodes() const {
+  const ::ZPMeta::Nodes* p = _impl_.nodes_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::Nodes&>(
+      ::ZPMeta::_Nodes_default_instance_);
 }
 inline const ::ZPMeta::Nodes& MetaCmdResponse_ListNode::nodes() const {
-  return nodes_ != NULL ? *nodes_ : *default_instance_->nodes_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.ListNode.nodes)
+  return _internal_nodes();
 }
-inline ::ZPMeta::Nodes* MetaCmdResponse_ListNode::mutable_nodes() {
-  set_has_nodes();
-  if (nodes_ == NULL) nodes_ = new ::ZPMeta::Nodes;
-  return nodes_;
+inline void MetaCmdResponse_ListNode::unsafe_arena_set_allocated_nodes(
+    ::ZPMeta::Nodes* nodes) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.nodes_);
+  }
+  _impl_.nodes_ = nodes;
+  if (nodes) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.ListNode.nodes)
 }
 inline ::ZPMeta::Nodes* MetaCmdResponse_ListNode::release_nodes() {
-  clear_has_nodes();
-  ::ZPMeta::Nodes* temp = nodes_;
-  nodes_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Nodes* temp = _impl_.nodes_;
+  _impl_.nodes_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::ZPMeta::Nodes* MetaCmdResponse_ListNode::unsafe_arena_release_nodes() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.ListNode.nodes)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::Nodes* temp = _impl_.nodes_;
+  _impl_.nodes_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::Nodes* MetaCmdResponse_ListNode::_internal_mutable_nodes() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.nodes_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::Nodes>(GetArenaForAllocation());
+    _impl_.nodes_ = p;
+  }
+  return _impl_.nodes_;
+}
+inline ::ZPMeta::Nodes* MetaCmdResponse_ListNode::mutable_nodes() {
+  ::ZPMeta::Nodes* _msg = _internal_mutable_nodes();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.ListNode.nodes)
+  return _msg;
+}
 inline void MetaCmdResponse_ListNode::set_allocated_nodes(::ZPMeta::Nodes* nodes) {
-  delete nodes_;
-  nodes_ = nodes;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.nodes_;
+  }
   if (nodes) {
-    set_has_nodes();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(nodes);
+    if (message_arena != submessage_arena) {
+      nodes = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nodes, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_nodes();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.nodes_ = nodes;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.ListNode.nodes)
 }
 
 // -------------------------------------------------------------------
@@ -4196,41 +8168,93 @@ inline void MetaCmdResponse_ListNode::set_allocated_nodes(::ZPMeta::Nodes* nodes
 // MetaCmdResponse_ListMeta
 
 // required .ZPMeta.MetaNodes nodes = 1;
-inline bool MetaCmdResponse_ListMeta::has_nodes() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool MetaCmdResponse_ListMeta::_internal_has_nodes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.nodes_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse_ListMeta::set_has_nodes() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MetaCmdResponse_ListMeta::clear_has_nodes() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmdResponse_ListMeta::has_nodes() const {
+  return _internal_has_nodes();
 }
 inline void MetaCmdResponse_ListMeta::clear_nodes() {
-  if (nodes_ != NULL) nodes_->::ZPMeta::MetaNodes::Clear();
-  clear_has_nodes();
+  if (_impl_.nodes_ != nullptr) _impl_.nodes_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ZPMeta::MetaNodes& MetaCmdResponse_ListMeta::_internal_nodes() const {
+  const ::ZPMeta::MetaNodes* p = _impl_.nodes_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaNodes&>(
+      ::ZPMeta::_MetaNodes_default_instance_);
 }
 inline const ::ZPMeta::MetaNodes& MetaCmdResponse_ListMeta::nodes() const {
-  return nodes_ != NULL ? *nodes_ : *default_instance_->nodes_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.ListMeta.nodes)
+  return _internal_nodes();
 }
-inline ::ZPMeta::MetaNodes* MetaCmdResponse_ListMeta::mutable_nodes() {
-  set_has_nodes();
-  if (nodes_ == NULL) nodes_ = new ::ZPMeta::MetaNodes;
-  return nodes_;
+inline void MetaCmdResponse_ListMeta::unsafe_arena_set_allocated_nodes(
+    ::ZPMeta::MetaNodes* nodes) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.nodes_);
+  }
+  _impl_.nodes_ = nodes;
+  if (nodes) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.ListMeta.nodes)
 }
 inline ::ZPMeta::MetaNodes* MetaCmdResponse_ListMeta::release_nodes() {
-  clear_has_nodes();
-  ::ZPMeta::MetaNodes* temp = nodes_;
-  nodes_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::MetaNodes* temp = _impl_.nodes_;
+  _impl_.nodes_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::ZPMeta::MetaNodes* MetaCmdResponse_ListMeta::unsafe_arena_release_nodes() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.ListMeta.nodes)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ZPMeta::MetaNodes* temp = _impl_.nodes_;
+  _impl_.nodes_ = nullptr;
+  return temp;
+}
+inline ::ZPMeta::MetaNodes* MetaCmdResponse_ListMeta::_internal_mutable_nodes() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.nodes_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaNodes>(GetArenaForAllocation());
+    _impl_.nodes_ = p;
+  }
+  return _impl_.nodes_;
+}
+inline ::ZPMeta::MetaNodes* MetaCmdResponse_ListMeta::mutable_nodes() {
+  ::ZPMeta::MetaNodes* _msg = _internal_mutable_nodes();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.ListMeta.nodes)
+  return _msg;
+}
 inline void MetaCmdResponse_ListMeta::set_allocated_nodes(::ZPMeta::MetaNodes* nodes) {
-  delete nodes_;
-  nodes_ = nodes;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.nodes_;
+  }
   if (nodes) {
-    set_has_nodes();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(nodes);
+    if (message_arena != submessage_arena) {
+      nodes = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nodes, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_nodes();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.nodes_ = nodes;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.ListMeta.nodes)
 }
 
 // -------------------------------------------------------------------
@@ -4238,337 +8262,656 @@ inline void MetaCmdResponse_ListMeta::set_allocated_nodes(::ZPMeta::MetaNodes* n
 // MetaCmdResponse
 
 // required .ZPMeta.Type type = 1;
-inline bool MetaCmdResponse::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool MetaCmdResponse::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void MetaCmdResponse::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MetaCmdResponse::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MetaCmdResponse::has_type() const {
+  return _internal_has_type();
 }
 inline void MetaCmdResponse::clear_type() {
-  type_ = 1;
-  clear_has_type();
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::ZPMeta::Type MetaCmdResponse::_internal_type() const {
+  return static_cast< ::ZPMeta::Type >(_impl_.type_);
 }
 inline ::ZPMeta::Type MetaCmdResponse::type() const {
-  return static_cast< ::ZPMeta::Type >(type_);
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.type)
+  return _internal_type();
 }
-inline void MetaCmdResponse::set_type(::ZPMeta::Type value) {
+inline void MetaCmdResponse::_internal_set_type(::ZPMeta::Type value) {
   assert(::ZPMeta::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.type_ = value;
+}
+inline void MetaCmdResponse::set_type(::ZPMeta::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmdResponse.type)
 }
 
 // required .ZPMeta.StatusCode code = 2;
-inline bool MetaCmdResponse::has_code() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void MetaCmdResponse::set_has_code() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool MetaCmdResponse::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void MetaCmdResponse::clear_has_code() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool MetaCmdResponse::has_code() const {
+  return _internal_has_code();
 }
 inline void MetaCmdResponse::clear_code() {
-  code_ = 0;
-  clear_has_code();
+  _impl_.code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::ZPMeta::StatusCode MetaCmdResponse::_internal_code() const {
+  return static_cast< ::ZPMeta::StatusCode >(_impl_.code_);
 }
 inline ::ZPMeta::StatusCode MetaCmdResponse::code() const {
-  return static_cast< ::ZPMeta::StatusCode >(code_);
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.code)
+  return _internal_code();
 }
-inline void MetaCmdResponse::set_code(::ZPMeta::StatusCode value) {
+inline void MetaCmdResponse::_internal_set_code(::ZPMeta::StatusCode value) {
   assert(::ZPMeta::StatusCode_IsValid(value));
-  set_has_code();
-  code_ = value;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.code_ = value;
+}
+inline void MetaCmdResponse::set_code(::ZPMeta::StatusCode value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmdResponse.code)
 }
 
 // optional string msg = 3;
-inline bool MetaCmdResponse::has_msg() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool MetaCmdResponse::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void MetaCmdResponse::set_has_msg() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void MetaCmdResponse::clear_has_msg() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool MetaCmdResponse::has_msg() const {
+  return _internal_has_msg();
 }
 inline void MetaCmdResponse::clear_msg() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    msg_->clear();
-  }
-  clear_has_msg();
-}
-inline const ::std::string& MetaCmdResponse::msg() const {
-  return *msg_;
-}
-inline void MetaCmdResponse::set_msg(const ::std::string& value) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(value);
-}
-inline void MetaCmdResponse::set_msg(const char* value) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(value);
-}
-inline void MetaCmdResponse::set_msg(const char* value, size_t size) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* MetaCmdResponse::mutable_msg() {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  return msg_;
-}
-inline ::std::string* MetaCmdResponse::release_msg() {
-  clear_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.msg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaCmdResponse::msg() const {
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaCmdResponse::set_msg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ZPMeta.MetaCmdResponse.msg)
+}
+inline std::string* MetaCmdResponse::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.msg)
+  return _s;
+}
+inline const std::string& MetaCmdResponse::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void MetaCmdResponse::_internal_set_msg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaCmdResponse::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaCmdResponse::release_msg() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.msg)
+  if (!_internal_has_msg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.msg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaCmdResponse::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = msg_;
-    msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void MetaCmdResponse::set_allocated_msg(::std::string* msg) {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (msg) {
-    set_has_msg();
-    msg_ = msg;
-  } else {
-    clear_has_msg();
-    msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.msg)
 }
 
 // optional .ZPMeta.MetaCmdResponse.Ping ping = 4;
-inline bool MetaCmdResponse::has_ping() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void MetaCmdResponse::set_has_ping() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool MetaCmdResponse::_internal_has_ping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ping_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse::clear_has_ping() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool MetaCmdResponse::has_ping() const {
+  return _internal_has_ping();
 }
 inline void MetaCmdResponse::clear_ping() {
-  if (ping_ != NULL) ping_->::ZPMeta::MetaCmdResponse_Ping::Clear();
-  clear_has_ping();
+  if (_impl_.ping_ != nullptr) _impl_.ping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::ZPMeta::MetaCmdResponse_Ping& MetaCmdResponse::_internal_ping() const {
+  const ::ZPMeta::MetaCmdResponse_Ping* p = _impl_.ping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmdResponse_Ping&>(
+      ::ZPMeta::_MetaCmdResponse_Ping_default_instance_);
 }
 inline const ::ZPMeta::MetaCmdResponse_Ping& MetaCmdResponse::ping() const {
-  return ping_ != NULL ? *ping_ : *default_instance_->ping_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.ping)
+  return _internal_ping();
 }
-inline ::ZPMeta::MetaCmdResponse_Ping* MetaCmdResponse::mutable_ping() {
-  set_has_ping();
-  if (ping_ == NULL) ping_ = new ::ZPMeta::MetaCmdResponse_Ping;
-  return ping_;
+inline void MetaCmdResponse::unsafe_arena_set_allocated_ping(
+    ::ZPMeta::MetaCmdResponse_Ping* ping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ping_);
+  }
+  _impl_.ping_ = ping;
+  if (ping) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.ping)
 }
 inline ::ZPMeta::MetaCmdResponse_Ping* MetaCmdResponse::release_ping() {
-  clear_has_ping();
-  ::ZPMeta::MetaCmdResponse_Ping* temp = ping_;
-  ping_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::MetaCmdResponse_Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmdResponse_Ping* MetaCmdResponse::unsafe_arena_release_ping() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.ping)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::ZPMeta::MetaCmdResponse_Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmdResponse_Ping* MetaCmdResponse::_internal_mutable_ping() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.ping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmdResponse_Ping>(GetArenaForAllocation());
+    _impl_.ping_ = p;
+  }
+  return _impl_.ping_;
+}
+inline ::ZPMeta::MetaCmdResponse_Ping* MetaCmdResponse::mutable_ping() {
+  ::ZPMeta::MetaCmdResponse_Ping* _msg = _internal_mutable_ping();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.ping)
+  return _msg;
+}
 inline void MetaCmdResponse::set_allocated_ping(::ZPMeta::MetaCmdResponse_Ping* ping) {
-  delete ping_;
-  ping_ = ping;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ping_;
+  }
   if (ping) {
-    set_has_ping();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ping);
+    if (message_arena != submessage_arena) {
+      ping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_ping();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.ping_ = ping;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.ping)
 }
 
 // optional .ZPMeta.MetaCmdResponse.Pull pull = 5;
-inline bool MetaCmdResponse::has_pull() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void MetaCmdResponse::set_has_pull() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool MetaCmdResponse::_internal_has_pull() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pull_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse::clear_has_pull() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool MetaCmdResponse::has_pull() const {
+  return _internal_has_pull();
 }
 inline void MetaCmdResponse::clear_pull() {
-  if (pull_ != NULL) pull_->::ZPMeta::MetaCmdResponse_Pull::Clear();
-  clear_has_pull();
+  if (_impl_.pull_ != nullptr) _impl_.pull_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::ZPMeta::MetaCmdResponse_Pull& MetaCmdResponse::_internal_pull() const {
+  const ::ZPMeta::MetaCmdResponse_Pull* p = _impl_.pull_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmdResponse_Pull&>(
+      ::ZPMeta::_MetaCmdResponse_Pull_default_instance_);
 }
 inline const ::ZPMeta::MetaCmdResponse_Pull& MetaCmdResponse::pull() const {
-  return pull_ != NULL ? *pull_ : *default_instance_->pull_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.pull)
+  return _internal_pull();
 }
-inline ::ZPMeta::MetaCmdResponse_Pull* MetaCmdResponse::mutable_pull() {
-  set_has_pull();
-  if (pull_ == NULL) pull_ = new ::ZPMeta::MetaCmdResponse_Pull;
-  return pull_;
+inline void MetaCmdResponse::unsafe_arena_set_allocated_pull(
+    ::ZPMeta::MetaCmdResponse_Pull* pull) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pull_);
+  }
+  _impl_.pull_ = pull;
+  if (pull) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.pull)
 }
 inline ::ZPMeta::MetaCmdResponse_Pull* MetaCmdResponse::release_pull() {
-  clear_has_pull();
-  ::ZPMeta::MetaCmdResponse_Pull* temp = pull_;
-  pull_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ZPMeta::MetaCmdResponse_Pull* temp = _impl_.pull_;
+  _impl_.pull_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmdResponse_Pull* MetaCmdResponse::unsafe_arena_release_pull() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.pull)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::ZPMeta::MetaCmdResponse_Pull* temp = _impl_.pull_;
+  _impl_.pull_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmdResponse_Pull* MetaCmdResponse::_internal_mutable_pull() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.pull_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmdResponse_Pull>(GetArenaForAllocation());
+    _impl_.pull_ = p;
+  }
+  return _impl_.pull_;
+}
+inline ::ZPMeta::MetaCmdResponse_Pull* MetaCmdResponse::mutable_pull() {
+  ::ZPMeta::MetaCmdResponse_Pull* _msg = _internal_mutable_pull();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.pull)
+  return _msg;
+}
 inline void MetaCmdResponse::set_allocated_pull(::ZPMeta::MetaCmdResponse_Pull* pull) {
-  delete pull_;
-  pull_ = pull;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pull_;
+  }
   if (pull) {
-    set_has_pull();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pull);
+    if (message_arena != submessage_arena) {
+      pull = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pull, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_pull();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.pull_ = pull;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.pull)
 }
 
 // optional .ZPMeta.MetaCmdResponse.ListTable list_table = 6;
-inline bool MetaCmdResponse::has_list_table() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void MetaCmdResponse::set_has_list_table() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool MetaCmdResponse::_internal_has_list_table() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.list_table_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse::clear_has_list_table() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool MetaCmdResponse::has_list_table() const {
+  return _internal_has_list_table();
 }
 inline void MetaCmdResponse::clear_list_table() {
-  if (list_table_ != NULL) list_table_->::ZPMeta::MetaCmdResponse_ListTable::Clear();
-  clear_has_list_table();
+  if (_impl_.list_table_ != nullptr) _impl_.list_table_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::ZPMeta::MetaCmdResponse_ListTable& MetaCmdResponse::_internal_list_table() const {
+  const ::ZPMeta::MetaCmdResponse_ListTable* p = _impl_.list_table_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmdResponse_ListTable&>(
+      ::ZPMeta::_MetaCmdResponse_ListTable_default_instance_);
 }
 inline const ::ZPMeta::MetaCmdResponse_ListTable& MetaCmdResponse::list_table() const {
-  return list_table_ != NULL ? *list_table_ : *default_instance_->list_table_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.list_table)
+  return _internal_list_table();
 }
-inline ::ZPMeta::MetaCmdResponse_ListTable* MetaCmdResponse::mutable_list_table() {
-  set_has_list_table();
-  if (list_table_ == NULL) list_table_ = new ::ZPMeta::MetaCmdResponse_ListTable;
-  return list_table_;
+inline void MetaCmdResponse::unsafe_arena_set_allocated_list_table(
+    ::ZPMeta::MetaCmdResponse_ListTable* list_table) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.list_table_);
+  }
+  _impl_.list_table_ = list_table;
+  if (list_table) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.list_table)
 }
 inline ::ZPMeta::MetaCmdResponse_ListTable* MetaCmdResponse::release_list_table() {
-  clear_has_list_table();
-  ::ZPMeta::MetaCmdResponse_ListTable* temp = list_table_;
-  list_table_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ZPMeta::MetaCmdResponse_ListTable* temp = _impl_.list_table_;
+  _impl_.list_table_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmdResponse_ListTable* MetaCmdResponse::unsafe_arena_release_list_table() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.list_table)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::ZPMeta::MetaCmdResponse_ListTable* temp = _impl_.list_table_;
+  _impl_.list_table_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmdResponse_ListTable* MetaCmdResponse::_internal_mutable_list_table() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.list_table_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmdResponse_ListTable>(GetArenaForAllocation());
+    _impl_.list_table_ = p;
+  }
+  return _impl_.list_table_;
+}
+inline ::ZPMeta::MetaCmdResponse_ListTable* MetaCmdResponse::mutable_list_table() {
+  ::ZPMeta::MetaCmdResponse_ListTable* _msg = _internal_mutable_list_table();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.list_table)
+  return _msg;
+}
 inline void MetaCmdResponse::set_allocated_list_table(::ZPMeta::MetaCmdResponse_ListTable* list_table) {
-  delete list_table_;
-  list_table_ = list_table;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.list_table_;
+  }
   if (list_table) {
-    set_has_list_table();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(list_table);
+    if (message_arena != submessage_arena) {
+      list_table = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list_table, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_list_table();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.list_table_ = list_table;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.list_table)
 }
 
 // optional .ZPMeta.MetaCmdResponse.ListNode list_node = 7;
-inline bool MetaCmdResponse::has_list_node() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void MetaCmdResponse::set_has_list_node() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool MetaCmdResponse::_internal_has_list_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.list_node_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse::clear_has_list_node() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool MetaCmdResponse::has_list_node() const {
+  return _internal_has_list_node();
 }
 inline void MetaCmdResponse::clear_list_node() {
-  if (list_node_ != NULL) list_node_->::ZPMeta::MetaCmdResponse_ListNode::Clear();
-  clear_has_list_node();
+  if (_impl_.list_node_ != nullptr) _impl_.list_node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::ZPMeta::MetaCmdResponse_ListNode& MetaCmdResponse::_internal_list_node() const {
+  const ::ZPMeta::MetaCmdResponse_ListNode* p = _impl_.list_node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmdResponse_ListNode&>(
+      ::ZPMeta::_MetaCmdResponse_ListNode_default_instance_);
 }
 inline const ::ZPMeta::MetaCmdResponse_ListNode& MetaCmdResponse::list_node() const {
-  return list_node_ != NULL ? *list_node_ : *default_instance_->list_node_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.list_node)
+  return _internal_list_node();
 }
-inline ::ZPMeta::MetaCmdResponse_ListNode* MetaCmdResponse::mutable_list_node() {
-  set_has_list_node();
-  if (list_node_ == NULL) list_node_ = new ::ZPMeta::MetaCmdResponse_ListNode;
-  return list_node_;
+inline void MetaCmdResponse::unsafe_arena_set_allocated_list_node(
+    ::ZPMeta::MetaCmdResponse_ListNode* list_node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.list_node_);
+  }
+  _impl_.list_node_ = list_node;
+  if (list_node) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.list_node)
 }
 inline ::ZPMeta::MetaCmdResponse_ListNode* MetaCmdResponse::release_list_node() {
-  clear_has_list_node();
-  ::ZPMeta::MetaCmdResponse_ListNode* temp = list_node_;
-  list_node_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::ZPMeta::MetaCmdResponse_ListNode* temp = _impl_.list_node_;
+  _impl_.list_node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmdResponse_ListNode* MetaCmdResponse::unsafe_arena_release_list_node() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.list_node)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::ZPMeta::MetaCmdResponse_ListNode* temp = _impl_.list_node_;
+  _impl_.list_node_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmdResponse_ListNode* MetaCmdResponse::_internal_mutable_list_node() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.list_node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmdResponse_ListNode>(GetArenaForAllocation());
+    _impl_.list_node_ = p;
+  }
+  return _impl_.list_node_;
+}
+inline ::ZPMeta::MetaCmdResponse_ListNode* MetaCmdResponse::mutable_list_node() {
+  ::ZPMeta::MetaCmdResponse_ListNode* _msg = _internal_mutable_list_node();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.list_node)
+  return _msg;
+}
 inline void MetaCmdResponse::set_allocated_list_node(::ZPMeta::MetaCmdResponse_ListNode* list_node) {
-  delete list_node_;
-  list_node_ = list_node;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.list_node_;
+  }
   if (list_node) {
-    set_has_list_node();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(list_node);
+    if (message_arena != submessage_arena) {
+      list_node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list_node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_list_node();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.list_node_ = list_node;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.list_node)
 }
 
 // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
-inline bool MetaCmdResponse::has_list_meta() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void MetaCmdResponse::set_has_list_meta() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool MetaCmdResponse::_internal_has_list_meta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.list_meta_ != nullptr);
+  return value;
 }
-inline void MetaCmdResponse::clear_has_list_meta() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool MetaCmdResponse::has_list_meta() const {
+  return _internal_has_list_meta();
 }
 inline void MetaCmdResponse::clear_list_meta() {
-  if (list_meta_ != NULL) list_meta_->::ZPMeta::MetaCmdResponse_ListMeta::Clear();
-  clear_has_list_meta();
+  if (_impl_.list_meta_ != nullptr) _impl_.list_meta_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::ZPMeta::MetaCmdResponse_ListMeta& MetaCmdResponse::_internal_list_meta() const {
+  const ::ZPMeta::MetaCmdResponse_ListMeta* p = _impl_.list_meta_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ZPMeta::MetaCmdResponse_ListMeta&>(
+      ::ZPMeta::_MetaCmdResponse_ListMeta_default_instance_);
 }
 inline const ::ZPMeta::MetaCmdResponse_ListMeta& MetaCmdResponse::list_meta() const {
-  return list_meta_ != NULL ? *list_meta_ : *default_instance_->list_meta_;
+  // @@protoc_insertion_point(field_get:ZPMeta.MetaCmdResponse.list_meta)
+  return _internal_list_meta();
 }
-inline ::ZPMeta::MetaCmdResponse_ListMeta* MetaCmdResponse::mutable_list_meta() {
-  set_has_list_meta();
-  if (list_meta_ == NULL) list_meta_ = new ::ZPMeta::MetaCmdResponse_ListMeta;
-  return list_meta_;
+inline void MetaCmdResponse::unsafe_arena_set_allocated_list_meta(
+    ::ZPMeta::MetaCmdResponse_ListMeta* list_meta) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.list_meta_);
+  }
+  _impl_.list_meta_ = list_meta;
+  if (list_meta) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ZPMeta.MetaCmdResponse.list_meta)
 }
 inline ::ZPMeta::MetaCmdResponse_ListMeta* MetaCmdResponse::release_list_meta() {
-  clear_has_list_meta();
-  ::ZPMeta::MetaCmdResponse_ListMeta* temp = list_meta_;
-  list_meta_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::ZPMeta::MetaCmdResponse_ListMeta* temp = _impl_.list_meta_;
+  _impl_.list_meta_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ZPMeta::MetaCmdResponse_ListMeta* MetaCmdResponse::unsafe_arena_release_list_meta() {
+  // @@protoc_insertion_point(field_release:ZPMeta.MetaCmdResponse.list_meta)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::ZPMeta::MetaCmdResponse_ListMeta* temp = _impl_.list_meta_;
+  _impl_.list_meta_ = nullptr;
   return temp;
 }
+inline ::ZPMeta::MetaCmdResponse_ListMeta* MetaCmdResponse::_internal_mutable_list_meta() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.list_meta_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ZPMeta::MetaCmdResponse_ListMeta>(GetArenaForAllocation());
+    _impl_.list_meta_ = p;
+  }
+  return _impl_.list_meta_;
+}
+inline ::ZPMeta::MetaCmdResponse_ListMeta* MetaCmdResponse::mutable_list_meta() {
+  ::ZPMeta::MetaCmdResponse_ListMeta* _msg = _internal_mutable_list_meta();
+  // @@protoc_insertion_point(field_mutable:ZPMeta.MetaCmdResponse.list_meta)
+  return _msg;
+}
 inline void MetaCmdResponse::set_allocated_list_meta(::ZPMeta::MetaCmdResponse_ListMeta* list_meta) {
-  delete list_meta_;
-  list_meta_ = list_meta;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.list_meta_;
+  }
   if (list_meta) {
-    set_has_list_meta();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(list_meta);
+    if (message_arena != submessage_arena) {
+      list_meta = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list_meta, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_list_meta();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
+  _impl_.list_meta_ = list_meta;
+  // @@protoc_insertion_point(field_set_allocated:ZPMeta.MetaCmdResponse.list_meta)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace ZPMeta
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::ZPMeta::StatusCode> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::ZPMeta::StatusCode>() {
   return ::ZPMeta::StatusCode_descriptor();
 }
+template <> struct is_proto_enum< ::ZPMeta::Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::ZPMeta::Type>() {
   return ::ZPMeta::Type_descriptor();
 }
+template <> struct is_proto_enum< ::ZPMeta::PState> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::ZPMeta::PState>() {
   return ::ZPMeta::PState_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_zp_5fmeta_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_zp_5fmeta_2eproto
@@ -4,6 +4,8 @@
 #include <string>
 #include <glog/logging.h>
 
+#include "include/zp_buffer_pool.h"
+
 using slash::RWLock;
 
 std::string NewFileName(const std::string name, const uint32_t current) {
@@ -16,6 +18,12 @@ uint64_t BinlogBlockStart(uint64_t offset) {
   return ((offset / kBlockSize) * kBlockSize);
 }
 
+int64_t BinlogDistance(uint32_t from_num, uint64_t from_offset,
+    uint32_t to_num, uint64_t to_offset) {
+  return (static_cast<int64_t>(to_num) - from_num) * static_cast<int64_t>(kBinlogSize)
+    + static_cast<int64_t>(to_offset) - static_cast<int64_t>(from_offset);
+}
+
 /*
  * Version
  */
@@ -211,13 +219,17 @@ Status BinlogWriter::AppendBlank(uint64_t len, int64_t* write_size) {
  */
 BinlogReader::BinlogReader(slash::SequentialFile *queue)
   :queue_(queue),
-  backing_store_(new char[kBlockSize]),
+  backing_store_(),
   buffer_(),
   last_record_offset_(0) {
   }
 
 BinlogReader::~BinlogReader() {
-  delete [] backing_store_;
+  ReleaseBuffer();
+}
+
+void BinlogReader::ReleaseBuffer() {
+  ZPBufferPool::Global()->Checkin(&backing_store_);
 }
 
 void BinlogReader::SkipNextBlock(uint64_t* size) {
@@ -247,7 +259,8 @@ Status BinlogReader::Consume(uint64_t* size, std::string* scratch) {
         if (inside_record) {
           return Status::Incomplete("Not found end item");
         }
-        *scratch = std::string(fragment.data(), fragment.size());
+        // Assign to keep the capacity of scratch
+        scratch->assign(fragment.data(), fragment.size());
         return Status::OK();
       case kFirstType:
         if (inside_record) {
@@ -322,12 +335,17 @@ unsigned int BinlogReader::ReadPhysicalRecord(uint64_t *size, slash::Slice *resu
     last_record_offset_ = 0;
   }
 
+  if (backing_store_.size() < kBlockSize) {
+    ZPBufferPool::Global()->CheckoutScratch(kBlockSize, &backing_store_);
+  }
+  char* scratch = &backing_store_[0];
+
   buffer_.clear();
   // TODO wk slash may return the actual read bytes
   //uint64_t actual_read = 0;
   //s = queue_->Read(kHeaderSize, &buffer_, backing_store_, &actual_read);
   //*size += actual_read;
-  s = queue_->Read(kHeaderSize, &buffer_, backing_store_);
+  s = queue_->Read(kHeaderSize, &buffer_, scratch);
   if (s.IsEndFile()) {
     return kEof;
   } else if (!s.ok()) {
@@ -346,7 +364,7 @@ unsigned int BinlogReader::ReadPhysicalRecord(uint64_t *size, slash::Slice *resu
   buffer_.clear();
   //s = queue_->Read(length, &buffer_, backing_store_, &actual_read);
   //*size += actual_read;
-  s = queue_->Read(length, &buffer_, backing_store_);
+  s = queue_->Read(length, &buffer_, scratch);
   *result = slash::Slice(buffer_.data(), buffer_.size());
   if (s.IsEndFile()) {
     return kEof;
@@ -0,0 +1,77 @@
+#include "include/zp_buffer_pool.h"
+
+#include "include/zp_const.h"
+
+// Index of the smallest class no less than size
+static size_t ClassCeil(size_t size) {
+  size_t cls = 0;
+  for (size_t s = kBufferPoolMinSize; s < size; s <<= 1) {
+    cls++;
+  }
+  return cls;
+}
+
+static size_t ClassNum() {
+  return ClassCeil(kBufferPoolMaxSize) + 1;
+}
+
+ZPBufferPool* ZPBufferPool::Global() {
+  static ZPBufferPool pool;
+  return &pool;
+}
+
+ZPBufferPool::ZPBufferPool()
+  : free_(ClassNum()) {
+  }
+
+void ZPBufferPool::Checkout(size_t size, std::string* buf) {
+  Take(size, buf);
+  buf->clear();
+}
+
+void ZPBufferPool::CheckoutScratch(size_t size, std::string* buf) {
+  Take(size, buf);
+  // Grow only the new ones, shrink never fill
+  buf->resize(size);
+}
+
+// Swap in a buffer with capacity no less than size, content kept
+void ZPBufferPool::Take(size_t size, std::string* buf) {
+  std::string tmp;
+  if (size <= kBufferPoolMaxSize) {
+    size_t cls = ClassCeil(size);
+    slash::MutexLock l(&mutex_);
+    for (; cls < free_.size(); cls++) {
+      if (!free_[cls].empty()) {
+        tmp.swap(free_[cls].back());
+        free_[cls].pop_back();
+        break;
+      }
+    }
+  }
+  if (tmp.capacity() < size) {
+    tmp.reserve(size <= kBufferPoolMaxSize
+        ? (kBufferPoolMinSize << ClassCeil(size)) : size);
+  }
+  buf->swap(tmp);
+}
+
+void ZPBufferPool::Checkin(std::string* buf) {
+  std::string tmp;
+  tmp.swap(*buf);
+  size_t capacity = tmp.capacity();
+  if (capacity < kBufferPoolMinSize || capacity >= 2 * kBufferPoolMaxSize) {
+    // Free it
+    return;
+  }
+  // The largest class no more than capacity
+  size_t cls = ClassCeil(capacity);
+  if ((kBufferPoolMinSize << cls) > capacity) {
+    cls--;
+  }
+  slash::MutexLock l(&mutex_);
+  if (free_[cls].size() < kBufferPoolMaxFree) {
+    free_[cls].push_back(std::string());
+    free_[cls].back().swap(tmp);
+  }
+}
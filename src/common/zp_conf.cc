@@ -41,13 +41,22 @@ ZpConf::ZpConf() {
   data_thread_num_ = 6;
   sync_recv_thread_num_ = 4;
   sync_send_thread_num_ = 4;
+  bgsave_thread_num_ = 4;
+  multikey_thread_num_ = 4;
+  pipeline_thread_num_ = 8;
   max_background_flushes_ = 24;
   max_background_compactions_ = 24;
   db_write_buffer_size_ = 256 * 1024; // 256M
   db_max_write_buffer_ = 20 * 1024 * 1024; // 20G
+  db_read_cache_size_ = 0; // disabled
   db_target_file_size_base_ = 256 * 1024; // 256M
   db_max_open_files_ = 4096;
   db_block_size_ = 16; // 16K
+  db_sync_speed_ = kDBSyncSpeedLimit;
+  db_sync_parallel_ = 4;
+  db_sync_sst_ = false;
+  bg_io_speed_ = 256;
+  bg_io_latency_target_ = 10000;
   slowlog_slower_than_ = -1;
 }
 
@@ -73,13 +82,22 @@ void ZpConf::Dump() const {
   fprintf (stderr, "    Config.data_thread_num    : %d\n", data_thread_num_);
   fprintf (stderr, "    Config.sync_recv_thread_num   : %d\n", sync_recv_thread_num_);
   fprintf (stderr, "    Config.sync_send_thread_num   : %d\n", sync_send_thread_num_);
+  fprintf (stderr, "    Config.bgsave_thread_num   : %d\n", bgsave_thread_num_);
+  fprintf (stderr, "    Config.multikey_thread_num   : %d\n", multikey_thread_num_);
+  fprintf (stderr, "    Config.pipeline_thread_num   : %d\n", pipeline_thread_num_);
   fprintf (stderr, "    Config.max_background_flushes    : %d\n", max_background_flushes_);
   fprintf (stderr, "    Config.max_background_compactions   : %d\n", max_background_compactions_);
   fprintf (stderr, "    Config.db_write_buffer_size   : %dKB\n", db_write_buffer_size_);
   fprintf (stderr, "    Config.db_max_write_buffer   : %dKB\n", db_max_write_buffer_);
+  fprintf (stderr, "    Config.db_read_cache_size   : %dKB\n", db_read_cache_size_);
   fprintf (stderr, "    Config.db_target_file_size_base   : %dKB\n", db_target_file_size_base_);
   fprintf (stderr, "    Config.db_max_open_files   : %d\n", db_max_open_files_);
   fprintf (stderr, "    Config.db_block_size   : %dKB\n", db_block_size_);
+  fprintf (stderr, "    Config.db_sync_speed   : %dMB\n", db_sync_speed_);
+  fprintf (stderr, "    Config.db_sync_parallel   : %d\n", db_sync_parallel_);
+  fprintf (stderr, "    Config.db_sync_sst   : %s\n", db_sync_sst_? "true":"false");
+  fprintf (stderr, "    Config.bg_io_speed   : %dMB\n", bg_io_speed_);
+  fprintf (stderr, "    Config.bg_io_latency_target   : %dus\n", bg_io_latency_target_);
   fprintf (stderr, "    Config.slowlog_slower_than   : %d\n", slowlog_slower_than_);
 }
 
@@ -102,13 +120,22 @@ int ZpConf::Load(const std::string& path) {
   READCONF(conf_reader, data_thread_num, data_thread_num_, INT);
   READCONF(conf_reader, sync_recv_thread_num, sync_recv_thread_num_, INT);
   READCONF(conf_reader, sync_send_thread_num, sync_send_thread_num_, INT);
+  READCONF(conf_reader, bgsave_thread_num, bgsave_thread_num_, INT);
+  READCONF(conf_reader, multikey_thread_num, multikey_thread_num_, INT);
+  READCONF(conf_reader, pipeline_thread_num, pipeline_thread_num_, INT);
   READCONF(conf_reader, max_background_flushes, max_background_flushes_, INT);
   READCONF(conf_reader, max_background_compactions, max_background_compactions_, INT);
   READCONF(conf_reader, db_write_buffer_size, db_write_buffer_size_, INT);
   READCONF(conf_reader, db_max_write_buffer, db_max_write_buffer_, INT);
+  READCONF(conf_reader, db_read_cache_size, db_read_cache_size_, INT);
   READCONF(conf_reader, db_target_file_size_base, db_target_file_size_base_, INT);
   READCONF(conf_reader, db_max_open_files, db_max_open_files_, INT);
   READCONF(conf_reader, db_block_size, db_block_size_, INT);
+  READCONF(conf_reader, db_sync_speed, db_sync_speed_, INT);
+  READCONF(conf_reader, db_sync_parallel, db_sync_parallel_, INT);
+  READCONF(conf_reader, db_sync_sst, db_sync_sst_, BOOL);
+  READCONF(conf_reader, bg_io_speed, bg_io_speed_, INT);
+  READCONF(conf_reader, bg_io_latency_target, bg_io_latency_target_, INT);
   READCONF(conf_reader, slowlog_slower_than, slowlog_slower_than_, INT);
   if (data_path_.back() != '/') {
     data_path_.append("/");
@@ -125,12 +152,20 @@ int ZpConf::Load(const std::string& path) {
   data_thread_num_ = BoundaryLimit(data_thread_num_, 1, 100);
   sync_recv_thread_num_ = BoundaryLimit(sync_recv_thread_num_, 1, 100);
   sync_send_thread_num_ = BoundaryLimit(sync_send_thread_num_, 1, 100);
+  bgsave_thread_num_ = BoundaryLimit(bgsave_thread_num_, 1, 100);
+  multikey_thread_num_ = BoundaryLimit(multikey_thread_num_, 1, 100);
+  pipeline_thread_num_ = BoundaryLimit(pipeline_thread_num_, 1, 100);
   max_background_flushes_ = BoundaryLimit(max_background_flushes_, 10, 100);
   max_background_compactions_ = BoundaryLimit(max_background_compactions_, 10, 100);
   slowlog_slower_than_ = BoundaryLimit(slowlog_slower_than_, -1, 10000000);
   db_write_buffer_size_ = BoundaryLimit(db_write_buffer_size_, 4 * 1024, 10 * 1024 * 1024); // 4M ~ 10G
   db_max_write_buffer_ = BoundaryLimit(db_max_write_buffer_, 1024 * 1024, 500 * 1024 * 1024); // 1G ~ 500G
+  db_read_cache_size_ = BoundaryLimit(db_read_cache_size_, 0, 10 * 1024 * 1024); // 0 ~ 10G
   db_target_file_size_base_ = BoundaryLimit(db_target_file_size_base_, 4 * 1024, 10 * 1024 * 1024); // 4M ~ 10G
   db_block_size_ = BoundaryLimit(db_block_size_, 4, 1024 * 1024); // 14K ~ 1G
+  db_sync_speed_ = BoundaryLimit(db_sync_speed_, 1, 10 * 1024); // 1M ~ 10G
+  db_sync_parallel_ = BoundaryLimit(db_sync_parallel_, 1, 64);
+  bg_io_speed_ = BoundaryLimit(bg_io_speed_, 1, 10 * 1024); // 1M ~ 10G
+  bg_io_latency_target_ = BoundaryLimit(bg_io_latency_target_, 100, 10000000);
   return res;
 }
@@ -93,12 +93,14 @@ void InitCmd::Do(const google::protobuf::Message *req, google::protobuf::Message
     return;
   }
 
-  Status s = g_meta_server->Distribute(table, request->init().num());
+  Status s = g_meta_server->Distribute(table, request->init().num(),
+      request->init().replica_num(), request->init().learner_num());
 
   if (s.ok()) {
     response->set_code(ZPMeta::StatusCode::OK);
     response->set_msg("Init OK!");
-    DLOG(INFO) << "Init, table: " << table << " partition num: " << request->init().num();
+    DLOG(INFO) << "Init, table: " << table << " partition num: " << request->init().num()
+      << " replica num: " << request->init().replica_num() << " learner num: " << request->init().learner_num();
   } else {
     response->set_code(ZPMeta::StatusCode::ERROR);
     response->set_msg(s.ToString());
@@ -168,6 +170,30 @@ void RemoveSlaveCmd::Do(const google::protobuf::Message *req, google::protobuf::
   }
 }
 
+void SetChainCmd::Do(const google::protobuf::Message *req, google::protobuf::Message *res, void* partition) const {
+  const ZPMeta::MetaCmd* request = static_cast<const ZPMeta::MetaCmd*>(req);
+  std::string name = request->set_chain().name();
+  std::string table = slash::StringToLower(name);
+  int p = request->set_chain().partition();
+  std::vector<ZPMeta::Node> order;
+  for (int i = 0; i < request->set_chain().order_size(); i++) {
+    order.push_back(request->set_chain().order(i));
+  }
+  ZPMeta::MetaCmdResponse* response = static_cast<ZPMeta::MetaCmdResponse*>(res);
+
+  response->set_type(ZPMeta::Type::SETCHAIN);
+
+  Status s = g_meta_server->SetChain(table, p, request->set_chain().enable(), order);
+
+  if (s.ok()) {
+    response->set_code(ZPMeta::StatusCode::OK);
+    response->set_msg("SetChain OK!");
+  } else {
+    response->set_code(ZPMeta::StatusCode::ERROR);
+    response->set_msg(s.ToString());
+  }
+}
+
 void ListTableCmd::Do(const google::protobuf::Message *req, google::protobuf::Message *res, void* partition) const {
   ZPMeta::MetaCmdResponse* response = static_cast<ZPMeta::MetaCmdResponse*>(res);
   ZPMeta::MetaCmdResponse_ListTable *table_name = response->mutable_list_table();
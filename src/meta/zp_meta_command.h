@@ -63,6 +63,16 @@ class RemoveSlaveCmd : public Cmd {
       google::protobuf::Message *res, void* partition = NULL) const;
 };
 
+class SetChainCmd : public Cmd {
+ public:
+  SetChainCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "SetChain"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition = NULL) const;
+};
+
 class ListTableCmd : public Cmd {
  public:
   ListTableCmd(int flag) : Cmd(flag) {}
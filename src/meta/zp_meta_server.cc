@@ -361,6 +361,12 @@ Status ZPMetaServer::RemoveSlave(const std::string &table, int partition, const
       break;
     }
   }
+  for (i = 0; i < p.learners_size(); i++) {
+    if (p.learners(i).ip() == node.ip() && p.learners(i).port() == node.port()) {
+      valid = true;
+      break;
+    }
+  }
 
   if (valid) {
     UpdateTask task = {ZPMetaUpdateOP::kOpRemoveSlave, ip_port, table, partition};
@@ -466,6 +472,11 @@ Status ZPMetaServer::AddSlave(const std::string &table, int partition, const ZPM
   if (i == p.slaves_size()) {
     valid = true;
   }
+  for (i = 0; i < p.learners_size(); i++) {
+    if (p.learners(i).ip() == node.ip() && p.learners(i).port() == node.port()) {
+      return Status::Corruption("AddSlave: Already learner");
+    }
+  }
 
   if (valid) {
     UpdateTask task = {ZPMetaUpdateOP::kOpAddSlave, ip_port, table, partition};
@@ -478,6 +489,57 @@ Status ZPMetaServer::AddSlave(const std::string &table, int partition, const ZPM
 
 }
 
+Status ZPMetaServer::SetChain(const std::string &table, int partition, bool enable, const std::vector<ZPMeta::Node> &order) {
+  LOG(INFO) << "SetChain " << table << " " << partition << " " << (enable ? "on" : "off");
+
+  ZPMeta::Table table_info;
+  Status s = GetTableInfo(table, &table_info);
+  if (!s.ok()) {
+    return s;
+  }
+
+  if (partition < 0 || partition >= table_info.partitions_size()) {
+    return Status::Corruption("invalid partition");
+  }
+
+  ZPMeta::Partitions p = table_info.partitions(partition);
+  if (p.master().ip() == "" && p.master().port() == 0) {
+    return Status::Corruption("partition has no master");
+  }
+
+  std::vector<std::string> chain;
+  if (enable) {
+    std::set<std::string> slaves;
+    for (int i = 0; i < p.slaves_size(); i++) {
+      slaves.insert(slash::IpPortString(p.slaves(i).ip(), p.slaves(i).port()));
+    }
+    if (order.empty()) {
+      for (int i = 0; i < p.slaves_size(); i++) {
+        chain.push_back(slash::IpPortString(p.slaves(i).ip(), p.slaves(i).port()));
+      }
+    } else {
+      for (auto iter = order.begin(); iter != order.end(); iter++) {
+        chain.push_back(slash::IpPortString(iter->ip(), iter->port()));
+      }
+      // The order should contain every slave exactly once
+      std::set<std::string> ordered(chain.begin(), chain.end());
+      if (ordered != slaves || ordered.size() != chain.size()) {
+        return Status::Corruption("order & slaves Dismatch");
+      }
+    }
+    if (chain.empty()) {
+      return Status::Corruption("partition has no slave");
+    }
+  }
+
+  UpdateTask task = {ZPMetaUpdateOP::kOpSetChain,
+    slash::IpPortString(p.master().ip(), p.master().port()), table, partition};
+  task.chain = chain;
+  LOG(INFO) << "SetChain PushTask" << task.op << " " << table << " " << partition;
+  AddMetaUpdateTask(task);
+  return Status::OK();
+}
+
 Status ZPMetaServer::GetAllMetaNodes(ZPMeta::MetaCmdResponse_ListMeta *nodes) {
   std::string value;
   ZPMeta::Nodes allnodes;
@@ -548,7 +610,12 @@ Status ZPMetaServer::GetAllNodes(ZPMeta::MetaCmdResponse_ListNode *nodes) {
   return s;
 }
 
-Status ZPMetaServer::Distribute(const std::string &name, int num) {
+Status ZPMetaServer::Distribute(const std::string &name, int num, int replica_num, int learner_num) {
+  if (replica_num < 1 || learner_num < 0
+      || replica_num + learner_num > kMaxReplicaNum) {
+    return Status::Corruption("invalid replica num or learner num");
+  }
+
   slash::MutexLock l(&node_mutex_);
   std::string value;
   Status s;
@@ -571,7 +638,7 @@ Status ZPMetaServer::Distribute(const std::string &name, int num) {
 
   std::vector<ZPMeta::NodeStatus> t_alive_nodes;
   GetAllAliveNode(nodes, &t_alive_nodes);
-  if (t_alive_nodes.size() < 3) {
+  if (t_alive_nodes.size() < static_cast<size_t>(replica_num + learner_num)) {
     return Status::Corruption("have no enough alive nodes to create replicats");
   }
 
@@ -594,11 +661,15 @@ Status ZPMetaServer::Distribute(const std::string &name, int num) {
     p->set_state(ZPMeta::PState::ACTIVE);
     p->mutable_master()->CopyFrom(alive_nodes[(i + rand_pos) % an_num].node());
 
-    ZPMeta::Node *slave = p->add_slaves();
-    slave->CopyFrom(alive_nodes[(i + rand_pos + 1) % an_num].node());
-
-    slave = p->add_slaves();
-    slave->CopyFrom(alive_nodes[(i + rand_pos + 2) % an_num].node());
+    int k = 1;
+    for (; k < replica_num; k++) {
+      ZPMeta::Node *slave = p->add_slaves();
+      slave->CopyFrom(alive_nodes[(i + rand_pos + k) % an_num].node());
+    }
+    for (; k < replica_num + learner_num; k++) {
+      ZPMeta::Node *learner = p->add_learners();
+      learner->CopyFrom(alive_nodes[(i + rand_pos + k) % an_num].node());
+    }
   }
 
   s = SetTable(table);
@@ -623,7 +694,7 @@ Status ZPMetaServer::Distribute(const std::string &name, int num) {
   }
 
   std::string ip_port;
-  int pnum = 3+num-1;
+  int pnum = replica_num+learner_num+num-1;
   for (int i = 0; pnum && i < an_num; i++) {
     ip_port = slash::IpPortString(alive_nodes[(i + rand_pos) % an_num].node().ip(),
         alive_nodes[(i + rand_pos) % an_num].node().port());
@@ -855,6 +926,10 @@ void ZPMetaServer::InitClientCmdTable() {
   Cmd* removeslaveptr = new RemoveSlaveCmd(kCmdFlagsWrite);
   cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(ZPMeta::Type::REMOVESLAVE), removeslaveptr));
 
+  //SetChain Command
+  Cmd* setchainptr = new SetChainCmd(kCmdFlagsWrite);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(ZPMeta::Type::SETCHAIN), setchainptr));
+
   //ListTable Command
   Cmd* listtableptr = new ListTableCmd(kCmdFlagsRead);
   cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(ZPMeta::Type::LISTTABLE), listtableptr));
@@ -899,6 +974,9 @@ bool ZPMetaServer::ProcessUpdateTableInfo(const ZPMetaUpdateTaskDeque task_deque
       DoAddSlaveForTableInfo(table_info, iter->partition, ip, port, &should_update_table_info);
     } else if (iter->op == ZPMetaUpdateOP::kOpRemoveSlave) {
       DoRemoveSlaveForTableInfo(table_info, iter->partition, ip, port, &should_update_table_info);
+    } else if (iter->op == ZPMetaUpdateOP::kOpSetChain
+        && iter->table == table_info->name()) {
+      DoSetChainForTableInfo(table_info, iter->partition, iter->chain, &should_update_table_info);
     }
   }
 
@@ -936,6 +1014,20 @@ void ZPMetaServer::DoDownNodeForTableInfo(const ZPMeta::Nodes &nodes, ZPMeta::Ta
   for (int i = 0; i < table_info->partitions_size(); ++i) {
     ZPMeta::Partitions* p = table_info->mutable_partitions(i);
     if (ip != p->master().ip() || port != p->master().port()) {
+      if (p->chain()) {
+        // Down slave in chain move to the tail, so that the ones after it
+        // are fed by the one before it
+        int slaves_size = p->slaves_size();
+        for (int j = 0; j < slaves_size - 1; j++) {
+          if (p->slaves(j).ip() == ip && p->slaves(j).port() == port) {
+            *should_update_table_info = true;
+            for (int k = j; k < slaves_size - 1; k++) {
+              p->mutable_slaves()->SwapElements(k, k + 1);
+            }
+            break;
+          }
+        }
+      }
       continue;
     }
 
@@ -965,8 +1057,12 @@ void ZPMetaServer::DoDownNodeForTableInfo(const ZPMeta::Nodes &nodes, ZPMeta::Ta
     if (candidate != -1) {
       LOG(INFO) << "Use Slave " << candidate << " " << p->slaves(candidate).ip() << " " << p->slaves(candidate).port();
       master->CopyFrom(p->slaves(candidate));
-      ZPMeta::Node* first = p->mutable_slaves(candidate);
-      first->CopyFrom(tmp);
+      // Old master go to the tail, keep the order of others,
+      // which is the order of chain
+      for (int k = candidate; k < slaves_size - 1; k++) {
+        p->mutable_slaves()->SwapElements(k, k + 1);
+      }
+      p->mutable_slaves(slaves_size - 1)->CopyFrom(tmp);
     } else {
       LOG(INFO) << "No Slave to use";
       ZPMeta::Node *slave = p->add_slaves();
@@ -992,13 +1088,25 @@ void ZPMetaServer::DoRemoveSlaveForTableInfo(ZPMeta::Table *table_info, int part
     return;
   }
 
+  // Keep the order of others, which is the order of chain
   int slaves_size = p->slaves_size();
   for (int j = 0; j < slaves_size; j++) {
     if (p->slaves(j).ip() == ip && p->slaves(j).port() == port) {
       *should_update_table_info = true;
-      ZPMeta::Node* slave = p->mutable_slaves(j);
-      slave->CopyFrom(p->slaves(slaves_size-1));
+      for (int k = j; k < slaves_size - 1; k++) {
+        p->mutable_slaves()->SwapElements(k, k + 1);
+      }
       p->mutable_slaves()->RemoveLast();
+      break;
+    }
+  }
+  int learners_size = p->learners_size();
+  for (int j = 0; j < learners_size; j++) {
+    if (p->learners(j).ip() == ip && p->learners(j).port() == port) {
+      *should_update_table_info = true;
+      p->mutable_learners()->SwapElements(j, learners_size - 1);
+      p->mutable_learners()->RemoveLast();
+      break;
     }
   }
 
@@ -1016,6 +1124,12 @@ void ZPMetaServer::DoRemoveSlaveForTableInfo(ZPMeta::Table *table_info, int part
         break;
       }
     }
+    for (int j = 0; j < part.learners_size(); j++) {
+      if (part.learners(j).ip() == ip && part.learners(j).port() == port) {
+        should_update_nodes = false;
+        break;
+      }
+    }
     if (!should_update_nodes) {
       break;
     }
@@ -1111,6 +1225,39 @@ void ZPMetaServer::DoAddSlaveForTableInfo(ZPMeta::Table *table_info, int partiti
   DebugNodes();
 }
 
+void ZPMetaServer::DoSetChainForTableInfo(ZPMeta::Table *table_info, int partition, const std::vector<std::string> &chain, bool *should_update_table_info) {
+
+  if (partition < 0 || partition >= table_info->partitions_size()) {
+    LOG(ERROR) << "invalid partition num in DoSetChainForTableInfo for " << table_info->name() << " : " << partition;
+    return;
+  }
+
+  ZPMeta::Partitions* p = table_info->mutable_partitions(partition);
+  if (chain.empty()) {
+    if (p->chain()) {
+      *should_update_table_info = true;
+      p->set_chain(false);
+    }
+    return;
+  }
+
+  // Reorder slaves as the chain, those not in chain any more keep behind
+  int pos = 0;
+  for (auto iter = chain.begin(); iter != chain.end(); iter++) {
+    for (int j = pos; j < p->slaves_size(); j++) {
+      if (slash::IpPortString(p->slaves(j).ip(), p->slaves(j).port()) == *iter) {
+        if (j != pos) {
+          p->mutable_slaves()->SwapElements(j, pos);
+        }
+        pos++;
+        break;
+      }
+    }
+  }
+  p->set_chain(true);
+  *should_update_table_info = true;
+}
+
 void ZPMetaServer::DoUpNodeForTableInfo(ZPMeta::Table *table_info, const std::string ip, int port, bool *should_update_table_info) {
   int slaves_size = 0;
   for (int i = 0; i < table_info->partitions_size(); ++i) {
@@ -1524,6 +1671,18 @@ Status ZPMetaServer::InitVersion() {
               nodes_.insert(std::unordered_map<std::string, std::set<std::string> >::value_type(ip_port, ts));
             }
           }
+
+          for (int k = 0; k < partition.learners_size(); k++) {
+            ip_port = slash::IpPortString(partition.learners(k).ip(), partition.learners(k).port());
+            auto iter = nodes_.find(ip_port);
+            if (iter != nodes_.end()) {
+              iter->second.insert(tables.name(i));
+            } else {
+              std::set<std::string> ts;
+              ts.insert(tables.name(i));
+              nodes_.insert(std::unordered_map<std::string, std::set<std::string> >::value_type(ip_port, ts));
+            }
+          }
         }
       }
       DebugNodes();
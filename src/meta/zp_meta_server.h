@@ -90,11 +90,12 @@ class ZPMetaServer {
   Status RemoveSlave(const std::string &table, int partition, const ZPMeta::Node &node);
   Status SetMaster(const std::string &table, int partition, const ZPMeta::Node &node);
   Status AddSlave(const std::string &table, int partition, const ZPMeta::Node &node);
+  Status SetChain(const std::string &table, int partition, bool enable, const std::vector<ZPMeta::Node> &order);
   Status GetAllMetaNodes(ZPMeta::MetaCmdResponse_ListMeta *nodes);
   Status GetMetaStatus(std::string *result);
   Status GetTableList(ZPMeta::MetaCmdResponse_ListTable *tables);
   Status GetAllNodes(ZPMeta::MetaCmdResponse_ListNode *nodes);
-  Status Distribute(const std::string &table, int num);
+  Status Distribute(const std::string &table, int num, int replica_num, int learner_num);
   void UpdateOffset(const ZPMeta::MetaCmd_Ping &ping);
   Status DropTable(const std::string &table);
   Status InitVersionIfNeeded();
@@ -141,6 +142,7 @@ private:
   void DoRemoveSlaveForTableInfo(ZPMeta::Table *table_info, int partition, const std::string &ip, int port, bool *should_update_table_info);
   void DoSetMasterForTableInfo(ZPMeta::Table *table_info, int partition, const std::string &ip, int port, bool *should_update_table_info);
   void DoAddSlaveForTableInfo(ZPMeta::Table *table_info, int partition, const std::string &ip, int port, bool *should_update_table_info);
+  void DoSetChainForTableInfo(ZPMeta::Table *table_info, int partition, const std::vector<std::string> &chain, bool *should_update_table_info);
 
   void DoUpNodeForTableInfo(ZPMeta::Table *table_info, const std::string ip, int port, bool *should_update_table_info);
   void DoClearStuckForTableInfo(ZPMeta::Table *table_info, int partition, bool *should_update_table_info);
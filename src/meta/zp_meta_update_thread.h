@@ -2,6 +2,7 @@
 #define ZP_META_UPDATE_THREAD_H
 
 #include <string>
+#include <vector>
 #include <unordered_map>
 #include <glog/logging.h>
 
@@ -20,7 +21,8 @@ enum ZPMetaUpdateOP : unsigned int {
   kOpSetMaster,
   kOpClearStuck,
   kOpAddSlave,
-  kOpRemoveSlave
+  kOpRemoveSlave,
+  kOpSetChain
 };
 
 struct UpdateTask {
@@ -28,6 +30,7 @@ struct UpdateTask {
   std::string ip_port;
   std::string table;
   int partition;
+  std::vector<std::string> chain;  // for kOpSetChain, empty to turn off
 };
 
 typedef std::deque<UpdateTask> ZPMetaUpdateTaskDeque;
@@ -1,703 +1,1452 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: client.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
-#include "include/client.pb.h"
+#include "client.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace client {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Node_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Node_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SyncOffset_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SyncOffset_reflection_ = NULL;
-const ::google::protobuf::Descriptor* KeyExpire_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  KeyExpire_reflection_ = NULL;
-const ::google::protobuf::Descriptor* PartitionState_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PartitionState_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Sync_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Sync_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Set_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Set_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Get_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Get_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Del_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Del_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Info_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Info_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Mget_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Mget_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_Sync_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_Sync_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_Get_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_Get_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_InfoStats_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_InfoStats_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_InfoCapacity_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_InfoCapacity_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_InfoRepl_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_InfoRepl_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_Mget_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_Mget_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_InfoServer_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_InfoServer_reflection_ = NULL;
-const ::google::protobuf::Descriptor* BinlogSkip_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  BinlogSkip_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SyncRequest_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SyncRequest_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Type_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* SyncType_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_client_2eproto() {
-  protobuf_AddDesc_client_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "client.proto");
-  GOOGLE_CHECK(file != NULL);
-  Node_descriptor_ = file->message_type(0);
-  static const int Node_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, port_),
+namespace client {
+PROTOBUF_CONSTEXPR Node::Node(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.port_)*/0} {}
+struct NodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeDefaultTypeInternal() {}
+  union {
+    Node _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeDefaultTypeInternal _Node_default_instance_;
+PROTOBUF_CONSTEXPR SyncOffset::SyncOffset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.offset_)*/int64_t{0}
+  , /*decltype(_impl_.filenum_)*/0
+  , /*decltype(_impl_.partition_)*/0} {}
+struct SyncOffsetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncOffsetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncOffsetDefaultTypeInternal() {}
+  union {
+    SyncOffset _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncOffsetDefaultTypeInternal _SyncOffset_default_instance_;
+PROTOBUF_CONSTEXPR ReplTerm::ReplTerm(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.repl_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.begin_)*/nullptr} {}
+struct ReplTermDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplTermDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplTermDefaultTypeInternal() {}
+  union {
+    ReplTerm _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplTermDefaultTypeInternal _ReplTerm_default_instance_;
+PROTOBUF_CONSTEXPR ReadStaleness::ReadStaleness(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.max_ms_)*/int64_t{0}
+  , /*decltype(_impl_.max_bytes_)*/int64_t{0}} {}
+struct ReadStalenessDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadStalenessDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadStalenessDefaultTypeInternal() {}
+  union {
+    ReadStaleness _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadStalenessDefaultTypeInternal _ReadStaleness_default_instance_;
+PROTOBUF_CONSTEXPR KeyExpire::KeyExpire(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.base_)*/0
+  , /*decltype(_impl_.ttl_)*/0} {}
+struct KeyExpireDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyExpireDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyExpireDefaultTypeInternal() {}
+  union {
+    KeyExpire _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyExpireDefaultTypeInternal _KeyExpire_default_instance_;
+PROTOBUF_CONSTEXPR PartitionState_SlaveLag::PartitionState_SlaveLag(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.node_)*/nullptr
+  , /*decltype(_impl_.lag_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.send_bytes_per_sec_)*/int64_t{0}
+  , /*decltype(_impl_.since_last_send_ms_)*/int64_t{0}
+  , /*decltype(_impl_.unacked_records_)*/0} {}
+struct PartitionState_SlaveLagDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PartitionState_SlaveLagDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PartitionState_SlaveLagDefaultTypeInternal() {}
+  union {
+    PartitionState_SlaveLag _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PartitionState_SlaveLagDefaultTypeInternal _PartitionState_SlaveLag_default_instance_;
+PROTOBUF_CONSTEXPR PartitionState::PartitionState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.slaves_)*/{}
+  , /*decltype(_impl_.slave_lags_)*/{}
+  , /*decltype(_impl_.role_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.repl_state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.master_)*/nullptr
+  , /*decltype(_impl_.sync_offset_)*/nullptr
+  , /*decltype(_impl_.apply_lag_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.apply_lag_ms_)*/int64_t{0}
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct PartitionStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PartitionStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PartitionStateDefaultTypeInternal() {}
+  union {
+    PartitionState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PartitionStateDefaultTypeInternal _PartitionState_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Sync::CmdRequest_Sync(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.repl_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_)*/nullptr
+  , /*decltype(_impl_.sync_offset_)*/nullptr} {}
+struct CmdRequest_SyncDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_SyncDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_SyncDefaultTypeInternal() {}
+  union {
+    CmdRequest_Sync _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_SyncDefaultTypeInternal _CmdRequest_Sync_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Set::CmdRequest_Set(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.expire_)*/nullptr} {}
+struct CmdRequest_SetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_SetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_SetDefaultTypeInternal() {}
+  union {
+    CmdRequest_Set _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_SetDefaultTypeInternal _CmdRequest_Set_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Get::CmdRequest_Get(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.staleness_)*/nullptr} {}
+struct CmdRequest_GetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_GetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_GetDefaultTypeInternal() {}
+  union {
+    CmdRequest_Get _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_GetDefaultTypeInternal _CmdRequest_Get_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Del::CmdRequest_Del(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdRequest_DelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_DelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_DelDefaultTypeInternal() {}
+  union {
+    CmdRequest_Del _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_DelDefaultTypeInternal _CmdRequest_Del_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Info::CmdRequest_Info(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdRequest_InfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_InfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_InfoDefaultTypeInternal() {}
+  union {
+    CmdRequest_Info _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_InfoDefaultTypeInternal _CmdRequest_Info_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Mget::CmdRequest_Mget(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.staleness_)*/nullptr
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct CmdRequest_MgetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_MgetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_MgetDefaultTypeInternal() {}
+  union {
+    CmdRequest_Mget _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_MgetDefaultTypeInternal _CmdRequest_Mget_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Msync::CmdRequest_Msync(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.syncs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CmdRequest_MsyncDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_MsyncDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_MsyncDefaultTypeInternal() {}
+  union {
+    CmdRequest_Msync _instance;
   };
-  Node_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Node_descriptor_,
-      Node::default_instance_,
-      Node_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Node));
-  SyncOffset_descriptor_ = file->message_type(1);
-  static const int SyncOffset_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, filenum_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, offset_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, partition_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_MsyncDefaultTypeInternal _CmdRequest_Msync_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Subscribe::CmdRequest_Subscribe(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cursors_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_records_)*/1000} {}
+struct CmdRequest_SubscribeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_SubscribeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_SubscribeDefaultTypeInternal() {}
+  union {
+    CmdRequest_Subscribe _instance;
   };
-  SyncOffset_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SyncOffset_descriptor_,
-      SyncOffset::default_instance_,
-      SyncOffset_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SyncOffset));
-  KeyExpire_descriptor_ = file->message_type(2);
-  static const int KeyExpire_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeyExpire, base_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeyExpire, ttl_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_SubscribeDefaultTypeInternal _CmdRequest_Subscribe_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Mset_Kv::CmdRequest_Mset_Kv(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdRequest_Mset_KvDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_Mset_KvDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_Mset_KvDefaultTypeInternal() {}
+  union {
+    CmdRequest_Mset_Kv _instance;
   };
-  KeyExpire_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      KeyExpire_descriptor_,
-      KeyExpire::default_instance_,
-      KeyExpire_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeyExpire, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeyExpire, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(KeyExpire));
-  PartitionState_descriptor_ = file->message_type(3);
-  static const int PartitionState_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, partition_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, role_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, repl_state_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, master_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, slaves_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, sync_offset_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_Mset_KvDefaultTypeInternal _CmdRequest_Mset_Kv_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Mset::CmdRequest_Mset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.kvs_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct CmdRequest_MsetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_MsetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_MsetDefaultTypeInternal() {}
+  union {
+    CmdRequest_Mset _instance;
   };
-  PartitionState_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PartitionState_descriptor_,
-      PartitionState::default_instance_,
-      PartitionState_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PartitionState, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PartitionState));
-  CmdRequest_descriptor_ = file->message_type(4);
-  static const int CmdRequest_offsets_[7] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, sync_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, set_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, get_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, del_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, info_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, mget_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_MsetDefaultTypeInternal _CmdRequest_Mset_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Mdel::CmdRequest_Mdel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct CmdRequest_MdelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_MdelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_MdelDefaultTypeInternal() {}
+  union {
+    CmdRequest_Mdel _instance;
   };
-  CmdRequest_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_descriptor_,
-      CmdRequest::default_instance_,
-      CmdRequest_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest));
-  CmdRequest_Sync_descriptor_ = CmdRequest_descriptor_->nested_type(0);
-  static const int CmdRequest_Sync_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Sync, node_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Sync, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Sync, sync_offset_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_MdelDefaultTypeInternal _CmdRequest_Mdel_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Incrby::CmdRequest_Incrby(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.by_)*/int64_t{0}} {}
+struct CmdRequest_IncrbyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_IncrbyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_IncrbyDefaultTypeInternal() {}
+  union {
+    CmdRequest_Incrby _instance;
   };
-  CmdRequest_Sync_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Sync_descriptor_,
-      CmdRequest_Sync::default_instance_,
-      CmdRequest_Sync_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Sync, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Sync, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Sync));
-  CmdRequest_Set_descriptor_ = CmdRequest_descriptor_->nested_type(1);
-  static const int CmdRequest_Set_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, value_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, uuid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, expire_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_IncrbyDefaultTypeInternal _CmdRequest_Incrby_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Append::CmdRequest_Append(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdRequest_AppendDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_AppendDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_AppendDefaultTypeInternal() {}
+  union {
+    CmdRequest_Append _instance;
   };
-  CmdRequest_Set_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Set_descriptor_,
-      CmdRequest_Set::default_instance_,
-      CmdRequest_Set_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Set));
-  CmdRequest_Get_descriptor_ = CmdRequest_descriptor_->nested_type(2);
-  static const int CmdRequest_Get_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, uuid_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_AppendDefaultTypeInternal _CmdRequest_Append_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest::CmdRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sync_)*/nullptr
+  , /*decltype(_impl_.set_)*/nullptr
+  , /*decltype(_impl_.get_)*/nullptr
+  , /*decltype(_impl_.del_)*/nullptr
+  , /*decltype(_impl_.info_)*/nullptr
+  , /*decltype(_impl_.mget_)*/nullptr
+  , /*decltype(_impl_.msync_)*/nullptr
+  , /*decltype(_impl_.subscribe_)*/nullptr
+  , /*decltype(_impl_.mset_)*/nullptr
+  , /*decltype(_impl_.mdel_)*/nullptr
+  , /*decltype(_impl_.incrby_)*/nullptr
+  , /*decltype(_impl_.append_)*/nullptr
+  , /*decltype(_impl_.write_us_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/0} {}
+struct CmdRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequestDefaultTypeInternal() {}
+  union {
+    CmdRequest _instance;
   };
-  CmdRequest_Get_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Get_descriptor_,
-      CmdRequest_Get::default_instance_,
-      CmdRequest_Get_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Get));
-  CmdRequest_Del_descriptor_ = CmdRequest_descriptor_->nested_type(3);
-  static const int CmdRequest_Del_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Del, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Del, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Del, uuid_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequestDefaultTypeInternal _CmdRequest_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Sync::CmdResponse_Sync(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.repl_history_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sync_offset_)*/nullptr} {}
+struct CmdResponse_SyncDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_SyncDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_SyncDefaultTypeInternal() {}
+  union {
+    CmdResponse_Sync _instance;
   };
-  CmdRequest_Del_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Del_descriptor_,
-      CmdRequest_Del::default_instance_,
-      CmdRequest_Del_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Del, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Del, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Del));
-  CmdRequest_Info_descriptor_ = CmdRequest_descriptor_->nested_type(4);
-  static const int CmdRequest_Info_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Info, table_name_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_SyncDefaultTypeInternal _CmdResponse_Sync_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Get::CmdResponse_Get(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdResponse_GetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_GetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_GetDefaultTypeInternal() {}
+  union {
+    CmdResponse_Get _instance;
   };
-  CmdRequest_Info_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Info_descriptor_,
-      CmdRequest_Info::default_instance_,
-      CmdRequest_Info_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Info, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Info, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Info));
-  CmdRequest_Mget_descriptor_ = CmdRequest_descriptor_->nested_type(5);
-  static const int CmdRequest_Mget_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mget, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mget, keys_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_GetDefaultTypeInternal _CmdResponse_Get_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_InfoStats::CmdResponse_InfoStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.total_querys_)*/int64_t{0}
+  , /*decltype(_impl_.qps_)*/0} {}
+struct CmdResponse_InfoStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_InfoStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_InfoStatsDefaultTypeInternal() {}
+  union {
+    CmdResponse_InfoStats _instance;
   };
-  CmdRequest_Mget_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Mget_descriptor_,
-      CmdRequest_Mget::default_instance_,
-      CmdRequest_Mget_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mget, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mget, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Mget));
-  CmdResponse_descriptor_ = file->message_type(5);
-  static const int CmdResponse_offsets_[11] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, code_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, msg_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, sync_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, get_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, redirect_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_stats_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_capacity_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_repl_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, mget_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_server_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_InfoStatsDefaultTypeInternal _CmdResponse_InfoStats_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_InfoCapacity::CmdResponse_InfoCapacity(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.used_)*/int64_t{0}
+  , /*decltype(_impl_.remain_)*/int64_t{0}} {}
+struct CmdResponse_InfoCapacityDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_InfoCapacityDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_InfoCapacityDefaultTypeInternal() {}
+  union {
+    CmdResponse_InfoCapacity _instance;
   };
-  CmdResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_descriptor_,
-      CmdResponse::default_instance_,
-      CmdResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse));
-  CmdResponse_Sync_descriptor_ = CmdResponse_descriptor_->nested_type(0);
-  static const int CmdResponse_Sync_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Sync, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Sync, sync_offset_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_InfoCapacityDefaultTypeInternal _CmdResponse_InfoCapacity_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_InfoRepl::CmdResponse_InfoRepl(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.partition_state_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_cnt_)*/int64_t{0}} {}
+struct CmdResponse_InfoReplDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_InfoReplDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_InfoReplDefaultTypeInternal() {}
+  union {
+    CmdResponse_InfoRepl _instance;
   };
-  CmdResponse_Sync_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_Sync_descriptor_,
-      CmdResponse_Sync::default_instance_,
-      CmdResponse_Sync_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Sync, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Sync, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_Sync));
-  CmdResponse_Get_descriptor_ = CmdResponse_descriptor_->nested_type(1);
-  static const int CmdResponse_Get_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Get, value_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_InfoReplDefaultTypeInternal _CmdResponse_InfoRepl_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Mget::CmdResponse_Mget(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.redirect_)*/nullptr
+  , /*decltype(_impl_.code_)*/0} {}
+struct CmdResponse_MgetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_MgetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_MgetDefaultTypeInternal() {}
+  union {
+    CmdResponse_Mget _instance;
   };
-  CmdResponse_Get_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_Get_descriptor_,
-      CmdResponse_Get::default_instance_,
-      CmdResponse_Get_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Get, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Get, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_Get));
-  CmdResponse_InfoStats_descriptor_ = CmdResponse_descriptor_->nested_type(2);
-  static const int CmdResponse_InfoStats_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoStats, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoStats, total_querys_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoStats, qps_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_MgetDefaultTypeInternal _CmdResponse_Mget_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_InfoServer::CmdResponse_InfoServer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_names_)*/{}
+  , /*decltype(_impl_.cur_meta_)*/nullptr
+  , /*decltype(_impl_.epoch_)*/int64_t{0}
+  , /*decltype(_impl_.meta_renewing_)*/false} {}
+struct CmdResponse_InfoServerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_InfoServerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_InfoServerDefaultTypeInternal() {}
+  union {
+    CmdResponse_InfoServer _instance;
   };
-  CmdResponse_InfoStats_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_InfoStats_descriptor_,
-      CmdResponse_InfoStats::default_instance_,
-      CmdResponse_InfoStats_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoStats, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoStats, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_InfoStats));
-  CmdResponse_InfoCapacity_descriptor_ = CmdResponse_descriptor_->nested_type(3);
-  static const int CmdResponse_InfoCapacity_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoCapacity, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoCapacity, used_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoCapacity, remain_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_InfoServerDefaultTypeInternal _CmdResponse_InfoServer_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Subscribe_Record::CmdResponse_Subscribe_Record(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/nullptr
+  , /*decltype(_impl_.partition_)*/0
+  , /*decltype(_impl_.type_)*/0} {}
+struct CmdResponse_Subscribe_RecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_Subscribe_RecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_Subscribe_RecordDefaultTypeInternal() {}
+  union {
+    CmdResponse_Subscribe_Record _instance;
   };
-  CmdResponse_InfoCapacity_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_InfoCapacity_descriptor_,
-      CmdResponse_InfoCapacity::default_instance_,
-      CmdResponse_InfoCapacity_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoCapacity, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoCapacity, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_InfoCapacity));
-  CmdResponse_InfoRepl_descriptor_ = CmdResponse_descriptor_->nested_type(4);
-  static const int CmdResponse_InfoRepl_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoRepl, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoRepl, partition_cnt_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoRepl, partition_state_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_Subscribe_RecordDefaultTypeInternal _CmdResponse_Subscribe_Record_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Subscribe::CmdResponse_Subscribe(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.records_)*/{}
+  , /*decltype(_impl_.cursors_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CmdResponse_SubscribeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_SubscribeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_SubscribeDefaultTypeInternal() {}
+  union {
+    CmdResponse_Subscribe _instance;
   };
-  CmdResponse_InfoRepl_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_InfoRepl_descriptor_,
-      CmdResponse_InfoRepl::default_instance_,
-      CmdResponse_InfoRepl_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoRepl, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoRepl, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_InfoRepl));
-  CmdResponse_Mget_descriptor_ = CmdResponse_descriptor_->nested_type(5);
-  static const int CmdResponse_Mget_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Mget, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Mget, value_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_SubscribeDefaultTypeInternal _CmdResponse_Subscribe_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_KeyResult::CmdResponse_KeyResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.redirect_)*/nullptr
+  , /*decltype(_impl_.code_)*/0} {}
+struct CmdResponse_KeyResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_KeyResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_KeyResultDefaultTypeInternal() {}
+  union {
+    CmdResponse_KeyResult _instance;
   };
-  CmdResponse_Mget_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_Mget_descriptor_,
-      CmdResponse_Mget::default_instance_,
-      CmdResponse_Mget_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Mget, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Mget, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_Mget));
-  CmdResponse_InfoServer_descriptor_ = CmdResponse_descriptor_->nested_type(6);
-  static const int CmdResponse_InfoServer_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoServer, epoch_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoServer, table_names_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoServer, cur_meta_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoServer, meta_renewing_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_KeyResultDefaultTypeInternal _CmdResponse_KeyResult_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Incrby::CmdResponse_Incrby(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.value_)*/int64_t{0}} {}
+struct CmdResponse_IncrbyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_IncrbyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_IncrbyDefaultTypeInternal() {}
+  union {
+    CmdResponse_Incrby _instance;
   };
-  CmdResponse_InfoServer_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_InfoServer_descriptor_,
-      CmdResponse_InfoServer::default_instance_,
-      CmdResponse_InfoServer_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoServer, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoServer, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_InfoServer));
-  BinlogSkip_descriptor_ = file->message_type(6);
-  static const int BinlogSkip_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogSkip, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogSkip, partition_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogSkip, gap_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_IncrbyDefaultTypeInternal _CmdResponse_Incrby_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Append::CmdResponse_Append(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.length_)*/int64_t{0}} {}
+struct CmdResponse_AppendDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_AppendDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_AppendDefaultTypeInternal() {}
+  union {
+    CmdResponse_Append _instance;
   };
-  BinlogSkip_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      BinlogSkip_descriptor_,
-      BinlogSkip::default_instance_,
-      BinlogSkip_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogSkip, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogSkip, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(BinlogSkip));
-  SyncRequest_descriptor_ = file->message_type(7);
-  static const int SyncRequest_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, sync_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, epoch_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, from_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, sync_offset_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, request_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, binlog_skip_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_AppendDefaultTypeInternal _CmdResponse_Append_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse::CmdResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.info_stats_)*/{}
+  , /*decltype(_impl_.info_capacity_)*/{}
+  , /*decltype(_impl_.info_repl_)*/{}
+  , /*decltype(_impl_.mget_)*/{}
+  , /*decltype(_impl_.msync_)*/{}
+  , /*decltype(_impl_.key_results_)*/{}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sync_)*/nullptr
+  , /*decltype(_impl_.get_)*/nullptr
+  , /*decltype(_impl_.redirect_)*/nullptr
+  , /*decltype(_impl_.info_server_)*/nullptr
+  , /*decltype(_impl_.subscribe_)*/nullptr
+  , /*decltype(_impl_.incrby_)*/nullptr
+  , /*decltype(_impl_.append_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.code_)*/0} {}
+struct CmdResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponseDefaultTypeInternal() {}
+  union {
+    CmdResponse _instance;
   };
-  SyncRequest_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SyncRequest_descriptor_,
-      SyncRequest::default_instance_,
-      SyncRequest_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SyncRequest));
-  Type_descriptor_ = file->enum_type(0);
-  SyncType_descriptor_ = file->enum_type(1);
-  StatusCode_descriptor_ = file->enum_type(2);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_client_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Node_descriptor_, &Node::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SyncOffset_descriptor_, &SyncOffset::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    KeyExpire_descriptor_, &KeyExpire::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PartitionState_descriptor_, &PartitionState::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_descriptor_, &CmdRequest::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Sync_descriptor_, &CmdRequest_Sync::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Set_descriptor_, &CmdRequest_Set::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Get_descriptor_, &CmdRequest_Get::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Del_descriptor_, &CmdRequest_Del::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Info_descriptor_, &CmdRequest_Info::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Mget_descriptor_, &CmdRequest_Mget::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_descriptor_, &CmdResponse::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_Sync_descriptor_, &CmdResponse_Sync::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_Get_descriptor_, &CmdResponse_Get::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_InfoStats_descriptor_, &CmdResponse_InfoStats::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_InfoCapacity_descriptor_, &CmdResponse_InfoCapacity::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_InfoRepl_descriptor_, &CmdResponse_InfoRepl::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_Mget_descriptor_, &CmdResponse_Mget::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_InfoServer_descriptor_, &CmdResponse_InfoServer::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    BinlogSkip_descriptor_, &BinlogSkip::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SyncRequest_descriptor_, &SyncRequest::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_client_2eproto() {
-  delete Node::default_instance_;
-  delete Node_reflection_;
-  delete SyncOffset::default_instance_;
-  delete SyncOffset_reflection_;
-  delete KeyExpire::default_instance_;
-  delete KeyExpire_reflection_;
-  delete PartitionState::default_instance_;
-  delete PartitionState_reflection_;
-  delete CmdRequest::default_instance_;
-  delete CmdRequest_reflection_;
-  delete CmdRequest_Sync::default_instance_;
-  delete CmdRequest_Sync_reflection_;
-  delete CmdRequest_Set::default_instance_;
-  delete CmdRequest_Set_reflection_;
-  delete CmdRequest_Get::default_instance_;
-  delete CmdRequest_Get_reflection_;
-  delete CmdRequest_Del::default_instance_;
-  delete CmdRequest_Del_reflection_;
-  delete CmdRequest_Info::default_instance_;
-  delete CmdRequest_Info_reflection_;
-  delete CmdRequest_Mget::default_instance_;
-  delete CmdRequest_Mget_reflection_;
-  delete CmdResponse::default_instance_;
-  delete CmdResponse_reflection_;
-  delete CmdResponse_Sync::default_instance_;
-  delete CmdResponse_Sync_reflection_;
-  delete CmdResponse_Get::default_instance_;
-  delete CmdResponse_Get_reflection_;
-  delete CmdResponse_InfoStats::default_instance_;
-  delete CmdResponse_InfoStats_reflection_;
-  delete CmdResponse_InfoCapacity::default_instance_;
-  delete CmdResponse_InfoCapacity_reflection_;
-  delete CmdResponse_InfoRepl::default_instance_;
-  delete CmdResponse_InfoRepl_reflection_;
-  delete CmdResponse_Mget::default_instance_;
-  delete CmdResponse_Mget_reflection_;
-  delete CmdResponse_InfoServer::default_instance_;
-  delete CmdResponse_InfoServer_reflection_;
-  delete BinlogSkip::default_instance_;
-  delete BinlogSkip_reflection_;
-  delete SyncRequest::default_instance_;
-  delete SyncRequest_reflection_;
-}
-
-void protobuf_AddDesc_client_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\014client.proto\022\006client\" \n\004Node\022\n\n\002ip\030\001 \002"
-    "(\t\022\014\n\004port\030\002 \002(\005\"@\n\nSyncOffset\022\017\n\007filenu"
-    "m\030\001 \002(\005\022\016\n\006offset\030\002 \002(\003\022\021\n\tpartition\030\003 \001"
-    "(\005\"&\n\tKeyExpire\022\014\n\004base\030\001 \001(\005\022\013\n\003ttl\030\002 \002"
-    "(\005\"\255\001\n\016PartitionState\022\024\n\014partition_id\030\001 "
-    "\002(\005\022\014\n\004role\030\002 \002(\t\022\022\n\nrepl_state\030\003 \002(\t\022\034\n"
-    "\006master\030\004 \002(\0132\014.client.Node\022\034\n\006slaves\030\005 "
-    "\003(\0132\014.client.Node\022\'\n\013sync_offset\030\006 \002(\0132\022"
-    ".client.SyncOffset\"\207\005\n\nCmdRequest\022\032\n\004typ"
-    "e\030\001 \002(\0162\014.client.Type\022%\n\004sync\030\002 \001(\0132\027.cl"
-    "ient.CmdRequest.Sync\022#\n\003set\030\003 \001(\0132\026.clie"
-    "nt.CmdRequest.Set\022#\n\003get\030\004 \001(\0132\026.client."
-    "CmdRequest.Get\022#\n\003del\030\005 \001(\0132\026.client.Cmd"
-    "Request.Del\022%\n\004info\030\006 \001(\0132\027.client.CmdRe"
-    "quest.Info\022%\n\004mget\030\007 \001(\0132\027.client.CmdReq"
-    "uest.Mget\032_\n\004Sync\022\032\n\004node\030\001 \002(\0132\014.client"
-    ".Node\022\022\n\ntable_name\030\002 \002(\t\022\'\n\013sync_offset"
-    "\030\003 \002(\0132\022.client.SyncOffset\032f\n\003Set\022\022\n\ntab"
-    "le_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\r\n\005value\030\003 \002("
-    "\014\022\014\n\004uuid\030\004 \001(\t\022!\n\006expire\030\005 \001(\0132\021.client"
-    ".KeyExpire\0324\n\003Get\022\022\n\ntable_name\030\001 \002(\t\022\013\n"
-    "\003key\030\002 \002(\t\022\014\n\004uuid\030\003 \001(\t\0324\n\003Del\022\022\n\ntable"
-    "_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\014\n\004uuid\030\003 \001(\t\032\032"
-    "\n\004Info\022\022\n\ntable_name\030\001 \001(\t\032(\n\004Mget\022\022\n\nta"
-    "ble_name\030\001 \002(\t\022\014\n\004keys\030\002 \003(\t\"\226\007\n\013CmdResp"
-    "onse\022\032\n\004type\030\001 \002(\0162\014.client.Type\022 \n\004code"
-    "\030\002 \002(\0162\022.client.StatusCode\022\013\n\003msg\030\003 \001(\t\022"
-    "&\n\004sync\030\004 \001(\0132\030.client.CmdResponse.Sync\022"
-    "$\n\003get\030\005 \001(\0132\027.client.CmdResponse.Get\022\036\n"
-    "\010redirect\030\006 \001(\0132\014.client.Node\0221\n\ninfo_st"
-    "ats\030\007 \003(\0132\035.client.CmdResponse.InfoStats"
-    "\0227\n\rinfo_capacity\030\010 \003(\0132 .client.CmdResp"
-    "onse.InfoCapacity\022/\n\tinfo_repl\030\t \003(\0132\034.c"
-    "lient.CmdResponse.InfoRepl\022&\n\004mget\030\n \003(\013"
-    "2\030.client.CmdResponse.Mget\0223\n\013info_serve"
-    "r\030\013 \001(\0132\036.client.CmdResponse.InfoServer\032"
-    "C\n\004Sync\022\022\n\ntable_name\030\001 \002(\t\022\'\n\013sync_offs"
-    "et\030\002 \002(\0132\022.client.SyncOffset\032\024\n\003Get\022\r\n\005v"
-    "alue\030\001 \001(\014\032B\n\tInfoStats\022\022\n\ntable_name\030\001 "
-    "\002(\t\022\024\n\014total_querys\030\002 \002(\003\022\013\n\003qps\030\003 \002(\005\032@"
-    "\n\014InfoCapacity\022\022\n\ntable_name\030\001 \002(\t\022\014\n\004us"
-    "ed\030\002 \002(\003\022\016\n\006remain\030\003 \002(\003\032f\n\010InfoRepl\022\022\n\n"
-    "table_name\030\001 \002(\t\022\025\n\rpartition_cnt\030\002 \002(\003\022"
-    "/\n\017partition_state\030\003 \003(\0132\026.client.Partit"
-    "ionState\032\"\n\004Mget\022\013\n\003key\030\001 \002(\t\022\r\n\005value\030\002"
-    " \002(\014\032g\n\nInfoServer\022\r\n\005epoch\030\001 \002(\003\022\023\n\013tab"
-    "le_names\030\002 \003(\t\022\036\n\010cur_meta\030\003 \002(\0132\014.clien"
-    "t.Node\022\025\n\rmeta_renewing\030\004 \002(\010\"C\n\nBinlogS"
-    "kip\022\022\n\ntable_name\030\001 \002(\t\022\024\n\014partition_id\030"
-    "\002 \002(\005\022\013\n\003gap\030\003 \002(\003\"\324\001\n\013SyncRequest\022#\n\tsy"
-    "nc_type\030\001 \002(\0162\020.client.SyncType\022\r\n\005epoch"
-    "\030\002 \002(\003\022\032\n\004from\030\003 \002(\0132\014.client.Node\022\'\n\013sy"
-    "nc_offset\030\004 \002(\0132\022.client.SyncOffset\022#\n\007r"
-    "equest\030\005 \001(\0132\022.client.CmdRequest\022\'\n\013binl"
-    "og_skip\030\006 \001(\0132\022.client.BinlogSkip*t\n\004Typ"
-    "e\022\010\n\004SYNC\020\000\022\007\n\003SET\020\001\022\007\n\003GET\020\002\022\007\n\003DEL\020\003\022\r"
-    "\n\tINFOSTATS\020\004\022\020\n\014INFOCAPACITY\020\005\022\014\n\010INFOR"
-    "EPL\020\006\022\010\n\004MGET\020\007\022\016\n\nINFOSERVER\020\010*\035\n\010SyncT"
-    "ype\022\007\n\003CMD\020\000\022\010\n\004SKIP\020\001*J\n\nStatusCode\022\007\n\003"
-    "kOk\020\000\022\r\n\tkNotFound\020\001\022\t\n\005kWait\020\002\022\n\n\006kErro"
-    "r\020\003\022\r\n\tkFallback\020\004", 2418);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "client.proto", &protobuf_RegisterTypes);
-  Node::default_instance_ = new Node();
-  SyncOffset::default_instance_ = new SyncOffset();
-  KeyExpire::default_instance_ = new KeyExpire();
-  PartitionState::default_instance_ = new PartitionState();
-  CmdRequest::default_instance_ = new CmdRequest();
-  CmdRequest_Sync::default_instance_ = new CmdRequest_Sync();
-  CmdRequest_Set::default_instance_ = new CmdRequest_Set();
-  CmdRequest_Get::default_instance_ = new CmdRequest_Get();
-  CmdRequest_Del::default_instance_ = new CmdRequest_Del();
-  CmdRequest_Info::default_instance_ = new CmdRequest_Info();
-  CmdRequest_Mget::default_instance_ = new CmdRequest_Mget();
-  CmdResponse::default_instance_ = new CmdResponse();
-  CmdResponse_Sync::default_instance_ = new CmdResponse_Sync();
-  CmdResponse_Get::default_instance_ = new CmdResponse_Get();
-  CmdResponse_InfoStats::default_instance_ = new CmdResponse_InfoStats();
-  CmdResponse_InfoCapacity::default_instance_ = new CmdResponse_InfoCapacity();
-  CmdResponse_InfoRepl::default_instance_ = new CmdResponse_InfoRepl();
-  CmdResponse_Mget::default_instance_ = new CmdResponse_Mget();
-  CmdResponse_InfoServer::default_instance_ = new CmdResponse_InfoServer();
-  BinlogSkip::default_instance_ = new BinlogSkip();
-  SyncRequest::default_instance_ = new SyncRequest();
-  Node::default_instance_->InitAsDefaultInstance();
-  SyncOffset::default_instance_->InitAsDefaultInstance();
-  KeyExpire::default_instance_->InitAsDefaultInstance();
-  PartitionState::default_instance_->InitAsDefaultInstance();
-  CmdRequest::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Sync::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Set::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Get::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Del::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Info::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Mget::default_instance_->InitAsDefaultInstance();
-  CmdResponse::default_instance_->InitAsDefaultInstance();
-  CmdResponse_Sync::default_instance_->InitAsDefaultInstance();
-  CmdResponse_Get::default_instance_->InitAsDefaultInstance();
-  CmdResponse_InfoStats::default_instance_->InitAsDefaultInstance();
-  CmdResponse_InfoCapacity::default_instance_->InitAsDefaultInstance();
-  CmdResponse_InfoRepl::default_instance_->InitAsDefaultInstance();
-  CmdResponse_Mget::default_instance_->InitAsDefaultInstance();
-  CmdResponse_InfoServer::default_instance_->InitAsDefaultInstance();
-  BinlogSkip::default_instance_->InitAsDefaultInstance();
-  SyncRequest::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_client_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_client_2eproto {
-  StaticDescriptorInitializer_client_2eproto() {
-    protobuf_AddDesc_client_2eproto();
-  }
-} static_descriptor_initializer_client_2eproto_;
-const ::google::protobuf::EnumDescriptor* Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Type_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponseDefaultTypeInternal _CmdResponse_default_instance_;
+PROTOBUF_CONSTEXPR BinlogSkip::BinlogSkip(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gap_)*/int64_t{0}
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct BinlogSkipDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BinlogSkipDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BinlogSkipDefaultTypeInternal() {}
+  union {
+    BinlogSkip _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BinlogSkipDefaultTypeInternal _BinlogSkip_default_instance_;
+PROTOBUF_CONSTEXPR BinlogAck::BinlogAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_id_)*/0
+  , /*decltype(_impl_.credits_)*/0} {}
+struct BinlogAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BinlogAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BinlogAckDefaultTypeInternal() {}
+  union {
+    BinlogAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BinlogAckDefaultTypeInternal _BinlogAck_default_instance_;
+PROTOBUF_CONSTEXPR BinlogResync::BinlogResync(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct BinlogResyncDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BinlogResyncDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BinlogResyncDefaultTypeInternal() {}
+  union {
+    BinlogResync _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BinlogResyncDefaultTypeInternal _BinlogResync_default_instance_;
+PROTOBUF_CONSTEXPR BinlogHeartbeat::BinlogHeartbeat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_id_)*/0} {}
+struct BinlogHeartbeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BinlogHeartbeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BinlogHeartbeatDefaultTypeInternal() {}
+  union {
+    BinlogHeartbeat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BinlogHeartbeatDefaultTypeInternal _BinlogHeartbeat_default_instance_;
+PROTOBUF_CONSTEXPR SyncRequest::SyncRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.from_)*/nullptr
+  , /*decltype(_impl_.sync_offset_)*/nullptr
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.binlog_skip_)*/nullptr
+  , /*decltype(_impl_.binlog_ack_)*/nullptr
+  , /*decltype(_impl_.head_)*/nullptr
+  , /*decltype(_impl_.binlog_resync_)*/nullptr
+  , /*decltype(_impl_.binlog_heartbeat_)*/nullptr
+  , /*decltype(_impl_.epoch_)*/int64_t{0}
+  , /*decltype(_impl_.sync_type_)*/0
+  , /*decltype(_impl_.item_len_)*/0} {}
+struct SyncRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncRequestDefaultTypeInternal() {}
+  union {
+    SyncRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncRequestDefaultTypeInternal _SyncRequest_default_instance_;
+}  // namespace client
+static ::_pb::Metadata file_level_metadata_client_2eproto[39];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_client_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_client_2eproto = nullptr;
+
+const uint32_t TableStruct_client_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::client::Node, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::Node, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::Node, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::client::Node, _impl_.port_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::SyncOffset, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncOffset, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::SyncOffset, _impl_.filenum_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncOffset, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncOffset, _impl_.partition_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::ReplTerm, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::ReplTerm, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::ReplTerm, _impl_.repl_id_),
+  PROTOBUF_FIELD_OFFSET(::client::ReplTerm, _impl_.begin_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::ReadStaleness, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::ReadStaleness, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::ReadStaleness, _impl_.max_ms_),
+  PROTOBUF_FIELD_OFFSET(::client::ReadStaleness, _impl_.max_bytes_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::KeyExpire, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::KeyExpire, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::KeyExpire, _impl_.base_),
+  PROTOBUF_FIELD_OFFSET(::client::KeyExpire, _impl_.ttl_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _impl_.lag_bytes_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _impl_.unacked_records_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _impl_.send_bytes_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState_SlaveLag, _impl_.since_last_send_ms_),
+  0,
+  1,
+  4,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.partition_id_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.role_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.repl_state_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.master_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.slaves_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.sync_offset_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.slave_lags_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.apply_lag_bytes_),
+  PROTOBUF_FIELD_OFFSET(::client::PartitionState, _impl_.apply_lag_ms_),
+  6,
+  0,
+  1,
+  2,
+  ~0u,
+  3,
+  ~0u,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Sync, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Sync, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Sync, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Sync, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Sync, _impl_.sync_offset_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Sync, _impl_.repl_id_),
+  2,
+  0,
+  3,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _impl_.uuid_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Set, _impl_.expire_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Get, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Get, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Get, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Get, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Get, _impl_.uuid_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Get, _impl_.staleness_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Del, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Del, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Del, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Del, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Del, _impl_.uuid_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Info, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Info, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Info, _impl_.table_name_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mget, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mget, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mget, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mget, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mget, _impl_.staleness_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mget, _impl_.partition_id_),
+  0,
+  ~0u,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Msync, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Msync, _impl_.syncs_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Subscribe, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Subscribe, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Subscribe, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Subscribe, _impl_.cursors_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Subscribe, _impl_.key_prefix_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Subscribe, _impl_.max_records_),
+  0,
+  ~0u,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset_Kv, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset_Kv, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset_Kv, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset_Kv, _impl_.value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset, _impl_.kvs_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mset, _impl_.partition_id_),
+  0,
+  ~0u,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mdel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mdel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mdel, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mdel, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Mdel, _impl_.partition_id_),
+  0,
+  ~0u,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Incrby, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Incrby, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Incrby, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Incrby, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Incrby, _impl_.by_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Append, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Append, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Append, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Append, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest_Append, _impl_.value_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.sync_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.set_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.get_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.del_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.info_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.mget_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.msync_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.subscribe_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.mset_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.mdel_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.incrby_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.append_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdRequest, _impl_.write_us_),
+  13,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Sync, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Sync, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Sync, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Sync, _impl_.sync_offset_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Sync, _impl_.repl_history_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Get, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Get, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Get, _impl_.value_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoStats, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoStats, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoStats, _impl_.total_querys_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoStats, _impl_.qps_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoCapacity, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoCapacity, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoCapacity, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoCapacity, _impl_.used_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoCapacity, _impl_.remain_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoRepl, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoRepl, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoRepl, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoRepl, _impl_.partition_cnt_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoRepl, _impl_.partition_state_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Mget, _impl_.redirect_),
+  0,
+  1,
+  4,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoServer, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoServer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoServer, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoServer, _impl_.table_names_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoServer, _impl_.cur_meta_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_InfoServer, _impl_.meta_renewing_),
+  1,
+  ~0u,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _impl_.partition_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe_Record, _impl_.cursor_),
+  3,
+  4,
+  0,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Subscribe, _impl_.cursors_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_KeyResult, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_KeyResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_KeyResult, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_KeyResult, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_KeyResult, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_KeyResult, _impl_.redirect_),
+  0,
+  3,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Incrby, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Incrby, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Incrby, _impl_.value_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Append, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Append, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse_Append, _impl_.length_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.sync_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.get_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.redirect_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.info_stats_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.info_capacity_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.info_repl_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.mget_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.info_server_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.msync_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.subscribe_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.key_results_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.incrby_),
+  PROTOBUF_FIELD_OFFSET(::client::CmdResponse, _impl_.append_),
+  8,
+  9,
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  4,
+  ~0u,
+  5,
+  ~0u,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::client::BinlogSkip, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogSkip, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::BinlogSkip, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogSkip, _impl_.partition_id_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogSkip, _impl_.gap_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::BinlogAck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::BinlogAck, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogAck, _impl_.partition_id_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogAck, _impl_.credits_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::client::BinlogResync, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogResync, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::BinlogResync, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogResync, _impl_.partition_id_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::BinlogHeartbeat, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogHeartbeat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::BinlogHeartbeat, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::client::BinlogHeartbeat, _impl_.partition_id_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.sync_type_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.sync_offset_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.binlog_skip_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.binlog_ack_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.head_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.item_len_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.binlog_resync_),
+  PROTOBUF_FIELD_OFFSET(::client::SyncRequest, _impl_.binlog_heartbeat_),
+  9,
+  8,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  10,
+  6,
+  7,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::client::Node)},
+  { 10, 19, -1, sizeof(::client::SyncOffset)},
+  { 22, 30, -1, sizeof(::client::ReplTerm)},
+  { 32, 40, -1, sizeof(::client::ReadStaleness)},
+  { 42, 50, -1, sizeof(::client::KeyExpire)},
+  { 52, 63, -1, sizeof(::client::PartitionState_SlaveLag)},
+  { 68, 83, -1, sizeof(::client::PartitionState)},
+  { 92, 102, -1, sizeof(::client::CmdRequest_Sync)},
+  { 106, 117, -1, sizeof(::client::CmdRequest_Set)},
+  { 122, 132, -1, sizeof(::client::CmdRequest_Get)},
+  { 136, 145, -1, sizeof(::client::CmdRequest_Del)},
+  { 148, 155, -1, sizeof(::client::CmdRequest_Info)},
+  { 156, 166, -1, sizeof(::client::CmdRequest_Mget)},
+  { 170, -1, -1, sizeof(::client::CmdRequest_Msync)},
+  { 177, 187, -1, sizeof(::client::CmdRequest_Subscribe)},
+  { 191, 199, -1, sizeof(::client::CmdRequest_Mset_Kv)},
+  { 201, 210, -1, sizeof(::client::CmdRequest_Mset)},
+  { 213, 222, -1, sizeof(::client::CmdRequest_Mdel)},
+  { 225, 234, -1, sizeof(::client::CmdRequest_Incrby)},
+  { 237, 246, -1, sizeof(::client::CmdRequest_Append)},
+  { 249, 269, -1, sizeof(::client::CmdRequest)},
+  { 283, 292, -1, sizeof(::client::CmdResponse_Sync)},
+  { 295, 302, -1, sizeof(::client::CmdResponse_Get)},
+  { 303, 312, -1, sizeof(::client::CmdResponse_InfoStats)},
+  { 315, 324, -1, sizeof(::client::CmdResponse_InfoCapacity)},
+  { 327, 336, -1, sizeof(::client::CmdResponse_InfoRepl)},
+  { 339, 350, -1, sizeof(::client::CmdResponse_Mget)},
+  { 355, 365, -1, sizeof(::client::CmdResponse_InfoServer)},
+  { 369, 380, -1, sizeof(::client::CmdResponse_Subscribe_Record)},
+  { 385, -1, -1, sizeof(::client::CmdResponse_Subscribe)},
+  { 393, 403, -1, sizeof(::client::CmdResponse_KeyResult)},
+  { 407, 414, -1, sizeof(::client::CmdResponse_Incrby)},
+  { 415, 422, -1, sizeof(::client::CmdResponse_Append)},
+  { 423, 445, -1, sizeof(::client::CmdResponse)},
+  { 461, 470, -1, sizeof(::client::BinlogSkip)},
+  { 473, 482, -1, sizeof(::client::BinlogAck)},
+  { 485, 493, -1, sizeof(::client::BinlogResync)},
+  { 495, 503, -1, sizeof(::client::BinlogHeartbeat)},
+  { 505, 522, -1, sizeof(::client::SyncRequest)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::client::_Node_default_instance_._instance,
+  &::client::_SyncOffset_default_instance_._instance,
+  &::client::_ReplTerm_default_instance_._instance,
+  &::client::_ReadStaleness_default_instance_._instance,
+  &::client::_KeyExpire_default_instance_._instance,
+  &::client::_PartitionState_SlaveLag_default_instance_._instance,
+  &::client::_PartitionState_default_instance_._instance,
+  &::client::_CmdRequest_Sync_default_instance_._instance,
+  &::client::_CmdRequest_Set_default_instance_._instance,
+  &::client::_CmdRequest_Get_default_instance_._instance,
+  &::client::_CmdRequest_Del_default_instance_._instance,
+  &::client::_CmdRequest_Info_default_instance_._instance,
+  &::client::_CmdRequest_Mget_default_instance_._instance,
+  &::client::_CmdRequest_Msync_default_instance_._instance,
+  &::client::_CmdRequest_Subscribe_default_instance_._instance,
+  &::client::_CmdRequest_Mset_Kv_default_instance_._instance,
+  &::client::_CmdRequest_Mset_default_instance_._instance,
+  &::client::_CmdRequest_Mdel_default_instance_._instance,
+  &::client::_CmdRequest_Incrby_default_instance_._instance,
+  &::client::_CmdRequest_Append_default_instance_._instance,
+  &::client::_CmdRequest_default_instance_._instance,
+  &::client::_CmdResponse_Sync_default_instance_._instance,
+  &::client::_CmdResponse_Get_default_instance_._instance,
+  &::client::_CmdResponse_InfoStats_default_instance_._instance,
+  &::client::_CmdResponse_InfoCapacity_default_instance_._instance,
+  &::client::_CmdResponse_InfoRepl_default_instance_._instance,
+  &::client::_CmdResponse_Mget_default_instance_._instance,
+  &::client::_CmdResponse_InfoServer_default_instance_._instance,
+  &::client::_CmdResponse_Subscribe_Record_default_instance_._instance,
+  &::client::_CmdResponse_Subscribe_default_instance_._instance,
+  &::client::_CmdResponse_KeyResult_default_instance_._instance,
+  &::client::_CmdResponse_Incrby_default_instance_._instance,
+  &::client::_CmdResponse_Append_default_instance_._instance,
+  &::client::_CmdResponse_default_instance_._instance,
+  &::client::_BinlogSkip_default_instance_._instance,
+  &::client::_BinlogAck_default_instance_._instance,
+  &::client::_BinlogResync_default_instance_._instance,
+  &::client::_BinlogHeartbeat_default_instance_._instance,
+  &::client::_SyncRequest_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_client_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014client.proto\022\006client\" \n\004Node\022\n\n\002ip\030\001 \002"
+  "(\t\022\014\n\004port\030\002 \002(\005\"@\n\nSyncOffset\022\017\n\007filenu"
+  "m\030\001 \002(\005\022\016\n\006offset\030\002 \002(\003\022\021\n\tpartition\030\003 \001"
+  "(\005\">\n\010ReplTerm\022\017\n\007repl_id\030\001 \002(\t\022!\n\005begin"
+  "\030\002 \002(\0132\022.client.SyncOffset\"2\n\rReadStalen"
+  "ess\022\016\n\006max_ms\030\001 \001(\003\022\021\n\tmax_bytes\030\002 \001(\003\"&"
+  "\n\tKeyExpire\022\014\n\004base\030\001 \001(\005\022\013\n\003ttl\030\002 \002(\005\"\236"
+  "\003\n\016PartitionState\022\024\n\014partition_id\030\001 \002(\005\022"
+  "\014\n\004role\030\002 \002(\t\022\022\n\nrepl_state\030\003 \002(\t\022\034\n\006mas"
+  "ter\030\004 \002(\0132\014.client.Node\022\034\n\006slaves\030\005 \003(\0132"
+  "\014.client.Node\022\'\n\013sync_offset\030\006 \002(\0132\022.cli"
+  "ent.SyncOffset\0223\n\nslave_lags\030\007 \003(\0132\037.cli"
+  "ent.PartitionState.SlaveLag\022\027\n\017apply_lag"
+  "_bytes\030\010 \001(\003\022\024\n\014apply_lag_ms\030\t \001(\003\032\212\001\n\010S"
+  "laveLag\022\032\n\004node\030\001 \002(\0132\014.client.Node\022\021\n\tl"
+  "ag_bytes\030\002 \002(\003\022\027\n\017unacked_records\030\003 \002(\005\022"
+  "\032\n\022send_bytes_per_sec\030\004 \002(\003\022\032\n\022since_las"
+  "t_send_ms\030\005 \002(\003\"\346\013\n\nCmdRequest\022\032\n\004type\030\001"
+  " \002(\0162\014.client.Type\022%\n\004sync\030\002 \001(\0132\027.clien"
+  "t.CmdRequest.Sync\022#\n\003set\030\003 \001(\0132\026.client."
+  "CmdRequest.Set\022#\n\003get\030\004 \001(\0132\026.client.Cmd"
+  "Request.Get\022#\n\003del\030\005 \001(\0132\026.client.CmdReq"
+  "uest.Del\022%\n\004info\030\006 \001(\0132\027.client.CmdReque"
+  "st.Info\022%\n\004mget\030\007 \001(\0132\027.client.CmdReques"
+  "t.Mget\022\'\n\005msync\030\010 \001(\0132\030.client.CmdReques"
+  "t.Msync\022/\n\tsubscribe\030\t \001(\0132\034.client.CmdR"
+  "equest.Subscribe\022%\n\004mset\030\n \001(\0132\027.client."
+  "CmdRequest.Mset\022%\n\004mdel\030\013 \001(\0132\027.client.C"
+  "mdRequest.Mdel\022)\n\006incrby\030\014 \001(\0132\031.client."
+  "CmdRequest.Incrby\022)\n\006append\030\r \001(\0132\031.clie"
+  "nt.CmdRequest.Append\022\020\n\010write_us\030\016 \001(\003\032p"
+  "\n\004Sync\022\032\n\004node\030\001 \002(\0132\014.client.Node\022\022\n\nta"
+  "ble_name\030\002 \002(\t\022\'\n\013sync_offset\030\003 \002(\0132\022.cl"
+  "ient.SyncOffset\022\017\n\007repl_id\030\004 \001(\t\032f\n\003Set\022"
+  "\022\n\ntable_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\r\n\005valu"
+  "e\030\003 \002(\014\022\014\n\004uuid\030\004 \001(\t\022!\n\006expire\030\005 \001(\0132\021."
+  "client.KeyExpire\032^\n\003Get\022\022\n\ntable_name\030\001 "
+  "\002(\t\022\013\n\003key\030\002 \002(\t\022\014\n\004uuid\030\003 \001(\t\022(\n\tstalen"
+  "ess\030\004 \001(\0132\025.client.ReadStaleness\0324\n\003Del\022"
+  "\022\n\ntable_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\014\n\004uuid"
+  "\030\003 \001(\t\032\032\n\004Info\022\022\n\ntable_name\030\001 \001(\t\032h\n\004Mg"
+  "et\022\022\n\ntable_name\030\001 \002(\t\022\014\n\004keys\030\002 \003(\t\022(\n\t"
+  "staleness\030\003 \001(\0132\025.client.ReadStaleness\022\024"
+  "\n\014partition_id\030\004 \001(\005\032/\n\005Msync\022&\n\005syncs\030\001"
+  " \003(\0132\027.client.CmdRequest.Sync\032s\n\tSubscri"
+  "be\022\022\n\ntable_name\030\001 \002(\t\022#\n\007cursors\030\002 \003(\0132"
+  "\022.client.SyncOffset\022\022\n\nkey_prefix\030\003 \001(\014\022"
+  "\031\n\013max_records\030\004 \001(\005:\0041000\032{\n\004Mset\022\022\n\nta"
+  "ble_name\030\001 \002(\t\022\'\n\003kvs\030\002 \003(\0132\032.client.Cmd"
+  "Request.Mset.Kv\022\024\n\014partition_id\030\003 \001(\005\032 \n"
+  "\002Kv\022\013\n\003key\030\001 \002(\t\022\r\n\005value\030\002 \002(\014\032>\n\004Mdel\022"
+  "\022\n\ntable_name\030\001 \002(\t\022\014\n\004keys\030\002 \003(\t\022\024\n\014par"
+  "tition_id\030\003 \001(\005\0325\n\006Incrby\022\022\n\ntable_name\030"
+  "\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\n\n\002by\030\003 \002(\003\0328\n\006Append"
+  "\022\022\n\ntable_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\r\n\005val"
+  "ue\030\003 \002(\014\"\363\014\n\013CmdResponse\022\032\n\004type\030\001 \002(\0162\014"
+  ".client.Type\022 \n\004code\030\002 \002(\0162\022.client.Stat"
+  "usCode\022\013\n\003msg\030\003 \001(\t\022&\n\004sync\030\004 \001(\0132\030.clie"
+  "nt.CmdResponse.Sync\022$\n\003get\030\005 \001(\0132\027.clien"
+  "t.CmdResponse.Get\022\036\n\010redirect\030\006 \001(\0132\014.cl"
+  "ient.Node\0221\n\ninfo_stats\030\007 \003(\0132\035.client.C"
+  "mdResponse.InfoStats\0227\n\rinfo_capacity\030\010 "
+  "\003(\0132 .client.CmdResponse.InfoCapacity\022/\n"
+  "\tinfo_repl\030\t \003(\0132\034.client.CmdResponse.In"
+  "foRepl\022&\n\004mget\030\n \003(\0132\030.client.CmdRespons"
+  "e.Mget\0223\n\013info_server\030\013 \001(\0132\036.client.Cmd"
+  "Response.InfoServer\022\"\n\005msync\030\014 \003(\0132\023.cli"
+  "ent.CmdResponse\0220\n\tsubscribe\030\r \001(\0132\035.cli"
+  "ent.CmdResponse.Subscribe\0222\n\013key_results"
+  "\030\016 \003(\0132\035.client.CmdResponse.KeyResult\022*\n"
+  "\006incrby\030\017 \001(\0132\032.client.CmdResponse.Incrb"
+  "y\022*\n\006append\030\020 \001(\0132\032.client.CmdResponse.A"
+  "ppend\032k\n\004Sync\022\022\n\ntable_name\030\001 \002(\t\022\'\n\013syn"
+  "c_offset\030\002 \002(\0132\022.client.SyncOffset\022&\n\014re"
+  "pl_history\030\003 \003(\0132\020.client.ReplTerm\032\024\n\003Ge"
+  "t\022\r\n\005value\030\001 \001(\014\032B\n\tInfoStats\022\022\n\ntable_n"
+  "ame\030\001 \002(\t\022\024\n\014total_querys\030\002 \002(\003\022\013\n\003qps\030\003"
+  " \002(\005\032@\n\014InfoCapacity\022\022\n\ntable_name\030\001 \002(\t"
+  "\022\014\n\004used\030\002 \002(\003\022\016\n\006remain\030\003 \002(\003\032f\n\010InfoRe"
+  "pl\022\022\n\ntable_name\030\001 \002(\t\022\025\n\rpartition_cnt\030"
+  "\002 \002(\003\022/\n\017partition_state\030\003 \003(\0132\026.client."
+  "PartitionState\032v\n\004Mget\022\013\n\003key\030\001 \002(\t\022\r\n\005v"
+  "alue\030\002 \002(\014\022%\n\004code\030\003 \001(\0162\022.client.Status"
+  "Code:\003kOk\022\013\n\003msg\030\004 \001(\t\022\036\n\010redirect\030\005 \001(\013"
+  "2\014.client.Node\032g\n\nInfoServer\022\r\n\005epoch\030\001 "
+  "\002(\003\022\023\n\013table_names\030\002 \003(\t\022\036\n\010cur_meta\030\003 \002"
+  "(\0132\014.client.Node\022\025\n\rmeta_renewing\030\004 \002(\010\032"
+  "\340\001\n\tSubscribe\0225\n\007records\030\001 \003(\0132$.client."
+  "CmdResponse.Subscribe.Record\022#\n\007cursors\030"
+  "\002 \003(\0132\022.client.SyncOffset\032w\n\006Record\022\021\n\tp"
+  "artition\030\001 \002(\005\022\032\n\004type\030\002 \002(\0162\014.client.Ty"
+  "pe\022\013\n\003key\030\003 \002(\014\022\r\n\005value\030\004 \001(\014\022\"\n\006cursor"
+  "\030\005 \002(\0132\022.client.SyncOffset\032g\n\tKeyResult\022"
+  "\013\n\003key\030\001 \002(\t\022 \n\004code\030\002 \002(\0162\022.client.Stat"
+  "usCode\022\013\n\003msg\030\003 \001(\t\022\036\n\010redirect\030\004 \001(\0132\014."
+  "client.Node\032\027\n\006Incrby\022\r\n\005value\030\001 \002(\003\032\030\n\006"
+  "Append\022\016\n\006length\030\001 \002(\003\"C\n\nBinlogSkip\022\022\n\n"
+  "table_name\030\001 \002(\t\022\024\n\014partition_id\030\002 \002(\005\022\013"
+  "\n\003gap\030\003 \002(\003\"F\n\tBinlogAck\022\022\n\ntable_name\030\001"
+  " \002(\t\022\024\n\014partition_id\030\002 \002(\005\022\017\n\007credits\030\003 "
+  "\002(\005\"8\n\014BinlogResync\022\022\n\ntable_name\030\001 \002(\t\022"
+  "\024\n\014partition_id\030\002 \002(\005\";\n\017BinlogHeartbeat"
+  "\022\022\n\ntable_name\030\001 \002(\t\022\024\n\014partition_id\030\002 \002"
+  "(\005\"\217\003\n\013SyncRequest\022#\n\tsync_type\030\001 \002(\0162\020."
+  "client.SyncType\022\r\n\005epoch\030\002 \002(\003\022\032\n\004from\030\003"
+  " \002(\0132\014.client.Node\022\'\n\013sync_offset\030\004 \002(\0132"
+  "\022.client.SyncOffset\022#\n\007request\030\005 \001(\0132\022.c"
+  "lient.CmdRequest\022\'\n\013binlog_skip\030\006 \001(\0132\022."
+  "client.BinlogSkip\022%\n\nbinlog_ack\030\007 \001(\0132\021."
+  "client.BinlogAck\022 \n\004head\030\010 \001(\0132\022.client."
+  "SyncOffset\022\020\n\010item_len\030\t \001(\005\022+\n\rbinlog_r"
+  "esync\030\n \001(\0132\024.client.BinlogResync\0221\n\020bin"
+  "log_heartbeat\030\013 \001(\0132\027.client.BinlogHeart"
+  "beat*\306\001\n\004Type\022\010\n\004SYNC\020\000\022\007\n\003SET\020\001\022\007\n\003GET\020"
+  "\002\022\007\n\003DEL\020\003\022\r\n\tINFOSTATS\020\004\022\020\n\014INFOCAPACIT"
+  "Y\020\005\022\014\n\010INFOREPL\020\006\022\010\n\004MGET\020\007\022\016\n\nINFOSERVE"
+  "R\020\010\022\t\n\005MSYNC\020\t\022\r\n\tSUBSCRIBE\020\n\022\010\n\004MSET\020\013\022"
+  "\010\n\004MDEL\020\014\022\n\n\006INCRBY\020\r\022\n\n\006DECRBY\020\016\022\n\n\006APP"
+  "END\020\017*A\n\010SyncType\022\007\n\003CMD\020\000\022\010\n\004SKIP\020\001\022\007\n\003"
+  "ACK\020\002\022\n\n\006RESYNC\020\003\022\r\n\tHEARTBEAT\020\004*J\n\nStat"
+  "usCode\022\007\n\003kOk\020\000\022\r\n\tkNotFound\020\001\022\t\n\005kWait\020"
+  "\002\022\n\n\006kError\020\003\022\r\n\tkFallback\020\004"
+  ;
+static ::_pbi::once_flag descriptor_table_client_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_client_2eproto = {
+    false, false, 4868, descriptor_table_protodef_client_2eproto,
+    "client.proto",
+    &descriptor_table_client_2eproto_once, nullptr, 0, 39,
+    schemas, file_default_instances, TableStruct_client_2eproto::offsets,
+    file_level_metadata_client_2eproto, file_level_enum_descriptors_client_2eproto,
+    file_level_service_descriptors_client_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_client_2eproto_getter() {
+  return &descriptor_table_client_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_client_2eproto(&descriptor_table_client_2eproto);
+namespace client {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_client_2eproto);
+  return file_level_enum_descriptors_client_2eproto[0];
 }
 bool Type_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -707,32 +1456,42 @@ bool Type_IsValid(int value) {
     case 6:
     case 7:
     case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* SyncType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SyncType_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SyncType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_client_2eproto);
+  return file_level_enum_descriptors_client_2eproto[1];
 }
 bool SyncType_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
+    case 2:
+    case 3:
+    case 4:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return StatusCode_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_client_2eproto);
+  return file_level_enum_descriptors_client_2eproto[2];
 }
 bool StatusCode_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -747,7175 +1506,14076 @@ bool StatusCode_IsValid(int value) {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Node::kIpFieldNumber;
-const int Node::kPortFieldNumber;
-#endif  // !_MSC_VER
-
-Node::Node()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Node::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Node>()._impl_._has_bits_);
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void Node::InitAsDefaultInstance() {
+Node::Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.Node)
 }
-
 Node::Node(const Node& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Node::SharedCtor() {
-  _cached_size_ = 0;
-  ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  port_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Node* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.port_ = from._impl_.port_;
+  // @@protoc_insertion_point(copy_constructor:client.Node)
+}
+
+inline void Node::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){0}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Node::~Node() {
+  // @@protoc_insertion_point(destructor:client.Node)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Node::SharedDtor() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Node::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
 void Node::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Node::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Node_descriptor_;
-}
-
-const Node& Node::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
-
-Node* Node::default_instance_ = NULL;
-
-Node* Node::New() const {
-  return new Node;
+  _impl_._cached_size_.Set(size);
 }
 
 void Node::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_ip()) {
-      if (ip_ != &::google::protobuf::internal::kEmptyString) {
-        ip_->clear();
-      }
-    }
-    port_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Node::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:client.Node)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.ip_.ClearNonDefaultToEmpty();
+  }
+  _impl_.port_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Node::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string ip = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_ip()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->ip().data(), this->ip().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_port;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.Node.ip");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 port = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-          set_has_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Node::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Node::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.Node)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string ip = 1;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->ip().data(), this->ip().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->ip(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.Node.ip");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_ip(), target);
   }
 
   // required int32 port = 2;
-  if (has_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->port(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_port(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.Node)
+  return target;
 }
 
-::google::protobuf::uint8* Node::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string ip = 1;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->ip().data(), this->ip().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->ip(), target);
-  }
+size_t Node::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.Node)
+  size_t total_size = 0;
 
-  // required int32 port = 2;
-  if (has_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->port(), target);
+  if (_internal_has_ip()) {
+    // required string ip = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_port()) {
+    // required int32 port = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
-  return target;
-}
 
-int Node::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t Node::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.Node)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string ip = 1;
-    if (has_ip()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->ip());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
 
     // required int32 port = 2;
-    if (has_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->port());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
 
-void Node::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Node* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Node*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Node::MergeFrom(const Node& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_ip()) {
-      set_ip(from.ip());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Node::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Node::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Node::GetClassData() const { return &_class_data_; }
+
+
+void Node::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Node*>(&to_msg);
+  auto& from = static_cast<const Node&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.Node)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
     }
-    if (from.has_port()) {
-      set_port(from.port());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.port_ = from._impl_.port_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Node::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Node::CopyFrom(const Node& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.Node)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Node::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Node::Swap(Node* other) {
-  if (other != this) {
-    std::swap(ip_, other->ip_);
-    std::swap(port_, other->port_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Node::InternalSwap(Node* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  swap(_impl_.port_, other->_impl_.port_);
 }
 
-::google::protobuf::Metadata Node::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Node_descriptor_;
-  metadata.reflection = Node_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Node::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SyncOffset::kFilenumFieldNumber;
-const int SyncOffset::kOffsetFieldNumber;
-const int SyncOffset::kPartitionFieldNumber;
-#endif  // !_MSC_VER
-
-SyncOffset::SyncOffset()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class SyncOffset::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncOffset>()._impl_._has_bits_);
+  static void set_has_filenum(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void SyncOffset::InitAsDefaultInstance() {
+SyncOffset::SyncOffset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.SyncOffset)
 }
-
 SyncOffset::SyncOffset(const SyncOffset& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SyncOffset::SharedCtor() {
-  _cached_size_ = 0;
-  filenum_ = 0;
-  offset_ = GOOGLE_LONGLONG(0);
-  partition_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncOffset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.filenum_){}
+    , decltype(_impl_.partition_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.partition_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.partition_));
+  // @@protoc_insertion_point(copy_constructor:client.SyncOffset)
+}
+
+inline void SyncOffset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){int64_t{0}}
+    , decltype(_impl_.filenum_){0}
+    , decltype(_impl_.partition_){0}
+  };
 }
 
 SyncOffset::~SyncOffset() {
+  // @@protoc_insertion_point(destructor:client.SyncOffset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SyncOffset::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void SyncOffset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void SyncOffset::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SyncOffset::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SyncOffset_descriptor_;
-}
-
-const SyncOffset& SyncOffset::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
-
-SyncOffset* SyncOffset::default_instance_ = NULL;
-
-SyncOffset* SyncOffset::New() const {
-  return new SyncOffset;
+  _impl_._cached_size_.Set(size);
 }
 
 void SyncOffset::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    filenum_ = 0;
-    offset_ = GOOGLE_LONGLONG(0);
-    partition_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SyncOffset::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:client.SyncOffset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.partition_) -
+        reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.partition_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncOffset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 filenum = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &filenum_)));
-          set_has_filenum();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_offset;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_filenum(&has_bits);
+          _impl_.filenum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required int64 offset = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_offset:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &offset_)));
-          set_has_offset();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_partition;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 partition = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_)));
-          set_has_partition();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SyncOffset::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_partition(&has_bits);
+          _impl_.partition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncOffset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.SyncOffset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 filenum = 1;
-  if (has_filenum()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->filenum(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_filenum(), target);
   }
 
   // required int64 offset = 2;
-  if (has_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->offset(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_offset(), target);
   }
 
   // optional int32 partition = 3;
-  if (has_partition()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->partition(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_partition(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.SyncOffset)
+  return target;
 }
 
-::google::protobuf::uint8* SyncOffset::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 filenum = 1;
-  if (has_filenum()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->filenum(), target);
-  }
+size_t SyncOffset::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.SyncOffset)
+  size_t total_size = 0;
 
-  // required int64 offset = 2;
-  if (has_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->offset(), target);
+  if (_internal_has_offset()) {
+    // required int64 offset = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
   }
 
-  // optional int32 partition = 3;
-  if (has_partition()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->partition(), target);
+  if (_internal_has_filenum()) {
+    // required int32 filenum = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_filenum());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t SyncOffset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.SyncOffset)
+  size_t total_size = 0;
 
-int SyncOffset::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 filenum = 1;
-    if (has_filenum()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->filenum());
-    }
-
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required int64 offset = 2;
-    if (has_offset()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->offset());
-    }
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
 
-    // optional int32 partition = 3;
-    if (has_partition()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition());
-    }
+    // required int32 filenum = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_filenum());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void SyncOffset::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SyncOffset* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SyncOffset*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // optional int32 partition = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SyncOffset::MergeFrom(const SyncOffset& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_filenum()) {
-      set_filenum(from.filenum());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncOffset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncOffset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncOffset::GetClassData() const { return &_class_data_; }
+
+
+void SyncOffset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncOffset*>(&to_msg);
+  auto& from = static_cast<const SyncOffset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.SyncOffset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
     }
-    if (from.has_offset()) {
-      set_offset(from.offset());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.filenum_ = from._impl_.filenum_;
     }
-    if (from.has_partition()) {
-      set_partition(from.partition());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.partition_ = from._impl_.partition_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SyncOffset::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SyncOffset::CopyFrom(const SyncOffset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.SyncOffset)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SyncOffset::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SyncOffset::Swap(SyncOffset* other) {
-  if (other != this) {
-    std::swap(filenum_, other->filenum_);
-    std::swap(offset_, other->offset_);
-    std::swap(partition_, other->partition_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SyncOffset::InternalSwap(SyncOffset* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncOffset, _impl_.partition_)
+      + sizeof(SyncOffset::_impl_.partition_)
+      - PROTOBUF_FIELD_OFFSET(SyncOffset, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
 }
 
-::google::protobuf::Metadata SyncOffset::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SyncOffset_descriptor_;
-  metadata.reflection = SyncOffset_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SyncOffset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int KeyExpire::kBaseFieldNumber;
-const int KeyExpire::kTtlFieldNumber;
-#endif  // !_MSC_VER
-
-KeyExpire::KeyExpire()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void KeyExpire::InitAsDefaultInstance() {
+class ReplTerm::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReplTerm>()._impl_._has_bits_);
+  static void set_has_repl_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::client::SyncOffset& begin(const ReplTerm* msg);
+  static void set_has_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::client::SyncOffset&
+ReplTerm::_Internal::begin(const ReplTerm* msg) {
+  return *msg->_impl_.begin_;
+}
+ReplTerm::ReplTerm(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.ReplTerm)
+}
+ReplTerm::ReplTerm(const ReplTerm& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplTerm* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.repl_id_){}
+    , decltype(_impl_.begin_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.repl_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_repl_id()) {
+    _this->_impl_.repl_id_.Set(from._internal_repl_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_begin()) {
+    _this->_impl_.begin_ = new ::client::SyncOffset(*from._impl_.begin_);
+  }
+  // @@protoc_insertion_point(copy_constructor:client.ReplTerm)
+}
+
+inline void ReplTerm::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.repl_id_){}
+    , decltype(_impl_.begin_){nullptr}
+  };
+  _impl_.repl_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-KeyExpire::KeyExpire(const KeyExpire& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+ReplTerm::~ReplTerm() {
+  // @@protoc_insertion_point(destructor:client.ReplTerm)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void KeyExpire::SharedCtor() {
-  _cached_size_ = 0;
-  base_ = 0;
-  ttl_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void ReplTerm::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.repl_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.begin_;
+}
+
+void ReplTerm::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplTerm::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.ReplTerm)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.repl_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.begin_ != nullptr);
+      _impl_.begin_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplTerm::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string repl_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_repl_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.ReplTerm.repl_id");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.SyncOffset begin = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_begin(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplTerm::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.ReplTerm)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string repl_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_repl_id().data(), static_cast<int>(this->_internal_repl_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.ReplTerm.repl_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_repl_id(), target);
+  }
+
+  // required .client.SyncOffset begin = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::begin(this),
+        _Internal::begin(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.ReplTerm)
+  return target;
 }
 
-KeyExpire::~KeyExpire() {
-  SharedDtor();
-}
+size_t ReplTerm::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.ReplTerm)
+  size_t total_size = 0;
 
-void KeyExpire::SharedDtor() {
-  if (this != default_instance_) {
+  if (_internal_has_repl_id()) {
+    // required string repl_id = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_repl_id());
   }
-}
 
-void KeyExpire::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* KeyExpire::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return KeyExpire_descriptor_;
-}
+  if (_internal_has_begin()) {
+    // required .client.SyncOffset begin = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.begin_);
+  }
 
-const KeyExpire& KeyExpire::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+  return total_size;
 }
+size_t ReplTerm::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.ReplTerm)
+  size_t total_size = 0;
 
-KeyExpire* KeyExpire::default_instance_ = NULL;
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string repl_id = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_repl_id());
 
-KeyExpire* KeyExpire::New() const {
-  return new KeyExpire;
-}
+    // required .client.SyncOffset begin = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.begin_);
 
-void KeyExpire::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    base_ = 0;
-    ttl_ = 0;
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-bool KeyExpire::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 base = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &base_)));
-          set_has_base();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_ttl;
-        break;
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplTerm::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplTerm::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplTerm::GetClassData() const { return &_class_data_; }
 
-      // required int32 ttl = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_ttl:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &ttl_)));
-          set_has_ttl();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+
+void ReplTerm::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplTerm*>(&to_msg);
+  auto& from = static_cast<const ReplTerm&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.ReplTerm)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_repl_id(from._internal_repl_id());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_begin()->::client::SyncOffset::MergeFrom(
+          from._internal_begin());
     }
   }
-  return true;
-#undef DO_
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void KeyExpire::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional int32 base = 1;
-  if (has_base()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->base(), output);
-  }
+void ReplTerm::CopyFrom(const ReplTerm& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.ReplTerm)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-  // required int32 ttl = 2;
-  if (has_ttl()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->ttl(), output);
+bool ReplTerm::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_begin()) {
+    if (!_impl_.begin_->IsInitialized()) return false;
   }
+  return true;
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+void ReplTerm::InternalSwap(ReplTerm* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.repl_id_, lhs_arena,
+      &other->_impl_.repl_id_, rhs_arena
+  );
+  swap(_impl_.begin_, other->_impl_.begin_);
 }
 
-::google::protobuf::uint8* KeyExpire::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional int32 base = 1;
-  if (has_base()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->base(), target);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata ReplTerm::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[2]);
+}
 
-  // required int32 ttl = 2;
-  if (has_ttl()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->ttl(), target);
-  }
+// ===================================================================
+
+class ReadStaleness::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReadStaleness>()._impl_._has_bits_);
+  static void set_has_max_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ReadStaleness::ReadStaleness(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.ReadStaleness)
+}
+ReadStaleness::ReadStaleness(const ReadStaleness& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadStaleness* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.max_ms_){}
+    , decltype(_impl_.max_bytes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.max_ms_, &from._impl_.max_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_bytes_) -
+    reinterpret_cast<char*>(&_impl_.max_ms_)) + sizeof(_impl_.max_bytes_));
+  // @@protoc_insertion_point(copy_constructor:client.ReadStaleness)
+}
+
+inline void ReadStaleness::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.max_ms_){int64_t{0}}
+    , decltype(_impl_.max_bytes_){int64_t{0}}
+  };
+}
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+ReadStaleness::~ReadStaleness() {
+  // @@protoc_insertion_point(destructor:client.ReadStaleness)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void ReadStaleness::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReadStaleness::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadStaleness::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.ReadStaleness)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.max_ms_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_bytes_) -
+        reinterpret_cast<char*>(&_impl_.max_ms_)) + sizeof(_impl_.max_bytes_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadStaleness::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int64 max_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_max_ms(&has_bits);
+          _impl_.max_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 max_bytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max_bytes(&has_bits);
+          _impl_.max_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadStaleness::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.ReadStaleness)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int64 max_ms = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_max_ms(), target);
+  }
+
+  // optional int64 max_bytes = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_max_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.ReadStaleness)
   return target;
 }
 
-int KeyExpire::ByteSize() const {
-  int total_size = 0;
+size_t ReadStaleness::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.ReadStaleness)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 base = 1;
-    if (has_base()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->base());
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int64 max_ms = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_max_ms());
     }
 
-    // required int32 ttl = 2;
-    if (has_ttl()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->ttl());
+    // optional int64 max_bytes = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_max_bytes());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void KeyExpire::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const KeyExpire* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const KeyExpire*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadStaleness::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadStaleness::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadStaleness::GetClassData() const { return &_class_data_; }
+
+
+void ReadStaleness::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadStaleness*>(&to_msg);
+  auto& from = static_cast<const ReadStaleness&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.ReadStaleness)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void KeyExpire::MergeFrom(const KeyExpire& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_base()) {
-      set_base(from.base());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.max_ms_ = from._impl_.max_ms_;
     }
-    if (from.has_ttl()) {
-      set_ttl(from.ttl());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_bytes_ = from._impl_.max_bytes_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void KeyExpire::CopyFrom(const ::google::protobuf::Message& from) {
+void ReadStaleness::CopyFrom(const ReadStaleness& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.ReadStaleness)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void KeyExpire::CopyFrom(const KeyExpire& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool KeyExpire::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000002) != 0x00000002) return false;
-
+bool ReadStaleness::IsInitialized() const {
   return true;
 }
 
-void KeyExpire::Swap(KeyExpire* other) {
-  if (other != this) {
-    std::swap(base_, other->base_);
-    std::swap(ttl_, other->ttl_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void ReadStaleness::InternalSwap(ReadStaleness* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadStaleness, _impl_.max_bytes_)
+      + sizeof(ReadStaleness::_impl_.max_bytes_)
+      - PROTOBUF_FIELD_OFFSET(ReadStaleness, _impl_.max_ms_)>(
+          reinterpret_cast<char*>(&_impl_.max_ms_),
+          reinterpret_cast<char*>(&other->_impl_.max_ms_));
 }
 
-::google::protobuf::Metadata KeyExpire::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = KeyExpire_descriptor_;
-  metadata.reflection = KeyExpire_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ReadStaleness::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[3]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int PartitionState::kPartitionIdFieldNumber;
-const int PartitionState::kRoleFieldNumber;
-const int PartitionState::kReplStateFieldNumber;
-const int PartitionState::kMasterFieldNumber;
-const int PartitionState::kSlavesFieldNumber;
-const int PartitionState::kSyncOffsetFieldNumber;
-#endif  // !_MSC_VER
+class KeyExpire::_Internal {
+ public:
+  using HasBits = decltype(std::declval<KeyExpire>()._impl_._has_bits_);
+  static void set_has_base(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ttl(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
 
-PartitionState::PartitionState()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+KeyExpire::KeyExpire(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.KeyExpire)
 }
-
-void PartitionState::InitAsDefaultInstance() {
-  master_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
-  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
+KeyExpire::KeyExpire(const KeyExpire& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeyExpire* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.base_){}
+    , decltype(_impl_.ttl_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.base_, &from._impl_.base_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ttl_) -
+    reinterpret_cast<char*>(&_impl_.base_)) + sizeof(_impl_.ttl_));
+  // @@protoc_insertion_point(copy_constructor:client.KeyExpire)
+}
+
+inline void KeyExpire::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.base_){0}
+    , decltype(_impl_.ttl_){0}
+  };
 }
 
-PartitionState::PartitionState(const PartitionState& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+KeyExpire::~KeyExpire() {
+  // @@protoc_insertion_point(destructor:client.KeyExpire)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void PartitionState::SharedCtor() {
-  _cached_size_ = 0;
-  partition_id_ = 0;
-  role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  master_ = NULL;
-  sync_offset_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void KeyExpire::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-PartitionState::~PartitionState() {
-  SharedDtor();
+void KeyExpire::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void PartitionState::SharedDtor() {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    delete role_;
+void KeyExpire::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.KeyExpire)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.base_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ttl_) -
+        reinterpret_cast<char*>(&_impl_.base_)) + sizeof(_impl_.ttl_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeyExpire::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 base = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_base(&has_bits);
+          _impl_.base_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 ttl = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_ttl(&has_bits);
+          _impl_.ttl_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeyExpire::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.KeyExpire)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 base = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_base(), target);
   }
-  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
-    delete repl_state_;
+
+  // required int32 ttl = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_ttl(), target);
   }
-  if (this != default_instance_) {
-    delete master_;
-    delete sync_offset_;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.KeyExpire)
+  return target;
 }
 
-void PartitionState::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PartitionState::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PartitionState_descriptor_;
-}
+size_t KeyExpire::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.KeyExpire)
+  size_t total_size = 0;
 
-const PartitionState& PartitionState::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
+  // required int32 ttl = 2;
+  if (_internal_has_ttl()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ttl());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PartitionState* PartitionState::default_instance_ = NULL;
+  // optional int32 base = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_base());
+  }
 
-PartitionState* PartitionState::New() const {
-  return new PartitionState;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PartitionState::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    partition_id_ = 0;
-    if (has_role()) {
-      if (role_ != &::google::protobuf::internal::kEmptyString) {
-        role_->clear();
-      }
-    }
-    if (has_repl_state()) {
-      if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
-        repl_state_->clear();
-      }
-    }
-    if (has_master()) {
-      if (master_ != NULL) master_->::client::Node::Clear();
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeyExpire::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeyExpire::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeyExpire::GetClassData() const { return &_class_data_; }
+
+
+void KeyExpire::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeyExpire*>(&to_msg);
+  auto& from = static_cast<const KeyExpire&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.KeyExpire)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.base_ = from._impl_.base_;
     }
-    if (has_sync_offset()) {
-      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ttl_ = from._impl_.ttl_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  slaves_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-bool PartitionState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required int32 partition_id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_id_)));
-          set_has_partition_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_role;
-        break;
-      }
+void KeyExpire::CopyFrom(const KeyExpire& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.KeyExpire)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // required string role = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_role:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_role()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->role().data(), this->role().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_repl_state;
-        break;
-      }
+bool KeyExpire::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
 
-      // required string repl_state = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_repl_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_repl_state()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->repl_state().data(), this->repl_state().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_master;
-        break;
-      }
+void KeyExpire::InternalSwap(KeyExpire* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(KeyExpire, _impl_.ttl_)
+      + sizeof(KeyExpire::_impl_.ttl_)
+      - PROTOBUF_FIELD_OFFSET(KeyExpire, _impl_.base_)>(
+          reinterpret_cast<char*>(&_impl_.base_),
+          reinterpret_cast<char*>(&other->_impl_.base_));
+}
 
-      // required .client.Node master = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_master:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_master()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_slaves;
-        break;
-      }
+::PROTOBUF_NAMESPACE_ID::Metadata KeyExpire::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[4]);
+}
 
-      // repeated .client.Node slaves = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_slaves:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_slaves()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_slaves;
-        if (input->ExpectTag(50)) goto parse_sync_offset;
-        break;
-      }
+// ===================================================================
 
-      // required .client.SyncOffset sync_offset = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_offset()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+class PartitionState_SlaveLag::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PartitionState_SlaveLag>()._impl_._has_bits_);
+  static const ::client::Node& node(const PartitionState_SlaveLag* msg);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lag_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_unacked_records(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_send_bytes_per_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_since_last_send_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+const ::client::Node&
+PartitionState_SlaveLag::_Internal::node(const PartitionState_SlaveLag* msg) {
+  return *msg->_impl_.node_;
+}
+PartitionState_SlaveLag::PartitionState_SlaveLag(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.PartitionState.SlaveLag)
+}
+PartitionState_SlaveLag::PartitionState_SlaveLag(const PartitionState_SlaveLag& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PartitionState_SlaveLag* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.lag_bytes_){}
+    , decltype(_impl_.send_bytes_per_sec_){}
+    , decltype(_impl_.since_last_send_ms_){}
+    , decltype(_impl_.unacked_records_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::client::Node(*from._impl_.node_);
+  }
+  ::memcpy(&_impl_.lag_bytes_, &from._impl_.lag_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unacked_records_) -
+    reinterpret_cast<char*>(&_impl_.lag_bytes_)) + sizeof(_impl_.unacked_records_));
+  // @@protoc_insertion_point(copy_constructor:client.PartitionState.SlaveLag)
+}
+
+inline void PartitionState_SlaveLag::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.lag_bytes_){int64_t{0}}
+    , decltype(_impl_.send_bytes_per_sec_){int64_t{0}}
+    , decltype(_impl_.since_last_send_ms_){int64_t{0}}
+    , decltype(_impl_.unacked_records_){0}
+  };
+}
+
+PartitionState_SlaveLag::~PartitionState_SlaveLag() {
+  // @@protoc_insertion_point(destructor:client.PartitionState.SlaveLag)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  return true;
-#undef DO_
+  SharedDtor();
 }
 
-void PartitionState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required int32 partition_id = 1;
-  if (has_partition_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->partition_id(), output);
+inline void PartitionState_SlaveLag::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.node_;
+}
+
+void PartitionState_SlaveLag::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PartitionState_SlaveLag::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.PartitionState.SlaveLag)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.node_ != nullptr);
+    _impl_.node_->Clear();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.lag_bytes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.unacked_records_) -
+        reinterpret_cast<char*>(&_impl_.lag_bytes_)) + sizeof(_impl_.unacked_records_));
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-  // required string role = 2;
-  if (has_role()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->role().data(), this->role().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->role(), output);
+const char* PartitionState_SlaveLag::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .client.Node node = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 lag_bytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lag_bytes(&has_bits);
+          _impl_.lag_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 unacked_records = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_unacked_records(&has_bits);
+          _impl_.unacked_records_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 send_bytes_per_sec = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_send_bytes_per_sec(&has_bits);
+          _impl_.send_bytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 since_last_send_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_since_last_send_ms(&has_bits);
+          _impl_.since_last_send_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PartitionState_SlaveLag::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.PartitionState.SlaveLag)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .client.Node node = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
   }
 
-  // required string repl_state = 3;
-  if (has_repl_state()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->repl_state().data(), this->repl_state().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->repl_state(), output);
+  // required int64 lag_bytes = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_lag_bytes(), target);
   }
 
-  // required .client.Node master = 4;
-  if (has_master()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->master(), output);
+  // required int32 unacked_records = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_unacked_records(), target);
   }
 
-  // repeated .client.Node slaves = 5;
-  for (int i = 0; i < this->slaves_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->slaves(i), output);
+  // required int64 send_bytes_per_sec = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_send_bytes_per_sec(), target);
   }
 
-  // required .client.SyncOffset sync_offset = 6;
-  if (has_sync_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->sync_offset(), output);
+  // required int64 since_last_send_ms = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_since_last_send_ms(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.PartitionState.SlaveLag)
+  return target;
 }
 
-::google::protobuf::uint8* PartitionState::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 partition_id = 1;
-  if (has_partition_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->partition_id(), target);
-  }
+size_t PartitionState_SlaveLag::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.PartitionState.SlaveLag)
+  size_t total_size = 0;
 
-  // required string role = 2;
-  if (has_role()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->role().data(), this->role().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->role(), target);
+  if (_internal_has_node()) {
+    // required .client.Node node = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
   }
 
-  // required string repl_state = 3;
-  if (has_repl_state()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->repl_state().data(), this->repl_state().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->repl_state(), target);
+  if (_internal_has_lag_bytes()) {
+    // required int64 lag_bytes = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_lag_bytes());
   }
 
-  // required .client.Node master = 4;
-  if (has_master()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->master(), target);
+  if (_internal_has_send_bytes_per_sec()) {
+    // required int64 send_bytes_per_sec = 4;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_send_bytes_per_sec());
   }
 
-  // repeated .client.Node slaves = 5;
-  for (int i = 0; i < this->slaves_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->slaves(i), target);
+  if (_internal_has_since_last_send_ms()) {
+    // required int64 since_last_send_ms = 5;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_since_last_send_ms());
   }
 
-  // required .client.SyncOffset sync_offset = 6;
-  if (has_sync_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->sync_offset(), target);
+  if (_internal_has_unacked_records()) {
+    // required int32 unacked_records = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_unacked_records());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t PartitionState_SlaveLag::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.PartitionState.SlaveLag)
+  size_t total_size = 0;
 
-int PartitionState::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 partition_id = 1;
-    if (has_partition_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition_id());
-    }
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required .client.Node node = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
 
-    // required string role = 2;
-    if (has_role()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->role());
-    }
+    // required int64 lag_bytes = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_lag_bytes());
 
-    // required string repl_state = 3;
-    if (has_repl_state()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->repl_state());
-    }
+    // required int64 send_bytes_per_sec = 4;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_send_bytes_per_sec());
 
-    // required .client.Node master = 4;
-    if (has_master()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->master());
-    }
+    // required int64 since_last_send_ms = 5;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_since_last_send_ms());
 
-    // required .client.SyncOffset sync_offset = 6;
-    if (has_sync_offset()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_offset());
-    }
+    // required int32 unacked_records = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_unacked_records());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  // repeated .client.Node slaves = 5;
-  total_size += 1 * this->slaves_size();
-  for (int i = 0; i < this->slaves_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->slaves(i));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PartitionState::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PartitionState* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PartitionState*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PartitionState_SlaveLag::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PartitionState_SlaveLag::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PartitionState_SlaveLag::GetClassData() const { return &_class_data_; }
+
 
-void PartitionState::MergeFrom(const PartitionState& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  slaves_.MergeFrom(from.slaves_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_partition_id()) {
-      set_partition_id(from.partition_id());
+void PartitionState_SlaveLag::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PartitionState_SlaveLag*>(&to_msg);
+  auto& from = static_cast<const PartitionState_SlaveLag&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.PartitionState.SlaveLag)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_node()->::client::Node::MergeFrom(
+          from._internal_node());
     }
-    if (from.has_role()) {
-      set_role(from.role());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.lag_bytes_ = from._impl_.lag_bytes_;
     }
-    if (from.has_repl_state()) {
-      set_repl_state(from.repl_state());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.send_bytes_per_sec_ = from._impl_.send_bytes_per_sec_;
     }
-    if (from.has_master()) {
-      mutable_master()->::client::Node::MergeFrom(from.master());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.since_last_send_ms_ = from._impl_.since_last_send_ms_;
     }
-    if (from.has_sync_offset()) {
-      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.unacked_records_ = from._impl_.unacked_records_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void PartitionState::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PartitionState::CopyFrom(const PartitionState& from) {
+void PartitionState_SlaveLag::CopyFrom(const PartitionState_SlaveLag& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.PartitionState.SlaveLag)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PartitionState::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000002f) != 0x0000002f) return false;
-
-  if (has_master()) {
-    if (!this->master().IsInitialized()) return false;
-  }
-  for (int i = 0; i < slaves_size(); i++) {
-    if (!this->slaves(i).IsInitialized()) return false;
-  }
-  if (has_sync_offset()) {
-    if (!this->sync_offset().IsInitialized()) return false;
+bool PartitionState_SlaveLag::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_node()) {
+    if (!_impl_.node_->IsInitialized()) return false;
   }
   return true;
 }
 
-void PartitionState::Swap(PartitionState* other) {
-  if (other != this) {
-    std::swap(partition_id_, other->partition_id_);
-    std::swap(role_, other->role_);
-    std::swap(repl_state_, other->repl_state_);
-    std::swap(master_, other->master_);
-    slaves_.Swap(&other->slaves_);
-    std::swap(sync_offset_, other->sync_offset_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void PartitionState_SlaveLag::InternalSwap(PartitionState_SlaveLag* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PartitionState_SlaveLag, _impl_.unacked_records_)
+      + sizeof(PartitionState_SlaveLag::_impl_.unacked_records_)
+      - PROTOBUF_FIELD_OFFSET(PartitionState_SlaveLag, _impl_.node_)>(
+          reinterpret_cast<char*>(&_impl_.node_),
+          reinterpret_cast<char*>(&other->_impl_.node_));
 }
 
-::google::protobuf::Metadata PartitionState::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PartitionState_descriptor_;
-  metadata.reflection = PartitionState_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata PartitionState_SlaveLag::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int CmdRequest_Sync::kNodeFieldNumber;
-const int CmdRequest_Sync::kTableNameFieldNumber;
-const int CmdRequest_Sync::kSyncOffsetFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_Sync::CmdRequest_Sync()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class PartitionState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PartitionState>()._impl_._has_bits_);
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_role(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_repl_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::Node& master(const PartitionState* msg);
+  static void set_has_master(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::client::SyncOffset& sync_offset(const PartitionState* msg);
+  static void set_has_sync_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_apply_lag_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_apply_lag_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000004f) ^ 0x0000004f) != 0;
+  }
+};
 
-void CmdRequest_Sync::InitAsDefaultInstance() {
-  node_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
-  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
+const ::client::Node&
+PartitionState::_Internal::master(const PartitionState* msg) {
+  return *msg->_impl_.master_;
 }
-
-CmdRequest_Sync::CmdRequest_Sync(const CmdRequest_Sync& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::client::SyncOffset&
+PartitionState::_Internal::sync_offset(const PartitionState* msg) {
+  return *msg->_impl_.sync_offset_;
 }
-
-void CmdRequest_Sync::SharedCtor() {
-  _cached_size_ = 0;
-  node_ = NULL;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  sync_offset_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+PartitionState::PartitionState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.PartitionState)
 }
-
-CmdRequest_Sync::~CmdRequest_Sync() {
-  SharedDtor();
+PartitionState::PartitionState(const PartitionState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PartitionState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slaves_){from._impl_.slaves_}
+    , decltype(_impl_.slave_lags_){from._impl_.slave_lags_}
+    , decltype(_impl_.role_){}
+    , decltype(_impl_.repl_state_){}
+    , decltype(_impl_.master_){nullptr}
+    , decltype(_impl_.sync_offset_){nullptr}
+    , decltype(_impl_.apply_lag_bytes_){}
+    , decltype(_impl_.apply_lag_ms_){}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.role_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.role_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_role()) {
+    _this->_impl_.role_.Set(from._internal_role(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.repl_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.repl_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_repl_state()) {
+    _this->_impl_.repl_state_.Set(from._internal_repl_state(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_master()) {
+    _this->_impl_.master_ = new ::client::Node(*from._impl_.master_);
+  }
+  if (from._internal_has_sync_offset()) {
+    _this->_impl_.sync_offset_ = new ::client::SyncOffset(*from._impl_.sync_offset_);
+  }
+  ::memcpy(&_impl_.apply_lag_bytes_, &from._impl_.apply_lag_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.partition_id_) -
+    reinterpret_cast<char*>(&_impl_.apply_lag_bytes_)) + sizeof(_impl_.partition_id_));
+  // @@protoc_insertion_point(copy_constructor:client.PartitionState)
+}
+
+inline void PartitionState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slaves_){arena}
+    , decltype(_impl_.slave_lags_){arena}
+    , decltype(_impl_.role_){}
+    , decltype(_impl_.repl_state_){}
+    , decltype(_impl_.master_){nullptr}
+    , decltype(_impl_.sync_offset_){nullptr}
+    , decltype(_impl_.apply_lag_bytes_){int64_t{0}}
+    , decltype(_impl_.apply_lag_ms_){int64_t{0}}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.role_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.role_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.repl_state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.repl_state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void CmdRequest_Sync::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (this != default_instance_) {
-    delete node_;
-    delete sync_offset_;
+PartitionState::~PartitionState() {
+  // @@protoc_insertion_point(destructor:client.PartitionState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void CmdRequest_Sync::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_Sync::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Sync_descriptor_;
+inline void PartitionState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slaves_.~RepeatedPtrField();
+  _impl_.slave_lags_.~RepeatedPtrField();
+  _impl_.role_.Destroy();
+  _impl_.repl_state_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.master_;
+  if (this != internal_default_instance()) delete _impl_.sync_offset_;
 }
 
-const CmdRequest_Sync& CmdRequest_Sync::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+void PartitionState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-CmdRequest_Sync* CmdRequest_Sync::default_instance_ = NULL;
+void PartitionState::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.PartitionState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slaves_.Clear();
+  _impl_.slave_lags_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.role_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.repl_state_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.master_ != nullptr);
+      _impl_.master_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.sync_offset_ != nullptr);
+      _impl_.sync_offset_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000070u) {
+    ::memset(&_impl_.apply_lag_bytes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.partition_id_) -
+        reinterpret_cast<char*>(&_impl_.apply_lag_bytes_)) + sizeof(_impl_.partition_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PartitionState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 partition_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string role = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_role();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.PartitionState.role");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string repl_state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_repl_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.PartitionState.repl_state");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.Node master = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_master(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.Node slaves = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slaves(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.SyncOffset sync_offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_offset(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.PartitionState.SlaveLag slave_lags = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slave_lags(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 apply_lag_bytes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_apply_lag_bytes(&has_bits);
+          _impl_.apply_lag_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 apply_lag_ms = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_apply_lag_ms(&has_bits);
+          _impl_.apply_lag_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PartitionState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.PartitionState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 partition_id = 1;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_partition_id(), target);
+  }
 
-CmdRequest_Sync* CmdRequest_Sync::New() const {
-  return new CmdRequest_Sync;
-}
+  // required string role = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_role().data(), static_cast<int>(this->_internal_role().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.PartitionState.role");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_role(), target);
+  }
 
-void CmdRequest_Sync::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_node()) {
-      if (node_ != NULL) node_->::client::Node::Clear();
-    }
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    if (has_sync_offset()) {
-      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-    }
+  // required string repl_state = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_repl_state().data(), static_cast<int>(this->_internal_repl_state().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.PartitionState.repl_state");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_repl_state(), target);
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
 
-bool CmdRequest_Sync::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .client.Node node = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_node()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_table_name;
-        break;
-      }
+  // required .client.Node master = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::master(this),
+        _Internal::master(this).GetCachedSize(), target, stream);
+  }
 
-      // required string table_name = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_table_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_sync_offset;
-        break;
-      }
+  // repeated .client.Node slaves = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slaves_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slaves(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
 
-      // required .client.SyncOffset sync_offset = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_offset()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+  // required .client.SyncOffset sync_offset = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::sync_offset(this),
+        _Internal::sync_offset(this).GetCachedSize(), target, stream);
   }
-  return true;
-#undef DO_
-}
 
-void CmdRequest_Sync::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .client.Node node = 1;
-  if (has_node()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->node(), output);
+  // repeated .client.PartitionState.SlaveLag slave_lags = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slave_lags_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slave_lags(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // required string table_name = 2;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->table_name(), output);
+  // optional int64 apply_lag_bytes = 8;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_apply_lag_bytes(), target);
   }
 
-  // required .client.SyncOffset sync_offset = 3;
-  if (has_sync_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->sync_offset(), output);
+  // optional int64 apply_lag_ms = 9;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_apply_lag_ms(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.PartitionState)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_Sync::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .client.Node node = 1;
-  if (has_node()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->node(), target);
+size_t PartitionState::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.PartitionState)
+  size_t total_size = 0;
+
+  if (_internal_has_role()) {
+    // required string role = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_role());
   }
 
-  // required string table_name = 2;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->table_name(), target);
+  if (_internal_has_repl_state()) {
+    // required string repl_state = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_repl_state());
   }
 
-  // required .client.SyncOffset sync_offset = 3;
-  if (has_sync_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->sync_offset(), target);
+  if (_internal_has_master()) {
+    // required .client.Node master = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_sync_offset()) {
+    // required .client.SyncOffset sync_offset = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
   }
-  return target;
+
+  if (_internal_has_partition_id()) {
+    // required int32 partition_id = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
+  }
+
+  return total_size;
 }
+size_t PartitionState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.PartitionState)
+  size_t total_size = 0;
 
-int CmdRequest_Sync::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x0000004f) ^ 0x0000004f) == 0) {  // All required fields are present.
+    // required string role = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_role());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .client.Node node = 1;
-    if (has_node()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->node());
-    }
+    // required string repl_state = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_repl_state());
 
-    // required string table_name = 2;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    // required .client.Node master = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_);
 
-    // required .client.SyncOffset sync_offset = 3;
-    if (has_sync_offset()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_offset());
-    }
+    // required .client.SyncOffset sync_offset = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
+
+    // required int32 partition_id = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  if (!unknown_fields().empty()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .client.Node slaves = 5;
+  total_size += 1UL * this->_internal_slaves_size();
+  for (const auto& msg : this->_impl_.slaves_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CmdRequest_Sync::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Sync* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Sync*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // repeated .client.PartitionState.SlaveLag slave_lags = 7;
+  total_size += 1UL * this->_internal_slave_lags_size();
+  for (const auto& msg : this->_impl_.slave_lags_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-}
 
-void CmdRequest_Sync::MergeFrom(const CmdRequest_Sync& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_node()) {
-      mutable_node()->::client::Node::MergeFrom(from.node());
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000030u) {
+    // optional int64 apply_lag_bytes = 8;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_apply_lag_bytes());
     }
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
-    }
-    if (from.has_sync_offset()) {
-      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
+
+    // optional int64 apply_lag_ms = 9;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_apply_lag_ms());
     }
+
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_Sync::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PartitionState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PartitionState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PartitionState::GetClassData() const { return &_class_data_; }
+
+
+void PartitionState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PartitionState*>(&to_msg);
+  auto& from = static_cast<const PartitionState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.PartitionState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slaves_.MergeFrom(from._impl_.slaves_);
+  _this->_impl_.slave_lags_.MergeFrom(from._impl_.slave_lags_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_role(from._internal_role());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_repl_state(from._internal_repl_state());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_master()->::client::Node::MergeFrom(
+          from._internal_master());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_sync_offset()->::client::SyncOffset::MergeFrom(
+          from._internal_sync_offset());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.apply_lag_bytes_ = from._impl_.apply_lag_bytes_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.apply_lag_ms_ = from._impl_.apply_lag_ms_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdRequest_Sync::CopyFrom(const CmdRequest_Sync& from) {
+void PartitionState::CopyFrom(const PartitionState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.PartitionState)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdRequest_Sync::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
-  if (has_node()) {
-    if (!this->node().IsInitialized()) return false;
+bool PartitionState::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.slaves_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.slave_lags_))
+    return false;
+  if (_internal_has_master()) {
+    if (!_impl_.master_->IsInitialized()) return false;
   }
-  if (has_sync_offset()) {
-    if (!this->sync_offset().IsInitialized()) return false;
+  if (_internal_has_sync_offset()) {
+    if (!_impl_.sync_offset_->IsInitialized()) return false;
   }
   return true;
 }
 
-void CmdRequest_Sync::Swap(CmdRequest_Sync* other) {
-  if (other != this) {
-    std::swap(node_, other->node_);
-    std::swap(table_name_, other->table_name_);
-    std::swap(sync_offset_, other->sync_offset_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata CmdRequest_Sync::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Sync_descriptor_;
-  metadata.reflection = CmdRequest_Sync_reflection_;
-  return metadata;
-}
-
-
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_Set::kTableNameFieldNumber;
-const int CmdRequest_Set::kKeyFieldNumber;
-const int CmdRequest_Set::kValueFieldNumber;
-const int CmdRequest_Set::kUuidFieldNumber;
-const int CmdRequest_Set::kExpireFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_Set::CmdRequest_Set()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void CmdRequest_Set::InitAsDefaultInstance() {
-  expire_ = const_cast< ::client::KeyExpire*>(&::client::KeyExpire::default_instance());
+void PartitionState::InternalSwap(PartitionState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.slaves_.InternalSwap(&other->_impl_.slaves_);
+  _impl_.slave_lags_.InternalSwap(&other->_impl_.slave_lags_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.role_, lhs_arena,
+      &other->_impl_.role_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.repl_state_, lhs_arena,
+      &other->_impl_.repl_state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PartitionState, _impl_.partition_id_)
+      + sizeof(PartitionState::_impl_.partition_id_)
+      - PROTOBUF_FIELD_OFFSET(PartitionState, _impl_.master_)>(
+          reinterpret_cast<char*>(&_impl_.master_),
+          reinterpret_cast<char*>(&other->_impl_.master_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PartitionState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[6]);
 }
 
-CmdRequest_Set::CmdRequest_Set(const CmdRequest_Set& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_Set::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  expire_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-CmdRequest_Set::~CmdRequest_Set() {
-  SharedDtor();
-}
+// ===================================================================
 
-void CmdRequest_Set::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+class CmdRequest_Sync::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Sync>()._impl_._has_bits_);
+  static const ::client::Node& node(const CmdRequest_Sync* msg);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+  static const ::client::SyncOffset& sync_offset(const CmdRequest_Sync* msg);
+  static void set_has_sync_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
+  static void set_has_repl_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  if (this != default_instance_) {
-    delete expire_;
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000d) ^ 0x0000000d) != 0;
   }
-}
+};
 
-void CmdRequest_Set::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::client::Node&
+CmdRequest_Sync::_Internal::node(const CmdRequest_Sync* msg) {
+  return *msg->_impl_.node_;
 }
-const ::google::protobuf::Descriptor* CmdRequest_Set::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Set_descriptor_;
+const ::client::SyncOffset&
+CmdRequest_Sync::_Internal::sync_offset(const CmdRequest_Sync* msg) {
+  return *msg->_impl_.sync_offset_;
+}
+CmdRequest_Sync::CmdRequest_Sync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Sync)
+}
+CmdRequest_Sync::CmdRequest_Sync(const CmdRequest_Sync& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Sync* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.repl_id_){}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.sync_offset_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.repl_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_repl_id()) {
+    _this->_impl_.repl_id_.Set(from._internal_repl_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::client::Node(*from._impl_.node_);
+  }
+  if (from._internal_has_sync_offset()) {
+    _this->_impl_.sync_offset_ = new ::client::SyncOffset(*from._impl_.sync_offset_);
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Sync)
+}
+
+inline void CmdRequest_Sync::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.repl_id_){}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.sync_offset_){nullptr}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.repl_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const CmdRequest_Set& CmdRequest_Set::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+CmdRequest_Sync::~CmdRequest_Sync() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Sync)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-CmdRequest_Set* CmdRequest_Set::default_instance_ = NULL;
+inline void CmdRequest_Sync::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+  _impl_.repl_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.node_;
+  if (this != internal_default_instance()) delete _impl_.sync_offset_;
+}
 
-CmdRequest_Set* CmdRequest_Set::New() const {
-  return new CmdRequest_Set;
+void CmdRequest_Sync::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void CmdRequest_Set::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
+void CmdRequest_Sync::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Sync)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
     }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.repl_id_.ClearNonDefaultToEmpty();
     }
-    if (has_uuid()) {
-      if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-        uuid_->clear();
-      }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.node_ != nullptr);
+      _impl_.node_->Clear();
     }
-    if (has_expire()) {
-      if (expire_ != NULL) expire_->::client::KeyExpire::Clear();
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.sync_offset_ != nullptr);
+      _impl_.sync_offset_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool CmdRequest_Set::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_key;
-        break;
-      }
+const char* CmdRequest_Sync::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .client.Node node = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string table_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Sync.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.SyncOffset sync_offset = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_offset(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string repl_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_repl_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Sync.repl_id");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Sync::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Sync)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .client.Node node = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
+  }
 
-      // required string key = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_key:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_key()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->key().data(), this->key().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_value;
-        break;
-      }
+  // required string table_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Sync.table_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_table_name(), target);
+  }
 
-      // required bytes value = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_uuid;
-        break;
-      }
+  // required .client.SyncOffset sync_offset = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::sync_offset(this),
+        _Internal::sync_offset(this).GetCachedSize(), target, stream);
+  }
 
-      // optional string uuid = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_uuid:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->uuid().data(), this->uuid().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_expire;
-        break;
-      }
+  // optional string repl_id = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_repl_id().data(), static_cast<int>(this->_internal_repl_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Sync.repl_id");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_repl_id(), target);
+  }
 
-      // optional .client.KeyExpire expire = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_expire:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_expire()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  return true;
-#undef DO_
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Sync)
+  return target;
 }
 
-void CmdRequest_Set::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+size_t CmdRequest_Sync::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Sync)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
 
-  // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->key(), output);
+  if (_internal_has_node()) {
+    // required .client.Node node = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
   }
 
-  // required bytes value = 3;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      3, this->value(), output);
+  if (_internal_has_sync_offset()) {
+    // required .client.SyncOffset sync_offset = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
   }
 
-  // optional string uuid = 4;
-  if (has_uuid()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->uuid().data(), this->uuid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->uuid(), output);
+  return total_size;
+}
+size_t CmdRequest_Sync::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Sync)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000d) ^ 0x0000000d) == 0) {  // All required fields are present.
+    // required string table_name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required .client.Node node = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
+
+    // required .client.SyncOffset sync_offset = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional .client.KeyExpire expire = 5;
-  if (has_expire()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->expire(), output);
+  // optional string repl_id = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_repl_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Sync::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Sync::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Sync::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Sync::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Sync*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Sync&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Sync)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_repl_id(from._internal_repl_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_node()->::client::Node::MergeFrom(
+          from._internal_node());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_sync_offset()->::client::SyncOffset::MergeFrom(
+          from._internal_sync_offset());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdRequest_Sync::CopyFrom(const CmdRequest_Sync& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Sync)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest_Sync::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_node()) {
+    if (!_impl_.node_->IsInitialized()) return false;
+  }
+  if (_internal_has_sync_offset()) {
+    if (!_impl_.sync_offset_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdRequest_Sync::InternalSwap(CmdRequest_Sync* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.repl_id_, lhs_arena,
+      &other->_impl_.repl_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest_Sync, _impl_.sync_offset_)
+      + sizeof(CmdRequest_Sync::_impl_.sync_offset_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest_Sync, _impl_.node_)>(
+          reinterpret_cast<char*>(&_impl_.node_),
+          reinterpret_cast<char*>(&other->_impl_.node_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Sync::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[7]);
+}
+
+// ===================================================================
+
+class CmdRequest_Set::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Set>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_uuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::client::KeyExpire& expire(const CmdRequest_Set* msg);
+  static void set_has_expire(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
   }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::client::KeyExpire&
+CmdRequest_Set::_Internal::expire(const CmdRequest_Set* msg) {
+  return *msg->_impl_.expire_;
+}
+CmdRequest_Set::CmdRequest_Set(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Set)
+}
+CmdRequest_Set::CmdRequest_Set(const CmdRequest_Set& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Set* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.expire_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uuid()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_expire()) {
+    _this->_impl_.expire_ = new ::client::KeyExpire(*from._impl_.expire_);
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Set)
+}
+
+inline void CmdRequest_Set::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.expire_){nullptr}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_Set::~CmdRequest_Set() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Set)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CmdRequest_Set::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.uuid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.expire_;
+}
+
+void CmdRequest_Set::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest_Set::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Set)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.uuid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.expire_ != nullptr);
+      _impl_.expire_->Clear();
+    }
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-::google::protobuf::uint8* CmdRequest_Set::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+const char* CmdRequest_Set::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Set.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Set.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string uuid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Set.uuid");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.KeyExpire expire = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_expire(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Set::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Set)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Set.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->key(), target);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Set.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
   }
 
   // required bytes value = 3;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->value(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
   }
 
   // optional string uuid = 4;
-  if (has_uuid()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->uuid().data(), this->uuid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->uuid(), target);
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Set.uuid");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_uuid(), target);
   }
 
   // optional .client.KeyExpire expire = 5;
-  if (has_expire()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->expire(), target);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::expire(this),
+        _Internal::expire(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Set)
   return target;
 }
 
-int CmdRequest_Set::ByteSize() const {
-  int total_size = 0;
+size_t CmdRequest_Set::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Set)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_table_name()) {
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
 
+  if (_internal_has_key()) {
     // required string key = 2;
-    if (has_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->key());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
 
+  if (_internal_has_value()) {
     // required bytes value = 3;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return total_size;
+}
+size_t CmdRequest_Set::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Set)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+    // required bytes value = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000018u) {
     // optional string uuid = 4;
-    if (has_uuid()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->uuid());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uuid());
     }
 
     // optional .client.KeyExpire expire = 5;
-    if (has_expire()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->expire());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.expire_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_Set::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Set* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Set*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Set::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Set::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Set::GetClassData() const { return &_class_data_; }
 
-void CmdRequest_Set::MergeFrom(const CmdRequest_Set& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+
+void CmdRequest_Set::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Set*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Set&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Set)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_key()) {
-      set_key(from.key());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_value(from._internal_value());
     }
-    if (from.has_uuid()) {
-      set_uuid(from.uuid());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_uuid(from._internal_uuid());
     }
-    if (from.has_expire()) {
-      mutable_expire()->::client::KeyExpire::MergeFrom(from.expire());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_expire()->::client::KeyExpire::MergeFrom(
+          from._internal_expire());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_Set::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_Set::CopyFrom(const CmdRequest_Set& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Set)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_Set::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
-  if (has_expire()) {
-    if (!this->expire().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_expire()) {
+    if (!_impl_.expire_->IsInitialized()) return false;
   }
   return true;
 }
 
-void CmdRequest_Set::Swap(CmdRequest_Set* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(key_, other->key_);
-    std::swap(value_, other->value_);
-    std::swap(uuid_, other->uuid_);
-    std::swap(expire_, other->expire_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata CmdRequest_Set::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Set_descriptor_;
-  metadata.reflection = CmdRequest_Set_reflection_;
-  return metadata;
+void CmdRequest_Set::InternalSwap(CmdRequest_Set* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  swap(_impl_.expire_, other->_impl_.expire_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Set::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[8]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_Get::kTableNameFieldNumber;
-const int CmdRequest_Get::kKeyFieldNumber;
-const int CmdRequest_Get::kUuidFieldNumber;
-#endif  // !_MSC_VER
+class CmdRequest_Get::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Get>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_uuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::client::ReadStaleness& staleness(const CmdRequest_Get* msg);
+  static void set_has_staleness(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-CmdRequest_Get::CmdRequest_Get()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::client::ReadStaleness&
+CmdRequest_Get::_Internal::staleness(const CmdRequest_Get* msg) {
+  return *msg->_impl_.staleness_;
 }
-
-void CmdRequest_Get::InitAsDefaultInstance() {
+CmdRequest_Get::CmdRequest_Get(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Get)
 }
-
 CmdRequest_Get::CmdRequest_Get(const CmdRequest_Get& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_Get::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Get* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.staleness_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uuid()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_staleness()) {
+    _this->_impl_.staleness_ = new ::client::ReadStaleness(*from._impl_.staleness_);
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Get)
+}
+
+inline void CmdRequest_Get::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.staleness_){nullptr}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdRequest_Get::~CmdRequest_Get() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Get)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdRequest_Get::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdRequest_Get::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.uuid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.staleness_;
 }
 
 void CmdRequest_Get::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_Get::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Get_descriptor_;
-}
-
-const CmdRequest_Get& CmdRequest_Get::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
-
-CmdRequest_Get* CmdRequest_Get::default_instance_ = NULL;
-
-CmdRequest_Get* CmdRequest_Get::New() const {
-  return new CmdRequest_Get;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdRequest_Get::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Get)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
     }
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
     }
-    if (has_uuid()) {
-      if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-        uuid_->clear();
-      }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.uuid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.staleness_ != nullptr);
+      _impl_.staleness_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool CmdRequest_Get::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* CmdRequest_Get::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_key;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Get.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string key = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_key:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_key()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->key().data(), this->key().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_uuid;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Get.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string uuid = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_uuid:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->uuid().data(), this->uuid().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest_Get::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Get.uuid");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.ReadStaleness staleness = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_staleness(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Get::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Get)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Get.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->key(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Get.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
   }
 
   // optional string uuid = 3;
-  if (has_uuid()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->uuid().data(), this->uuid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->uuid(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Get.uuid");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_uuid(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional .client.ReadStaleness staleness = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::staleness(this),
+        _Internal::staleness(this).GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* CmdRequest_Get::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Get)
+  return target;
+}
 
-  // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->key(), target);
-  }
+size_t CmdRequest_Get::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Get)
+  size_t total_size = 0;
 
-  // optional string uuid = 3;
-  if (has_uuid()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->uuid().data(), this->uuid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->uuid(), target);
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_key()) {
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
-  return target;
-}
 
-int CmdRequest_Get::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t CmdRequest_Get::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Get)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
 
     // required string key = 2;
-    if (has_key()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional string uuid = 3;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->key());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uuid());
     }
 
-    // optional string uuid = 3;
-    if (has_uuid()) {
+    // optional .client.ReadStaleness staleness = 4;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->uuid());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.staleness_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_Get::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Get* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Get*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Get::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Get::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Get::GetClassData() const { return &_class_data_; }
+
 
-void CmdRequest_Get::MergeFrom(const CmdRequest_Get& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+void CmdRequest_Get::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Get*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Get&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Get)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_key()) {
-      set_key(from.key());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_uuid(from._internal_uuid());
     }
-    if (from.has_uuid()) {
-      set_uuid(from.uuid());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_staleness()->::client::ReadStaleness::MergeFrom(
+          from._internal_staleness());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_Get::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_Get::CopyFrom(const CmdRequest_Get& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Get)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_Get::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_Get::Swap(CmdRequest_Get* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(key_, other->key_);
-    std::swap(uuid_, other->uuid_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata CmdRequest_Get::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Get_descriptor_;
-  metadata.reflection = CmdRequest_Get_reflection_;
-  return metadata;
+void CmdRequest_Get::InternalSwap(CmdRequest_Get* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  swap(_impl_.staleness_, other->_impl_.staleness_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Get::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[9]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_Del::kTableNameFieldNumber;
-const int CmdRequest_Del::kKeyFieldNumber;
-const int CmdRequest_Del::kUuidFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_Del::CmdRequest_Del()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdRequest_Del::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Del>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_uuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void CmdRequest_Del::InitAsDefaultInstance() {
+CmdRequest_Del::CmdRequest_Del(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Del)
 }
-
 CmdRequest_Del::CmdRequest_Del(const CmdRequest_Del& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_Del::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Del* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.uuid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uuid()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Del)
+}
+
+inline void CmdRequest_Del::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.uuid_){}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdRequest_Del::~CmdRequest_Del() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Del)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdRequest_Del::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdRequest_Del::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.uuid_.Destroy();
 }
 
 void CmdRequest_Del::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_Del::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Del_descriptor_;
-}
-
-const CmdRequest_Del& CmdRequest_Del::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
-
-CmdRequest_Del* CmdRequest_Del::default_instance_ = NULL;
-
-CmdRequest_Del* CmdRequest_Del::New() const {
-  return new CmdRequest_Del;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdRequest_Del::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Del)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
     }
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
     }
-    if (has_uuid()) {
-      if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-        uuid_->clear();
-      }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.uuid_.ClearNonDefaultToEmpty();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool CmdRequest_Del::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* CmdRequest_Del::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_key;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Del.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string key = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_key:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_key()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->key().data(), this->key().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_uuid;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Del.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string uuid = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_uuid:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->uuid().data(), this->uuid().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest_Del::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Del.uuid");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Del::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Del)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Del.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->key(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Del.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
   }
 
   // optional string uuid = 3;
-  if (has_uuid()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->uuid().data(), this->uuid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->uuid(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Del.uuid");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_uuid(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Del)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_Del::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
-  }
+size_t CmdRequest_Del::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Del)
+  size_t total_size = 0;
 
-  // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->key(), target);
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
 
-  // optional string uuid = 3;
-  if (has_uuid()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->uuid().data(), this->uuid().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->uuid(), target);
+  if (_internal_has_key()) {
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t CmdRequest_Del::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Del)
+  size_t total_size = 0;
 
-int CmdRequest_Del::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
 
     // required string key = 2;
-    if (has_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->key());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
 
-    // optional string uuid = 3;
-    if (has_uuid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->uuid());
-    }
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  // optional string uuid = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CmdRequest_Del::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Del* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Del*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_Del::MergeFrom(const CmdRequest_Del& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Del::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Del::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Del::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Del::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Del*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Del&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Del)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_key()) {
-      set_key(from.key());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_uuid()) {
-      set_uuid(from.uuid());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_uuid(from._internal_uuid());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_Del::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_Del::CopyFrom(const CmdRequest_Del& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Del)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_Del::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_Del::Swap(CmdRequest_Del* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(key_, other->key_);
-    std::swap(uuid_, other->uuid_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata CmdRequest_Del::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Del_descriptor_;
-  metadata.reflection = CmdRequest_Del_reflection_;
-  return metadata;
+void CmdRequest_Del::InternalSwap(CmdRequest_Del* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Del::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[10]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_Info::kTableNameFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_Info::CmdRequest_Info()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdRequest_Info::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Info>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void CmdRequest_Info::InitAsDefaultInstance() {
+CmdRequest_Info::CmdRequest_Info(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Info)
 }
-
 CmdRequest_Info::CmdRequest_Info(const CmdRequest_Info& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_Info::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Info* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Info)
+}
+
+inline void CmdRequest_Info::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdRequest_Info::~CmdRequest_Info() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Info)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdRequest_Info::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdRequest_Info::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
 }
 
 void CmdRequest_Info::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_Info::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Info_descriptor_;
-}
-
-const CmdRequest_Info& CmdRequest_Info::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
-
-CmdRequest_Info* CmdRequest_Info::default_instance_ = NULL;
-
-CmdRequest_Info* CmdRequest_Info::New() const {
-  return new CmdRequest_Info;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdRequest_Info::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdRequest_Info::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Info)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_Info::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest_Info::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Info.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Info::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Info)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Info.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Info)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_Info::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t CmdRequest_Info::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Info)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // optional string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int CmdRequest_Info::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Info::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Info::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Info::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CmdRequest_Info::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Info* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Info*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void CmdRequest_Info::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Info*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Info&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Info)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void CmdRequest_Info::MergeFrom(const CmdRequest_Info& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
-    }
+  if (from._internal_has_table_name()) {
+    _this->_internal_set_table_name(from._internal_table_name());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_Info::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_Info::CopyFrom(const CmdRequest_Info& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Info)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_Info::IsInitialized() const {
-
   return true;
 }
 
-void CmdRequest_Info::Swap(CmdRequest_Info* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_Info::InternalSwap(CmdRequest_Info* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata CmdRequest_Info::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Info_descriptor_;
-  metadata.reflection = CmdRequest_Info_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Info::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[11]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_Mget::kTableNameFieldNumber;
-const int CmdRequest_Mget::kKeysFieldNumber;
-#endif  // !_MSC_VER
+class CmdRequest_Mget::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Mget>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::client::ReadStaleness& staleness(const CmdRequest_Mget* msg);
+  static void set_has_staleness(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-CmdRequest_Mget::CmdRequest_Mget()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::client::ReadStaleness&
+CmdRequest_Mget::_Internal::staleness(const CmdRequest_Mget* msg) {
+  return *msg->_impl_.staleness_;
 }
-
-void CmdRequest_Mget::InitAsDefaultInstance() {
+CmdRequest_Mget::CmdRequest_Mget(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Mget)
 }
-
 CmdRequest_Mget::CmdRequest_Mget(const CmdRequest_Mget& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_Mget::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Mget* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.staleness_){nullptr}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_staleness()) {
+    _this->_impl_.staleness_ = new ::client::ReadStaleness(*from._impl_.staleness_);
+  }
+  _this->_impl_.partition_id_ = from._impl_.partition_id_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Mget)
+}
+
+inline void CmdRequest_Mget::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.staleness_){nullptr}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdRequest_Mget::~CmdRequest_Mget() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Mget)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdRequest_Mget::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdRequest_Mget::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.table_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.staleness_;
 }
 
 void CmdRequest_Mget::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_Mget::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Mget_descriptor_;
-}
-
-const CmdRequest_Mget& CmdRequest_Mget::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
-
-CmdRequest_Mget* CmdRequest_Mget::default_instance_ = NULL;
-
-CmdRequest_Mget* CmdRequest_Mget::New() const {
-  return new CmdRequest_Mget;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdRequest_Mget::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-  }
-  keys_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdRequest_Mget::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Mget)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.staleness_ != nullptr);
+      _impl_.staleness_->Clear();
+    }
+  }
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_Mget::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_keys;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Mget.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated string keys = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_keys:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_keys()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->keys(this->keys_size() - 1).data(),
-            this->keys(this->keys_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_keys;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest_Mget::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "client.CmdRequest.Mget.keys");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.ReadStaleness staleness = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_staleness(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 partition_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Mget::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Mget)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Mget.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // repeated string keys = 2;
-  for (int i = 0; i < this->keys_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->keys(i).data(), this->keys(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->keys(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Mget.keys");
+    target = stream->WriteString(2, s, target);
   }
-}
 
-::google::protobuf::uint8* CmdRequest_Mget::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  // optional .client.ReadStaleness staleness = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::staleness(this),
+        _Internal::staleness(this).GetCachedSize(), target, stream);
   }
 
-  // repeated string keys = 2;
-  for (int i = 0; i < this->keys_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->keys(i).data(), this->keys(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(2, this->keys(i), target);
+  // optional int32 partition_id = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_partition_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Mget)
   return target;
 }
 
-int CmdRequest_Mget::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+size_t CmdRequest_Mget::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Mget)
+  size_t total_size = 0;
 
+  // required string table_name = 1;
+  if (_internal_has_table_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated string keys = 2;
-  total_size += 1 * this->keys_size();
-  for (int i = 0; i < this->keys_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->keys(i));
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional .client.ReadStaleness staleness = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.staleness_);
+    }
+
+    // optional int32 partition_id = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
+    }
 
-void CmdRequest_Mget::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Mget* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Mget*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_Mget::MergeFrom(const CmdRequest_Mget& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  keys_.MergeFrom(from.keys_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Mget::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Mget::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Mget::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Mget::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Mget*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Mget&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Mget)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_staleness()->::client::ReadStaleness::MergeFrom(
+          from._internal_staleness());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_Mget::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_Mget::CopyFrom(const CmdRequest_Mget& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Mget)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_Mget::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_Mget::Swap(CmdRequest_Mget* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    keys_.Swap(&other->keys_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_Mget::InternalSwap(CmdRequest_Mget* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest_Mget, _impl_.partition_id_)
+      + sizeof(CmdRequest_Mget::_impl_.partition_id_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest_Mget, _impl_.staleness_)>(
+          reinterpret_cast<char*>(&_impl_.staleness_),
+          reinterpret_cast<char*>(&other->_impl_.staleness_));
 }
 
-::google::protobuf::Metadata CmdRequest_Mget::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Mget_descriptor_;
-  metadata.reflection = CmdRequest_Mget_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Mget::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[12]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest::kTypeFieldNumber;
-const int CmdRequest::kSyncFieldNumber;
-const int CmdRequest::kSetFieldNumber;
-const int CmdRequest::kGetFieldNumber;
-const int CmdRequest::kDelFieldNumber;
-const int CmdRequest::kInfoFieldNumber;
-const int CmdRequest::kMgetFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest::CmdRequest()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+class CmdRequest_Msync::_Internal {
+ public:
+};
+
+CmdRequest_Msync::CmdRequest_Msync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Msync)
+}
+CmdRequest_Msync::CmdRequest_Msync(const CmdRequest_Msync& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Msync* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.syncs_){from._impl_.syncs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Msync)
+}
+
+inline void CmdRequest_Msync::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.syncs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void CmdRequest::InitAsDefaultInstance() {
-  sync_ = const_cast< ::client::CmdRequest_Sync*>(&::client::CmdRequest_Sync::default_instance());
-  set_ = const_cast< ::client::CmdRequest_Set*>(&::client::CmdRequest_Set::default_instance());
-  get_ = const_cast< ::client::CmdRequest_Get*>(&::client::CmdRequest_Get::default_instance());
-  del_ = const_cast< ::client::CmdRequest_Del*>(&::client::CmdRequest_Del::default_instance());
-  info_ = const_cast< ::client::CmdRequest_Info*>(&::client::CmdRequest_Info::default_instance());
-  mget_ = const_cast< ::client::CmdRequest_Mget*>(&::client::CmdRequest_Mget::default_instance());
+CmdRequest_Msync::~CmdRequest_Msync() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Msync)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-CmdRequest::CmdRequest(const CmdRequest& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+inline void CmdRequest_Msync::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.syncs_.~RepeatedPtrField();
+}
+
+void CmdRequest_Msync::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest_Msync::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Msync)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.syncs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_Msync::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .client.CmdRequest.Sync syncs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_syncs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Msync::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Msync)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .client.CmdRequest.Sync syncs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_syncs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_syncs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Msync)
+  return target;
 }
 
-void CmdRequest::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  sync_ = NULL;
-  set_ = NULL;
-  get_ = NULL;
-  del_ = NULL;
-  info_ = NULL;
-  mget_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+size_t CmdRequest_Msync::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Msync)
+  size_t total_size = 0;
 
-CmdRequest::~CmdRequest() {
-  SharedDtor();
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void CmdRequest::SharedDtor() {
-  if (this != default_instance_) {
-    delete sync_;
-    delete set_;
-    delete get_;
-    delete del_;
-    delete info_;
-    delete mget_;
+  // repeated .client.CmdRequest.Sync syncs = 1;
+  total_size += 1UL * this->_internal_syncs_size();
+  for (const auto& msg : this->_impl_.syncs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-}
 
-void CmdRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_descriptor_;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const CmdRequest& CmdRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Msync::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Msync::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Msync::GetClassData() const { return &_class_data_; }
 
-CmdRequest* CmdRequest::default_instance_ = NULL;
 
-CmdRequest* CmdRequest::New() const {
-  return new CmdRequest;
-}
+void CmdRequest_Msync::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Msync*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Msync&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Msync)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void CmdRequest::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_sync()) {
-      if (sync_ != NULL) sync_->::client::CmdRequest_Sync::Clear();
-    }
-    if (has_set()) {
-      if (set_ != NULL) set_->::client::CmdRequest_Set::Clear();
-    }
-    if (has_get()) {
-      if (get_ != NULL) get_->::client::CmdRequest_Get::Clear();
-    }
-    if (has_del()) {
-      if (del_ != NULL) del_->::client::CmdRequest_Del::Clear();
-    }
-    if (has_info()) {
-      if (info_ != NULL) info_->::client::CmdRequest_Info::Clear();
-    }
-    if (has_mget()) {
-      if (mget_ != NULL) mget_->::client::CmdRequest_Mget::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_impl_.syncs_.MergeFrom(from._impl_.syncs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-bool CmdRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .client.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::Type_IsValid(value)) {
-            set_type(static_cast< ::client::Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_sync;
-        break;
-      }
-
-      // optional .client.CmdRequest.Sync sync = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_set;
-        break;
-      }
-
-      // optional .client.CmdRequest.Set set = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_set:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_set()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_get;
-        break;
-      }
-
-      // optional .client.CmdRequest.Get get = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_get:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_get()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_del;
-        break;
-      }
-
-      // optional .client.CmdRequest.Del del = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_del:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_del()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_info;
-        break;
-      }
-
-      // optional .client.CmdRequest.Info info = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_info()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_mget;
-        break;
-      }
+void CmdRequest_Msync::CopyFrom(const CmdRequest_Msync& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Msync)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // optional .client.CmdRequest.Mget mget = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_mget:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_mget()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
+bool CmdRequest_Msync::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.syncs_))
+    return false;
   return true;
-#undef DO_
 }
 
-void CmdRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
-
-  // optional .client.CmdRequest.Sync sync = 2;
-  if (has_sync()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->sync(), output);
-  }
-
-  // optional .client.CmdRequest.Set set = 3;
-  if (has_set()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->set(), output);
-  }
-
-  // optional .client.CmdRequest.Get get = 4;
-  if (has_get()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->get(), output);
-  }
+void CmdRequest_Msync::InternalSwap(CmdRequest_Msync* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.syncs_.InternalSwap(&other->_impl_.syncs_);
+}
 
-  // optional .client.CmdRequest.Del del = 5;
-  if (has_del()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->del(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Msync::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[13]);
+}
 
-  // optional .client.CmdRequest.Info info = 6;
-  if (has_info()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->info(), output);
-  }
+// ===================================================================
 
-  // optional .client.CmdRequest.Mget mget = 7;
-  if (has_mget()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->mget(), output);
+class CmdRequest_Subscribe::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Subscribe>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_max_records(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CmdRequest_Subscribe::CmdRequest_Subscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Subscribe)
+}
+CmdRequest_Subscribe::CmdRequest_Subscribe(const CmdRequest_Subscribe& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Subscribe* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cursors_){from._impl_.cursors_}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_prefix_){}
+    , decltype(_impl_.max_records_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key_prefix()) {
+    _this->_impl_.key_prefix_.Set(from._internal_key_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.max_records_ = from._impl_.max_records_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Subscribe)
+}
+
+inline void CmdRequest_Subscribe::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cursors_){arena}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_prefix_){}
+    , decltype(_impl_.max_records_){1000}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_Subscribe::~CmdRequest_Subscribe() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Subscribe)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+inline void CmdRequest_Subscribe::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cursors_.~RepeatedPtrField();
+  _impl_.table_name_.Destroy();
+  _impl_.key_prefix_.Destroy();
 }
 
-::google::protobuf::uint8* CmdRequest::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
+void CmdRequest_Subscribe::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  // optional .client.CmdRequest.Sync sync = 2;
-  if (has_sync()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->sync(), target);
-  }
+void CmdRequest_Subscribe::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Subscribe)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional .client.CmdRequest.Set set = 3;
-  if (has_set()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->set(), target);
+  _impl_.cursors_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_prefix_.ClearNonDefaultToEmpty();
+    }
+    _impl_.max_records_ = 1000;
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-  // optional .client.CmdRequest.Get get = 4;
-  if (has_get()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->get(), target);
+const char* CmdRequest_Subscribe::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Subscribe.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.SyncOffset cursors = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_cursors(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes key_prefix = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_records = 4 [default = 1000];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_max_records(&has_bits);
+          _impl_.max_records_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Subscribe::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Subscribe)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Subscribe.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
-  // optional .client.CmdRequest.Del del = 5;
-  if (has_del()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->del(), target);
+  // repeated .client.SyncOffset cursors = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_cursors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_cursors(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional .client.CmdRequest.Info info = 6;
-  if (has_info()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->info(), target);
+  // optional bytes key_prefix = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key_prefix(), target);
   }
 
-  // optional .client.CmdRequest.Mget mget = 7;
-  if (has_mget()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->mget(), target);
+  // optional int32 max_records = 4 [default = 1000];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_records(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Subscribe)
   return target;
 }
 
-int CmdRequest::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .client.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-
-    // optional .client.CmdRequest.Sync sync = 2;
-    if (has_sync()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync());
-    }
-
-    // optional .client.CmdRequest.Set set = 3;
-    if (has_set()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->set());
-    }
-
-    // optional .client.CmdRequest.Get get = 4;
-    if (has_get()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->get());
-    }
+size_t CmdRequest_Subscribe::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Subscribe)
+  size_t total_size = 0;
 
-    // optional .client.CmdRequest.Del del = 5;
-    if (has_del()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->del());
-    }
+  // required string table_name = 1;
+  if (_internal_has_table_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .client.SyncOffset cursors = 2;
+  total_size += 1UL * this->_internal_cursors_size();
+  for (const auto& msg : this->_impl_.cursors_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-    // optional .client.CmdRequest.Info info = 6;
-    if (has_info()) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional bytes key_prefix = 3;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->info());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_key_prefix());
     }
 
-    // optional .client.CmdRequest.Mget mget = 7;
-    if (has_mget()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->mget());
+    // optional int32 max_records = 4 [default = 1000];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_records());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Subscribe::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Subscribe::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Subscribe::GetClassData() const { return &_class_data_; }
 
-void CmdRequest::MergeFrom(const CmdRequest& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_sync()) {
-      mutable_sync()->::client::CmdRequest_Sync::MergeFrom(from.sync());
-    }
-    if (from.has_set()) {
-      mutable_set()->::client::CmdRequest_Set::MergeFrom(from.set());
-    }
-    if (from.has_get()) {
-      mutable_get()->::client::CmdRequest_Get::MergeFrom(from.get());
-    }
-    if (from.has_del()) {
-      mutable_del()->::client::CmdRequest_Del::MergeFrom(from.del());
+
+void CmdRequest_Subscribe::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Subscribe*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Subscribe&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Subscribe)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cursors_.MergeFrom(from._impl_.cursors_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_info()) {
-      mutable_info()->::client::CmdRequest_Info::MergeFrom(from.info());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key_prefix(from._internal_key_prefix());
     }
-    if (from.has_mget()) {
-      mutable_mget()->::client::CmdRequest_Mget::MergeFrom(from.mget());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_records_ = from._impl_.max_records_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Subscribe::CopyFrom(const CmdRequest_Subscribe& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Subscribe)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdRequest::CopyFrom(const CmdRequest& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool CmdRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_sync()) {
-    if (!this->sync().IsInitialized()) return false;
-  }
-  if (has_set()) {
-    if (!this->set().IsInitialized()) return false;
-  }
-  if (has_get()) {
-    if (!this->get().IsInitialized()) return false;
-  }
-  if (has_del()) {
-    if (!this->del().IsInitialized()) return false;
-  }
-  if (has_mget()) {
-    if (!this->mget().IsInitialized()) return false;
-  }
+bool CmdRequest_Subscribe::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.cursors_))
+    return false;
   return true;
 }
 
-void CmdRequest::Swap(CmdRequest* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(sync_, other->sync_);
-    std::swap(set_, other->set_);
-    std::swap(get_, other->get_);
-    std::swap(del_, other->del_);
-    std::swap(info_, other->info_);
-    std::swap(mget_, other->mget_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_Subscribe::InternalSwap(CmdRequest_Subscribe* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.cursors_.InternalSwap(&other->_impl_.cursors_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_prefix_, lhs_arena,
+      &other->_impl_.key_prefix_, rhs_arena
+  );
+  swap(_impl_.max_records_, other->_impl_.max_records_);
 }
 
-::google::protobuf::Metadata CmdRequest::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_descriptor_;
-  metadata.reflection = CmdRequest_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Subscribe::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[14]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int CmdResponse_Sync::kTableNameFieldNumber;
-const int CmdResponse_Sync::kSyncOffsetFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_Sync::CmdResponse_Sync()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void CmdResponse_Sync::InitAsDefaultInstance() {
-  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
-}
-
-CmdResponse_Sync::CmdResponse_Sync(const CmdResponse_Sync& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdResponse_Sync::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  sync_offset_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-CmdResponse_Sync::~CmdResponse_Sync() {
-  SharedDtor();
-}
-
-void CmdResponse_Sync::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (this != default_instance_) {
-    delete sync_offset_;
+class CmdRequest_Mset_Kv::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Mset_Kv>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CmdRequest_Mset_Kv::CmdRequest_Mset_Kv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Mset.Kv)
+}
+CmdRequest_Mset_Kv::CmdRequest_Mset_Kv(const CmdRequest_Mset_Kv& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Mset_Kv* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Mset.Kv)
+}
+
+inline void CmdRequest_Mset_Kv::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_Mset_Kv::~CmdRequest_Mset_Kv() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Mset.Kv)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void CmdResponse_Sync::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_Sync::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Sync_descriptor_;
+inline void CmdRequest_Mset_Kv::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-const CmdResponse_Sync& CmdResponse_Sync::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+void CmdRequest_Mset_Kv::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-CmdResponse_Sync* CmdResponse_Sync::default_instance_ = NULL;
-
-CmdResponse_Sync* CmdResponse_Sync::New() const {
-  return new CmdResponse_Sync;
-}
+void CmdRequest_Mset_Kv::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Mset.Kv)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void CmdResponse_Sync::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    if (has_sync_offset()) {
-      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
     }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdResponse_Sync::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_sync_offset;
-        break;
-      }
-
-      // required .client.SyncOffset sync_offset = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_offset()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
     }
   }
-  return true;
-#undef DO_
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_Sync::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+const char* CmdRequest_Mset_Kv::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Mset.Kv.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Mset_Kv::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Mset.Kv)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Mset.Kv.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
   }
 
-  // required .client.SyncOffset sync_offset = 2;
-  if (has_sync_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->sync_offset(), output);
+  // required bytes value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Mset.Kv)
+  return target;
 }
 
-::google::protobuf::uint8* CmdResponse_Sync::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
-  }
+size_t CmdRequest_Mset_Kv::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Mset.Kv)
+  size_t total_size = 0;
 
-  // required .client.SyncOffset sync_offset = 2;
-  if (has_sync_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->sync_offset(), target);
+  if (_internal_has_key()) {
+    // required string key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_value()) {
+    // required bytes value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
-  return target;
-}
-
-int CmdResponse_Sync::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
 
-    // required .client.SyncOffset sync_offset = 2;
-    if (has_sync_offset()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_offset());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
   return total_size;
 }
+size_t CmdRequest_Mset_Kv::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Mset.Kv)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+    // required bytes value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
 
-void CmdResponse_Sync::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Sync* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Sync*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_Sync::MergeFrom(const CmdResponse_Sync& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Mset_Kv::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Mset_Kv::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Mset_Kv::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Mset_Kv::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Mset_Kv*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Mset_Kv&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Mset.Kv)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_sync_offset()) {
-      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_Sync::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_Sync::CopyFrom(const CmdResponse_Sync& from) {
+void CmdRequest_Mset_Kv::CopyFrom(const CmdRequest_Mset_Kv& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Mset.Kv)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_Sync::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
-  if (has_sync_offset()) {
-    if (!this->sync_offset().IsInitialized()) return false;
-  }
+bool CmdRequest_Mset_Kv::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdResponse_Sync::Swap(CmdResponse_Sync* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(sync_offset_, other->sync_offset_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata CmdResponse_Sync::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Sync_descriptor_;
-  metadata.reflection = CmdResponse_Sync_reflection_;
-  return metadata;
-}
-
-
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_Get::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_Get::CmdResponse_Get()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void CmdResponse_Get::InitAsDefaultInstance() {
+void CmdRequest_Mset_Kv::InternalSwap(CmdRequest_Mset_Kv* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
-CmdResponse_Get::CmdResponse_Get(const CmdResponse_Get& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Mset_Kv::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[15]);
 }
 
-void CmdResponse_Get::SharedCtor() {
-  _cached_size_ = 0;
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+// ===================================================================
 
-CmdResponse_Get::~CmdResponse_Get() {
-  SharedDtor();
+class CmdRequest_Mset::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Mset>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CmdRequest_Mset::CmdRequest_Mset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Mset)
+}
+CmdRequest_Mset::CmdRequest_Mset(const CmdRequest_Mset& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Mset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.kvs_){from._impl_.kvs_}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.partition_id_ = from._impl_.partition_id_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Mset)
+}
+
+inline void CmdRequest_Mset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.kvs_){arena}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void CmdResponse_Get::SharedDtor() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (this != default_instance_) {
+CmdRequest_Mset::~CmdRequest_Mset() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Mset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void CmdResponse_Get::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_Get::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Get_descriptor_;
-}
-
-const CmdResponse_Get& CmdResponse_Get::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+inline void CmdRequest_Mset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.kvs_.~RepeatedPtrField();
+  _impl_.table_name_.Destroy();
 }
 
-CmdResponse_Get* CmdResponse_Get::default_instance_ = NULL;
-
-CmdResponse_Get* CmdResponse_Get::New() const {
-  return new CmdResponse_Get;
+void CmdRequest_Mset::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void CmdResponse_Get::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
+void CmdRequest_Mset::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Mset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool CmdResponse_Get::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional bytes value = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+  _impl_.kvs_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
   }
-  return true;
-#undef DO_
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_Get::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional bytes value = 1;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->value(), output);
+const char* CmdRequest_Mset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Mset.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.CmdRequest.Mset.Kv kvs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_kvs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 partition_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Mset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Mset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Mset.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // repeated .client.CmdRequest.Mset.Kv kvs = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_kvs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_kvs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* CmdResponse_Get::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional bytes value = 1;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->value(), target);
+  // optional int32 partition_id = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_partition_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Mset)
   return target;
 }
 
-int CmdResponse_Get::ByteSize() const {
-  int total_size = 0;
+size_t CmdRequest_Mset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Mset)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional bytes value = 1;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
+  // required string table_name = 1;
+  if (_internal_has_table_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .client.CmdRequest.Mset.Kv kvs = 2;
+  total_size += 1UL * this->_internal_kvs_size();
+  for (const auto& msg : this->_impl_.kvs_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CmdResponse_Get::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Get* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Get*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // optional int32 partition_id = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_Get::MergeFrom(const CmdResponse_Get& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_value()) {
-      set_value(from.value());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Mset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Mset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Mset::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Mset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Mset*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Mset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Mset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.kvs_.MergeFrom(from._impl_.kvs_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_Get::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_Get::CopyFrom(const CmdResponse_Get& from) {
+void CmdRequest_Mset::CopyFrom(const CmdRequest_Mset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Mset)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_Get::IsInitialized() const {
-
+bool CmdRequest_Mset::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.kvs_))
+    return false;
   return true;
 }
 
-void CmdResponse_Get::Swap(CmdResponse_Get* other) {
-  if (other != this) {
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_Mset::InternalSwap(CmdRequest_Mset* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.kvs_.InternalSwap(&other->_impl_.kvs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.partition_id_, other->_impl_.partition_id_);
 }
 
-::google::protobuf::Metadata CmdResponse_Get::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Get_descriptor_;
-  metadata.reflection = CmdResponse_Get_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Mset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[16]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_InfoStats::kTableNameFieldNumber;
-const int CmdResponse_InfoStats::kTotalQuerysFieldNumber;
-const int CmdResponse_InfoStats::kQpsFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_InfoStats::CmdResponse_InfoStats()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+class CmdRequest_Mdel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Mdel>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CmdRequest_Mdel::CmdRequest_Mdel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Mdel)
+}
+CmdRequest_Mdel::CmdRequest_Mdel(const CmdRequest_Mdel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Mdel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.partition_id_ = from._impl_.partition_id_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Mdel)
+}
+
+inline void CmdRequest_Mdel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void CmdResponse_InfoStats::InitAsDefaultInstance() {
+CmdRequest_Mdel::~CmdRequest_Mdel() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Mdel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-CmdResponse_InfoStats::CmdResponse_InfoStats(const CmdResponse_InfoStats& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+inline void CmdRequest_Mdel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.table_name_.Destroy();
 }
 
-void CmdResponse_InfoStats::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  total_querys_ = GOOGLE_LONGLONG(0);
-  qps_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void CmdRequest_Mdel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-CmdResponse_InfoStats::~CmdResponse_InfoStats() {
-  SharedDtor();
+void CmdRequest_Mdel::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Mdel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_InfoStats::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+const char* CmdRequest_Mdel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Mdel.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string keys = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "client.CmdRequest.Mdel.keys");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 partition_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Mdel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Mdel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Mdel.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
+  }
+
+  // repeated string keys = 2;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Mdel.keys");
+    target = stream->WriteString(2, s, target);
   }
-  if (this != default_instance_) {
+
+  // optional int32 partition_id = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_partition_id(), target);
   }
-}
 
-void CmdResponse_InfoStats::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_InfoStats::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoStats_descriptor_;
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Mdel)
+  return target;
 }
 
-const CmdResponse_InfoStats& CmdResponse_InfoStats::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
-}
+size_t CmdRequest_Mdel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Mdel)
+  size_t total_size = 0;
 
-CmdResponse_InfoStats* CmdResponse_InfoStats::default_instance_ = NULL;
+  // required string table_name = 1;
+  if (_internal_has_table_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-CmdResponse_InfoStats* CmdResponse_InfoStats::New() const {
-  return new CmdResponse_InfoStats;
-}
+  // repeated string keys = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
 
-void CmdResponse_InfoStats::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    total_querys_ = GOOGLE_LONGLONG(0);
-    qps_ = 0;
+  // optional int32 partition_id = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-bool CmdResponse_InfoStats::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_total_querys;
-        break;
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Mdel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Mdel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Mdel::GetClassData() const { return &_class_data_; }
 
-      // required int64 total_querys = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_total_querys:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &total_querys_)));
-          set_has_total_querys();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_qps;
-        break;
-      }
 
-      // required int32 qps = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_qps:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &qps_)));
-          set_has_qps();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+void CmdRequest_Mdel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Mdel*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Mdel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Mdel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdRequest_Mdel::CopyFrom(const CmdRequest_Mdel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Mdel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest_Mdel::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
-#undef DO_
 }
 
-void CmdResponse_InfoStats::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
-  }
+void CmdRequest_Mdel::InternalSwap(CmdRequest_Mdel* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.partition_id_, other->_impl_.partition_id_);
+}
 
-  // required int64 total_querys = 2;
-  if (has_total_querys()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->total_querys(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Mdel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[17]);
+}
 
-  // required int32 qps = 3;
-  if (has_qps()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->qps(), output);
+// ===================================================================
+
+class CmdRequest_Incrby::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Incrby>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_by(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+CmdRequest_Incrby::CmdRequest_Incrby(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Incrby)
+}
+CmdRequest_Incrby::CmdRequest_Incrby(const CmdRequest_Incrby& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Incrby* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.by_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.by_ = from._impl_.by_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Incrby)
+}
+
+inline void CmdRequest_Incrby::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.by_){int64_t{0}}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_Incrby::~CmdRequest_Incrby() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Incrby)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void CmdRequest_Incrby::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+  _impl_.key_.Destroy();
+}
+
+void CmdRequest_Incrby::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest_Incrby::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Incrby)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
   }
+  _impl_.by_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-::google::protobuf::uint8* CmdResponse_InfoStats::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+const char* CmdRequest_Incrby::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Incrby.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Incrby.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 by = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_by(&has_bits);
+          _impl_.by_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Incrby::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Incrby)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Incrby.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
-  // required int64 total_querys = 2;
-  if (has_total_querys()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->total_querys(), target);
+  // required string key = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Incrby.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
   }
 
-  // required int32 qps = 3;
-  if (has_qps()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->qps(), target);
+  // required int64 by = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_by(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Incrby)
   return target;
 }
 
-int CmdResponse_InfoStats::ByteSize() const {
-  int total_size = 0;
+size_t CmdRequest_Incrby::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Incrby)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_table_name()) {
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
-
-    // required int64 total_querys = 2;
-    if (has_total_querys()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->total_querys());
-    }
-
-    // required int32 qps = 3;
-    if (has_qps()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->qps());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
 
+  if (_internal_has_key()) {
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_by()) {
+    // required int64 by = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_by());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t CmdRequest_Incrby::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Incrby)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+    // required int64 by = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_by());
 
-void CmdResponse_InfoStats::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoStats* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoStats*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_InfoStats::MergeFrom(const CmdResponse_InfoStats& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Incrby::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Incrby::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Incrby::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Incrby::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Incrby*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Incrby&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Incrby)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_total_querys()) {
-      set_total_querys(from.total_querys());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_qps()) {
-      set_qps(from.qps());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.by_ = from._impl_.by_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_InfoStats::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_InfoStats::CopyFrom(const CmdResponse_InfoStats& from) {
+void CmdRequest_Incrby::CopyFrom(const CmdRequest_Incrby& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Incrby)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_InfoStats::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+bool CmdRequest_Incrby::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdResponse_InfoStats::Swap(CmdResponse_InfoStats* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(total_querys_, other->total_querys_);
-    std::swap(qps_, other->qps_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_Incrby::InternalSwap(CmdRequest_Incrby* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  swap(_impl_.by_, other->_impl_.by_);
 }
 
-::google::protobuf::Metadata CmdResponse_InfoStats::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoStats_descriptor_;
-  metadata.reflection = CmdResponse_InfoStats_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Incrby::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[18]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_InfoCapacity::kTableNameFieldNumber;
-const int CmdResponse_InfoCapacity::kUsedFieldNumber;
-const int CmdResponse_InfoCapacity::kRemainFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_InfoCapacity::CmdResponse_InfoCapacity()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+class CmdRequest_Append::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Append>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+CmdRequest_Append::CmdRequest_Append(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest.Append)
+}
+CmdRequest_Append::CmdRequest_Append(const CmdRequest_Append& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Append* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest.Append)
+}
+
+inline void CmdRequest_Append::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_Append::~CmdRequest_Append() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest.Append)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void CmdResponse_InfoCapacity::InitAsDefaultInstance() {
+inline void CmdRequest_Append::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-CmdResponse_InfoCapacity::CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+void CmdRequest_Append::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void CmdResponse_InfoCapacity::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  used_ = GOOGLE_LONGLONG(0);
-  remain_ = GOOGLE_LONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void CmdRequest_Append::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest.Append)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-CmdResponse_InfoCapacity::~CmdResponse_InfoCapacity() {
+const char* CmdRequest_Append::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Append.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdRequest.Append.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Append::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest.Append)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Append.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
+  }
+
+  // required string key = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdRequest.Append.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // required bytes value = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest.Append)
+  return target;
+}
+
+size_t CmdRequest_Append::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdRequest.Append)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  if (_internal_has_key()) {
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  if (_internal_has_value()) {
+    // required bytes value = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return total_size;
+}
+size_t CmdRequest_Append::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest.Append)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+
+    // required bytes value = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Append::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Append::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Append::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_Append::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Append*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Append&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest.Append)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdRequest_Append::CopyFrom(const CmdRequest_Append& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest.Append)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest_Append::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CmdRequest_Append::InternalSwap(CmdRequest_Append* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Append::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[19]);
+}
+
+// ===================================================================
+
+class CmdRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::client::CmdRequest_Sync& sync(const CmdRequest* msg);
+  static void set_has_sync(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::client::CmdRequest_Set& set(const CmdRequest* msg);
+  static void set_has_set(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::CmdRequest_Get& get(const CmdRequest* msg);
+  static void set_has_get(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::client::CmdRequest_Del& del(const CmdRequest* msg);
+  static void set_has_del(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::client::CmdRequest_Info& info(const CmdRequest* msg);
+  static void set_has_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::client::CmdRequest_Mget& mget(const CmdRequest* msg);
+  static void set_has_mget(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::client::CmdRequest_Msync& msync(const CmdRequest* msg);
+  static void set_has_msync(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::client::CmdRequest_Subscribe& subscribe(const CmdRequest* msg);
+  static void set_has_subscribe(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::client::CmdRequest_Mset& mset(const CmdRequest* msg);
+  static void set_has_mset(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::client::CmdRequest_Mdel& mdel(const CmdRequest* msg);
+  static void set_has_mdel(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::client::CmdRequest_Incrby& incrby(const CmdRequest* msg);
+  static void set_has_incrby(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::client::CmdRequest_Append& append(const CmdRequest* msg);
+  static void set_has_append(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_write_us(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00002000) ^ 0x00002000) != 0;
+  }
+};
+
+const ::client::CmdRequest_Sync&
+CmdRequest::_Internal::sync(const CmdRequest* msg) {
+  return *msg->_impl_.sync_;
+}
+const ::client::CmdRequest_Set&
+CmdRequest::_Internal::set(const CmdRequest* msg) {
+  return *msg->_impl_.set_;
+}
+const ::client::CmdRequest_Get&
+CmdRequest::_Internal::get(const CmdRequest* msg) {
+  return *msg->_impl_.get_;
+}
+const ::client::CmdRequest_Del&
+CmdRequest::_Internal::del(const CmdRequest* msg) {
+  return *msg->_impl_.del_;
+}
+const ::client::CmdRequest_Info&
+CmdRequest::_Internal::info(const CmdRequest* msg) {
+  return *msg->_impl_.info_;
+}
+const ::client::CmdRequest_Mget&
+CmdRequest::_Internal::mget(const CmdRequest* msg) {
+  return *msg->_impl_.mget_;
+}
+const ::client::CmdRequest_Msync&
+CmdRequest::_Internal::msync(const CmdRequest* msg) {
+  return *msg->_impl_.msync_;
+}
+const ::client::CmdRequest_Subscribe&
+CmdRequest::_Internal::subscribe(const CmdRequest* msg) {
+  return *msg->_impl_.subscribe_;
+}
+const ::client::CmdRequest_Mset&
+CmdRequest::_Internal::mset(const CmdRequest* msg) {
+  return *msg->_impl_.mset_;
+}
+const ::client::CmdRequest_Mdel&
+CmdRequest::_Internal::mdel(const CmdRequest* msg) {
+  return *msg->_impl_.mdel_;
+}
+const ::client::CmdRequest_Incrby&
+CmdRequest::_Internal::incrby(const CmdRequest* msg) {
+  return *msg->_impl_.incrby_;
+}
+const ::client::CmdRequest_Append&
+CmdRequest::_Internal::append(const CmdRequest* msg) {
+  return *msg->_impl_.append_;
+}
+CmdRequest::CmdRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdRequest)
+}
+CmdRequest::CmdRequest(const CmdRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sync_){nullptr}
+    , decltype(_impl_.set_){nullptr}
+    , decltype(_impl_.get_){nullptr}
+    , decltype(_impl_.del_){nullptr}
+    , decltype(_impl_.info_){nullptr}
+    , decltype(_impl_.mget_){nullptr}
+    , decltype(_impl_.msync_){nullptr}
+    , decltype(_impl_.subscribe_){nullptr}
+    , decltype(_impl_.mset_){nullptr}
+    , decltype(_impl_.mdel_){nullptr}
+    , decltype(_impl_.incrby_){nullptr}
+    , decltype(_impl_.append_){nullptr}
+    , decltype(_impl_.write_us_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_sync()) {
+    _this->_impl_.sync_ = new ::client::CmdRequest_Sync(*from._impl_.sync_);
+  }
+  if (from._internal_has_set()) {
+    _this->_impl_.set_ = new ::client::CmdRequest_Set(*from._impl_.set_);
+  }
+  if (from._internal_has_get()) {
+    _this->_impl_.get_ = new ::client::CmdRequest_Get(*from._impl_.get_);
+  }
+  if (from._internal_has_del()) {
+    _this->_impl_.del_ = new ::client::CmdRequest_Del(*from._impl_.del_);
+  }
+  if (from._internal_has_info()) {
+    _this->_impl_.info_ = new ::client::CmdRequest_Info(*from._impl_.info_);
+  }
+  if (from._internal_has_mget()) {
+    _this->_impl_.mget_ = new ::client::CmdRequest_Mget(*from._impl_.mget_);
+  }
+  if (from._internal_has_msync()) {
+    _this->_impl_.msync_ = new ::client::CmdRequest_Msync(*from._impl_.msync_);
+  }
+  if (from._internal_has_subscribe()) {
+    _this->_impl_.subscribe_ = new ::client::CmdRequest_Subscribe(*from._impl_.subscribe_);
+  }
+  if (from._internal_has_mset()) {
+    _this->_impl_.mset_ = new ::client::CmdRequest_Mset(*from._impl_.mset_);
+  }
+  if (from._internal_has_mdel()) {
+    _this->_impl_.mdel_ = new ::client::CmdRequest_Mdel(*from._impl_.mdel_);
+  }
+  if (from._internal_has_incrby()) {
+    _this->_impl_.incrby_ = new ::client::CmdRequest_Incrby(*from._impl_.incrby_);
+  }
+  if (from._internal_has_append()) {
+    _this->_impl_.append_ = new ::client::CmdRequest_Append(*from._impl_.append_);
+  }
+  ::memcpy(&_impl_.write_us_, &from._impl_.write_us_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.write_us_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:client.CmdRequest)
+}
+
+inline void CmdRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sync_){nullptr}
+    , decltype(_impl_.set_){nullptr}
+    , decltype(_impl_.get_){nullptr}
+    , decltype(_impl_.del_){nullptr}
+    , decltype(_impl_.info_){nullptr}
+    , decltype(_impl_.mget_){nullptr}
+    , decltype(_impl_.msync_){nullptr}
+    , decltype(_impl_.subscribe_){nullptr}
+    , decltype(_impl_.mset_){nullptr}
+    , decltype(_impl_.mdel_){nullptr}
+    , decltype(_impl_.incrby_){nullptr}
+    , decltype(_impl_.append_){nullptr}
+    , decltype(_impl_.write_us_){int64_t{0}}
+    , decltype(_impl_.type_){0}
+  };
+}
+
+CmdRequest::~CmdRequest() {
+  // @@protoc_insertion_point(destructor:client.CmdRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdResponse_InfoCapacity::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline void CmdRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.sync_;
+  if (this != internal_default_instance()) delete _impl_.set_;
+  if (this != internal_default_instance()) delete _impl_.get_;
+  if (this != internal_default_instance()) delete _impl_.del_;
+  if (this != internal_default_instance()) delete _impl_.info_;
+  if (this != internal_default_instance()) delete _impl_.mget_;
+  if (this != internal_default_instance()) delete _impl_.msync_;
+  if (this != internal_default_instance()) delete _impl_.subscribe_;
+  if (this != internal_default_instance()) delete _impl_.mset_;
+  if (this != internal_default_instance()) delete _impl_.mdel_;
+  if (this != internal_default_instance()) delete _impl_.incrby_;
+  if (this != internal_default_instance()) delete _impl_.append_;
+}
+
+void CmdRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.sync_ != nullptr);
+      _impl_.sync_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.set_ != nullptr);
+      _impl_.set_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.get_ != nullptr);
+      _impl_.get_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.del_ != nullptr);
+      _impl_.del_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.info_ != nullptr);
+      _impl_.info_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.mget_ != nullptr);
+      _impl_.mget_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.msync_ != nullptr);
+      _impl_.msync_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.subscribe_ != nullptr);
+      _impl_.subscribe_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.mset_ != nullptr);
+      _impl_.mset_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.mdel_ != nullptr);
+      _impl_.mdel_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(_impl_.incrby_ != nullptr);
+      _impl_.incrby_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(_impl_.append_ != nullptr);
+      _impl_.append_->Clear();
+    }
   }
-  if (this != default_instance_) {
+  if (cached_has_bits & 0x00003000u) {
+    ::memset(&_impl_.write_us_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.write_us_)) + sizeof(_impl_.type_));
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_InfoCapacity::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const char* CmdRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .client.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::client::Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Sync sync = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Set set = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Get get = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_get(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Del del = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_del(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Info info = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Mget mget = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mget(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Msync msync = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_msync(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Subscribe subscribe = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_subscribe(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Mset mset = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mset(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Mdel mdel = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mdel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Incrby incrby = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_incrby(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdRequest.Append append = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_append(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 write_us = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_write_us(&has_bits);
+          _impl_.write_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .client.Type type = 1;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional .client.CmdRequest.Sync sync = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::sync(this),
+        _Internal::sync(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Set set = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::set(this),
+        _Internal::set(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Get get = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::get(this),
+        _Internal::get(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Del del = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::del(this),
+        _Internal::del(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Info info = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::info(this),
+        _Internal::info(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Mget mget = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::mget(this),
+        _Internal::mget(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Msync msync = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::msync(this),
+        _Internal::msync(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Subscribe subscribe = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::subscribe(this),
+        _Internal::subscribe(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Mset mset = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::mset(this),
+        _Internal::mset(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Mdel mdel = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::mdel(this),
+        _Internal::mdel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Incrby incrby = 12;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::incrby(this),
+        _Internal::incrby(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .client.CmdRequest.Append append = 13;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::append(this),
+        _Internal::append(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 write_us = 14;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(14, this->_internal_write_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdRequest)
+  return target;
 }
-const ::google::protobuf::Descriptor* CmdResponse_InfoCapacity::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoCapacity_descriptor_;
+
+size_t CmdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdRequest)
+  size_t total_size = 0;
+
+  // required .client.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .client.CmdRequest.Sync sync = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sync_);
+    }
+
+    // optional .client.CmdRequest.Set set = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.set_);
+    }
+
+    // optional .client.CmdRequest.Get get = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_);
+    }
+
+    // optional .client.CmdRequest.Del del = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.del_);
+    }
+
+    // optional .client.CmdRequest.Info info = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.info_);
+    }
+
+    // optional .client.CmdRequest.Mget mget = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mget_);
+    }
+
+    // optional .client.CmdRequest.Msync msync = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msync_);
+    }
+
+    // optional .client.CmdRequest.Subscribe subscribe = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.subscribe_);
+    }
+
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    // optional .client.CmdRequest.Mset mset = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mset_);
+    }
+
+    // optional .client.CmdRequest.Mdel mdel = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mdel_);
+    }
+
+    // optional .client.CmdRequest.Incrby incrby = 12;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.incrby_);
+    }
+
+    // optional .client.CmdRequest.Append append = 13;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.append_);
+    }
+
+    // optional int64 write_us = 14;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_write_us());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const CmdResponse_InfoCapacity& CmdResponse_InfoCapacity::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest*>(&to_msg);
+  auto& from = static_cast<const CmdRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_sync()->::client::CmdRequest_Sync::MergeFrom(
+          from._internal_sync());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_set()->::client::CmdRequest_Set::MergeFrom(
+          from._internal_set());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_get()->::client::CmdRequest_Get::MergeFrom(
+          from._internal_get());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_del()->::client::CmdRequest_Del::MergeFrom(
+          from._internal_del());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_info()->::client::CmdRequest_Info::MergeFrom(
+          from._internal_info());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_mget()->::client::CmdRequest_Mget::MergeFrom(
+          from._internal_mget());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_msync()->::client::CmdRequest_Msync::MergeFrom(
+          from._internal_msync());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_subscribe()->::client::CmdRequest_Subscribe::MergeFrom(
+          from._internal_subscribe());
+    }
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_mset()->::client::CmdRequest_Mset::MergeFrom(
+          from._internal_mset());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_mdel()->::client::CmdRequest_Mdel::MergeFrom(
+          from._internal_mdel());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_incrby()->::client::CmdRequest_Incrby::MergeFrom(
+          from._internal_incrby());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_append()->::client::CmdRequest_Append::MergeFrom(
+          from._internal_append());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.write_us_ = from._impl_.write_us_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-CmdResponse_InfoCapacity* CmdResponse_InfoCapacity::default_instance_ = NULL;
+void CmdRequest::CopyFrom(const CmdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-CmdResponse_InfoCapacity* CmdResponse_InfoCapacity::New() const {
-  return new CmdResponse_InfoCapacity;
+bool CmdRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_sync()) {
+    if (!_impl_.sync_->IsInitialized()) return false;
+  }
+  if (_internal_has_set()) {
+    if (!_impl_.set_->IsInitialized()) return false;
+  }
+  if (_internal_has_get()) {
+    if (!_impl_.get_->IsInitialized()) return false;
+  }
+  if (_internal_has_del()) {
+    if (!_impl_.del_->IsInitialized()) return false;
+  }
+  if (_internal_has_mget()) {
+    if (!_impl_.mget_->IsInitialized()) return false;
+  }
+  if (_internal_has_msync()) {
+    if (!_impl_.msync_->IsInitialized()) return false;
+  }
+  if (_internal_has_subscribe()) {
+    if (!_impl_.subscribe_->IsInitialized()) return false;
+  }
+  if (_internal_has_mset()) {
+    if (!_impl_.mset_->IsInitialized()) return false;
+  }
+  if (_internal_has_mdel()) {
+    if (!_impl_.mdel_->IsInitialized()) return false;
+  }
+  if (_internal_has_incrby()) {
+    if (!_impl_.incrby_->IsInitialized()) return false;
+  }
+  if (_internal_has_append()) {
+    if (!_impl_.append_->IsInitialized()) return false;
+  }
+  return true;
 }
 
-void CmdResponse_InfoCapacity::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
+void CmdRequest::InternalSwap(CmdRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest, _impl_.type_)
+      + sizeof(CmdRequest::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest, _impl_.sync_)>(
+          reinterpret_cast<char*>(&_impl_.sync_),
+          reinterpret_cast<char*>(&other->_impl_.sync_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[20]);
+}
+
+// ===================================================================
+
+class CmdResponse_Sync::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Sync>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::client::SyncOffset& sync_offset(const CmdResponse_Sync* msg);
+  static void set_has_sync_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::client::SyncOffset&
+CmdResponse_Sync::_Internal::sync_offset(const CmdResponse_Sync* msg) {
+  return *msg->_impl_.sync_offset_;
+}
+CmdResponse_Sync::CmdResponse_Sync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Sync)
+}
+CmdResponse_Sync::CmdResponse_Sync(const CmdResponse_Sync& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Sync* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.repl_history_){from._impl_.repl_history_}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.sync_offset_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_sync_offset()) {
+    _this->_impl_.sync_offset_ = new ::client::SyncOffset(*from._impl_.sync_offset_);
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Sync)
+}
+
+inline void CmdResponse_Sync::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.repl_history_){arena}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.sync_offset_){nullptr}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse_Sync::~CmdResponse_Sync() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Sync)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CmdResponse_Sync::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.repl_history_.~RepeatedPtrField();
+  _impl_.table_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.sync_offset_;
+}
+
+void CmdResponse_Sync::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Sync::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Sync)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.repl_history_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.sync_offset_ != nullptr);
+      _impl_.sync_offset_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Sync::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.Sync.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.SyncOffset sync_offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_offset(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.ReplTerm repl_history = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repl_history(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Sync::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Sync)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.Sync.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
+  }
+
+  // required .client.SyncOffset sync_offset = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::sync_offset(this),
+        _Internal::sync_offset(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .client.ReplTerm repl_history = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_repl_history_size()); i < n; i++) {
+    const auto& repfield = this->_internal_repl_history(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Sync)
+  return target;
+}
+
+size_t CmdResponse_Sync::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.Sync)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  if (_internal_has_sync_offset()) {
+    // required .client.SyncOffset sync_offset = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
+  }
+
+  return total_size;
+}
+size_t CmdResponse_Sync::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Sync)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required .client.SyncOffset sync_offset = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .client.ReplTerm repl_history = 3;
+  total_size += 1UL * this->_internal_repl_history_size();
+  for (const auto& msg : this->_impl_.repl_history_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Sync::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Sync::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Sync::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_Sync::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Sync*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Sync&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Sync)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.repl_history_.MergeFrom(from._impl_.repl_history_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_sync_offset()->::client::SyncOffset::MergeFrom(
+          from._internal_sync_offset());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdResponse_Sync::CopyFrom(const CmdResponse_Sync& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Sync)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Sync::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.repl_history_))
+    return false;
+  if (_internal_has_sync_offset()) {
+    if (!_impl_.sync_offset_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdResponse_Sync::InternalSwap(CmdResponse_Sync* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.repl_history_.InternalSwap(&other->_impl_.repl_history_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.sync_offset_, other->_impl_.sync_offset_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Sync::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[21]);
+}
+
+// ===================================================================
+
+class CmdResponse_Get::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Get>()._impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CmdResponse_Get::CmdResponse_Get(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Get)
+}
+CmdResponse_Get::CmdResponse_Get(const CmdResponse_Get& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Get* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Get)
+}
+
+inline void CmdResponse_Get::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse_Get::~CmdResponse_Get() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Get)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CmdResponse_Get::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void CmdResponse_Get::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Get::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Get)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.value_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Get::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Get::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Get)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Get)
+  return target;
+}
+
+size_t CmdResponse_Get::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Get)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Get::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Get::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Get::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_Get::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Get*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Get&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Get)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_value()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdResponse_Get::CopyFrom(const CmdResponse_Get& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Get)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Get::IsInitialized() const {
+  return true;
+}
+
+void CmdResponse_Get::InternalSwap(CmdResponse_Get* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Get::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[22]);
+}
+
+// ===================================================================
+
+class CmdResponse_InfoStats::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_InfoStats>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_total_querys(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_qps(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+CmdResponse_InfoStats::CmdResponse_InfoStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.InfoStats)
+}
+CmdResponse_InfoStats::CmdResponse_InfoStats(const CmdResponse_InfoStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_InfoStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.total_querys_){}
+    , decltype(_impl_.qps_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.total_querys_, &from._impl_.total_querys_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.qps_) -
+    reinterpret_cast<char*>(&_impl_.total_querys_)) + sizeof(_impl_.qps_));
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.InfoStats)
+}
+
+inline void CmdResponse_InfoStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.total_querys_){int64_t{0}}
+    , decltype(_impl_.qps_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse_InfoStats::~CmdResponse_InfoStats() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.InfoStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CmdResponse_InfoStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+}
+
+void CmdResponse_InfoStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_InfoStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.InfoStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.total_querys_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.qps_) -
+        reinterpret_cast<char*>(&_impl_.total_querys_)) + sizeof(_impl_.qps_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_InfoStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.InfoStats.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 total_querys = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_total_querys(&has_bits);
+          _impl_.total_querys_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 qps = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_qps(&has_bits);
+          _impl_.qps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_InfoStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.InfoStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.InfoStats.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
+  }
+
+  // required int64 total_querys = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_total_querys(), target);
+  }
+
+  // required int32 qps = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_qps(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.InfoStats)
+  return target;
+}
+
+size_t CmdResponse_InfoStats::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.InfoStats)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  if (_internal_has_total_querys()) {
+    // required int64 total_querys = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_total_querys());
+  }
+
+  if (_internal_has_qps()) {
+    // required int32 qps = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_qps());
+  }
+
+  return total_size;
+}
+size_t CmdResponse_InfoStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.InfoStats)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required int64 total_querys = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_total_querys());
+
+    // required int32 qps = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_qps());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_InfoStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_InfoStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_InfoStats::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_InfoStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_InfoStats*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_InfoStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.InfoStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.total_querys_ = from._impl_.total_querys_;
     }
-    used_ = GOOGLE_LONGLONG(0);
-    remain_ = GOOGLE_LONGLONG(0);
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.qps_ = from._impl_.qps_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdResponse_InfoStats::CopyFrom(const CmdResponse_InfoStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.InfoStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoStats::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CmdResponse_InfoStats::InternalSwap(CmdResponse_InfoStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_InfoStats, _impl_.qps_)
+      + sizeof(CmdResponse_InfoStats::_impl_.qps_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_InfoStats, _impl_.total_querys_)>(
+          reinterpret_cast<char*>(&_impl_.total_querys_),
+          reinterpret_cast<char*>(&other->_impl_.total_querys_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_InfoStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[23]);
+}
+
+// ===================================================================
+
+class CmdResponse_InfoCapacity::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_InfoCapacity>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_used(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_remain(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+CmdResponse_InfoCapacity::CmdResponse_InfoCapacity(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.InfoCapacity)
+}
+CmdResponse_InfoCapacity::CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_InfoCapacity* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.used_){}
+    , decltype(_impl_.remain_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.used_, &from._impl_.used_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.remain_) -
+    reinterpret_cast<char*>(&_impl_.used_)) + sizeof(_impl_.remain_));
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.InfoCapacity)
+}
+
+inline void CmdResponse_InfoCapacity::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.used_){int64_t{0}}
+    , decltype(_impl_.remain_){int64_t{0}}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse_InfoCapacity::~CmdResponse_InfoCapacity() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.InfoCapacity)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CmdResponse_InfoCapacity::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+}
+
+void CmdResponse_InfoCapacity::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool CmdResponse_InfoCapacity::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void CmdResponse_InfoCapacity::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.InfoCapacity)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.used_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.remain_) -
+        reinterpret_cast<char*>(&_impl_.used_)) + sizeof(_impl_.remain_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_InfoCapacity::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_used;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.InfoCapacity.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int64 used = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_used:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &used_)));
-          set_has_used();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_remain;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_used(&has_bits);
+          _impl_.used_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required int64 remain = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_remain:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &remain_)));
-          set_has_remain();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdResponse_InfoCapacity::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_remain(&has_bits);
+          _impl_.remain_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_InfoCapacity::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.InfoCapacity)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.InfoCapacity.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // required int64 used = 2;
-  if (has_used()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->used(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_used(), target);
   }
 
   // required int64 remain = 3;
-  if (has_remain()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->remain(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_remain(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.InfoCapacity)
+  return target;
 }
 
-::google::protobuf::uint8* CmdResponse_InfoCapacity::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
-  }
+size_t CmdResponse_InfoCapacity::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.InfoCapacity)
+  size_t total_size = 0;
 
-  // required int64 used = 2;
-  if (has_used()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->used(), target);
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
 
-  // required int64 remain = 3;
-  if (has_remain()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->remain(), target);
+  if (_internal_has_used()) {
+    // required int64 used = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_used());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_remain()) {
+    // required int64 remain = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_remain());
   }
-  return target;
-}
 
-int CmdResponse_InfoCapacity::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t CmdResponse_InfoCapacity::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.InfoCapacity)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
 
     // required int64 used = 2;
-    if (has_used()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->used());
-    }
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_used());
 
     // required int64 remain = 3;
-    if (has_remain()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->remain());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_remain());
 
-void CmdResponse_InfoCapacity::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoCapacity* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoCapacity*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_InfoCapacity::MergeFrom(const CmdResponse_InfoCapacity& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_InfoCapacity::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_InfoCapacity::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_InfoCapacity::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_InfoCapacity::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_InfoCapacity*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_InfoCapacity&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.InfoCapacity)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_used()) {
-      set_used(from.used());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.used_ = from._impl_.used_;
     }
-    if (from.has_remain()) {
-      set_remain(from.remain());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.remain_ = from._impl_.remain_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_InfoCapacity::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse_InfoCapacity::CopyFrom(const CmdResponse_InfoCapacity& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.InfoCapacity)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse_InfoCapacity::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdResponse_InfoCapacity::Swap(CmdResponse_InfoCapacity* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(used_, other->used_);
-    std::swap(remain_, other->remain_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse_InfoCapacity::InternalSwap(CmdResponse_InfoCapacity* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_InfoCapacity, _impl_.remain_)
+      + sizeof(CmdResponse_InfoCapacity::_impl_.remain_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_InfoCapacity, _impl_.used_)>(
+          reinterpret_cast<char*>(&_impl_.used_),
+          reinterpret_cast<char*>(&other->_impl_.used_));
 }
 
-::google::protobuf::Metadata CmdResponse_InfoCapacity::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoCapacity_descriptor_;
-  metadata.reflection = CmdResponse_InfoCapacity_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_InfoCapacity::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[24]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
+class CmdResponse_InfoRepl::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_InfoRepl>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition_cnt(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-#ifndef _MSC_VER
-const int CmdResponse_InfoRepl::kTableNameFieldNumber;
-const int CmdResponse_InfoRepl::kPartitionCntFieldNumber;
-const int CmdResponse_InfoRepl::kPartitionStateFieldNumber;
-#endif  // !_MSC_VER
+CmdResponse_InfoRepl::CmdResponse_InfoRepl(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.InfoRepl)
+}
+CmdResponse_InfoRepl::CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_InfoRepl* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.partition_state_){from._impl_.partition_state_}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_cnt_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.partition_cnt_ = from._impl_.partition_cnt_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.InfoRepl)
+}
+
+inline void CmdResponse_InfoRepl::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.partition_state_){arena}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_cnt_){int64_t{0}}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-CmdResponse_InfoRepl::CmdResponse_InfoRepl()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+CmdResponse_InfoRepl::~CmdResponse_InfoRepl() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.InfoRepl)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void CmdResponse_InfoRepl::InitAsDefaultInstance() {
+inline void CmdResponse_InfoRepl::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.partition_state_.~RepeatedPtrField();
+  _impl_.table_name_.Destroy();
 }
 
-CmdResponse_InfoRepl::CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+void CmdResponse_InfoRepl::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void CmdResponse_InfoRepl::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_cnt_ = GOOGLE_LONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void CmdResponse_InfoRepl::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.InfoRepl)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.partition_state_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.partition_cnt_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_InfoRepl::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.InfoRepl.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 partition_cnt = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition_cnt(&has_bits);
+          _impl_.partition_cnt_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.PartitionState partition_state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_partition_state(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_InfoRepl::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.InfoRepl)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.InfoRepl.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
+  }
+
+  // required int64 partition_cnt = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_partition_cnt(), target);
+  }
+
+  // repeated .client.PartitionState partition_state = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_partition_state_size()); i < n; i++) {
+    const auto& repfield = this->_internal_partition_state(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.InfoRepl)
+  return target;
 }
 
-CmdResponse_InfoRepl::~CmdResponse_InfoRepl() {
-  SharedDtor();
+size_t CmdResponse_InfoRepl::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.InfoRepl)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  if (_internal_has_partition_cnt()) {
+    // required int64 partition_cnt = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_partition_cnt());
+  }
+
+  return total_size;
 }
+size_t CmdResponse_InfoRepl::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.InfoRepl)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
 
-void CmdResponse_InfoRepl::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+    // required int64 partition_cnt = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_partition_cnt());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  if (this != default_instance_) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .client.PartitionState partition_state = 3;
+  total_size += 1UL * this->_internal_partition_state_size();
+  for (const auto& msg : this->_impl_.partition_state_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_InfoRepl::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_InfoRepl::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_InfoRepl::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_InfoRepl::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_InfoRepl::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_InfoRepl*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_InfoRepl&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.InfoRepl)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.partition_state_.MergeFrom(from._impl_.partition_state_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_cnt_ = from._impl_.partition_cnt_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-const ::google::protobuf::Descriptor* CmdResponse_InfoRepl::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoRepl_descriptor_;
+
+void CmdResponse_InfoRepl::CopyFrom(const CmdResponse_InfoRepl& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.InfoRepl)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-const CmdResponse_InfoRepl& CmdResponse_InfoRepl::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+bool CmdResponse_InfoRepl::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.partition_state_))
+    return false;
+  return true;
 }
 
-CmdResponse_InfoRepl* CmdResponse_InfoRepl::default_instance_ = NULL;
+void CmdResponse_InfoRepl::InternalSwap(CmdResponse_InfoRepl* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.partition_state_.InternalSwap(&other->_impl_.partition_state_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.partition_cnt_, other->_impl_.partition_cnt_);
+}
 
-CmdResponse_InfoRepl* CmdResponse_InfoRepl::New() const {
-  return new CmdResponse_InfoRepl;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_InfoRepl::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[25]);
 }
 
-void CmdResponse_InfoRepl::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    partition_cnt_ = GOOGLE_LONGLONG(0);
+// ===================================================================
+
+class CmdResponse_Mget::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Mget>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
   }
-  partition_state_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::client::Node& redirect(const CmdResponse_Mget* msg);
+  static void set_has_redirect(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::client::Node&
+CmdResponse_Mget::_Internal::redirect(const CmdResponse_Mget* msg) {
+  return *msg->_impl_.redirect_;
+}
+CmdResponse_Mget::CmdResponse_Mget(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Mget)
+}
+CmdResponse_Mget::CmdResponse_Mget(const CmdResponse_Mget& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Mget* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.redirect_){nullptr}
+    , decltype(_impl_.code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_redirect()) {
+    _this->_impl_.redirect_ = new ::client::Node(*from._impl_.redirect_);
+  }
+  _this->_impl_.code_ = from._impl_.code_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Mget)
+}
+
+inline void CmdResponse_Mget::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.redirect_){nullptr}
+    , decltype(_impl_.code_){0}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-bool CmdResponse_InfoRepl::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_partition_cnt;
-        break;
-      }
+CmdResponse_Mget::~CmdResponse_Mget() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Mget)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-      // required int64 partition_cnt = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition_cnt:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &partition_cnt_)));
-          set_has_partition_cnt();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_partition_state;
-        break;
-      }
+inline void CmdResponse_Mget::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.msg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.redirect_;
+}
 
-      // repeated .client.PartitionState partition_state = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_partition_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_partition_state()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_partition_state;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+void CmdResponse_Mget::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Mget::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Mget)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.msg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.redirect_ != nullptr);
+      _impl_.redirect_->Clear();
     }
   }
-  return true;
-#undef DO_
+  _impl_.code_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_InfoRepl::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+const char* CmdResponse_Mget::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.Mget.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.StatusCode code = 3 [default = kOk];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::StatusCode_IsValid(val))) {
+            _internal_set_code(static_cast<::client::StatusCode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string msg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.Mget.msg");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.Node redirect = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_redirect(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Mget::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Mget)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.Mget.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
   }
 
-  // required int64 partition_cnt = 2;
-  if (has_partition_cnt()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->partition_cnt(), output);
+  // required bytes value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
   }
 
-  // repeated .client.PartitionState partition_state = 3;
-  for (int i = 0; i < this->partition_state_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->partition_state(i), output);
+  // optional .client.StatusCode code = 3 [default = kOk];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_code(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional string msg = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.Mget.msg");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_msg(), target);
   }
-}
 
-::google::protobuf::uint8* CmdResponse_InfoRepl::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  // optional .client.Node redirect = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::redirect(this),
+        _Internal::redirect(this).GetCachedSize(), target, stream);
   }
 
-  // required int64 partition_cnt = 2;
-  if (has_partition_cnt()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->partition_cnt(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Mget)
+  return target;
+}
 
-  // repeated .client.PartitionState partition_state = 3;
-  for (int i = 0; i < this->partition_state_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->partition_state(i), target);
+size_t CmdResponse_Mget::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.Mget)
+  size_t total_size = 0;
+
+  if (_internal_has_key()) {
+    // required string key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_value()) {
+    // required bytes value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
-  return target;
+
+  return total_size;
 }
+size_t CmdResponse_Mget::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Mget)
+  size_t total_size = 0;
 
-int CmdResponse_InfoRepl::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string table_name = 1;
-    if (has_table_name()) {
+    // required bytes value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001cu) {
+    // optional string msg = 4;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_msg());
     }
 
-    // required int64 partition_cnt = 2;
-    if (has_partition_cnt()) {
+    // optional .client.Node redirect = 5;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->partition_cnt());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.redirect_);
     }
 
-  }
-  // repeated .client.PartitionState partition_state = 3;
-  total_size += 1 * this->partition_state_size();
-  for (int i = 0; i < this->partition_state_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->partition_state(i));
-  }
+    // optional .client.StatusCode code = 3 [default = kOk];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
+    }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_InfoRepl::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoRepl* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoRepl*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Mget::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Mget::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Mget::GetClassData() const { return &_class_data_; }
+
 
-void CmdResponse_InfoRepl::MergeFrom(const CmdResponse_InfoRepl& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  partition_state_.MergeFrom(from.partition_state_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+void CmdResponse_Mget::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Mget*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Mget&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Mget)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
     }
-    if (from.has_partition_cnt()) {
-      set_partition_cnt(from.partition_cnt());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_msg(from._internal_msg());
     }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_redirect()->::client::Node::MergeFrom(
+          from._internal_redirect());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.code_ = from._impl_.code_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_InfoRepl::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdResponse_Mget::CopyFrom(const CmdResponse_Mget& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Mget)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoRepl::CopyFrom(const CmdResponse_InfoRepl& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool CmdResponse_Mget::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_redirect()) {
+    if (!_impl_.redirect_->IsInitialized()) return false;
+  }
+  return true;
 }
 
-bool CmdResponse_InfoRepl::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+void CmdResponse_Mget::InternalSwap(CmdResponse_Mget* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_Mget, _impl_.code_)
+      + sizeof(CmdResponse_Mget::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_Mget, _impl_.redirect_)>(
+          reinterpret_cast<char*>(&_impl_.redirect_),
+          reinterpret_cast<char*>(&other->_impl_.redirect_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Mget::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[26]);
+}
 
-  for (int i = 0; i < partition_state_size(); i++) {
-    if (!this->partition_state(i).IsInitialized()) return false;
+// ===================================================================
+
+class CmdResponse_InfoServer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_InfoServer>()._impl_._has_bits_);
+  static void set_has_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::Node& cur_meta(const CmdResponse_InfoServer* msg);
+  static void set_has_cur_meta(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_meta_renewing(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::client::Node&
+CmdResponse_InfoServer::_Internal::cur_meta(const CmdResponse_InfoServer* msg) {
+  return *msg->_impl_.cur_meta_;
+}
+CmdResponse_InfoServer::CmdResponse_InfoServer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.InfoServer)
+}
+CmdResponse_InfoServer::CmdResponse_InfoServer(const CmdResponse_InfoServer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_InfoServer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_names_){from._impl_.table_names_}
+    , decltype(_impl_.cur_meta_){nullptr}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.meta_renewing_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_cur_meta()) {
+    _this->_impl_.cur_meta_ = new ::client::Node(*from._impl_.cur_meta_);
+  }
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.meta_renewing_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.meta_renewing_));
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.InfoServer)
+}
+
+inline void CmdResponse_InfoServer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_names_){arena}
+    , decltype(_impl_.cur_meta_){nullptr}
+    , decltype(_impl_.epoch_){int64_t{0}}
+    , decltype(_impl_.meta_renewing_){false}
+  };
+}
+
+CmdResponse_InfoServer::~CmdResponse_InfoServer() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.InfoServer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CmdResponse_InfoServer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_names_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.cur_meta_;
+}
+
+void CmdResponse_InfoServer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_InfoServer::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.InfoServer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.table_names_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.cur_meta_ != nullptr);
+    _impl_.cur_meta_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.meta_renewing_) -
+        reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.meta_renewing_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_InfoServer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 epoch = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_epoch(&has_bits);
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string table_names = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_table_names();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "client.CmdResponse.InfoServer.table_names");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.Node cur_meta = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cur_meta(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool meta_renewing = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_meta_renewing(&has_bits);
+          _impl_.meta_renewing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_InfoServer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.InfoServer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 epoch = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_epoch(), target);
+  }
+
+  // repeated string table_names = 2;
+  for (int i = 0, n = this->_internal_table_names_size(); i < n; i++) {
+    const auto& s = this->_internal_table_names(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.InfoServer.table_names");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // required .client.Node cur_meta = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::cur_meta(this),
+        _Internal::cur_meta(this).GetCachedSize(), target, stream);
+  }
+
+  // required bool meta_renewing = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_meta_renewing(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.InfoServer)
+  return target;
+}
+
+size_t CmdResponse_InfoServer::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.InfoServer)
+  size_t total_size = 0;
+
+  if (_internal_has_cur_meta()) {
+    // required .client.Node cur_meta = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cur_meta_);
+  }
+
+  if (_internal_has_epoch()) {
+    // required int64 epoch = 1;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_epoch());
+  }
+
+  if (_internal_has_meta_renewing()) {
+    // required bool meta_renewing = 4;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t CmdResponse_InfoServer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.InfoServer)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .client.Node cur_meta = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cur_meta_);
+
+    // required int64 epoch = 1;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_epoch());
+
+    // required bool meta_renewing = 4;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  return true;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void CmdResponse_InfoRepl::Swap(CmdResponse_InfoRepl* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(partition_cnt_, other->partition_cnt_);
-    partition_state_.Swap(&other->partition_state_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+  // repeated string table_names = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.table_names_.size());
+  for (int i = 0, n = _impl_.table_names_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.table_names_.Get(i));
   }
-}
 
-::google::protobuf::Metadata CmdResponse_InfoRepl::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoRepl_descriptor_;
-  metadata.reflection = CmdResponse_InfoRepl_reflection_;
-  return metadata;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_InfoServer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_InfoServer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_InfoServer::GetClassData() const { return &_class_data_; }
 
-// -------------------------------------------------------------------
 
-#ifndef _MSC_VER
-const int CmdResponse_Mget::kKeyFieldNumber;
-const int CmdResponse_Mget::kValueFieldNumber;
-#endif  // !_MSC_VER
+void CmdResponse_InfoServer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_InfoServer*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_InfoServer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.InfoServer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-CmdResponse_Mget::CmdResponse_Mget()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void CmdResponse_Mget::InitAsDefaultInstance() {
+  _this->_impl_.table_names_.MergeFrom(from._impl_.table_names_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_cur_meta()->::client::Node::MergeFrom(
+          from._internal_cur_meta());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.epoch_ = from._impl_.epoch_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.meta_renewing_ = from._impl_.meta_renewing_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-CmdResponse_Mget::CmdResponse_Mget(const CmdResponse_Mget& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+void CmdResponse_InfoServer::CopyFrom(const CmdResponse_InfoServer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.InfoServer)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_Mget::SharedCtor() {
-  _cached_size_ = 0;
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-CmdResponse_Mget::~CmdResponse_Mget() {
-  SharedDtor();
-}
-
-void CmdResponse_Mget::SharedDtor() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (this != default_instance_) {
+bool CmdResponse_InfoServer::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_cur_meta()) {
+    if (!_impl_.cur_meta_->IsInitialized()) return false;
   }
+  return true;
 }
 
-void CmdResponse_Mget::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_Mget::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Mget_descriptor_;
+void CmdResponse_InfoServer::InternalSwap(CmdResponse_InfoServer* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.table_names_.InternalSwap(&other->_impl_.table_names_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_InfoServer, _impl_.meta_renewing_)
+      + sizeof(CmdResponse_InfoServer::_impl_.meta_renewing_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_InfoServer, _impl_.cur_meta_)>(
+          reinterpret_cast<char*>(&_impl_.cur_meta_),
+          reinterpret_cast<char*>(&other->_impl_.cur_meta_));
 }
 
-const CmdResponse_Mget& CmdResponse_Mget::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_InfoServer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[27]);
 }
 
-CmdResponse_Mget* CmdResponse_Mget::default_instance_ = NULL;
-
-CmdResponse_Mget* CmdResponse_Mget::New() const {
-  return new CmdResponse_Mget;
-}
+// ===================================================================
 
-void CmdResponse_Mget::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
-    }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
-    }
+class CmdResponse_Subscribe_Record::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Subscribe_Record>()._impl_._has_bits_);
+  static void set_has_partition(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::SyncOffset& cursor(const CmdResponse_Subscribe_Record* msg);
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001d) ^ 0x0000001d) != 0;
+  }
+};
+
+const ::client::SyncOffset&
+CmdResponse_Subscribe_Record::_Internal::cursor(const CmdResponse_Subscribe_Record* msg) {
+  return *msg->_impl_.cursor_;
+}
+CmdResponse_Subscribe_Record::CmdResponse_Subscribe_Record(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Subscribe.Record)
+}
+CmdResponse_Subscribe_Record::CmdResponse_Subscribe_Record(const CmdResponse_Subscribe_Record& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Subscribe_Record* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.cursor_){nullptr}
+    , decltype(_impl_.partition_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_ = new ::client::SyncOffset(*from._impl_.cursor_);
+  }
+  ::memcpy(&_impl_.partition_, &from._impl_.partition_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.partition_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Subscribe.Record)
+}
+
+inline void CmdResponse_Subscribe_Record::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.cursor_){nullptr}
+    , decltype(_impl_.partition_){0}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse_Subscribe_Record::~CmdResponse_Subscribe_Record() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Subscribe.Record)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  SharedDtor();
 }
 
-bool CmdResponse_Mget::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string key = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_key()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->key().data(), this->key().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_value;
-        break;
-      }
-
-      // required bytes value = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+inline void CmdResponse_Subscribe_Record::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.cursor_;
+}
+
+void CmdResponse_Subscribe_Record::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Subscribe_Record::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Subscribe.Record)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.cursor_ != nullptr);
+      _impl_.cursor_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000018u) {
+    ::memset(&_impl_.partition_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.partition_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Subscribe_Record::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 partition = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_partition(&has_bits);
+          _impl_.partition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.Type type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::client::Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.SyncOffset cursor = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Subscribe_Record::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Subscribe.Record)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 partition = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_partition(), target);
+  }
+
+  // required .client.Type type = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // required bytes key = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // optional bytes value = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  // required .client.SyncOffset cursor = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::cursor(this),
+        _Internal::cursor(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Subscribe.Record)
+  return target;
 }
 
-void CmdResponse_Mget::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string key = 1;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->key(), output);
-  }
+size_t CmdResponse_Subscribe_Record::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.Subscribe.Record)
+  size_t total_size = 0;
 
-  // required bytes value = 2;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->value(), output);
+  if (_internal_has_key()) {
+    // required bytes key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (_internal_has_cursor()) {
+    // required .client.SyncOffset cursor = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cursor_);
   }
-}
 
-::google::protobuf::uint8* CmdResponse_Mget::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string key = 1;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->key(), target);
+  if (_internal_has_partition()) {
+    // required int32 partition = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
   }
 
-  // required bytes value = 2;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->value(), target);
+  if (_internal_has_type()) {
+    // required .client.Type type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t CmdResponse_Subscribe_Record::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Subscribe.Record)
+  size_t total_size = 0;
 
-int CmdResponse_Mget::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x0000001d) ^ 0x0000001d) == 0) {  // All required fields are present.
+    // required bytes key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string key = 1;
-    if (has_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->key());
-    }
+    // required .client.SyncOffset cursor = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cursor_);
 
-    // required bytes value = 2;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
-    }
+    // required int32 partition = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // required .client.Type type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
 
-void CmdResponse_Mget::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Mget* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Mget*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes value = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_Mget::MergeFrom(const CmdResponse_Mget& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_key()) {
-      set_key(from.key());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Subscribe_Record::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Subscribe_Record::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Subscribe_Record::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_Subscribe_Record::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Subscribe_Record*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Subscribe_Record&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Subscribe.Record)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_cursor()->::client::SyncOffset::MergeFrom(
+          from._internal_cursor());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.partition_ = from._impl_.partition_;
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_Mget::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdResponse_Subscribe_Record::CopyFrom(const CmdResponse_Subscribe_Record& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Subscribe.Record)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_Mget::CopyFrom(const CmdResponse_Mget& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool CmdResponse_Subscribe_Record::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_cursor()) {
+    if (!_impl_.cursor_->IsInitialized()) return false;
+  }
+  return true;
 }
 
-bool CmdResponse_Mget::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+void CmdResponse_Subscribe_Record::InternalSwap(CmdResponse_Subscribe_Record* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_Subscribe_Record, _impl_.type_)
+      + sizeof(CmdResponse_Subscribe_Record::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_Subscribe_Record, _impl_.cursor_)>(
+          reinterpret_cast<char*>(&_impl_.cursor_),
+          reinterpret_cast<char*>(&other->_impl_.cursor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Subscribe_Record::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[28]);
+}
 
-  return true;
+// ===================================================================
+
+class CmdResponse_Subscribe::_Internal {
+ public:
+};
+
+CmdResponse_Subscribe::CmdResponse_Subscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Subscribe)
+}
+CmdResponse_Subscribe::CmdResponse_Subscribe(const CmdResponse_Subscribe& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Subscribe* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.records_){from._impl_.records_}
+    , decltype(_impl_.cursors_){from._impl_.cursors_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Subscribe)
+}
+
+inline void CmdResponse_Subscribe::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.records_){arena}
+    , decltype(_impl_.cursors_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void CmdResponse_Mget::Swap(CmdResponse_Mget* other) {
-  if (other != this) {
-    std::swap(key_, other->key_);
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+CmdResponse_Subscribe::~CmdResponse_Subscribe() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Subscribe)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata CmdResponse_Mget::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Mget_descriptor_;
-  metadata.reflection = CmdResponse_Mget_reflection_;
-  return metadata;
+inline void CmdResponse_Subscribe::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.records_.~RepeatedPtrField();
+  _impl_.cursors_.~RepeatedPtrField();
+}
+
+void CmdResponse_Subscribe::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Subscribe::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Subscribe)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.records_.Clear();
+  _impl_.cursors_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Subscribe::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .client.CmdResponse.Subscribe.Record records = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_records(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.SyncOffset cursors = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_cursors(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Subscribe::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Subscribe)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .client.CmdResponse.Subscribe.Record records = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_records_size()); i < n; i++) {
+    const auto& repfield = this->_internal_records(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .client.SyncOffset cursors = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_cursors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_cursors(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Subscribe)
+  return target;
 }
 
+size_t CmdResponse_Subscribe::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Subscribe)
+  size_t total_size = 0;
 
-// -------------------------------------------------------------------
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-#ifndef _MSC_VER
-const int CmdResponse_InfoServer::kEpochFieldNumber;
-const int CmdResponse_InfoServer::kTableNamesFieldNumber;
-const int CmdResponse_InfoServer::kCurMetaFieldNumber;
-const int CmdResponse_InfoServer::kMetaRenewingFieldNumber;
-#endif  // !_MSC_VER
+  // repeated .client.CmdResponse.Subscribe.Record records = 1;
+  total_size += 1UL * this->_internal_records_size();
+  for (const auto& msg : this->_impl_.records_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-CmdResponse_InfoServer::CmdResponse_InfoServer()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  // repeated .client.SyncOffset cursors = 2;
+  total_size += 1UL * this->_internal_cursors_size();
+  for (const auto& msg : this->_impl_.cursors_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-void CmdResponse_InfoServer::InitAsDefaultInstance() {
-  cur_meta_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-CmdResponse_InfoServer::CmdResponse_InfoServer(const CmdResponse_InfoServer& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Subscribe::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Subscribe::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Subscribe::GetClassData() const { return &_class_data_; }
 
-void CmdResponse_InfoServer::SharedCtor() {
-  _cached_size_ = 0;
-  epoch_ = GOOGLE_LONGLONG(0);
-  cur_meta_ = NULL;
-  meta_renewing_ = false;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
 
-CmdResponse_InfoServer::~CmdResponse_InfoServer() {
-  SharedDtor();
-}
+void CmdResponse_Subscribe::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Subscribe*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Subscribe&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Subscribe)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void CmdResponse_InfoServer::SharedDtor() {
-  if (this != default_instance_) {
-    delete cur_meta_;
-  }
+  _this->_impl_.records_.MergeFrom(from._impl_.records_);
+  _this->_impl_.cursors_.MergeFrom(from._impl_.cursors_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_InfoServer::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_InfoServer::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoServer_descriptor_;
+void CmdResponse_Subscribe::CopyFrom(const CmdResponse_Subscribe& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Subscribe)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-const CmdResponse_InfoServer& CmdResponse_InfoServer::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+bool CmdResponse_Subscribe::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.records_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.cursors_))
+    return false;
+  return true;
 }
 
-CmdResponse_InfoServer* CmdResponse_InfoServer::default_instance_ = NULL;
+void CmdResponse_Subscribe::InternalSwap(CmdResponse_Subscribe* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.records_.InternalSwap(&other->_impl_.records_);
+  _impl_.cursors_.InternalSwap(&other->_impl_.cursors_);
+}
 
-CmdResponse_InfoServer* CmdResponse_InfoServer::New() const {
-  return new CmdResponse_InfoServer;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Subscribe::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[29]);
 }
 
-void CmdResponse_InfoServer::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    epoch_ = GOOGLE_LONGLONG(0);
-    if (has_cur_meta()) {
-      if (cur_meta_ != NULL) cur_meta_->::client::Node::Clear();
-    }
-    meta_renewing_ = false;
+// ===================================================================
+
+class CmdResponse_KeyResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_KeyResult>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::Node& redirect(const CmdResponse_KeyResult* msg);
+  static void set_has_redirect(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000009) ^ 0x00000009) != 0;
+  }
+};
+
+const ::client::Node&
+CmdResponse_KeyResult::_Internal::redirect(const CmdResponse_KeyResult* msg) {
+  return *msg->_impl_.redirect_;
+}
+CmdResponse_KeyResult::CmdResponse_KeyResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.KeyResult)
+}
+CmdResponse_KeyResult::CmdResponse_KeyResult(const CmdResponse_KeyResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_KeyResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.redirect_){nullptr}
+    , decltype(_impl_.code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_redirect()) {
+    _this->_impl_.redirect_ = new ::client::Node(*from._impl_.redirect_);
+  }
+  _this->_impl_.code_ = from._impl_.code_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.KeyResult)
+}
+
+inline void CmdResponse_KeyResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.redirect_){nullptr}
+    , decltype(_impl_.code_){0}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse_KeyResult::~CmdResponse_KeyResult() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.KeyResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  table_names_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  SharedDtor();
 }
 
-bool CmdResponse_InfoServer::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required int64 epoch = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &epoch_)));
-          set_has_epoch();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_table_names;
-        break;
-      }
+inline void CmdResponse_KeyResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.msg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.redirect_;
+}
 
-      // repeated string table_names = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_table_names:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_table_names()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_names(this->table_names_size() - 1).data(),
-            this->table_names(this->table_names_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_table_names;
-        if (input->ExpectTag(26)) goto parse_cur_meta;
-        break;
-      }
+void CmdResponse_KeyResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-      // required .client.Node cur_meta = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_cur_meta:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_cur_meta()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_meta_renewing;
-        break;
-      }
+void CmdResponse_KeyResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.KeyResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-      // required bool meta_renewing = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_meta_renewing:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &meta_renewing_)));
-          set_has_meta_renewing();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.msg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.redirect_ != nullptr);
+      _impl_.redirect_->Clear();
     }
   }
-  return true;
-#undef DO_
+  _impl_.code_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_InfoServer::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required int64 epoch = 1;
-  if (has_epoch()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->epoch(), output);
+const char* CmdResponse_KeyResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.KeyResult.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .client.StatusCode code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::StatusCode_IsValid(val))) {
+            _internal_set_code(static_cast<::client::StatusCode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string msg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.KeyResult.msg");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.Node redirect = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_redirect(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_KeyResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.KeyResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.KeyResult.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
   }
 
-  // repeated string table_names = 2;
-  for (int i = 0; i < this->table_names_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->table_names(i).data(), this->table_names(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->table_names(i), output);
+  // required .client.StatusCode code = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_code(), target);
   }
 
-  // required .client.Node cur_meta = 3;
-  if (has_cur_meta()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->cur_meta(), output);
+  // optional string msg = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.KeyResult.msg");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_msg(), target);
   }
 
-  // required bool meta_renewing = 4;
-  if (has_meta_renewing()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->meta_renewing(), output);
+  // optional .client.Node redirect = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::redirect(this),
+        _Internal::redirect(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.KeyResult)
+  return target;
 }
 
-::google::protobuf::uint8* CmdResponse_InfoServer::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int64 epoch = 1;
-  if (has_epoch()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->epoch(), target);
-  }
-
-  // repeated string table_names = 2;
-  for (int i = 0; i < this->table_names_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_names(i).data(), this->table_names(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(2, this->table_names(i), target);
-  }
+size_t CmdResponse_KeyResult::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse.KeyResult)
+  size_t total_size = 0;
 
-  // required .client.Node cur_meta = 3;
-  if (has_cur_meta()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->cur_meta(), target);
+  if (_internal_has_key()) {
+    // required string key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
 
-  // required bool meta_renewing = 4;
-  if (has_meta_renewing()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->meta_renewing(), target);
+  if (_internal_has_code()) {
+    // required .client.StatusCode code = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t CmdResponse_KeyResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.KeyResult)
+  size_t total_size = 0;
 
-int CmdResponse_InfoServer::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x00000009) ^ 0x00000009) == 0) {  // All required fields are present.
+    // required string key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int64 epoch = 1;
-    if (has_epoch()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->epoch());
-    }
+    // required .client.StatusCode code = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
 
-    // required .client.Node cur_meta = 3;
-    if (has_cur_meta()) {
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional string msg = 3;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->cur_meta());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_msg());
     }
 
-    // required bool meta_renewing = 4;
-    if (has_meta_renewing()) {
-      total_size += 1 + 1;
+    // optional .client.Node redirect = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.redirect_);
     }
 
   }
-  // repeated string table_names = 2;
-  total_size += 1 * this->table_names_size();
-  for (int i = 0; i < this->table_names_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->table_names(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_InfoServer::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoServer* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoServer*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_KeyResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_KeyResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_KeyResult::GetClassData() const { return &_class_data_; }
+
 
-void CmdResponse_InfoServer::MergeFrom(const CmdResponse_InfoServer& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  table_names_.MergeFrom(from.table_names_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_epoch()) {
-      set_epoch(from.epoch());
+void CmdResponse_KeyResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_KeyResult*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_KeyResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.KeyResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_msg(from._internal_msg());
     }
-    if (from.has_cur_meta()) {
-      mutable_cur_meta()->::client::Node::MergeFrom(from.cur_meta());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_redirect()->::client::Node::MergeFrom(
+          from._internal_redirect());
     }
-    if (from.has_meta_renewing()) {
-      set_meta_renewing(from.meta_renewing());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.code_ = from._impl_.code_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse_InfoServer::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdResponse_KeyResult::CopyFrom(const CmdResponse_KeyResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.KeyResult)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoServer::CopyFrom(const CmdResponse_InfoServer& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool CmdResponse_KeyResult::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_redirect()) {
+    if (!_impl_.redirect_->IsInitialized()) return false;
+  }
+  return true;
 }
 
-bool CmdResponse_InfoServer::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000d) != 0x0000000d) return false;
+void CmdResponse_KeyResult::InternalSwap(CmdResponse_KeyResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_KeyResult, _impl_.code_)
+      + sizeof(CmdResponse_KeyResult::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_KeyResult, _impl_.redirect_)>(
+          reinterpret_cast<char*>(&_impl_.redirect_),
+          reinterpret_cast<char*>(&other->_impl_.redirect_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_KeyResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[30]);
+}
 
-  if (has_cur_meta()) {
-    if (!this->cur_meta().IsInitialized()) return false;
-  }
-  return true;
+// ===================================================================
+
+class CmdResponse_Incrby::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Incrby>()._impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CmdResponse_Incrby::CmdResponse_Incrby(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Incrby)
+}
+CmdResponse_Incrby::CmdResponse_Incrby(const CmdResponse_Incrby& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Incrby* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.value_ = from._impl_.value_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Incrby)
+}
+
+inline void CmdResponse_Incrby::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.value_){int64_t{0}}
+  };
 }
 
-void CmdResponse_InfoServer::Swap(CmdResponse_InfoServer* other) {
-  if (other != this) {
-    std::swap(epoch_, other->epoch_);
-    table_names_.Swap(&other->table_names_);
-    std::swap(cur_meta_, other->cur_meta_);
-    std::swap(meta_renewing_, other->meta_renewing_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+CmdResponse_Incrby::~CmdResponse_Incrby() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Incrby)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata CmdResponse_InfoServer::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoServer_descriptor_;
-  metadata.reflection = CmdResponse_InfoServer_reflection_;
-  return metadata;
+inline void CmdResponse_Incrby::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CmdResponse_Incrby::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Incrby::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Incrby)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Incrby::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_value(&has_bits);
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Incrby::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Incrby)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 value = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Incrby)
+  return target;
 }
 
+size_t CmdResponse_Incrby::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Incrby)
+  size_t total_size = 0;
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse::kTypeFieldNumber;
-const int CmdResponse::kCodeFieldNumber;
-const int CmdResponse::kMsgFieldNumber;
-const int CmdResponse::kSyncFieldNumber;
-const int CmdResponse::kGetFieldNumber;
-const int CmdResponse::kRedirectFieldNumber;
-const int CmdResponse::kInfoStatsFieldNumber;
-const int CmdResponse::kInfoCapacityFieldNumber;
-const int CmdResponse::kInfoReplFieldNumber;
-const int CmdResponse::kMgetFieldNumber;
-const int CmdResponse::kInfoServerFieldNumber;
-#endif  // !_MSC_VER
+  // required int64 value = 1;
+  if (_internal_has_value()) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_value());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-CmdResponse::CmdResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse::InitAsDefaultInstance() {
-  sync_ = const_cast< ::client::CmdResponse_Sync*>(&::client::CmdResponse_Sync::default_instance());
-  get_ = const_cast< ::client::CmdResponse_Get*>(&::client::CmdResponse_Get::default_instance());
-  redirect_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
-  info_server_ = const_cast< ::client::CmdResponse_InfoServer*>(&::client::CmdResponse_InfoServer::default_instance());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Incrby::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Incrby::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Incrby::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_Incrby::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Incrby*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Incrby&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Incrby)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_value()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-CmdResponse::CmdResponse(const CmdResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+void CmdResponse_Incrby::CopyFrom(const CmdResponse_Incrby& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Incrby)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void CmdResponse::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  code_ = 0;
-  msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  sync_ = NULL;
-  get_ = NULL;
-  redirect_ = NULL;
-  info_server_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool CmdResponse_Incrby::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-CmdResponse::~CmdResponse() {
-  SharedDtor();
+void CmdResponse_Incrby::InternalSwap(CmdResponse_Incrby* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Incrby::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[31]);
+}
+
+// ===================================================================
+
+class CmdResponse_Append::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Append>()._impl_._has_bits_);
+  static void set_has_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CmdResponse_Append::CmdResponse_Append(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse.Append)
+}
+CmdResponse_Append::CmdResponse_Append(const CmdResponse_Append& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Append* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.length_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.length_ = from._impl_.length_;
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse.Append)
+}
+
+inline void CmdResponse_Append::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.length_){int64_t{0}}
+  };
 }
 
-void CmdResponse::SharedDtor() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
+CmdResponse_Append::~CmdResponse_Append() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse.Append)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  if (this != default_instance_) {
-    delete sync_;
-    delete get_;
-    delete redirect_;
-    delete info_server_;
+  SharedDtor();
+}
+
+inline void CmdResponse_Append::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CmdResponse_Append::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_Append::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse.Append)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.length_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Append::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 length = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_length(&has_bits);
+          _impl_.length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Append::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse.Append)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 length = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_length(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse.Append)
+  return target;
+}
+
+size_t CmdResponse_Append::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse.Append)
+  size_t total_size = 0;
+
+  // required int64 length = 1;
+  if (_internal_has_length()) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_length());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Append::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Append::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Append::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_Append::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Append*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Append&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse.Append)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_length()) {
+    _this->_internal_set_length(from._internal_length());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-const ::google::protobuf::Descriptor* CmdResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_descriptor_;
+
+void CmdResponse_Append::CopyFrom(const CmdResponse_Append& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse.Append)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-const CmdResponse& CmdResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+bool CmdResponse_Append::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-CmdResponse* CmdResponse::default_instance_ = NULL;
+void CmdResponse_Append::InternalSwap(CmdResponse_Append* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.length_, other->_impl_.length_);
+}
 
-CmdResponse* CmdResponse::New() const {
-  return new CmdResponse;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Append::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[32]);
 }
 
-void CmdResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    code_ = 0;
-    if (has_msg()) {
-      if (msg_ != &::google::protobuf::internal::kEmptyString) {
-        msg_->clear();
-      }
-    }
-    if (has_sync()) {
-      if (sync_ != NULL) sync_->::client::CmdResponse_Sync::Clear();
-    }
-    if (has_get()) {
-      if (get_ != NULL) get_->::client::CmdResponse_Get::Clear();
-    }
-    if (has_redirect()) {
-      if (redirect_ != NULL) redirect_->::client::Node::Clear();
-    }
+// ===================================================================
+
+class CmdResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
   }
-  if (_has_bits_[10 / 32] & (0xffu << (10 % 32))) {
-    if (has_info_server()) {
-      if (info_server_ != NULL) info_server_->::client::CmdResponse_InfoServer::Clear();
-    }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::client::CmdResponse_Sync& sync(const CmdResponse* msg);
+  static void set_has_sync(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::CmdResponse_Get& get(const CmdResponse* msg);
+  static void set_has_get(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::client::Node& redirect(const CmdResponse* msg);
+  static void set_has_redirect(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::client::CmdResponse_InfoServer& info_server(const CmdResponse* msg);
+  static void set_has_info_server(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::client::CmdResponse_Subscribe& subscribe(const CmdResponse* msg);
+  static void set_has_subscribe(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::client::CmdResponse_Incrby& incrby(const CmdResponse* msg);
+  static void set_has_incrby(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::client::CmdResponse_Append& append(const CmdResponse* msg);
+  static void set_has_append(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000300) ^ 0x00000300) != 0;
   }
-  info_stats_.Clear();
-  info_capacity_.Clear();
-  info_repl_.Clear();
-  mget_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+};
+
+const ::client::CmdResponse_Sync&
+CmdResponse::_Internal::sync(const CmdResponse* msg) {
+  return *msg->_impl_.sync_;
+}
+const ::client::CmdResponse_Get&
+CmdResponse::_Internal::get(const CmdResponse* msg) {
+  return *msg->_impl_.get_;
+}
+const ::client::Node&
+CmdResponse::_Internal::redirect(const CmdResponse* msg) {
+  return *msg->_impl_.redirect_;
+}
+const ::client::CmdResponse_InfoServer&
+CmdResponse::_Internal::info_server(const CmdResponse* msg) {
+  return *msg->_impl_.info_server_;
+}
+const ::client::CmdResponse_Subscribe&
+CmdResponse::_Internal::subscribe(const CmdResponse* msg) {
+  return *msg->_impl_.subscribe_;
+}
+const ::client::CmdResponse_Incrby&
+CmdResponse::_Internal::incrby(const CmdResponse* msg) {
+  return *msg->_impl_.incrby_;
+}
+const ::client::CmdResponse_Append&
+CmdResponse::_Internal::append(const CmdResponse* msg) {
+  return *msg->_impl_.append_;
+}
+CmdResponse::CmdResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.CmdResponse)
+}
+CmdResponse::CmdResponse(const CmdResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.info_stats_){from._impl_.info_stats_}
+    , decltype(_impl_.info_capacity_){from._impl_.info_capacity_}
+    , decltype(_impl_.info_repl_){from._impl_.info_repl_}
+    , decltype(_impl_.mget_){from._impl_.mget_}
+    , decltype(_impl_.msync_){from._impl_.msync_}
+    , decltype(_impl_.key_results_){from._impl_.key_results_}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.sync_){nullptr}
+    , decltype(_impl_.get_){nullptr}
+    , decltype(_impl_.redirect_){nullptr}
+    , decltype(_impl_.info_server_){nullptr}
+    , decltype(_impl_.subscribe_){nullptr}
+    , decltype(_impl_.incrby_){nullptr}
+    , decltype(_impl_.append_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_sync()) {
+    _this->_impl_.sync_ = new ::client::CmdResponse_Sync(*from._impl_.sync_);
+  }
+  if (from._internal_has_get()) {
+    _this->_impl_.get_ = new ::client::CmdResponse_Get(*from._impl_.get_);
+  }
+  if (from._internal_has_redirect()) {
+    _this->_impl_.redirect_ = new ::client::Node(*from._impl_.redirect_);
+  }
+  if (from._internal_has_info_server()) {
+    _this->_impl_.info_server_ = new ::client::CmdResponse_InfoServer(*from._impl_.info_server_);
+  }
+  if (from._internal_has_subscribe()) {
+    _this->_impl_.subscribe_ = new ::client::CmdResponse_Subscribe(*from._impl_.subscribe_);
+  }
+  if (from._internal_has_incrby()) {
+    _this->_impl_.incrby_ = new ::client::CmdResponse_Incrby(*from._impl_.incrby_);
+  }
+  if (from._internal_has_append()) {
+    _this->_impl_.append_ = new ::client::CmdResponse_Append(*from._impl_.append_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.code_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.code_));
+  // @@protoc_insertion_point(copy_constructor:client.CmdResponse)
+}
+
+inline void CmdResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.info_stats_){arena}
+    , decltype(_impl_.info_capacity_){arena}
+    , decltype(_impl_.info_repl_){arena}
+    , decltype(_impl_.mget_){arena}
+    , decltype(_impl_.msync_){arena}
+    , decltype(_impl_.key_results_){arena}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.sync_){nullptr}
+    , decltype(_impl_.get_){nullptr}
+    , decltype(_impl_.redirect_){nullptr}
+    , decltype(_impl_.info_server_){nullptr}
+    , decltype(_impl_.subscribe_){nullptr}
+    , decltype(_impl_.incrby_){nullptr}
+    , decltype(_impl_.append_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.code_){0}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdResponse::~CmdResponse() {
+  // @@protoc_insertion_point(destructor:client.CmdResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-bool CmdResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+inline void CmdResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.info_stats_.~RepeatedPtrField();
+  _impl_.info_capacity_.~RepeatedPtrField();
+  _impl_.info_repl_.~RepeatedPtrField();
+  _impl_.mget_.~RepeatedPtrField();
+  _impl_.msync_.~RepeatedPtrField();
+  _impl_.key_results_.~RepeatedPtrField();
+  _impl_.msg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.sync_;
+  if (this != internal_default_instance()) delete _impl_.get_;
+  if (this != internal_default_instance()) delete _impl_.redirect_;
+  if (this != internal_default_instance()) delete _impl_.info_server_;
+  if (this != internal_default_instance()) delete _impl_.subscribe_;
+  if (this != internal_default_instance()) delete _impl_.incrby_;
+  if (this != internal_default_instance()) delete _impl_.append_;
+}
+
+void CmdResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.CmdResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.info_stats_.Clear();
+  _impl_.info_capacity_.Clear();
+  _impl_.info_repl_.Clear();
+  _impl_.mget_.Clear();
+  _impl_.msync_.Clear();
+  _impl_.key_results_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.msg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.sync_ != nullptr);
+      _impl_.sync_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.get_ != nullptr);
+      _impl_.get_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.redirect_ != nullptr);
+      _impl_.redirect_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.info_server_ != nullptr);
+      _impl_.info_server_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.subscribe_ != nullptr);
+      _impl_.subscribe_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.incrby_ != nullptr);
+      _impl_.incrby_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.append_ != nullptr);
+      _impl_.append_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.code_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.code_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .client.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::Type_IsValid(value)) {
-            set_type(static_cast< ::client::Type >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::client::Type>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_code;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required .client.StatusCode code = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_code:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::StatusCode_IsValid(value)) {
-            set_code(static_cast< ::client::StatusCode >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::StatusCode_IsValid(val))) {
+            _internal_set_code(static_cast<::client::StatusCode>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_msg;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional string msg = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_msg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_sync;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.CmdResponse.msg");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional .client.CmdResponse.Sync sync = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_get;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .client.CmdResponse.Get get = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_get:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_get()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_redirect;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_get(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .client.Node redirect = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_redirect:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_redirect()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_info_stats;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_redirect(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .client.CmdResponse.InfoStats info_stats = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_stats:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info_stats()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_info_stats;
-        if (input->ExpectTag(66)) goto parse_info_capacity;
-        break;
-      }
-
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_info_stats(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_capacity:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info_capacity()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_info_capacity;
-        if (input->ExpectTag(74)) goto parse_info_repl;
-        break;
-      }
-
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_info_capacity(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_repl:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info_repl()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(74)) goto parse_info_repl;
-        if (input->ExpectTag(82)) goto parse_mget;
-        break;
-      }
-
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_info_repl(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .client.CmdResponse.Mget mget = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_mget:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_mget()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(82)) goto parse_mget;
-        if (input->ExpectTag(90)) goto parse_info_server;
-        break;
-      }
-
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_mget(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional .client.CmdResponse.InfoServer info_server = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_server:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_info_server()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_info_server(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.CmdResponse msync = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_msync(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdResponse.Subscribe subscribe = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_subscribe(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .client.CmdResponse.KeyResult key_results = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_key_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdResponse.Incrby incrby = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_incrby(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.CmdResponse.Append append = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_append(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.CmdResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .client.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // required .client.StatusCode code = 2;
-  if (has_code()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->code(), output);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_code(), target);
   }
 
   // optional string msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->msg(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.CmdResponse.msg");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_msg(), target);
   }
 
   // optional .client.CmdResponse.Sync sync = 4;
-  if (has_sync()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->sync(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::sync(this),
+        _Internal::sync(this).GetCachedSize(), target, stream);
   }
 
   // optional .client.CmdResponse.Get get = 5;
-  if (has_get()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->get(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::get(this),
+        _Internal::get(this).GetCachedSize(), target, stream);
   }
 
   // optional .client.Node redirect = 6;
-  if (has_redirect()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->redirect(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::redirect(this),
+        _Internal::redirect(this).GetCachedSize(), target, stream);
   }
 
   // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  for (int i = 0; i < this->info_stats_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->info_stats(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_info_stats_size()); i < n; i++) {
+    const auto& repfield = this->_internal_info_stats(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  for (int i = 0; i < this->info_capacity_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->info_capacity(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_info_capacity_size()); i < n; i++) {
+    const auto& repfield = this->_internal_info_capacity(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  for (int i = 0; i < this->info_repl_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, this->info_repl(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_info_repl_size()); i < n; i++) {
+    const auto& repfield = this->_internal_info_repl(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .client.CmdResponse.Mget mget = 10;
-  for (int i = 0; i < this->mget_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->mget(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_mget_size()); i < n; i++) {
+    const auto& repfield = this->_internal_mget(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional .client.CmdResponse.InfoServer info_server = 11;
-  if (has_info_server()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->info_server(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::info_server(this),
+        _Internal::info_server(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // repeated .client.CmdResponse msync = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_msync_size()); i < n; i++) {
+    const auto& repfield = this->_internal_msync(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* CmdResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  // optional .client.CmdResponse.Subscribe subscribe = 13;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::subscribe(this),
+        _Internal::subscribe(this).GetCachedSize(), target, stream);
   }
 
-  // required .client.StatusCode code = 2;
-  if (has_code()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->code(), target);
+  // repeated .client.CmdResponse.KeyResult key_results = 14;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_key_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_key_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(14, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional string msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->msg(), target);
+  // optional .client.CmdResponse.Incrby incrby = 15;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::incrby(this),
+        _Internal::incrby(this).GetCachedSize(), target, stream);
   }
 
-  // optional .client.CmdResponse.Sync sync = 4;
-  if (has_sync()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->sync(), target);
+  // optional .client.CmdResponse.Append append = 16;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::append(this),
+        _Internal::append(this).GetCachedSize(), target, stream);
   }
 
-  // optional .client.CmdResponse.Get get = 5;
-  if (has_get()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->get(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.CmdResponse)
+  return target;
+}
 
-  // optional .client.Node redirect = 6;
-  if (has_redirect()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->redirect(), target);
+size_t CmdResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.CmdResponse)
+  size_t total_size = 0;
+
+  if (_internal_has_type()) {
+    // required .client.Type type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
+  if (_internal_has_code()) {
+    // required .client.StatusCode code = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
+  }
+
+  return total_size;
+}
+size_t CmdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.CmdResponse)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000300) ^ 0x00000300) == 0) {  // All required fields are present.
+    // required .client.Type type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+
+    // required .client.StatusCode code = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  for (int i = 0; i < this->info_stats_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->info_stats(i), target);
+  total_size += 1UL * this->_internal_info_stats_size();
+  for (const auto& msg : this->_impl_.info_stats_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  for (int i = 0; i < this->info_capacity_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        8, this->info_capacity(i), target);
+  total_size += 1UL * this->_internal_info_capacity_size();
+  for (const auto& msg : this->_impl_.info_capacity_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  for (int i = 0; i < this->info_repl_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        9, this->info_repl(i), target);
+  total_size += 1UL * this->_internal_info_repl_size();
+  for (const auto& msg : this->_impl_.info_repl_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .client.CmdResponse.Mget mget = 10;
-  for (int i = 0; i < this->mget_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        10, this->mget(i), target);
+  total_size += 1UL * this->_internal_mget_size();
+  for (const auto& msg : this->_impl_.mget_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional .client.CmdResponse.InfoServer info_server = 11;
-  if (has_info_server()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        11, this->info_server(), target);
+  // repeated .client.CmdResponse msync = 12;
+  total_size += 1UL * this->_internal_msync_size();
+  for (const auto& msg : this->_impl_.msync_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated .client.CmdResponse.KeyResult key_results = 14;
+  total_size += 1UL * this->_internal_key_results_size();
+  for (const auto& msg : this->_impl_.key_results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  return target;
-}
 
-int CmdResponse::ByteSize() const {
-  int total_size = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string msg = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_msg());
+    }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .client.Type type = 1;
-    if (has_type()) {
+    // optional .client.CmdResponse.Sync sync = 4;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sync_);
     }
 
-    // required .client.StatusCode code = 2;
-    if (has_code()) {
+    // optional .client.CmdResponse.Get get = 5;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->code());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_);
     }
 
-    // optional string msg = 3;
-    if (has_msg()) {
+    // optional .client.Node redirect = 6;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->msg());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.redirect_);
     }
 
-    // optional .client.CmdResponse.Sync sync = 4;
-    if (has_sync()) {
+    // optional .client.CmdResponse.InfoServer info_server = 11;
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.info_server_);
     }
 
-    // optional .client.CmdResponse.Get get = 5;
-    if (has_get()) {
+    // optional .client.CmdResponse.Subscribe subscribe = 13;
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->get());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.subscribe_);
     }
 
-    // optional .client.Node redirect = 6;
-    if (has_redirect()) {
+    // optional .client.CmdResponse.Incrby incrby = 15;
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->redirect());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.incrby_);
+    }
+
+    // optional .client.CmdResponse.Append append = 16;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.append_);
     }
 
   }
-  if (_has_bits_[10 / 32] & (0xffu << (10 % 32))) {
-    // optional .client.CmdResponse.InfoServer info_server = 11;
-    if (has_info_server()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->info_server());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse*>(&to_msg);
+  auto& from = static_cast<const CmdResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.CmdResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.info_stats_.MergeFrom(from._impl_.info_stats_);
+  _this->_impl_.info_capacity_.MergeFrom(from._impl_.info_capacity_);
+  _this->_impl_.info_repl_.MergeFrom(from._impl_.info_repl_);
+  _this->_impl_.mget_.MergeFrom(from._impl_.mget_);
+  _this->_impl_.msync_.MergeFrom(from._impl_.msync_);
+  _this->_impl_.key_results_.MergeFrom(from._impl_.key_results_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_msg(from._internal_msg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_sync()->::client::CmdResponse_Sync::MergeFrom(
+          from._internal_sync());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_get()->::client::CmdResponse_Get::MergeFrom(
+          from._internal_get());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_redirect()->::client::Node::MergeFrom(
+          from._internal_redirect());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_info_server()->::client::CmdResponse_InfoServer::MergeFrom(
+          from._internal_info_server());
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_subscribe()->::client::CmdResponse_Subscribe::MergeFrom(
+          from._internal_subscribe());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_incrby()->::client::CmdResponse_Incrby::MergeFrom(
+          from._internal_incrby());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_append()->::client::CmdResponse_Append::MergeFrom(
+          from._internal_append());
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.code_ = from._impl_.code_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
+void CmdResponse::CopyFrom(const CmdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.CmdResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.info_stats_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.info_capacity_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.info_repl_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.mget_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.msync_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.key_results_))
+    return false;
+  if (_internal_has_sync()) {
+    if (!_impl_.sync_->IsInitialized()) return false;
+  }
+  if (_internal_has_redirect()) {
+    if (!_impl_.redirect_->IsInitialized()) return false;
+  }
+  if (_internal_has_info_server()) {
+    if (!_impl_.info_server_->IsInitialized()) return false;
+  }
+  if (_internal_has_subscribe()) {
+    if (!_impl_.subscribe_->IsInitialized()) return false;
+  }
+  if (_internal_has_incrby()) {
+    if (!_impl_.incrby_->IsInitialized()) return false;
+  }
+  if (_internal_has_append()) {
+    if (!_impl_.append_->IsInitialized()) return false;
   }
-  // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  total_size += 1 * this->info_stats_size();
-  for (int i = 0; i < this->info_stats_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info_stats(i));
+  return true;
+}
+
+void CmdResponse::InternalSwap(CmdResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.info_stats_.InternalSwap(&other->_impl_.info_stats_);
+  _impl_.info_capacity_.InternalSwap(&other->_impl_.info_capacity_);
+  _impl_.info_repl_.InternalSwap(&other->_impl_.info_repl_);
+  _impl_.mget_.InternalSwap(&other->_impl_.mget_);
+  _impl_.msync_.InternalSwap(&other->_impl_.msync_);
+  _impl_.key_results_.InternalSwap(&other->_impl_.key_results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse, _impl_.code_)
+      + sizeof(CmdResponse::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse, _impl_.sync_)>(
+          reinterpret_cast<char*>(&_impl_.sync_),
+          reinterpret_cast<char*>(&other->_impl_.sync_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[33]);
+}
+
+// ===================================================================
+
+class BinlogSkip::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BinlogSkip>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_gap(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  total_size += 1 * this->info_capacity_size();
-  for (int i = 0; i < this->info_capacity_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info_capacity(i));
+BinlogSkip::BinlogSkip(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.BinlogSkip)
+}
+BinlogSkip::BinlogSkip(const BinlogSkip& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BinlogSkip* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.gap_){}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.gap_, &from._impl_.gap_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.partition_id_) -
+    reinterpret_cast<char*>(&_impl_.gap_)) + sizeof(_impl_.partition_id_));
+  // @@protoc_insertion_point(copy_constructor:client.BinlogSkip)
+}
+
+inline void BinlogSkip::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.gap_){int64_t{0}}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BinlogSkip::~BinlogSkip() {
+  // @@protoc_insertion_point(destructor:client.BinlogSkip)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  total_size += 1 * this->info_repl_size();
-  for (int i = 0; i < this->info_repl_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info_repl(i));
+inline void BinlogSkip::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+}
+
+void BinlogSkip::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BinlogSkip::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.BinlogSkip)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.gap_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.partition_id_) -
+        reinterpret_cast<char*>(&_impl_.gap_)) + sizeof(_impl_.partition_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BinlogSkip::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.BinlogSkip.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 partition_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 gap = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_gap(&has_bits);
+          _impl_.gap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BinlogSkip::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.BinlogSkip)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.BinlogSkip.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
-  // repeated .client.CmdResponse.Mget mget = 10;
-  total_size += 1 * this->mget_size();
-  for (int i = 0; i < this->mget_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->mget(i));
+  // required int32 partition_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // required int64 gap = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_gap(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.BinlogSkip)
+  return target;
+}
+
+size_t BinlogSkip::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.BinlogSkip)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  if (_internal_has_gap()) {
+    // required int64 gap = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_gap());
+  }
+
+  if (_internal_has_partition_id()) {
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t BinlogSkip::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.BinlogSkip)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required int64 gap = 3;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_gap());
+
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
 
-void CmdResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse::MergeFrom(const CmdResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  info_stats_.MergeFrom(from.info_stats_);
-  info_capacity_.MergeFrom(from.info_capacity_);
-  info_repl_.MergeFrom(from.info_repl_);
-  mget_.MergeFrom(from.mget_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_code()) {
-      set_code(from.code());
-    }
-    if (from.has_msg()) {
-      set_msg(from.msg());
-    }
-    if (from.has_sync()) {
-      mutable_sync()->::client::CmdResponse_Sync::MergeFrom(from.sync());
-    }
-    if (from.has_get()) {
-      mutable_get()->::client::CmdResponse_Get::MergeFrom(from.get());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BinlogSkip::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BinlogSkip::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BinlogSkip::GetClassData() const { return &_class_data_; }
+
+
+void BinlogSkip::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BinlogSkip*>(&to_msg);
+  auto& from = static_cast<const BinlogSkip&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.BinlogSkip)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_redirect()) {
-      mutable_redirect()->::client::Node::MergeFrom(from.redirect());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.gap_ = from._impl_.gap_;
     }
-  }
-  if (from._has_bits_[10 / 32] & (0xffu << (10 % 32))) {
-    if (from.has_info_server()) {
-      mutable_info_server()->::client::CmdResponse_InfoServer::MergeFrom(from.info_server());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdResponse::CopyFrom(const ::google::protobuf::Message& from) {
+void BinlogSkip::CopyFrom(const BinlogSkip& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.BinlogSkip)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse::CopyFrom(const CmdResponse& from) {
+bool BinlogSkip::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BinlogSkip::InternalSwap(BinlogSkip* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BinlogSkip, _impl_.partition_id_)
+      + sizeof(BinlogSkip::_impl_.partition_id_)
+      - PROTOBUF_FIELD_OFFSET(BinlogSkip, _impl_.gap_)>(
+          reinterpret_cast<char*>(&_impl_.gap_),
+          reinterpret_cast<char*>(&other->_impl_.gap_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BinlogSkip::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[34]);
+}
+
+// ===================================================================
+
+class BinlogAck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BinlogAck>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_credits(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+BinlogAck::BinlogAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.BinlogAck)
+}
+BinlogAck::BinlogAck(const BinlogAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BinlogAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){}
+    , decltype(_impl_.credits_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.partition_id_, &from._impl_.partition_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.credits_) -
+    reinterpret_cast<char*>(&_impl_.partition_id_)) + sizeof(_impl_.credits_));
+  // @@protoc_insertion_point(copy_constructor:client.BinlogAck)
+}
+
+inline void BinlogAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){0}
+    , decltype(_impl_.credits_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BinlogAck::~BinlogAck() {
+  // @@protoc_insertion_point(destructor:client.BinlogAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BinlogAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+}
+
+void BinlogAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BinlogAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.BinlogAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.partition_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.credits_) -
+        reinterpret_cast<char*>(&_impl_.partition_id_)) + sizeof(_impl_.credits_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BinlogAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.BinlogAck.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 partition_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 credits = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_credits(&has_bits);
+          _impl_.credits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BinlogAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.BinlogAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.BinlogAck.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
+  }
+
+  // required int32 partition_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition_id(), target);
+  }
+
+  // required int32 credits = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_credits(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.BinlogAck)
+  return target;
+}
+
+size_t BinlogAck::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.BinlogAck)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  if (_internal_has_partition_id()) {
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
+  }
+
+  if (_internal_has_credits()) {
+    // required int32 credits = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_credits());
+  }
+
+  return total_size;
+}
+size_t BinlogAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.BinlogAck)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
+
+    // required int32 credits = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_credits());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BinlogAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BinlogAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BinlogAck::GetClassData() const { return &_class_data_; }
+
+
+void BinlogAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BinlogAck*>(&to_msg);
+  auto& from = static_cast<const BinlogAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.BinlogAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.credits_ = from._impl_.credits_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BinlogAck::CopyFrom(const BinlogAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.BinlogAck)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool BinlogAck::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BinlogAck::InternalSwap(BinlogAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BinlogAck, _impl_.credits_)
+      + sizeof(BinlogAck::_impl_.credits_)
+      - PROTOBUF_FIELD_OFFSET(BinlogAck, _impl_.partition_id_)>(
+          reinterpret_cast<char*>(&_impl_.partition_id_),
+          reinterpret_cast<char*>(&other->_impl_.partition_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BinlogAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[35]);
+}
+
+// ===================================================================
+
+class BinlogResync::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BinlogResync>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+BinlogResync::BinlogResync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.BinlogResync)
+}
+BinlogResync::BinlogResync(const BinlogResync& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BinlogResync* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.partition_id_ = from._impl_.partition_id_;
+  // @@protoc_insertion_point(copy_constructor:client.BinlogResync)
+}
+
+inline void BinlogResync::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BinlogResync::~BinlogResync() {
+  // @@protoc_insertion_point(destructor:client.BinlogResync)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BinlogResync::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+}
+
+void BinlogResync::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BinlogResync::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.BinlogResync)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (has_sync()) {
-    if (!this->sync().IsInitialized()) return false;
-  }
-  if (has_redirect()) {
-    if (!this->redirect().IsInitialized()) return false;
-  }
-  for (int i = 0; i < info_stats_size(); i++) {
-    if (!this->info_stats(i).IsInitialized()) return false;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
   }
-  for (int i = 0; i < info_capacity_size(); i++) {
-    if (!this->info_capacity(i).IsInitialized()) return false;
-  }
-  for (int i = 0; i < info_repl_size(); i++) {
-    if (!this->info_repl(i).IsInitialized()) return false;
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BinlogResync::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.BinlogResync.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 partition_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BinlogResync::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.BinlogResync)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string table_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.BinlogResync.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
-  for (int i = 0; i < mget_size(); i++) {
-    if (!this->mget(i).IsInitialized()) return false;
+
+  // required int32 partition_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition_id(), target);
   }
-  if (has_info_server()) {
-    if (!this->info_server().IsInitialized()) return false;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  return true;
+  // @@protoc_insertion_point(serialize_to_array_end:client.BinlogResync)
+  return target;
 }
 
-void CmdResponse::Swap(CmdResponse* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(code_, other->code_);
-    std::swap(msg_, other->msg_);
-    std::swap(sync_, other->sync_);
-    std::swap(get_, other->get_);
-    std::swap(redirect_, other->redirect_);
-    info_stats_.Swap(&other->info_stats_);
-    info_capacity_.Swap(&other->info_capacity_);
-    info_repl_.Swap(&other->info_repl_);
-    mget_.Swap(&other->mget_);
-    std::swap(info_server_, other->info_server_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+size_t BinlogResync::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.BinlogResync)
+  size_t total_size = 0;
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
-}
 
-::google::protobuf::Metadata CmdResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_descriptor_;
-  metadata.reflection = CmdResponse_reflection_;
-  return metadata;
-}
+  if (_internal_has_partition_id()) {
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
+  }
 
+  return total_size;
+}
+size_t BinlogResync::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.BinlogResync)
+  size_t total_size = 0;
 
-// ===================================================================
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
 
-#ifndef _MSC_VER
-const int BinlogSkip::kTableNameFieldNumber;
-const int BinlogSkip::kPartitionIdFieldNumber;
-const int BinlogSkip::kGapFieldNumber;
-#endif  // !_MSC_VER
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
 
-BinlogSkip::BinlogSkip()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void BinlogSkip::InitAsDefaultInstance() {
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-BinlogSkip::BinlogSkip(const BinlogSkip& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BinlogResync::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BinlogResync::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BinlogResync::GetClassData() const { return &_class_data_; }
 
-void BinlogSkip::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_id_ = 0;
-  gap_ = GOOGLE_LONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
 
-BinlogSkip::~BinlogSkip() {
-  SharedDtor();
-}
+void BinlogResync::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BinlogResync*>(&to_msg);
+  auto& from = static_cast<const BinlogResync&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.BinlogResync)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void BinlogSkip::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (this != default_instance_) {
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BinlogSkip::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* BinlogSkip::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return BinlogSkip_descriptor_;
+void BinlogResync::CopyFrom(const BinlogResync& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.BinlogResync)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-const BinlogSkip& BinlogSkip::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+bool BinlogResync::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-BinlogSkip* BinlogSkip::default_instance_ = NULL;
-
-BinlogSkip* BinlogSkip::New() const {
-  return new BinlogSkip;
+void BinlogResync::InternalSwap(BinlogResync* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.partition_id_, other->_impl_.partition_id_);
 }
 
-void BinlogSkip::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    partition_id_ = 0;
-    gap_ = GOOGLE_LONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+::PROTOBUF_NAMESPACE_ID::Metadata BinlogResync::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[36]);
 }
 
-bool BinlogSkip::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_partition_id;
-        break;
-      }
+// ===================================================================
 
-      // required int32 partition_id = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_id_)));
-          set_has_partition_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_gap;
-        break;
-      }
+class BinlogHeartbeat::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BinlogHeartbeat>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+BinlogHeartbeat::BinlogHeartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.BinlogHeartbeat)
+}
+BinlogHeartbeat::BinlogHeartbeat(const BinlogHeartbeat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BinlogHeartbeat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.partition_id_ = from._impl_.partition_id_;
+  // @@protoc_insertion_point(copy_constructor:client.BinlogHeartbeat)
+}
+
+inline void BinlogHeartbeat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_id_){0}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-      // required int64 gap = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_gap:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &gap_)));
-          set_has_gap();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+BinlogHeartbeat::~BinlogHeartbeat() {
+  // @@protoc_insertion_point(destructor:client.BinlogHeartbeat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  return true;
-#undef DO_
+  SharedDtor();
 }
 
-void BinlogSkip::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
-  }
+inline void BinlogHeartbeat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
+}
 
-  // required int32 partition_id = 2;
-  if (has_partition_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
-  }
+void BinlogHeartbeat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  // required int64 gap = 3;
-  if (has_gap()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->gap(), output);
-  }
+void BinlogHeartbeat::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.BinlogHeartbeat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
   }
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-::google::protobuf::uint8* BinlogSkip::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+const char* BinlogHeartbeat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "client.BinlogHeartbeat.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 partition_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition_id(&has_bits);
+          _impl_.partition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BinlogHeartbeat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.BinlogHeartbeat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "client.BinlogHeartbeat.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // required int32 partition_id = 2;
-  if (has_partition_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition_id(), target);
   }
 
-  // required int64 gap = 3;
-  if (has_gap()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->gap(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:client.BinlogHeartbeat)
   return target;
 }
 
-int BinlogSkip::ByteSize() const {
-  int total_size = 0;
+size_t BinlogHeartbeat::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.BinlogHeartbeat)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_table_name()) {
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
 
+  if (_internal_has_partition_id()) {
     // required int32 partition_id = 2;
-    if (has_partition_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition_id());
-    }
-
-    // required int64 gap = 3;
-    if (has_gap()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->gap());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t BinlogHeartbeat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.BinlogHeartbeat)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+    // required int32 partition_id = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition_id());
 
-void BinlogSkip::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const BinlogSkip* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const BinlogSkip*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BinlogSkip::MergeFrom(const BinlogSkip& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
-    }
-    if (from.has_partition_id()) {
-      set_partition_id(from.partition_id());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BinlogHeartbeat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BinlogHeartbeat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BinlogHeartbeat::GetClassData() const { return &_class_data_; }
+
+
+void BinlogHeartbeat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BinlogHeartbeat*>(&to_msg);
+  auto& from = static_cast<const BinlogHeartbeat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.BinlogHeartbeat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_gap()) {
-      set_gap(from.gap());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_id_ = from._impl_.partition_id_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void BinlogSkip::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BinlogSkip::CopyFrom(const BinlogSkip& from) {
+void BinlogHeartbeat::CopyFrom(const BinlogHeartbeat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.BinlogHeartbeat)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BinlogSkip::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+bool BinlogHeartbeat::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void BinlogSkip::Swap(BinlogSkip* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(partition_id_, other->partition_id_);
-    std::swap(gap_, other->gap_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void BinlogHeartbeat::InternalSwap(BinlogHeartbeat* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.partition_id_, other->_impl_.partition_id_);
 }
 
-::google::protobuf::Metadata BinlogSkip::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = BinlogSkip_descriptor_;
-  metadata.reflection = BinlogSkip_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata BinlogHeartbeat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[37]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SyncRequest::kSyncTypeFieldNumber;
-const int SyncRequest::kEpochFieldNumber;
-const int SyncRequest::kFromFieldNumber;
-const int SyncRequest::kSyncOffsetFieldNumber;
-const int SyncRequest::kRequestFieldNumber;
-const int SyncRequest::kBinlogSkipFieldNumber;
-#endif  // !_MSC_VER
+class SyncRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncRequest>()._impl_._has_bits_);
+  static void set_has_sync_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::client::Node& from(const SyncRequest* msg);
+  static void set_has_from(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::client::SyncOffset& sync_offset(const SyncRequest* msg);
+  static void set_has_sync_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::client::CmdRequest& request(const SyncRequest* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::client::BinlogSkip& binlog_skip(const SyncRequest* msg);
+  static void set_has_binlog_skip(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::client::BinlogAck& binlog_ack(const SyncRequest* msg);
+  static void set_has_binlog_ack(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::client::SyncOffset& head(const SyncRequest* msg);
+  static void set_has_head(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_item_len(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::client::BinlogResync& binlog_resync(const SyncRequest* msg);
+  static void set_has_binlog_resync(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::client::BinlogHeartbeat& binlog_heartbeat(const SyncRequest* msg);
+  static void set_has_binlog_heartbeat(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000303) ^ 0x00000303) != 0;
+  }
+};
 
-SyncRequest::SyncRequest()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::client::Node&
+SyncRequest::_Internal::from(const SyncRequest* msg) {
+  return *msg->_impl_.from_;
 }
-
-void SyncRequest::InitAsDefaultInstance() {
-  from_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
-  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
-  request_ = const_cast< ::client::CmdRequest*>(&::client::CmdRequest::default_instance());
-  binlog_skip_ = const_cast< ::client::BinlogSkip*>(&::client::BinlogSkip::default_instance());
+const ::client::SyncOffset&
+SyncRequest::_Internal::sync_offset(const SyncRequest* msg) {
+  return *msg->_impl_.sync_offset_;
 }
-
-SyncRequest::SyncRequest(const SyncRequest& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::client::CmdRequest&
+SyncRequest::_Internal::request(const SyncRequest* msg) {
+  return *msg->_impl_.request_;
 }
-
-void SyncRequest::SharedCtor() {
-  _cached_size_ = 0;
-  sync_type_ = 0;
-  epoch_ = GOOGLE_LONGLONG(0);
-  from_ = NULL;
-  sync_offset_ = NULL;
-  request_ = NULL;
-  binlog_skip_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::client::BinlogSkip&
+SyncRequest::_Internal::binlog_skip(const SyncRequest* msg) {
+  return *msg->_impl_.binlog_skip_;
 }
-
-SyncRequest::~SyncRequest() {
-  SharedDtor();
+const ::client::BinlogAck&
+SyncRequest::_Internal::binlog_ack(const SyncRequest* msg) {
+  return *msg->_impl_.binlog_ack_;
 }
-
-void SyncRequest::SharedDtor() {
-  if (this != default_instance_) {
-    delete from_;
-    delete sync_offset_;
-    delete request_;
-    delete binlog_skip_;
-  }
+const ::client::SyncOffset&
+SyncRequest::_Internal::head(const SyncRequest* msg) {
+  return *msg->_impl_.head_;
 }
-
-void SyncRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::client::BinlogResync&
+SyncRequest::_Internal::binlog_resync(const SyncRequest* msg) {
+  return *msg->_impl_.binlog_resync_;
 }
-const ::google::protobuf::Descriptor* SyncRequest::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SyncRequest_descriptor_;
+const ::client::BinlogHeartbeat&
+SyncRequest::_Internal::binlog_heartbeat(const SyncRequest* msg) {
+  return *msg->_impl_.binlog_heartbeat_;
 }
-
-const SyncRequest& SyncRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
-  return *default_instance_;
+SyncRequest::SyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:client.SyncRequest)
+}
+SyncRequest::SyncRequest(const SyncRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.from_){nullptr}
+    , decltype(_impl_.sync_offset_){nullptr}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.binlog_skip_){nullptr}
+    , decltype(_impl_.binlog_ack_){nullptr}
+    , decltype(_impl_.head_){nullptr}
+    , decltype(_impl_.binlog_resync_){nullptr}
+    , decltype(_impl_.binlog_heartbeat_){nullptr}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.sync_type_){}
+    , decltype(_impl_.item_len_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_from()) {
+    _this->_impl_.from_ = new ::client::Node(*from._impl_.from_);
+  }
+  if (from._internal_has_sync_offset()) {
+    _this->_impl_.sync_offset_ = new ::client::SyncOffset(*from._impl_.sync_offset_);
+  }
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::client::CmdRequest(*from._impl_.request_);
+  }
+  if (from._internal_has_binlog_skip()) {
+    _this->_impl_.binlog_skip_ = new ::client::BinlogSkip(*from._impl_.binlog_skip_);
+  }
+  if (from._internal_has_binlog_ack()) {
+    _this->_impl_.binlog_ack_ = new ::client::BinlogAck(*from._impl_.binlog_ack_);
+  }
+  if (from._internal_has_head()) {
+    _this->_impl_.head_ = new ::client::SyncOffset(*from._impl_.head_);
+  }
+  if (from._internal_has_binlog_resync()) {
+    _this->_impl_.binlog_resync_ = new ::client::BinlogResync(*from._impl_.binlog_resync_);
+  }
+  if (from._internal_has_binlog_heartbeat()) {
+    _this->_impl_.binlog_heartbeat_ = new ::client::BinlogHeartbeat(*from._impl_.binlog_heartbeat_);
+  }
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.item_len_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.item_len_));
+  // @@protoc_insertion_point(copy_constructor:client.SyncRequest)
+}
+
+inline void SyncRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.from_){nullptr}
+    , decltype(_impl_.sync_offset_){nullptr}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.binlog_skip_){nullptr}
+    , decltype(_impl_.binlog_ack_){nullptr}
+    , decltype(_impl_.head_){nullptr}
+    , decltype(_impl_.binlog_resync_){nullptr}
+    , decltype(_impl_.binlog_heartbeat_){nullptr}
+    , decltype(_impl_.epoch_){int64_t{0}}
+    , decltype(_impl_.sync_type_){0}
+    , decltype(_impl_.item_len_){0}
+  };
 }
 
-SyncRequest* SyncRequest::default_instance_ = NULL;
+SyncRequest::~SyncRequest() {
+  // @@protoc_insertion_point(destructor:client.SyncRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-SyncRequest* SyncRequest::New() const {
-  return new SyncRequest;
+inline void SyncRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.from_;
+  if (this != internal_default_instance()) delete _impl_.sync_offset_;
+  if (this != internal_default_instance()) delete _impl_.request_;
+  if (this != internal_default_instance()) delete _impl_.binlog_skip_;
+  if (this != internal_default_instance()) delete _impl_.binlog_ack_;
+  if (this != internal_default_instance()) delete _impl_.head_;
+  if (this != internal_default_instance()) delete _impl_.binlog_resync_;
+  if (this != internal_default_instance()) delete _impl_.binlog_heartbeat_;
 }
 
-void SyncRequest::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    sync_type_ = 0;
-    epoch_ = GOOGLE_LONGLONG(0);
-    if (has_from()) {
-      if (from_ != NULL) from_->::client::Node::Clear();
-    }
-    if (has_sync_offset()) {
-      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-    }
-    if (has_request()) {
-      if (request_ != NULL) request_->::client::CmdRequest::Clear();
-    }
-    if (has_binlog_skip()) {
-      if (binlog_skip_ != NULL) binlog_skip_->::client::BinlogSkip::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void SyncRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool SyncRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void SyncRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:client.SyncRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.from_ != nullptr);
+      _impl_.from_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.sync_offset_ != nullptr);
+      _impl_.sync_offset_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.request_ != nullptr);
+      _impl_.request_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.binlog_skip_ != nullptr);
+      _impl_.binlog_skip_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.binlog_ack_ != nullptr);
+      _impl_.binlog_ack_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.head_ != nullptr);
+      _impl_.head_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.binlog_resync_ != nullptr);
+      _impl_.binlog_resync_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.binlog_heartbeat_ != nullptr);
+      _impl_.binlog_heartbeat_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.item_len_) -
+        reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.item_len_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .client.SyncType sync_type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::SyncType_IsValid(value)) {
-            set_sync_type(static_cast< ::client::SyncType >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::client::SyncType_IsValid(val))) {
+            _internal_set_sync_type(static_cast<::client::SyncType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_epoch;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required int64 epoch = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_epoch:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &epoch_)));
-          set_has_epoch();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_from;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_epoch(&has_bits);
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .client.Node from = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_from:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_from()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_sync_offset;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_from(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .client.SyncOffset sync_offset = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_offset()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_request;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sync_offset(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .client.CmdRequest request = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_request:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_request()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_binlog_skip;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .client.BinlogSkip binlog_skip = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_binlog_skip:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_binlog_skip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SyncRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_binlog_skip(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.BinlogAck binlog_ack = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_binlog_ack(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.SyncOffset head = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_head(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 item_len = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_item_len(&has_bits);
+          _impl_.item_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.BinlogResync binlog_resync = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_binlog_resync(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .client.BinlogHeartbeat binlog_heartbeat = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_binlog_heartbeat(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:client.SyncRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .client.SyncType sync_type = 1;
-  if (has_sync_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->sync_type(), output);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_sync_type(), target);
   }
 
   // required int64 epoch = 2;
-  if (has_epoch()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->epoch(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_epoch(), target);
   }
 
   // required .client.Node from = 3;
-  if (has_from()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->from(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::from(this),
+        _Internal::from(this).GetCachedSize(), target, stream);
   }
 
   // required .client.SyncOffset sync_offset = 4;
-  if (has_sync_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->sync_offset(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::sync_offset(this),
+        _Internal::sync_offset(this).GetCachedSize(), target, stream);
   }
 
   // optional .client.CmdRequest request = 5;
-  if (has_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->request(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
   }
 
   // optional .client.BinlogSkip binlog_skip = 6;
-  if (has_binlog_skip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->binlog_skip(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::binlog_skip(this),
+        _Internal::binlog_skip(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional .client.BinlogAck binlog_ack = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::binlog_ack(this),
+        _Internal::binlog_ack(this).GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* SyncRequest::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .client.SyncType sync_type = 1;
-  if (has_sync_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->sync_type(), target);
+  // optional .client.SyncOffset head = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::head(this),
+        _Internal::head(this).GetCachedSize(), target, stream);
   }
 
-  // required int64 epoch = 2;
-  if (has_epoch()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->epoch(), target);
+  // optional int32 item_len = 9;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_item_len(), target);
   }
 
-  // required .client.Node from = 3;
-  if (has_from()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->from(), target);
+  // optional .client.BinlogResync binlog_resync = 10;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::binlog_resync(this),
+        _Internal::binlog_resync(this).GetCachedSize(), target, stream);
   }
 
-  // required .client.SyncOffset sync_offset = 4;
-  if (has_sync_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->sync_offset(), target);
+  // optional .client.BinlogHeartbeat binlog_heartbeat = 11;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::binlog_heartbeat(this),
+        _Internal::binlog_heartbeat(this).GetCachedSize(), target, stream);
   }
 
-  // optional .client.CmdRequest request = 5;
-  if (has_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->request(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:client.SyncRequest)
+  return target;
+}
+
+size_t SyncRequest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:client.SyncRequest)
+  size_t total_size = 0;
+
+  if (_internal_has_from()) {
+    // required .client.Node from = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.from_);
   }
 
-  // optional .client.BinlogSkip binlog_skip = 6;
-  if (has_binlog_skip()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->binlog_skip(), target);
+  if (_internal_has_sync_offset()) {
+    // required .client.SyncOffset sync_offset = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
+  }
+
+  if (_internal_has_epoch()) {
+    // required int64 epoch = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_epoch());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_sync_type()) {
+    // required .client.SyncType sync_type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_sync_type());
   }
-  return target;
+
+  return total_size;
 }
+size_t SyncRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:client.SyncRequest)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000303) ^ 0x00000303) == 0) {  // All required fields are present.
+    // required .client.Node from = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.from_);
 
-int SyncRequest::ByteSize() const {
-  int total_size = 0;
+    // required .client.SyncOffset sync_offset = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sync_offset_);
+
+    // required int64 epoch = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_epoch());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required .client.SyncType sync_type = 1;
-    if (has_sync_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_sync_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000fcu) {
+    // optional .client.CmdRequest request = 5;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->sync_type());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.request_);
     }
 
-    // required int64 epoch = 2;
-    if (has_epoch()) {
+    // optional .client.BinlogSkip binlog_skip = 6;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->epoch());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.binlog_skip_);
     }
 
-    // required .client.Node from = 3;
-    if (has_from()) {
+    // optional .client.BinlogAck binlog_ack = 7;
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->from());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.binlog_ack_);
     }
 
-    // required .client.SyncOffset sync_offset = 4;
-    if (has_sync_offset()) {
+    // optional .client.SyncOffset head = 8;
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_offset());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.head_);
     }
 
-    // optional .client.CmdRequest request = 5;
-    if (has_request()) {
+    // optional .client.BinlogResync binlog_resync = 10;
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->request());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.binlog_resync_);
     }
 
-    // optional .client.BinlogSkip binlog_skip = 6;
-    if (has_binlog_skip()) {
+    // optional .client.BinlogHeartbeat binlog_heartbeat = 11;
+    if (cached_has_bits & 0x00000080u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->binlog_skip());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.binlog_heartbeat_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional int32 item_len = 9;
+  if (cached_has_bits & 0x00000400u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_item_len());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void SyncRequest::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SyncRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SyncRequest*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SyncRequest::MergeFrom(const SyncRequest& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_sync_type()) {
-      set_sync_type(from.sync_type());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncRequest::GetClassData() const { return &_class_data_; }
+
+
+void SyncRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncRequest*>(&to_msg);
+  auto& from = static_cast<const SyncRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:client.SyncRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_from()->::client::Node::MergeFrom(
+          from._internal_from());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_sync_offset()->::client::SyncOffset::MergeFrom(
+          from._internal_sync_offset());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_request()->::client::CmdRequest::MergeFrom(
+          from._internal_request());
     }
-    if (from.has_epoch()) {
-      set_epoch(from.epoch());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_binlog_skip()->::client::BinlogSkip::MergeFrom(
+          from._internal_binlog_skip());
     }
-    if (from.has_from()) {
-      mutable_from()->::client::Node::MergeFrom(from.from());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_binlog_ack()->::client::BinlogAck::MergeFrom(
+          from._internal_binlog_ack());
     }
-    if (from.has_sync_offset()) {
-      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_head()->::client::SyncOffset::MergeFrom(
+          from._internal_head());
     }
-    if (from.has_request()) {
-      mutable_request()->::client::CmdRequest::MergeFrom(from.request());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_binlog_resync()->::client::BinlogResync::MergeFrom(
+          from._internal_binlog_resync());
     }
-    if (from.has_binlog_skip()) {
-      mutable_binlog_skip()->::client::BinlogSkip::MergeFrom(from.binlog_skip());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_binlog_heartbeat()->::client::BinlogHeartbeat::MergeFrom(
+          from._internal_binlog_heartbeat());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SyncRequest::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.epoch_ = from._impl_.epoch_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.sync_type_ = from._impl_.sync_type_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.item_len_ = from._impl_.item_len_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SyncRequest::CopyFrom(const SyncRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:client.SyncRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SyncRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
-
-  if (has_from()) {
-    if (!this->from().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_from()) {
+    if (!_impl_.from_->IsInitialized()) return false;
+  }
+  if (_internal_has_sync_offset()) {
+    if (!_impl_.sync_offset_->IsInitialized()) return false;
+  }
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
   }
-  if (has_sync_offset()) {
-    if (!this->sync_offset().IsInitialized()) return false;
+  if (_internal_has_binlog_skip()) {
+    if (!_impl_.binlog_skip_->IsInitialized()) return false;
   }
-  if (has_request()) {
-    if (!this->request().IsInitialized()) return false;
+  if (_internal_has_binlog_ack()) {
+    if (!_impl_.binlog_ack_->IsInitialized()) return false;
   }
-  if (has_binlog_skip()) {
-    if (!this->binlog_skip().IsInitialized()) return false;
+  if (_internal_has_head()) {
+    if (!_impl_.head_->IsInitialized()) return false;
+  }
+  if (_internal_has_binlog_resync()) {
+    if (!_impl_.binlog_resync_->IsInitialized()) return false;
+  }
+  if (_internal_has_binlog_heartbeat()) {
+    if (!_impl_.binlog_heartbeat_->IsInitialized()) return false;
   }
   return true;
 }
 
-void SyncRequest::Swap(SyncRequest* other) {
-  if (other != this) {
-    std::swap(sync_type_, other->sync_type_);
-    std::swap(epoch_, other->epoch_);
-    std::swap(from_, other->from_);
-    std::swap(sync_offset_, other->sync_offset_);
-    std::swap(request_, other->request_);
-    std::swap(binlog_skip_, other->binlog_skip_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SyncRequest::InternalSwap(SyncRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncRequest, _impl_.item_len_)
+      + sizeof(SyncRequest::_impl_.item_len_)
+      - PROTOBUF_FIELD_OFFSET(SyncRequest, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
 }
 
-::google::protobuf::Metadata SyncRequest::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SyncRequest_descriptor_;
-  metadata.reflection = SyncRequest_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SyncRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_client_2eproto_getter, &descriptor_table_client_2eproto_once,
+      file_level_metadata_client_2eproto[38]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace client
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::client::Node*
+Arena::CreateMaybeMessage< ::client::Node >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::Node >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::SyncOffset*
+Arena::CreateMaybeMessage< ::client::SyncOffset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::SyncOffset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::ReplTerm*
+Arena::CreateMaybeMessage< ::client::ReplTerm >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::ReplTerm >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::ReadStaleness*
+Arena::CreateMaybeMessage< ::client::ReadStaleness >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::ReadStaleness >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::KeyExpire*
+Arena::CreateMaybeMessage< ::client::KeyExpire >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::KeyExpire >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::PartitionState_SlaveLag*
+Arena::CreateMaybeMessage< ::client::PartitionState_SlaveLag >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::PartitionState_SlaveLag >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::PartitionState*
+Arena::CreateMaybeMessage< ::client::PartitionState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::PartitionState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Sync*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Sync >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Sync >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Set*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Set >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Set >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Get*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Get >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Get >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Del*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Del >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Del >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Info*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Info >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Info >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Mget*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Mget >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Mget >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Msync*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Msync >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Msync >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Subscribe*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Subscribe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Subscribe >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Mset_Kv*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Mset_Kv >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Mset_Kv >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Mset*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Mset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Mset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Mdel*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Mdel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Mdel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Incrby*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Incrby >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Incrby >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest_Append*
+Arena::CreateMaybeMessage< ::client::CmdRequest_Append >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest_Append >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdRequest*
+Arena::CreateMaybeMessage< ::client::CmdRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Sync*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Sync >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Sync >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Get*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Get >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Get >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_InfoStats*
+Arena::CreateMaybeMessage< ::client::CmdResponse_InfoStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_InfoStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_InfoCapacity*
+Arena::CreateMaybeMessage< ::client::CmdResponse_InfoCapacity >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_InfoCapacity >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_InfoRepl*
+Arena::CreateMaybeMessage< ::client::CmdResponse_InfoRepl >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_InfoRepl >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Mget*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Mget >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Mget >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_InfoServer*
+Arena::CreateMaybeMessage< ::client::CmdResponse_InfoServer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_InfoServer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Subscribe_Record*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Subscribe_Record >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Subscribe_Record >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Subscribe*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Subscribe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Subscribe >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_KeyResult*
+Arena::CreateMaybeMessage< ::client::CmdResponse_KeyResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_KeyResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Incrby*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Incrby >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Incrby >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse_Append*
+Arena::CreateMaybeMessage< ::client::CmdResponse_Append >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse_Append >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::CmdResponse*
+Arena::CreateMaybeMessage< ::client::CmdResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::CmdResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::BinlogSkip*
+Arena::CreateMaybeMessage< ::client::BinlogSkip >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::BinlogSkip >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::BinlogAck*
+Arena::CreateMaybeMessage< ::client::BinlogAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::BinlogAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::BinlogResync*
+Arena::CreateMaybeMessage< ::client::BinlogResync >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::BinlogResync >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::BinlogHeartbeat*
+Arena::CreateMaybeMessage< ::client::BinlogHeartbeat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::BinlogHeartbeat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::client::SyncRequest*
+Arena::CreateMaybeMessage< ::client::SyncRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::client::SyncRequest >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -11,11 +11,13 @@ struct ZPBinlogReceiveTask {
   client::CmdRequest request;
   uint64_t gap;
 
+  // Take over the content of req
   ZPBinlogReceiveTask(const PartitionSyncOption &opt,
-      const Cmd* c, const client::CmdRequest &req)
+      const Cmd* c, client::CmdRequest* req)
     : option(opt),
-    cmd(c),
-    request(req) {}
+    cmd(c) {
+      request.Swap(req);
+    }
 
   ZPBinlogReceiveTask(const PartitionSyncOption &opt,
       uint64_t g)
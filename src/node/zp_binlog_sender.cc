@@ -4,6 +4,7 @@
 #include <glog/logging.h>
 #include <google/protobuf/text_format.h>
 #include "include/zp_const.h"
+#include "include/zp_buffer_pool.h"
 #include "src/node/zp_data_server.h"
 #include "src/node/zp_data_partition.h"
 
@@ -45,14 +46,43 @@ ZPBinlogSendTask::ZPBinlogSendTask(uint64_t seq, const std::string &table,
   offset_(ioffset),
   pre_filenum_(0),
   pre_offset_(0),
-  pre_has_content_(false) {
+  pre_has_content_(false),
+  head_filenum_(0),
+  head_offset_(0),
+  master_head_filenum_(0),
+  master_head_offset_(0),
+  sent_filenum_(ifilenum),
+  sent_offset_(ioffset),
+  last_send_us_(0),
+  rate_begin_us_(slash::NowMicros()),
+  rate_bytes_(0),
+  send_rate_(0),
+  queue_(NULL),
+  reader_(NULL),
+  credits_(kBinlogSendWindow),
+  last_grant_time_(time(NULL)),
+  resync_pending_(false),
+  resync_filenum_(0),
+  resync_offset_(0),
+  defer_until_us_(0) {
     name_ = ZPBinlogSendTaskName(table, partition_id_, target);
-    pre_content_.reserve(1024 * 1024);
   }
 
 ZPBinlogSendTask::~ZPBinlogSendTask() {
   delete reader_;
   delete queue_;
+  ZPBufferPool::Global()->Checkin(&pre_content_);
+}
+
+// Give back the buffers when put back to the pool, so that only the tasks
+// being processed hold them. Keep the item not sent yet for the retry
+void ZPBinlogSendTask::ReleaseBuffers() {
+  if (reader_ != NULL) {
+    reader_->ReleaseBuffer();
+  }
+  if (send_next) {
+    ZPBufferPool::Global()->Checkin(&pre_content_);
+  }
 }
 
 Status ZPBinlogSendTask::Init() {
@@ -95,6 +125,12 @@ Status ZPBinlogSendTask::ProcessTask() {
     return Status::InvalidArgument("Error no exist or closed partition");
   }
   partition->GetBinlogOffsetWithLock(&curnum, &curoffset);
+  head_filenum_ = curnum;
+  head_offset_ = curoffset;
+  if (!partition->GetMasterHead(&master_head_filenum_, &master_head_offset_)) {
+    master_head_filenum_ = curnum;
+    master_head_offset_ = curoffset;
+  }
   if (filenum_ == curnum && offset_ == curoffset) {
     // No more binlog item in current task, switch to others
     return Status::EndFile("no more binlog item");
@@ -103,6 +139,9 @@ Status ZPBinlogSendTask::ProcessTask() {
   // << "parititon: " << partition_id_;
   RecordPreOffset();
 
+  if (pre_content_.capacity() < kBufferPoolMinSize) {
+    ZPBufferPool::Global()->Checkout(kBufferPoolMinSize, &pre_content_);
+  }
   uint64_t consume_len = 0;
   Status s = reader_->Consume(&consume_len, &pre_content_);
   if (s.IsEndFile()) {
@@ -161,6 +200,9 @@ void ZPBinlogSendTask::BuildSyncRequest(client::SyncRequest *msg) const {
   client::SyncOffset *sync_offset = msg->mutable_sync_offset();
   sync_offset->set_filenum(pre_filenum_);
   sync_offset->set_offset(pre_offset_);
+  client::SyncOffset *head = msg->mutable_head();
+  head->set_filenum(master_head_filenum_);
+  head->set_offset(master_head_offset_);
 
   // Different part
   if (pre_has_content_) {
@@ -170,6 +212,7 @@ void ZPBinlogSendTask::BuildSyncRequest(client::SyncRequest *msg) const {
     assert(!pre_content_.empty());
     req.ParseFromString(pre_content_);
     req_ptr->CopyFrom(req);
+    msg->set_item_len(pre_content_.size());
   } else {
     msg->set_sync_type(client::SyncType::SKIP);
     client::BinlogSkip* skip = msg->mutable_binlog_skip();
@@ -179,11 +222,149 @@ void ZPBinlogSendTask::BuildSyncRequest(client::SyncRequest *msg) const {
   }
 } 
 
+// Return true if nothing has been sent for a while
+// Required: ProcessTask just return EndFile
+bool ZPBinlogSendTask::ShouldHeartbeat() {
+  slash::MutexLock l(&stats_mutex_);
+  return slash::NowMicros() - last_send_us_ > kBinlogHeartbeatInterval * 1000;
+}
+
+void ZPBinlogSendTask::BuildHeartbeat(client::SyncRequest *msg) const {
+  msg->set_sync_type(client::SyncType::HEARTBEAT);
+  msg->set_epoch(zp_data_server->meta_epoch());
+  client::Node *node = msg->mutable_from();
+  node->set_ip(zp_data_server->local_ip());
+  node->set_port(zp_data_server->local_port());
+  client::SyncOffset *sync_offset = msg->mutable_sync_offset();
+  sync_offset->set_filenum(master_head_filenum_);
+  sync_offset->set_offset(master_head_offset_);
+  client::BinlogHeartbeat *beat = msg->mutable_binlog_heartbeat();
+  beat->set_table_name(table_name_);
+  beat->set_partition_id(partition_id_);
+}
+
+// Record the item or heartbeat just sent successfully
+// Required: only be called by the thread who has fetched out this task
+void ZPBinlogSendTask::MarkSent(uint64_t bytes) {
+  uint64_t now = slash::NowMicros();
+  slash::MutexLock l(&stats_mutex_);
+  sent_filenum_ = filenum_;
+  sent_offset_ = offset_;
+  last_send_us_ = now;
+  rate_bytes_ += bytes;
+  if (now - rate_begin_us_ >= kBinlogSendRateWindow * 1000) {
+    send_rate_ = rate_bytes_ * 1000000 / (now - rate_begin_us_);
+    rate_begin_us_ = now;
+    rate_bytes_ = 0;
+  }
+}
+
+void ZPBinlogSendTask::GetStats(ZPBinlogSendStats* stats) {
+  uint64_t now = slash::NowMicros();
+  slash::MutexLock l(&stats_mutex_);
+  stats->sent_filenum = sent_filenum_;
+  stats->sent_offset = sent_offset_;
+  stats->unacked = kBinlogSendWindow - credits_;
+  stats->last_send_us = last_send_us_;
+  // Nothing sent in the last window
+  stats->send_rate = (now - rate_begin_us_ > 2 * kBinlogSendRateWindow * 1000)
+    ? 0 : send_rate_;
+}
+
+// Return true if the slave could receive more items
+bool ZPBinlogSendTask::HasCredit() {
+  if (credits_ > 0) {
+    return true;
+  }
+  if (time(NULL) - last_grant_time_ > kBinlogCreditTimeout) {
+    // Credits may be lost together with the slave's ack,
+    // restore the window rather than starve forever
+    LOG(WARNING) << "No credit granted from " << node_ << " for "
+      << kBinlogCreditTimeout << "s, restore send window"
+      << ", table:" << table_name_ << ", partition:" << partition_id_;
+    credits_ = kBinlogSendWindow;
+    last_grant_time_ = time(NULL);
+    return true;
+  }
+  return false;
+}
+
+void ZPBinlogSendTask::GrantCredit(int32_t credits) {
+  credits_ += credits;
+  if (credits_ > kBinlogSendWindow) {
+    credits_ = kBinlogSendWindow;
+  }
+  last_grant_time_ = time(NULL);
+}
+
+// Called when slave find a gap
+void ZPBinlogSendTask::RequestResync(uint32_t filenum, uint64_t offset) {
+  slash::MutexLock l(&resync_mutex_);
+  resync_pending_ = true;
+  resync_filenum_ = filenum;
+  resync_offset_ = offset;
+}
+
+// Seek back in place to where the slave asked, if any
+// Required: only be called by the thread who has fetched out this task,
+// or by the pool with write lock hold while the task is not fetched out
+Status ZPBinlogSendTask::MaybeResync() {
+  uint32_t filenum = 0;
+  uint64_t offset = 0;
+  {
+    slash::MutexLock l(&resync_mutex_);
+    if (!resync_pending_) {
+      return Status::OK();
+    }
+    resync_pending_ = false;
+    filenum = resync_filenum_;
+    offset = resync_offset_;
+  }
+
+  std::string confile = NewFileName(binlog_filename_, filenum);
+  slash::SequentialFile *queue = NULL;
+  Status s = slash::NewSequentialFile(confile, &queue);
+  if (!s.ok()) {
+    LOG(WARNING) << "Failed to resync " << node_ << ", table: " << table_name_
+      << ", partition:" << partition_id_ << ", open binlog " << filenum
+      << " failed: " << s.ToString();
+    return s;
+  }
+  BinlogReader *reader = new BinlogReader(queue);
+  s = reader->Seek(offset);
+  if (!s.ok()) {
+    // Keep current position, slave will fall back to trysync
+    LOG(WARNING) << "Failed to resync " << node_ << ", table: " << table_name_
+      << ", partition:" << partition_id_ << ", invalid offset (" << filenum
+      << ", " << offset << "): " << s.ToString();
+    delete reader;
+    delete queue;
+    return s;
+  }
+
+  LOG(INFO) << "Resync " << node_ << ", table: " << table_name_
+    << ", partition:" << partition_id_ << " from (" << filenum_ << ", "
+    << offset_ << ") to (" << filenum << ", " << offset << ")";
+  delete reader_;
+  delete queue_;
+  queue_ = queue;
+  reader_ = reader;
+  filenum_ = filenum;
+  offset_ = offset;
+  pre_has_content_ = false;
+  send_next = true;
+  credits_ = kBinlogSendWindow;
+  last_grant_time_ = time(NULL);
+  return Status::OK();
+}
+
 /**
  * ZPBinlogSendTaskPool
  */
 ZPBinlogSendTaskPool::ZPBinlogSendTaskPool()
-  : next_sequence_(0) {
+  : next_sequence_(0),
+  wake_cond_(&wake_mutex_),
+  wake_pending_(false) {
   pthread_rwlock_init(&tasks_rwlock_, NULL);
   task_ptrs_.reserve(1000);
   LOG(INFO) << "size: " << tasks_.size();
@@ -235,6 +416,7 @@ Status ZPBinlogSendTaskPool::AddTask(ZPBinlogSendTask* task) {
   task_ptrs_[task->name()].iter = tasks_.end();
   --(task_ptrs_[task->name()].iter);
   task_ptrs_[task->name()].sequence = task->sequence();
+  task_ptrs_[task->name()].task = task;
   return Status::OK();
 }
 
@@ -269,16 +451,87 @@ int32_t ZPBinlogSendTaskPool::TaskFilenum(const std::string &name) {
   return (*(it->second.iter))->filenum();
 }
 
+// Credits granted by slave, the task may be processing by some thread now
+Status ZPBinlogSendTaskPool::GrantCredit(const std::string &name,
+    int32_t credits) {
+  slash::RWLock l(&tasks_rwlock_, false);
+  ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(name);
+  if (it == task_ptrs_.end()) {
+    return Status::NotFound("Task not exist");
+  }
+  // Task fetched out is only deleted when PutBack with write lock hold
+  it->second.task->GrantCredit(credits);
+  return Status::OK();
+}
+
+// Seek at once if the task is not fetched out, and move it to the front
+// with a sending thread woken up, so that the slave recovers right now
+// rather than after the send interval
+Status ZPBinlogSendTaskPool::RequestResync(const std::string &name,
+    uint32_t filenum, uint64_t offset) {
+  {
+    slash::RWLock l(&tasks_rwlock_, true);
+    ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(name);
+    if (it == task_ptrs_.end()) {
+      return Status::NotFound("Task not exist");
+    }
+    it->second.task->RequestResync(filenum, offset);
+    if (it->second.iter != tasks_.end()) {
+      it->second.task->MaybeResync();
+      tasks_.splice(tasks_.begin(), tasks_, it->second.iter);
+      it->second.iter = tasks_.begin();
+    }
+  }
+  Wake();
+  return Status::OK();
+}
+
+void ZPBinlogSendTaskPool::Wake() {
+  slash::MutexLock l(&wake_mutex_);
+  wake_pending_ = true;
+  wake_cond_.Signal();
+}
+
+void ZPBinlogSendTaskPool::WaitForWake(uint32_t timeout_ms) {
+  slash::MutexLock l(&wake_mutex_);
+  if (!wake_pending_) {
+    wake_cond_.TimedWait(timeout_ms);
+  }
+  wake_pending_ = false;
+}
+
+size_t ZPBinlogSendTaskPool::TaskCount() {
+  slash::RWLock l(&tasks_rwlock_, false);
+  return task_ptrs_.size();
+}
+
+Status ZPBinlogSendTaskPool::GetTaskStats(const std::string &name,
+    ZPBinlogSendStats* stats) {
+  slash::RWLock l(&tasks_rwlock_, false);
+  ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(name);
+  if (it == task_ptrs_.end()) {
+    return Status::NotFound("Task not exist");
+  }
+  it->second.task->GetStats(stats);
+  return Status::OK();
+}
+
 // Fetch one task out from the front of tasks_ list
 // and live the its ptr point to the tasks_.end()
 // to distinguish from task has been removed
 Status ZPBinlogSendTaskPool::FetchOut(ZPBinlogSendTask** task_ptr) {
   slash::RWLock l(&tasks_rwlock_, true);
-  if (tasks_.size() == 0) {
+  // Skip the ones waiting for io budget
+  uint64_t now = slash::NowMicros();
+  std::list<ZPBinlogSendTask*>::iterator it = tasks_.begin();
+  while (it != tasks_.end() && (*it)->Deferred(now)) {
+    ++it;
+  }
+  if (it == tasks_.end()) {
     return Status::NotFound("No more task");
   }
-  *task_ptr = tasks_.front();
-  tasks_.pop_front();
+  *task_ptr = *it;
+  tasks_.erase(it);
   // Do not remove from the task_ptrs_ map
   // When the same task put back we need to know it is a old one
   task_ptrs_[(*task_ptr)->name()].iter = tasks_.end();
@@ -289,6 +542,7 @@ Status ZPBinlogSendTaskPool::FetchOut(ZPBinlogSendTask** task_ptr) {
 // return NotFound when the task is not exist in index map task_pts_
 // which mean the task has been removed or its not a task fetch out before
 Status ZPBinlogSendTaskPool::PutBack(ZPBinlogSendTask* task) {
+  task->ReleaseBuffers();
   slash::RWLock l(&tasks_rwlock_, true);
   ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(task->name());
   if (it == task_ptrs_.end()              // task has been removed
@@ -318,6 +572,7 @@ void ZPBinlogSendTaskPool::Dump() {
       LOG(INFO) << "  +Node  " << (*tptr)->node();
       LOG(INFO) << "  +filenum " << (*tptr)->filenum();
       LOG(INFO) << "  +offset " << (*tptr)->offset();
+      LOG(INFO) << "  +credits " << (*tptr)->credits();
     } else {
       LOG(INFO) << "  +Being occupied";
     }
@@ -348,30 +603,64 @@ void* ZPBinlogSendThread::ThreadMain() {
   }
 
   struct timeval begin, now;
+  // Tasks fetched in a row with nothing to send
+  size_t idle_tasks = 0;
   while (!should_stop()) {
-    sleep(kBinlogSendInterval);
+    // Wait only when a round of tasks has nothing to send, and not
+    // for long, so that idle tasks still heartbeat in time
+    if (idle_tasks >= pool_->TaskCount()) {
+      pool_->WaitForWake(kBinlogSendIdleWait);
+      idle_tasks = 0;
+    }
     ZPBinlogSendTask* task = NULL;
     Status s = pool_->FetchOut(&task);
     if (!s.ok()) {
       //LOG(INFO) << "No task to be processed";
+      idle_tasks = pool_->TaskCount();
       continue;
     }
 
     // Fetched one task, process it
+    idle_tasks++;
     gettimeofday(&begin, NULL);
     while (!should_stop()) {
       Status item_s = Status::OK();
+      // Seek back first if slave asked to
+      task->MaybeResync();
+
       // Record offset of current binlog item for sending later
       if (task->send_next) {
+        if (!task->HasCredit()) {
+          // Slave is slow, switch to others until it grant more credits
+          pool_->PutBack(task);
+          break;
+        }
         // Process ProcessTask
         item_s = task->ProcessTask();
         if (!item_s.ok()) {
           //LOG(INFO) << "Error happened when process task: " << task->table_name()
           //  << " parititon: " << task->partition_id()
           //  << ", status:" << item_s.ToString(); 
+          if (item_s.IsEndFile() && task->ShouldHeartbeat()) {
+            client::SyncRequest beat;
+            task->BuildHeartbeat(&beat);
+            if (zp_data_server->SendToPeer(task->node(), beat).ok()) {
+              task->MarkSent(0);
+            }
+          }
           pool_->PutBack(task);
           break;
         }
+        task->ConsumeCredit();
+        if (task->lag() > kIOCatchUpLag) {
+          // Catching up reads binlog out of page cache, charge it
+          // but never sleep here, the thread is shared by other tasks
+          uint64_t wait_us = zp_data_server->io_scheduler()->Reserve(
+              kIOCatchUp, task->offset() - task->pre_offset());
+          if (wait_us > 0) {
+            task->DeferUntil(slash::NowMicros() + wait_us);
+          }
+        }
       }
 
       // Construct SyncRequest
@@ -400,9 +689,17 @@ void* ZPBinlogSendThread::ThreadMain() {
           sleep(kBinlogSendInterval);
         } else {
           task->send_next = true;
+          task->MarkSent(task->offset() - task->pre_offset());
+          idle_tasks = 0;
         }
       }
 
+      // Over io budget, switch to others until it's due
+      if (task->Deferred(slash::NowMicros())) {
+        pool_->PutBack(task);
+        break;
+      }
+
       // Check if need to switch task
       gettimeofday(&now, NULL);
       if (now.tv_sec - begin.tv_sec > kBinlogTimeSlice) {
@@ -2,6 +2,7 @@
 #define ZP_BINLOG_SENDER
 #include <list>
 #include <string>
+#include <atomic>
 #include <unordered_map>
 
 #include "slash/include/slash_status.h"
@@ -20,6 +21,7 @@ class ZPBinlogSendTask;
 struct ZPBinlogSendTaskHandle {
   std::list< ZPBinlogSendTask* >::iterator iter;
   uint64_t sequence; // use squence to distinguish task with same name
+  ZPBinlogSendTask* task; // valid even when the task has been fetched out
 };
 
 typedef std::unordered_map< std::string,
@@ -27,6 +29,18 @@ typedef std::unordered_map< std::string,
 
 std::string ZPBinlogSendTaskName(const std::string& table, int32_t id, const Node& target);
 
+// Replication progress of one task, for INFOREPL
+struct ZPBinlogSendStats {
+  uint32_t sent_filenum;  // where the items sent end
+  uint64_t sent_offset;
+  int32_t unacked;        // items sent but not acked by slave
+  uint64_t send_rate;     // bytes per second
+  uint64_t last_send_us;  // 0 if nothing sent yet
+  ZPBinlogSendStats()
+    : sent_filenum(0), sent_offset(0), unacked(0),
+    send_rate(0), last_send_us(0) {}
+};
+
 /**
  * ZPBinlogSendTask
  */
@@ -75,6 +89,43 @@ public:
 
   Status ProcessTask();
   void BuildSyncRequest(client::SyncRequest *msg) const;
+  // Bytes behind the binlog end when last processed
+  int64_t lag() const {
+    return BinlogDistance(filenum_, offset_, head_filenum_, head_offset_);
+  }
+
+  // Heartbeat related, let the slave know it has caught up
+  // when there is nothing more to send
+  bool ShouldHeartbeat();
+  void BuildHeartbeat(client::SyncRequest *msg) const;
+
+  // Stats related
+  void MarkSent(uint64_t bytes);
+  void GetStats(ZPBinlogSendStats* stats);
+
+  // Flow control related
+  int32_t credits() const {
+    return credits_;
+  }
+  bool HasCredit();
+  void ConsumeCredit() {
+    credits_--;
+  }
+  void GrantCredit(int32_t credits);
+
+  // Resync related
+  void RequestResync(uint32_t filenum, uint64_t offset);
+  Status MaybeResync();
+
+  void ReleaseBuffers();
+
+  // Not fetched out again until then, for io budget
+  void DeferUntil(uint64_t us) {
+    defer_until_us_ = us;
+  }
+  bool Deferred(uint64_t now) const {
+    return defer_until_us_ > now;
+  }
 
 private:
   uint64_t sequence_;
@@ -90,9 +141,33 @@ private:
   uint64_t pre_offset_;
   std::string pre_content_;
   bool pre_has_content_;
+  // Binlog end of partition when last processed
+  uint32_t head_filenum_;
+  uint64_t head_offset_;
+  // Binlog end of master as far as the partition know, sent to slave
+  uint32_t master_head_filenum_;
+  uint64_t master_head_offset_;
+  // Stats written by the sending thread, and read by others
+  slash::Mutex stats_mutex_;
+  uint32_t sent_filenum_;
+  uint64_t sent_offset_;
+  uint64_t last_send_us_;
+  uint64_t rate_begin_us_;
+  uint64_t rate_bytes_;
+  uint64_t send_rate_;
   std::string binlog_filename_; // Name of the binlog file
   slash::SequentialFile *queue_;
   BinlogReader *reader_;
+  // Items could be sent before the slave grant more
+  std::atomic<int32_t> credits_;
+  std::atomic<time_t> last_grant_time_;
+  // Position slave asked to continue from, applied by the pool at once
+  // if the task is there, or by the sending thread who fetched it out
+  slash::Mutex resync_mutex_;
+  bool resync_pending_;
+  uint32_t resync_filenum_;
+  uint64_t resync_offset_;
+  uint64_t defer_until_us_;
   Status Init();
   // Record current filenum and offset in the pre one
   // So that we can know where the last binlog item begin
@@ -117,11 +192,18 @@ public:
     uint32_t ifilenum, uint64_t ioffset, bool force);
   Status RemoveTask(const std::string &name);
   int32_t TaskFilenum(const std::string &name);
+  Status GrantCredit(const std::string &name, int32_t credits);
+  Status RequestResync(const std::string &name,
+      uint32_t filenum, uint64_t offset);
+  Status GetTaskStats(const std::string &name, ZPBinlogSendStats* stats);
 
   // Use by Task Worker
   // Who Fetchout one task, process it, and then PutBack
   Status FetchOut(ZPBinlogSendTask** task);
   Status PutBack(ZPBinlogSendTask* task);
+  // Wait before next FetchOut, return early if some task need it now
+  void WaitForWake(uint32_t timeout_ms);
+  size_t TaskCount();
 
   void Dump();
 
@@ -131,6 +213,11 @@ private:
   ZPBinlogSendTaskIndex task_ptrs_;
   std::list<ZPBinlogSendTask*> tasks_;
   Status AddTask(ZPBinlogSendTask* task);
+
+  slash::Mutex wake_mutex_;
+  slash::CondVar wake_cond_;
+  bool wake_pending_;
+  void Wake();
 };
 
 /**
@@ -0,0 +1,70 @@
+#include "src/node/zp_client_flusher.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <glog/logging.h>
+
+#include "include/zp_const.h"
+#include "src/node/zp_data_client_conn.h"
+
+ZPClientFlusher::ZPClientFlusher()
+  : pink::Thread::Thread() {
+    epfd_ = epoll_create(1024);
+    if (epfd_ < 0) {
+      LOG(FATAL) << "Client flusher epoll_create failed: " << strerror(errno);
+    }
+    set_thread_name("ZPDataClientFlush");
+  }
+
+ZPClientFlusher::~ZPClientFlusher() {
+  StopThread();
+  close(epfd_);
+}
+
+void ZPClientFlusher::Watch(ZPDataClientConn* conn) {
+  struct epoll_event ev;
+  ev.events = EPOLLOUT | EPOLLONESHOT;
+  ev.data.ptr = conn;
+  slash::MutexLock l(&mutex_);
+  int op = conns_.insert(conn).second ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+  if (epoll_ctl(epfd_, op, conn->fd(), &ev) < 0) {
+    LOG(WARNING) << "Client flusher watch (" << conn->ip_port()
+      << ") failed: " << strerror(errno);
+  }
+}
+
+void ZPClientFlusher::Unwatch(ZPDataClientConn* conn) {
+  slash::MutexLock l(&mutex_);
+  if (conns_.erase(conn) > 0) {
+    // Fail if the fd is closed already, which is fine
+    epoll_ctl(epfd_, EPOLL_CTL_DEL, conn->fd(), NULL);
+  }
+}
+
+void* ZPClientFlusher::ThreadMain() {
+  struct epoll_event events[kClientFlushEvents];
+  while (!should_stop()) {
+    int num = epoll_wait(epfd_, events, kClientFlushEvents, kClientFlushWait);
+    for (int i = 0; i < num; i++) {
+      ZPDataClientConn* conn =
+        static_cast<ZPDataClientConn*>(events[i].data.ptr);
+      slash::MutexLock l(&mutex_);
+      if (conns_.find(conn) == conns_.end()) {
+        // Unwatched meanwhile
+        continue;
+      }
+      if (conn->FlushPending()) {
+        struct epoll_event ev;
+        ev.events = EPOLLOUT | EPOLLONESHOT;
+        ev.data.ptr = conn;
+        epoll_ctl(epfd_, EPOLL_CTL_MOD, conn->fd(), &ev);
+      } else {
+        epoll_ctl(epfd_, EPOLL_CTL_DEL, conn->fd(), NULL);
+        conns_.erase(conn);
+      }
+    }
+  }
+  return NULL;
+}
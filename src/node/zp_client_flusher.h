@@ -0,0 +1,33 @@
+#ifndef ZP_CLIENT_FLUSHER_H
+#define ZP_CLIENT_FLUSHER_H
+#include <set>
+
+#include "pink/include/pink_thread.h"
+#include "slash/include/slash_mutex.h"
+
+class ZPDataClientConn;
+
+/**
+ * ZPClientFlusher
+ * Write the responses finished by pipeline workers, which are left
+ * when the client socket is full, once it's writable again.
+ * So that no worker ever wait for a slow client
+ */
+class ZPClientFlusher : public pink::Thread {
+ public:
+  ZPClientFlusher();
+  virtual ~ZPClientFlusher();
+
+  // Flush conn once its socket is writable, until nothing left
+  void Watch(ZPDataClientConn* conn);
+  // Never touch conn after return
+  void Unwatch(ZPDataClientConn* conn);
+
+ private:
+  int epfd_;
+  slash::Mutex mutex_;  // hold while flushing
+  std::set<ZPDataClientConn*> conns_;
+  virtual void* ThreadMain();
+};
+
+#endif
@@ -1,5 +1,9 @@
 #include "src/node/zp_data_client_conn.h"
 
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
 #include <glog/logging.h>
 #include "src/node/zp_data_server.h"
 
@@ -8,76 +12,362 @@ extern ZPDataServer* zp_data_server;
 ////// ZPDataClientConn //////
 ZPDataClientConn::ZPDataClientConn(int fd, std::string ip_port,
     pink::Thread* thread) :
-  PbConn(fd, ip_port, thread) {
+  PbConn(fd, ip_port, thread),
+  in_pos_(0),
+  out_pos_(0),
+  write_error_(false),
+  parse_error_(false),
+  inflight_(0),
+  busy_workers_(0),
+  busy_cond_(&mutex_),
+  flushing_(false),
+  running_(false) {
 }
 
 ZPDataClientConn::~ZPDataClientConn() {
+  {
+    // Pipeline workers may still use me
+    slash::MutexLock l(&mutex_);
+    write_error_ = true;
+    while (busy_workers_ > 0) {
+      busy_cond_.Wait();
+    }
+  }
+  // Then the flusher, no more watch since workers are all gone
+  zp_data_server->client_flusher()->Unwatch(this);
+  for (auto task : free_tasks_) {
+    delete task;
+  }
 }
 
+// Never called, since GetRequest handle requests itself
 int ZPDataClientConn::DealMessage() {
-  set_is_reply(true);
-  int s = DealMessageInternal();
-  res_ = &response_;
-  return s;
+  return -1;
+}
+
+pink::ReadStatus ZPDataClientConn::GetRequest() {
+  slash::MutexLock l(&mutex_);
+  size_t old_len = in_buf_.size();
+  in_buf_.resize(old_len + kClientConnReadSize);
+  ssize_t nread = read(fd(), &in_buf_[old_len], kClientConnReadSize);
+  in_buf_.resize(old_len + (nread > 0 ? nread : 0));
+  if (nread == 0) {
+    return pink::kReadClose;
+  } else if (nread < 0) {
+    return (errno == EAGAIN || errno == EINTR)
+      ? pink::kReadHalf : pink::kReadError;
+  }
+
+  if (!DealPendingRequests() || parse_error_) {
+    return pink::kParseError;
+  }
+  if (write_error_) {
+    return pink::kReadError;
+  }
+  if (!out_buf_.empty() && !flushing_) {
+    set_is_reply(true);
+    return pink::kReadAll;
+  }
+  return pink::kReadHalf;
+}
+
+pink::WriteStatus ZPDataClientConn::SendReply() {
+  slash::MutexLock l(&mutex_);
+  if (!FlushReply()) {
+    return pink::kWriteError;
+  }
+  if (!out_buf_.empty()) {
+    return pink::kWriteHalf;
+  }
+
+  // Requests left for the bound of pending responses
+  if (!DealPendingRequests() || parse_error_ || write_error_) {
+    return pink::kWriteError;
+  }
+  return out_buf_.empty() ? pink::kWriteAll : pink::kWriteHalf;
+}
+
+// Write as much as possible without blocking,
+// return false if the connection is broken
+// Required: hold mutex_
+bool ZPDataClientConn::FlushReply() {
+  while (out_pos_ < out_buf_.size()) {
+    ssize_t nwritten = write(fd(), out_buf_.data() + out_pos_,
+        out_buf_.size() - out_pos_);
+    if (nwritten < 0) {
+      if (errno == EAGAIN || errno == EINTR) {
+        return true;
+      }
+      write_error_ = true;
+      return false;
+    }
+    out_pos_ += nwritten;
+  }
+  out_buf_.clear();
+  out_pos_ = 0;
+  return true;
+}
+
+void ZPDataClientConn::AppendResponse(const client::CmdResponse& response,
+    bool v2, uint64_t request_id) {
+  uint32_t res_len = response.ByteSize();
+  if (v2) {
+    char header[kFrameV2HeaderSize];
+    header[0] = kFrameV2Magic;
+    header[1] = kFrameV2Version;
+    uint16_t flags = 0;
+    memcpy(header + 2, &flags, 2);
+    uint32_t len = htonl(res_len);
+    memcpy(header + 4, &len, 4);
+    uint32_t id_high = htonl(static_cast<uint32_t>(request_id >> 32));
+    uint32_t id_low = htonl(static_cast<uint32_t>(request_id));
+    memcpy(header + 8, &id_high, 4);
+    memcpy(header + 12, &id_low, 4);
+    out_buf_.append(header, kFrameV2HeaderSize);
+  } else {
+    uint32_t len = htonl(res_len);
+    out_buf_.append(reinterpret_cast<char*>(&len), 4);
+  }
+  size_t res_pos = out_buf_.size();
+  out_buf_.resize(res_pos + res_len);
+  response.SerializeWithCachedSizesToArray(
+      reinterpret_cast<uint8_t*>(&out_buf_[res_pos]));
+}
+
+// Frame at in_pos_, return 1 if it's complete, 0 if more bytes needed,
+// -1 if it's invalid
+int ZPDataClientConn::PeekFrame(ClientFrame* frame) {
+  size_t remain = in_buf_.size() - in_pos_;
+  const char* p = in_buf_.data() + in_pos_;
+  if (remain < 4) {
+    return 0;
+  }
+  uint32_t len = 0;
+  if (p[0] == kFrameV2Magic) {
+    if (remain < kFrameV2HeaderSize) {
+      return 0;
+    }
+    if (p[1] != kFrameV2Version) {
+      return -1;
+    }
+    uint16_t flags = 0;
+    memcpy(&flags, p + 2, 2);
+    memcpy(&len, p + 4, 4);
+    uint32_t id_high = 0, id_low = 0;
+    memcpy(&id_high, p + 8, 4);
+    memcpy(&id_low, p + 12, 4);
+    frame->v2 = true;
+    frame->flags = ntohs(flags);
+    frame->request_id = (static_cast<uint64_t>(ntohl(id_high)) << 32)
+      | ntohl(id_low);
+    frame->header_len = kFrameV2HeaderSize;
+  } else {
+    memcpy(&len, p, 4);
+    frame->v2 = false;
+    frame->flags = kFrameFlagOrdered;
+    frame->request_id = 0;
+    frame->header_len = 4;
+  }
+  len = ntohl(len);
+  if (len > kClientConnMaxFrame) {
+    LOG(WARNING) << "Receive Client command from (" << ip_port()
+      << ") too large: " << len;
+    return -1;
+  }
+  if (remain - frame->header_len < len) {
+    return 0;
+  }
+  frame->data = p + frame->header_len;
+  frame->len = len;
+  return 1;
+}
+
+// Execute complete requests in in_buf_, append their responses to
+// out_buf_, until no more or enough responses pending.
+// v1 ones and v2 ones with kFrameFlagOrdered run inline in order,
+// once the pipeline tasks before them are all done,
+// others are handed to pipeline workers without waiting, and
+// their responses are sent by the workers as soon as they are done.
+// Frames are taken under mutex_, but commands run without it, so that
+// workers finishing meanwhile never wait for a slow one
+// Return false if there is a request could not be parsed
+// Required: hold mutex_
+bool ZPDataClientConn::DealPendingRequests() {
+  ClientFrame frame;
+  int ret = 0;
+  while (!running_ && out_buf_.size() < kClientConnMaxReply
+      && (ret = PeekFrame(&frame)) > 0) {
+    if (frame.flags & kFrameFlagOrdered) {
+      if (inflight_ > 0) {
+        // The last pipeline task done continue from here
+        break;
+      }
+      // Copy since in_buf_ may move once unlocked, others wait for
+      // me by running_ to keep the order
+      ordered_data_.assign(frame.data, frame.len);
+      in_pos_ += frame.header_len + frame.len;
+      running_ = true;
+      mutex_.Unlock();
+      response_.Clear();
+      DealMessageInternal(ordered_data_.data(), ordered_data_.size(),
+          &request_, &response_);
+      mutex_.Lock();
+      running_ = false;
+      if (!response_.IsInitialized()) {
+        // Parse failed
+        return false;
+      }
+      AppendResponse(response_, frame.v2, frame.request_id);
+      continue;
+    }
+
+    if (inflight_ >= kClientConnMaxInflight) {
+      // Pipeline tasks done continue from here
+      break;
+    }
+    SchedulePipelineTask(frame);
+    in_pos_ += frame.header_len + frame.len;
+  }
+  if (ret < 0) {
+    return false;
+  }
+
+  // Drop what's handled, pipeline tasks have their own copy
+  if (in_pos_ == in_buf_.size()) {
+    in_buf_.clear();
+    in_pos_ = 0;
+  } else if (in_pos_ > kClientConnReadSize) {
+    in_buf_.erase(0, in_pos_);
+    in_pos_ = 0;
+  }
+  return true;
+}
+
+// Required: hold mutex_
+void ZPDataClientConn::SchedulePipelineTask(const ClientFrame& frame) {
+  PipelineTask* task = NULL;
+  if (free_tasks_.empty()) {
+    task = new PipelineTask();
+    task->conn = this;
+  } else {
+    task = free_tasks_.back();
+    free_tasks_.pop_back();
+  }
+  task->request_id = frame.request_id;
+  task->data.assign(frame.data, frame.len);
+  inflight_++;
+  busy_workers_++;
+  zp_data_server->PipelineTaskSchedule(&DoPipelineTask, task);
+}
+
+void ZPDataClientConn::DoPipelineTask(void* arg) {
+  PipelineTask* task = static_cast<PipelineTask*>(arg);
+  task->response.Clear();
+  task->conn->DealMessageInternal(task->data.data(), task->data.size(),
+      &task->request, &task->response);
+  task->conn->FinishPipelineTask(task);
+}
+
+// Respond on the pipeline worker as much as the socket take without
+// waiting, the rest is left to the flusher.
+// Continue with requests held back for the done one
+void ZPDataClientConn::FinishPipelineTask(PipelineTask* task) {
+  mutex_.Lock();
+  if (!task->response.IsInitialized()) {
+    parse_error_ = true;
+  } else {
+    AppendResponse(task->response, true, task->request_id);
+  }
+  free_tasks_.push_back(task);
+  inflight_--;
+  if (!parse_error_ && !write_error_ && !DealPendingRequests()) {
+    parse_error_ = true;
+  }
+
+  // Flusher already watching will write mine too
+  bool watch = false;
+  if (!flushing_ && !write_error_ && FlushReply() && !out_buf_.empty()) {
+    flushing_ = true;
+    watch = true;
+  }
+  mutex_.Unlock();
+
+  // Not under mutex_, which the flusher lock after its own
+  if (watch) {
+    zp_data_server->client_flusher()->Watch(this);
+  }
+
+  slash::MutexLock l(&mutex_);
+  busy_workers_--;
+  busy_cond_.Signal();
+}
+
+// Called by the flusher once the socket is writable,
+// return true if there is more to write
+bool ZPDataClientConn::FlushPending() {
+  slash::MutexLock l(&mutex_);
+  if (!write_error_ && FlushReply() && !out_buf_.empty()) {
+    return true;
+  }
+  flushing_ = false;
+  return false;
 }
 
 // Msg is  [ length (int32) | pb_msg (length bytes) ]
-int ZPDataClientConn::DealMessageInternal() {
+// or v2   [ magic (1) | version (1) | flags (2) | length (4) |
+//           request id (8) | pb_msg (length bytes) ]
+int ZPDataClientConn::DealMessageInternal(const char* data, int len,
+    client::CmdRequest* request, client::CmdResponse* response) {
   if (!zp_data_server->Availible()) {
-    LOG(WARNING) << "Receive Client command " << static_cast<int>(request_.type())
+    LOG(WARNING) << "Receive Client command " << static_cast<int>(request->type())
       << " from (" << ip_port() << "), but the server is not availible yet";
-    response_.set_type(request_.type());
-    response_.set_code(client::StatusCode::kError);
-    response_.set_msg("server is not availible yet");
+    response->set_type(request->type());
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("server is not availible yet");
     return -1;
   }
 
-  if (!request_.ParseFromArray(rbuf_ + cur_pos_ - header_len_, header_len_)) {
+  if (!request->ParseFromArray(data, len)) {
     LOG(WARNING) << "Receive Client command, but parse error";
     return -1;
   }
 
-  Cmd* cmd = zp_data_server->CmdGet(static_cast<int>(request_.type()));
+  Cmd* cmd = zp_data_server->CmdGet(static_cast<int>(request->type()));
   if (cmd == NULL) {
-    response_.set_type(request_.type());
-    response_.set_code(client::StatusCode::kError);
-    response_.set_msg("unsupported cmd");
-    LOG(ERROR) << "unsupported type: " << (int)request_.type();
+    response->set_type(request->type());
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("unsupported cmd");
+    LOG(ERROR) << "unsupported type: " << (int)request->type();
     return -1;
   }
 
+  RequestContext context;
+  cmd->ExtractContext(request, &context);
+
   DLOG(INFO) << "Receive client cmd: " << cmd->name()
-    << ", table=" << cmd->ExtractTable(&request_)
-    << " key=" << cmd->ExtractKey(&request_);
+    << ", table=" << *context.table
+    << " key=" << *context.key;
 
-  zp_data_server->PlusStat(StatType::kClient, cmd->ExtractTable(&request_));
+  zp_data_server->PlusStat(StatType::kClient, *context.table);
 
   if (!cmd->is_single_paritition()) {
-    cmd->Do(&request_, &response_);
+    cmd->Do(request, response);
     return 0;
   }
 
   // Single Partition related Cmds
-  std::shared_ptr<Partition> partition;
-  int partition_id = cmd->ExtractPartition(&request_);
-  if (partition_id >= 0) {
-    partition = zp_data_server->GetTablePartitionById(cmd->ExtractTable(&request_),
-        partition_id);
-  } else {
-    partition = zp_data_server->GetTablePartition(cmd->ExtractTable(&request_),
-        cmd->ExtractKey(&request_));
-  }
-
+  std::shared_ptr<Partition> partition =
+    zp_data_server->GetTablePartition(context);
 
   if (partition == NULL) {
     // Partition not found
-    response_.set_type(request_.type());
-    response_.set_code(client::StatusCode::kError);
-    response_.set_msg("no partition");
+    response->set_type(request->type());
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("no partition");
     return -1;
   }
 
-  partition->DoCommand(cmd, request_, response_);
+  partition->DoCommand(cmd, *request, *response, &context);
 
   return 0;
 }
@@ -2,12 +2,30 @@
 #define ZP_DATA_CLIENT_CONN_H
 
 #include <string>
+#include <vector>
 #include "pink/include/pb_conn.h"
 #include "pink/include/pink_thread.h"
 #include "pink/include/server_thread.h"
+#include "slash/include/slash_mutex.h"
 
 #include "include/client.pb.h"
 
+// Flags of v2 frame
+enum ClientFrameFlag {
+  // Run after all the earlier requests on the connection are done,
+  // v1 frames are always ordered
+  kFrameFlagOrdered = 1,
+};
+
+struct ClientFrame {
+  bool v2;
+  uint16_t flags;
+  uint64_t request_id;
+  size_t header_len;
+  const char* data;
+  uint32_t len;
+};
+
 class ZPDataClientConn : public pink::PbConn {
  public:
   ZPDataClientConn(int fd, std::string ip_port, pink::Thread *thread);
@@ -15,11 +33,56 @@ class ZPDataClientConn : public pink::PbConn {
 
   virtual int DealMessage();
 
+  // Pipelining, every complete request in one read is executed,
+  // and their responses are written back together.
+  // A v2 frame carry a request id, which is echoed in its response,
+  // so that it could complete out of order
+  virtual pink::ReadStatus GetRequest() override;
+  virtual pink::WriteStatus SendReply() override;
+
+  // Write responses left by pipeline workers, used by ZPClientFlusher
+  bool FlushPending();
+
  private:
+  // Of ordered requests, used by whom set running_
   client::CmdRequest request_;
   client::CmdResponse response_;
-  
-  int DealMessageInternal();
+
+  // Protect all below, shared by the io thread and pipeline workers
+  slash::Mutex mutex_;
+  std::string in_buf_;
+  size_t in_pos_;  // where the next unhandled request begin
+  std::string out_buf_;
+  size_t out_pos_;  // where the next unsent response begin
+  bool write_error_;
+  bool parse_error_;  // found by pipeline workers
+
+  struct PipelineTask {
+    ZPDataClientConn* conn;
+    uint64_t request_id;
+    std::string data;  // copied, since in_buf_ may move before it run
+    client::CmdRequest request;
+    client::CmdResponse response;
+  };
+  // Tasks are reused along with their messages, so that the memory is kept
+  std::vector<PipelineTask*> free_tasks_;
+  size_t inflight_;  // pipeline tasks not done yet
+  size_t busy_workers_;  // pipeline workers still using me
+  slash::CondVar busy_cond_;
+  bool flushing_;  // watched by the flusher for responses left
+  bool running_;  // some thread is running an ordered request without lock
+  std::string ordered_data_;  // of the running ordered request
+
+  int DealMessageInternal(const char* data, int len,
+      client::CmdRequest* request, client::CmdResponse* response);
+  bool DealPendingRequests();
+  int PeekFrame(ClientFrame* frame);
+  void SchedulePipelineTask(const ClientFrame& frame);
+  static void DoPipelineTask(void* arg);
+  void FinishPipelineTask(PipelineTask* task);
+  void AppendResponse(const client::CmdResponse& response, bool v2,
+      uint64_t request_id);
+  bool FlushReply();
 };
 
 class ZPDataClientConnHandle : public pink::ServerHandle {
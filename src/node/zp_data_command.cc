@@ -1,8 +1,12 @@
 #include "src/node/zp_data_command.h"
 
+#include <map>
+#include <algorithm>
 #include <glog/logging.h>
 #include <google/protobuf/text_format.h>
 #include "slash/include/slash_string.h"
+#include "slash/include/slash_mutex.h"
+#include "rocksdb/write_batch.h"
 
 #include "include/db_nemo_impl.h"
 #include "src/node/zp_data_server.h"
@@ -21,8 +25,10 @@ void SetCmd::Do(const google::protobuf::Message *req,
   response->set_type(client::Type::SET);
 
   rocksdb::Status s;
+  int ttl = 0;
   if (request->set().has_expire()) {
-    int base = 0, ttl = request->set().expire().ttl();
+    int base = 0;
+    ttl = request->set().expire().ttl();
     if (request->set().expire().has_base()) {
       // Come from sync conn
       base = request->set().expire().base();
@@ -51,6 +57,10 @@ void SetCmd::Do(const google::protobuf::Message *req,
     response->set_msg(s.ToString());
     LOG(ERROR) << "command failed: Set, caz " << s.ToString();
   } else {
+    if (ptr->read_cache() != NULL) {
+      ptr->read_cache()->Update(request->set().key(),
+          request->set().value(), ttl);
+    }
     response->set_code(client::StatusCode::kOk);
     DLOG(INFO) << "Set key(" << request->set().key() << ") at "
       << ptr->table_name() << "_" << ptr->partition_id() << " ok";
@@ -61,6 +71,8 @@ bool SetCmd::GenerateLog(const google::protobuf::Message *req,
     std::string* log_raw) const {
   const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
   if (request->set().has_expire()) {
+    // Copy to stamp the base, an appended patch would be merged when
+    // parsed by slaves, and their binlog items come out shorter
     client::CmdRequest log_req(*request);
     log_req.mutable_set()->mutable_expire()->set_base(time(NULL));
     return log_req.SerializeToString(log_raw);
@@ -78,16 +90,27 @@ void GetCmd::Do(const google::protobuf::Message *req,
   client::CmdResponse_Get* get_res = response->mutable_get();
   response->set_type(client::Type::GET);
 
+  ZPReadCache* cache = ptr->read_cache();
+  uint64_t epoch = 0;
+  if (cache != NULL
+      && cache->Lookup(request->get().key(), get_res->mutable_value(), &epoch)) {
+    response->set_code(client::StatusCode::kOk);
+    return;
+  }
+
   std::string value;
   rocksdb::Status s = ptr->db()->Get(rocksdb::ReadOptions(),
       request->get().key(),
       &value);
   if (s.ok()) {
     response->set_code(client::StatusCode::kOk);
-    get_res->set_value(value);
+    if (cache != NULL) {
+      cache->Fill(request->get().key(), value, epoch);
+    }
+    get_res->mutable_value()->swap(value);
     DLOG(INFO) << "Get key(" << request->get().key()
       << ") at " << ptr->table_name() << "_" << ptr->partition_id()
-      << " ok, value is (" << value << ")";
+      << " ok, value is (" << get_res->value() << ")";
   } else if (s.IsNotFound()) {
     response->set_code(client::StatusCode::kNotFound);
     DLOG(INFO) << "Get key(" << request->get().key() <<
@@ -117,56 +140,675 @@ void DelCmd::Do(const google::protobuf::Message *req,
     response->set_msg(s.ToString());
     LOG(ERROR) << "command failed: Del, caz " << s.ToString();
   } else {
+    if (ptr->read_cache() != NULL) {
+      ptr->read_cache()->Erase(request->del().key());
+    }
     response->set_code(client::StatusCode::kOk);
     DLOG(INFO) << "Del key(" << request->del().key()
       << ") at Partition: " << ptr->partition_id() << " ok";
   }
 }
 
-void MgetCmd::Do(const google::protobuf::Message *req,
-    google::protobuf::Message *res, void* ptr) const {
+// Current value of key for read-modify-write, always from db,
+// the cache may hold one expired already.
+// Keys with ttl are refused by the caller, since the binlog hold the
+// operand only, and the value may have expired on slaves but not here.
+// Return Status::NotFound with empty value if there is no such key,
+// or Status::NotSupported if it has ttl
+// Required: hold the lock of key
+static rocksdb::Status ReadForUpdate(Partition* ptr, const std::string& key,
+    std::string* value) {
+  rocksdb::Status s = ptr->db()->Get(rocksdb::ReadOptions(), key, value);
+  if (s.IsNotFound()) {
+    value->clear();
+    return rocksdb::Status::NotFound();
+  }
+  if (!s.ok()) {
+    return s;
+  }
+  // -1 for no ttl, expired right after Get counts as having one
+  int32_t ttl = 0;
+  s = ptr->db()->GetKeyTTL(rocksdb::ReadOptions(), key, &ttl);
+  if (s.IsNotFound() || (s.ok() && ttl != -1)) {
+    return rocksdb::Status::NotSupported("key has ttl");
+  }
+  return s;
+}
+
+void IncrbyCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
   const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
   client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  Partition* ptr = static_cast<Partition*>(partition);
+
   response->Clear();
-  response->set_type(client::Type::MGET);
+  response->set_type(request->type());
 
-  // One error all error
-  Cmd* sub_cmd = zp_data_server->CmdGet(client::Type::GET);
-  client::CmdRequest sub_req;
-  sub_req.set_type(client::Type::GET);
-  client::CmdResponse sub_res;
-  sub_res.set_type(client::Type::GET);
-  for (auto& key : request->mget().keys()) {
+  const std::string& key = request->incrby().key();
+  std::string value;
+  rocksdb::Status s = ReadForUpdate(ptr, key, &value);
+  if (s.IsNotSupported()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("key has ttl");
+    return;
+  } else if (!s.ok() && !s.IsNotFound()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(ERROR) << "command failed: Incrby, caz " << s.ToString();
+    return;
+  }
+
+  long current = 0;
+  if (s.ok() && !slash::string2l(value.data(), value.size(), &current)) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("value is not an integer");
+    return;
+  }
+  int64_t by = request->incrby().by();
+  int64_t result = 0;
+  bool overflow = (request->type() == client::Type::DECRBY)
+    ? __builtin_sub_overflow(static_cast<int64_t>(current), by, &result)
+    : __builtin_add_overflow(static_cast<int64_t>(current), by, &result);
+  if (overflow) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("increment or decrement would overflow");
+    return;
+  }
+
+  value = std::to_string(result);
+  s = ptr->db()->Put(rocksdb::WriteOptions(), key, value);
+  if (!s.ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(ERROR) << "command failed: Incrby, caz " << s.ToString();
+    return;
+  }
+  if (ptr->read_cache() != NULL) {
+    ptr->read_cache()->Update(key, value, 0);
+  }
+  response->set_code(client::StatusCode::kOk);
+  response->mutable_incrby()->set_value(result);
+  DLOG(INFO) << "Incrby key(" << key << ") at " << ptr->table_name() << "_"
+    << ptr->partition_id() << " ok, value is (" << result << ")";
+}
+
+void AppendCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  Partition* ptr = static_cast<Partition*>(partition);
+
+  response->Clear();
+  response->set_type(client::Type::APPEND);
+
+  const std::string& key = request->append().key();
+  std::string value;
+  rocksdb::Status s = ReadForUpdate(ptr, key, &value);
+  if (s.IsNotSupported()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("key has ttl");
+    return;
+  } else if (!s.ok() && !s.IsNotFound()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(ERROR) << "command failed: Append, caz " << s.ToString();
+    return;
+  }
+
+  value.append(request->append().value());
+  s = ptr->db()->Put(rocksdb::WriteOptions(), key, value);
+  if (!s.ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(ERROR) << "command failed: Append, caz " << s.ToString();
+    return;
+  }
+  if (ptr->read_cache() != NULL) {
+    ptr->read_cache()->Update(key, value, 0);
+  }
+  response->set_code(client::StatusCode::kOk);
+  response->mutable_append()->set_length(value.size());
+  DLOG(INFO) << "Append key(" << key << ") at " << ptr->table_name() << "_"
+    << ptr->partition_id() << " ok, length is " << value.size();
+}
+
+// Mget, Mset and Mdel run on partitions by group of keys
+static int BatchSize(const client::CmdRequest& request) {
+  switch (request.type()) {
+    case client::Type::MGET:
+      return request.mget().keys_size();
+    case client::Type::MSET:
+      return request.mset().kvs_size();
+    default:
+      return request.mdel().keys_size();
+  }
+}
+
+static const std::string& BatchTable(const client::CmdRequest& request) {
+  switch (request.type()) {
+    case client::Type::MGET:
+      return request.mget().table_name();
+    case client::Type::MSET:
+      return request.mset().table_name();
+    default:
+      return request.mdel().table_name();
+  }
+}
+
+static const std::string& BatchKey(const client::CmdRequest& request, int i) {
+  switch (request.type()) {
+    case client::Type::MGET:
+      return request.mget().keys(i);
+    case client::Type::MSET:
+      return request.mset().kvs(i).key();
+    default:
+      return request.mdel().keys(i);
+  }
+}
+
+// Append the ith key of request to the group of partition_id
+static void AddToBatchGroup(const client::CmdRequest& request, int i,
+    int partition_id, client::CmdRequest* group) {
+  group->set_type(request.type());
+  if (request.type() == client::Type::MGET) {
+    client::CmdRequest_Mget* mget = group->mutable_mget();
+    if (!mget->has_table_name()) {
+      mget->set_table_name(request.mget().table_name());
+      mget->set_partition_id(partition_id);
+      if (request.mget().has_staleness()) {
+        mget->mutable_staleness()->CopyFrom(request.mget().staleness());
+      }
+    }
+    mget->add_keys(request.mget().keys(i));
+  } else if (request.type() == client::Type::MSET) {
+    client::CmdRequest_Mset* mset = group->mutable_mset();
+    mset->set_table_name(request.mset().table_name());
+    mset->set_partition_id(partition_id);
+    mset->add_kvs()->CopyFrom(request.mset().kvs(i));
+  } else {
+    client::CmdRequest_Mdel* mdel = group->mutable_mdel();
+    mdel->set_table_name(request.mdel().table_name());
+    mdel->set_partition_id(partition_id);
+    mdel->add_keys(request.mdel().keys(i));
+  }
+}
+
+// Whether request is a group of keys from the peer, rather than client
+static bool IsBatchGroup(const client::CmdRequest& request) {
+  switch (request.type()) {
+    case client::Type::MGET:
+      return request.mget().has_partition_id();
+    case client::Type::MSET:
+      return request.mset().has_partition_id();
+    default:
+      return request.mdel().has_partition_id();
+  }
+}
+
+struct BatchGroup {
+  int size;
+  bool forward;  // to the master if partition is not served here
+  std::shared_ptr<Partition> partition;
+  client::CmdRequest request;
+  client::CmdResponse response;
+};
+
+// Forward the group to where the partition redirect it, if not myself,
+// the result of every key is kept in response like a local one
+static void ForwardBatchGroup(BatchGroup* group) {
+  client::CmdResponse& response = group->response;
+  if (response.code() == client::StatusCode::kOk || !response.has_redirect()) {
+    return;
+  }
+  Node node(response.redirect().ip(), response.redirect().port());
+  if (node.empty() || zp_data_server->IsSelf(node)) {
+    return;
+  }
+
+  client::CmdResponse forward_res;
+  Status s = zp_data_server->ForwardToPeer(node, group->request, &forward_res);
+  if (!s.ok()) {
+    // Keep the redirect, client could still go there itself
+    LOG(WARNING) << "Failed to forward " << static_cast<int>(group->request.type())
+      << " of partition " << group->partition->partition_id()
+      << " to " << node << ", " << s.ToString();
+    response.set_msg("forward failed: " + s.ToString());
+    return;
+  }
+
+  // One partition, so every key has the same result but Mget ones
+  if (forward_res.type() == client::Type::MGET
+      && forward_res.mget_size() == group->size) {
+    forward_res.set_code(client::StatusCode::kOk);
+    forward_res.clear_msg();
+  } else if (forward_res.key_results_size() == group->size
+      && forward_res.code() != client::StatusCode::kOk) {
+    const client::CmdResponse_KeyResult& first = forward_res.key_results(0);
+    forward_res.set_code(first.code());
+    forward_res.set_msg(first.msg());
+    if (first.has_redirect()) {
+      forward_res.mutable_redirect()->CopyFrom(first.redirect());
+    }
+  }
+  response.Swap(&forward_res);
+}
+
+static void DoBatchGroup(const Cmd* cmd, BatchGroup* group) {
+  group->partition->DoCommand(cmd, group->request, group->response);
+  if (group->forward) {
+    ForwardBatchGroup(group);
+  }
+}
+
+// Wait for all groups of one request
+struct BatchFanOut {
+  slash::Mutex mutex;
+  slash::CondVar cond;
+  int pending;
+  explicit BatchFanOut(int num)
+    : cond(&mutex),
+    pending(num) {
+    }
+};
+
+struct BatchGroupTask {
+  const Cmd* cmd;
+  BatchGroup* group;
+  BatchFanOut* fan_out;
+};
+
+static void DoBatchGroupTask(void* arg) {
+  BatchGroupTask* task = static_cast<BatchGroupTask*>(arg);
+  DoBatchGroup(task->cmd, task->group);
+  slash::MutexLock l(&task->fan_out->mutex);
+  if (--task->fan_out->pending == 0) {
+    task->fan_out->cond.Signal();
+  }
+}
+
+// Hand the groups to multikey workers but the first one,
+// which run inline, then wait for all of them
+static void DoBatchGroupsInParallel(const Cmd* cmd,
+    std::map<int, BatchGroup>* groups) {
+  BatchFanOut fan_out(groups->size());
+  std::vector<BatchGroupTask> tasks;
+  tasks.reserve(groups->size());
+  for (auto& item : *groups) {
+    BatchGroupTask task = {cmd, &item.second, &fan_out};
+    tasks.push_back(task);
+  }
+  for (size_t i = 1; i < tasks.size(); i++) {
+    zp_data_server->MultiKeyTaskSchedule(&DoBatchGroupTask, &tasks[i]);
+  }
+  DoBatchGroupTask(&tasks[0]);
+
+  slash::MutexLock l(&fan_out.mutex);
+  while (fan_out.pending > 0) {
+    fan_out.cond.Wait();
+  }
+}
+
+// Group keys of request by partition, then apply each group on its
+// partition as the same command. The ith key is the key_pos[i]th one
+// of group key_groups[i], which is -1 if there is no partition for it.
+// Groups of partitions not served here are forwarded to their masters,
+// unless request is already a group forwarded by the peer
+static void DoBatchOnPartitions(const Cmd* cmd,
+    const client::CmdRequest& request, std::map<int, BatchGroup>* groups,
+    std::vector<int>* key_groups, std::vector<int>* key_pos) {
+  const std::string& table_name = BatchTable(request);
+  key_groups->assign(BatchSize(request), -1);
+  key_pos->assign(BatchSize(request), -1);
+  for (int i = 0; i < BatchSize(request); i++) {
     std::shared_ptr<Partition> partition = zp_data_server->GetTablePartition(
-        request->mget().table_name(), key);
+        table_name, BatchKey(request, i));
     if (partition == NULL) {
-      LOG(WARNING) << "command failed: Mget, no partition for key:" << key;
+      continue;
+    }
+    auto iter = groups->find(partition->partition_id());
+    if (iter == groups->end()) {
+      iter = groups->insert(std::make_pair(partition->partition_id(),
+            BatchGroup())).first;
+      iter->second.size = 0;
+      iter->second.forward = !IsBatchGroup(request);
+      iter->second.partition = partition;
+    }
+    BatchGroup& group = iter->second;
+    (*key_pos)[i] = group.size++;
+    AddToBatchGroup(request, i, partition->partition_id(), &group.request);
+    (*key_groups)[i] = partition->partition_id();
+  }
+
+  if (!cmd->is_write() && groups->size() > 1
+      && BatchSize(request) >= kMultiKeyParallelMinKeys) {
+    DoBatchGroupsInParallel(cmd, groups);
+  } else {
+    for (auto& item : *groups) {
+      DoBatchGroup(cmd, &item.second);
+    }
+  }
+
+  for (auto& item : *groups) {
+    BatchGroup& group = item.second;
+    if (group.response.code() != client::StatusCode::kOk) {
+      LOG(WARNING) << "command failed: " << cmd->name() << ", table: "
+        << table_name << ", partition: " << item.first
+        << ", error: " << group.response.msg();
+    }
+  }
+}
+
+void MgetCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  response->Clear();
+  response->set_type(client::Type::MGET);
+
+  if (partition == NULL) {
+    std::map<int, BatchGroup> groups;
+    std::vector<int> key_groups, key_pos;
+    DoBatchOnPartitions(this, *request, &groups, &key_groups, &key_pos);
+
+    bool all_ok = true;
+    for (int i = 0; i < request->mget().keys_size(); i++) {
+      client::CmdResponse_Mget* mget = response->add_mget();
+      mget->set_key(request->mget().keys(i));
+      if (key_groups[i] < 0) {
+        mget->set_value("");
+        mget->set_code(client::StatusCode::kError);
+        mget->set_msg("no partition");
+        all_ok = false;
+        continue;
+      }
+      client::CmdResponse& group_res = groups[key_groups[i]].response;
+      if (group_res.code() != client::StatusCode::kOk) {
+        // The whole group failed, such as not local or too stale
+        mget->set_value("");
+        mget->set_code(group_res.code());
+        mget->set_msg(group_res.msg());
+        if (group_res.has_redirect()) {
+          mget->mutable_redirect()->CopyFrom(group_res.redirect());
+        }
+        all_ok = false;
+        continue;
+      }
+      client::CmdResponse_Mget* found = group_res.mutable_mget(key_pos[i]);
+      mget->mutable_value()->swap(*found->mutable_value());
+      mget->set_code(found->code());
+      if (found->has_msg()) {
+        mget->set_msg(found->msg());
+      }
+      all_ok = all_ok && (found->code() == client::StatusCode::kOk
+          || found->code() == client::StatusCode::kNotFound);
+    }
+    if (all_ok) {
+      response->set_code(client::StatusCode::kOk);
+    } else {
       response->set_code(client::StatusCode::kError);
-      response->set_msg("no partition" + key);
-      return;
+      response->set_msg("some keys failed");
     }
+    return;
+  }
 
-    // convert to multi sub command, then execute
-    sub_req.Clear();
-    sub_res.Clear();
-    client::CmdRequest_Get* get = sub_req.mutable_get();
-    get->set_table_name(request->mget().table_name());
-    get->set_key(key);
-    partition->DoCommand(sub_cmd, sub_req, sub_res);
-    if (sub_res.code() != client::StatusCode::kOk
-        && sub_res.code() != client::StatusCode::kNotFound) {
-      LOG(WARNING) << "command failed: Mget, key:" << key << ", error:" << sub_res.msg();
-      response->set_code(sub_res.code());
-      response->set_msg(sub_res.msg());
-      return;
+  // Keys of one partition, the ones missed in cache looked up together
+  Partition* ptr = static_cast<Partition*>(partition);
+  ZPReadCache* cache = ptr->read_cache();
+  int key_num = request->mget().keys_size();
+  std::vector<std::string> values(key_num);
+  std::vector<rocksdb::Status> ss(key_num);
+  std::vector<uint64_t> epochs(key_num);
+  std::vector<int> missed;
+  std::vector<rocksdb::Slice> keys;
+  for (int i = 0; i < key_num; i++) {
+    const std::string& key = request->mget().keys(i);
+    if (cache != NULL && cache->Lookup(key, &values[i], &epochs[i])) {
+      continue;
+    }
+    missed.push_back(i);
+    keys.push_back(key);
+  }
+  if (!keys.empty()) {
+    std::vector<std::string> missed_values;
+    std::vector<rocksdb::Status> missed_ss = ptr->db()->MultiGet(
+        rocksdb::ReadOptions(), keys, &missed_values);
+    for (size_t j = 0; j < missed.size(); j++) {
+      int i = missed[j];
+      ss[i] = missed_ss[j];
+      values[i].swap(missed_values[j]);
+      if (ss[i].IsNotSupported()) {
+        // Lookup one by one if the db could not do it in batch
+        ss[i] = ptr->db()->Get(rocksdb::ReadOptions(), keys[j], &values[i]);
+      }
+      if (ss[i].ok() && cache != NULL) {
+        cache->Fill(keys[j].ToString(), values[i], epochs[i]);
+      }
     }
+  }
+  for (int i = 0; i < key_num; i++) {
     client::CmdResponse_Mget* mget = response->add_mget();
-    mget->set_key(key);
-    if (sub_res.code() == client::StatusCode::kOk) {
-      mget->set_value(sub_res.get().value());
+    mget->set_key(request->mget().keys(i));
+    if (ss[i].ok()) {
+      mget->mutable_value()->swap(values[i]);
+      mget->set_code(client::StatusCode::kOk);
+    } else if (ss[i].IsNotFound()) {
+      mget->set_value("");
+      mget->set_code(client::StatusCode::kNotFound);
     } else {
       mget->set_value("");
+      mget->set_code(client::StatusCode::kError);
+      mget->set_msg(ss[i].ToString());
+      LOG(ERROR) << "command failed: Mget at "
+        << ptr->table_name() << "_"  << ptr->partition_id()
+        << ", caz " << ss[i].ToString();
+    }
+  }
+  response->set_code(client::StatusCode::kOk);
+}
+
+// Result of every key of Mset or Mdel, which is the result of its group
+static void FillKeyResults(const client::CmdRequest& request,
+    std::map<int, BatchGroup>& groups, const std::vector<int>& key_groups,
+    client::CmdResponse* response) {
+  bool all_ok = true;
+  for (int i = 0; i < BatchSize(request); i++) {
+    client::CmdResponse_KeyResult* result = response->add_key_results();
+    result->set_key(BatchKey(request, i));
+    if (key_groups[i] < 0) {
+      result->set_code(client::StatusCode::kError);
+      result->set_msg("no partition");
+      all_ok = false;
+      continue;
+    }
+    const client::CmdResponse& group_res = groups[key_groups[i]].response;
+    result->set_code(group_res.code());
+    if (group_res.has_msg()) {
+      result->set_msg(group_res.msg());
+    }
+    if (group_res.has_redirect()) {
+      result->mutable_redirect()->CopyFrom(group_res.redirect());
+    }
+    all_ok = all_ok && group_res.code() == client::StatusCode::kOk;
+  }
+  if (all_ok) {
+    response->set_code(client::StatusCode::kOk);
+  } else {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("some keys failed");
+  }
+}
+
+void MsetCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  response->Clear();
+  response->set_type(client::Type::MSET);
+  if (partition == NULL) {
+    std::map<int, BatchGroup> groups;
+    std::vector<int> key_groups, key_pos;
+    DoBatchOnPartitions(this, *request, &groups, &key_groups, &key_pos);
+    FillKeyResults(*request, groups, key_groups, response);
+    return;
+  }
+
+  // Keys of one partition
+  Partition* ptr = static_cast<Partition*>(partition);
+  rocksdb::WriteBatch batch;
+  for (auto& kv : request->mset().kvs()) {
+    batch.Put(kv.key(), kv.value());
+  }
+  rocksdb::Status s = ptr->db()->Write(rocksdb::WriteOptions(), &batch);
+  if (!s.ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(ERROR) << "command failed: Mset at "
+      << ptr->table_name() << "_"  << ptr->partition_id()
+      << ", caz " << s.ToString();
+  } else {
+    if (ptr->read_cache() != NULL) {
+      for (auto& kv : request->mset().kvs()) {
+        ptr->read_cache()->Update(kv.key(), kv.value(), 0);
+      }
+    }
+    response->set_code(client::StatusCode::kOk);
+  }
+}
+
+void MdelCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  response->Clear();
+  response->set_type(client::Type::MDEL);
+  if (partition == NULL) {
+    std::map<int, BatchGroup> groups;
+    std::vector<int> key_groups, key_pos;
+    DoBatchOnPartitions(this, *request, &groups, &key_groups, &key_pos);
+    FillKeyResults(*request, groups, key_groups, response);
+    return;
+  }
+
+  // Keys of one partition
+  Partition* ptr = static_cast<Partition*>(partition);
+  rocksdb::WriteBatch batch;
+  for (auto& key : request->mdel().keys()) {
+    batch.Delete(key);
+  }
+  rocksdb::Status s = ptr->db()->Write(rocksdb::WriteOptions(), &batch);
+  if (!s.ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(ERROR) << "command failed: Mdel at "
+      << ptr->table_name() << "_"  << ptr->partition_id()
+      << ", caz " << s.ToString();
+  } else {
+    if (ptr->read_cache() != NULL) {
+      for (auto& key : request->mdel().keys()) {
+        ptr->read_cache()->Erase(key);
+      }
+    }
+    response->set_code(client::StatusCode::kOk);
+  }
+}
+
+void MsyncCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* ptr) const {
+  const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  response->Clear();
+  response->set_type(client::Type::MSYNC);
+
+  // Every partition has its own result
+  Cmd* sub_cmd = zp_data_server->CmdGet(client::Type::SYNC);
+  client::CmdRequest sub_req;
+  sub_req.set_type(client::Type::SYNC);
+  for (auto& sync : request->msync().syncs()) {
+    client::CmdResponse* sub_res = response->add_msync();
+    sub_res->set_type(client::Type::SYNC);
+    std::shared_ptr<Partition> partition = zp_data_server->GetTablePartitionById(
+        sync.table_name(), sync.sync_offset().partition());
+    if (partition == NULL) {
+      LOG(WARNING) << "command failed: Msync, no partition: "
+        << sync.table_name() << "_" << sync.sync_offset().partition();
+      sub_res->set_code(client::StatusCode::kError);
+      sub_res->set_msg("no partition");
+      continue;
+    }
+
+    // convert to sync command, then execute
+    sub_req.mutable_sync()->CopyFrom(sync);
+    partition->DoCommand(sub_cmd, sub_req, *sub_res);
+  }
+  response->set_code(client::StatusCode::kOk);
+}
+
+void SubscribeCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* ptr) const {
+  const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  response->Clear();
+  response->set_type(client::Type::SUBSCRIBE);
+  const client::CmdRequest_Subscribe& subscribe = request->subscribe();
+  client::CmdResponse_Subscribe* result = response->mutable_subscribe();
+
+  std::shared_ptr<Table> table = zp_data_server->GetTable(subscribe.table_name());
+  if (table == NULL) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("no table");
+    return;
+  }
+
+  // Begin from the current end of every partition
+  if (subscribe.cursors_size() == 0) {
+    std::vector<PartitionBinlogOffset> offsets;
+    table->DumpPartitionBinlogOffsets(offsets);
+    for (auto& po : offsets) {
+      std::shared_ptr<Partition> partition = table->GetPartitionById(po.partition_id);
+      if (partition == NULL || !partition->opened()) {
+        continue;
+      }
+      client::SyncOffset* cursor = result->add_cursors();
+      cursor->set_filenum(po.filenum);
+      cursor->set_offset(po.offset);
+      cursor->set_partition(po.partition_id);
+    }
+    response->set_code(client::StatusCode::kOk);
+    return;
+  }
+
+  int max_records = std::min(std::max(subscribe.max_records(), 1),
+      kSubscribeMaxRecords);
+  // Shared by all partitions, so that one response never exceed it
+  uint64_t max_bytes = kSubscribeMaxBytes;
+  for (auto& from : subscribe.cursors()) {
+    std::shared_ptr<Partition> partition = table->GetPartitionById(from.partition());
+    if (partition == NULL) {
+      response->Clear();
+      response->set_type(client::Type::SUBSCRIBE);
+      response->set_code(client::StatusCode::kError);
+      response->set_msg("no partition " + std::to_string(from.partition()));
+      return;
+    }
+    uint32_t filenum = from.filenum();
+    uint64_t offset = from.offset();
+    int found = result->records_size();
+    Status s = partition->ReadBinlogRecords(subscribe.key_prefix(),
+        max_records - found, &max_bytes, &filenum, &offset, result);
+    if (!s.ok()) {
+      LOG(WARNING) << "command failed: Subscribe, table: " << subscribe.table_name()
+        << ", partition: " << from.partition() << ", " << s.ToString();
+      response->Clear();
+      response->set_type(client::Type::SUBSCRIBE);
+      response->set_code(client::StatusCode::kError);
+      response->set_msg("partition " + std::to_string(from.partition())
+          + ": " + s.ToString());
+      return;
     }
+    client::SyncOffset* cursor = result->add_cursors();
+    cursor->set_filenum(filenum);
+    cursor->set_offset(offset);
+    cursor->set_partition(from.partition());
   }
   response->set_code(client::StatusCode::kOk);
 }
@@ -229,7 +871,7 @@ void InfoCmd::Do(const google::protobuf::Message *req,
       }
 
       for (auto& info_repl : info_repls) {
-        response->add_info_repl()->CopyFrom(info_repl.second);
+        response->add_info_repl()->Swap(&info_repl.second);
       }
       break;
     }
@@ -272,12 +914,41 @@ void SyncCmd::Do(const google::protobuf::Message *req,
   LOG(INFO) << "SyncCmd with a new node ("
     << ptr->table_name() << "_"  << ptr->partition_id()
     << "_" << node.ip << ":" << node.port << ", "
-    << s_filenum << ", " << s_offset << ")";
+    << s_filenum << ", " << s_offset << ", " << sync_req.repl_id() << ")";
+  if (ptr->MapSyncPoint(sync_req.repl_id(), &s_filenum, &s_offset)) {
+    // Slave has items never be in my binlog, fallback to the exact end of its term
+    response->set_code(client::StatusCode::kFallback);
+    client::CmdResponse_Sync *sync_res = response->mutable_sync();
+    sync_res->set_table_name(sync_req.table_name());
+    client::SyncOffset *offset = sync_res->mutable_sync_offset();
+    offset->set_filenum(s_filenum);
+    offset->set_offset(s_offset);
+    return;
+  }
   s = ptr->SlaveAskSync(node, s_filenum, s_offset);
 
   if (s.ok()) {
     response->set_code(client::StatusCode::kOk);
+    // Send back my history for slave to continue with
+    client::CmdResponse_Sync *sync_res = response->mutable_sync();
+    sync_res->set_table_name(sync_req.table_name());
+    client::SyncOffset *offset = sync_res->mutable_sync_offset();
+    offset->set_filenum(s_filenum);
+    offset->set_offset(s_offset);
+    for (auto& term : ptr->ReplHistoryTerms()) {
+      client::ReplTerm* rterm = sync_res->add_repl_history();
+      rterm->set_repl_id(term.repl_id);
+      rterm->mutable_begin()->set_filenum(term.filenum);
+      rterm->mutable_begin()->set_offset(term.offset);
+    }
     DLOG(INFO) << "SyncCmd add node ok";
+  } else if (s.IsEndFile()
+      && !ptr->GetWinBinlogOffset(&s_filenum, &s_offset)) {
+    // I'm a slave feeding peer in chain, let peer wait for me to catch up
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("upstream is behind");
+    DLOG(INFO) << "SyncCmd with offset larger than upstream, node:"
+      << sync_req.node().ip() << ":" << sync_req.node().port();
   } else if (s.IsEndFile() || s.IsInvalidArgument()) {
     // Need send fallback offset
     response->set_code(client::StatusCode::kFallback);
@@ -14,11 +14,11 @@ class SetCmd : public Cmd {
       google::protobuf::Message *res, void* partition) const;
   virtual bool GenerateLog(const google::protobuf::Message *request,
       std::string* raw) const override;
-  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->set().table_name();
   }
-  virtual std::string ExtractKey(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractKey(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->set().key();
   }
@@ -32,14 +32,19 @@ class GetCmd : public Cmd {
   }
   virtual void Do(const google::protobuf::Message *req,
       google::protobuf::Message *res, void* partition) const;
-  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->get().table_name();
   }
-  virtual std::string ExtractKey(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractKey(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->get().key();
   }
+  virtual const client::ReadStaleness* ExtractStaleness(
+      const google::protobuf::Message *req) const override {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->get().has_staleness() ? &request->get().staleness() : NULL;
+  }
 };
 
 class DelCmd : public Cmd {
@@ -50,16 +55,55 @@ class DelCmd : public Cmd {
   }
   virtual void Do(const google::protobuf::Message *req,
       google::protobuf::Message *res, void* partition) const;
-  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->del().table_name();
   }
-  virtual std::string ExtractKey(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractKey(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->del().key();
   }
 };
 
+// Read, modify and write the value under the lock of key,
+// logged as the operand only, keys with ttl are refused.
+// Incrby handle DECRBY too
+class IncrbyCmd : public Cmd {
+ public:
+  IncrbyCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "Incrby"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition) const;
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->incrby().table_name();
+  }
+  virtual const std::string& ExtractKey(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->incrby().key();
+  }
+};
+
+class AppendCmd : public Cmd {
+ public:
+  AppendCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "Append"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition) const;
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->append().table_name();
+  }
+  virtual const std::string& ExtractKey(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->append().key();
+  }
+};
+
 ////// Info Cmds /////
 class InfoCmd : public Cmd {
  public:
@@ -69,12 +113,12 @@ class InfoCmd : public Cmd {
   }
   virtual void Do(const google::protobuf::Message *req,
       google::protobuf::Message *res, void* parition = NULL) const;
-  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     if (request->has_info() && request->info().has_table_name()) {
       return request->info().table_name();
     }
-    return "";
+    return kCmdEmptyArg;
   }
 };
 
@@ -87,7 +131,7 @@ class SyncCmd : public Cmd {
   }
   virtual void Do(const google::protobuf::Message *req,
       google::protobuf::Message *res, void* partition) const;
-  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->sync().table_name();
   }
@@ -97,6 +141,30 @@ class SyncCmd : public Cmd {
   }
 };
 
+class SubscribeCmd : public Cmd {
+ public:
+  SubscribeCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "Subscribe"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition = NULL) const;
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->subscribe().table_name();
+  }
+};
+
+class MsyncCmd : public Cmd {
+ public:
+  MsyncCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "Msync"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition = NULL) const;
+};
+
 class MgetCmd : public Cmd {
  public:
   MgetCmd(int flag) : Cmd(flag) {}
@@ -104,11 +172,75 @@ class MgetCmd : public Cmd {
     return "Mget"; 
   }
   virtual void Do(const google::protobuf::Message *req,
-      google::protobuf::Message *res, void* partition) const;
-  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+      google::protobuf::Message *res, void* partition = NULL) const;
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
     return request->mget().table_name();
   }
+  virtual int ExtractPartition(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->mget().has_partition_id()
+      ? request->mget().partition_id() : -1;
+  }
+  virtual const client::ReadStaleness* ExtractStaleness(
+      const google::protobuf::Message *req) const override {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->mget().has_staleness() ? &request->mget().staleness() : NULL;
+  }
+};
+
+// Mset and Mdel are dispatched to partitions by group of keys,
+// and applied on partition, or replayed from binlog, as one WriteBatch
+class MsetCmd : public Cmd {
+ public:
+  MsetCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "Mset"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition = NULL) const;
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->mset().table_name();
+  }
+  virtual int ExtractPartition(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->mset().has_partition_id()
+      ? request->mset().partition_id() : -1;
+  }
+  virtual bool ExtractKeys(const google::protobuf::Message *req,
+      std::vector<std::string>* keys) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    for (auto& kv : request->mset().kvs()) {
+      keys->push_back(kv.key());
+    }
+    return true;
+  }
+};
+
+class MdelCmd : public Cmd {
+ public:
+  MdelCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const override {
+    return "Mdel"; 
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition = NULL) const;
+  virtual const std::string& ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->mdel().table_name();
+  }
+  virtual int ExtractPartition(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    return request->mdel().has_partition_id()
+      ? request->mdel().partition_id() : -1;
+  }
+  virtual bool ExtractKeys(const google::protobuf::Message *req,
+      std::vector<std::string>* keys) const {
+    const client::CmdRequest* request = static_cast<const client::CmdRequest*>(req);
+    keys->assign(request->mdel().keys().begin(), request->mdel().keys().end());
+    return true;
+  }
 };
 
 #endif
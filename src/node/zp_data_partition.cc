@@ -5,10 +5,12 @@
 #include <unistd.h>
 #include <vector>
 #include <fstream>
+#include <algorithm>
 #include <glog/logging.h>
+#include "rocksdb/sst_file_writer.h"
 
-#include "slash/include/rsync.h"
 #include "src/node/zp_data_server.h"
+#include "src/node/zp_dbsync.h"
 
 extern ZPDataServer* zp_data_server;
 
@@ -31,12 +33,23 @@ Partition::Partition(const std::string &table_name, const int partition_id,
   : table_name_(table_name),
   partition_id_(partition_id),
   opened_(false),
+  down_upstream_("", 0),
+  upstream_active_us_(0),
   readonly_(false),
   pstate_(ZPMeta::PState::ACTIVE),
   role_(Role::kNodeSingle),
   repl_state_(ReplState::kNoConnect),
+  db_ref_cond_(&db_ref_mutex_),
+  db_refs_(0),
+  db_closing_(false),
   do_recovery_sync_(false),
   recover_sync_flag_(0),
+  sync_credit_pending_(0),
+  last_resync_us_(0),
+  upstream_head_filenum_(0),
+  upstream_head_offset_(0),
+  caught_up_us_(0),
+  applied_write_us_(0),
   purging_(false),
   purged_index_(0) {
     // Partition related path
@@ -57,6 +70,12 @@ Partition::Partition(const std::string &table_name, const int partition_id,
     if (bgsave_path_.back() != '/') {
       bgsave_path_.push_back('/');
     }
+    repl_history_ = new ReplHistory(log_path_ + kReplHistoryFile);
+    read_cache_ = NULL;
+    if (g_zp_conf->db_read_cache_size() > 0) {
+      read_cache_ = new ZPReadCache(
+          static_cast<size_t>(g_zp_conf->db_read_cache_size()) * 1024);
+    }
     
     pthread_rwlock_init(&state_rw_, NULL);
     pthread_rwlockattr_t attr;
@@ -90,6 +109,14 @@ Status Partition::Open() {
     return s;
   }
 
+  // Replication history, sync by offset only if it's unavailable
+  s = repl_history_->Load();
+  if (!s.ok()) {
+    LOG(WARNING) << "Load repl history failed: " << s.ToString()
+      << ", table: " << table_name_ << ", partition: " << partition_id_;
+    repl_history_->Reset(std::vector<ReplTerm>());
+  }
+
   // Check and update purged_index_
   if (!CheckBinlogFiles()) {
     // Binlog unavailable
@@ -99,6 +126,9 @@ Status Partition::Open() {
     return Status::Corruption("Check binlog file failed!");
   }
 
+  if (read_cache_ != NULL) {
+    read_cache_->Clear();
+  }
   opened_ = true;
   return s;
 }
@@ -108,13 +138,43 @@ void Partition::Close() {
   if (!opened_) {
     return;
   }
+  WaitDbUnref();
   delete db_;
   delete logger_;
+  if (read_cache_ != NULL) {
+    read_cache_->Clear();
+  }
   opened_ = false;
 }
 
+// Required: hold read lock of state_rw_, and partition is opened
+void Partition::RefDb() {
+  slash::MutexLock l(&db_ref_mutex_);
+  db_refs_++;
+}
+
+void Partition::UnrefDb() {
+  slash::MutexLock l(&db_ref_mutex_);
+  if (--db_refs_ == 0) {
+    db_ref_cond_.SignalAll();
+  }
+}
+
+// Ask the users of db_ to give up, and wait for them
+// Required: hold write lock of state_rw_
+void Partition::WaitDbUnref() {
+  db_closing_ = true;
+  slash::MutexLock l(&db_ref_mutex_);
+  while (db_refs_ > 0) {
+    db_ref_cond_.Wait();
+  }
+  db_closing_ = false;
+}
+
 Partition::~Partition() {
   Close();
+  delete repl_history_;
+  delete read_cache_;
   pthread_rwlock_destroy(&purged_index_rw_);
   pthread_rwlock_destroy(&suspend_rw_);
   pthread_rwlock_destroy(&state_rw_);
@@ -133,6 +193,8 @@ void Partition::SetWaitDBSync() {
   slash::RWLock l(&state_rw_, true);
   assert(ReplState::kShouldConnect == repl_state_);
   repl_state_ = ReplState::kWaitDBSync;
+  // Offset after db sync comes from master directly, forget the old terms
+  repl_history_->Reset(std::vector<ReplTerm>());
 }
 
 void Partition::WaitDBSyncDone() {
@@ -168,7 +230,11 @@ bool Partition::ChangeDb(const std::string& new_path) {
   tmp_path += "_bak";
   slash::DeleteDirIfExist(tmp_path);
   DLOG(INFO) << "Prepare change db from: " << tmp_path;
+  WaitDbUnref();
   delete db_;
+  if (read_cache_ != NULL) {
+    read_cache_->Clear();
+  }
   if (0 != slash::RenameFile(data_path_.c_str(), tmp_path)) {
     LOG(WARNING) << "Failed to rename db path when change db, error: " << strerror(errno);
     return false;
@@ -201,20 +267,41 @@ bool Partition::InitBgsaveEnv() {
   char s_time[32];
   int len = strftime(s_time, sizeof(s_time), "%Y%m%d%H%M%S", localtime(&bgsave_info_.start_time));
   bgsave_info_.s_start_time.assign(s_time, len);
-  bgsave_info_.path = bgsave_path_;
-  if (!slash::DeleteDirIfExist(bgsave_info_.path)) {
-    LOG(WARNING) << "Remove exist bgsave dir failed, Partition:" << partition_id_;
-    return false;
+  slash::CreatePath(bgsave_path_, 0755); // create parent directory
+
+  // Remove old snapshots no dbsync is using, including the failed ones
+  std::set<std::string> in_use;
+  auto it = bgsave_snapshots_.begin();
+  while (it != bgsave_snapshots_.end()) {
+    BgsaveSnapshotRef ref = it->lock();
+    if (ref) {
+      in_use.insert(*ref);
+      ++it;
+    } else {
+      it = bgsave_snapshots_.erase(it);
+    }
   }
-  slash::CreatePath(bgsave_info_.path, 0755); // create parent directory
-  bgsave_info_.path += std::string(s_time, 8);
-
-  // Prepare for failed dir
-  if (!slash::DeleteDirIfExist(bgsave_info_.path + "_FAILED")) {
-    LOG(WARNING) << "remove exist fail bgsave dir failed, Partition:" << partition_id_;
-    return false;
+  std::vector<std::string> children;
+  slash::GetChildren(bgsave_path_, children);
+  for (auto& child : children) {
+    if (in_use.find(bgsave_path_ + child) == in_use.end()
+        && !slash::DeleteDirIfExist(bgsave_path_ + child)) {
+      LOG(WARNING) << "Remove exist bgsave dir failed, Partition:" << partition_id_;
+      return false;
+    }
   }
 
+  // New snapshot dir never collide with the ones in use
+  bgsave_info_.path = bgsave_path_ + bgsave_info_.s_start_time;
+  while (in_use.find(bgsave_info_.path) != in_use.end()) {
+    bgsave_info_.path += "_";
+  }
+  bgsave_info_.snapshot.reset(new std::string(bgsave_info_.path),
+      [](std::string* path) {
+        slash::DeleteDirIfExist(*path);
+        delete path;
+      });
+  bgsave_snapshots_.push_back(bgsave_info_.snapshot);
   return true;
 }
 
@@ -242,6 +329,10 @@ bool Partition::InitBgsaveContent(rocksdb::DBNemoCheckpoint* cp,
 }
 
 bool Partition::RunBgsave() {
+  if (g_zp_conf->db_sync_sst()) {
+    return RunSstExport();
+  }
+
   // Create new checkpoint
   CheckpointContent content;
   rocksdb::DBNemoCheckpoint* cp;
@@ -285,6 +376,105 @@ bool Partition::RunBgsave() {
   return true;
 }
 
+static std::string SstExportFileName(const std::string& path, int num) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%06d.sst", num);
+  return path + "/" + kSstExportPrefix + buf;
+}
+
+// Export all data as sorted sst files, built from a snapshot
+// taken at the same point with the binlog offset.
+// Slave could ingest them into an empty db directly,
+// which are much smaller than a checkpoint without the history versions
+// The scan runs without state_rw_ held, so that role changes are not
+// blocked by the throttled export, while db_ is kept by a ref
+bool Partition::RunSstExport() {
+  rocksdb::DB* base_db = NULL;
+  const rocksdb::Snapshot* snapshot = NULL;
+  {
+    slash::RWLock l(&state_rw_, false);
+    if (!opened_) {
+      LOG(WARNING) << "db already closed when try to export sst"
+        << ", Table:" << table_name_ << ", Partition:" << partition_id_;
+      return false;
+    }
+    if (!InitBgsaveEnv()) {
+      return false;
+    }
+
+    base_db = db_->GetBaseDB();
+    {
+      slash::RWLock l(&suspend_rw_, true);
+      slash::MutexLock lb(&bgsave_protector_);
+      logger_->GetProducerStatus(&bgsave_info_.filenum, &bgsave_info_.offset);
+      snapshot = base_db->GetSnapshot();
+    }
+    RefDb();
+  }
+  BGSaveInfo info = bgsave_info();
+  DLOG(INFO) << "   sst export: path=" << info.path << ",  filenum=" << info.filenum
+    << ", offset=" << info.offset;
+  slash::CreatePath(info.path);
+
+  // Raw value with the nemo meta, the same as it's stored
+  rocksdb::ReadOptions read_options;
+  read_options.snapshot = snapshot;
+  read_options.fill_cache = false;
+  rocksdb::Iterator* iter = base_db->NewIterator(read_options);
+  rocksdb::SstFileWriter* writer = NULL;
+  int file_num = 0;
+  uint64_t key_num = 0;
+  int64_t uncharged = 0;
+  rocksdb::Status s;
+  for (iter->SeekToFirst(); s.ok() && iter->Valid(); iter->Next()) {
+    if (db_closing_) {
+      s = rocksdb::Status::Aborted("db is closing");
+      break;
+    }
+    if (writer == NULL) {
+      writer = new rocksdb::SstFileWriter(rocksdb::EnvOptions(),
+          *(zp_data_server->db_options()));
+      s = writer->Open(SstExportFileName(info.path, ++file_num));
+      if (!s.ok()) {
+        break;
+      }
+    }
+    s = writer->Add(iter->key(), iter->value());
+    key_num++;
+    uncharged += iter->key().size() + iter->value().size();
+    if (uncharged >= kIOChargeBatch) {
+      zp_data_server->io_scheduler()->Request(kIOBgsave, uncharged);
+      uncharged = 0;
+    }
+    if (s.ok() && writer->FileSize() >= kSstExportFileSize) {
+      s = writer->Finish();
+      delete writer;
+      writer = NULL;
+    }
+  }
+  if (s.ok()) {
+    s = iter->status();
+  }
+  if (writer != NULL) {
+    if (s.ok()) {
+      s = writer->Finish();
+    }
+    delete writer;
+  }
+  delete iter;
+  base_db->ReleaseSnapshot(snapshot);
+  UnrefDb();
+
+  if (!s.ok()) {
+    LOG(WARNING) << "sst export failed :" << s.ToString()
+      << ", Table:" << table_name_ << ", Partition:" << partition_id_;
+    return false;
+  }
+  LOG(INFO) << "Export " << key_num << " keys into " << file_num
+    << " sst files, path is " << info.path;
+  return true;
+}
+
 void Partition::Bgsave() {
   // Only one thread can go through
   {
@@ -296,7 +486,8 @@ void Partition::Bgsave() {
     bgsave_info_.bgsaving = true;
   }
 
-  zp_data_server->BGSaveTaskSchedule(&DoBgsave, static_cast<void*>(this));
+  zp_data_server->BGSaveTaskSchedule(&DoBgsave, static_cast<void*>(this),
+      std::hash<std::string>()(table_name_) + partition_id_);
 }
 
 void Partition::DoBgsave(void* arg) {
@@ -385,9 +576,15 @@ bool Partition::TryUpdateMasterOffset() {
     return false;
   }
 
-  if (master_ip != master_node_.ip || master_port != master_node_.port) {
+  if (master_ip != upstream_node_.ip || master_port != upstream_node_.port) {
     LOG(WARNING) << "Error master ip port: " << master_ip << ":" << master_port
-      << ". current master ip port: " << master_node_.ip <<":" << master_node_.port ;
+      << ". current upstream ip port: " << upstream_node_.ip <<":" << upstream_node_.port ;
+    return false;
+  }
+
+  if (!slash::FileExists(sync_path_ + "CURRENT")
+      && !IngestSstExport(sync_path_)) {
+    // Master sent sst files export rather than a checkpoint
     return false;
   }
 
@@ -401,16 +598,54 @@ bool Partition::TryUpdateMasterOffset() {
   return true;
 }
 
+// Build a new db in path with the sst files exported by master there
+// Required: hold write mutex of status_rw_
+bool Partition::IngestSstExport(const std::string& path) {
+  std::vector<std::string> children;
+  slash::GetChildren(path, children);
+  std::vector<std::string> files;
+  for (auto& child : children) {
+    if (child.compare(0, kSstExportPrefix.size(), kSstExportPrefix) == 0) {
+      files.push_back(path + child);
+    }
+  }
+  // Exported in key order, so they never overlap
+  std::sort(files.begin(), files.end());
+
+  rocksdb::DBNemo* db = NULL;
+  rocksdb::Status s = rocksdb::DBNemo::Open(*(zp_data_server->db_options()),
+      path, &db);
+  if (s.ok() && !files.empty()) {
+    rocksdb::IngestExternalFileOptions ingest_options;
+    ingest_options.move_files = true;
+    s = db->GetBaseDB()->IngestExternalFile(files, ingest_options);
+  }
+  delete db;
+  for (auto& file : files) {
+    slash::DeleteFile(file);
+  }
+  if (!s.ok()) {
+    LOG(WARNING) << "Ingest sst files after db sync failed: " << s.ToString()
+      << ", Table:" << table_name_ << ", Partition:" << partition_id_;
+    // Wait for the master to send again
+    slash::DeleteDirIfExist(path);
+    return false;
+  }
+  LOG(INFO) << "Ingest " << files.size() << " sst files after db sync"
+    << ", Table:" << table_name_ << ", Partition:" << partition_id_;
+  return true;
+}
+
 // Try to be master of node
 // Return EndFile when the sync offset is larger than current one
 // Return InvalidArgument when the offset is invalid
 // Return Incomplete when neet sync db
 // Required: state_rw hold and partition opened
 Status Partition::SlaveAskSync(const Node &node, uint32_t filenum, uint64_t offset) {
-  // Check role
-  if (role_ != Role::kNodeMaster
-      || slave_nodes_.find(node) == slave_nodes_.end()) {
-    LOG(WARNING) << "I'm not the master for :" << node
+  // Check role, slave may feed the next one in chain
+  if (role_ == Role::kNodeSingle
+      || downstream_nodes_.find(node) == downstream_nodes_.end()) {
+    LOG(WARNING) << "I'm not the upstream for :" << node
       << ", table: " << table_name_
       << ", partition: " << partition_id_;
     return Status::Corruption("Current node is not the master");
@@ -424,12 +659,15 @@ Status Partition::SlaveAskSync(const Node &node, uint32_t filenum, uint64_t offs
     return Status::EndFile("AddBinlogSender invalid binlog offset");
   }
 
-  // Binlog already be purged
+  // Binlog already be purged, or too much to replay
   slash::RWLock lp(&purged_index_rw_, false);
+  bool need_db_sync = purged_index_ > filenum
+    || (g_zp_conf->db_sync_sst() && cur_filenum - filenum > kDBSyncMaxGap);
   LOG(INFO) << "Partition:" << table_name_ << "_" << partition_id_
-    << ", We " << (purged_index_ > filenum ? "will" : "won't")
-    << " TryDBSync, purged_index_=" << purged_index_ << ", filenum=" << filenum;
-  if (purged_index_ > filenum) {
+    << ", We " << (need_db_sync ? "will" : "won't")
+    << " TryDBSync, purged_index_=" << purged_index_ << ", filenum=" << filenum
+    << ", cur_filenum=" << cur_filenum;
+  if (need_db_sync) {
     TryDBSync(node.ip, node.port + kPortShiftRsync, cur_filenum);
     return Status::Incomplete("Bgsaving and DBSync first");
   }
@@ -455,6 +693,43 @@ Status Partition::SlaveAskSync(const Node &node, uint32_t filenum, uint64_t offs
   return s;
 }
 
+// Map the slave's sync point onto my binlog by its repl id
+// Return true if the slave has gone beyond the end of its term,
+// in which case filenum and offset is set to the exact point to fallback
+// Required: state_rw hold and partition opened
+bool Partition::MapSyncPoint(const std::string& repl_id,
+    uint32_t* filenum, uint64_t* offset) {
+  if (repl_id.empty()) {
+    return false;
+  }
+  uint32_t end_filenum = 0;
+  uint64_t end_offset = 0;
+  Status s = repl_history_->TermEnd(repl_id, &end_filenum, &end_offset);
+  if (!s.ok()) {
+    // Current term or unknown, check by offset only
+    return false;
+  }
+  if (*filenum < end_filenum
+      || (*filenum == end_filenum && *offset <= end_offset)) {
+    // Common prefix of my binlog, continue incrementally
+    return false;
+  }
+  LOG(INFO) << "Partition:" << table_name_ << "_" << partition_id_
+    << ", sync point (" << *filenum << ", " << *offset << ") of term " << repl_id
+    << " diverged, fallback to its end (" << end_filenum << ", " << end_offset << ")";
+  *filenum = end_filenum;
+  *offset = end_offset;
+  return true;
+}
+
+void Partition::AdoptReplHistory(const std::vector<ReplTerm>& terms) {
+  Status s = repl_history_->Reset(terms);
+  if (!s.ok()) {
+    LOG(WARNING) << "Adopt repl history failed: " << s.ToString()
+      << ", table: " << table_name_ << ", partition: " << partition_id_;
+  }
+}
+
 // Requeired: hold write lock of state_rw_
 void Partition::CleanSlaves(const std::set<Node> &old_slaves) {
   for (auto& old : old_slaves) {
@@ -485,16 +760,28 @@ void Partition::BecomeMaster() {
   
   // Record binlog offset when I win the master for the later slave sync
   GetBinlogOffset(&win_filenum_, &win_offset_);
+
+  // Begin a new term, so that slaves of the old master could map to it
+  if (opened_) {
+    ReplTerm term;
+    Status s = repl_history_->NewTerm(win_filenum_, win_offset_, &term);
+    LOG(INFO) << " Partition " << partition_id_ << " begin repl term "
+      << term.repl_id << " at " << win_filenum_ << ", " << win_offset_
+      << (s.ok() ? "" : ", persist failed: " + s.ToString());
+  }
 }
 
 // Requeired: hold write lock of state_rw_
 void Partition::BecomeSlave() {
   Open();
   LOG(INFO) << " Partition " << partition_id_
-    << " BecomeSlave, master is " << master_node_.ip << ":" << master_node_.port;
+    << " BecomeSlave, master is " << master_node_.ip << ":" << master_node_.port
+    << ", upstream is " << upstream_node_.ip << ":" << upstream_node_.port;
   role_ = Role::kNodeSlave;
   repl_state_ = ReplState::kShouldConnect;
   readonly_ = true;
+  ResetUpstreamHead();
+  upstream_active_us_ = slash::NowMicros();
 
   zp_data_server->AddSyncTask(table_name_, partition_id_);
 }
@@ -525,7 +812,7 @@ ZPMeta::PState Partition::UpdateState(ZPMeta::PState state) {
 }
 
 void Partition::Update(ZPMeta::PState state, const Node &master,
-    const std::set<Node> &slaves) {
+    const std::set<Node> &slaves, const std::vector<Node> &chain) {
   slash::RWLock l(&state_rw_, true);
 
   // Check Status first
@@ -537,22 +824,46 @@ void Partition::Update(ZPMeta::PState state, const Node &master,
 
   // Update master slave nodes
   bool change_master = false;
-  std::set<Node> miss_slaves;
-
   if (master_node_ != master) {
     master_node_ = master;
     change_master = true;
   }
-  if (slave_nodes_ != slaves) {
-    miss_slaves = slave_nodes_;
-    slave_nodes_.clear();
-    for (auto& slave : slaves) {
-      slave_nodes_.insert(slave);
-      // Remove those who also exist in the new slaves
-      // And what's remain in miss_slaves is those who will not be slave any more
-      miss_slaves.erase(slave);
+  slave_nodes_ = slaves;
+
+  // Determine where binlog come from and go to
+  Node upstream = master;
+  std::set<Node> downstream = slaves;
+  if (!chain.empty()) {
+    downstream.clear();
+    if (zp_data_server->IsSelf(master)) {
+      downstream.insert(chain.front());
+    }
+    for (size_t i = 0; i < chain.size(); i++) {
+      if (zp_data_server->IsSelf(chain[i])) {
+        upstream = (i == 0) ? master : chain[i - 1];
+        if (i + 1 < chain.size()) {
+          downstream.insert(chain[i + 1]);
+        }
+        break;
+      }
     }
   }
+  if (upstream == down_upstream_) {
+    // Still down as far as I know, keep syncing from master
+    upstream = master;
+  } else {
+    down_upstream_ = Node("", 0);
+  }
+  bool change_upstream = false;
+  if (upstream_node_ != upstream) {
+    upstream_node_ = upstream;
+    change_upstream = true;
+  }
+  // What's remain in miss_downstream is those who will not be fed by me any more
+  std::set<Node> miss_downstream = downstream_nodes_;
+  for (auto& node : downstream) {
+    miss_downstream.erase(node);
+  }
 
   // Determine new role
   Role new_role = Role::kNodeSingle;
@@ -566,14 +877,14 @@ void Partition::Update(ZPMeta::PState state, const Node &master,
     }
   }
 
-  // Clean Slaves
-  if (role_ == Role::kNodeMaster) {
-    CleanSlaves(miss_slaves);
-    if (new_role != Role::kNodeMaster) {
-      // Clean all others also
-      CleanSlaves(slave_nodes_);
-    }
+  // Clean binlog send tasks
+  if (role_ != new_role || change_master) {
+    // Clean all, they will trysync again
+    CleanSlaves(downstream_nodes_);
+  } else {
+    CleanSlaves(miss_downstream);
   }
+  downstream_nodes_ = downstream;
 
   // Update role
   if (role_ != new_role) {
@@ -585,8 +896,8 @@ void Partition::Update(ZPMeta::PState state, const Node &master,
     } else {
       BecomeSingle(); 
     }
-  } else if (change_master && role_ == Role::kNodeSlave) {
-    // Change master
+  } else if ((change_master || change_upstream) && role_ == Role::kNodeSlave) {
+    // Change master or the one before me in chain
     BecomeSlave();
   }
 }
@@ -595,9 +906,8 @@ void Partition::Leave() {
   slash::RWLock l(&state_rw_, true);
   slave_nodes_.erase(Node(zp_data_server->local_ip(),
         zp_data_server->local_port()));
-  if (role_ == Role::kNodeMaster) {
-    CleanSlaves(slave_nodes_);
-  }
+  CleanSlaves(downstream_nodes_);
+  downstream_nodes_.clear();
   BecomeSingle();
 }
 
@@ -653,6 +963,135 @@ std::string Partition::GetBinlogFilename() {
   return logger_->filename();
 }
 
+// Read the SET and DEL records whose key has the prefix for subscriber,
+// from filenum and offset, till the binlog end, max_records found,
+// or kSubscribeMaxBytes read. A batch is never split, so it may find
+// a few more. filenum and offset are moved to where the next record begin
+Status Partition::ReadBinlogRecords(const std::string& key_prefix,
+    int max_records, uint64_t* max_bytes, uint32_t* filenum, uint64_t* offset,
+    client::CmdResponse_Subscribe* res) {
+  // Only the binlog end and name are taken under the lock, files are read
+  // without it, those purged meanwhile are still readable once opened
+  uint32_t end_filenum = 0;
+  uint64_t end_offset = 0;
+  std::string binlog_name;
+  {
+    slash::RWLock l(&state_rw_, false);
+    if (!opened_) {
+      return Status::Incomplete("partition not opened");
+    }
+    logger_->GetProducerStatus(&end_filenum, &end_offset);
+    binlog_name = logger_->filename();
+  }
+  if (BinlogDistance(*filenum, *offset, end_filenum, end_offset) < 0) {
+    return Status::InvalidArgument("cursor beyond binlog end");
+  }
+  if ((*filenum == end_filenum && *offset == end_offset)
+      || *max_bytes == 0) {
+    return Status::OK();
+  }
+
+  slash::SequentialFile* queue = NULL;
+  Status s = slash::NewSequentialFile(
+      NewFileName(binlog_name, *filenum), &queue);
+  if (!s.ok()) {
+    return Status::NotFound("cursor purged");
+  }
+  BinlogReader* reader = new BinlogReader(queue);
+  s = reader->Seek(*offset);
+  if (!s.ok()) {
+    delete reader;
+    delete queue;
+    return Status::InvalidArgument("cursor not at a record begin");
+  }
+
+  int found = 0;
+  std::string item;
+  client::CmdRequest req;
+  while (found < max_records && *max_bytes > 0
+      && (*filenum != end_filenum || *offset != end_offset)) {
+    uint64_t consume_len = 0;
+    s = reader->Consume(&consume_len, &item);
+    if (s.IsEndFile()) {
+      // Roll to next file
+      delete reader;
+      reader = NULL;
+      delete queue;
+      queue = NULL;
+      if (!slash::NewSequentialFile(
+            NewFileName(binlog_name, *filenum + 1), &queue).ok()) {
+        LOG(WARNING) << "Subscribe read end of binlog " << *filenum
+          << ", but no next binlog exist, table: " << table_name_
+          << ", partition: " << partition_id_;
+        break;
+      }
+      reader = new BinlogReader(queue);
+      (*filenum)++;
+      *offset = 0;
+      continue;
+    } else if (!s.ok() && !s.IsIncomplete()) {
+      reader->SkipNextBlock(&consume_len);
+    }
+    *offset += consume_len;
+    *max_bytes -= std::min(*max_bytes, consume_len);
+    if (!s.ok() || !req.ParseFromString(item)) {
+      continue;
+    }
+
+    // Batch records are expanded to the SET or DEL of every key,
+    // all with the cursor after the batch
+    std::vector<std::pair<const std::string*, const std::string*>> changes;
+    client::Type type = client::Type::SET;
+    std::string delta;
+    if (req.type() == client::Type::INCRBY
+        || req.type() == client::Type::DECRBY) {
+      type = req.type();
+      delta = std::to_string(req.incrby().by());
+      changes.push_back(std::make_pair(&req.incrby().key(), &delta));
+    } else if (req.type() == client::Type::APPEND) {
+      type = client::Type::APPEND;
+      changes.push_back(std::make_pair(&req.append().key(),
+            &req.append().value()));
+    } else if (req.type() == client::Type::SET) {
+      changes.push_back(std::make_pair(&req.set().key(), &req.set().value()));
+    } else if (req.type() == client::Type::DEL) {
+      type = client::Type::DEL;
+      changes.push_back(std::make_pair(&req.del().key(),
+            static_cast<const std::string*>(NULL)));
+    } else if (req.type() == client::Type::MSET) {
+      for (auto& kv : req.mset().kvs()) {
+        changes.push_back(std::make_pair(&kv.key(), &kv.value()));
+      }
+    } else if (req.type() == client::Type::MDEL) {
+      type = client::Type::DEL;
+      for (auto& k : req.mdel().keys()) {
+        changes.push_back(std::make_pair(&k,
+              static_cast<const std::string*>(NULL)));
+      }
+    }
+    for (auto& change : changes) {
+      if (change.first->compare(0, key_prefix.size(), key_prefix) != 0) {
+        continue;
+      }
+      client::CmdResponse_Subscribe_Record* record = res->add_records();
+      record->set_partition(partition_id_);
+      record->set_type(type);
+      record->set_key(*change.first);
+      if (change.second != NULL) {
+        record->set_value(*change.second);
+      }
+      client::SyncOffset* cursor = record->mutable_cursor();
+      cursor->set_filenum(*filenum);
+      cursor->set_offset(*offset);
+      cursor->set_partition(partition_id_);
+      found++;
+    }
+  }
+  delete reader;
+  delete queue;
+  return Status::OK();
+}
+
 // Required: hold read mutex of status_rw_
 bool Partition::CheckSyncOption(const PartitionSyncOption& option) {
   // Check current status
@@ -668,10 +1107,10 @@ bool Partition::CheckSyncOption(const PartitionSyncOption& option) {
   }
 
   // Check from node
-  if (option.from_node != slash::IpPortString(master_node_.ip, master_node_.port)) {
+  if (option.from_node != slash::IpPortString(upstream_node_.ip, upstream_node_.port)) {
     LOG(WARNING) << "Discard binlog item from " << option.from_node
       << ", partition:" << partition_id_
-      << ", current my master is " << master_node_;
+      << ", current my upstream is " << upstream_node_;
     return false;
   }
 
@@ -687,7 +1126,9 @@ bool Partition::CheckSyncOption(const PartitionSyncOption& option) {
     if (option.filenum > cur_filenum ||
         (option.filenum == cur_filenum && option.offset > cur_offset)) {
       // Under this circumstance, slave has no chance to recovery itself
-      // So Try to schedule a new trysync bg job
+      // Ask master to seek back to my offset at once,
+      // and schedule a new trysync bg job in case it doesn't work
+      RequestResync();
       TryRecoverSync();
     }
     return false;
@@ -719,6 +1160,13 @@ void Partition::DoBinlogCommand(const PartitionSyncOption& option,
 
   std::string raw;
   req.SerializeToString(&raw);
+  if (option.item_len > 0 && raw.size() != option.item_len) {
+    // Offsets after it no longer match upstream's
+    LOG(ERROR) << "Binlog item of " << cmd->name() << " is " << raw.size()
+      << " bytes, but " << option.item_len << " bytes at upstream " << option.from_node
+      << ", filenum: " << option.filenum << ", offset: " << option.offset
+      << ", table: " << table_name_ << ", partition: " << partition_id_;
+  }
   Status s = logger_->Put(raw);
   if (!s.ok()) {
     LOG(WARNING) << "Binlog Put failed : " << s.ToString()
@@ -738,6 +1186,16 @@ void Partition::DoBinlogCommand(const PartitionSyncOption& option,
         << ", duration(us): " << duration;
     }
   }
+
+  if (req.has_write_us()) {
+    slash::MutexLock l(&lag_mutex_);
+    applied_write_us_ = req.write_us();
+  }
+  if (option.has_head) {
+    RecordUpstreamHead(option.head_filenum, option.head_offset);
+  }
+  upstream_active_us_ = slash::NowMicros();
+  GrantSyncCredit();
 }
 
 // Keep binlog order outside
@@ -755,11 +1213,168 @@ void Partition::DoBinlogSkip(const PartitionSyncOption& option,
       << ", partition: " << partition_id_
       << ", gap: " << gap;
   }
+
+  if (option.has_head) {
+    RecordUpstreamHead(option.head_filenum, option.head_offset);
+  }
+  upstream_active_us_ = slash::NowMicros();
+  GrantSyncCredit();
+}
+
+// Upstream has sent all it has till filenum and offset
+void Partition::ReceiveHeartbeat(const std::string& from,
+    uint32_t filenum, uint64_t offset) {
+  slash::RWLock l(&state_rw_, false);
+  if (!opened_
+      || role_ != Role::kNodeSlave
+      || from != slash::IpPortString(upstream_node_.ip, upstream_node_.port)) {
+    return;
+  }
+  upstream_active_us_ = slash::NowMicros();
+  RecordUpstreamHead(filenum, offset);
+}
+
+// Grant credits back to master every kBinlogCreditBatch items consumed
+// Required: hold read mutex of state_rw_
+void Partition::GrantSyncCredit() {
+  int pending = ++sync_credit_pending_;
+  if (pending < kBinlogCreditBatch) {
+    return;
+  }
+  sync_credit_pending_ -= pending;
+  // Master will restore the window after kBinlogCreditTimeout if failed
+  SendSyncToMaster(client::SyncType::ACK, pending);
+}
+
+// Binlog end of master as far as I know, mine if I'm not a slave,
+// so that the nodes after me in chain measure their lag against master
+bool Partition::GetMasterHead(uint32_t* filenum, uint64_t* offset) {
+  slash::RWLock l(&state_rw_, false);
+  if (!GetBinlogOffset(filenum, offset)) {
+    return false;
+  }
+  if (role_ != Role::kNodeSlave) {
+    return true;
+  }
+  slash::MutexLock lm(&lag_mutex_);
+  if (BinlogDistance(*filenum, *offset,
+        upstream_head_filenum_, upstream_head_offset_) > 0) {
+    *filenum = upstream_head_filenum_;
+    *offset = upstream_head_offset_;
+  }
+  return true;
+}
+
+// Remember where master's binlog end, and when I catch up with it
+// Required: hold read mutex of state_rw_, and partition is opened
+void Partition::RecordUpstreamHead(uint32_t filenum, uint64_t offset) {
+  uint32_t cur_filenum = 0;
+  uint64_t cur_offset = 0;
+  logger_->GetProducerStatus(&cur_filenum, &cur_offset);
+  slash::MutexLock l(&lag_mutex_);
+  upstream_head_filenum_ = filenum;
+  upstream_head_offset_ = offset;
+  if (cur_filenum > filenum
+      || (cur_filenum == filenum && cur_offset >= offset)) {
+    caught_up_us_ = slash::NowMicros();
+  }
+}
+
+void Partition::ResetUpstreamHead() {
+  slash::MutexLock l(&lag_mutex_);
+  upstream_head_filenum_ = 0;
+  upstream_head_offset_ = 0;
+  caught_up_us_ = 0;
+  applied_write_us_ = 0;
+}
+
+// How far I'm behind master's binlog end in bytes, and in time,
+// which is since the later of when the last applied item was written
+// on master and when I last caught up, so I have all writes before it.
+// Clocks of master and me are assumed to be close
+// Return false if neither is known since become slave
+// Required: hold read mutex of state_rw_, and partition is opened
+bool Partition::GetApplyLag(int64_t* bytes, uint64_t* ms) {
+  uint32_t cur_filenum = 0;
+  uint64_t cur_offset = 0;
+  logger_->GetProducerStatus(&cur_filenum, &cur_offset);
+  slash::MutexLock l(&lag_mutex_);
+  uint64_t fresh_us = std::max(caught_up_us_, applied_write_us_);
+  if (fresh_us == 0) {
+    return false;
+  }
+  *bytes = std::max(BinlogDistance(cur_filenum, cur_offset,
+        upstream_head_filenum_, upstream_head_offset_), static_cast<int64_t>(0));
+  uint64_t now = slash::NowMicros();
+  *ms = now > fresh_us ? (now - fresh_us) / 1000 : 0;
+  return true;
+}
+
+// Whether my data is fresh enough for a read with this bound
+// Required: hold read mutex of state_rw_, and partition is opened
+bool Partition::WithinStaleness(const client::ReadStaleness& bound) {
+  int64_t lag_bytes = 0;
+  uint64_t lag_ms = 0;
+  if (!GetApplyLag(&lag_bytes, &lag_ms)) {
+    return false;
+  }
+  if (bound.has_max_ms()
+      && lag_ms > static_cast<uint64_t>(bound.max_ms())) {
+    return false;
+  }
+  if (bound.has_max_bytes() && lag_bytes > bound.max_bytes()) {
+    return false;
+  }
+  return true;
+}
+
+// Ask master to continue from my current offset, at most once per
+// kResyncRequestInterval, since the items in flight will all be discarded
+// Required: hold read mutex of state_rw_
+void Partition::RequestResync() {
+  uint64_t now = slash::NowMicros();
+  if (now - last_resync_us_ < kResyncRequestInterval * 1000) {
+    return;
+  }
+  last_resync_us_ = now;
+  SendSyncToMaster(client::SyncType::RESYNC, 0);
+}
+
+// Send ack or resync request back to master with my current offset
+// Required: hold read mutex of state_rw_
+void Partition::SendSyncToMaster(client::SyncType type, int32_t credits) {
+  client::SyncRequest msg;
+  msg.set_epoch(zp_data_server->meta_epoch());
+  client::Node *node = msg.mutable_from();
+  node->set_ip(zp_data_server->local_ip());
+  node->set_port(zp_data_server->local_port());
+  uint32_t cur_filenum = 0;
+  uint64_t cur_offset = 0;
+  logger_->GetProducerStatus(&cur_filenum, &cur_offset);
+  client::SyncOffset *sync_offset = msg.mutable_sync_offset();
+  sync_offset->set_filenum(cur_filenum);
+  sync_offset->set_offset(cur_offset);
+  msg.set_sync_type(type);
+  if (type == client::SyncType::RESYNC) {
+    client::BinlogResync *resync = msg.mutable_binlog_resync();
+    resync->set_table_name(table_name_);
+    resync->set_partition_id(partition_id_);
+  } else {
+    client::BinlogAck *back = msg.mutable_binlog_ack();
+    back->set_table_name(table_name_);
+    back->set_partition_id(partition_id_);
+    back->set_credits(credits);
+  }
+
+  // Off the binlog apply thread, a slow upstream should not stall
+  // the apply of other partitions
+  zp_data_server->AsyncSendToPeer(
+      Node(upstream_node_.ip, upstream_node_.port + kPortShiftSync), msg);
 }
 
 void Partition::DoCommand(const Cmd* cmd, const client::CmdRequest &req,
-    client::CmdResponse &res) {
-  std::string key = cmd->ExtractKey(&req);
+    client::CmdResponse &res, const RequestContext* context) {
+  const std::string& key = context ? *context->key : cmd->ExtractKey(&req);
 
   slash::RWLock l(&state_rw_, false);
   if (!opened_) {
@@ -790,17 +1405,40 @@ void Partition::DoCommand(const Cmd* cmd, const client::CmdRequest &req,
     return;
   }
 
-  uint64_t start_us = 0;
-  if (g_zp_conf->slowlog_slower_than() >= 0) {
-    start_us = slash::NowMicros();
+  // Slave serve kv read only when it's fresh enough for the client
+  if (!cmd->is_write() && cmd->flag_type() == kCmdFlagsKv
+      && role_ == Role::kNodeSlave) {
+    const client::ReadStaleness* bound = cmd->ExtractStaleness(&req);
+    if (bound == NULL || !WithinStaleness(*bound)) {
+      res.set_type(req.type());
+      res.set_code(client::StatusCode::kError);
+      res.set_msg("stale read on slave");
+
+      client::Node* node = res.mutable_redirect();
+      node->set_ip(master_node_.ip);
+      node->set_port(master_node_.port);
+      return;
+    }
   }
 
+  // Always timed, background io adapt to the foreground latency
+  uint64_t start_us = slash::NowMicros();
+
   // Add read lock for no suspend command
   if (!cmd->is_suspend()) {
     pthread_rwlock_rdlock(&suspend_rw_);
   }
 
-  if (cmd->is_write()) {
+  std::vector<std::string> keys;
+  bool many_keys = cmd->is_write() && cmd->ExtractKeys(&req, &keys);
+  if (many_keys) {
+    // Lock in order, so that batches never wait for each other in circle
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    for (auto& k : keys) {
+      mutex_record_.Lock(k);
+    }
+  } else if (cmd->is_write()) {
     mutex_record_.Lock(key);
   }
   
@@ -808,25 +1446,46 @@ void Partition::DoCommand(const Cmd* cmd, const client::CmdRequest &req,
 
   if (cmd->is_write()) {
     if (res.code() == client::StatusCode::kOk) {
-      // Restore Message
+      // Restore Message, write_us from client is dropped,
+      // or it would be logged twice with the patch below
+      const client::CmdRequest* log_req = &req;
+      client::CmdRequest clean_req;
+      if (req.has_write_us()) {
+        clean_req.CopyFrom(req);
+        clean_req.clear_write_us();
+        log_req = &clean_req;
+      }
       std::string raw;
-      if(cmd->GenerateLog(&req, &raw)) {
+      if(cmd->GenerateLog(log_req, &raw)) {
+        // Merged into the request when parsed, slaves measure
+        // their lag in time by it
+        client::CmdRequest patch;
+        patch.set_write_us(slash::NowMicros());
+        patch.AppendPartialToString(&raw);
         logger_->Put(raw);
       }
     }
-    mutex_record_.Unlock(key);
+    if (many_keys) {
+      for (auto& k : keys) {
+        mutex_record_.Unlock(k);
+      }
+    } else {
+      mutex_record_.Unlock(key);
+    }
   }
 
   if (!cmd->is_suspend()) {
     pthread_rwlock_unlock(&suspend_rw_);
   }
 
-  if (g_zp_conf->slowlog_slower_than() >= 0) {
-    int64_t duration = slash::NowMicros() - start_us;
-    if (duration > g_zp_conf->slowlog_slower_than()) {
-      LOG(WARNING) << "slow client command:" << cmd->name()
-        << ", duration(us): " << duration;
-    }
+  int64_t duration = slash::NowMicros() - start_us;
+  if (cmd->flag_type() == kCmdFlagsKv) {
+    zp_data_server->io_scheduler()->RecordForeground(duration);
+  }
+  if (g_zp_conf->slowlog_slower_than() >= 0
+      && duration > g_zp_conf->slowlog_slower_than()) {
+    LOG(WARNING) << "slow client command:" << cmd->name()
+      << ", duration(us): " << duration;
   }
 }
 
@@ -839,6 +1498,7 @@ inline void Partition::CancelRecoverSync() {
   // since we can tolerant the inconsistence
   do_recovery_sync_ = false;
   recover_sync_flag_ = 0;
+  last_resync_us_ = 0;
 }
 
 void Partition::MaybeRecoverSync() {
@@ -855,9 +1515,36 @@ void Partition::MaybeRecoverSync() {
   }
 }
 
+// The one before me in chain may be down while meta has not reordered
+// the chain yet, or never will for a learner, sync from master instead
+void Partition::MaybeSkipDownUpstream() {
+  {
+    slash::RWLock l(&state_rw_, false);
+    if (role_ != Role::kNodeSlave
+        || upstream_node_ == master_node_
+        || repl_state_ == ReplState::kWaitDBSync
+        || slash::NowMicros() - upstream_active_us_
+          < kChainUpstreamTimeout * 1000ULL) {
+      return;
+    }
+  }
+  slash::RWLock l(&state_rw_, true);
+  if (role_ != Role::kNodeSlave || upstream_node_ == master_node_) {
+    return;
+  }
+  LOG(WARNING) << "Heard nothing from upstream " << upstream_node_
+    << " for " << kChainUpstreamTimeout << "ms, sync from master "
+    << master_node_ << " instead, table: " << table_name_
+    << ", partition: " << partition_id_;
+  down_upstream_ = upstream_node_;
+  upstream_node_ = master_node_;
+  BecomeSlave();
+}
+
 void Partition::DoTimingTask() {
   // Maybe trysync
   MaybeRecoverSync();
+  MaybeSkipDownUpstream();
 
   // Purge log
   if (!PurgeLogs(0, false)) {
@@ -902,16 +1589,21 @@ void Partition::DBSync(const std::string& ip, int port) {
   }
 
   DLOG(INFO) << " DBSync add new SyncTask for (" << ip_port << ")";
-  // Reuse the bg_thread for Bgsave
-  // Since we expect Bgsave and DBSync execute serially
   DBSyncArg *arg = new DBSyncArg(this, ip, port);
-  zp_data_server->BGSaveTaskSchedule(&DoDBSync, static_cast<void*>(arg));
+  zp_data_server->DBSyncTaskSchedule(&DoDBSync, static_cast<void*>(arg));
 }
 
 void Partition::DoDBSync(void* arg) {
   DBSyncArg *psync = static_cast<DBSyncArg*>(arg);
   Partition* partition = psync->p;
 
+  if (partition->bgsaving()) {
+    // Wait for the checkpoint, without occupying the worker
+    zp_data_server->DBSyncTaskSchedule(&DoDBSync, arg,
+        kDBSyncWaitBgsaveInterval);
+    return;
+  }
+
   //sleep(3);
   DLOG(INFO) << "DBSync begin sendfile " << psync->ip << ":" << psync->port;
   partition->DBSyncSendFile(psync->ip, psync->port);
@@ -920,74 +1612,47 @@ void Partition::DoDBSync(void* arg) {
 }
 
 void Partition::DBSyncSendFile(const std::string& ip, int port) {
-  slash::RWLock l(&state_rw_, false);
-  if (!opened_) {
-    LOG(WARNING) << "Partition has been closed when try to dbsync"
-      << ", Table:" << table_name_ << ", Partition: "<< partition_id_;
-    return;
-  }
-  std::string bg_path;
+  std::string ip_port = slash::IpPortString(ip, port);
+  // Hold the snapshot, so that it will not be removed by a new bgsave
+  BgsaveSnapshotRef snapshot;
   {
-    slash::MutexLock l(&bgsave_protector_);
-    bg_path = bgsave_info_.path;
-  }
-  // Get all files need to send
-  std::vector<std::string> descendant;
-  if (!slash::GetDescendant(bg_path, descendant)) {
-    LOG(WARNING) << "Get Descendant when try to do db sync failed";
-    return;
-  }
-
-  DLOG(INFO) << "DBSyncSendFile descendant size= " << descendant.size() << " bg_path=" << bg_path;
-
-  // Iterate to send files
-  int ret = 0;
-  std::string target_path;
-  std::string target_dir = NewPartitionPath(table_name_ + "/.", partition_id_);
-  std::string module = kDBSyncModule;
-  std::vector<std::string>::iterator it = descendant.begin();
-  slash::RsyncRemote remote(ip, port, module, kDBSyncSpeedLimit * 1024);
-  for (; it != descendant.end(); ++it) {
-    target_path = (*it).substr(bg_path.size() + 1);
-    DLOG(INFO) << "--- descendant: " << target_path;
-    if (target_path == kBgsaveInfoFile) {
-      continue;
-    }
-    // We need specify the speed limit for every single file
-    ret = slash::RsyncSendFile(*it, target_dir + "/" + target_path, remote);
-    if (0 != ret) {
-      LOG(WARNING) << "rsync send file failed! From: " << *it
-        << ", To: " << target_path
-        << ", At: " << ip << ":" << port
-        << ", Error: " << ret;
-      break;
-    }
+    slash::RWLock l(&state_rw_, false);
     if (!opened_) {
-      LOG(WARNING) << "Partition has been closed when try to send dbsync"
+      LOG(WARNING) << "Partition has been closed when try to dbsync"
         << ", Table:" << table_name_ << ", Partition: "<< partition_id_;
-      return; // Terminate as soon as possible
+      slash::MutexLock lp(&db_sync_protector_);
+      db_sync_slaves_.erase(ip_port);
+      return;
     }
+    {
+      slash::MutexLock lb(&bgsave_protector_);
+      snapshot = bgsave_info_.snapshot;
+    }
+    // Close and ChangeDb wait for us, and ask us to give up by db_closing_
+    RefDb();
   }
- 
-  // Clear target path
-  slash::RsyncSendClearTarget(bg_path, target_dir, remote);
+  std::string bg_path = snapshot ? *snapshot : std::string();
 
-  // Send info file at last
-  if (0 == ret) {
-    if (0 != (ret = slash::RsyncSendFile(bg_path + "/" + kBgsaveInfoFile,
-            target_dir + "/" + kBgsaveInfoFile, remote))) {
-      LOG(WARNING) << "send info file failed";
-    }
+  // Send all files with the info file at last, without state_rw_ held
+  ZPDBSyncSender sender(ip, port, g_zp_conf->db_sync_parallel(),
+      zp_data_server->io_scheduler());
+  Status s = sender.SendDir(bg_path, NewPartitionPath(table_name_, partition_id_),
+      kBgsaveInfoFile, [this]() { return db_closing_.load(); });
+  UnrefDb();
+  if (!s.ok()) {
+    LOG(WARNING) << "DBSync send files failed! From: " << bg_path
+      << ", At: " << ip << ":" << port
+      << ", Table:" << table_name_ << ", Partition: "<< partition_id_
+      << ", Error: " << s.ToString();
   }
 
   // remove slave
-  std::string ip_port = slash::IpPortString(ip, port);
   {
     slash::MutexLock l(&db_sync_protector_);
     db_sync_slaves_.erase(ip_port);
   }
-  if (0 == ret) {
-    LOG(INFO) << "rsync send files success";
+  if (s.ok()) {
+    LOG(INFO) << "DBSync send files success";
   }
 }
 
@@ -1016,13 +1681,22 @@ void Partition::DoPurgeLogs(void* arg) {
   PurgeArg *ppurge = static_cast<PurgeArg*>(arg);
   Partition* ps = ppurge->p;
 
-  ps->PurgeFiles(ppurge->to, ppurge->manual);
+  std::map<uint32_t, std::string> files;
+  ps->PickPurgeFiles(ppurge->to, ppurge->manual, &files);
+  // Charge before deletion with the lock released, an unlink cost
+  // little io whatever the file size.
+  // The picked ones are marked purged already, no slave could use them
+  zp_data_server->io_scheduler()->Request(kIOPurge,
+      files.size() * kIOPurgeUnlinkCost);
+  ps->DeletePurgeFiles(files);
 
   ps->purging_ = false;
   delete (PurgeArg*)arg;
 }
 
-bool Partition::PurgeFiles(uint32_t to, bool manual)
+// Pick the binlog files to purge
+bool Partition::PickPurgeFiles(uint32_t to, bool manual,
+    std::map<uint32_t, std::string>* files)
 {
   slash::RWLock l(&state_rw_, false);
   if (!opened_) {
@@ -1040,7 +1714,6 @@ bool Partition::PurgeFiles(uint32_t to, bool manual)
     return true;
   }
 
-  int delete_num = 0;
   struct stat file_stat;
   int remain_expire_num = binlogs.size() - kBinlogRemainMaxCount;
   std::map<uint32_t, std::string>::iterator it;
@@ -1057,25 +1730,37 @@ bool Partition::PurgeFiles(uint32_t to, bool manual)
         return false;
       }
 
-      // Do delete
-      slash::Status s = slash::DeleteFile(log_path_ + "/" + it->second);
-      if (s.ok()) {
-        ++delete_num;
-        --remain_expire_num;
-      } else {
-        LOG(WARNING) << "Purge log file : " << (it->second) <<  " failed! error:" << s.ToString();
-      }
+      files->insert(*it);
+      --remain_expire_num;
     } else {
       // Break when face the first one not satisfied
       // Since the binlogs is order by the file index
       break;
     }
   }
+
+  return true;
+}
+
+void Partition::DeletePurgeFiles(const std::map<uint32_t, std::string>& files) {
+  slash::RWLock l(&state_rw_, false);
+  if (!opened_ || files.empty()) {
+    return;
+  }
+
+  int delete_num = 0;
+  std::map<uint32_t, std::string>::const_iterator it;
+  for (it = files.begin(); it != files.end(); ++it) {
+    slash::Status s = slash::DeleteFile(log_path_ + "/" + it->second);
+    if (s.ok()) {
+      ++delete_num;
+    } else {
+      LOG(WARNING) << "Purge log file : " << (it->second) <<  " failed! error:" << s.ToString();
+    }
+  }
   if (delete_num) {
     LOG(INFO) << "Success purge "<< delete_num << " for " << table_name_ << "_" << partition_id_;
   }
-
-  return true;
 }
 
 // Required hold read lock of state_rw_ and  partition opened
@@ -1153,7 +1838,7 @@ bool Partition::CouldPurge(uint32_t index) {
 
   std::set<Node>::iterator it;
   slash::RWLock lp(&purged_index_rw_, true);
-  for (it = slave_nodes_.begin(); it != slave_nodes_.end(); ++it) {
+  for (it = downstream_nodes_.begin(); it != downstream_nodes_.end(); ++it) {
     int32_t filenum = zp_data_server->GetBinlogSendFilenum(table_name_,
         partition_id_, Node((*it).ip, (*it).port + kPortShiftSync));
     //LOG(WARNING) << "slave node : " << Node((*it).ip, (*it).port + kPortShiftSync)
@@ -1190,6 +1875,12 @@ void Partition::Dump() {
   for (auto& slave : slave_nodes_) {
     LOG(INFO) << "     -* slave  " <<  slave;
   }
+  if (upstream_node_ != master_node_) {
+    LOG(INFO) << "     -*Upstream node " << upstream_node_;
+  }
+  for (auto& downstream : downstream_nodes_) {
+    LOG(INFO) << "     -* downstream  " <<  downstream;
+  }
 }
 
 void Partition::GetState(client::PartitionState* state) {
@@ -1210,5 +1901,36 @@ void Partition::GetState(client::PartitionState* state) {
   GetBinlogOffset(&filenum, &offset);
   sync_offset->set_filenum(filenum);
   sync_offset->set_offset(offset);
+
+  uint64_t now = slash::NowMicros();
+  for (auto& d : downstream_nodes_) {
+    ZPBinlogSendStats stats;
+    Status s = zp_data_server->GetBinlogSendStats(table_name_, partition_id_,
+        Node(d.ip, d.port + kPortShiftSync), &stats);
+    if (!s.ok()) {
+      // Not in sync yet
+      continue;
+    }
+    client::PartitionState_SlaveLag* lag = state->add_slave_lags();
+    lag->mutable_node()->set_ip(d.ip);
+    lag->mutable_node()->set_port(d.port);
+    lag->set_lag_bytes(std::max(BinlogDistance(stats.sent_filenum,
+            stats.sent_offset, filenum, offset), static_cast<int64_t>(0)));
+    lag->set_unacked_records(stats.unacked);
+    lag->set_send_bytes_per_sec(stats.send_rate);
+    lag->set_since_last_send_ms(stats.last_send_us == 0
+        ? -1 : (now - stats.last_send_us) / 1000);
+  }
+
+  if (opened_ && role_ == Role::kNodeSlave) {
+    int64_t lag_bytes = 0;
+    uint64_t lag_ms = 0;
+    if (GetApplyLag(&lag_bytes, &lag_ms)) {
+      state->set_apply_lag_bytes(lag_bytes);
+      state->set_apply_lag_ms(lag_ms);
+    } else {
+      state->set_apply_lag_ms(-1);
+    }
+  }
 }
 
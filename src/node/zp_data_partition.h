@@ -15,6 +15,8 @@
 #include "include/zp_binlog.h"
 #include "include/zp_meta_utils.h"
 #include "include/zp_command.h"
+#include "src/node/zp_repl_history.h"
+#include "src/node/zp_read_cache.h"
 
 
 class Partition;
@@ -55,6 +57,12 @@ struct PartitionSyncOption {
   std::string from_node;
   uint32_t filenum;
   uint64_t offset;
+  // Binlog end of upstream when sent, unknown if has_head is false
+  bool has_head;
+  uint32_t head_filenum;
+  uint64_t head_offset;
+  // Bytes of the CMD item in upstream's binlog, 0 if unknown
+  uint32_t item_len;
   PartitionSyncOption(
       client::SyncType t,
       std::string table,
@@ -67,7 +75,16 @@ struct PartitionSyncOption {
     partition_id(id),
     from_node(from),
     filenum(arg_filenum),
-    offset(arg_offset) {}
+    offset(arg_offset),
+    has_head(false),
+    head_filenum(0),
+    head_offset(0),
+    item_len(0) {}
+  void SetHead(uint32_t arg_filenum, uint64_t arg_offset) {
+    has_head = true;
+    head_filenum = arg_filenum;
+    head_offset = arg_offset;
+  }
 };
 
 struct CheckpointContent {
@@ -80,6 +97,9 @@ struct CheckpointContent {
     sequence_number(0) {}
 };
 
+// Checkpoint dir, removed when the last one refer to it release
+typedef std::shared_ptr<std::string> BgsaveSnapshotRef;
+
 struct BGSaveInfo {
   bool bgsaving;
   time_t start_time;
@@ -87,12 +107,14 @@ struct BGSaveInfo {
   std::string path;
   uint32_t filenum;
   uint64_t offset;
+  BgsaveSnapshotRef snapshot;
   BGSaveInfo() : bgsaving(false), filenum(0), offset(0){}
   void Clear() {
     bgsaving = false;
     path.clear();
     filenum = 0;
     offset = 0;
+    snapshot.reset();
   }
 };
 
@@ -116,12 +138,22 @@ class Partition {
   rocksdb::DBNemo* db() const {
     return db_;
   }
+  // NULL if disabled
+  ZPReadCache* read_cache() const {
+    return read_cache_;
+  }
 
   Node master_node() {
     slash::RWLock l(&state_rw_, false);
     return master_node_;
   }
 
+  // Where binlog come from, which is master_node_ without chain
+  Node upstream_node() {
+    slash::RWLock l(&state_rw_, false);
+    return upstream_node_;
+  }
+
   bool opened() {
     slash::RWLock l(&state_rw_, false);
     return opened_;
@@ -130,9 +162,12 @@ class Partition {
   // Command related
   void DoBinlogCommand(const PartitionSyncOption& option,
       const Cmd* cmd, const client::CmdRequest &req);
+  // context is extracted from req if NULL
   void DoCommand(const Cmd* cmd, const client::CmdRequest &req,
-      client::CmdResponse &res);
+      client::CmdResponse &res, const RequestContext* context = NULL);
   void DoBinlogSkip(const PartitionSyncOption& option, uint64_t gap);
+  void ReceiveHeartbeat(const std::string& from,
+      uint32_t filenum, uint64_t offset);
 
   // Status related
   bool ShouldTrySync();
@@ -143,14 +178,31 @@ class Partition {
   void WaitDBSyncDone();
 
   // Partition node related
-  void Update(ZPMeta::PState state, const Node& master, const std::set<Node> &slaves);
+  // chain is the ordered slaves if chain replication is on, otherwise empty
+  void Update(ZPMeta::PState state, const Node& master,
+      const std::set<Node> &slaves, const std::vector<Node> &chain);
   void Leave();
 
   // Binlog related
   Status SlaveAskSync(const Node &node, uint32_t filenum, uint64_t offset);
+  bool MapSyncPoint(const std::string& repl_id,
+      uint32_t* filenum, uint64_t* offset);
   bool GetBinlogOffsetWithLock(uint32_t* filenum, uint64_t* offset);
+  bool GetMasterHead(uint32_t* filenum, uint64_t* offset);
   Status SetBinlogOffsetWithLock(uint32_t filenum, uint64_t offset);
   std::string GetBinlogFilename();
+  Status ReadBinlogRecords(const std::string& key_prefix, int max_records,
+      uint64_t* max_bytes, uint32_t* filenum, uint64_t* offset,
+      client::CmdResponse_Subscribe* res);
+
+  // Replication history related
+  std::string ReplId() {
+    return repl_history_->current_id();
+  }
+  std::vector<ReplTerm> ReplHistoryTerms() {
+    return repl_history_->terms();
+  }
+  void AdoptReplHistory(const std::vector<ReplTerm>& terms);
 
   // State related
   void Dump();
@@ -175,6 +227,14 @@ class Partition {
   std::atomic<bool> opened_;
   Node master_node_;
   std::set<Node> slave_nodes_;
+  // Binlog come from upstream and go to downstreams, with chain replication
+  // a slave may have downstreams, and master has only the first slave
+  Node upstream_node_;
+  std::set<Node> downstream_nodes_;
+  // The one before me in chain found down, skipped until chain changed
+  Node down_upstream_;
+  std::atomic<uint64_t> upstream_active_us_;  // last time heard from upstream
+  void MaybeSkipDownUpstream();
   std::atomic<bool> readonly_;
   ZPMeta::PState pstate_;
   Role role_;
@@ -190,9 +250,20 @@ class Partition {
 
   // DB related
   rocksdb::DBNemo *db_;
+  ZPReadCache* read_cache_;
+  // Users of db_ without state_rw_ held, such as sst export and
+  // dbsync send, db_ is deleted only after they are all gone
+  slash::Mutex db_ref_mutex_;
+  slash::CondVar db_ref_cond_;
+  int db_refs_;
+  std::atomic<bool> db_closing_;  // ask the users to give up
+  void RefDb();
+  void UnrefDb();
+  void WaitDbUnref();
 
   // Binlog related
   Binlog* logger_;
+  ReplHistory* repl_history_;
   bool CheckBinlogFiles(); // Check binlog availible and update purge_index_
   Status SetBinlogOffset(uint32_t filenum, uint64_t offset);
   bool GetBinlogOffset(uint32_t* filenum, uint64_t* pro_offset) const;
@@ -208,12 +279,35 @@ class Partition {
   void CancelRecoverSync();
   void MaybeRecoverSync();
 
+  // Flow control related
+  std::atomic<int> sync_credit_pending_; // items consumed but not acked yet
+  void GrantSyncCredit();
+  void SendSyncToMaster(client::SyncType type, int32_t credits);
+
+  // Fast resync related
+  std::atomic<uint64_t> last_resync_us_;
+  void RequestResync();
+
+  // Follower read related
+  slash::Mutex lag_mutex_;
+  uint32_t upstream_head_filenum_;
+  uint64_t upstream_head_offset_;
+  uint64_t caught_up_us_;  // last time binlog reach where master's end, 0 if never
+  uint64_t applied_write_us_;  // when the last applied item written on master
+  void RecordUpstreamHead(uint32_t filenum, uint64_t offset);
+  void ResetUpstreamHead();
+  bool GetApplyLag(int64_t* bytes, uint64_t* ms);
+  bool WithinStaleness(const client::ReadStaleness& bound);
+
   // BGSave related
   slash::Mutex bgsave_protector_;
   BGSaveInfo bgsave_info_;
+  // All snapshots created, some may be still in use by dbsync
+  std::vector<std::weak_ptr<std::string>> bgsave_snapshots_;
   void Bgsave();
   static void DoBgsave(void* arg);
   bool RunBgsave();
+  bool RunSstExport();
   bool InitBgsaveEnv();
   bool InitBgsaveContent(rocksdb::DBNemoCheckpoint* cp,
     CheckpointContent* content);
@@ -233,6 +327,7 @@ class Partition {
   void DBSync(const std::string& ip, int port);
   static void DoDBSync(void* arg);
   bool ChangeDb(const std::string& new_path);
+  bool IngestSstExport(const std::string& path);
   void DBSyncSendFile(const std::string& ip, int port);
 
   // Purge binlog related
@@ -245,7 +340,9 @@ class Partition {
   static void DoPurgeLogs(void* arg);
   bool CouldPurge(uint32_t index);
   bool PurgeLogs(uint32_t to, bool manual);
-  bool PurgeFiles(uint32_t to, bool manual);
+  bool PickPurgeFiles(uint32_t to, bool manual,
+      std::map<uint32_t, std::string>* files);
+  void DeletePurgeFiles(const std::map<uint32_t, std::string>& files);
 
   // Lock order:
   // state_rw_      >       suspend_rw_         >       bgsave_protector_
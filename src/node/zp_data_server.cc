@@ -6,8 +6,6 @@
 #include <sys/resource.h>
 #include <google/protobuf/text_format.h>
 
-#include "slash/include/rsync.h"
-
 #include "src/node/zp_sync_conn.h"
 #include "src/node/zp_data_client_conn.h"
 
@@ -15,7 +13,10 @@ ZPDataServer::ZPDataServer()
   : table_count_(0),
   should_exit_(false),
   meta_epoch_(-1),
-  should_pull_meta_(false) {
+  should_pull_meta_(false),
+  db_sync_next_worker_(0),
+  multikey_next_worker_(0),
+  pipeline_next_worker_(0) {
     pthread_rwlock_init(&meta_state_rw_, NULL);
     pthread_rwlockattr_t attr;
     pthread_rwlockattr_init(&attr);
@@ -52,6 +53,43 @@ ZPDataServer::ZPDataServer()
     // Create thread
     zp_metacmd_bgworker_= new ZPMetacmdBGWorker();
     zp_trysync_thread_ = new ZPTrySyncThread();
+    zp_dbsync_receiver_ = new ZPDBSyncReceiver(g_zp_conf->local_ip(),
+        g_zp_conf->local_port() + kPortShiftRsync, db_sync_path(),
+        g_zp_conf->data_path() + "/");
+    io_scheduler_ = new ZPIOScheduler(
+        static_cast<int64_t>(g_zp_conf->bg_io_speed()) * 1024 * 1024,
+        g_zp_conf->bg_io_latency_target());
+    io_scheduler_->SetCap(kIODBSync,
+        static_cast<int64_t>(g_zp_conf->db_sync_speed()) * 1024 * 1024);
+
+    // Bgsave and DBSync
+    for (int i = 0; i < g_zp_conf->bgsave_thread_num(); i++) {
+      pink::BGThread* worker = new pink::BGThread();
+      worker->set_thread_name("ZPDataBgsave");
+      bgsave_workers_.push_back(worker);
+    }
+
+    // Sync ack
+    for (int i = 0; i < kSyncAckThreadNum; i++) {
+      pink::BGThread* worker = new pink::BGThread();
+      worker->set_thread_name("ZPDataSyncAck");
+      sync_ack_workers_.push_back(worker);
+    }
+
+    // Multi-key read
+    for (int i = 0; i < g_zp_conf->multikey_thread_num(); i++) {
+      pink::BGThread* worker = new pink::BGThread();
+      worker->set_thread_name("ZPDataMultiKey");
+      multikey_workers_.push_back(worker);
+    }
+
+    // Pipelined request
+    for (int i = 0; i < g_zp_conf->pipeline_thread_num(); i++) {
+      pink::BGThread* worker = new pink::BGThread();
+      worker->set_thread_name("ZPDataPipeline");
+      pipeline_workers_.push_back(worker);
+    }
+    client_flusher_ = new ZPClientFlusher();
     
     // Binlog receive
     for (int j = 0; j < g_zp_conf->sync_recv_thread_num(); j++) {
@@ -111,6 +149,8 @@ ZPDataServer::~ZPDataServer() {
   delete client_factory_;
   delete client_handle_;
   LOG(INFO) << "Dispatch thread exit!";
+  // After all the client connections are gone
+  delete client_flusher_;
 
   auto it = binlog_send_workers_.begin();
   for (; it != binlog_send_workers_.end(); ++it) {
@@ -121,11 +161,22 @@ ZPDataServer::~ZPDataServer() {
     slash::MutexLock l(&mutex_peers_);
     auto iter = peers_.begin();
     while (iter != peers_.end()) {
-      iter->second->Close();
-      delete iter->second;
+      if (iter->second->cli != NULL) {
+        iter->second->cli->Close();
+        delete iter->second->cli;
+      }
       iter++;
     }
   }
+  {
+    slash::MutexLock l(&mutex_forward_clis_);
+    for (auto& item : forward_clis_) {
+      for (auto cli : item.second) {
+        cli->Close();
+        delete cli;
+      }
+    }
+  }
   LOG(INFO) << "Peers client exit!";
 
   zp_binlog_receiver_thread_->StopThread();
@@ -148,11 +199,28 @@ ZPDataServer::~ZPDataServer() {
   }
 
   delete zp_trysync_thread_;
+  delete zp_dbsync_receiver_;
   delete zp_metacmd_bgworker_;
 
   LOG(INFO) << " All Tables exit!!!";
-  bgsave_thread_.StopThread();
+  for (auto worker : bgsave_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
   bgpurge_thread_.StopThread();
+  for (auto worker : sync_ack_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
+  for (auto worker : multikey_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
+  for (auto worker : pipeline_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
+  delete io_scheduler_;
 
   DestoryCmdTable(cmds_);
   pthread_rwlock_destroy(&meta_state_rw_);
@@ -198,6 +266,25 @@ void ZPDataServer::InitDBOptions() {
 }
 
 Status ZPDataServer::Start() {
+  // Before dispatch, multi-key and pipelined requests need them
+  // once clients come
+  for (auto worker : multikey_workers_) {
+    if (pink::RetCode::kSuccess != worker->StartThread()) {
+      LOG(INFO) << "Multi-key worker start failed";
+      return Status::Corruption("Multi-key worker start failed!");
+    }
+  }
+  for (auto worker : pipeline_workers_) {
+    if (pink::RetCode::kSuccess != worker->StartThread()) {
+      LOG(INFO) << "Pipeline worker start failed";
+      return Status::Corruption("Pipeline worker start failed!");
+    }
+  }
+  if (pink::RetCode::kSuccess != client_flusher_->StartThread()) {
+    LOG(INFO) << "Client flusher start failed";
+    return Status::Corruption("Client flusher start failed!");
+  }
+
   if (pink::RetCode::kSuccess != zp_dispatch_thread_->StartThread()) {
     LOG(INFO) << "Dispatch thread start failed";
     return Status::Corruption("Dispatch thread start failed!");
@@ -213,6 +300,11 @@ Status ZPDataServer::Start() {
     return Status::Corruption("Ping thread start failed!");
   }
 
+  if (pink::RetCode::kSuccess != zp_dbsync_receiver_->StartThread()) {
+    LOG(INFO) << "DBSync receiver thread start failed";
+    return Status::Corruption("DBSync receiver thread start failed!");
+  }
+
   std::vector<ZPBinlogSendThread*>::iterator bsit = binlog_send_workers_.begin();
   for (; bsit != binlog_send_workers_.end(); ++bsit) {
     LOG(INFO) << "Start one binlog send worker thread";
@@ -291,9 +383,18 @@ Status ZPDataServer::SendToPeer(const Node &node, const client::SyncRequest &msg
   pink::Status res;
   std::string ip_port = slash::IpPortString(node.ip, node.port);
 
-  slash::MutexLock pl(&mutex_peers_);
-  std::unordered_map<std::string, pink::PinkCli*>::iterator iter = peers_.find(ip_port);
-  if (iter == peers_.end()) {
+  std::shared_ptr<PeerCli> peer;
+  {
+    slash::MutexLock pl(&mutex_peers_);
+    std::shared_ptr<PeerCli>& item = peers_[ip_port];
+    if (!item) {
+      item = std::make_shared<PeerCli>();
+    }
+    peer = item;
+  }
+
+  slash::MutexLock l(&peer->mu);
+  if (peer->cli == NULL) {
     pink::PinkCli *cli = pink::NewPbCli();
     res = cli->Connect(node.ip, node.port);
     if (!res.ok()) {
@@ -303,20 +404,107 @@ Status ZPDataServer::SendToPeer(const Node &node, const client::SyncRequest &msg
     }
     cli->set_send_timeout(1000);
     cli->set_recv_timeout(1000);
-    iter = (peers_.insert(std::pair<std::string, pink::PinkCli*>(ip_port, cli))).first;
+    peer->cli = cli;
   }
   
-  res = iter->second->Send(const_cast<client::SyncRequest*>(&msg));
+  res = peer->cli->Send(const_cast<client::SyncRequest*>(&msg));
   if (!res.ok()) {
     // Remove when second Failed, retry outside
-    iter->second->Close();
-    delete iter->second;
-    peers_.erase(iter);
+    peer->cli->Close();
+    delete peer->cli;
+    peer->cli = NULL;
     return Status::Corruption(res.ToString());
   }
   return Status::OK();
 }
 
+struct AsyncSendArg {
+  ZPDataServer* server;
+  Node node;
+  client::SyncRequest msg;
+};
+
+static void DoAsyncSendToPeer(void* arg) {
+  AsyncSendArg* send_arg = static_cast<AsyncSendArg*>(arg);
+  Status s = send_arg->server->SendToPeer(send_arg->node, send_arg->msg);
+  if (!s.ok()) {
+    const client::SyncRequest& msg = send_arg->msg;
+    bool resync = msg.sync_type() == client::SyncType::RESYNC;
+    LOG(WARNING) << "Failed to send sync type "
+      << static_cast<int>(msg.sync_type())
+      << " to " << send_arg->node
+      << ", table: " << (resync ? msg.binlog_resync().table_name()
+          : msg.binlog_ack().table_name())
+      << ", partition: " << (resync ? msg.binlog_resync().partition_id()
+          : msg.binlog_ack().partition_id())
+      << ", Error: " << s.ToString();
+  }
+  delete send_arg;
+}
+
+void ZPDataServer::AsyncSendToPeer(const Node &node,
+    const client::SyncRequest &msg) {
+  AsyncSendArg* arg = new AsyncSendArg();
+  arg->server = this;
+  arg->node = node;
+  arg->msg.CopyFrom(msg);
+  size_t hint = std::hash<std::string>()(
+      slash::IpPortString(node.ip, node.port));
+  slash::MutexLock l(&sync_ack_thread_protector_);
+  pink::BGThread* worker = sync_ack_workers_[hint % sync_ack_workers_.size()];
+  worker->StartThread();
+  worker->Schedule(&DoAsyncSendToPeer, static_cast<void*>(arg));
+}
+
+// Connections are checked out during the request, so that
+// requests to the same peer could go in parallel
+Status ZPDataServer::ForwardToPeer(const Node &node,
+    const client::CmdRequest &req, client::CmdResponse* res) {
+  std::string ip_port = slash::IpPortString(node.ip, node.port);
+  pink::PinkCli* cli = NULL;
+  {
+    slash::MutexLock l(&mutex_forward_clis_);
+    std::vector<pink::PinkCli*>& idle = forward_clis_[ip_port];
+    if (!idle.empty()) {
+      cli = idle.back();
+      idle.pop_back();
+    }
+  }
+
+  pink::Status s;
+  if (cli == NULL) {
+    cli = pink::NewPbCli();
+    s = cli->Connect(node.ip, node.port);
+    if (!s.ok()) {
+      cli->Close();
+      delete cli;
+      return Status::Corruption(s.ToString());
+    }
+    cli->set_send_timeout(kForwardTimeout);
+    cli->set_recv_timeout(kForwardTimeout);
+  }
+
+  s = cli->Send(const_cast<client::CmdRequest*>(&req));
+  if (s.ok()) {
+    s = cli->Recv(res);
+  }
+  if (!s.ok()) {
+    cli->Close();
+    delete cli;
+    return Status::Corruption(s.ToString());
+  }
+
+  slash::MutexLock l(&mutex_forward_clis_);
+  std::vector<pink::PinkCli*>& idle = forward_clis_[ip_port];
+  if (idle.size() < kForwardMaxIdleConns) {
+    idle.push_back(cli);
+  } else {
+    cli->Close();
+    delete cli;
+  }
+  return Status::OK();
+}
+
 std::shared_ptr<Table> ZPDataServer::GetOrAddTable(const std::string &table_name) {
   slash::RWLock l(&table_rw_, true);
   auto it = tables_.find(table_name);
@@ -392,10 +580,49 @@ int ZPDataServer::KeyToPartition(const std::string& table_name,
   return table ? table->KeyToPartition(key) : -1;
 }
 
-void ZPDataServer::BGSaveTaskSchedule(void (*function)(void*), void* arg) {
+std::shared_ptr<Partition> ZPDataServer::GetTablePartition(
+    const RequestContext& context) {
+  slash::RWLock l(&table_rw_, false);
+  std::shared_ptr<Table> table = GetTable(*context.table);
+  if (!table) {
+    return NULL;
+  }
+  return context.partition_id >= 0
+    ? table->GetPartitionById(context.partition_id)
+    : table->GetPartitionByHash(context.key_hash);
+}
+
+int ZPDataServer::ContextToPartition(const RequestContext& context) {
+  slash::RWLock l(&table_rw_, false);
+  std::shared_ptr<Table> table = GetTable(*context.table);
+  if (!table) {
+    return -1;
+  }
+  return context.partition_id >= 0
+    ? context.partition_id : table->HashToPartition(context.key_hash);
+}
+
+// Bgsave of one partition go to the same worker indicated by hint
+void ZPDataServer::BGSaveTaskSchedule(void (*function)(void*), void* arg,
+    size_t hint) {
   slash::MutexLock l(&bgsave_thread_protector_);
-  bgsave_thread_.StartThread();
-  bgsave_thread_.Schedule(function, arg);
+  pink::BGThread* worker = bgsave_workers_[hint % bgsave_workers_.size()];
+  worker->StartThread();
+  worker->Schedule(function, arg);
+}
+
+// DBSync could go to any worker, so that slaves could be served in parallel
+void ZPDataServer::DBSyncTaskSchedule(void (*function)(void*), void* arg,
+    uint64_t delay) {
+  slash::MutexLock l(&bgsave_thread_protector_);
+  pink::BGThread* worker =
+    bgsave_workers_[db_sync_next_worker_++ % bgsave_workers_.size()];
+  worker->StartThread();
+  if (delay == 0) {
+    worker->Schedule(function, arg);
+  } else {
+    worker->DelaySchedule(delay, function, arg);
+  }
 }
 
 void ZPDataServer::BGPurgeTaskSchedule(void (*function)(void*), void* arg) {
@@ -404,6 +631,19 @@ void ZPDataServer::BGPurgeTaskSchedule(void (*function)(void*), void* arg) {
   bgpurge_thread_.Schedule(function, arg);
 }
 
+// Started already, no protector needed
+void ZPDataServer::MultiKeyTaskSchedule(void (*function)(void*), void* arg) {
+  pink::BGThread* worker =
+    multikey_workers_[multikey_next_worker_++ % multikey_workers_.size()];
+  worker->Schedule(function, arg);
+}
+
+void ZPDataServer::PipelineTaskSchedule(void (*function)(void*), void* arg) {
+  pink::BGThread* worker =
+    pipeline_workers_[pipeline_next_worker_++ % pipeline_workers_.size()];
+  worker->Schedule(function, arg);
+}
+
 // Add Task, remove first if already exist
 // Return Status::InvalidArgument means the filenum and offset is Invalid
 Status ZPDataServer::AddBinlogSendTask(const std::string &table, int partition_id, const Node& node,
@@ -424,6 +664,26 @@ int32_t ZPDataServer::GetBinlogSendFilenum(const std::string &table, int partiti
   return binlog_send_pool_.TaskFilenum(task_name);
 }
 
+// Slave grant more credits to the binlog send task indicated by id and node
+Status ZPDataServer::GrantBinlogSendCredit(const std::string &table, int partition_id,
+    const Node& node, int32_t credits) {
+  std::string task_name = ZPBinlogSendTaskName(table, partition_id, node);
+  return binlog_send_pool_.GrantCredit(task_name, credits);
+}
+
+// Slave ask the binlog send task to continue from filenum and offset
+Status ZPDataServer::ResyncBinlogSendTask(const std::string &table, int partition_id,
+    const Node& node, uint32_t filenum, uint64_t offset) {
+  std::string task_name = ZPBinlogSendTaskName(table, partition_id, node);
+  return binlog_send_pool_.RequestResync(task_name, filenum, offset);
+}
+
+Status ZPDataServer::GetBinlogSendStats(const std::string &table, int partition_id,
+    const Node& node, ZPBinlogSendStats* stats) {
+  std::string task_name = ZPBinlogSendTaskName(table, partition_id, node);
+  return binlog_send_pool_.GetTaskStats(task_name, stats);
+}
+
 void ZPDataServer::DumpBinlogSendTask() {
   LOG(INFO) << "BinlogSendTask==========================";
   binlog_send_pool_.Dump();
@@ -608,6 +868,13 @@ void ZPDataServer::InitClientCmdTable() {
   // DelCmd
   Cmd* delptr = new DelCmd(kCmdFlagsKv | kCmdFlagsWrite);
   cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::DEL), delptr));
+  // IncrbyCmd handle both INCRBY and DECRBY, and AppendCmd
+  Cmd* incrbyptr = new IncrbyCmd(kCmdFlagsKv | kCmdFlagsWrite);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::INCRBY), incrbyptr));
+  Cmd* decrbyptr = new IncrbyCmd(kCmdFlagsKv | kCmdFlagsWrite);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::DECRBY), decrbyptr));
+  Cmd* appendptr = new AppendCmd(kCmdFlagsKv | kCmdFlagsWrite);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::APPEND), appendptr));
   // One InfoCmd handle many type queries;
   Cmd* infostatsptr = new InfoCmd(kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
   cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::INFOSTATS), infostatsptr));
@@ -620,12 +887,24 @@ void ZPDataServer::InitClientCmdTable() {
   // SyncCmd
   Cmd* syncptr = new SyncCmd(kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsSuspend);
   cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::SYNC), syncptr));
+  Cmd* msyncptr = new MsyncCmd(kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::MSYNC), msyncptr));
+  // SubscribeCmd
+  Cmd* subscribeptr = new SubscribeCmd(kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::SUBSCRIBE), subscribeptr));
   // MgetCmd
   Cmd* mgetptr = new MgetCmd(kCmdFlagsKv | kCmdFlagsRead | kCmdFlagsMultiPartition);
   cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::MGET), mgetptr));
+  // MsetCmd and MdelCmd
+  Cmd* msetptr = new MsetCmd(kCmdFlagsKv | kCmdFlagsWrite | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::MSET), msetptr));
+  Cmd* mdelptr = new MdelCmd(kCmdFlagsKv | kCmdFlagsWrite | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(static_cast<int>(client::Type::MDEL), mdelptr));
 }
 
 void ZPDataServer::DoTimingTask() {
+  io_scheduler_->Adjust();
+
   slash::RWLock l(&table_rw_, false);
   for (auto& pair : tables_) {
     pair.second->DoTimingTask();
@@ -20,7 +20,10 @@
 #include "src/node/zp_data_command.h"
 #include "src/node/zp_metacmd_bgworker.h"
 #include "src/node/zp_ping_thread.h"
+#include "src/node/zp_client_flusher.h"
 #include "src/node/zp_trysync_thread.h"
+#include "src/node/zp_dbsync.h"
+#include "src/node/zp_io_scheduler.h"
 #include "src/node/zp_binlog_sender.h"
 #include "src/node/zp_binlog_receive_bgworker.h"
 #include "src/node/zp_data_table.h"
@@ -115,16 +118,34 @@ class ZPDataServer {
   std::shared_ptr<Partition> GetTablePartitionById(const std::string &table_name,
       const int partition_id);
   int KeyToPartition(const std::string& table_name, const std::string &key);
+  // By partition id of context if there is, or by its key hash
+  std::shared_ptr<Partition> GetTablePartition(const RequestContext& context);
+  int ContextToPartition(const RequestContext& context);
 
   void DumpTablePartitions();
   void DumpBinlogSendTask();
   
   // Peer Client
   Status SendToPeer(const Node &node, const client::SyncRequest &msg);
+  // Send on the sync ack thread, so that the caller never wait for peer
+  void AsyncSendToPeer(const Node &node, const client::SyncRequest &msg);
+  // Send request to the client port of node and wait for its response
+  Status ForwardToPeer(const Node &node, const client::CmdRequest &req,
+      client::CmdResponse* res);
   
   // Backgroud thread
-  void BGSaveTaskSchedule(void (*function)(void*), void* arg);
+  void BGSaveTaskSchedule(void (*function)(void*), void* arg, size_t hint);
+  void DBSyncTaskSchedule(void (*function)(void*), void* arg,
+      uint64_t delay = 0);
+  ZPIOScheduler* io_scheduler() {
+    return io_scheduler_;
+  }
   void BGPurgeTaskSchedule(void (*function)(void*), void* arg);
+  void MultiKeyTaskSchedule(void (*function)(void*), void* arg);
+  void PipelineTaskSchedule(void (*function)(void*), void* arg);
+  ZPClientFlusher* client_flusher() {
+    return client_flusher_;
+  }
   void AddSyncTask(const std::string& table, int partition_id,
       uint64_t delay = 0);
   void AddMetacmdTask();
@@ -134,6 +155,12 @@ class ZPDataServer {
       const Node& node);
   int32_t GetBinlogSendFilenum(const std::string &table, int partition_id,
       const Node& node);
+  Status GrantBinlogSendCredit(const std::string &table, int partition_id,
+      const Node& node, int32_t credits);
+  Status ResyncBinlogSendTask(const std::string &table, int partition_id,
+      const Node& node, uint32_t filenum, uint64_t offset);
+  Status GetBinlogSendStats(const std::string &table, int partition_id,
+      const Node& node, ZPBinlogSendStats* stats);
   void DispatchBinlogBGWorker(ZPBinlogReceiveTask *task);
 
 
@@ -171,14 +198,26 @@ class ZPDataServer {
   std::shared_ptr<Table> GetTable(const std::string &table_name);
 
   // Binlog Send related
+  // Sends to one peer go in order on its connection, while mutex_peers_
+  // is held only to find it, so that a slow peer never block the others
+  struct PeerCli {
+    slash::Mutex mu;
+    pink::PinkCli* cli;
+    PeerCli() : cli(NULL) {}
+  };
   slash::Mutex mutex_peers_;
-  std::unordered_map<std::string, pink::PinkCli*> peers_;
+  std::unordered_map<std::string, std::shared_ptr<PeerCli>> peers_;
+
+  // Idle connections to the client port of peers, for forward
+  slash::Mutex mutex_forward_clis_;
+  std::unordered_map<std::string, std::vector<pink::PinkCli*>> forward_clis_;
   ZPBinlogSendTaskPool binlog_send_pool_;
   std::vector<ZPBinlogSendThread*> binlog_send_workers_;
 
   // Server related
   ZPMetacmdBGWorker* zp_metacmd_bgworker_;
   ZPTrySyncThread* zp_trysync_thread_;
+  ZPDBSyncReceiver* zp_dbsync_receiver_;
 
   std::vector<ZPBinlogReceiveBgWorker*> zp_binlog_receive_bgworkers_;
   pink::ConnFactory* sync_factory_;
@@ -188,6 +227,7 @@ class ZPDataServer {
   pink::ConnFactory* client_factory_;
   pink::ServerHandle* client_handle_;
   pink::ServerThread* zp_dispatch_thread_;
+  ZPClientFlusher* client_flusher_;
   ZPPingThread* zp_ping_thread_;
 
   std::atomic<bool> should_exit_;
@@ -205,10 +245,24 @@ class ZPDataServer {
   void InitClientCmdTable();
 
   // Background thread
+  // Shared by bgsave and dbsync, task of the same partition's bgsave
+  // always go to the same worker, while dbsync go around
   slash::Mutex bgsave_thread_protector_;
-  pink::BGThread bgsave_thread_;
+  std::vector<pink::BGThread*> bgsave_workers_;
+  std::atomic<uint32_t> db_sync_next_worker_;
+  ZPIOScheduler* io_scheduler_;  // io budget of all background work
   slash::Mutex bgpurge_thread_protector_;
   pink::BGThread bgpurge_thread_;
+  // Acks and resync requests from slaves to their upstream,
+  // those to the same upstream always go to the same worker
+  slash::Mutex sync_ack_thread_protector_;
+  std::vector<pink::BGThread*> sync_ack_workers_;
+  // Partitions of one big multi-key read run on them in parallel
+  std::vector<pink::BGThread*> multikey_workers_;
+  std::atomic<uint32_t> multikey_next_worker_;
+  // Unordered requests of protocol v2 from one read run on them together
+  std::vector<pink::BGThread*> pipeline_workers_;
+  std::atomic<uint32_t> pipeline_next_worker_;
   void DoTimingTask();
 
   // Statistic related
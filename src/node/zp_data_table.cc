@@ -53,9 +53,13 @@ bool Table::SetPartitionCount(const int count) {
 }
 
 std::shared_ptr<Partition> Table::GetPartition(const std::string &key) {
+  return GetPartitionByHash(std::hash<std::string>()(key));
+}
+
+std::shared_ptr<Partition> Table::GetPartitionByHash(size_t key_hash) {
   slash::RWLock l(&partition_rw_, false);
   if (partition_cnt_ > 0) {
-    int partition_id = std::hash<std::string>()(key) % partition_cnt_;
+    int partition_id = key_hash % partition_cnt_;
     auto it = partitions_.find(partition_id);
     if (it != partitions_.end()) {
       return it->second;
@@ -74,12 +78,13 @@ std::shared_ptr<Partition> Table::GetPartitionById(const int partition_id) {
 }
 
 bool Table::UpdateOrAddPartition(const int partition_id,
-    ZPMeta::PState state, const Node& master, const std::set<Node>& slaves) {
+    ZPMeta::PState state, const Node& master, const std::set<Node>& slaves,
+    const std::vector<Node>& chain) {
   slash::RWLock l(&partition_rw_, true);
   auto iter = partitions_.find(partition_id);
   if (iter != partitions_.end()) {
     //Exist partition: update it
-    (iter->second)->Update(state, master, slaves);
+    (iter->second)->Update(state, master, slaves, chain);
     return true;
   }
 
@@ -93,7 +98,7 @@ bool Table::UpdateOrAddPartition(const int partition_id,
       log_path_, data_path_, partition_id, master, slaves);
   assert(partition != NULL);
 
-  partition->Update(ZPMeta::PState::ACTIVE, master, slaves);
+  partition->Update(ZPMeta::PState::ACTIVE, master, slaves, chain);
   partitions_[partition_id] = partition;
 
   return true;
@@ -107,8 +112,12 @@ void Table::LeaveAllPartition() {
 }
 
 uint32_t Table::KeyToPartition(const std::string &key) {
+  return HashToPartition(std::hash<std::string>()(key));
+}
+
+uint32_t Table::HashToPartition(size_t key_hash) {
   assert(partition_cnt_ != 0);
-  return std::hash<std::string>()(key) % partition_cnt_;
+  return key_hash % partition_cnt_;
 }
 
 void Table::Dump() {
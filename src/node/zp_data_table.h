@@ -27,12 +27,16 @@ class Table {
 
   bool SetPartitionCount(int count);
   std::shared_ptr<Partition> GetPartition(const std::string &key);
+  // Same as GetPartition, with the key hashed already
+  std::shared_ptr<Partition> GetPartitionByHash(size_t key_hash);
   std::shared_ptr<Partition> GetPartitionById(const int partition_id);
   bool UpdateOrAddPartition(int partition_id, ZPMeta::PState state,
-      const Node& master, const std::set<Node>& slaves);
+      const Node& master, const std::set<Node>& slaves,
+      const std::vector<Node>& chain);
   void LeaveAllPartition();
   
   uint32_t KeyToPartition(const std::string &key);
+  uint32_t HashToPartition(size_t key_hash);
 
   void Dump();
   void DoTimingTask();
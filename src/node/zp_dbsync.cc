@@ -0,0 +1,629 @@
+#include "src/node/zp_dbsync.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <set>
+#include <thread>
+#include <algorithm>
+#include <glog/logging.h>
+
+#include "slash/include/env.h"
+#include "include/zp_const.h"
+
+// magic, op, path length, size
+static const size_t kDBSyncHeaderSize = 4 + 4 + 4 + 8;
+// size or start offset, crc32
+static const size_t kDBSyncPointSize = 8 + 4;
+static const size_t kDBSyncMaxPathLen = 4096;
+static const uint64_t kDBSyncMaxClearLen = 16 * 1024 * 1024;
+
+static void EncodeFixed32(char* buf, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    buf[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+}
+
+static void EncodeFixed64(char* buf, uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    buf[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+}
+
+static uint32_t DecodeFixed32(const char* buf) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    value |= static_cast<uint32_t>(static_cast<unsigned char>(buf[i])) << (8 * i);
+  }
+  return value;
+}
+
+static uint64_t DecodeFixed64(const char* buf) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++) {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(buf[i])) << (8 * i);
+  }
+  return value;
+}
+
+static bool WriteAll(int fd, const char* buf, size_t n) {
+  while (n > 0) {
+    ssize_t ret = write(fd, buf, n);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    buf += ret;
+    n -= ret;
+  }
+  return true;
+}
+
+static bool ReadAll(int fd, char* buf, size_t n) {
+  while (n > 0) {
+    ssize_t ret = read(fd, buf, n);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      return false;
+    }
+    buf += ret;
+    n -= ret;
+  }
+  return true;
+}
+
+static void SetTimeout(int fd) {
+  struct timeval tv;
+  tv.tv_sec = kDBSyncTimeout / 1000;
+  tv.tv_usec = (kDBSyncTimeout % 1000) * 1000;
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+// Calculate crc32 of the first len bytes of file,
+// and the crc32 of first mark bytes at the same pass if mark <= len
+static bool FileCrc(int fd, uint64_t len, uint64_t mark,
+    uint32_t* mark_crc, uint32_t* crc) {
+  std::string buf(kDBSyncChunkSize, '\0');
+  uint32_t cur = 0;
+  uint64_t off = 0;
+  if (mark == 0) {
+    *mark_crc = 0;
+  }
+  while (off < len) {
+    size_t n = std::min(static_cast<uint64_t>(kDBSyncChunkSize), len - off);
+    if (off < mark && mark < off + n) {
+      n = mark - off;
+    }
+    ssize_t ret = pread(fd, &buf[0], n, off);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      return false;
+    }
+    cur = crc32(cur, reinterpret_cast<const Bytef*>(buf.data()), ret);
+    off += ret;
+    if (off == mark) {
+      *mark_crc = cur;
+    }
+  }
+  *crc = cur;
+  return true;
+}
+
+/**
+ * ZPDBSyncSender
+ */
+ZPDBSyncSender::ZPDBSyncSender(const std::string& ip, int port, int parallel,
+    ZPIOScheduler* io_scheduler)
+  : ip_(ip),
+  port_(port),
+  parallel_(parallel),
+  io_scheduler_(io_scheduler) {
+  }
+
+int ZPDBSyncSender::Connect() {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  SetTimeout(fd);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port_);
+  if (inet_pton(AF_INET, ip_.c_str(), &addr.sin_addr) != 1
+      || connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+    LOG(WARNING) << "DBSync connect to " << ip_ << ":" << port_
+      << " failed: " << strerror(errno);
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+Status ZPDBSyncSender::SendFile(int fd, const std::string& local,
+    const std::string& remote) {
+  int in = open(local.c_str(), O_RDONLY);
+  if (in < 0) {
+    return Status::IOError("Open file failed", local);
+  }
+  struct stat st;
+  if (fstat(in, &st) != 0) {
+    close(in);
+    return Status::IOError("Stat file failed", local);
+  }
+  uint64_t size = st.st_size;
+
+  // Header
+  std::string header(kDBSyncHeaderSize, '\0');
+  EncodeFixed32(&header[0], kDBSyncMagic);
+  EncodeFixed32(&header[4], kDBSyncOpFile);
+  EncodeFixed32(&header[8], remote.size());
+  EncodeFixed64(&header[12], size);
+  header.append(remote);
+  char point[kDBSyncPointSize];
+  if (!WriteAll(fd, header.data(), header.size())
+      || !ReadAll(fd, point, kDBSyncPointSize)) {
+    close(in);
+    return Status::IOError("Exchange header failed", remote);
+  }
+
+  // Resume from the partial file if it's the same as ours
+  uint64_t partial = DecodeFixed64(point);
+  uint32_t partial_crc = DecodeFixed32(point + 8);
+  uint32_t mark_crc = 0, crc = 0;
+  if (!FileCrc(in, size, partial, &mark_crc, &crc)) {
+    close(in);
+    return Status::IOError("Read file failed", local);
+  }
+  uint64_t start = (partial <= size && mark_crc == partial_crc) ? partial : 0;
+  if (start > 0 && start == size) {
+    LOG(INFO) << "DBSync skip " << remote << ", receiver already has it";
+  } else if (start > 0) {
+    LOG(INFO) << "DBSync resume " << remote << " from " << start << "/" << size;
+  }
+  EncodeFixed64(point, start);
+  EncodeFixed32(point + 8, crc);
+  if (!WriteAll(fd, point, kDBSyncPointSize)) {
+    close(in);
+    return Status::IOError("Send start point failed", remote);
+  }
+
+  // Content
+  off_t off = start;
+  while (static_cast<uint64_t>(off) < size) {
+    size_t n = std::min(static_cast<uint64_t>(kDBSyncChunkSize), size - off);
+    io_scheduler_->Request(kIODBSync, n);
+    ssize_t ret = sendfile(fd, in, &off, n);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      close(in);
+      return Status::IOError("Sendfile failed", remote);
+    }
+  }
+  close(in);
+
+  // Result
+  char code[4];
+  if (!ReadAll(fd, code, sizeof(code))) {
+    return Status::IOError("Receive result failed", remote);
+  }
+  if (DecodeFixed32(code) != 0) {
+    return Status::Corruption("Receiver reject", remote);
+  }
+  return Status::OK();
+}
+
+Status ZPDBSyncSender::SendClear(int fd, const std::string& remote_dir,
+    const std::vector<std::string>& keep) {
+  std::string content;
+  for (auto& name : keep) {
+    content.append(name);
+    content.append("\n");
+  }
+  std::string header(kDBSyncHeaderSize, '\0');
+  EncodeFixed32(&header[0], kDBSyncMagic);
+  EncodeFixed32(&header[4], kDBSyncOpClear);
+  EncodeFixed32(&header[8], remote_dir.size());
+  EncodeFixed64(&header[12], content.size());
+  header.append(remote_dir);
+  header.append(content);
+  char code[4];
+  if (!WriteAll(fd, header.data(), header.size())
+      || !ReadAll(fd, code, sizeof(code))) {
+    return Status::IOError("Send clear failed", remote_dir);
+  }
+  if (DecodeFixed32(code) != 0) {
+    return Status::Corruption("Receiver reject clear", remote_dir);
+  }
+  return Status::OK();
+}
+
+// Reconnect and try again, receiver will resume from what it has
+Status ZPDBSyncSender::SendFileWithRetry(int* fd, const std::string& local,
+    const std::string& remote) {
+  Status s;
+  for (int i = 0; i <= kDBSyncRetryTimes; i++) {
+    if (*fd < 0 && (*fd = Connect()) < 0) {
+      s = Status::IOError("Connect failed");
+      sleep(1);
+      continue;
+    }
+    s = SendFile(*fd, local, remote);
+    if (s.ok()) {
+      return s;
+    }
+    LOG(WARNING) << "DBSync send " << local << " to " << ip_ << ":" << port_
+      << " failed, retry: " << i << ", Error: " << s.ToString();
+    close(*fd);
+    *fd = -1;
+  }
+  return s;
+}
+
+Status ZPDBSyncSender::SendDir(const std::string& local_dir,
+    const std::string& remote_dir, const std::string& last_file,
+    std::function<bool()> should_abort) {
+  std::string dir = local_dir;
+  if (!dir.empty() && dir.back() == '/') {
+    dir.resize(dir.size() - 1);
+  }
+  std::vector<std::string> descendant;
+  if (!slash::GetDescendant(dir, descendant)) {
+    return Status::IOError("Get descendant failed", dir);
+  }
+  std::vector<std::string> names;
+  std::vector<std::string> to_send;
+  for (auto& path : descendant) {
+    std::string name = path.substr(dir.size() + 1);
+    names.push_back(name);
+    if (name != last_file) {
+      to_send.push_back(name);
+    }
+  }
+
+  // Send files in parallel, every worker with its own connection
+  std::atomic<size_t> next(0);
+  std::atomic<bool> failed(false);
+  auto worker = [&]() {
+    int fd = -1;
+    while (!failed) {
+      size_t i = next++;
+      if (i >= to_send.size()) {
+        break;
+      }
+      if (should_abort()) {
+        failed = true;
+        break;
+      }
+      Status s = SendFileWithRetry(&fd, dir + "/" + to_send[i],
+          remote_dir + "/" + to_send[i]);
+      if (!s.ok()) {
+        failed = true;
+      }
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  };
+  std::vector<std::thread> workers;
+  int worker_num = std::min(static_cast<size_t>(parallel_), to_send.size());
+  for (int i = 0; i < worker_num; i++) {
+    workers.push_back(std::thread(worker));
+  }
+  for (auto& t : workers) {
+    t.join();
+  }
+  if (failed) {
+    return Status::Incomplete("Send files failed");
+  }
+
+  // Clear stale files then send the last one
+  int fd = Connect();
+  if (fd < 0) {
+    return Status::IOError("Connect failed");
+  }
+  Status s = SendClear(fd, remote_dir, names);
+  if (s.ok() && !last_file.empty()) {
+    s = SendFileWithRetry(&fd, dir + "/" + last_file,
+        remote_dir + "/" + last_file);
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+  return s;
+}
+
+/**
+ * ZPDBSyncReceiver
+ */
+ZPDBSyncReceiver::ZPDBSyncReceiver(const std::string& ip, int port,
+    const std::string& root, const std::string& reuse_root)
+  : ip_(ip),
+  port_(port),
+  root_(root),
+  reuse_root_(reuse_root),
+  listen_fd_(-1),
+  conn_num_(0) {
+    set_thread_name("ZPDataDBSync");
+  }
+
+ZPDBSyncReceiver::~ZPDBSyncReceiver() {
+  StopThread();
+  // Connections exit when current file done or timeout
+  while (conn_num_ > 0) {
+    usleep(100000);
+  }
+  if (listen_fd_ >= 0) {
+    close(listen_fd_);
+  }
+  LOG(INFO) << " DBSync receiver " << pthread_self() << " exit!!!";
+}
+
+void* ZPDBSyncReceiver::ThreadMain() {
+  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ < 0) {
+    LOG(ERROR) << "DBSync receiver create socket failed: " << strerror(errno);
+    return NULL;
+  }
+  int yes = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port_);
+  if (inet_pton(AF_INET, ip_.c_str(), &addr.sin_addr) != 1
+      || bind(listen_fd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0
+      || listen(listen_fd_, 128) < 0) {
+    LOG(ERROR) << "DBSync receiver listen on " << ip_ << ":" << port_
+      << " failed: " << strerror(errno);
+    return NULL;
+  }
+  LOG(INFO) << "DBSync receiver listen on " << ip_ << ":" << port_;
+
+  while (!should_stop()) {
+    struct pollfd pfd;
+    pfd.fd = listen_fd_;
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, 1000) <= 0) {
+      continue;
+    }
+    int fd = accept(listen_fd_, NULL, NULL);
+    if (fd < 0) {
+      continue;
+    }
+    SetTimeout(fd);
+    conn_num_++;
+    std::thread(&ZPDBSyncReceiver::HandleConn, this, fd).detach();
+  }
+  return NULL;
+}
+
+void ZPDBSyncReceiver::HandleConn(int fd) {
+  char header[kDBSyncHeaderSize];
+  while (!should_stop()) {
+    if (!ReadAll(fd, header, kDBSyncHeaderSize)) {
+      break;  // Closed by sender or timeout
+    }
+    uint32_t magic = DecodeFixed32(header);
+    uint32_t op = DecodeFixed32(header + 4);
+    uint32_t path_len = DecodeFixed32(header + 8);
+    uint64_t size = DecodeFixed64(header + 12);
+    if (magic != kDBSyncMagic || path_len == 0 || path_len > kDBSyncMaxPathLen) {
+      LOG(WARNING) << "DBSync receive invalid header, magic: " << magic
+        << ", path length: " << path_len;
+      break;
+    }
+    std::string path(path_len, '\0');
+    if (!ReadAll(fd, &path[0], path_len)) {
+      break;
+    }
+    if (path[0] == '/' || path.find("..") != std::string::npos) {
+      LOG(WARNING) << "DBSync receive invalid path: " << path;
+      break;
+    }
+
+    Status s;
+    if (op == kDBSyncOpFile) {
+      s = ReceiveFile(fd, path, size);
+    } else if (op == kDBSyncOpClear) {
+      s = ReceiveClear(fd, path, size);
+    } else {
+      s = Status::InvalidArgument("Unknown op");
+    }
+    if (!s.ok()) {
+      LOG(WARNING) << "DBSync receive " << path << " failed: " << s.ToString();
+      if (!s.IsCorruption()) {
+        // Connection is out of order
+        break;
+      }
+    }
+  }
+  close(fd);
+  conn_num_--;
+}
+
+static bool IsImmutableFile(const std::string& path) {
+  static const std::string kSstSuffix = ".sst";
+  return path.size() > kSstSuffix.size()
+    && path.compare(path.size() - kSstSuffix.size(),
+        kSstSuffix.size(), kSstSuffix) == 0;
+}
+
+// Link the file we may already have as the partial one,
+// sender will check its crc and skip the content if they are the same
+bool ZPDBSyncReceiver::LinkExistFile(const std::string& path, uint64_t size,
+    const std::string& tmp) {
+  std::vector<std::string> candidates;
+  // Received by an earlier sync which has not finished
+  candidates.push_back(root_ + path);
+  if (IsImmutableFile(path)) {
+    // Same sst in the db currently used
+    candidates.push_back(reuse_root_ + path);
+  }
+  struct stat st;
+  for (auto& candidate : candidates) {
+    if (stat(candidate.c_str(), &st) == 0
+        && static_cast<uint64_t>(st.st_size) == size
+        && link(candidate.c_str(), tmp.c_str()) == 0) {
+      DLOG(INFO) << "DBSync reuse " << candidate << " for " << path;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Content is received into a temporary file first,
+// which will be kept for resuming if the connection broken
+Status ZPDBSyncReceiver::ReceiveFile(int fd, const std::string& path,
+    uint64_t size) {
+  std::string target = root_ + path;
+  std::string tmp = target + kDBSyncTmpSuffix;
+  slash::CreatePath(target.substr(0, target.rfind('/')));
+  if (!slash::FileExists(tmp)) {
+    LinkExistFile(path, size, tmp);
+  }
+  int out = open(tmp.c_str(), O_RDWR | O_CREAT, 0644);
+  if (out < 0) {
+    return Status::IOError("Open file failed", tmp);
+  }
+
+  // Tell sender what we have
+  struct stat st;
+  uint64_t file_size = 0, partial = 0;
+  uint32_t partial_crc = 0, crc = 0;
+  if (fstat(out, &st) == 0) {
+    file_size = st.st_size;
+    partial = file_size;
+  }
+  if (partial > size || !FileCrc(out, partial, partial, &partial_crc, &crc)) {
+    partial = 0;
+    partial_crc = 0;
+  }
+  char point[kDBSyncPointSize];
+  EncodeFixed64(point, partial);
+  EncodeFixed32(point + 8, partial_crc);
+  if (!WriteAll(fd, point, kDBSyncPointSize)
+      || !ReadAll(fd, point, kDBSyncPointSize)) {
+    close(out);
+    return Status::IOError("Exchange start point failed", path);
+  }
+  uint64_t start = DecodeFixed64(point);
+  uint32_t expect_crc = DecodeFixed32(point + 8);
+  if (start != 0 && start != partial) {
+    close(out);
+    return Status::IOError("Invalid start point", path);
+  }
+  crc = (start == 0) ? 0 : partial_crc;
+  if (start == 0 && file_size > 0) {
+    // Never write into the existing one, which may be linked to others,
+    // even if it was not offered as partial
+    close(out);
+    slash::DeleteFile(tmp);
+    out = open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (out < 0) {
+      return Status::IOError("Open file failed", tmp);
+    }
+  }
+  if (lseek(out, start, SEEK_SET) < 0) {
+    close(out);
+    return Status::IOError("Seek file failed", tmp);
+  }
+
+  // Content
+  std::string buf(kDBSyncChunkSize, '\0');
+  uint64_t left = size - start;
+  while (left > 0) {
+    size_t n = std::min(static_cast<uint64_t>(kDBSyncChunkSize), left);
+    if (!ReadAll(fd, &buf[0], n)) {
+      close(out);
+      return Status::IOError("Receive content failed", path);
+    }
+    if (!WriteAll(out, buf.data(), n)) {
+      close(out);
+      return Status::IOError("Write file failed", tmp);
+    }
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(buf.data()), n);
+    left -= n;
+  }
+  // Drop any stale tail beyond the content
+  if (ftruncate(out, size) != 0) {
+    close(out);
+    return Status::IOError("Truncate file failed", tmp);
+  }
+  fdatasync(out);
+  close(out);
+
+  Status s;
+  uint32_t code = 0;
+  if (crc != expect_crc) {
+    slash::DeleteFile(tmp);
+    s = Status::Corruption("Checksum mismatch", path);
+    code = 1;
+  } else if (slash::RenameFile(tmp.c_str(), target.c_str()) != 0) {
+    s = Status::Corruption("Rename file failed", path);
+    code = 2;
+  }
+  char result[4];
+  EncodeFixed32(result, code);
+  if (!WriteAll(fd, result, sizeof(result))) {
+    return Status::IOError("Send result failed", path);
+  }
+  return s;
+}
+
+// Remove files not in the list sent
+Status ZPDBSyncReceiver::ReceiveClear(int fd, const std::string& path,
+    uint64_t size) {
+  if (size > kDBSyncMaxClearLen) {
+    return Status::IOError("Clear list too long", path);
+  }
+  std::string content(size, '\0');
+  if (size > 0 && !ReadAll(fd, &content[0], size)) {
+    return Status::IOError("Receive clear list failed", path);
+  }
+  std::set<std::string> keep;
+  size_t pos = 0, next = 0;
+  while ((next = content.find('\n', pos)) != std::string::npos) {
+    keep.insert(content.substr(pos, next - pos));
+    pos = next + 1;
+  }
+
+  std::string dir = root_ + path;
+  std::vector<std::string> children;
+  slash::GetChildren(dir, children);
+  for (auto& child : children) {
+    if (keep.find(child) != keep.end()) {
+      continue;
+    }
+    std::string child_path = dir + "/" + child;
+    if (slash::IsDir(child_path) == 0) {
+      slash::DeleteDirIfExist(child_path);
+    } else {
+      slash::DeleteFile(child_path);
+    }
+  }
+
+  char result[4];
+  EncodeFixed32(result, 0);
+  if (!WriteAll(fd, result, sizeof(result))) {
+    return Status::IOError("Send result failed", path);
+  }
+  return Status::OK();
+}
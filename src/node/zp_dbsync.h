@@ -0,0 +1,84 @@
+#ifndef ZP_DBSYNC_H
+#define ZP_DBSYNC_H
+#include <string>
+#include <vector>
+#include <atomic>
+#include <functional>
+
+#include "slash/include/slash_status.h"
+#include "slash/include/slash_mutex.h"
+#include "pink/include/pink_thread.h"
+#include "src/node/zp_io_scheduler.h"
+
+using slash::Status;
+
+// Snapshot transfer for DBSync, every connection carry files one by one:
+//   sender   -> header: magic, op, path length, size, path
+//   receiver -> size and crc32 of the partial file it already has
+//   sender   -> start offset, 0 if partial one mismatch, and crc32 of file
+//   sender   -> file content from start offset, by sendfile
+//   receiver -> result code
+// CLEAR op carry the names to keep as its content,
+// receiver remove other files in that path and reply result code only
+enum DBSyncOp {
+  kDBSyncOpFile = 1,
+  kDBSyncOpClear = 2,
+};
+
+/**
+ * ZPDBSyncSender
+ */
+class ZPDBSyncSender {
+ public:
+  ZPDBSyncSender(const std::string& ip, int port, int parallel,
+      ZPIOScheduler* io_scheduler);
+
+  // Send all files in local_dir to remote_dir relative to receiver's root,
+  // then clear files not in local_dir, send last_file at the end if not empty
+  Status SendDir(const std::string& local_dir, const std::string& remote_dir,
+      const std::string& last_file, std::function<bool()> should_abort);
+
+ private:
+  const std::string ip_;
+  const int port_;
+  const int parallel_;
+  ZPIOScheduler* io_scheduler_;  // kIODBSync is capped by db_sync_speed
+
+  int Connect();
+  Status SendFile(int fd, const std::string& local, const std::string& remote);
+  Status SendClear(int fd, const std::string& remote_dir,
+      const std::vector<std::string>& keep);
+  Status SendFileWithRetry(int* fd, const std::string& local,
+      const std::string& remote);
+};
+
+/**
+ * ZPDBSyncReceiver
+ * Receive files into root, one thread for each connection.
+ * Files already there from an earlier sync, or immutable ones
+ * with the same name and size in reuse_root, are hard linked as the
+ * partial file, so that only the changed ones need to be transferred
+ */
+class ZPDBSyncReceiver : public pink::Thread {
+ public:
+  ZPDBSyncReceiver(const std::string& ip, int port, const std::string& root,
+      const std::string& reuse_root);
+  virtual ~ZPDBSyncReceiver();
+
+ private:
+  const std::string ip_;
+  const int port_;
+  const std::string root_;
+  const std::string reuse_root_;
+  int listen_fd_;
+  std::atomic<int> conn_num_;
+
+  virtual void* ThreadMain();
+  void HandleConn(int fd);
+  bool LinkExistFile(const std::string& path, uint64_t size,
+      const std::string& tmp);
+  Status ReceiveFile(int fd, const std::string& path, uint64_t size);
+  Status ReceiveClear(int fd, const std::string& path, uint64_t size);
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "src/node/zp_io_scheduler.h"
+
+#include <unistd.h>
+#include <algorithm>
+#include <glog/logging.h>
+
+#include "slash/include/env.h"
+#include "include/zp_const.h"
+
+ZPIOScheduler::ZPIOScheduler(int64_t bytes_per_second,
+    uint64_t latency_target_us)
+  : max_rate_(bytes_per_second),
+  step_(std::max(bytes_per_second / kIORateStepDivisor, static_cast<int64_t>(1))),
+  rate_(bytes_per_second),
+  latency_target_us_(latency_target_us),
+  fg_total_(0),
+  fg_slow_(0) {
+    for (int i = 0; i < kIOPriorityNum; i++) {
+      next_us_[i] = 0;
+      cap_[i] = 0;
+    }
+  }
+
+void ZPIOScheduler::Request(ZPIOPriority pri, int64_t bytes) {
+  uint64_t wait_us = Reserve(pri, bytes);
+  if (wait_us > 0) {
+    usleep(wait_us);
+  }
+}
+
+uint64_t ZPIOScheduler::Reserve(ZPIOPriority pri, int64_t bytes) {
+  if (bytes <= 0) {
+    return 0;
+  }
+  slash::MutexLock l(&mutex_);
+  uint64_t now = slash::NowMicros();
+  uint64_t cost = bytes * 1000000 / rate_;
+  uint64_t start_us = std::max(now, next_us_[pri]);
+  // Capped one wait longer for itself, but cost others the same
+  uint64_t own_cost = cost;
+  if (cap_[pri] > 0) {
+    own_cost = std::max(own_cost,
+        static_cast<uint64_t>(bytes * 1000000 / cap_[pri]));
+  }
+  next_us_[pri] = start_us + own_cost;
+  // Lower ones wait for me, and keep behind the higher ones
+  for (int i = pri + 1; i < kIOPriorityNum; i++) {
+    next_us_[i] = std::max(std::max(next_us_[i], now) + cost,
+        next_us_[i - 1]);
+  }
+  return start_us - now;
+}
+
+void ZPIOScheduler::SetCap(ZPIOPriority pri, int64_t bytes_per_second) {
+  slash::MutexLock l(&mutex_);
+  cap_[pri] = bytes_per_second;
+}
+
+void ZPIOScheduler::RecordForeground(uint64_t latency_us) {
+  fg_total_++;
+  if (latency_us > latency_target_us_) {
+    fg_slow_++;
+  }
+}
+
+void ZPIOScheduler::Adjust() {
+  uint64_t total = fg_total_;
+  if (total < kIOMinSamples) {
+    // Too few to judge, keep counting
+    return;
+  }
+  uint64_t slow = fg_slow_;
+  fg_total_ -= total;
+  fg_slow_ -= slow;
+
+  slash::MutexLock l(&mutex_);
+  int64_t old = rate_;
+  if (slow * kIOSlowDivisor > total) {
+    rate_ = std::max(rate_ / 2, step_);
+  } else {
+    rate_ = std::min(rate_ + step_, max_rate_);
+  }
+  if (rate_ != old) {
+    LOG(INFO) << "Background io budget " << old << " -> " << rate_
+      << " bytes/s, foreground slow " << slow << " of " << total;
+  }
+}
+
+int64_t ZPIOScheduler::bytes_per_second() {
+  slash::MutexLock l(&mutex_);
+  return rate_;
+}
@@ -0,0 +1,59 @@
+#ifndef ZP_IO_SCHEDULER_H
+#define ZP_IO_SCHEDULER_H
+#include <atomic>
+
+#include "slash/include/slash_mutex.h"
+
+// Background io in priority order, the higher one go first
+enum ZPIOPriority {
+  kIOCatchUp = 0,  // binlog sent to slaves far behind
+  kIODBSync = 1,
+  kIOBgsave = 2,
+  kIOPurge = 3,
+  kIOPriorityNum = 4,
+};
+
+/**
+ * ZPIOScheduler
+ * Budget of background io shared by the whole node.
+ * Every request reserve its time on the budget, a higher priority one
+ * start right after the reservations of the same or higher priority,
+ * and push the lower ones back, those already sleeping are not preempted.
+ * The budget adapt to foreground latency like AIMD
+ */
+class ZPIOScheduler {
+ public:
+  ZPIOScheduler(int64_t bytes_per_second, uint64_t latency_target_us);
+
+  // Block until bytes could be read or written
+  void Request(ZPIOPriority pri, int64_t bytes);
+  // Charge without blocking, return micros the caller should
+  // wait before its next io
+  uint64_t Reserve(ZPIOPriority pri, int64_t bytes);
+  // Requests of pri go no faster than bytes_per_second even if the
+  // budget allow, 0 for no cap
+  void SetCap(ZPIOPriority pri, int64_t bytes_per_second);
+
+  // Latency of one foreground command
+  void RecordForeground(uint64_t latency_us);
+  // Adjust budget by foreground latency since last call
+  void Adjust();
+
+  int64_t bytes_per_second();
+
+ private:
+  slash::Mutex mutex_;
+  const int64_t max_rate_;
+  const int64_t step_;
+  int64_t rate_;
+  uint64_t next_us_[kIOPriorityNum];  // when the next one could start
+  int64_t cap_[kIOPriorityNum];
+  const uint64_t latency_target_us_;
+  std::atomic<uint64_t> fg_total_;
+  std::atomic<uint64_t> fg_slow_;
+
+  ZPIOScheduler(const ZPIOScheduler&);
+  void operator=(const ZPIOScheduler&);
+};
+
+#endif
@@ -135,13 +135,26 @@ pink::Status ZPMetacmdBGWorker::ParsePullResponse(
         continue;
       }
       std::set<Node> slave_nodes;
+      std::vector<Node> chain_nodes;
       for (int j = 0; j < partition.slaves_size(); j++) {
-        slave_nodes.insert(Node(partition.slaves(j).ip(),
-              partition.slaves(j).port()));
+        Node slave(partition.slaves(j).ip(), partition.slaves(j).port());
+        slave_nodes.insert(slave);
+        if (partition.chain()) {
+          chain_nodes.push_back(slave);
+        }
+      }
+      // Learners are fed like slaves, by the tail if chain is on,
+      // meta never promote them to master
+      for (int j = 0; j < partition.learners_size(); j++) {
+        Node learner(partition.learners(j).ip(), partition.learners(j).port());
+        slave_nodes.insert(learner);
+        if (partition.chain()) {
+          chain_nodes.push_back(learner);
+        }
       }
 
       bool result = table->UpdateOrAddPartition(partition.id(),
-          partition.state(), master_node, slave_nodes);
+          partition.state(), master_node, slave_nodes, chain_nodes);
       if (!result) {
         LOG(WARNING) << "Failed to AddPartition " << partition.id()
           << ", State: " << static_cast<int>(partition.state())
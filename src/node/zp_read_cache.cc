@@ -0,0 +1,140 @@
+#include "src/node/zp_read_cache.h"
+
+#include <functional>
+
+#include "slash/include/env.h"
+
+static size_t EntryCharge(const std::string& key, const std::string& value) {
+  return key.size() + value.size();
+}
+
+ZPReadCache::ZPReadCache(size_t capacity)
+  : shard_capacity_(capacity / kReadCacheShards) {
+    for (int i = 0; i < kReadCacheShards; i++) {
+      shards_[i].epoch = 0;
+      shards_[i].usage = 0;
+      shards_[i].hand = 0;
+    }
+  }
+
+ZPReadCache::Shard* ZPReadCache::GetShard(const std::string& key) {
+  return &shards_[std::hash<std::string>()(key) % kReadCacheShards];
+}
+
+bool ZPReadCache::Lookup(const std::string& key, std::string* value,
+    uint64_t* epoch) {
+  Shard* shard = GetShard(key);
+  slash::MutexLock l(&shard->mutex);
+  *epoch = shard->epoch;
+  auto iter = shard->index.find(key);
+  if (iter == shard->index.end()) {
+    return false;
+  }
+  Entry& entry = shard->slots[iter->second];
+  if (entry.expire_us != 0 && entry.expire_us <= slash::NowMicros()) {
+    Remove(shard, iter->second);
+    return false;
+  }
+  entry.referenced = true;
+  value->assign(entry.value);
+  return true;
+}
+
+void ZPReadCache::Fill(const std::string& key, const std::string& value,
+    uint64_t epoch) {
+  Shard* shard = GetShard(key);
+  slash::MutexLock l(&shard->mutex);
+  if (shard->epoch != epoch || shard->index.count(key)) {
+    return;
+  }
+  Insert(shard, key, value, slash::NowMicros() + kReadCacheMaxAge * 1000);
+}
+
+void ZPReadCache::Update(const std::string& key, const std::string& value,
+    int32_t ttl) {
+  Shard* shard = GetShard(key);
+  slash::MutexLock l(&shard->mutex);
+  shard->epoch++;
+  auto iter = shard->index.find(key);
+  if (iter == shard->index.end()) {
+    return;
+  }
+  Remove(shard, iter->second);
+  Insert(shard, key, value,
+      ttl > 0 ? slash::NowMicros() + static_cast<uint64_t>(ttl) * 1000000 : 0);
+}
+
+void ZPReadCache::Erase(const std::string& key) {
+  Shard* shard = GetShard(key);
+  slash::MutexLock l(&shard->mutex);
+  shard->epoch++;
+  auto iter = shard->index.find(key);
+  if (iter != shard->index.end()) {
+    Remove(shard, iter->second);
+  }
+}
+
+void ZPReadCache::Clear() {
+  for (int i = 0; i < kReadCacheShards; i++) {
+    Shard* shard = &shards_[i];
+    slash::MutexLock l(&shard->mutex);
+    shard->epoch++;
+    shard->usage = 0;
+    shard->hand = 0;
+    shard->slots.clear();
+    shard->free_slots.clear();
+    shard->index.clear();
+  }
+}
+
+void ZPReadCache::Insert(Shard* shard, const std::string& key,
+    const std::string& value, uint64_t expire_us) {
+  size_t charge = EntryCharge(key, value);
+  if (charge > shard_capacity_) {
+    return;
+  }
+
+  // CLOCK, the referenced ones get a second chance
+  while (shard->usage + charge > shard_capacity_) {
+    if (shard->hand >= shard->slots.size()) {
+      shard->hand = 0;
+    }
+    Entry& entry = shard->slots[shard->hand];
+    if (entry.used) {
+      if (entry.referenced) {
+        entry.referenced = false;
+      } else {
+        Remove(shard, shard->hand);
+      }
+    }
+    shard->hand++;
+  }
+
+  size_t slot = 0;
+  if (!shard->free_slots.empty()) {
+    slot = shard->free_slots.back();
+    shard->free_slots.pop_back();
+  } else {
+    slot = shard->slots.size();
+    shard->slots.push_back(Entry());
+  }
+  Entry& entry = shard->slots[slot];
+  entry.key = key;
+  entry.value = value;
+  entry.expire_us = expire_us;
+  entry.referenced = false;
+  entry.used = true;
+  shard->usage += charge;
+  shard->index[key] = slot;
+}
+
+void ZPReadCache::Remove(Shard* shard, size_t slot) {
+  Entry& entry = shard->slots[slot];
+  shard->usage -= EntryCharge(entry.key, entry.value);
+  shard->index.erase(entry.key);
+  entry.used = false;
+  entry.referenced = false;
+  std::string().swap(entry.key);
+  std::string().swap(entry.value);
+  shard->free_slots.push_back(slot);
+}
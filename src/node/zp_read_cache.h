@@ -0,0 +1,63 @@
+#ifndef ZP_READ_CACHE_H
+#define ZP_READ_CACHE_H
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "slash/include/slash_mutex.h"
+#include "include/zp_const.h"
+
+/**
+ * ZPReadCache
+ * Values of hot keys of one partition, evicted by CLOCK in every shard.
+ * Writes erase or update the key synchronously, and make the fill of
+ * reads begin before them give up, so that no stale value is cached.
+ * The ttl of a value read from db is unknown, it live no longer than
+ * kReadCacheMaxAge, while the one updated by write know its ttl
+ */
+class ZPReadCache {
+ public:
+  explicit ZPReadCache(size_t capacity);
+
+  // Return false if missed, with epoch to fill the value read from db
+  bool Lookup(const std::string& key, std::string* value, uint64_t* epoch);
+  // Cache the value read from db if no write on the shard since Lookup
+  void Fill(const std::string& key, const std::string& value, uint64_t epoch);
+  // Update if cached, ttl in seconds, 0 for never expire
+  void Update(const std::string& key, const std::string& value, int32_t ttl);
+  void Erase(const std::string& key);
+  void Clear();
+
+ private:
+  struct Entry {
+    std::string key;
+    std::string value;
+    uint64_t expire_us;
+    bool referenced;
+    bool used;
+  };
+
+  struct Shard {
+    slash::Mutex mutex;
+    uint64_t epoch;  // bumped by every write
+    size_t usage;
+    size_t hand;
+    std::vector<Entry> slots;
+    std::vector<size_t> free_slots;
+    std::unordered_map<std::string, size_t> index;
+  };
+
+  const size_t shard_capacity_;
+  Shard shards_[kReadCacheShards];
+
+  Shard* GetShard(const std::string& key);
+  // Required: hold mutex of shard
+  void Insert(Shard* shard, const std::string& key, const std::string& value,
+      uint64_t expire_us);
+  void Remove(Shard* shard, size_t slot);
+
+  ZPReadCache(const ZPReadCache&);
+  void operator=(const ZPReadCache&);
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "src/node/zp_repl_history.h"
+
+#include <fstream>
+#include <random>
+#include <glog/logging.h>
+
+#include "slash/include/env.h"
+#include "include/zp_const.h"
+
+static std::string NewReplId() {
+  static std::random_device rd;
+  static std::mt19937_64 gen(rd());
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%016llx",
+      static_cast<unsigned long long>(gen()));
+  return std::string(buf);
+}
+
+ReplHistory::ReplHistory(const std::string& path)
+  : path_(path) {
+  }
+
+Status ReplHistory::Load() {
+  slash::MutexLock l(&mutex_);
+  terms_.clear();
+  if (!slash::FileExists(path_)) {
+    // No history yet
+    return Status::OK();
+  }
+
+  std::ifstream is(path_);
+  if (!is) {
+    return Status::IOError("Failed to open repl history", path_);
+  }
+  ReplTerm term;
+  while (is >> term.repl_id >> term.filenum >> term.offset) {
+    terms_.push_back(term);
+  }
+  if (!is.eof()) {
+    terms_.clear();
+    return Status::Corruption("Invalid repl history", path_);
+  }
+  return Status::OK();
+}
+
+// Required: hold mutex_
+Status ReplHistory::Save() {
+  std::string tmp_path = path_ + ".tmp";
+  std::ofstream out(tmp_path, std::ios::out | std::ios::trunc);
+  if (!out.is_open()) {
+    return Status::IOError("Failed to open repl history", tmp_path);
+  }
+  for (auto& term : terms_) {
+    out << term.repl_id << " " << term.filenum << " " << term.offset << "\n";
+  }
+  out.close();
+  if (!out) {
+    return Status::IOError("Failed to write repl history", tmp_path);
+  }
+  if (slash::RenameFile(tmp_path.c_str(), path_.c_str()) != 0) {
+    return Status::IOError("Failed to rename repl history", path_);
+  }
+  return Status::OK();
+}
+
+Status ReplHistory::NewTerm(uint32_t filenum, uint64_t offset,
+    ReplTerm* term) {
+  slash::MutexLock l(&mutex_);
+  terms_.push_back(ReplTerm(NewReplId(), filenum, offset));
+  if (terms_.size() > kReplHistoryMaxTerms) {
+    // Slaves behind the oldest term fall back to the offset checking
+    terms_.erase(terms_.begin(),
+        terms_.begin() + (terms_.size() - kReplHistoryMaxTerms));
+  }
+  *term = terms_.back();
+  return Save();
+}
+
+Status ReplHistory::Reset(const std::vector<ReplTerm>& terms) {
+  slash::MutexLock l(&mutex_);
+  terms_ = terms;
+  return Save();
+}
+
+std::string ReplHistory::current_id() {
+  slash::MutexLock l(&mutex_);
+  if (terms_.empty()) {
+    return std::string();
+  }
+  return terms_.back().repl_id;
+}
+
+std::vector<ReplTerm> ReplHistory::terms() {
+  slash::MutexLock l(&mutex_);
+  return terms_;
+}
+
+Status ReplHistory::TermEnd(const std::string& repl_id,
+    uint32_t* filenum, uint64_t* offset) {
+  slash::MutexLock l(&mutex_);
+  for (size_t i = 0; i < terms_.size(); i++) {
+    if (terms_[i].repl_id != repl_id) {
+      continue;
+    }
+    if (i + 1 == terms_.size()) {
+      return Status::Complete("Current term");
+    }
+    *filenum = terms_[i + 1].filenum;
+    *offset = terms_[i + 1].offset;
+    return Status::OK();
+  }
+  return Status::NotFound("Unknown repl id");
+}
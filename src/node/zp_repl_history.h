@@ -0,0 +1,57 @@
+#ifndef ZP_REPL_HISTORY_H
+#define ZP_REPL_HISTORY_H
+#include <string>
+#include <vector>
+
+#include "slash/include/slash_status.h"
+#include "slash/include/slash_mutex.h"
+
+using slash::Status;
+
+// One master term of a partition, which begin at filenum and offset
+struct ReplTerm {
+  std::string repl_id;
+  uint32_t filenum;
+  uint64_t offset;
+  ReplTerm() : filenum(0), offset(0) {}
+  ReplTerm(const std::string& id, uint32_t num, uint64_t off)
+    : repl_id(id), filenum(num), offset(off) {}
+};
+
+/**
+ * ReplHistory
+ * Master terms of one partition in time order, the last one is current.
+ * Binlog of all the replicas are byte aligned within one term,
+ * so the begin of a term is exactly where its previous one end,
+ * and any position before it is valid in every node who has the history
+ */
+class ReplHistory {
+ public:
+  explicit ReplHistory(const std::string& path);
+
+  Status Load();
+  // Begin a new term with random repl id at filenum and offset
+  Status NewTerm(uint32_t filenum, uint64_t offset, ReplTerm* term);
+  // Replace all with the history from master
+  Status Reset(const std::vector<ReplTerm>& terms);
+
+  std::string current_id();
+  std::vector<ReplTerm> terms();
+
+  // Find where the term with repl_id end
+  // Return NotFound if the repl_id is unknown
+  // Return Complete if it's the current term, which has no end yet
+  Status TermEnd(const std::string& repl_id,
+      uint32_t* filenum, uint64_t* offset);
+
+ private:
+  std::string path_;
+  slash::Mutex mutex_;
+  std::vector<ReplTerm> terms_;
+  Status Save();
+
+  ReplHistory(const ReplHistory&);
+  void operator=(const ReplHistory&);
+};
+
+#endif
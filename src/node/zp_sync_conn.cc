@@ -1,6 +1,7 @@
 #include "src/node/zp_sync_conn.h"
 
 #include <glog/logging.h>
+#include "include/zp_const.h"
 #include "src/node/zp_data_server.h"
 //#include "src/node/zp_data_partition.h"
 
@@ -57,6 +58,51 @@ int ZPSyncConn::DealMessage() {
   // do not reply
   set_is_reply(false);
 
+  if (request_.sync_type() == client::SyncType::ACK) {
+    // Receive credits granted from slave, no need to dispatch
+    const client::BinlogAck& back = request_.binlog_ack();
+    Status s = zp_data_server->GrantBinlogSendCredit(back.table_name(),
+        back.partition_id(),
+        Node(request_.from().ip(), request_.from().port() + kPortShiftSync),
+        back.credits());
+    if (!s.ok()) {
+      DLOG(INFO) << "Ignore binlog ack from: (" << request_.from().ip()
+        << ", " << request_.from().port() << "), table: " << back.table_name()
+        << ", partition: " << back.partition_id() << ", " << s.ToString();
+    }
+    return 0;
+  }
+
+  if (request_.sync_type() == client::SyncType::RESYNC) {
+    // Slave find a gap, seek the send task back to its offset
+    const client::BinlogResync& back = request_.binlog_resync();
+    Status s = zp_data_server->ResyncBinlogSendTask(back.table_name(),
+        back.partition_id(),
+        Node(request_.from().ip(), request_.from().port() + kPortShiftSync),
+        request_.sync_offset().filenum(),
+        request_.sync_offset().offset());
+    if (!s.ok()) {
+      LOG(WARNING) << "Ignore binlog resync from: (" << request_.from().ip()
+        << ", " << request_.from().port() << "), table: " << back.table_name()
+        << ", partition: " << back.partition_id() << ", " << s.ToString();
+    }
+    return 0;
+  }
+
+  if (request_.sync_type() == client::SyncType::HEARTBEAT) {
+    // Upstream has nothing more to send, no need to dispatch
+    const client::BinlogHeartbeat& beat = request_.binlog_heartbeat();
+    std::shared_ptr<Partition> partition =
+      zp_data_server->GetTablePartitionById(beat.table_name(), beat.partition_id());
+    if (partition != NULL) {
+      partition->ReceiveHeartbeat(
+          slash::IpPortString(request_.from().ip(), request_.from().port()),
+          request_.sync_offset().filenum(),
+          request_.sync_offset().offset());
+    }
+    return 0;
+  }
+
   ZPBinlogReceiveTask *arg = NULL;
   if (request_.sync_type() == client::SyncType::SKIP) {
     // Receive a binlog skip request
@@ -69,14 +115,17 @@ int ZPSyncConn::DealMessage() {
         slash::IpPortString(request_.from().ip(), request_.from().port()),
         request_.sync_offset().filenum(),
         request_.sync_offset().offset());
+    if (request_.has_head()) {
+      option.SetHead(request_.head().filenum(), request_.head().offset());
+    }
 
     arg = new ZPBinlogReceiveTask(
         option,
         bskip.gap());
 
   } else if (request_.sync_type() == client::SyncType::CMD) {
-    // Receive a cmd request
-    client::CmdRequest crequest = request_.request();
+    // Receive a cmd request, moved to the task later without copy
+    client::CmdRequest& crequest = *request_.mutable_request();
     DebugReceive(crequest);
 
 
@@ -86,27 +135,32 @@ int ZPSyncConn::DealMessage() {
       return -1;
     }
 
+    RequestContext context;
+    cmd->ExtractContext(&crequest, &context);
+
     DLOG(INFO) << "Receive sync cmd: " << cmd->name()
-      << ", table=" << cmd->ExtractTable(&crequest)
-      << " key=" << cmd->ExtractKey(&crequest);
+      << ", table=" << *context.table
+      << " key=" << *context.key;
 
-    std::string table_name = cmd->ExtractTable(&crequest);
-    zp_data_server->PlusStat(StatType::kSync, table_name);
+    zp_data_server->PlusStat(StatType::kSync, *context.table);
     
-    int partition_id = zp_data_server->KeyToPartition(table_name, cmd->ExtractKey(&crequest));
+    int partition_id = zp_data_server->ContextToPartition(context);
     if (partition_id < 0) {
-      LOG(ERROR) << "SyncConn Receive unknow table: " << table_name;
+      LOG(ERROR) << "SyncConn Receive unknow table: " << *context.table;
       return -1;
     }
 
     PartitionSyncOption option(
         request_.sync_type(),
-        cmd->ExtractTable(&crequest),
-        ((cmd->ExtractPartition(&crequest) >= 0 )
-         ? cmd->ExtractPartition(&crequest) : partition_id),
+        *context.table,
+        partition_id,
         slash::IpPortString(request_.from().ip(), request_.from().port()),
         request_.sync_offset().filenum(),
         request_.sync_offset().offset());
+    if (request_.has_head()) {
+      option.SetHead(request_.head().filenum(), request_.head().offset());
+    }
+    option.item_len = request_.item_len();
 
     // We need to malloc for args need by binglog_bgworker
     // So that it will not be free after the executing of current function
@@ -114,7 +168,7 @@ int ZPSyncConn::DealMessage() {
     arg = new ZPBinlogReceiveTask(
         option,
         cmd,
-        crequest);
+        &crequest);
   } else {
     LOG(ERROR) << "Unknow Sync Request Type: " << static_cast<int>(request_.sync_type());
     return -1;
@@ -1,14 +1,13 @@
 #include "src/node/zp_trysync_thread.h"
 
 #include <glog/logging.h>
-#include "slash/include/rsync.h"
+#include "slash/include/env.h"
 #include "src/node/zp_data_server.h"
 #include "src/node/zp_data_partition.h"
 
 extern ZPDataServer* zp_data_server;
 
-ZPTrySyncThread::ZPTrySyncThread():
-  rsync_flag_(0) {
+ZPTrySyncThread::ZPTrySyncThread() {
     bg_thread_ = new pink::BGThread();
     bg_thread_->set_thread_name("ZPDataTrySync");
 }
@@ -20,7 +19,6 @@ ZPTrySyncThread::~ZPTrySyncThread() {
     kv.second->Close();
     delete kv.second;
   }
-  slash::StopRsync(zp_data_server->db_sync_path());
   LOG(INFO) << " TrySync thread " << pthread_self() << " exit!!!";
 }
 
@@ -28,37 +26,133 @@ void ZPTrySyncThread::TrySyncTaskSchedule(const std::string& table,
     int partition_id, uint64_t delay) {
   slash::MutexLock l(&bg_thread_protector_);
   bg_thread_->StartThread();
-  TrySyncTaskArg *targ = new TrySyncTaskArg(this, table, partition_id);
+  uint64_t due = slash::NowMicros() + delay * 1000;
+  PartitionKey key(table, partition_id);
+  auto iter = pending_.find(key);
+  if (iter != pending_.end() && iter->second <= due) {
+    // Will be handled earlier
+    return;
+  }
+  pending_[key] = due;
+
+  // Every task handle all partitions due at that time
   if (delay == 0) { // no delay
-    bg_thread_->Schedule(&DoTrySyncTask, static_cast<void*>(targ));
+    bg_thread_->Schedule(&DoTrySyncTask, static_cast<void*>(this));
   } else {
-    bg_thread_->DelaySchedule(delay, &DoTrySyncTask, static_cast<void*>(targ));
+    bg_thread_->DelaySchedule(delay, &DoTrySyncTask, static_cast<void*>(this));
   }
 }
 
 void ZPTrySyncThread::DoTrySyncTask(void* arg) {
-  TrySyncTaskArg* targ = static_cast<TrySyncTaskArg*>(arg);
-  (targ->thread)->TrySyncTask(targ->table_name, targ->partition_id);
-  delete targ;
+  (static_cast<ZPTrySyncThread*>(arg))->TrySyncTask();
 }
 
-void ZPTrySyncThread::TrySyncTask(const std::string& table_name, int partition_id) {
-  
-  if (!zp_data_server->Availible() // server is not availible now
-      || !SendTrySync(table_name, partition_id)) {
+void ZPTrySyncThread::TrySyncTask() {
+  std::vector<PartitionKey> keys;
+  {
+    slash::MutexLock l(&bg_thread_protector_);
+    uint64_t now = slash::NowMicros();
+    auto iter = pending_.begin();
+    while (iter != pending_.end()) {
+      if (iter->second <= now) {
+        keys.push_back(iter->first);
+        iter = pending_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+  if (keys.empty()) {
+    return;
+  }
+
+  std::vector<PartitionKey> retry;
+  if (!zp_data_server->Availible()) { // server is not availible now
+    retry = keys;
+  } else {
+    // Group by master
+    std::map<std::string, TrySyncBatch> batches;
+    for (auto& key : keys) {
+      std::shared_ptr<Partition> partition;
+      if (!PrepareTrySync(key.first, key.second, &partition)) {
+        retry.push_back(key);
+        continue;
+      }
+      if (!partition) {
+        continue;
+      }
+      Node master_node = partition->upstream_node();
+      TrySyncBatch& batch =
+        batches[slash::IpPortString(master_node.ip, master_node.port)];
+      batch.master = master_node;
+      batch.partitions.push_back(partition);
+    }
+
+    // Send to all masters first, so that they work at the same time
+    for (auto& kv : batches) {
+      if (!ShouldBatch(kv.second.master)) {
+        TrySyncOneByOne(&kv.second, &retry);
+        continue;
+      }
+      if (!SendBatch(&kv.second)) {
+        for (auto& partition : kv.second.partitions) {
+          retry.push_back(PartitionKey(partition->table_name(),
+                partition->partition_id()));
+        }
+      }
+    }
+    for (auto& kv : batches) {
+      if (kv.second.cli != NULL) {
+        RecvBatch(&kv.second, &retry);
+      }
+    }
+  }
+
+  for (auto& key : retry) {
     // Need one more trysync, since error happenning or waiting for db sync
     LOG(WARNING) << "SendTrySync delay " << kTrySyncInterval
-      << "(ms) to ReSchedule for table:" << table_name
-      << ", partition:" << partition_id << ",  meta_epoch:" << zp_data_server->meta_epoch();
-    zp_data_server->AddSyncTask(table_name, partition_id, kTrySyncInterval);
+      << "(ms) to ReSchedule for table:" << key.first
+      << ", partition:" << key.second << ",  meta_epoch:" << zp_data_server->meta_epoch();
+    zp_data_server->AddSyncTask(key.first, key.second, kTrySyncInterval);
   }
 }
 
-bool ZPTrySyncThread::Send(std::shared_ptr<Partition> partition, pink::PinkCli* cli) {
-  // Generate Request 
-  client::CmdRequest request;
-  client::CmdRequest_Sync* sync = request.mutable_sync();
-  request.set_type(client::Type::SYNC);
+/*
+ * Return false if one more trysync is needed,
+ * partition is set only if it should be sent to master now
+ */
+bool ZPTrySyncThread::PrepareTrySync(const std::string& table_name,
+    int partition_id, std::shared_ptr<Partition>* ptr) {
+  std::shared_ptr<Partition> partition =
+    zp_data_server->GetTablePartitionById(table_name, partition_id);
+  if (!partition
+      || !partition->opened()) {
+    // Partition maybe deleted or closed, no need to rescheule again
+    DLOG(INFO) << "SendTrySync closed or deleted Partition " << table_name << "_" << partition_id;
+    return true;
+  }
+
+  if (partition->ShouldWaitDBSync()) {
+    if (!partition->TryUpdateMasterOffset()) {
+      return false;
+    }
+    partition->WaitDBSyncDone();
+    LOG(INFO) << "Success Update Master Offset for Partition "
+      << partition->table_name() << "_" << partition->partition_id();
+  }
+
+  if (!partition->ShouldTrySync()) {
+    // Return true so that the trysync will not be reschedule
+    return true;
+  }
+
+  slash::CreatePath(partition->sync_path());
+  *ptr = partition;
+  return true;
+}
+
+void ZPTrySyncThread::FillSync(std::shared_ptr<Partition> partition,
+    client::CmdRequest_Sync* sync) {
   client::Node* node = sync->mutable_node();
   node->set_ip(zp_data_server->local_ip());
   node->set_port(zp_data_server->local_port());
@@ -71,44 +165,205 @@ bool ZPTrySyncThread::Send(std::shared_ptr<Partition> partition, pink::PinkCli*
   sync_offset->set_partition(partition->partition_id());
   sync_offset->set_filenum(filenum);
   sync_offset->set_offset(offset);
-
-  // Send through client
-  slash::Status s = cli->Send(&request);
+  sync->set_repl_id(partition->ReplId());
   DLOG(INFO) << "TrySync: Partition " << partition->table_name() << "_"
     << partition->partition_id() << " with SyncPoint ("
     << sync->node().ip() << ":" << sync->node().port()
     << ", " << filenum << ", " << offset << ")";
+}
+
+bool ZPTrySyncThread::SendBatch(TrySyncBatch* batch) {
+  pink::PinkCli* cli = GetConnection(batch->master);
+  DLOG(INFO) << "TrySync connect(" << batch->master.ip << ":"
+    << batch->master.port << ") " << (cli != NULL ? "ok" : "failed")
+    << ", partition count: " << batch->partitions.size();
+  if (cli == NULL) {
+    LOG(WARNING) << "TrySyncThread Connect failed ("
+      << batch->master.ip << ":" << batch->master.port << ")";
+    return false;
+  }
+  cli->set_send_timeout(1000);
+  cli->set_recv_timeout(kTrySyncBatchTimeout
+      + kTrySyncBatchPartitionTimeout * batch->partitions.size());
+
+  // Generate Request
+  client::CmdRequest request;
+  request.set_type(client::Type::MSYNC);
+  for (auto& partition : batch->partitions) {
+    FillSync(partition, request.mutable_msync()->add_syncs());
+  }
+
+  // Send through client
+  slash::Status s = cli->Send(&request);
   if (!s.ok()) {
-    LOG(WARNING) << "TrySync send failed, Partition " << partition->table_name()
-      << "_" << partition->partition_id() << ", caz " << s.ToString();
+    LOG(WARNING) << "TrySyncThread Send failed ("
+      << batch->master.ip << ":" << batch->master.port << "), caz " << s.ToString();
+    DropConnection(batch->master);
     return false;
   }
+  batch->cli = cli;
   return true;
 }
 
-bool ZPTrySyncThread::Recv(std::shared_ptr<Partition> partition, pink::PinkCli* cli,
-    RecvResult* res) {
-  // Recv from client
+void ZPTrySyncThread::RecvBatch(TrySyncBatch* batch,
+    std::vector<PartitionKey>* retry) {
   client::CmdResponse response;
-  Status result = cli->Recv(&response); 
-  if (!result.ok()) {
-    LOG(WARNING) << "TrySync recv failed, Partition:"
-      << partition->partition_id() << ", caz " << result.ToString();
+  Status s = batch->cli->Recv(&response);
+  if (!s.ok()) {
+    // Timeout or unparsable, master may not support MSYNC
+    LOG(WARNING) << "TrySyncThread Recv failed ("
+      << batch->master.ip << ":" << batch->master.port << "), caz "
+      << s.ToString() << ", try SYNC instead";
+    DropConnection(batch->master);
+    no_batch_until_[slash::IpPortString(batch->master.ip, batch->master.port)]
+      = slash::NowMicros() + kTrySyncNoBatchTime * 1000000ULL;
+    TrySyncOneByOne(batch, retry);
+    return;
+  }
+
+  if (response.code() != client::StatusCode::kOk
+      || response.msync_size() != static_cast<int>(batch->partitions.size())) {
+    // Master may not support MSYNC, try one by one
+    LOG(WARNING) << "TrySyncThread MSYNC failed ("
+      << batch->master.ip << ":" << batch->master.port << "), Msg: "
+      << response.msg() << ", try SYNC instead";
+    no_batch_until_[slash::IpPortString(batch->master.ip, batch->master.port)]
+      = slash::NowMicros() + kTrySyncNoBatchTime * 1000000ULL;
+    TrySyncOneByOne(batch, retry);
+    return;
+  }
+
+  for (int i = 0; i < response.msync_size(); i++) {
+    std::shared_ptr<Partition> partition = batch->partitions[i];
+    RecvResult res;
+    ParseResult(response.msync(i), &res);
+    if (!HandleResult(partition, res)) {
+      retry->push_back(PartitionKey(partition->table_name(),
+            partition->partition_id()));
+    }
+  }
+}
+
+bool ZPTrySyncThread::ShouldBatch(const Node& master) {
+  auto iter = no_batch_until_.find(slash::IpPortString(master.ip, master.port));
+  if (iter == no_batch_until_.end()) {
+    return true;
+  }
+  if (iter->second <= slash::NowMicros()) {
+    // Maybe upgraded, try MSYNC again
+    no_batch_until_.erase(iter);
+    return true;
+  }
+  return false;
+}
+
+// SYNC the partitions of batch one by one, stop connecting once
+// master is unreachable, the rest wait for the next round
+void ZPTrySyncThread::TrySyncOneByOne(TrySyncBatch* batch,
+    std::vector<PartitionKey>* retry) {
+  bool reachable = true;
+  for (auto& partition : batch->partitions) {
+    if (reachable) {
+      reachable = GetConnection(batch->master) != NULL;
+    }
+    if (!reachable || !SendTrySync(partition)) {
+      retry->push_back(PartitionKey(partition->table_name(),
+            partition->partition_id()));
+    }
+  }
+}
+
+/*
+ * Single partition SYNC, return false if one more trysync is needed
+ */
+bool ZPTrySyncThread::SendTrySync(std::shared_ptr<Partition> partition) {
+  Node master_node = partition->upstream_node();
+  pink::PinkCli* cli = GetConnection(master_node);
+  if (cli == NULL) {
+    LOG(WARNING) << "TrySyncThread Connect failed (" 
+      << partition->table_name() << "_" << partition->partition_id()
+      << "_" << master_node.ip << ":" << master_node.port << ")";
     return false;
   }
+  cli->set_send_timeout(1000);
+  cli->set_recv_timeout(1000);
 
+  client::CmdRequest request;
+  request.set_type(client::Type::SYNC);
+  FillSync(partition, request.mutable_sync());
+  client::CmdResponse response;
+  slash::Status s = cli->Send(&request);
+  if (s.ok()) {
+    s = cli->Recv(&response);
+  }
+  if (!s.ok()) {
+    LOG(WARNING) << "TrySyncThread Send or Recv failed, " 
+      << partition->table_name() << "_" << partition->partition_id()
+      << "_" << master_node.ip << ":" << master_node.port << "), caz "
+      << s.ToString();
+    DropConnection(master_node);
+    return false;
+  }
+
+  RecvResult res;
+  ParseResult(response, &res);
+  return HandleResult(partition, res);
+}
+
+void ZPTrySyncThread::ParseResult(const client::CmdResponse& response,
+    RecvResult* res) {
   res->code = response.code();
   res->message = response.msg();
+  res->filenum = 0;
+  res->offset = 0;
   if (response.type() != client::Type::SYNC) {
-    LOG(WARNING) << "TrySync recv error type reponse, Partition:"
-      << partition->partition_id();
-    return false;
+    res->code = client::StatusCode::kError;
+    res->message = "error type reponse";
+    return;
   }
   if (response.has_sync())  {
     res->filenum = response.sync().sync_offset().filenum();
     res->offset = response.sync().sync_offset().offset();
+    for (int i = 0; i < response.sync().repl_history_size(); i++) {
+      const client::ReplTerm& term = response.sync().repl_history(i);
+      res->history.push_back(ReplTerm(term.repl_id(),
+            term.begin().filenum(), term.begin().offset()));
+    }
   }
-  return true;
+}
+
+/*
+ * Return false if one more trysync is needed
+ */
+bool ZPTrySyncThread::HandleResult(std::shared_ptr<Partition> partition,
+    const RecvResult& res) {
+  Status s;
+  switch (res.code) {
+    case client::StatusCode::kOk:
+      // Follow master's history from now on
+      partition->AdoptReplHistory(res.history);
+      partition->TrySyncDone();
+      return true;
+    case client::StatusCode::kFallback:
+      LOG(INFO) << "Receive sync offset fallback to : "
+        << res.filenum << "_" << res.offset;
+      s = partition->SetBinlogOffsetWithLock(res.filenum, res.offset);
+      if (!s.ok()) {
+        LOG(WARNING) << "Set sync offset fallback to : "
+          << res.filenum << "_" << res.offset
+          << ", Faliled: " << s.ToString();
+      }
+      break;
+    case client::StatusCode::kWait:
+      LOG(INFO) << "Receive wait dbsync wait";
+      partition->SetWaitDBSync();
+      break;
+    default:
+      LOG(WARNING) << "TrySyncThread failed, " 
+        << partition->table_name() << "_" << partition->partition_id()
+        << ", Msg: " << res.message;
+  }
+  return false;
 }
 
 pink::PinkCli* ZPTrySyncThread::GetConnection(const Node& node) {
@@ -143,121 +398,3 @@ void ZPTrySyncThread::DropConnection(const Node& node) {
     client_pool_.erase(iter);
   }
 }
-
-/*
- * Return false if one more trysync is needed
- */
-bool ZPTrySyncThread::SendTrySync(const std::string& table_name, int partition_id) {
-  std::shared_ptr<Partition> partition =
-    zp_data_server->GetTablePartitionById(table_name, partition_id);
-  if (!partition
-      || !partition->opened()) {
-    // Partition maybe deleted or closed, no need to rescheule again
-    DLOG(INFO) << "SendTrySync closed or deleted Partition " << table_name << "_" << partition_id;
-    return true;
-  }
-
-  if (partition->ShouldWaitDBSync()) {
-    if (!partition->TryUpdateMasterOffset()) {
-      return false;
-    }
-    partition->WaitDBSyncDone();
-    RsyncUnref();
-    LOG(INFO) << "Success Update Master Offset for Partition "
-      << partition->table_name() << "_" << partition->partition_id();
-  }
-
-  if (!partition->ShouldTrySync()) {
-    // Return true so that the trysync will not be reschedule
-    return true;
-  }
-
-  Node master_node = partition->master_node();
-  pink::PinkCli* cli = GetConnection(master_node);
-  DLOG(INFO) << "TrySync connect(" << partition->table_name() << "_"
-    << partition->partition_id() << "_" << master_node.ip << ":"
-    << master_node.port << ") " << (cli != NULL ? "ok" : "failed");
-  if (cli) {
-    cli->set_send_timeout(1000);
-    cli->set_recv_timeout(1000);
-
-    slash::CreatePath(partition->sync_path());
-    RsyncRef();
-    // Send && Recv
-    if (Send(partition, cli)) {
-      Status s;
-      RecvResult res;
-      if (Recv(partition, cli, &res)) {
-        switch (res.code) {
-          case client::StatusCode::kOk:
-            partition->TrySyncDone();
-            RsyncUnref();
-            return true;
-          case client::StatusCode::kFallback:
-            LOG(INFO) << "Receive sync offset fallback to : "
-              << res.filenum << "_" << res.offset;
-            s = partition->SetBinlogOffsetWithLock(res.filenum, res.offset);
-            if (!s.ok()) {
-              LOG(WARNING) << "Set sync offset fallback to : "
-                << res.filenum << "_" << res.offset
-                << ", Faliled: " << s.ToString();
-            }
-            break;
-          case client::StatusCode::kWait:
-            LOG(INFO) << "Receive wait dbsync wait";
-            RsyncRef(); // Keep the rsync deamon for sync file receive
-            partition->SetWaitDBSync();
-            break;
-          default:
-            LOG(WARNING) << "TrySyncThread failed, " 
-              << partition->table_name() << "_" << partition->partition_id()
-              << "_" << master_node.ip << ":" << master_node.port << "), Msg: "
-              << res.message;
-        }
-      } else {
-        LOG(WARNING) << "TrySyncThread Recv failed, " 
-          << partition->table_name() << "_" << partition->partition_id()
-          << "_" << master_node.ip << ":" << master_node.port << ")";
-        DropConnection(master_node);
-      }
-    } else {
-      LOG(WARNING) << "TrySyncThread Send failed, " 
-        << partition->table_name() << "_" << partition->partition_id()
-        << "_" << master_node.ip << ":" << master_node.port << ")";
-      DropConnection(master_node);
-    }
-    RsyncUnref();
-  } else {
-    LOG(WARNING) << "TrySyncThread Connect failed (" 
-      << partition->table_name() << "_" << partition->partition_id()
-      << "_" << master_node.ip << ":" << master_node.port << ")";
-  }
-  return false;
-}
-
-void ZPTrySyncThread::RsyncRef() {
-  assert(rsync_flag_ >= 0);
-  // Start Rsync
-  if (0 == rsync_flag_) {
-    slash::StopRsync(zp_data_server->db_sync_path());
-    std::string dbsync_path = zp_data_server->db_sync_path();
-
-    // We append the master ip port after module name
-    // To make sure only data from current master is received
-    int ret = slash::StartRsync(dbsync_path, kDBSyncModule,
-        zp_data_server->local_ip(), zp_data_server->local_port() + kPortShiftRsync);
-    if (0 != ret) {
-      LOG(WARNING) << "Failed to start rsync, path:" << dbsync_path << " error : " << ret;
-    }
-    LOG(INFO) << "Finish to start rsync, path:" << dbsync_path;
-  }
-  rsync_flag_++;
-}
-
-void ZPTrySyncThread::RsyncUnref() {
-  assert(rsync_flag_ >= 0);
-  rsync_flag_--;
-  if (0 == rsync_flag_) {
-    slash::StopRsync(zp_data_server->db_sync_path());
-  }
-}
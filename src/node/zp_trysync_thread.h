@@ -1,5 +1,7 @@
 #ifndef ZP_TRYSYNC_THREAD_H
 #define ZP_TRYSYNC_THREAD_H
+#include <map>
+#include <vector>
 #include "slash/include/slash_status.h"
 #include "slash/include/slash_mutex.h"
 #include "pink/include/pink_cli.h"
@@ -8,43 +10,60 @@
 #include "include/zp_const.h"
 #include "src/node/zp_data_partition.h"
 
+/**
+ * ZPTrySyncThread
+ * Partitions waiting for trysync are collected and handled in rounds,
+ * in one round partitions with the same master are sent in one MSYNC,
+ * and requests to all masters are sent before waiting for any response
+ */
 class ZPTrySyncThread {
  public:
   ZPTrySyncThread();
   virtual ~ZPTrySyncThread();
   void TrySyncTaskSchedule(const std::string& table,
       int partition_id, uint64_t delay = 0);
-  void TrySyncTask(const std::string& table_name, int partition_id);
+  void TrySyncTask();
 
  private:
+  typedef std::pair<std::string, int> PartitionKey;
+
   // BGThread related
-  struct TrySyncTaskArg {
-    ZPTrySyncThread* thread;
-    std::string table_name;
-    int partition_id;
-    TrySyncTaskArg(ZPTrySyncThread* t, const std::string& table, int id)
-        : thread(t), table_name(table), partition_id(id){}
-  };
   slash::Mutex bg_thread_protector_;
   pink::BGThread* bg_thread_;
+  // Partitions to trysync and when, protected by bg_thread_protector_
+  std::map<PartitionKey, uint64_t> pending_;
   static void DoTrySyncTask(void* arg);
-  bool SendTrySync(const std::string& table_name, int partition_id);
-  bool Send(std::shared_ptr<Partition> partition, pink::PinkCli* cli);
+
+  // Partitions with the same master in one round
+  struct TrySyncBatch {
+    Node master;
+    pink::PinkCli* cli;
+    std::vector<std::shared_ptr<Partition> > partitions;
+    TrySyncBatch() : cli(NULL) {}
+  };
+  bool PrepareTrySync(const std::string& table_name, int partition_id,
+      std::shared_ptr<Partition>* partition);
+  bool SendBatch(TrySyncBatch* batch);
+  void RecvBatch(TrySyncBatch* batch, std::vector<PartitionKey>* retry);
+  void TrySyncOneByOne(TrySyncBatch* batch, std::vector<PartitionKey>* retry);
+  // Masters not answering MSYNC, such as older version, and until when
+  std::map<std::string, uint64_t> no_batch_until_;
+  bool ShouldBatch(const Node& master);
+  bool SendTrySync(std::shared_ptr<Partition> partition);
+  void FillSync(std::shared_ptr<Partition> partition,
+      client::CmdRequest_Sync* sync);
   
   struct RecvResult {
     client::StatusCode code;
     std::string message;
     uint32_t filenum;
     uint64_t offset;
+    std::vector<ReplTerm> history;
   };
-  bool Recv(std::shared_ptr<Partition> partition, pink::PinkCli* cli,
-      RecvResult* res);
+  void ParseResult(const client::CmdResponse& response, RecvResult* res);
+  bool HandleResult(std::shared_ptr<Partition> partition,
+      const RecvResult& res);
 
-  // Rsync related
-  int rsync_flag_;
-  void RsyncRef();
-  void RsyncUnref();
-  
   // Connection related
   std::map<std::string, pink::PinkCli*> client_pool_;
   pink::PinkCli* GetConnection(const Node& node);
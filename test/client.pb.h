@@ -1,62 +1,213 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: client.proto
 
-#ifndef PROTOBUF_client_2eproto__INCLUDED
-#define PROTOBUF_client_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_client_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_client_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_client_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_client_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_client_2eproto;
 namespace client {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_client_2eproto();
-void protobuf_AssignDesc_client_2eproto();
-void protobuf_ShutdownFile_client_2eproto();
-
-class Node;
-class SyncOffset;
-class KeyExpire;
-class PartitionState;
+class BinlogAck;
+struct BinlogAckDefaultTypeInternal;
+extern BinlogAckDefaultTypeInternal _BinlogAck_default_instance_;
+class BinlogHeartbeat;
+struct BinlogHeartbeatDefaultTypeInternal;
+extern BinlogHeartbeatDefaultTypeInternal _BinlogHeartbeat_default_instance_;
+class BinlogResync;
+struct BinlogResyncDefaultTypeInternal;
+extern BinlogResyncDefaultTypeInternal _BinlogResync_default_instance_;
+class BinlogSkip;
+struct BinlogSkipDefaultTypeInternal;
+extern BinlogSkipDefaultTypeInternal _BinlogSkip_default_instance_;
 class CmdRequest;
-class CmdRequest_Sync;
-class CmdRequest_Set;
-class CmdRequest_Get;
+struct CmdRequestDefaultTypeInternal;
+extern CmdRequestDefaultTypeInternal _CmdRequest_default_instance_;
+class CmdRequest_Append;
+struct CmdRequest_AppendDefaultTypeInternal;
+extern CmdRequest_AppendDefaultTypeInternal _CmdRequest_Append_default_instance_;
 class CmdRequest_Del;
+struct CmdRequest_DelDefaultTypeInternal;
+extern CmdRequest_DelDefaultTypeInternal _CmdRequest_Del_default_instance_;
+class CmdRequest_Get;
+struct CmdRequest_GetDefaultTypeInternal;
+extern CmdRequest_GetDefaultTypeInternal _CmdRequest_Get_default_instance_;
+class CmdRequest_Incrby;
+struct CmdRequest_IncrbyDefaultTypeInternal;
+extern CmdRequest_IncrbyDefaultTypeInternal _CmdRequest_Incrby_default_instance_;
 class CmdRequest_Info;
+struct CmdRequest_InfoDefaultTypeInternal;
+extern CmdRequest_InfoDefaultTypeInternal _CmdRequest_Info_default_instance_;
+class CmdRequest_Mdel;
+struct CmdRequest_MdelDefaultTypeInternal;
+extern CmdRequest_MdelDefaultTypeInternal _CmdRequest_Mdel_default_instance_;
 class CmdRequest_Mget;
+struct CmdRequest_MgetDefaultTypeInternal;
+extern CmdRequest_MgetDefaultTypeInternal _CmdRequest_Mget_default_instance_;
+class CmdRequest_Mset;
+struct CmdRequest_MsetDefaultTypeInternal;
+extern CmdRequest_MsetDefaultTypeInternal _CmdRequest_Mset_default_instance_;
+class CmdRequest_Mset_Kv;
+struct CmdRequest_Mset_KvDefaultTypeInternal;
+extern CmdRequest_Mset_KvDefaultTypeInternal _CmdRequest_Mset_Kv_default_instance_;
+class CmdRequest_Msync;
+struct CmdRequest_MsyncDefaultTypeInternal;
+extern CmdRequest_MsyncDefaultTypeInternal _CmdRequest_Msync_default_instance_;
+class CmdRequest_Set;
+struct CmdRequest_SetDefaultTypeInternal;
+extern CmdRequest_SetDefaultTypeInternal _CmdRequest_Set_default_instance_;
+class CmdRequest_Subscribe;
+struct CmdRequest_SubscribeDefaultTypeInternal;
+extern CmdRequest_SubscribeDefaultTypeInternal _CmdRequest_Subscribe_default_instance_;
+class CmdRequest_Sync;
+struct CmdRequest_SyncDefaultTypeInternal;
+extern CmdRequest_SyncDefaultTypeInternal _CmdRequest_Sync_default_instance_;
 class CmdResponse;
-class CmdResponse_Sync;
+struct CmdResponseDefaultTypeInternal;
+extern CmdResponseDefaultTypeInternal _CmdResponse_default_instance_;
+class CmdResponse_Append;
+struct CmdResponse_AppendDefaultTypeInternal;
+extern CmdResponse_AppendDefaultTypeInternal _CmdResponse_Append_default_instance_;
 class CmdResponse_Get;
-class CmdResponse_InfoStats;
+struct CmdResponse_GetDefaultTypeInternal;
+extern CmdResponse_GetDefaultTypeInternal _CmdResponse_Get_default_instance_;
+class CmdResponse_Incrby;
+struct CmdResponse_IncrbyDefaultTypeInternal;
+extern CmdResponse_IncrbyDefaultTypeInternal _CmdResponse_Incrby_default_instance_;
 class CmdResponse_InfoCapacity;
+struct CmdResponse_InfoCapacityDefaultTypeInternal;
+extern CmdResponse_InfoCapacityDefaultTypeInternal _CmdResponse_InfoCapacity_default_instance_;
 class CmdResponse_InfoRepl;
-class CmdResponse_Mget;
+struct CmdResponse_InfoReplDefaultTypeInternal;
+extern CmdResponse_InfoReplDefaultTypeInternal _CmdResponse_InfoRepl_default_instance_;
 class CmdResponse_InfoServer;
-class BinlogSkip;
+struct CmdResponse_InfoServerDefaultTypeInternal;
+extern CmdResponse_InfoServerDefaultTypeInternal _CmdResponse_InfoServer_default_instance_;
+class CmdResponse_InfoStats;
+struct CmdResponse_InfoStatsDefaultTypeInternal;
+extern CmdResponse_InfoStatsDefaultTypeInternal _CmdResponse_InfoStats_default_instance_;
+class CmdResponse_KeyResult;
+struct CmdResponse_KeyResultDefaultTypeInternal;
+extern CmdResponse_KeyResultDefaultTypeInternal _CmdResponse_KeyResult_default_instance_;
+class CmdResponse_Mget;
+struct CmdResponse_MgetDefaultTypeInternal;
+extern CmdResponse_MgetDefaultTypeInternal _CmdResponse_Mget_default_instance_;
+class CmdResponse_Subscribe;
+struct CmdResponse_SubscribeDefaultTypeInternal;
+extern CmdResponse_SubscribeDefaultTypeInternal _CmdResponse_Subscribe_default_instance_;
+class CmdResponse_Subscribe_Record;
+struct CmdResponse_Subscribe_RecordDefaultTypeInternal;
+extern CmdResponse_Subscribe_RecordDefaultTypeInternal _CmdResponse_Subscribe_Record_default_instance_;
+class CmdResponse_Sync;
+struct CmdResponse_SyncDefaultTypeInternal;
+extern CmdResponse_SyncDefaultTypeInternal _CmdResponse_Sync_default_instance_;
+class KeyExpire;
+struct KeyExpireDefaultTypeInternal;
+extern KeyExpireDefaultTypeInternal _KeyExpire_default_instance_;
+class Node;
+struct NodeDefaultTypeInternal;
+extern NodeDefaultTypeInternal _Node_default_instance_;
+class PartitionState;
+struct PartitionStateDefaultTypeInternal;
+extern PartitionStateDefaultTypeInternal _PartitionState_default_instance_;
+class PartitionState_SlaveLag;
+struct PartitionState_SlaveLagDefaultTypeInternal;
+extern PartitionState_SlaveLagDefaultTypeInternal _PartitionState_SlaveLag_default_instance_;
+class ReadStaleness;
+struct ReadStalenessDefaultTypeInternal;
+extern ReadStalenessDefaultTypeInternal _ReadStaleness_default_instance_;
+class ReplTerm;
+struct ReplTermDefaultTypeInternal;
+extern ReplTermDefaultTypeInternal _ReplTerm_default_instance_;
+class SyncOffset;
+struct SyncOffsetDefaultTypeInternal;
+extern SyncOffsetDefaultTypeInternal _SyncOffset_default_instance_;
 class SyncRequest;
+struct SyncRequestDefaultTypeInternal;
+extern SyncRequestDefaultTypeInternal _SyncRequest_default_instance_;
+}  // namespace client
+PROTOBUF_NAMESPACE_OPEN
+template<> ::client::BinlogAck* Arena::CreateMaybeMessage<::client::BinlogAck>(Arena*);
+template<> ::client::BinlogHeartbeat* Arena::CreateMaybeMessage<::client::BinlogHeartbeat>(Arena*);
+template<> ::client::BinlogResync* Arena::CreateMaybeMessage<::client::BinlogResync>(Arena*);
+template<> ::client::BinlogSkip* Arena::CreateMaybeMessage<::client::BinlogSkip>(Arena*);
+template<> ::client::CmdRequest* Arena::CreateMaybeMessage<::client::CmdRequest>(Arena*);
+template<> ::client::CmdRequest_Append* Arena::CreateMaybeMessage<::client::CmdRequest_Append>(Arena*);
+template<> ::client::CmdRequest_Del* Arena::CreateMaybeMessage<::client::CmdRequest_Del>(Arena*);
+template<> ::client::CmdRequest_Get* Arena::CreateMaybeMessage<::client::CmdRequest_Get>(Arena*);
+template<> ::client::CmdRequest_Incrby* Arena::CreateMaybeMessage<::client::CmdRequest_Incrby>(Arena*);
+template<> ::client::CmdRequest_Info* Arena::CreateMaybeMessage<::client::CmdRequest_Info>(Arena*);
+template<> ::client::CmdRequest_Mdel* Arena::CreateMaybeMessage<::client::CmdRequest_Mdel>(Arena*);
+template<> ::client::CmdRequest_Mget* Arena::CreateMaybeMessage<::client::CmdRequest_Mget>(Arena*);
+template<> ::client::CmdRequest_Mset* Arena::CreateMaybeMessage<::client::CmdRequest_Mset>(Arena*);
+template<> ::client::CmdRequest_Mset_Kv* Arena::CreateMaybeMessage<::client::CmdRequest_Mset_Kv>(Arena*);
+template<> ::client::CmdRequest_Msync* Arena::CreateMaybeMessage<::client::CmdRequest_Msync>(Arena*);
+template<> ::client::CmdRequest_Set* Arena::CreateMaybeMessage<::client::CmdRequest_Set>(Arena*);
+template<> ::client::CmdRequest_Subscribe* Arena::CreateMaybeMessage<::client::CmdRequest_Subscribe>(Arena*);
+template<> ::client::CmdRequest_Sync* Arena::CreateMaybeMessage<::client::CmdRequest_Sync>(Arena*);
+template<> ::client::CmdResponse* Arena::CreateMaybeMessage<::client::CmdResponse>(Arena*);
+template<> ::client::CmdResponse_Append* Arena::CreateMaybeMessage<::client::CmdResponse_Append>(Arena*);
+template<> ::client::CmdResponse_Get* Arena::CreateMaybeMessage<::client::CmdResponse_Get>(Arena*);
+template<> ::client::CmdResponse_Incrby* Arena::CreateMaybeMessage<::client::CmdResponse_Incrby>(Arena*);
+template<> ::client::CmdResponse_InfoCapacity* Arena::CreateMaybeMessage<::client::CmdResponse_InfoCapacity>(Arena*);
+template<> ::client::CmdResponse_InfoRepl* Arena::CreateMaybeMessage<::client::CmdResponse_InfoRepl>(Arena*);
+template<> ::client::CmdResponse_InfoServer* Arena::CreateMaybeMessage<::client::CmdResponse_InfoServer>(Arena*);
+template<> ::client::CmdResponse_InfoStats* Arena::CreateMaybeMessage<::client::CmdResponse_InfoStats>(Arena*);
+template<> ::client::CmdResponse_KeyResult* Arena::CreateMaybeMessage<::client::CmdResponse_KeyResult>(Arena*);
+template<> ::client::CmdResponse_Mget* Arena::CreateMaybeMessage<::client::CmdResponse_Mget>(Arena*);
+template<> ::client::CmdResponse_Subscribe* Arena::CreateMaybeMessage<::client::CmdResponse_Subscribe>(Arena*);
+template<> ::client::CmdResponse_Subscribe_Record* Arena::CreateMaybeMessage<::client::CmdResponse_Subscribe_Record>(Arena*);
+template<> ::client::CmdResponse_Sync* Arena::CreateMaybeMessage<::client::CmdResponse_Sync>(Arena*);
+template<> ::client::KeyExpire* Arena::CreateMaybeMessage<::client::KeyExpire>(Arena*);
+template<> ::client::Node* Arena::CreateMaybeMessage<::client::Node>(Arena*);
+template<> ::client::PartitionState* Arena::CreateMaybeMessage<::client::PartitionState>(Arena*);
+template<> ::client::PartitionState_SlaveLag* Arena::CreateMaybeMessage<::client::PartitionState_SlaveLag>(Arena*);
+template<> ::client::ReadStaleness* Arena::CreateMaybeMessage<::client::ReadStaleness>(Arena*);
+template<> ::client::ReplTerm* Arena::CreateMaybeMessage<::client::ReplTerm>(Arena*);
+template<> ::client::SyncOffset* Arena::CreateMaybeMessage<::client::SyncOffset>(Arena*);
+template<> ::client::SyncRequest* Arena::CreateMaybeMessage<::client::SyncRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace client {
 
-enum Type {
+enum Type : int {
   SYNC = 0,
   SET = 1,
   GET = 2,
@@ -65,43 +216,61 @@ enum Type {
   INFOCAPACITY = 5,
   INFOREPL = 6,
   MGET = 7,
-  INFOSERVER = 8
+  INFOSERVER = 8,
+  MSYNC = 9,
+  SUBSCRIBE = 10,
+  MSET = 11,
+  MDEL = 12,
+  INCRBY = 13,
+  DECRBY = 14,
+  APPEND = 15
 };
 bool Type_IsValid(int value);
-const Type Type_MIN = SYNC;
-const Type Type_MAX = INFOSERVER;
-const int Type_ARRAYSIZE = Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Type_descriptor();
-inline const ::std::string& Type_Name(Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Type_descriptor(), value);
+constexpr Type Type_MIN = SYNC;
+constexpr Type Type_MAX = APPEND;
+constexpr int Type_ARRAYSIZE = Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor();
+template<typename T>
+inline const std::string& Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Type_descriptor(), enum_t_value);
 }
 inline bool Type_Parse(
-    const ::std::string& name, Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Type>(
     Type_descriptor(), name, value);
 }
-enum SyncType {
+enum SyncType : int {
   CMD = 0,
-  SKIP = 1
+  SKIP = 1,
+  ACK = 2,
+  RESYNC = 3,
+  HEARTBEAT = 4
 };
 bool SyncType_IsValid(int value);
-const SyncType SyncType_MIN = CMD;
-const SyncType SyncType_MAX = SKIP;
-const int SyncType_ARRAYSIZE = SyncType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SyncType_descriptor();
-inline const ::std::string& SyncType_Name(SyncType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SyncType_descriptor(), value);
+constexpr SyncType SyncType_MIN = CMD;
+constexpr SyncType SyncType_MAX = HEARTBEAT;
+constexpr int SyncType_ARRAYSIZE = SyncType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SyncType_descriptor();
+template<typename T>
+inline const std::string& SyncType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SyncType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SyncType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SyncType_descriptor(), enum_t_value);
 }
 inline bool SyncType_Parse(
-    const ::std::string& name, SyncType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SyncType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SyncType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SyncType>(
     SyncType_descriptor(), name, value);
 }
-enum StatusCode {
+enum StatusCode : int {
   kOk = 0,
   kNotFound = 1,
   kWait = 2,
@@ -109,5142 +278,15428 @@ enum StatusCode {
   kFallback = 4
 };
 bool StatusCode_IsValid(int value);
-const StatusCode StatusCode_MIN = kOk;
-const StatusCode StatusCode_MAX = kFallback;
-const int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor();
-inline const ::std::string& StatusCode_Name(StatusCode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    StatusCode_descriptor(), value);
+constexpr StatusCode StatusCode_MIN = kOk;
+constexpr StatusCode StatusCode_MAX = kFallback;
+constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
+template<typename T>
+inline const std::string& StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatusCode_descriptor(), enum_t_value);
 }
 inline bool StatusCode_Parse(
-    const ::std::string& name, StatusCode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<StatusCode>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
     StatusCode_descriptor(), name, value);
 }
 // ===================================================================
 
-class Node : public ::google::protobuf::Message {
+class Node final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.Node) */ {
  public:
-  Node();
-  virtual ~Node();
+  inline Node() : Node(nullptr) {}
+  ~Node() override;
+  explicit PROTOBUF_CONSTEXPR Node(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Node(const Node& from);
+  Node(Node&& from) noexcept
+    : Node() {
+    *this = ::std::move(from);
+  }
 
   inline Node& operator=(const Node& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Node& operator=(Node&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Node& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Node& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Node* internal_default_instance() {
+    return reinterpret_cast<const Node*>(
+               &_Node_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Node* other);
+  friend void swap(Node& a, Node& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Node* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Node* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Node* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Node* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Node>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Node& from);
-  void MergeFrom(const Node& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Node& from) {
+    Node::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Node* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.Node";
+  }
+  protected:
+  explicit Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIpFieldNumber = 1,
+    kPortFieldNumber = 2,
+  };
   // required string ip = 1;
-  inline bool has_ip() const;
-  inline void clear_ip();
-  static const int kIpFieldNumber = 1;
-  inline const ::std::string& ip() const;
-  inline void set_ip(const ::std::string& value);
-  inline void set_ip(const char* value);
-  inline void set_ip(const char* value, size_t size);
-  inline ::std::string* mutable_ip();
-  inline ::std::string* release_ip();
-  inline void set_allocated_ip(::std::string* ip);
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
   // required int32 port = 2;
-  inline bool has_port() const;
-  inline void clear_port();
-  static const int kPortFieldNumber = 2;
-  inline ::google::protobuf::int32 port() const;
-  inline void set_port(::google::protobuf::int32 value);
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:client.Node)
  private:
-  inline void set_has_ip();
-  inline void clear_has_ip();
-  inline void set_has_port();
-  inline void clear_has_port();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* ip_;
-  ::google::protobuf::int32 port_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static Node* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SyncOffset : public ::google::protobuf::Message {
+class SyncOffset final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.SyncOffset) */ {
  public:
-  SyncOffset();
-  virtual ~SyncOffset();
+  inline SyncOffset() : SyncOffset(nullptr) {}
+  ~SyncOffset() override;
+  explicit PROTOBUF_CONSTEXPR SyncOffset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SyncOffset(const SyncOffset& from);
+  SyncOffset(SyncOffset&& from) noexcept
+    : SyncOffset() {
+    *this = ::std::move(from);
+  }
 
   inline SyncOffset& operator=(const SyncOffset& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SyncOffset& operator=(SyncOffset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SyncOffset& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncOffset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncOffset* internal_default_instance() {
+    return reinterpret_cast<const SyncOffset*>(
+               &_SyncOffset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(SyncOffset* other);
+  friend void swap(SyncOffset& a, SyncOffset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncOffset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncOffset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SyncOffset* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SyncOffset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncOffset>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SyncOffset& from);
-  void MergeFrom(const SyncOffset& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncOffset& from) {
+    SyncOffset::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncOffset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.SyncOffset";
+  }
+  protected:
+  explicit SyncOffset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 filenum = 1;
-  inline bool has_filenum() const;
-  inline void clear_filenum();
-  static const int kFilenumFieldNumber = 1;
-  inline ::google::protobuf::int32 filenum() const;
-  inline void set_filenum(::google::protobuf::int32 value);
-
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kFilenumFieldNumber = 1,
+    kPartitionFieldNumber = 3,
+  };
   // required int64 offset = 2;
-  inline bool has_offset() const;
-  inline void clear_offset();
-  static const int kOffsetFieldNumber = 2;
-  inline ::google::protobuf::int64 offset() const;
-  inline void set_offset(::google::protobuf::int64 value);
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // required int32 filenum = 1;
+  bool has_filenum() const;
+  private:
+  bool _internal_has_filenum() const;
+  public:
+  void clear_filenum();
+  int32_t filenum() const;
+  void set_filenum(int32_t value);
+  private:
+  int32_t _internal_filenum() const;
+  void _internal_set_filenum(int32_t value);
+  public:
 
   // optional int32 partition = 3;
-  inline bool has_partition() const;
-  inline void clear_partition();
-  static const int kPartitionFieldNumber = 3;
-  inline ::google::protobuf::int32 partition() const;
-  inline void set_partition(::google::protobuf::int32 value);
+  bool has_partition() const;
+  private:
+  bool _internal_has_partition() const;
+  public:
+  void clear_partition();
+  int32_t partition() const;
+  void set_partition(int32_t value);
+  private:
+  int32_t _internal_partition() const;
+  void _internal_set_partition(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:client.SyncOffset)
  private:
-  inline void set_has_filenum();
-  inline void clear_has_filenum();
-  inline void set_has_offset();
-  inline void clear_has_offset();
-  inline void set_has_partition();
-  inline void clear_has_partition();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int64 offset_;
-  ::google::protobuf::int32 filenum_;
-  ::google::protobuf::int32 partition_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static SyncOffset* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t offset_;
+    int32_t filenum_;
+    int32_t partition_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KeyExpire : public ::google::protobuf::Message {
+class ReplTerm final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.ReplTerm) */ {
  public:
-  KeyExpire();
-  virtual ~KeyExpire();
+  inline ReplTerm() : ReplTerm(nullptr) {}
+  ~ReplTerm() override;
+  explicit PROTOBUF_CONSTEXPR ReplTerm(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  KeyExpire(const KeyExpire& from);
+  ReplTerm(const ReplTerm& from);
+  ReplTerm(ReplTerm&& from) noexcept
+    : ReplTerm() {
+    *this = ::std::move(from);
+  }
 
-  inline KeyExpire& operator=(const KeyExpire& from) {
+  inline ReplTerm& operator=(const ReplTerm& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ReplTerm& operator=(ReplTerm&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const KeyExpire& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplTerm& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplTerm* internal_default_instance() {
+    return reinterpret_cast<const ReplTerm*>(
+               &_ReplTerm_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(KeyExpire* other);
+  friend void swap(ReplTerm& a, ReplTerm& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplTerm* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplTerm* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  KeyExpire* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const KeyExpire& from);
-  void MergeFrom(const KeyExpire& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  ReplTerm* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplTerm>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplTerm& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplTerm& from) {
+    ReplTerm::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // accessors -------------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplTerm* other);
 
-  // optional int32 base = 1;
-  inline bool has_base() const;
-  inline void clear_base();
-  static const int kBaseFieldNumber = 1;
-  inline ::google::protobuf::int32 base() const;
-  inline void set_base(::google::protobuf::int32 value);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.ReplTerm";
+  }
+  protected:
+  explicit ReplTerm(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required int32 ttl = 2;
-  inline bool has_ttl() const;
-  inline void clear_ttl();
-  static const int kTtlFieldNumber = 2;
-  inline ::google::protobuf::int32 ttl() const;
-  inline void set_ttl(::google::protobuf::int32 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:client.KeyExpire)
- private:
-  inline void set_has_base();
-  inline void clear_has_base();
-  inline void set_has_ttl();
-  inline void clear_has_ttl();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::int32 base_;
-  ::google::protobuf::int32 ttl_;
+  // accessors -------------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  enum : int {
+    kReplIdFieldNumber = 1,
+    kBeginFieldNumber = 2,
+  };
+  // required string repl_id = 1;
+  bool has_repl_id() const;
+  private:
+  bool _internal_has_repl_id() const;
+  public:
+  void clear_repl_id();
+  const std::string& repl_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_repl_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_repl_id();
+  PROTOBUF_NODISCARD std::string* release_repl_id();
+  void set_allocated_repl_id(std::string* repl_id);
+  private:
+  const std::string& _internal_repl_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_repl_id(const std::string& value);
+  std::string* _internal_mutable_repl_id();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // required .client.SyncOffset begin = 2;
+  bool has_begin() const;
+  private:
+  bool _internal_has_begin() const;
+  public:
+  void clear_begin();
+  const ::client::SyncOffset& begin() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_begin();
+  ::client::SyncOffset* mutable_begin();
+  void set_allocated_begin(::client::SyncOffset* begin);
+  private:
+  const ::client::SyncOffset& _internal_begin() const;
+  ::client::SyncOffset* _internal_mutable_begin();
+  public:
+  void unsafe_arena_set_allocated_begin(
+      ::client::SyncOffset* begin);
+  ::client::SyncOffset* unsafe_arena_release_begin();
 
-  void InitAsDefaultInstance();
-  static KeyExpire* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.ReplTerm)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr repl_id_;
+    ::client::SyncOffset* begin_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PartitionState : public ::google::protobuf::Message {
+class ReadStaleness final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.ReadStaleness) */ {
  public:
-  PartitionState();
-  virtual ~PartitionState();
+  inline ReadStaleness() : ReadStaleness(nullptr) {}
+  ~ReadStaleness() override;
+  explicit PROTOBUF_CONSTEXPR ReadStaleness(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PartitionState(const PartitionState& from);
+  ReadStaleness(const ReadStaleness& from);
+  ReadStaleness(ReadStaleness&& from) noexcept
+    : ReadStaleness() {
+    *this = ::std::move(from);
+  }
 
-  inline PartitionState& operator=(const PartitionState& from) {
+  inline ReadStaleness& operator=(const ReadStaleness& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ReadStaleness& operator=(ReadStaleness&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PartitionState& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadStaleness& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadStaleness* internal_default_instance() {
+    return reinterpret_cast<const ReadStaleness*>(
+               &_ReadStaleness_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(PartitionState* other);
+  friend void swap(ReadStaleness& a, ReadStaleness& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadStaleness* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadStaleness* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PartitionState* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PartitionState& from);
-  void MergeFrom(const PartitionState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  ReadStaleness* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadStaleness>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadStaleness& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadStaleness& from) {
+    ReadStaleness::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadStaleness* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.ReadStaleness";
+  }
+  protected:
+  explicit ReadStaleness(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required int32 partition_id = 1;
-  inline bool has_partition_id() const;
-  inline void clear_partition_id();
-  static const int kPartitionIdFieldNumber = 1;
-  inline ::google::protobuf::int32 partition_id() const;
-  inline void set_partition_id(::google::protobuf::int32 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required string role = 2;
-  inline bool has_role() const;
-  inline void clear_role();
-  static const int kRoleFieldNumber = 2;
-  inline const ::std::string& role() const;
-  inline void set_role(const ::std::string& value);
-  inline void set_role(const char* value);
-  inline void set_role(const char* value, size_t size);
-  inline ::std::string* mutable_role();
-  inline ::std::string* release_role();
-  inline void set_allocated_role(::std::string* role);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // required string repl_state = 3;
-  inline bool has_repl_state() const;
-  inline void clear_repl_state();
-  static const int kReplStateFieldNumber = 3;
-  inline const ::std::string& repl_state() const;
-  inline void set_repl_state(const ::std::string& value);
-  inline void set_repl_state(const char* value);
-  inline void set_repl_state(const char* value, size_t size);
-  inline ::std::string* mutable_repl_state();
-  inline ::std::string* release_repl_state();
-  inline void set_allocated_repl_state(::std::string* repl_state);
+  // nested types ----------------------------------------------------
 
-  // required .client.Node master = 4;
-  inline bool has_master() const;
-  inline void clear_master();
-  static const int kMasterFieldNumber = 4;
-  inline const ::client::Node& master() const;
-  inline ::client::Node* mutable_master();
-  inline ::client::Node* release_master();
-  inline void set_allocated_master(::client::Node* master);
+  // accessors -------------------------------------------------------
 
-  // repeated .client.Node slaves = 5;
-  inline int slaves_size() const;
-  inline void clear_slaves();
-  static const int kSlavesFieldNumber = 5;
-  inline const ::client::Node& slaves(int index) const;
-  inline ::client::Node* mutable_slaves(int index);
-  inline ::client::Node* add_slaves();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::Node >&
-      slaves() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::Node >*
-      mutable_slaves();
+  enum : int {
+    kMaxMsFieldNumber = 1,
+    kMaxBytesFieldNumber = 2,
+  };
+  // optional int64 max_ms = 1;
+  bool has_max_ms() const;
+  private:
+  bool _internal_has_max_ms() const;
+  public:
+  void clear_max_ms();
+  int64_t max_ms() const;
+  void set_max_ms(int64_t value);
+  private:
+  int64_t _internal_max_ms() const;
+  void _internal_set_max_ms(int64_t value);
+  public:
 
-  // required .client.SyncOffset sync_offset = 6;
-  inline bool has_sync_offset() const;
-  inline void clear_sync_offset();
-  static const int kSyncOffsetFieldNumber = 6;
-  inline const ::client::SyncOffset& sync_offset() const;
-  inline ::client::SyncOffset* mutable_sync_offset();
-  inline ::client::SyncOffset* release_sync_offset();
-  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  // optional int64 max_bytes = 2;
+  bool has_max_bytes() const;
+  private:
+  bool _internal_has_max_bytes() const;
+  public:
+  void clear_max_bytes();
+  int64_t max_bytes() const;
+  void set_max_bytes(int64_t value);
+  private:
+  int64_t _internal_max_bytes() const;
+  void _internal_set_max_bytes(int64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:client.PartitionState)
+  // @@protoc_insertion_point(class_scope:client.ReadStaleness)
  private:
-  inline void set_has_partition_id();
-  inline void clear_has_partition_id();
-  inline void set_has_role();
-  inline void clear_has_role();
-  inline void set_has_repl_state();
-  inline void clear_has_repl_state();
-  inline void set_has_master();
-  inline void clear_has_master();
-  inline void set_has_sync_offset();
-  inline void clear_has_sync_offset();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* role_;
-  ::std::string* repl_state_;
-  ::client::Node* master_;
-  ::google::protobuf::RepeatedPtrField< ::client::Node > slaves_;
-  ::client::SyncOffset* sync_offset_;
-  ::google::protobuf::int32 partition_id_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static PartitionState* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t max_ms_;
+    int64_t max_bytes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Sync : public ::google::protobuf::Message {
+class KeyExpire final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.KeyExpire) */ {
  public:
-  CmdRequest_Sync();
-  virtual ~CmdRequest_Sync();
+  inline KeyExpire() : KeyExpire(nullptr) {}
+  ~KeyExpire() override;
+  explicit PROTOBUF_CONSTEXPR KeyExpire(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Sync(const CmdRequest_Sync& from);
+  KeyExpire(const KeyExpire& from);
+  KeyExpire(KeyExpire&& from) noexcept
+    : KeyExpire() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Sync& operator=(const CmdRequest_Sync& from) {
+  inline KeyExpire& operator=(const KeyExpire& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline KeyExpire& operator=(KeyExpire&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Sync& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyExpire& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyExpire* internal_default_instance() {
+    return reinterpret_cast<const KeyExpire*>(
+               &_KeyExpire_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(CmdRequest_Sync* other);
+  friend void swap(KeyExpire& a, KeyExpire& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyExpire* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyExpire* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Sync* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Sync& from);
-  void MergeFrom(const CmdRequest_Sync& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  KeyExpire* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyExpire>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyExpire& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyExpire& from) {
+    KeyExpire::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // required .client.Node node = 1;
-  inline bool has_node() const;
-  inline void clear_node();
-  static const int kNodeFieldNumber = 1;
-  inline const ::client::Node& node() const;
-  inline ::client::Node* mutable_node();
-  inline ::client::Node* release_node();
-  inline void set_allocated_node(::client::Node* node);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyExpire* other);
 
-  // required string table_name = 2;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 2;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.KeyExpire";
+  }
+  protected:
+  explicit KeyExpire(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required .client.SyncOffset sync_offset = 3;
-  inline bool has_sync_offset() const;
-  inline void clear_sync_offset();
-  static const int kSyncOffsetFieldNumber = 3;
-  inline const ::client::SyncOffset& sync_offset() const;
-  inline ::client::SyncOffset* mutable_sync_offset();
-  inline ::client::SyncOffset* release_sync_offset();
-  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:client.CmdRequest.Sync)
- private:
-  inline void set_has_node();
-  inline void clear_has_node();
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_sync_offset();
-  inline void clear_has_sync_offset();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // nested types ----------------------------------------------------
 
-  ::client::Node* node_;
-  ::std::string* table_name_;
-  ::client::SyncOffset* sync_offset_;
+  // accessors -------------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  enum : int {
+    kBaseFieldNumber = 1,
+    kTtlFieldNumber = 2,
+  };
+  // optional int32 base = 1;
+  bool has_base() const;
+  private:
+  bool _internal_has_base() const;
+  public:
+  void clear_base();
+  int32_t base() const;
+  void set_base(int32_t value);
+  private:
+  int32_t _internal_base() const;
+  void _internal_set_base(int32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // required int32 ttl = 2;
+  bool has_ttl() const;
+  private:
+  bool _internal_has_ttl() const;
+  public:
+  void clear_ttl();
+  int32_t ttl() const;
+  void set_ttl(int32_t value);
+  private:
+  int32_t _internal_ttl() const;
+  void _internal_set_ttl(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdRequest_Sync* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.KeyExpire)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t base_;
+    int32_t ttl_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Set : public ::google::protobuf::Message {
+class PartitionState_SlaveLag final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.PartitionState.SlaveLag) */ {
  public:
-  CmdRequest_Set();
-  virtual ~CmdRequest_Set();
+  inline PartitionState_SlaveLag() : PartitionState_SlaveLag(nullptr) {}
+  ~PartitionState_SlaveLag() override;
+  explicit PROTOBUF_CONSTEXPR PartitionState_SlaveLag(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Set(const CmdRequest_Set& from);
+  PartitionState_SlaveLag(const PartitionState_SlaveLag& from);
+  PartitionState_SlaveLag(PartitionState_SlaveLag&& from) noexcept
+    : PartitionState_SlaveLag() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Set& operator=(const CmdRequest_Set& from) {
+  inline PartitionState_SlaveLag& operator=(const PartitionState_SlaveLag& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PartitionState_SlaveLag& operator=(PartitionState_SlaveLag&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Set& default_instance();
-
-  void Swap(CmdRequest_Set* other);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PartitionState_SlaveLag& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PartitionState_SlaveLag* internal_default_instance() {
+    return reinterpret_cast<const PartitionState_SlaveLag*>(
+               &_PartitionState_SlaveLag_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PartitionState_SlaveLag& a, PartitionState_SlaveLag& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PartitionState_SlaveLag* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PartitionState_SlaveLag* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Set* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Set& from);
-  void MergeFrom(const CmdRequest_Set& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  PartitionState_SlaveLag* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PartitionState_SlaveLag>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PartitionState_SlaveLag& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PartitionState_SlaveLag& from) {
+    PartitionState_SlaveLag::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PartitionState_SlaveLag* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.PartitionState.SlaveLag";
+  }
+  protected:
+  explicit PartitionState_SlaveLag(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  enum : int {
+    kNodeFieldNumber = 1,
+    kLagBytesFieldNumber = 2,
+    kSendBytesPerSecFieldNumber = 4,
+    kSinceLastSendMsFieldNumber = 5,
+    kUnackedRecordsFieldNumber = 3,
+  };
+  // required .client.Node node = 1;
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::client::Node& node() const;
+  PROTOBUF_NODISCARD ::client::Node* release_node();
+  ::client::Node* mutable_node();
+  void set_allocated_node(::client::Node* node);
+  private:
+  const ::client::Node& _internal_node() const;
+  ::client::Node* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::client::Node* node);
+  ::client::Node* unsafe_arena_release_node();
 
-  // required string key = 2;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 2;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const char* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
+  // required int64 lag_bytes = 2;
+  bool has_lag_bytes() const;
+  private:
+  bool _internal_has_lag_bytes() const;
+  public:
+  void clear_lag_bytes();
+  int64_t lag_bytes() const;
+  void set_lag_bytes(int64_t value);
+  private:
+  int64_t _internal_lag_bytes() const;
+  void _internal_set_lag_bytes(int64_t value);
+  public:
 
-  // required bytes value = 3;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 3;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const void* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
+  // required int64 send_bytes_per_sec = 4;
+  bool has_send_bytes_per_sec() const;
+  private:
+  bool _internal_has_send_bytes_per_sec() const;
+  public:
+  void clear_send_bytes_per_sec();
+  int64_t send_bytes_per_sec() const;
+  void set_send_bytes_per_sec(int64_t value);
+  private:
+  int64_t _internal_send_bytes_per_sec() const;
+  void _internal_set_send_bytes_per_sec(int64_t value);
+  public:
 
-  // optional string uuid = 4;
-  inline bool has_uuid() const;
-  inline void clear_uuid();
-  static const int kUuidFieldNumber = 4;
-  inline const ::std::string& uuid() const;
-  inline void set_uuid(const ::std::string& value);
-  inline void set_uuid(const char* value);
-  inline void set_uuid(const char* value, size_t size);
-  inline ::std::string* mutable_uuid();
-  inline ::std::string* release_uuid();
-  inline void set_allocated_uuid(::std::string* uuid);
+  // required int64 since_last_send_ms = 5;
+  bool has_since_last_send_ms() const;
+  private:
+  bool _internal_has_since_last_send_ms() const;
+  public:
+  void clear_since_last_send_ms();
+  int64_t since_last_send_ms() const;
+  void set_since_last_send_ms(int64_t value);
+  private:
+  int64_t _internal_since_last_send_ms() const;
+  void _internal_set_since_last_send_ms(int64_t value);
+  public:
 
-  // optional .client.KeyExpire expire = 5;
-  inline bool has_expire() const;
-  inline void clear_expire();
-  static const int kExpireFieldNumber = 5;
-  inline const ::client::KeyExpire& expire() const;
-  inline ::client::KeyExpire* mutable_expire();
-  inline ::client::KeyExpire* release_expire();
-  inline void set_allocated_expire(::client::KeyExpire* expire);
+  // required int32 unacked_records = 3;
+  bool has_unacked_records() const;
+  private:
+  bool _internal_has_unacked_records() const;
+  public:
+  void clear_unacked_records();
+  int32_t unacked_records() const;
+  void set_unacked_records(int32_t value);
+  private:
+  int32_t _internal_unacked_records() const;
+  void _internal_set_unacked_records(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:client.CmdRequest.Set)
+  // @@protoc_insertion_point(class_scope:client.PartitionState.SlaveLag)
  private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_value();
-  inline void clear_has_value();
-  inline void set_has_uuid();
-  inline void clear_has_uuid();
-  inline void set_has_expire();
-  inline void clear_has_expire();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* table_name_;
-  ::std::string* key_;
-  ::std::string* value_;
-  ::std::string* uuid_;
-  ::client::KeyExpire* expire_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdRequest_Set* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::client::Node* node_;
+    int64_t lag_bytes_;
+    int64_t send_bytes_per_sec_;
+    int64_t since_last_send_ms_;
+    int32_t unacked_records_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Get : public ::google::protobuf::Message {
+class PartitionState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.PartitionState) */ {
  public:
-  CmdRequest_Get();
-  virtual ~CmdRequest_Get();
+  inline PartitionState() : PartitionState(nullptr) {}
+  ~PartitionState() override;
+  explicit PROTOBUF_CONSTEXPR PartitionState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Get(const CmdRequest_Get& from);
+  PartitionState(const PartitionState& from);
+  PartitionState(PartitionState&& from) noexcept
+    : PartitionState() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Get& operator=(const CmdRequest_Get& from) {
+  inline PartitionState& operator=(const PartitionState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PartitionState& operator=(PartitionState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Get& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PartitionState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PartitionState* internal_default_instance() {
+    return reinterpret_cast<const PartitionState*>(
+               &_PartitionState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(CmdRequest_Get* other);
+  friend void swap(PartitionState& a, PartitionState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PartitionState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PartitionState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Get* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Get& from);
-  void MergeFrom(const CmdRequest_Get& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  PartitionState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PartitionState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PartitionState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PartitionState& from) {
+    PartitionState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PartitionState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.PartitionState";
+  }
+  protected:
+  explicit PartitionState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef PartitionState_SlaveLag SlaveLag;
+
   // accessors -------------------------------------------------------
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  enum : int {
+    kSlavesFieldNumber = 5,
+    kSlaveLagsFieldNumber = 7,
+    kRoleFieldNumber = 2,
+    kReplStateFieldNumber = 3,
+    kMasterFieldNumber = 4,
+    kSyncOffsetFieldNumber = 6,
+    kApplyLagBytesFieldNumber = 8,
+    kApplyLagMsFieldNumber = 9,
+    kPartitionIdFieldNumber = 1,
+  };
+  // repeated .client.Node slaves = 5;
+  int slaves_size() const;
+  private:
+  int _internal_slaves_size() const;
+  public:
+  void clear_slaves();
+  ::client::Node* mutable_slaves(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::Node >*
+      mutable_slaves();
+  private:
+  const ::client::Node& _internal_slaves(int index) const;
+  ::client::Node* _internal_add_slaves();
+  public:
+  const ::client::Node& slaves(int index) const;
+  ::client::Node* add_slaves();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::Node >&
+      slaves() const;
 
-  // required string key = 2;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 2;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const char* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
+  // repeated .client.PartitionState.SlaveLag slave_lags = 7;
+  int slave_lags_size() const;
+  private:
+  int _internal_slave_lags_size() const;
+  public:
+  void clear_slave_lags();
+  ::client::PartitionState_SlaveLag* mutable_slave_lags(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState_SlaveLag >*
+      mutable_slave_lags();
+  private:
+  const ::client::PartitionState_SlaveLag& _internal_slave_lags(int index) const;
+  ::client::PartitionState_SlaveLag* _internal_add_slave_lags();
+  public:
+  const ::client::PartitionState_SlaveLag& slave_lags(int index) const;
+  ::client::PartitionState_SlaveLag* add_slave_lags();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState_SlaveLag >&
+      slave_lags() const;
 
-  // optional string uuid = 3;
-  inline bool has_uuid() const;
-  inline void clear_uuid();
-  static const int kUuidFieldNumber = 3;
-  inline const ::std::string& uuid() const;
-  inline void set_uuid(const ::std::string& value);
-  inline void set_uuid(const char* value);
-  inline void set_uuid(const char* value, size_t size);
-  inline ::std::string* mutable_uuid();
-  inline ::std::string* release_uuid();
-  inline void set_allocated_uuid(::std::string* uuid);
+  // required string role = 2;
+  bool has_role() const;
+  private:
+  bool _internal_has_role() const;
+  public:
+  void clear_role();
+  const std::string& role() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_role(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_role();
+  PROTOBUF_NODISCARD std::string* release_role();
+  void set_allocated_role(std::string* role);
+  private:
+  const std::string& _internal_role() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role(const std::string& value);
+  std::string* _internal_mutable_role();
+  public:
 
-  // @@protoc_insertion_point(class_scope:client.CmdRequest.Get)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_uuid();
-  inline void clear_has_uuid();
+  // required string repl_state = 3;
+  bool has_repl_state() const;
+  private:
+  bool _internal_has_repl_state() const;
+  public:
+  void clear_repl_state();
+  const std::string& repl_state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_repl_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_repl_state();
+  PROTOBUF_NODISCARD std::string* release_repl_state();
+  void set_allocated_repl_state(std::string* repl_state);
+  private:
+  const std::string& _internal_repl_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_repl_state(const std::string& value);
+  std::string* _internal_mutable_repl_state();
+  public:
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // required .client.Node master = 4;
+  bool has_master() const;
+  private:
+  bool _internal_has_master() const;
+  public:
+  void clear_master();
+  const ::client::Node& master() const;
+  PROTOBUF_NODISCARD ::client::Node* release_master();
+  ::client::Node* mutable_master();
+  void set_allocated_master(::client::Node* master);
+  private:
+  const ::client::Node& _internal_master() const;
+  ::client::Node* _internal_mutable_master();
+  public:
+  void unsafe_arena_set_allocated_master(
+      ::client::Node* master);
+  ::client::Node* unsafe_arena_release_master();
+
+  // required .client.SyncOffset sync_offset = 6;
+  bool has_sync_offset() const;
+  private:
+  bool _internal_has_sync_offset() const;
+  public:
+  void clear_sync_offset();
+  const ::client::SyncOffset& sync_offset() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_sync_offset();
+  ::client::SyncOffset* mutable_sync_offset();
+  void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  private:
+  const ::client::SyncOffset& _internal_sync_offset() const;
+  ::client::SyncOffset* _internal_mutable_sync_offset();
+  public:
+  void unsafe_arena_set_allocated_sync_offset(
+      ::client::SyncOffset* sync_offset);
+  ::client::SyncOffset* unsafe_arena_release_sync_offset();
 
-  ::std::string* table_name_;
-  ::std::string* key_;
-  ::std::string* uuid_;
+  // optional int64 apply_lag_bytes = 8;
+  bool has_apply_lag_bytes() const;
+  private:
+  bool _internal_has_apply_lag_bytes() const;
+  public:
+  void clear_apply_lag_bytes();
+  int64_t apply_lag_bytes() const;
+  void set_apply_lag_bytes(int64_t value);
+  private:
+  int64_t _internal_apply_lag_bytes() const;
+  void _internal_set_apply_lag_bytes(int64_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  // optional int64 apply_lag_ms = 9;
+  bool has_apply_lag_ms() const;
+  private:
+  bool _internal_has_apply_lag_ms() const;
+  public:
+  void clear_apply_lag_ms();
+  int64_t apply_lag_ms() const;
+  void set_apply_lag_ms(int64_t value);
+  private:
+  int64_t _internal_apply_lag_ms() const;
+  void _internal_set_apply_lag_ms(int64_t value);
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // required int32 partition_id = 1;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdRequest_Get* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.PartitionState)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::Node > slaves_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState_SlaveLag > slave_lags_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr role_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr repl_state_;
+    ::client::Node* master_;
+    ::client::SyncOffset* sync_offset_;
+    int64_t apply_lag_bytes_;
+    int64_t apply_lag_ms_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Del : public ::google::protobuf::Message {
+class CmdRequest_Sync final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Sync) */ {
  public:
-  CmdRequest_Del();
-  virtual ~CmdRequest_Del();
+  inline CmdRequest_Sync() : CmdRequest_Sync(nullptr) {}
+  ~CmdRequest_Sync() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Sync(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Del(const CmdRequest_Del& from);
+  CmdRequest_Sync(const CmdRequest_Sync& from);
+  CmdRequest_Sync(CmdRequest_Sync&& from) noexcept
+    : CmdRequest_Sync() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Del& operator=(const CmdRequest_Del& from) {
+  inline CmdRequest_Sync& operator=(const CmdRequest_Sync& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Sync& operator=(CmdRequest_Sync&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Del& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Sync& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Sync* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Sync*>(
+               &_CmdRequest_Sync_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(CmdRequest_Del* other);
+  friend void swap(CmdRequest_Sync& a, CmdRequest_Sync& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Sync* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Sync* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Del* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Del& from);
-  void MergeFrom(const CmdRequest_Del& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Sync* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Sync>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Sync& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Sync& from) {
+    CmdRequest_Sync::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Sync* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Sync";
+  }
+  protected:
+  explicit CmdRequest_Sync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required string key = 2;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 2;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const char* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional string uuid = 3;
-  inline bool has_uuid() const;
-  inline void clear_uuid();
-  static const int kUuidFieldNumber = 3;
-  inline const ::std::string& uuid() const;
-  inline void set_uuid(const ::std::string& value);
-  inline void set_uuid(const char* value);
-  inline void set_uuid(const char* value, size_t size);
-  inline ::std::string* mutable_uuid();
-  inline ::std::string* release_uuid();
-  inline void set_allocated_uuid(::std::string* uuid);
+  // nested types ----------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:client.CmdRequest.Del)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_uuid();
-  inline void clear_has_uuid();
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  enum : int {
+    kTableNameFieldNumber = 2,
+    kReplIdFieldNumber = 4,
+    kNodeFieldNumber = 1,
+    kSyncOffsetFieldNumber = 3,
+  };
+  // required string table_name = 2;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  ::std::string* table_name_;
-  ::std::string* key_;
-  ::std::string* uuid_;
+  // optional string repl_id = 4;
+  bool has_repl_id() const;
+  private:
+  bool _internal_has_repl_id() const;
+  public:
+  void clear_repl_id();
+  const std::string& repl_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_repl_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_repl_id();
+  PROTOBUF_NODISCARD std::string* release_repl_id();
+  void set_allocated_repl_id(std::string* repl_id);
+  private:
+  const std::string& _internal_repl_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_repl_id(const std::string& value);
+  std::string* _internal_mutable_repl_id();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  // required .client.Node node = 1;
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::client::Node& node() const;
+  PROTOBUF_NODISCARD ::client::Node* release_node();
+  ::client::Node* mutable_node();
+  void set_allocated_node(::client::Node* node);
+  private:
+  const ::client::Node& _internal_node() const;
+  ::client::Node* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::client::Node* node);
+  ::client::Node* unsafe_arena_release_node();
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // required .client.SyncOffset sync_offset = 3;
+  bool has_sync_offset() const;
+  private:
+  bool _internal_has_sync_offset() const;
+  public:
+  void clear_sync_offset();
+  const ::client::SyncOffset& sync_offset() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_sync_offset();
+  ::client::SyncOffset* mutable_sync_offset();
+  void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  private:
+  const ::client::SyncOffset& _internal_sync_offset() const;
+  ::client::SyncOffset* _internal_mutable_sync_offset();
+  public:
+  void unsafe_arena_set_allocated_sync_offset(
+      ::client::SyncOffset* sync_offset);
+  ::client::SyncOffset* unsafe_arena_release_sync_offset();
 
-  void InitAsDefaultInstance();
-  static CmdRequest_Del* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Sync)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr repl_id_;
+    ::client::Node* node_;
+    ::client::SyncOffset* sync_offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Info : public ::google::protobuf::Message {
+class CmdRequest_Set final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Set) */ {
  public:
-  CmdRequest_Info();
-  virtual ~CmdRequest_Info();
+  inline CmdRequest_Set() : CmdRequest_Set(nullptr) {}
+  ~CmdRequest_Set() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Set(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Info(const CmdRequest_Info& from);
+  CmdRequest_Set(const CmdRequest_Set& from);
+  CmdRequest_Set(CmdRequest_Set&& from) noexcept
+    : CmdRequest_Set() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Info& operator=(const CmdRequest_Info& from) {
+  inline CmdRequest_Set& operator=(const CmdRequest_Set& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Set& operator=(CmdRequest_Set&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Info& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Set& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Set* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Set*>(
+               &_CmdRequest_Set_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(CmdRequest_Info* other);
+  friend void swap(CmdRequest_Set& a, CmdRequest_Set& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Set* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Set* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Info* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Info& from);
-  void MergeFrom(const CmdRequest_Info& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_Set* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Set>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Set& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Set& from) {
+    CmdRequest_Set::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Set* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Set";
+  }
+  protected:
+  explicit CmdRequest_Set(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
-
-  // @@protoc_insertion_point(class_scope:client.CmdRequest.Info)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kUuidFieldNumber = 4,
+    kExpireFieldNumber = 5,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // required string key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  ::std::string* table_name_;
+  // required bytes value = 3;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional string uuid = 4;
+  bool has_uuid() const;
+  private:
+  bool _internal_has_uuid() const;
+  public:
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // optional .client.KeyExpire expire = 5;
+  bool has_expire() const;
+  private:
+  bool _internal_has_expire() const;
+  public:
+  void clear_expire();
+  const ::client::KeyExpire& expire() const;
+  PROTOBUF_NODISCARD ::client::KeyExpire* release_expire();
+  ::client::KeyExpire* mutable_expire();
+  void set_allocated_expire(::client::KeyExpire* expire);
+  private:
+  const ::client::KeyExpire& _internal_expire() const;
+  ::client::KeyExpire* _internal_mutable_expire();
+  public:
+  void unsafe_arena_set_allocated_expire(
+      ::client::KeyExpire* expire);
+  ::client::KeyExpire* unsafe_arena_release_expire();
 
-  void InitAsDefaultInstance();
-  static CmdRequest_Info* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Set)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::client::KeyExpire* expire_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Mget : public ::google::protobuf::Message {
+class CmdRequest_Get final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Get) */ {
  public:
-  CmdRequest_Mget();
-  virtual ~CmdRequest_Mget();
+  inline CmdRequest_Get() : CmdRequest_Get(nullptr) {}
+  ~CmdRequest_Get() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Get(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Mget(const CmdRequest_Mget& from);
+  CmdRequest_Get(const CmdRequest_Get& from);
+  CmdRequest_Get(CmdRequest_Get&& from) noexcept
+    : CmdRequest_Get() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Mget& operator=(const CmdRequest_Mget& from) {
+  inline CmdRequest_Get& operator=(const CmdRequest_Get& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Get& operator=(CmdRequest_Get&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Mget& default_instance();
-
-  void Swap(CmdRequest_Mget* other);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Get& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Get* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Get*>(
+               &_CmdRequest_Get_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CmdRequest_Get& a, CmdRequest_Get& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Get* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Get* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Mget* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Mget& from);
-  void MergeFrom(const CmdRequest_Mget& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_Get* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Get>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Get& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Get& from) {
+    CmdRequest_Get::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Get* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Get";
+  }
+  protected:
+  explicit CmdRequest_Get(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kUuidFieldNumber = 3,
+    kStalenessFieldNumber = 4,
+  };
   // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
-
-  // repeated string keys = 2;
-  inline int keys_size() const;
-  inline void clear_keys();
-  static const int kKeysFieldNumber = 2;
-  inline const ::std::string& keys(int index) const;
-  inline ::std::string* mutable_keys(int index);
-  inline void set_keys(int index, const ::std::string& value);
-  inline void set_keys(int index, const char* value);
-  inline void set_keys(int index, const char* value, size_t size);
-  inline ::std::string* add_keys();
-  inline void add_keys(const ::std::string& value);
-  inline void add_keys(const char* value);
-  inline void add_keys(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& keys() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_keys();
-
-  // @@protoc_insertion_point(class_scope:client.CmdRequest.Mget)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  ::std::string* table_name_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> keys_;
+  // required string key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional string uuid = 3;
+  bool has_uuid() const;
+  private:
+  bool _internal_has_uuid() const;
+  public:
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // optional .client.ReadStaleness staleness = 4;
+  bool has_staleness() const;
+  private:
+  bool _internal_has_staleness() const;
+  public:
+  void clear_staleness();
+  const ::client::ReadStaleness& staleness() const;
+  PROTOBUF_NODISCARD ::client::ReadStaleness* release_staleness();
+  ::client::ReadStaleness* mutable_staleness();
+  void set_allocated_staleness(::client::ReadStaleness* staleness);
+  private:
+  const ::client::ReadStaleness& _internal_staleness() const;
+  ::client::ReadStaleness* _internal_mutable_staleness();
+  public:
+  void unsafe_arena_set_allocated_staleness(
+      ::client::ReadStaleness* staleness);
+  ::client::ReadStaleness* unsafe_arena_release_staleness();
 
-  void InitAsDefaultInstance();
-  static CmdRequest_Mget* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Get)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::client::ReadStaleness* staleness_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest : public ::google::protobuf::Message {
+class CmdRequest_Del final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Del) */ {
  public:
-  CmdRequest();
-  virtual ~CmdRequest();
+  inline CmdRequest_Del() : CmdRequest_Del(nullptr) {}
+  ~CmdRequest_Del() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Del(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest(const CmdRequest& from);
+  CmdRequest_Del(const CmdRequest_Del& from);
+  CmdRequest_Del(CmdRequest_Del&& from) noexcept
+    : CmdRequest_Del() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest& operator=(const CmdRequest& from) {
+  inline CmdRequest_Del& operator=(const CmdRequest_Del& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Del& operator=(CmdRequest_Del&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Del& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Del* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Del*>(
+               &_CmdRequest_Del_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(CmdRequest* other);
+  friend void swap(CmdRequest_Del& a, CmdRequest_Del& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Del* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Del* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest& from);
-  void MergeFrom(const CmdRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Del* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Del>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Del& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Del& from) {
+    CmdRequest_Del::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  typedef CmdRequest_Sync Sync;
-  typedef CmdRequest_Set Set;
-  typedef CmdRequest_Get Get;
-  typedef CmdRequest_Del Del;
-  typedef CmdRequest_Info Info;
-  typedef CmdRequest_Mget Mget;
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Del* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Del";
+  }
+  protected:
+  explicit CmdRequest_Del(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required .client.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::client::Type type() const;
-  inline void set_type(::client::Type value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // optional .client.CmdRequest.Sync sync = 2;
-  inline bool has_sync() const;
-  inline void clear_sync();
-  static const int kSyncFieldNumber = 2;
-  inline const ::client::CmdRequest_Sync& sync() const;
-  inline ::client::CmdRequest_Sync* mutable_sync();
-  inline ::client::CmdRequest_Sync* release_sync();
-  inline void set_allocated_sync(::client::CmdRequest_Sync* sync);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional .client.CmdRequest.Set set = 3;
-  inline bool has_set() const;
-  inline void clear_set();
-  static const int kSetFieldNumber = 3;
-  inline const ::client::CmdRequest_Set& set() const;
-  inline ::client::CmdRequest_Set* mutable_set();
-  inline ::client::CmdRequest_Set* release_set();
-  inline void set_allocated_set(::client::CmdRequest_Set* set);
+  // nested types ----------------------------------------------------
 
-  // optional .client.CmdRequest.Get get = 4;
-  inline bool has_get() const;
-  inline void clear_get();
-  static const int kGetFieldNumber = 4;
-  inline const ::client::CmdRequest_Get& get() const;
-  inline ::client::CmdRequest_Get* mutable_get();
-  inline ::client::CmdRequest_Get* release_get();
-  inline void set_allocated_get(::client::CmdRequest_Get* get);
+  // accessors -------------------------------------------------------
 
-  // optional .client.CmdRequest.Del del = 5;
-  inline bool has_del() const;
-  inline void clear_del();
-  static const int kDelFieldNumber = 5;
-  inline const ::client::CmdRequest_Del& del() const;
-  inline ::client::CmdRequest_Del* mutable_del();
-  inline ::client::CmdRequest_Del* release_del();
-  inline void set_allocated_del(::client::CmdRequest_Del* del);
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kUuidFieldNumber = 3,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  // optional .client.CmdRequest.Info info = 6;
-  inline bool has_info() const;
-  inline void clear_info();
-  static const int kInfoFieldNumber = 6;
-  inline const ::client::CmdRequest_Info& info() const;
-  inline ::client::CmdRequest_Info* mutable_info();
-  inline ::client::CmdRequest_Info* release_info();
-  inline void set_allocated_info(::client::CmdRequest_Info* info);
+  // required string key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // optional .client.CmdRequest.Mget mget = 7;
-  inline bool has_mget() const;
-  inline void clear_mget();
-  static const int kMgetFieldNumber = 7;
-  inline const ::client::CmdRequest_Mget& mget() const;
-  inline ::client::CmdRequest_Mget* mutable_mget();
-  inline ::client::CmdRequest_Mget* release_mget();
-  inline void set_allocated_mget(::client::CmdRequest_Mget* mget);
+  // optional string uuid = 3;
+  bool has_uuid() const;
+  private:
+  bool _internal_has_uuid() const;
+  public:
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  // @@protoc_insertion_point(class_scope:client.CmdRequest)
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Del)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_sync();
-  inline void clear_has_sync();
-  inline void set_has_set();
-  inline void clear_has_set();
-  inline void set_has_get();
-  inline void clear_has_get();
-  inline void set_has_del();
-  inline void clear_has_del();
-  inline void set_has_info();
-  inline void clear_has_info();
-  inline void set_has_mget();
-  inline void clear_has_mget();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::client::CmdRequest_Sync* sync_;
-  ::client::CmdRequest_Set* set_;
-  ::client::CmdRequest_Get* get_;
-  ::client::CmdRequest_Del* del_;
-  ::client::CmdRequest_Info* info_;
-  ::client::CmdRequest_Mget* mget_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(7 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdRequest* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Sync : public ::google::protobuf::Message {
+class CmdRequest_Info final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Info) */ {
  public:
-  CmdResponse_Sync();
-  virtual ~CmdResponse_Sync();
+  inline CmdRequest_Info() : CmdRequest_Info(nullptr) {}
+  ~CmdRequest_Info() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Info(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_Sync(const CmdResponse_Sync& from);
+  CmdRequest_Info(const CmdRequest_Info& from);
+  CmdRequest_Info(CmdRequest_Info&& from) noexcept
+    : CmdRequest_Info() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_Sync& operator=(const CmdResponse_Sync& from) {
+  inline CmdRequest_Info& operator=(const CmdRequest_Info& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Info& operator=(CmdRequest_Info&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Sync& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Info& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Info* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Info*>(
+               &_CmdRequest_Info_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(CmdResponse_Sync* other);
+  friend void swap(CmdRequest_Info& a, CmdRequest_Info& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Info* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Info* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Sync* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Sync& from);
-  void MergeFrom(const CmdResponse_Sync& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Info* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Info>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Info& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Info& from) {
+    CmdRequest_Info::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Info* other);
 
-  // required .client.SyncOffset sync_offset = 2;
-  inline bool has_sync_offset() const;
-  inline void clear_sync_offset();
-  static const int kSyncOffsetFieldNumber = 2;
-  inline const ::client::SyncOffset& sync_offset() const;
-  inline ::client::SyncOffset* mutable_sync_offset();
-  inline ::client::SyncOffset* release_sync_offset();
-  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Info";
+  }
+  protected:
+  explicit CmdRequest_Info(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.Sync)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_sync_offset();
-  inline void clear_has_sync_offset();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::std::string* table_name_;
-  ::client::SyncOffset* sync_offset_;
+  // nested types ----------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // accessors -------------------------------------------------------
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  enum : int {
+    kTableNameFieldNumber = 1,
+  };
+  // optional string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_Sync* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Info)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Get : public ::google::protobuf::Message {
+class CmdRequest_Mget final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Mget) */ {
  public:
-  CmdResponse_Get();
-  virtual ~CmdResponse_Get();
+  inline CmdRequest_Mget() : CmdRequest_Mget(nullptr) {}
+  ~CmdRequest_Mget() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Mget(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_Get(const CmdResponse_Get& from);
+  CmdRequest_Mget(const CmdRequest_Mget& from);
+  CmdRequest_Mget(CmdRequest_Mget&& from) noexcept
+    : CmdRequest_Mget() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_Get& operator=(const CmdResponse_Get& from) {
+  inline CmdRequest_Mget& operator=(const CmdRequest_Mget& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Mget& operator=(CmdRequest_Mget&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Get& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Mget& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Mget* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Mget*>(
+               &_CmdRequest_Mget_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  void Swap(CmdResponse_Get* other);
+  friend void swap(CmdRequest_Mget& a, CmdRequest_Mget& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Mget* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Mget* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Get* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Get& from);
-  void MergeFrom(const CmdResponse_Get& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_Mget* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Mget>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Mget& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Mget& from) {
+    CmdRequest_Mget::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Mget* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Mget";
+  }
+  protected:
+  explicit CmdRequest_Mget(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bytes value = 1;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 1;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const void* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
-
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.Get)
- private:
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  enum : int {
+    kKeysFieldNumber = 2,
+    kTableNameFieldNumber = 1,
+    kStalenessFieldNumber = 3,
+    kPartitionIdFieldNumber = 4,
+  };
+  // repeated string keys = 2;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
 
-  ::std::string* value_;
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional .client.ReadStaleness staleness = 3;
+  bool has_staleness() const;
+  private:
+  bool _internal_has_staleness() const;
+  public:
+  void clear_staleness();
+  const ::client::ReadStaleness& staleness() const;
+  PROTOBUF_NODISCARD ::client::ReadStaleness* release_staleness();
+  ::client::ReadStaleness* mutable_staleness();
+  void set_allocated_staleness(::client::ReadStaleness* staleness);
+  private:
+  const ::client::ReadStaleness& _internal_staleness() const;
+  ::client::ReadStaleness* _internal_mutable_staleness();
+  public:
+  void unsafe_arena_set_allocated_staleness(
+      ::client::ReadStaleness* staleness);
+  ::client::ReadStaleness* unsafe_arena_release_staleness();
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // optional int32 partition_id = 4;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_Get* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Mget)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::client::ReadStaleness* staleness_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoStats : public ::google::protobuf::Message {
+class CmdRequest_Msync final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Msync) */ {
  public:
-  CmdResponse_InfoStats();
-  virtual ~CmdResponse_InfoStats();
+  inline CmdRequest_Msync() : CmdRequest_Msync(nullptr) {}
+  ~CmdRequest_Msync() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Msync(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_InfoStats(const CmdResponse_InfoStats& from);
+  CmdRequest_Msync(const CmdRequest_Msync& from);
+  CmdRequest_Msync(CmdRequest_Msync&& from) noexcept
+    : CmdRequest_Msync() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_InfoStats& operator=(const CmdResponse_InfoStats& from) {
+  inline CmdRequest_Msync& operator=(const CmdRequest_Msync& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Msync& operator=(CmdRequest_Msync&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoStats& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Msync& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Msync* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Msync*>(
+               &_CmdRequest_Msync_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
 
-  void Swap(CmdResponse_InfoStats* other);
+  friend void swap(CmdRequest_Msync& a, CmdRequest_Msync& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Msync* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Msync* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoStats* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoStats& from);
-  void MergeFrom(const CmdResponse_InfoStats& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Msync* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Msync>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Msync& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Msync& from) {
+    CmdRequest_Msync::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // required int64 total_querys = 2;
-  inline bool has_total_querys() const;
-  inline void clear_total_querys();
-  static const int kTotalQuerysFieldNumber = 2;
-  inline ::google::protobuf::int64 total_querys() const;
-  inline void set_total_querys(::google::protobuf::int64 value);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Msync* other);
 
-  // required int32 qps = 3;
-  inline bool has_qps() const;
-  inline void clear_qps();
-  static const int kQpsFieldNumber = 3;
-  inline ::google::protobuf::int32 qps() const;
-  inline void set_qps(::google::protobuf::int32 value);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Msync";
+  }
+  protected:
+  explicit CmdRequest_Msync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoStats)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_total_querys();
-  inline void clear_has_total_querys();
-  inline void set_has_qps();
-  inline void clear_has_qps();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::std::string* table_name_;
-  ::google::protobuf::int64 total_querys_;
-  ::google::protobuf::int32 qps_;
+  // nested types ----------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  // accessors -------------------------------------------------------
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  enum : int {
+    kSyncsFieldNumber = 1,
+  };
+  // repeated .client.CmdRequest.Sync syncs = 1;
+  int syncs_size() const;
+  private:
+  int _internal_syncs_size() const;
+  public:
+  void clear_syncs();
+  ::client::CmdRequest_Sync* mutable_syncs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Sync >*
+      mutable_syncs();
+  private:
+  const ::client::CmdRequest_Sync& _internal_syncs(int index) const;
+  ::client::CmdRequest_Sync* _internal_add_syncs();
+  public:
+  const ::client::CmdRequest_Sync& syncs(int index) const;
+  ::client::CmdRequest_Sync* add_syncs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Sync >&
+      syncs() const;
 
-  void InitAsDefaultInstance();
-  static CmdResponse_InfoStats* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Msync)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Sync > syncs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoCapacity : public ::google::protobuf::Message {
+class CmdRequest_Subscribe final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Subscribe) */ {
  public:
-  CmdResponse_InfoCapacity();
-  virtual ~CmdResponse_InfoCapacity();
+  inline CmdRequest_Subscribe() : CmdRequest_Subscribe(nullptr) {}
+  ~CmdRequest_Subscribe() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Subscribe(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from);
+  CmdRequest_Subscribe(const CmdRequest_Subscribe& from);
+  CmdRequest_Subscribe(CmdRequest_Subscribe&& from) noexcept
+    : CmdRequest_Subscribe() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_InfoCapacity& operator=(const CmdResponse_InfoCapacity& from) {
+  inline CmdRequest_Subscribe& operator=(const CmdRequest_Subscribe& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Subscribe& operator=(CmdRequest_Subscribe&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoCapacity& default_instance();
-
-  void Swap(CmdResponse_InfoCapacity* other);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Subscribe& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Subscribe* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Subscribe*>(
+               &_CmdRequest_Subscribe_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CmdRequest_Subscribe& a, CmdRequest_Subscribe& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Subscribe* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Subscribe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoCapacity* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoCapacity& from);
-  void MergeFrom(const CmdResponse_InfoCapacity& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Subscribe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Subscribe>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Subscribe& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Subscribe& from) {
+    CmdRequest_Subscribe::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Subscribe* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Subscribe";
+  }
+  protected:
+  explicit CmdRequest_Subscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required int64 used = 2;
-  inline bool has_used() const;
-  inline void clear_used();
-  static const int kUsedFieldNumber = 2;
-  inline ::google::protobuf::int64 used() const;
-  inline void set_used(::google::protobuf::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // required int64 remain = 3;
-  inline bool has_remain() const;
-  inline void clear_remain();
-  static const int kRemainFieldNumber = 3;
-  inline ::google::protobuf::int64 remain() const;
-  inline void set_remain(::google::protobuf::int64 value);
+  // nested types ----------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoCapacity)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_used();
-  inline void clear_has_used();
-  inline void set_has_remain();
-  inline void clear_has_remain();
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  enum : int {
+    kCursorsFieldNumber = 2,
+    kTableNameFieldNumber = 1,
+    kKeyPrefixFieldNumber = 3,
+    kMaxRecordsFieldNumber = 4,
+  };
+  // repeated .client.SyncOffset cursors = 2;
+  int cursors_size() const;
+  private:
+  int _internal_cursors_size() const;
+  public:
+  void clear_cursors();
+  ::client::SyncOffset* mutable_cursors(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >*
+      mutable_cursors();
+  private:
+  const ::client::SyncOffset& _internal_cursors(int index) const;
+  ::client::SyncOffset* _internal_add_cursors();
+  public:
+  const ::client::SyncOffset& cursors(int index) const;
+  ::client::SyncOffset* add_cursors();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >&
+      cursors() const;
 
-  ::std::string* table_name_;
-  ::google::protobuf::int64 used_;
-  ::google::protobuf::int64 remain_;
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  // optional bytes key_prefix = 3;
+  bool has_key_prefix() const;
+  private:
+  bool _internal_has_key_prefix() const;
+  public:
+  void clear_key_prefix();
+  const std::string& key_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key_prefix();
+  PROTOBUF_NODISCARD std::string* release_key_prefix();
+  void set_allocated_key_prefix(std::string* key_prefix);
+  private:
+  const std::string& _internal_key_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key_prefix(const std::string& value);
+  std::string* _internal_mutable_key_prefix();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // optional int32 max_records = 4 [default = 1000];
+  bool has_max_records() const;
+  private:
+  bool _internal_has_max_records() const;
+  public:
+  void clear_max_records();
+  int32_t max_records() const;
+  void set_max_records(int32_t value);
+  private:
+  int32_t _internal_max_records() const;
+  void _internal_set_max_records(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_InfoCapacity* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Subscribe)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset > cursors_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_prefix_;
+    int32_t max_records_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoRepl : public ::google::protobuf::Message {
+class CmdRequest_Mset_Kv final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Mset.Kv) */ {
  public:
-  CmdResponse_InfoRepl();
-  virtual ~CmdResponse_InfoRepl();
+  inline CmdRequest_Mset_Kv() : CmdRequest_Mset_Kv(nullptr) {}
+  ~CmdRequest_Mset_Kv() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Mset_Kv(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from);
+  CmdRequest_Mset_Kv(const CmdRequest_Mset_Kv& from);
+  CmdRequest_Mset_Kv(CmdRequest_Mset_Kv&& from) noexcept
+    : CmdRequest_Mset_Kv() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_InfoRepl& operator=(const CmdResponse_InfoRepl& from) {
+  inline CmdRequest_Mset_Kv& operator=(const CmdRequest_Mset_Kv& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Mset_Kv& operator=(CmdRequest_Mset_Kv&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoRepl& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Mset_Kv& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Mset_Kv* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Mset_Kv*>(
+               &_CmdRequest_Mset_Kv_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
 
-  void Swap(CmdResponse_InfoRepl* other);
+  friend void swap(CmdRequest_Mset_Kv& a, CmdRequest_Mset_Kv& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Mset_Kv* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Mset_Kv* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoRepl* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoRepl& from);
-  void MergeFrom(const CmdResponse_InfoRepl& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Mset_Kv* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Mset_Kv>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Mset_Kv& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Mset_Kv& from) {
+    CmdRequest_Mset_Kv::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Mset_Kv* other);
 
-  // required int64 partition_cnt = 2;
-  inline bool has_partition_cnt() const;
-  inline void clear_partition_cnt();
-  static const int kPartitionCntFieldNumber = 2;
-  inline ::google::protobuf::int64 partition_cnt() const;
-  inline void set_partition_cnt(::google::protobuf::int64 value);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Mset.Kv";
+  }
+  protected:
+  explicit CmdRequest_Mset_Kv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // repeated .client.PartitionState partition_state = 3;
-  inline int partition_state_size() const;
-  inline void clear_partition_state();
-  static const int kPartitionStateFieldNumber = 3;
-  inline const ::client::PartitionState& partition_state(int index) const;
-  inline ::client::PartitionState* mutable_partition_state(int index);
-  inline ::client::PartitionState* add_partition_state();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::PartitionState >&
-      partition_state() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::PartitionState >*
-      mutable_partition_state();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoRepl)
- private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_partition_cnt();
-  inline void clear_has_partition_cnt();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // nested types ----------------------------------------------------
 
-  ::std::string* table_name_;
-  ::google::protobuf::int64 partition_cnt_;
-  ::google::protobuf::RepeatedPtrField< ::client::PartitionState > partition_state_;
+  // accessors -------------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // required bytes value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_InfoRepl* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Mset.Kv)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Mget : public ::google::protobuf::Message {
+class CmdRequest_Mset final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Mset) */ {
  public:
-  CmdResponse_Mget();
-  virtual ~CmdResponse_Mget();
+  inline CmdRequest_Mset() : CmdRequest_Mset(nullptr) {}
+  ~CmdRequest_Mset() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Mset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_Mget(const CmdResponse_Mget& from);
+  CmdRequest_Mset(const CmdRequest_Mset& from);
+  CmdRequest_Mset(CmdRequest_Mset&& from) noexcept
+    : CmdRequest_Mset() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_Mget& operator=(const CmdResponse_Mget& from) {
+  inline CmdRequest_Mset& operator=(const CmdRequest_Mset& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Mset& operator=(CmdRequest_Mset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Mget& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Mset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Mset* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Mset*>(
+               &_CmdRequest_Mset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-  void Swap(CmdResponse_Mget* other);
+  friend void swap(CmdRequest_Mset& a, CmdRequest_Mset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Mset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Mset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Mget* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Mget& from);
-  void MergeFrom(const CmdResponse_Mget& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Mset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Mset>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Mset& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Mset& from) {
+    CmdRequest_Mset::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Mset* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Mset";
+  }
+  protected:
+  explicit CmdRequest_Mset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required string key = 1;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 1;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const char* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required bytes value = 2;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 2;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const void* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.Mget)
- private:
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_value();
-  inline void clear_has_value();
+  // nested types ----------------------------------------------------
+
+  typedef CmdRequest_Mset_Kv Kv;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
 
-  ::std::string* key_;
-  ::std::string* value_;
+  enum : int {
+    kKvsFieldNumber = 2,
+    kTableNameFieldNumber = 1,
+    kPartitionIdFieldNumber = 3,
+  };
+  // repeated .client.CmdRequest.Mset.Kv kvs = 2;
+  int kvs_size() const;
+  private:
+  int _internal_kvs_size() const;
+  public:
+  void clear_kvs();
+  ::client::CmdRequest_Mset_Kv* mutable_kvs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Mset_Kv >*
+      mutable_kvs();
+  private:
+  const ::client::CmdRequest_Mset_Kv& _internal_kvs(int index) const;
+  ::client::CmdRequest_Mset_Kv* _internal_add_kvs();
+  public:
+  const ::client::CmdRequest_Mset_Kv& kvs(int index) const;
+  ::client::CmdRequest_Mset_Kv* add_kvs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Mset_Kv >&
+      kvs() const;
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // optional int32 partition_id = 3;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_Mget* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Mset)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Mset_Kv > kvs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoServer : public ::google::protobuf::Message {
+class CmdRequest_Mdel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Mdel) */ {
  public:
-  CmdResponse_InfoServer();
-  virtual ~CmdResponse_InfoServer();
+  inline CmdRequest_Mdel() : CmdRequest_Mdel(nullptr) {}
+  ~CmdRequest_Mdel() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Mdel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_InfoServer(const CmdResponse_InfoServer& from);
+  CmdRequest_Mdel(const CmdRequest_Mdel& from);
+  CmdRequest_Mdel(CmdRequest_Mdel&& from) noexcept
+    : CmdRequest_Mdel() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_InfoServer& operator=(const CmdResponse_InfoServer& from) {
+  inline CmdRequest_Mdel& operator=(const CmdRequest_Mdel& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Mdel& operator=(CmdRequest_Mdel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoServer& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Mdel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Mdel* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Mdel*>(
+               &_CmdRequest_Mdel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-  void Swap(CmdResponse_InfoServer* other);
+  friend void swap(CmdRequest_Mdel& a, CmdRequest_Mdel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Mdel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Mdel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoServer* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoServer& from);
-  void MergeFrom(const CmdResponse_InfoServer& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Mdel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Mdel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Mdel& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Mdel& from) {
+    CmdRequest_Mdel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // required int64 epoch = 1;
-  inline bool has_epoch() const;
-  inline void clear_epoch();
-  static const int kEpochFieldNumber = 1;
-  inline ::google::protobuf::int64 epoch() const;
-  inline void set_epoch(::google::protobuf::int64 value);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Mdel* other);
 
-  // repeated string table_names = 2;
-  inline int table_names_size() const;
-  inline void clear_table_names();
-  static const int kTableNamesFieldNumber = 2;
-  inline const ::std::string& table_names(int index) const;
-  inline ::std::string* mutable_table_names(int index);
-  inline void set_table_names(int index, const ::std::string& value);
-  inline void set_table_names(int index, const char* value);
-  inline void set_table_names(int index, const char* value, size_t size);
-  inline ::std::string* add_table_names();
-  inline void add_table_names(const ::std::string& value);
-  inline void add_table_names(const char* value);
-  inline void add_table_names(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& table_names() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_table_names();
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Mdel";
+  }
+  protected:
+  explicit CmdRequest_Mdel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required .client.Node cur_meta = 3;
-  inline bool has_cur_meta() const;
-  inline void clear_cur_meta();
-  static const int kCurMetaFieldNumber = 3;
-  inline const ::client::Node& cur_meta() const;
-  inline ::client::Node* mutable_cur_meta();
-  inline ::client::Node* release_cur_meta();
-  inline void set_allocated_cur_meta(::client::Node* cur_meta);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required bool meta_renewing = 4;
-  inline bool has_meta_renewing() const;
-  inline void clear_meta_renewing();
-  static const int kMetaRenewingFieldNumber = 4;
-  inline bool meta_renewing() const;
-  inline void set_meta_renewing(bool value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoServer)
- private:
-  inline void set_has_epoch();
-  inline void clear_has_epoch();
-  inline void set_has_cur_meta();
-  inline void clear_has_cur_meta();
-  inline void set_has_meta_renewing();
-  inline void clear_has_meta_renewing();
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::int64 epoch_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> table_names_;
-  ::client::Node* cur_meta_;
-  bool meta_renewing_;
+  enum : int {
+    kKeysFieldNumber = 2,
+    kTableNameFieldNumber = 1,
+    kPartitionIdFieldNumber = 3,
+  };
+  // repeated string keys = 2;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  // optional int32 partition_id = 3;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_InfoServer* default_instance_;
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Mdel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse : public ::google::protobuf::Message {
+class CmdRequest_Incrby final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Incrby) */ {
  public:
-  CmdResponse();
-  virtual ~CmdResponse();
+  inline CmdRequest_Incrby() : CmdRequest_Incrby(nullptr) {}
+  ~CmdRequest_Incrby() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Incrby(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse(const CmdResponse& from);
+  CmdRequest_Incrby(const CmdRequest_Incrby& from);
+  CmdRequest_Incrby(CmdRequest_Incrby&& from) noexcept
+    : CmdRequest_Incrby() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse& operator=(const CmdResponse& from) {
+  inline CmdRequest_Incrby& operator=(const CmdRequest_Incrby& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Incrby& operator=(CmdRequest_Incrby&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Incrby& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Incrby* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Incrby*>(
+               &_CmdRequest_Incrby_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-  void Swap(CmdResponse* other);
+  friend void swap(CmdRequest_Incrby& a, CmdRequest_Incrby& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Incrby* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Incrby* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse& from);
-  void MergeFrom(const CmdResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_Incrby* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Incrby>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Incrby& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Incrby& from) {
+    CmdRequest_Incrby::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Incrby* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Incrby";
+  }
+  protected:
+  explicit CmdRequest_Incrby(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // nested types ----------------------------------------------------
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  typedef CmdResponse_Sync Sync;
-  typedef CmdResponse_Get Get;
-  typedef CmdResponse_InfoStats InfoStats;
-  typedef CmdResponse_InfoCapacity InfoCapacity;
-  typedef CmdResponse_InfoRepl InfoRepl;
-  typedef CmdResponse_Mget Mget;
-  typedef CmdResponse_InfoServer InfoServer;
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required .client.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::client::Type type() const;
-  inline void set_type(::client::Type value);
-
-  // required .client.StatusCode code = 2;
-  inline bool has_code() const;
-  inline void clear_code();
-  static const int kCodeFieldNumber = 2;
-  inline ::client::StatusCode code() const;
-  inline void set_code(::client::StatusCode value);
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kByFieldNumber = 3,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
 
-  // optional string msg = 3;
-  inline bool has_msg() const;
-  inline void clear_msg();
-  static const int kMsgFieldNumber = 3;
-  inline const ::std::string& msg() const;
-  inline void set_msg(const ::std::string& value);
-  inline void set_msg(const char* value);
-  inline void set_msg(const char* value, size_t size);
-  inline ::std::string* mutable_msg();
-  inline ::std::string* release_msg();
-  inline void set_allocated_msg(::std::string* msg);
+  // required string key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // optional .client.CmdResponse.Sync sync = 4;
-  inline bool has_sync() const;
-  inline void clear_sync();
-  static const int kSyncFieldNumber = 4;
-  inline const ::client::CmdResponse_Sync& sync() const;
-  inline ::client::CmdResponse_Sync* mutable_sync();
-  inline ::client::CmdResponse_Sync* release_sync();
-  inline void set_allocated_sync(::client::CmdResponse_Sync* sync);
+  // required int64 by = 3;
+  bool has_by() const;
+  private:
+  bool _internal_has_by() const;
+  public:
+  void clear_by();
+  int64_t by() const;
+  void set_by(int64_t value);
+  private:
+  int64_t _internal_by() const;
+  void _internal_set_by(int64_t value);
+  public:
 
-  // optional .client.CmdResponse.Get get = 5;
-  inline bool has_get() const;
-  inline void clear_get();
-  static const int kGetFieldNumber = 5;
-  inline const ::client::CmdResponse_Get& get() const;
-  inline ::client::CmdResponse_Get* mutable_get();
-  inline ::client::CmdResponse_Get* release_get();
-  inline void set_allocated_get(::client::CmdResponse_Get* get);
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Incrby)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int64_t by_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
 
-  // optional .client.Node redirect = 6;
-  inline bool has_redirect() const;
-  inline void clear_redirect();
-  static const int kRedirectFieldNumber = 6;
-  inline const ::client::Node& redirect() const;
-  inline ::client::Node* mutable_redirect();
-  inline ::client::Node* release_redirect();
-  inline void set_allocated_redirect(::client::Node* redirect);
+class CmdRequest_Append final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest.Append) */ {
+ public:
+  inline CmdRequest_Append() : CmdRequest_Append(nullptr) {}
+  ~CmdRequest_Append() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Append(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  inline int info_stats_size() const;
-  inline void clear_info_stats();
-  static const int kInfoStatsFieldNumber = 7;
-  inline const ::client::CmdResponse_InfoStats& info_stats(int index) const;
-  inline ::client::CmdResponse_InfoStats* mutable_info_stats(int index);
-  inline ::client::CmdResponse_InfoStats* add_info_stats();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
-      info_stats() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
-      mutable_info_stats();
+  CmdRequest_Append(const CmdRequest_Append& from);
+  CmdRequest_Append(CmdRequest_Append&& from) noexcept
+    : CmdRequest_Append() {
+    *this = ::std::move(from);
+  }
 
-  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  inline int info_capacity_size() const;
-  inline void clear_info_capacity();
-  static const int kInfoCapacityFieldNumber = 8;
-  inline const ::client::CmdResponse_InfoCapacity& info_capacity(int index) const;
-  inline ::client::CmdResponse_InfoCapacity* mutable_info_capacity(int index);
-  inline ::client::CmdResponse_InfoCapacity* add_info_capacity();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
-      info_capacity() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
-      mutable_info_capacity();
+  inline CmdRequest_Append& operator=(const CmdRequest_Append& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdRequest_Append& operator=(CmdRequest_Append&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  inline int info_repl_size() const;
-  inline void clear_info_repl();
-  static const int kInfoReplFieldNumber = 9;
-  inline const ::client::CmdResponse_InfoRepl& info_repl(int index) const;
-  inline ::client::CmdResponse_InfoRepl* mutable_info_repl(int index);
-  inline ::client::CmdResponse_InfoRepl* add_info_repl();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
-      info_repl() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
-      mutable_info_repl();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
 
-  // repeated .client.CmdResponse.Mget mget = 10;
-  inline int mget_size() const;
-  inline void clear_mget();
-  static const int kMgetFieldNumber = 10;
-  inline const ::client::CmdResponse_Mget& mget(int index) const;
-  inline ::client::CmdResponse_Mget* mutable_mget(int index);
-  inline ::client::CmdResponse_Mget* add_mget();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >&
-      mget() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >*
-      mutable_mget();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Append& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Append* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Append*>(
+               &_CmdRequest_Append_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-  // optional .client.CmdResponse.InfoServer info_server = 11;
-  inline bool has_info_server() const;
-  inline void clear_info_server();
-  static const int kInfoServerFieldNumber = 11;
-  inline const ::client::CmdResponse_InfoServer& info_server() const;
-  inline ::client::CmdResponse_InfoServer* mutable_info_server();
-  inline ::client::CmdResponse_InfoServer* release_info_server();
-  inline void set_allocated_info_server(::client::CmdResponse_InfoServer* info_server);
+  friend void swap(CmdRequest_Append& a, CmdRequest_Append& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Append* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Append* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse)
+  // implements Message ----------------------------------------------
+
+  CmdRequest_Append* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Append>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Append& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Append& from) {
+    CmdRequest_Append::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Append* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest.Append";
+  }
+  protected:
+  explicit CmdRequest_Append(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required string key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required bytes value = 3;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Append)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_code();
-  inline void clear_has_code();
-  inline void set_has_msg();
-  inline void clear_has_msg();
-  inline void set_has_sync();
-  inline void clear_has_sync();
-  inline void set_has_get();
-  inline void clear_has_get();
-  inline void set_has_redirect();
-  inline void clear_has_redirect();
-  inline void set_has_info_server();
-  inline void clear_has_info_server();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  int type_;
-  int code_;
-  ::std::string* msg_;
-  ::client::CmdResponse_Sync* sync_;
-  ::client::CmdResponse_Get* get_;
-  ::client::Node* redirect_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats > info_stats_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity > info_capacity_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl > info_repl_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget > mget_;
-  ::client::CmdResponse_InfoServer* info_server_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(11 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdResponse* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BinlogSkip : public ::google::protobuf::Message {
+class CmdRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdRequest) */ {
  public:
-  BinlogSkip();
-  virtual ~BinlogSkip();
+  inline CmdRequest() : CmdRequest(nullptr) {}
+  ~CmdRequest() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BinlogSkip(const BinlogSkip& from);
+  CmdRequest(const CmdRequest& from);
+  CmdRequest(CmdRequest&& from) noexcept
+    : CmdRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline BinlogSkip& operator=(const BinlogSkip& from) {
+  inline CmdRequest& operator=(const CmdRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest& operator=(CmdRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BinlogSkip& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest*>(
+               &_CmdRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
 
-  void Swap(BinlogSkip* other);
+  friend void swap(CmdRequest& a, CmdRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  BinlogSkip* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BinlogSkip& from);
-  void MergeFrom(const BinlogSkip& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest& from) {
+    CmdRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdRequest";
+  }
+  protected:
+  explicit CmdRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef CmdRequest_Sync Sync;
+  typedef CmdRequest_Set Set;
+  typedef CmdRequest_Get Get;
+  typedef CmdRequest_Del Del;
+  typedef CmdRequest_Info Info;
+  typedef CmdRequest_Mget Mget;
+  typedef CmdRequest_Msync Msync;
+  typedef CmdRequest_Subscribe Subscribe;
+  typedef CmdRequest_Mset Mset;
+  typedef CmdRequest_Mdel Mdel;
+  typedef CmdRequest_Incrby Incrby;
+  typedef CmdRequest_Append Append;
+
   // accessors -------------------------------------------------------
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  enum : int {
+    kSyncFieldNumber = 2,
+    kSetFieldNumber = 3,
+    kGetFieldNumber = 4,
+    kDelFieldNumber = 5,
+    kInfoFieldNumber = 6,
+    kMgetFieldNumber = 7,
+    kMsyncFieldNumber = 8,
+    kSubscribeFieldNumber = 9,
+    kMsetFieldNumber = 10,
+    kMdelFieldNumber = 11,
+    kIncrbyFieldNumber = 12,
+    kAppendFieldNumber = 13,
+    kWriteUsFieldNumber = 14,
+    kTypeFieldNumber = 1,
+  };
+  // optional .client.CmdRequest.Sync sync = 2;
+  bool has_sync() const;
+  private:
+  bool _internal_has_sync() const;
+  public:
+  void clear_sync();
+  const ::client::CmdRequest_Sync& sync() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Sync* release_sync();
+  ::client::CmdRequest_Sync* mutable_sync();
+  void set_allocated_sync(::client::CmdRequest_Sync* sync);
+  private:
+  const ::client::CmdRequest_Sync& _internal_sync() const;
+  ::client::CmdRequest_Sync* _internal_mutable_sync();
+  public:
+  void unsafe_arena_set_allocated_sync(
+      ::client::CmdRequest_Sync* sync);
+  ::client::CmdRequest_Sync* unsafe_arena_release_sync();
 
-  // required int32 partition_id = 2;
-  inline bool has_partition_id() const;
-  inline void clear_partition_id();
-  static const int kPartitionIdFieldNumber = 2;
-  inline ::google::protobuf::int32 partition_id() const;
-  inline void set_partition_id(::google::protobuf::int32 value);
+  // optional .client.CmdRequest.Set set = 3;
+  bool has_set() const;
+  private:
+  bool _internal_has_set() const;
+  public:
+  void clear_set();
+  const ::client::CmdRequest_Set& set() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Set* release_set();
+  ::client::CmdRequest_Set* mutable_set();
+  void set_allocated_set(::client::CmdRequest_Set* set);
+  private:
+  const ::client::CmdRequest_Set& _internal_set() const;
+  ::client::CmdRequest_Set* _internal_mutable_set();
+  public:
+  void unsafe_arena_set_allocated_set(
+      ::client::CmdRequest_Set* set);
+  ::client::CmdRequest_Set* unsafe_arena_release_set();
 
-  // required int64 gap = 3;
-  inline bool has_gap() const;
-  inline void clear_gap();
-  static const int kGapFieldNumber = 3;
-  inline ::google::protobuf::int64 gap() const;
-  inline void set_gap(::google::protobuf::int64 value);
+  // optional .client.CmdRequest.Get get = 4;
+  bool has_get() const;
+  private:
+  bool _internal_has_get() const;
+  public:
+  void clear_get();
+  const ::client::CmdRequest_Get& get() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Get* release_get();
+  ::client::CmdRequest_Get* mutable_get();
+  void set_allocated_get(::client::CmdRequest_Get* get);
+  private:
+  const ::client::CmdRequest_Get& _internal_get() const;
+  ::client::CmdRequest_Get* _internal_mutable_get();
+  public:
+  void unsafe_arena_set_allocated_get(
+      ::client::CmdRequest_Get* get);
+  ::client::CmdRequest_Get* unsafe_arena_release_get();
 
-  // @@protoc_insertion_point(class_scope:client.BinlogSkip)
+  // optional .client.CmdRequest.Del del = 5;
+  bool has_del() const;
+  private:
+  bool _internal_has_del() const;
+  public:
+  void clear_del();
+  const ::client::CmdRequest_Del& del() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Del* release_del();
+  ::client::CmdRequest_Del* mutable_del();
+  void set_allocated_del(::client::CmdRequest_Del* del);
+  private:
+  const ::client::CmdRequest_Del& _internal_del() const;
+  ::client::CmdRequest_Del* _internal_mutable_del();
+  public:
+  void unsafe_arena_set_allocated_del(
+      ::client::CmdRequest_Del* del);
+  ::client::CmdRequest_Del* unsafe_arena_release_del();
+
+  // optional .client.CmdRequest.Info info = 6;
+  bool has_info() const;
+  private:
+  bool _internal_has_info() const;
+  public:
+  void clear_info();
+  const ::client::CmdRequest_Info& info() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Info* release_info();
+  ::client::CmdRequest_Info* mutable_info();
+  void set_allocated_info(::client::CmdRequest_Info* info);
+  private:
+  const ::client::CmdRequest_Info& _internal_info() const;
+  ::client::CmdRequest_Info* _internal_mutable_info();
+  public:
+  void unsafe_arena_set_allocated_info(
+      ::client::CmdRequest_Info* info);
+  ::client::CmdRequest_Info* unsafe_arena_release_info();
+
+  // optional .client.CmdRequest.Mget mget = 7;
+  bool has_mget() const;
+  private:
+  bool _internal_has_mget() const;
+  public:
+  void clear_mget();
+  const ::client::CmdRequest_Mget& mget() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Mget* release_mget();
+  ::client::CmdRequest_Mget* mutable_mget();
+  void set_allocated_mget(::client::CmdRequest_Mget* mget);
+  private:
+  const ::client::CmdRequest_Mget& _internal_mget() const;
+  ::client::CmdRequest_Mget* _internal_mutable_mget();
+  public:
+  void unsafe_arena_set_allocated_mget(
+      ::client::CmdRequest_Mget* mget);
+  ::client::CmdRequest_Mget* unsafe_arena_release_mget();
+
+  // optional .client.CmdRequest.Msync msync = 8;
+  bool has_msync() const;
+  private:
+  bool _internal_has_msync() const;
+  public:
+  void clear_msync();
+  const ::client::CmdRequest_Msync& msync() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Msync* release_msync();
+  ::client::CmdRequest_Msync* mutable_msync();
+  void set_allocated_msync(::client::CmdRequest_Msync* msync);
+  private:
+  const ::client::CmdRequest_Msync& _internal_msync() const;
+  ::client::CmdRequest_Msync* _internal_mutable_msync();
+  public:
+  void unsafe_arena_set_allocated_msync(
+      ::client::CmdRequest_Msync* msync);
+  ::client::CmdRequest_Msync* unsafe_arena_release_msync();
+
+  // optional .client.CmdRequest.Subscribe subscribe = 9;
+  bool has_subscribe() const;
+  private:
+  bool _internal_has_subscribe() const;
+  public:
+  void clear_subscribe();
+  const ::client::CmdRequest_Subscribe& subscribe() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Subscribe* release_subscribe();
+  ::client::CmdRequest_Subscribe* mutable_subscribe();
+  void set_allocated_subscribe(::client::CmdRequest_Subscribe* subscribe);
+  private:
+  const ::client::CmdRequest_Subscribe& _internal_subscribe() const;
+  ::client::CmdRequest_Subscribe* _internal_mutable_subscribe();
+  public:
+  void unsafe_arena_set_allocated_subscribe(
+      ::client::CmdRequest_Subscribe* subscribe);
+  ::client::CmdRequest_Subscribe* unsafe_arena_release_subscribe();
+
+  // optional .client.CmdRequest.Mset mset = 10;
+  bool has_mset() const;
+  private:
+  bool _internal_has_mset() const;
+  public:
+  void clear_mset();
+  const ::client::CmdRequest_Mset& mset() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Mset* release_mset();
+  ::client::CmdRequest_Mset* mutable_mset();
+  void set_allocated_mset(::client::CmdRequest_Mset* mset);
+  private:
+  const ::client::CmdRequest_Mset& _internal_mset() const;
+  ::client::CmdRequest_Mset* _internal_mutable_mset();
+  public:
+  void unsafe_arena_set_allocated_mset(
+      ::client::CmdRequest_Mset* mset);
+  ::client::CmdRequest_Mset* unsafe_arena_release_mset();
+
+  // optional .client.CmdRequest.Mdel mdel = 11;
+  bool has_mdel() const;
+  private:
+  bool _internal_has_mdel() const;
+  public:
+  void clear_mdel();
+  const ::client::CmdRequest_Mdel& mdel() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Mdel* release_mdel();
+  ::client::CmdRequest_Mdel* mutable_mdel();
+  void set_allocated_mdel(::client::CmdRequest_Mdel* mdel);
+  private:
+  const ::client::CmdRequest_Mdel& _internal_mdel() const;
+  ::client::CmdRequest_Mdel* _internal_mutable_mdel();
+  public:
+  void unsafe_arena_set_allocated_mdel(
+      ::client::CmdRequest_Mdel* mdel);
+  ::client::CmdRequest_Mdel* unsafe_arena_release_mdel();
+
+  // optional .client.CmdRequest.Incrby incrby = 12;
+  bool has_incrby() const;
+  private:
+  bool _internal_has_incrby() const;
+  public:
+  void clear_incrby();
+  const ::client::CmdRequest_Incrby& incrby() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Incrby* release_incrby();
+  ::client::CmdRequest_Incrby* mutable_incrby();
+  void set_allocated_incrby(::client::CmdRequest_Incrby* incrby);
+  private:
+  const ::client::CmdRequest_Incrby& _internal_incrby() const;
+  ::client::CmdRequest_Incrby* _internal_mutable_incrby();
+  public:
+  void unsafe_arena_set_allocated_incrby(
+      ::client::CmdRequest_Incrby* incrby);
+  ::client::CmdRequest_Incrby* unsafe_arena_release_incrby();
+
+  // optional .client.CmdRequest.Append append = 13;
+  bool has_append() const;
+  private:
+  bool _internal_has_append() const;
+  public:
+  void clear_append();
+  const ::client::CmdRequest_Append& append() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest_Append* release_append();
+  ::client::CmdRequest_Append* mutable_append();
+  void set_allocated_append(::client::CmdRequest_Append* append);
+  private:
+  const ::client::CmdRequest_Append& _internal_append() const;
+  ::client::CmdRequest_Append* _internal_mutable_append();
+  public:
+  void unsafe_arena_set_allocated_append(
+      ::client::CmdRequest_Append* append);
+  ::client::CmdRequest_Append* unsafe_arena_release_append();
+
+  // optional int64 write_us = 14;
+  bool has_write_us() const;
+  private:
+  bool _internal_has_write_us() const;
+  public:
+  void clear_write_us();
+  int64_t write_us() const;
+  void set_write_us(int64_t value);
+  private:
+  int64_t _internal_write_us() const;
+  void _internal_set_write_us(int64_t value);
+  public:
+
+  // required .client.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::client::Type type() const;
+  void set_type(::client::Type value);
+  private:
+  ::client::Type _internal_type() const;
+  void _internal_set_type(::client::Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest)
  private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_partition_id();
-  inline void clear_has_partition_id();
-  inline void set_has_gap();
-  inline void clear_has_gap();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::client::CmdRequest_Sync* sync_;
+    ::client::CmdRequest_Set* set_;
+    ::client::CmdRequest_Get* get_;
+    ::client::CmdRequest_Del* del_;
+    ::client::CmdRequest_Info* info_;
+    ::client::CmdRequest_Mget* mget_;
+    ::client::CmdRequest_Msync* msync_;
+    ::client::CmdRequest_Subscribe* subscribe_;
+    ::client::CmdRequest_Mset* mset_;
+    ::client::CmdRequest_Mdel* mdel_;
+    ::client::CmdRequest_Incrby* incrby_;
+    ::client::CmdRequest_Append* append_;
+    int64_t write_us_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Sync final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Sync) */ {
+ public:
+  inline CmdResponse_Sync() : CmdResponse_Sync(nullptr) {}
+  ~CmdResponse_Sync() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Sync(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Sync(const CmdResponse_Sync& from);
+  CmdResponse_Sync(CmdResponse_Sync&& from) noexcept
+    : CmdResponse_Sync() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Sync& operator=(const CmdResponse_Sync& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Sync& operator=(CmdResponse_Sync&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Sync& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Sync* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Sync*>(
+               &_CmdResponse_Sync_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(CmdResponse_Sync& a, CmdResponse_Sync& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Sync* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Sync* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Sync* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Sync>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Sync& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Sync& from) {
+    CmdResponse_Sync::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Sync* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Sync";
+  }
+  protected:
+  explicit CmdResponse_Sync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplHistoryFieldNumber = 3,
+    kTableNameFieldNumber = 1,
+    kSyncOffsetFieldNumber = 2,
+  };
+  // repeated .client.ReplTerm repl_history = 3;
+  int repl_history_size() const;
+  private:
+  int _internal_repl_history_size() const;
+  public:
+  void clear_repl_history();
+  ::client::ReplTerm* mutable_repl_history(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::ReplTerm >*
+      mutable_repl_history();
+  private:
+  const ::client::ReplTerm& _internal_repl_history(int index) const;
+  ::client::ReplTerm* _internal_add_repl_history();
+  public:
+  const ::client::ReplTerm& repl_history(int index) const;
+  ::client::ReplTerm* add_repl_history();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::ReplTerm >&
+      repl_history() const;
+
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required .client.SyncOffset sync_offset = 2;
+  bool has_sync_offset() const;
+  private:
+  bool _internal_has_sync_offset() const;
+  public:
+  void clear_sync_offset();
+  const ::client::SyncOffset& sync_offset() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_sync_offset();
+  ::client::SyncOffset* mutable_sync_offset();
+  void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  private:
+  const ::client::SyncOffset& _internal_sync_offset() const;
+  ::client::SyncOffset* _internal_mutable_sync_offset();
+  public:
+  void unsafe_arena_set_allocated_sync_offset(
+      ::client::SyncOffset* sync_offset);
+  ::client::SyncOffset* unsafe_arena_release_sync_offset();
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Sync)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::ReplTerm > repl_history_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    ::client::SyncOffset* sync_offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
 
-  ::std::string* table_name_;
-  ::google::protobuf::int64 gap_;
-  ::google::protobuf::int32 partition_id_;
+class CmdResponse_Get final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Get) */ {
+ public:
+  inline CmdResponse_Get() : CmdResponse_Get(nullptr) {}
+  ~CmdResponse_Get() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Get(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  CmdResponse_Get(const CmdResponse_Get& from);
+  CmdResponse_Get(CmdResponse_Get&& from) noexcept
+    : CmdResponse_Get() {
+    *this = ::std::move(from);
+  }
 
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
+  inline CmdResponse_Get& operator=(const CmdResponse_Get& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Get& operator=(CmdResponse_Get&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Get& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Get* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Get*>(
+               &_CmdResponse_Get_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(CmdResponse_Get& a, CmdResponse_Get& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Get* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Get* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Get* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Get>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Get& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Get& from) {
+    CmdResponse_Get::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Get* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Get";
+  }
+  protected:
+  explicit CmdResponse_Get(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // optional bytes value = 1;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Get)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InfoStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.InfoStats) */ {
+ public:
+  inline CmdResponse_InfoStats() : CmdResponse_InfoStats(nullptr) {}
+  ~CmdResponse_InfoStats() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_InfoStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_InfoStats(const CmdResponse_InfoStats& from);
+  CmdResponse_InfoStats(CmdResponse_InfoStats&& from) noexcept
+    : CmdResponse_InfoStats() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_InfoStats& operator=(const CmdResponse_InfoStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_InfoStats& operator=(CmdResponse_InfoStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_InfoStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_InfoStats* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_InfoStats*>(
+               &_CmdResponse_InfoStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(CmdResponse_InfoStats& a, CmdResponse_InfoStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_InfoStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_InfoStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InfoStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_InfoStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_InfoStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_InfoStats& from) {
+    CmdResponse_InfoStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_InfoStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.InfoStats";
+  }
+  protected:
+  explicit CmdResponse_InfoStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kTotalQuerysFieldNumber = 2,
+    kQpsFieldNumber = 3,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int64 total_querys = 2;
+  bool has_total_querys() const;
+  private:
+  bool _internal_has_total_querys() const;
+  public:
+  void clear_total_querys();
+  int64_t total_querys() const;
+  void set_total_querys(int64_t value);
+  private:
+  int64_t _internal_total_querys() const;
+  void _internal_set_total_querys(int64_t value);
+  public:
+
+  // required int32 qps = 3;
+  bool has_qps() const;
+  private:
+  bool _internal_has_qps() const;
+  public:
+  void clear_qps();
+  int32_t qps() const;
+  void set_qps(int32_t value);
+  private:
+  int32_t _internal_qps() const;
+  void _internal_set_qps(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoStats)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int64_t total_querys_;
+    int32_t qps_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InfoCapacity final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.InfoCapacity) */ {
+ public:
+  inline CmdResponse_InfoCapacity() : CmdResponse_InfoCapacity(nullptr) {}
+  ~CmdResponse_InfoCapacity() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_InfoCapacity(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from);
+  CmdResponse_InfoCapacity(CmdResponse_InfoCapacity&& from) noexcept
+    : CmdResponse_InfoCapacity() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_InfoCapacity& operator=(const CmdResponse_InfoCapacity& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_InfoCapacity& operator=(CmdResponse_InfoCapacity&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_InfoCapacity& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_InfoCapacity* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_InfoCapacity*>(
+               &_CmdResponse_InfoCapacity_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(CmdResponse_InfoCapacity& a, CmdResponse_InfoCapacity& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_InfoCapacity* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_InfoCapacity* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InfoCapacity* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_InfoCapacity>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_InfoCapacity& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_InfoCapacity& from) {
+    CmdResponse_InfoCapacity::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_InfoCapacity* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.InfoCapacity";
+  }
+  protected:
+  explicit CmdResponse_InfoCapacity(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kUsedFieldNumber = 2,
+    kRemainFieldNumber = 3,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int64 used = 2;
+  bool has_used() const;
+  private:
+  bool _internal_has_used() const;
+  public:
+  void clear_used();
+  int64_t used() const;
+  void set_used(int64_t value);
+  private:
+  int64_t _internal_used() const;
+  void _internal_set_used(int64_t value);
+  public:
+
+  // required int64 remain = 3;
+  bool has_remain() const;
+  private:
+  bool _internal_has_remain() const;
+  public:
+  void clear_remain();
+  int64_t remain() const;
+  void set_remain(int64_t value);
+  private:
+  int64_t _internal_remain() const;
+  void _internal_set_remain(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoCapacity)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int64_t used_;
+    int64_t remain_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InfoRepl final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.InfoRepl) */ {
+ public:
+  inline CmdResponse_InfoRepl() : CmdResponse_InfoRepl(nullptr) {}
+  ~CmdResponse_InfoRepl() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_InfoRepl(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from);
+  CmdResponse_InfoRepl(CmdResponse_InfoRepl&& from) noexcept
+    : CmdResponse_InfoRepl() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_InfoRepl& operator=(const CmdResponse_InfoRepl& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_InfoRepl& operator=(CmdResponse_InfoRepl&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_InfoRepl& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_InfoRepl* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_InfoRepl*>(
+               &_CmdResponse_InfoRepl_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(CmdResponse_InfoRepl& a, CmdResponse_InfoRepl& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_InfoRepl* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_InfoRepl* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InfoRepl* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_InfoRepl>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_InfoRepl& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_InfoRepl& from) {
+    CmdResponse_InfoRepl::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_InfoRepl* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.InfoRepl";
+  }
+  protected:
+  explicit CmdResponse_InfoRepl(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPartitionStateFieldNumber = 3,
+    kTableNameFieldNumber = 1,
+    kPartitionCntFieldNumber = 2,
+  };
+  // repeated .client.PartitionState partition_state = 3;
+  int partition_state_size() const;
+  private:
+  int _internal_partition_state_size() const;
+  public:
+  void clear_partition_state();
+  ::client::PartitionState* mutable_partition_state(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState >*
+      mutable_partition_state();
+  private:
+  const ::client::PartitionState& _internal_partition_state(int index) const;
+  ::client::PartitionState* _internal_add_partition_state();
+  public:
+  const ::client::PartitionState& partition_state(int index) const;
+  ::client::PartitionState* add_partition_state();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState >&
+      partition_state() const;
+
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int64 partition_cnt = 2;
+  bool has_partition_cnt() const;
+  private:
+  bool _internal_has_partition_cnt() const;
+  public:
+  void clear_partition_cnt();
+  int64_t partition_cnt() const;
+  void set_partition_cnt(int64_t value);
+  private:
+  int64_t _internal_partition_cnt() const;
+  void _internal_set_partition_cnt(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoRepl)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState > partition_state_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int64_t partition_cnt_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Mget final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Mget) */ {
+ public:
+  inline CmdResponse_Mget() : CmdResponse_Mget(nullptr) {}
+  ~CmdResponse_Mget() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Mget(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Mget(const CmdResponse_Mget& from);
+  CmdResponse_Mget(CmdResponse_Mget&& from) noexcept
+    : CmdResponse_Mget() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Mget& operator=(const CmdResponse_Mget& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Mget& operator=(CmdResponse_Mget&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Mget& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Mget* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Mget*>(
+               &_CmdResponse_Mget_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(CmdResponse_Mget& a, CmdResponse_Mget& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Mget* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Mget* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Mget* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Mget>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Mget& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Mget& from) {
+    CmdResponse_Mget::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Mget* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Mget";
+  }
+  protected:
+  explicit CmdResponse_Mget(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kMsgFieldNumber = 4,
+    kRedirectFieldNumber = 5,
+    kCodeFieldNumber = 3,
+  };
+  // required string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // required bytes value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // optional string msg = 4;
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // optional .client.Node redirect = 5;
+  bool has_redirect() const;
+  private:
+  bool _internal_has_redirect() const;
+  public:
+  void clear_redirect();
+  const ::client::Node& redirect() const;
+  PROTOBUF_NODISCARD ::client::Node* release_redirect();
+  ::client::Node* mutable_redirect();
+  void set_allocated_redirect(::client::Node* redirect);
+  private:
+  const ::client::Node& _internal_redirect() const;
+  ::client::Node* _internal_mutable_redirect();
+  public:
+  void unsafe_arena_set_allocated_redirect(
+      ::client::Node* redirect);
+  ::client::Node* unsafe_arena_release_redirect();
+
+  // optional .client.StatusCode code = 3 [default = kOk];
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  ::client::StatusCode code() const;
+  void set_code(::client::StatusCode value);
+  private:
+  ::client::StatusCode _internal_code() const;
+  void _internal_set_code(::client::StatusCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Mget)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::client::Node* redirect_;
+    int code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InfoServer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.InfoServer) */ {
+ public:
+  inline CmdResponse_InfoServer() : CmdResponse_InfoServer(nullptr) {}
+  ~CmdResponse_InfoServer() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_InfoServer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_InfoServer(const CmdResponse_InfoServer& from);
+  CmdResponse_InfoServer(CmdResponse_InfoServer&& from) noexcept
+    : CmdResponse_InfoServer() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_InfoServer& operator=(const CmdResponse_InfoServer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_InfoServer& operator=(CmdResponse_InfoServer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_InfoServer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_InfoServer* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_InfoServer*>(
+               &_CmdResponse_InfoServer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(CmdResponse_InfoServer& a, CmdResponse_InfoServer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_InfoServer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_InfoServer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InfoServer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_InfoServer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_InfoServer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_InfoServer& from) {
+    CmdResponse_InfoServer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_InfoServer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.InfoServer";
+  }
+  protected:
+  explicit CmdResponse_InfoServer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNamesFieldNumber = 2,
+    kCurMetaFieldNumber = 3,
+    kEpochFieldNumber = 1,
+    kMetaRenewingFieldNumber = 4,
+  };
+  // repeated string table_names = 2;
+  int table_names_size() const;
+  private:
+  int _internal_table_names_size() const;
+  public:
+  void clear_table_names();
+  const std::string& table_names(int index) const;
+  std::string* mutable_table_names(int index);
+  void set_table_names(int index, const std::string& value);
+  void set_table_names(int index, std::string&& value);
+  void set_table_names(int index, const char* value);
+  void set_table_names(int index, const char* value, size_t size);
+  std::string* add_table_names();
+  void add_table_names(const std::string& value);
+  void add_table_names(std::string&& value);
+  void add_table_names(const char* value);
+  void add_table_names(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& table_names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_table_names();
+  private:
+  const std::string& _internal_table_names(int index) const;
+  std::string* _internal_add_table_names();
+  public:
+
+  // required .client.Node cur_meta = 3;
+  bool has_cur_meta() const;
+  private:
+  bool _internal_has_cur_meta() const;
+  public:
+  void clear_cur_meta();
+  const ::client::Node& cur_meta() const;
+  PROTOBUF_NODISCARD ::client::Node* release_cur_meta();
+  ::client::Node* mutable_cur_meta();
+  void set_allocated_cur_meta(::client::Node* cur_meta);
+  private:
+  const ::client::Node& _internal_cur_meta() const;
+  ::client::Node* _internal_mutable_cur_meta();
+  public:
+  void unsafe_arena_set_allocated_cur_meta(
+      ::client::Node* cur_meta);
+  ::client::Node* unsafe_arena_release_cur_meta();
+
+  // required int64 epoch = 1;
+  bool has_epoch() const;
+  private:
+  bool _internal_has_epoch() const;
+  public:
+  void clear_epoch();
+  int64_t epoch() const;
+  void set_epoch(int64_t value);
+  private:
+  int64_t _internal_epoch() const;
+  void _internal_set_epoch(int64_t value);
+  public:
+
+  // required bool meta_renewing = 4;
+  bool has_meta_renewing() const;
+  private:
+  bool _internal_has_meta_renewing() const;
+  public:
+  void clear_meta_renewing();
+  bool meta_renewing() const;
+  void set_meta_renewing(bool value);
+  private:
+  bool _internal_meta_renewing() const;
+  void _internal_set_meta_renewing(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoServer)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> table_names_;
+    ::client::Node* cur_meta_;
+    int64_t epoch_;
+    bool meta_renewing_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Subscribe_Record final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Subscribe.Record) */ {
+ public:
+  inline CmdResponse_Subscribe_Record() : CmdResponse_Subscribe_Record(nullptr) {}
+  ~CmdResponse_Subscribe_Record() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Subscribe_Record(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Subscribe_Record(const CmdResponse_Subscribe_Record& from);
+  CmdResponse_Subscribe_Record(CmdResponse_Subscribe_Record&& from) noexcept
+    : CmdResponse_Subscribe_Record() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Subscribe_Record& operator=(const CmdResponse_Subscribe_Record& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Subscribe_Record& operator=(CmdResponse_Subscribe_Record&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Subscribe_Record& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Subscribe_Record* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Subscribe_Record*>(
+               &_CmdResponse_Subscribe_Record_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(CmdResponse_Subscribe_Record& a, CmdResponse_Subscribe_Record& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Subscribe_Record* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Subscribe_Record* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Subscribe_Record* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Subscribe_Record>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Subscribe_Record& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Subscribe_Record& from) {
+    CmdResponse_Subscribe_Record::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Subscribe_Record* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Subscribe.Record";
+  }
+  protected:
+  explicit CmdResponse_Subscribe_Record(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kCursorFieldNumber = 5,
+    kPartitionFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // required bytes key = 3;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional bytes value = 4;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // required .client.SyncOffset cursor = 5;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const ::client::SyncOffset& cursor() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_cursor();
+  ::client::SyncOffset* mutable_cursor();
+  void set_allocated_cursor(::client::SyncOffset* cursor);
+  private:
+  const ::client::SyncOffset& _internal_cursor() const;
+  ::client::SyncOffset* _internal_mutable_cursor();
+  public:
+  void unsafe_arena_set_allocated_cursor(
+      ::client::SyncOffset* cursor);
+  ::client::SyncOffset* unsafe_arena_release_cursor();
+
+  // required int32 partition = 1;
+  bool has_partition() const;
+  private:
+  bool _internal_has_partition() const;
+  public:
+  void clear_partition();
+  int32_t partition() const;
+  void set_partition(int32_t value);
+  private:
+  int32_t _internal_partition() const;
+  void _internal_set_partition(int32_t value);
+  public:
+
+  // required .client.Type type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::client::Type type() const;
+  void set_type(::client::Type value);
+  private:
+  ::client::Type _internal_type() const;
+  void _internal_set_type(::client::Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Subscribe.Record)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::client::SyncOffset* cursor_;
+    int32_t partition_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Subscribe final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Subscribe) */ {
+ public:
+  inline CmdResponse_Subscribe() : CmdResponse_Subscribe(nullptr) {}
+  ~CmdResponse_Subscribe() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Subscribe(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Subscribe(const CmdResponse_Subscribe& from);
+  CmdResponse_Subscribe(CmdResponse_Subscribe&& from) noexcept
+    : CmdResponse_Subscribe() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Subscribe& operator=(const CmdResponse_Subscribe& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Subscribe& operator=(CmdResponse_Subscribe&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Subscribe& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Subscribe* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Subscribe*>(
+               &_CmdResponse_Subscribe_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(CmdResponse_Subscribe& a, CmdResponse_Subscribe& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Subscribe* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Subscribe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Subscribe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Subscribe>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Subscribe& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Subscribe& from) {
+    CmdResponse_Subscribe::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Subscribe* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Subscribe";
+  }
+  protected:
+  explicit CmdResponse_Subscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CmdResponse_Subscribe_Record Record;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecordsFieldNumber = 1,
+    kCursorsFieldNumber = 2,
+  };
+  // repeated .client.CmdResponse.Subscribe.Record records = 1;
+  int records_size() const;
+  private:
+  int _internal_records_size() const;
+  public:
+  void clear_records();
+  ::client::CmdResponse_Subscribe_Record* mutable_records(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Subscribe_Record >*
+      mutable_records();
+  private:
+  const ::client::CmdResponse_Subscribe_Record& _internal_records(int index) const;
+  ::client::CmdResponse_Subscribe_Record* _internal_add_records();
+  public:
+  const ::client::CmdResponse_Subscribe_Record& records(int index) const;
+  ::client::CmdResponse_Subscribe_Record* add_records();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Subscribe_Record >&
+      records() const;
+
+  // repeated .client.SyncOffset cursors = 2;
+  int cursors_size() const;
+  private:
+  int _internal_cursors_size() const;
+  public:
+  void clear_cursors();
+  ::client::SyncOffset* mutable_cursors(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >*
+      mutable_cursors();
+  private:
+  const ::client::SyncOffset& _internal_cursors(int index) const;
+  ::client::SyncOffset* _internal_add_cursors();
+  public:
+  const ::client::SyncOffset& cursors(int index) const;
+  ::client::SyncOffset* add_cursors();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >&
+      cursors() const;
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Subscribe)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Subscribe_Record > records_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset > cursors_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_KeyResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.KeyResult) */ {
+ public:
+  inline CmdResponse_KeyResult() : CmdResponse_KeyResult(nullptr) {}
+  ~CmdResponse_KeyResult() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_KeyResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_KeyResult(const CmdResponse_KeyResult& from);
+  CmdResponse_KeyResult(CmdResponse_KeyResult&& from) noexcept
+    : CmdResponse_KeyResult() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_KeyResult& operator=(const CmdResponse_KeyResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_KeyResult& operator=(CmdResponse_KeyResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_KeyResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_KeyResult* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_KeyResult*>(
+               &_CmdResponse_KeyResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(CmdResponse_KeyResult& a, CmdResponse_KeyResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_KeyResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_KeyResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_KeyResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_KeyResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_KeyResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_KeyResult& from) {
+    CmdResponse_KeyResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_KeyResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.KeyResult";
+  }
+  protected:
+  explicit CmdResponse_KeyResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kMsgFieldNumber = 3,
+    kRedirectFieldNumber = 4,
+    kCodeFieldNumber = 2,
+  };
+  // required string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional string msg = 3;
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // optional .client.Node redirect = 4;
+  bool has_redirect() const;
+  private:
+  bool _internal_has_redirect() const;
+  public:
+  void clear_redirect();
+  const ::client::Node& redirect() const;
+  PROTOBUF_NODISCARD ::client::Node* release_redirect();
+  ::client::Node* mutable_redirect();
+  void set_allocated_redirect(::client::Node* redirect);
+  private:
+  const ::client::Node& _internal_redirect() const;
+  ::client::Node* _internal_mutable_redirect();
+  public:
+  void unsafe_arena_set_allocated_redirect(
+      ::client::Node* redirect);
+  ::client::Node* unsafe_arena_release_redirect();
+
+  // required .client.StatusCode code = 2;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  ::client::StatusCode code() const;
+  void set_code(::client::StatusCode value);
+  private:
+  ::client::StatusCode _internal_code() const;
+  void _internal_set_code(::client::StatusCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.KeyResult)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::client::Node* redirect_;
+    int code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Incrby final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Incrby) */ {
+ public:
+  inline CmdResponse_Incrby() : CmdResponse_Incrby(nullptr) {}
+  ~CmdResponse_Incrby() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Incrby(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Incrby(const CmdResponse_Incrby& from);
+  CmdResponse_Incrby(CmdResponse_Incrby&& from) noexcept
+    : CmdResponse_Incrby() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Incrby& operator=(const CmdResponse_Incrby& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Incrby& operator=(CmdResponse_Incrby&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Incrby& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Incrby* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Incrby*>(
+               &_CmdResponse_Incrby_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(CmdResponse_Incrby& a, CmdResponse_Incrby& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Incrby* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Incrby* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Incrby* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Incrby>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Incrby& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Incrby& from) {
+    CmdResponse_Incrby::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Incrby* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Incrby";
+  }
+  protected:
+  explicit CmdResponse_Incrby(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // required int64 value = 1;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  int64_t value() const;
+  void set_value(int64_t value);
+  private:
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Incrby)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Append final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse.Append) */ {
+ public:
+  inline CmdResponse_Append() : CmdResponse_Append(nullptr) {}
+  ~CmdResponse_Append() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Append(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Append(const CmdResponse_Append& from);
+  CmdResponse_Append(CmdResponse_Append&& from) noexcept
+    : CmdResponse_Append() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Append& operator=(const CmdResponse_Append& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Append& operator=(CmdResponse_Append&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Append& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Append* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Append*>(
+               &_CmdResponse_Append_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(CmdResponse_Append& a, CmdResponse_Append& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Append* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Append* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Append* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Append>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Append& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Append& from) {
+    CmdResponse_Append::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Append* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse.Append";
+  }
+  protected:
+  explicit CmdResponse_Append(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLengthFieldNumber = 1,
+  };
+  // required int64 length = 1;
+  bool has_length() const;
+  private:
+  bool _internal_has_length() const;
+  public:
+  void clear_length();
+  int64_t length() const;
+  void set_length(int64_t value);
+  private:
+  int64_t _internal_length() const;
+  void _internal_set_length(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Append)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t length_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.CmdResponse) */ {
+ public:
+  inline CmdResponse() : CmdResponse(nullptr) {}
+  ~CmdResponse() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse(const CmdResponse& from);
+  CmdResponse(CmdResponse&& from) noexcept
+    : CmdResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse& operator=(const CmdResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse& operator=(CmdResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse*>(
+               &_CmdResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(CmdResponse& a, CmdResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse& from) {
+    CmdResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.CmdResponse";
+  }
+  protected:
+  explicit CmdResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CmdResponse_Sync Sync;
+  typedef CmdResponse_Get Get;
+  typedef CmdResponse_InfoStats InfoStats;
+  typedef CmdResponse_InfoCapacity InfoCapacity;
+  typedef CmdResponse_InfoRepl InfoRepl;
+  typedef CmdResponse_Mget Mget;
+  typedef CmdResponse_InfoServer InfoServer;
+  typedef CmdResponse_Subscribe Subscribe;
+  typedef CmdResponse_KeyResult KeyResult;
+  typedef CmdResponse_Incrby Incrby;
+  typedef CmdResponse_Append Append;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInfoStatsFieldNumber = 7,
+    kInfoCapacityFieldNumber = 8,
+    kInfoReplFieldNumber = 9,
+    kMgetFieldNumber = 10,
+    kMsyncFieldNumber = 12,
+    kKeyResultsFieldNumber = 14,
+    kMsgFieldNumber = 3,
+    kSyncFieldNumber = 4,
+    kGetFieldNumber = 5,
+    kRedirectFieldNumber = 6,
+    kInfoServerFieldNumber = 11,
+    kSubscribeFieldNumber = 13,
+    kIncrbyFieldNumber = 15,
+    kAppendFieldNumber = 16,
+    kTypeFieldNumber = 1,
+    kCodeFieldNumber = 2,
+  };
+  // repeated .client.CmdResponse.InfoStats info_stats = 7;
+  int info_stats_size() const;
+  private:
+  int _internal_info_stats_size() const;
+  public:
+  void clear_info_stats();
+  ::client::CmdResponse_InfoStats* mutable_info_stats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
+      mutable_info_stats();
+  private:
+  const ::client::CmdResponse_InfoStats& _internal_info_stats(int index) const;
+  ::client::CmdResponse_InfoStats* _internal_add_info_stats();
+  public:
+  const ::client::CmdResponse_InfoStats& info_stats(int index) const;
+  ::client::CmdResponse_InfoStats* add_info_stats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
+      info_stats() const;
+
+  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+  int info_capacity_size() const;
+  private:
+  int _internal_info_capacity_size() const;
+  public:
+  void clear_info_capacity();
+  ::client::CmdResponse_InfoCapacity* mutable_info_capacity(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
+      mutable_info_capacity();
+  private:
+  const ::client::CmdResponse_InfoCapacity& _internal_info_capacity(int index) const;
+  ::client::CmdResponse_InfoCapacity* _internal_add_info_capacity();
+  public:
+  const ::client::CmdResponse_InfoCapacity& info_capacity(int index) const;
+  ::client::CmdResponse_InfoCapacity* add_info_capacity();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
+      info_capacity() const;
+
+  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+  int info_repl_size() const;
+  private:
+  int _internal_info_repl_size() const;
+  public:
+  void clear_info_repl();
+  ::client::CmdResponse_InfoRepl* mutable_info_repl(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
+      mutable_info_repl();
+  private:
+  const ::client::CmdResponse_InfoRepl& _internal_info_repl(int index) const;
+  ::client::CmdResponse_InfoRepl* _internal_add_info_repl();
+  public:
+  const ::client::CmdResponse_InfoRepl& info_repl(int index) const;
+  ::client::CmdResponse_InfoRepl* add_info_repl();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
+      info_repl() const;
+
+  // repeated .client.CmdResponse.Mget mget = 10;
+  int mget_size() const;
+  private:
+  int _internal_mget_size() const;
+  public:
+  void clear_mget();
+  ::client::CmdResponse_Mget* mutable_mget(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Mget >*
+      mutable_mget();
+  private:
+  const ::client::CmdResponse_Mget& _internal_mget(int index) const;
+  ::client::CmdResponse_Mget* _internal_add_mget();
+  public:
+  const ::client::CmdResponse_Mget& mget(int index) const;
+  ::client::CmdResponse_Mget* add_mget();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Mget >&
+      mget() const;
+
+  // repeated .client.CmdResponse msync = 12;
+  int msync_size() const;
+  private:
+  int _internal_msync_size() const;
+  public:
+  void clear_msync();
+  ::client::CmdResponse* mutable_msync(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse >*
+      mutable_msync();
+  private:
+  const ::client::CmdResponse& _internal_msync(int index) const;
+  ::client::CmdResponse* _internal_add_msync();
+  public:
+  const ::client::CmdResponse& msync(int index) const;
+  ::client::CmdResponse* add_msync();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse >&
+      msync() const;
+
+  // repeated .client.CmdResponse.KeyResult key_results = 14;
+  int key_results_size() const;
+  private:
+  int _internal_key_results_size() const;
+  public:
+  void clear_key_results();
+  ::client::CmdResponse_KeyResult* mutable_key_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_KeyResult >*
+      mutable_key_results();
+  private:
+  const ::client::CmdResponse_KeyResult& _internal_key_results(int index) const;
+  ::client::CmdResponse_KeyResult* _internal_add_key_results();
+  public:
+  const ::client::CmdResponse_KeyResult& key_results(int index) const;
+  ::client::CmdResponse_KeyResult* add_key_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_KeyResult >&
+      key_results() const;
+
+  // optional string msg = 3;
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // optional .client.CmdResponse.Sync sync = 4;
+  bool has_sync() const;
+  private:
+  bool _internal_has_sync() const;
+  public:
+  void clear_sync();
+  const ::client::CmdResponse_Sync& sync() const;
+  PROTOBUF_NODISCARD ::client::CmdResponse_Sync* release_sync();
+  ::client::CmdResponse_Sync* mutable_sync();
+  void set_allocated_sync(::client::CmdResponse_Sync* sync);
+  private:
+  const ::client::CmdResponse_Sync& _internal_sync() const;
+  ::client::CmdResponse_Sync* _internal_mutable_sync();
+  public:
+  void unsafe_arena_set_allocated_sync(
+      ::client::CmdResponse_Sync* sync);
+  ::client::CmdResponse_Sync* unsafe_arena_release_sync();
+
+  // optional .client.CmdResponse.Get get = 5;
+  bool has_get() const;
+  private:
+  bool _internal_has_get() const;
+  public:
+  void clear_get();
+  const ::client::CmdResponse_Get& get() const;
+  PROTOBUF_NODISCARD ::client::CmdResponse_Get* release_get();
+  ::client::CmdResponse_Get* mutable_get();
+  void set_allocated_get(::client::CmdResponse_Get* get);
+  private:
+  const ::client::CmdResponse_Get& _internal_get() const;
+  ::client::CmdResponse_Get* _internal_mutable_get();
+  public:
+  void unsafe_arena_set_allocated_get(
+      ::client::CmdResponse_Get* get);
+  ::client::CmdResponse_Get* unsafe_arena_release_get();
+
+  // optional .client.Node redirect = 6;
+  bool has_redirect() const;
+  private:
+  bool _internal_has_redirect() const;
+  public:
+  void clear_redirect();
+  const ::client::Node& redirect() const;
+  PROTOBUF_NODISCARD ::client::Node* release_redirect();
+  ::client::Node* mutable_redirect();
+  void set_allocated_redirect(::client::Node* redirect);
+  private:
+  const ::client::Node& _internal_redirect() const;
+  ::client::Node* _internal_mutable_redirect();
+  public:
+  void unsafe_arena_set_allocated_redirect(
+      ::client::Node* redirect);
+  ::client::Node* unsafe_arena_release_redirect();
+
+  // optional .client.CmdResponse.InfoServer info_server = 11;
+  bool has_info_server() const;
+  private:
+  bool _internal_has_info_server() const;
+  public:
+  void clear_info_server();
+  const ::client::CmdResponse_InfoServer& info_server() const;
+  PROTOBUF_NODISCARD ::client::CmdResponse_InfoServer* release_info_server();
+  ::client::CmdResponse_InfoServer* mutable_info_server();
+  void set_allocated_info_server(::client::CmdResponse_InfoServer* info_server);
+  private:
+  const ::client::CmdResponse_InfoServer& _internal_info_server() const;
+  ::client::CmdResponse_InfoServer* _internal_mutable_info_server();
+  public:
+  void unsafe_arena_set_allocated_info_server(
+      ::client::CmdResponse_InfoServer* info_server);
+  ::client::CmdResponse_InfoServer* unsafe_arena_release_info_server();
+
+  // optional .client.CmdResponse.Subscribe subscribe = 13;
+  bool has_subscribe() const;
+  private:
+  bool _internal_has_subscribe() const;
+  public:
+  void clear_subscribe();
+  const ::client::CmdResponse_Subscribe& subscribe() const;
+  PROTOBUF_NODISCARD ::client::CmdResponse_Subscribe* release_subscribe();
+  ::client::CmdResponse_Subscribe* mutable_subscribe();
+  void set_allocated_subscribe(::client::CmdResponse_Subscribe* subscribe);
+  private:
+  const ::client::CmdResponse_Subscribe& _internal_subscribe() const;
+  ::client::CmdResponse_Subscribe* _internal_mutable_subscribe();
+  public:
+  void unsafe_arena_set_allocated_subscribe(
+      ::client::CmdResponse_Subscribe* subscribe);
+  ::client::CmdResponse_Subscribe* unsafe_arena_release_subscribe();
+
+  // optional .client.CmdResponse.Incrby incrby = 15;
+  bool has_incrby() const;
+  private:
+  bool _internal_has_incrby() const;
+  public:
+  void clear_incrby();
+  const ::client::CmdResponse_Incrby& incrby() const;
+  PROTOBUF_NODISCARD ::client::CmdResponse_Incrby* release_incrby();
+  ::client::CmdResponse_Incrby* mutable_incrby();
+  void set_allocated_incrby(::client::CmdResponse_Incrby* incrby);
+  private:
+  const ::client::CmdResponse_Incrby& _internal_incrby() const;
+  ::client::CmdResponse_Incrby* _internal_mutable_incrby();
+  public:
+  void unsafe_arena_set_allocated_incrby(
+      ::client::CmdResponse_Incrby* incrby);
+  ::client::CmdResponse_Incrby* unsafe_arena_release_incrby();
+
+  // optional .client.CmdResponse.Append append = 16;
+  bool has_append() const;
+  private:
+  bool _internal_has_append() const;
+  public:
+  void clear_append();
+  const ::client::CmdResponse_Append& append() const;
+  PROTOBUF_NODISCARD ::client::CmdResponse_Append* release_append();
+  ::client::CmdResponse_Append* mutable_append();
+  void set_allocated_append(::client::CmdResponse_Append* append);
+  private:
+  const ::client::CmdResponse_Append& _internal_append() const;
+  ::client::CmdResponse_Append* _internal_mutable_append();
+  public:
+  void unsafe_arena_set_allocated_append(
+      ::client::CmdResponse_Append* append);
+  ::client::CmdResponse_Append* unsafe_arena_release_append();
+
+  // required .client.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::client::Type type() const;
+  void set_type(::client::Type value);
+  private:
+  ::client::Type _internal_type() const;
+  void _internal_set_type(::client::Type value);
+  public:
+
+  // required .client.StatusCode code = 2;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  ::client::StatusCode code() const;
+  void set_code(::client::StatusCode value);
+  private:
+  ::client::StatusCode _internal_code() const;
+  void _internal_set_code(::client::StatusCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoStats > info_stats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoCapacity > info_capacity_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoRepl > info_repl_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Mget > mget_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse > msync_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_KeyResult > key_results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::client::CmdResponse_Sync* sync_;
+    ::client::CmdResponse_Get* get_;
+    ::client::Node* redirect_;
+    ::client::CmdResponse_InfoServer* info_server_;
+    ::client::CmdResponse_Subscribe* subscribe_;
+    ::client::CmdResponse_Incrby* incrby_;
+    ::client::CmdResponse_Append* append_;
+    int type_;
+    int code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BinlogSkip final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.BinlogSkip) */ {
+ public:
+  inline BinlogSkip() : BinlogSkip(nullptr) {}
+  ~BinlogSkip() override;
+  explicit PROTOBUF_CONSTEXPR BinlogSkip(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BinlogSkip(const BinlogSkip& from);
+  BinlogSkip(BinlogSkip&& from) noexcept
+    : BinlogSkip() {
+    *this = ::std::move(from);
+  }
+
+  inline BinlogSkip& operator=(const BinlogSkip& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BinlogSkip& operator=(BinlogSkip&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BinlogSkip& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BinlogSkip* internal_default_instance() {
+    return reinterpret_cast<const BinlogSkip*>(
+               &_BinlogSkip_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(BinlogSkip& a, BinlogSkip& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BinlogSkip* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BinlogSkip* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BinlogSkip* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BinlogSkip>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BinlogSkip& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BinlogSkip& from) {
+    BinlogSkip::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BinlogSkip* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.BinlogSkip";
+  }
+  protected:
+  explicit BinlogSkip(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kGapFieldNumber = 3,
+    kPartitionIdFieldNumber = 2,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int64 gap = 3;
+  bool has_gap() const;
+  private:
+  bool _internal_has_gap() const;
+  public:
+  void clear_gap();
+  int64_t gap() const;
+  void set_gap(int64_t value);
+  private:
+  int64_t _internal_gap() const;
+  void _internal_set_gap(int64_t value);
+  public:
+
+  // required int32 partition_id = 2;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.BinlogSkip)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int64_t gap_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BinlogAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.BinlogAck) */ {
+ public:
+  inline BinlogAck() : BinlogAck(nullptr) {}
+  ~BinlogAck() override;
+  explicit PROTOBUF_CONSTEXPR BinlogAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BinlogAck(const BinlogAck& from);
+  BinlogAck(BinlogAck&& from) noexcept
+    : BinlogAck() {
+    *this = ::std::move(from);
+  }
+
+  inline BinlogAck& operator=(const BinlogAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BinlogAck& operator=(BinlogAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BinlogAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BinlogAck* internal_default_instance() {
+    return reinterpret_cast<const BinlogAck*>(
+               &_BinlogAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(BinlogAck& a, BinlogAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BinlogAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BinlogAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BinlogAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BinlogAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BinlogAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BinlogAck& from) {
+    BinlogAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BinlogAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.BinlogAck";
+  }
+  protected:
+  explicit BinlogAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kPartitionIdFieldNumber = 2,
+    kCreditsFieldNumber = 3,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int32 partition_id = 2;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
+
+  // required int32 credits = 3;
+  bool has_credits() const;
+  private:
+  bool _internal_has_credits() const;
+  public:
+  void clear_credits();
+  int32_t credits() const;
+  void set_credits(int32_t value);
+  private:
+  int32_t _internal_credits() const;
+  void _internal_set_credits(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.BinlogAck)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int32_t partition_id_;
+    int32_t credits_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BinlogResync final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.BinlogResync) */ {
+ public:
+  inline BinlogResync() : BinlogResync(nullptr) {}
+  ~BinlogResync() override;
+  explicit PROTOBUF_CONSTEXPR BinlogResync(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BinlogResync(const BinlogResync& from);
+  BinlogResync(BinlogResync&& from) noexcept
+    : BinlogResync() {
+    *this = ::std::move(from);
+  }
+
+  inline BinlogResync& operator=(const BinlogResync& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BinlogResync& operator=(BinlogResync&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BinlogResync& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BinlogResync* internal_default_instance() {
+    return reinterpret_cast<const BinlogResync*>(
+               &_BinlogResync_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(BinlogResync& a, BinlogResync& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BinlogResync* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BinlogResync* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BinlogResync* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BinlogResync>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BinlogResync& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BinlogResync& from) {
+    BinlogResync::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BinlogResync* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.BinlogResync";
+  }
+  protected:
+  explicit BinlogResync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kPartitionIdFieldNumber = 2,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int32 partition_id = 2;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.BinlogResync)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BinlogHeartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.BinlogHeartbeat) */ {
+ public:
+  inline BinlogHeartbeat() : BinlogHeartbeat(nullptr) {}
+  ~BinlogHeartbeat() override;
+  explicit PROTOBUF_CONSTEXPR BinlogHeartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BinlogHeartbeat(const BinlogHeartbeat& from);
+  BinlogHeartbeat(BinlogHeartbeat&& from) noexcept
+    : BinlogHeartbeat() {
+    *this = ::std::move(from);
+  }
+
+  inline BinlogHeartbeat& operator=(const BinlogHeartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BinlogHeartbeat& operator=(BinlogHeartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BinlogHeartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BinlogHeartbeat* internal_default_instance() {
+    return reinterpret_cast<const BinlogHeartbeat*>(
+               &_BinlogHeartbeat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(BinlogHeartbeat& a, BinlogHeartbeat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BinlogHeartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BinlogHeartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BinlogHeartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BinlogHeartbeat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BinlogHeartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BinlogHeartbeat& from) {
+    BinlogHeartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BinlogHeartbeat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.BinlogHeartbeat";
+  }
+  protected:
+  explicit BinlogHeartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kPartitionIdFieldNumber = 2,
+  };
+  // required string table_name = 1;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // required int32 partition_id = 2;
+  bool has_partition_id() const;
+  private:
+  bool _internal_has_partition_id() const;
+  public:
+  void clear_partition_id();
+  int32_t partition_id() const;
+  void set_partition_id(int32_t value);
+  private:
+  int32_t _internal_partition_id() const;
+  void _internal_set_partition_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.BinlogHeartbeat)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    int32_t partition_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:client.SyncRequest) */ {
+ public:
+  inline SyncRequest() : SyncRequest(nullptr) {}
+  ~SyncRequest() override;
+  explicit PROTOBUF_CONSTEXPR SyncRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncRequest(const SyncRequest& from);
+  SyncRequest(SyncRequest&& from) noexcept
+    : SyncRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncRequest& operator=(const SyncRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncRequest& operator=(SyncRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncRequest* internal_default_instance() {
+    return reinterpret_cast<const SyncRequest*>(
+               &_SyncRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(SyncRequest& a, SyncRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncRequest& from) {
+    SyncRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "client.SyncRequest";
+  }
+  protected:
+  explicit SyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFromFieldNumber = 3,
+    kSyncOffsetFieldNumber = 4,
+    kRequestFieldNumber = 5,
+    kBinlogSkipFieldNumber = 6,
+    kBinlogAckFieldNumber = 7,
+    kHeadFieldNumber = 8,
+    kBinlogResyncFieldNumber = 10,
+    kBinlogHeartbeatFieldNumber = 11,
+    kEpochFieldNumber = 2,
+    kSyncTypeFieldNumber = 1,
+    kItemLenFieldNumber = 9,
+  };
+  // required .client.Node from = 3;
+  bool has_from() const;
+  private:
+  bool _internal_has_from() const;
+  public:
+  void clear_from();
+  const ::client::Node& from() const;
+  PROTOBUF_NODISCARD ::client::Node* release_from();
+  ::client::Node* mutable_from();
+  void set_allocated_from(::client::Node* from);
+  private:
+  const ::client::Node& _internal_from() const;
+  ::client::Node* _internal_mutable_from();
+  public:
+  void unsafe_arena_set_allocated_from(
+      ::client::Node* from);
+  ::client::Node* unsafe_arena_release_from();
+
+  // required .client.SyncOffset sync_offset = 4;
+  bool has_sync_offset() const;
+  private:
+  bool _internal_has_sync_offset() const;
+  public:
+  void clear_sync_offset();
+  const ::client::SyncOffset& sync_offset() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_sync_offset();
+  ::client::SyncOffset* mutable_sync_offset();
+  void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  private:
+  const ::client::SyncOffset& _internal_sync_offset() const;
+  ::client::SyncOffset* _internal_mutable_sync_offset();
+  public:
+  void unsafe_arena_set_allocated_sync_offset(
+      ::client::SyncOffset* sync_offset);
+  ::client::SyncOffset* unsafe_arena_release_sync_offset();
+
+  // optional .client.CmdRequest request = 5;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::client::CmdRequest& request() const;
+  PROTOBUF_NODISCARD ::client::CmdRequest* release_request();
+  ::client::CmdRequest* mutable_request();
+  void set_allocated_request(::client::CmdRequest* request);
+  private:
+  const ::client::CmdRequest& _internal_request() const;
+  ::client::CmdRequest* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::client::CmdRequest* request);
+  ::client::CmdRequest* unsafe_arena_release_request();
+
+  // optional .client.BinlogSkip binlog_skip = 6;
+  bool has_binlog_skip() const;
+  private:
+  bool _internal_has_binlog_skip() const;
+  public:
+  void clear_binlog_skip();
+  const ::client::BinlogSkip& binlog_skip() const;
+  PROTOBUF_NODISCARD ::client::BinlogSkip* release_binlog_skip();
+  ::client::BinlogSkip* mutable_binlog_skip();
+  void set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip);
+  private:
+  const ::client::BinlogSkip& _internal_binlog_skip() const;
+  ::client::BinlogSkip* _internal_mutable_binlog_skip();
+  public:
+  void unsafe_arena_set_allocated_binlog_skip(
+      ::client::BinlogSkip* binlog_skip);
+  ::client::BinlogSkip* unsafe_arena_release_binlog_skip();
+
+  // optional .client.BinlogAck binlog_ack = 7;
+  bool has_binlog_ack() const;
+  private:
+  bool _internal_has_binlog_ack() const;
+  public:
+  void clear_binlog_ack();
+  const ::client::BinlogAck& binlog_ack() const;
+  PROTOBUF_NODISCARD ::client::BinlogAck* release_binlog_ack();
+  ::client::BinlogAck* mutable_binlog_ack();
+  void set_allocated_binlog_ack(::client::BinlogAck* binlog_ack);
+  private:
+  const ::client::BinlogAck& _internal_binlog_ack() const;
+  ::client::BinlogAck* _internal_mutable_binlog_ack();
+  public:
+  void unsafe_arena_set_allocated_binlog_ack(
+      ::client::BinlogAck* binlog_ack);
+  ::client::BinlogAck* unsafe_arena_release_binlog_ack();
+
+  // optional .client.SyncOffset head = 8;
+  bool has_head() const;
+  private:
+  bool _internal_has_head() const;
+  public:
+  void clear_head();
+  const ::client::SyncOffset& head() const;
+  PROTOBUF_NODISCARD ::client::SyncOffset* release_head();
+  ::client::SyncOffset* mutable_head();
+  void set_allocated_head(::client::SyncOffset* head);
+  private:
+  const ::client::SyncOffset& _internal_head() const;
+  ::client::SyncOffset* _internal_mutable_head();
+  public:
+  void unsafe_arena_set_allocated_head(
+      ::client::SyncOffset* head);
+  ::client::SyncOffset* unsafe_arena_release_head();
+
+  // optional .client.BinlogResync binlog_resync = 10;
+  bool has_binlog_resync() const;
+  private:
+  bool _internal_has_binlog_resync() const;
+  public:
+  void clear_binlog_resync();
+  const ::client::BinlogResync& binlog_resync() const;
+  PROTOBUF_NODISCARD ::client::BinlogResync* release_binlog_resync();
+  ::client::BinlogResync* mutable_binlog_resync();
+  void set_allocated_binlog_resync(::client::BinlogResync* binlog_resync);
+  private:
+  const ::client::BinlogResync& _internal_binlog_resync() const;
+  ::client::BinlogResync* _internal_mutable_binlog_resync();
+  public:
+  void unsafe_arena_set_allocated_binlog_resync(
+      ::client::BinlogResync* binlog_resync);
+  ::client::BinlogResync* unsafe_arena_release_binlog_resync();
+
+  // optional .client.BinlogHeartbeat binlog_heartbeat = 11;
+  bool has_binlog_heartbeat() const;
+  private:
+  bool _internal_has_binlog_heartbeat() const;
+  public:
+  void clear_binlog_heartbeat();
+  const ::client::BinlogHeartbeat& binlog_heartbeat() const;
+  PROTOBUF_NODISCARD ::client::BinlogHeartbeat* release_binlog_heartbeat();
+  ::client::BinlogHeartbeat* mutable_binlog_heartbeat();
+  void set_allocated_binlog_heartbeat(::client::BinlogHeartbeat* binlog_heartbeat);
+  private:
+  const ::client::BinlogHeartbeat& _internal_binlog_heartbeat() const;
+  ::client::BinlogHeartbeat* _internal_mutable_binlog_heartbeat();
+  public:
+  void unsafe_arena_set_allocated_binlog_heartbeat(
+      ::client::BinlogHeartbeat* binlog_heartbeat);
+  ::client::BinlogHeartbeat* unsafe_arena_release_binlog_heartbeat();
+
+  // required int64 epoch = 2;
+  bool has_epoch() const;
+  private:
+  bool _internal_has_epoch() const;
+  public:
+  void clear_epoch();
+  int64_t epoch() const;
+  void set_epoch(int64_t value);
+  private:
+  int64_t _internal_epoch() const;
+  void _internal_set_epoch(int64_t value);
+  public:
+
+  // required .client.SyncType sync_type = 1;
+  bool has_sync_type() const;
+  private:
+  bool _internal_has_sync_type() const;
+  public:
+  void clear_sync_type();
+  ::client::SyncType sync_type() const;
+  void set_sync_type(::client::SyncType value);
+  private:
+  ::client::SyncType _internal_sync_type() const;
+  void _internal_set_sync_type(::client::SyncType value);
+  public:
+
+  // optional int32 item_len = 9;
+  bool has_item_len() const;
+  private:
+  bool _internal_has_item_len() const;
+  public:
+  void clear_item_len();
+  int32_t item_len() const;
+  void set_item_len(int32_t value);
+  private:
+  int32_t _internal_item_len() const;
+  void _internal_set_item_len(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:client.SyncRequest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::client::Node* from_;
+    ::client::SyncOffset* sync_offset_;
+    ::client::CmdRequest* request_;
+    ::client::BinlogSkip* binlog_skip_;
+    ::client::BinlogAck* binlog_ack_;
+    ::client::SyncOffset* head_;
+    ::client::BinlogResync* binlog_resync_;
+    ::client::BinlogHeartbeat* binlog_heartbeat_;
+    int64_t epoch_;
+    int sync_type_;
+    int32_t item_len_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_client_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Node
+
+// required string ip = 1;
+inline bool Node::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Node::has_ip() const {
+  return _internal_has_ip();
+}
+inline void Node::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Node::ip() const {
+  // @@protoc_insertion_point(field_get:client.Node.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Node::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.Node.ip)
+}
+inline std::string* Node::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:client.Node.ip)
+  return _s;
+}
+inline const std::string& Node::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void Node::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Node::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Node::release_ip() {
+  // @@protoc_insertion_point(field_release:client.Node.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Node::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.Node.ip)
+}
+
+// required int32 port = 2;
+inline bool Node::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Node::has_port() const {
+  return _internal_has_port();
+}
+inline void Node::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Node::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t Node::port() const {
+  // @@protoc_insertion_point(field_get:client.Node.port)
+  return _internal_port();
+}
+inline void Node::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.port_ = value;
+}
+inline void Node::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:client.Node.port)
+}
+
+// -------------------------------------------------------------------
+
+// SyncOffset
+
+// required int32 filenum = 1;
+inline bool SyncOffset::_internal_has_filenum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyncOffset::has_filenum() const {
+  return _internal_has_filenum();
+}
+inline void SyncOffset::clear_filenum() {
+  _impl_.filenum_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t SyncOffset::_internal_filenum() const {
+  return _impl_.filenum_;
+}
+inline int32_t SyncOffset::filenum() const {
+  // @@protoc_insertion_point(field_get:client.SyncOffset.filenum)
+  return _internal_filenum();
+}
+inline void SyncOffset::_internal_set_filenum(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.filenum_ = value;
+}
+inline void SyncOffset::set_filenum(int32_t value) {
+  _internal_set_filenum(value);
+  // @@protoc_insertion_point(field_set:client.SyncOffset.filenum)
+}
+
+// required int64 offset = 2;
+inline bool SyncOffset::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncOffset::has_offset() const {
+  return _internal_has_offset();
+}
+inline void SyncOffset::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int64_t SyncOffset::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t SyncOffset::offset() const {
+  // @@protoc_insertion_point(field_get:client.SyncOffset.offset)
+  return _internal_offset();
+}
+inline void SyncOffset::_internal_set_offset(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.offset_ = value;
+}
+inline void SyncOffset::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:client.SyncOffset.offset)
+}
+
+// optional int32 partition = 3;
+inline bool SyncOffset::_internal_has_partition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyncOffset::has_partition() const {
+  return _internal_has_partition();
+}
+inline void SyncOffset::clear_partition() {
+  _impl_.partition_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t SyncOffset::_internal_partition() const {
+  return _impl_.partition_;
+}
+inline int32_t SyncOffset::partition() const {
+  // @@protoc_insertion_point(field_get:client.SyncOffset.partition)
+  return _internal_partition();
+}
+inline void SyncOffset::_internal_set_partition(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.partition_ = value;
+}
+inline void SyncOffset::set_partition(int32_t value) {
+  _internal_set_partition(value);
+  // @@protoc_insertion_point(field_set:client.SyncOffset.partition)
+}
+
+// -------------------------------------------------------------------
+
+// ReplTerm
+
+// required string repl_id = 1;
+inline bool ReplTerm::_internal_has_repl_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplTerm::has_repl_id() const {
+  return _internal_has_repl_id();
+}
+inline void ReplTerm::clear_repl_id() {
+  _impl_.repl_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplTerm::repl_id() const {
+  // @@protoc_insertion_point(field_get:client.ReplTerm.repl_id)
+  return _internal_repl_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplTerm::set_repl_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.repl_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.ReplTerm.repl_id)
+}
+inline std::string* ReplTerm::mutable_repl_id() {
+  std::string* _s = _internal_mutable_repl_id();
+  // @@protoc_insertion_point(field_mutable:client.ReplTerm.repl_id)
+  return _s;
+}
+inline const std::string& ReplTerm::_internal_repl_id() const {
+  return _impl_.repl_id_.Get();
+}
+inline void ReplTerm::_internal_set_repl_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.repl_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplTerm::_internal_mutable_repl_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.repl_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplTerm::release_repl_id() {
+  // @@protoc_insertion_point(field_release:client.ReplTerm.repl_id)
+  if (!_internal_has_repl_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.repl_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.repl_id_.IsDefault()) {
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplTerm::set_allocated_repl_id(std::string* repl_id) {
+  if (repl_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.repl_id_.SetAllocated(repl_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.repl_id_.IsDefault()) {
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.ReplTerm.repl_id)
+}
+
+// required .client.SyncOffset begin = 2;
+inline bool ReplTerm::_internal_has_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.begin_ != nullptr);
+  return value;
+}
+inline bool ReplTerm::has_begin() const {
+  return _internal_has_begin();
+}
+inline void ReplTerm::clear_begin() {
+  if (_impl_.begin_ != nullptr) _impl_.begin_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::client::SyncOffset& ReplTerm::_internal_begin() const {
+  const ::client::SyncOffset* p = _impl_.begin_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
+}
+inline const ::client::SyncOffset& ReplTerm::begin() const {
+  // @@protoc_insertion_point(field_get:client.ReplTerm.begin)
+  return _internal_begin();
+}
+inline void ReplTerm::unsafe_arena_set_allocated_begin(
+    ::client::SyncOffset* begin) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.begin_);
+  }
+  _impl_.begin_ = begin;
+  if (begin) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.ReplTerm.begin)
+}
+inline ::client::SyncOffset* ReplTerm::release_begin() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::SyncOffset* temp = _impl_.begin_;
+  _impl_.begin_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::SyncOffset* ReplTerm::unsafe_arena_release_begin() {
+  // @@protoc_insertion_point(field_release:client.ReplTerm.begin)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::SyncOffset* temp = _impl_.begin_;
+  _impl_.begin_ = nullptr;
+  return temp;
+}
+inline ::client::SyncOffset* ReplTerm::_internal_mutable_begin() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.begin_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.begin_ = p;
+  }
+  return _impl_.begin_;
+}
+inline ::client::SyncOffset* ReplTerm::mutable_begin() {
+  ::client::SyncOffset* _msg = _internal_mutable_begin();
+  // @@protoc_insertion_point(field_mutable:client.ReplTerm.begin)
+  return _msg;
+}
+inline void ReplTerm::set_allocated_begin(::client::SyncOffset* begin) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.begin_;
+  }
+  if (begin) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(begin);
+    if (message_arena != submessage_arena) {
+      begin = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, begin, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.begin_ = begin;
+  // @@protoc_insertion_point(field_set_allocated:client.ReplTerm.begin)
+}
+
+// -------------------------------------------------------------------
+
+// ReadStaleness
+
+// optional int64 max_ms = 1;
+inline bool ReadStaleness::_internal_has_max_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReadStaleness::has_max_ms() const {
+  return _internal_has_max_ms();
+}
+inline void ReadStaleness::clear_max_ms() {
+  _impl_.max_ms_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int64_t ReadStaleness::_internal_max_ms() const {
+  return _impl_.max_ms_;
+}
+inline int64_t ReadStaleness::max_ms() const {
+  // @@protoc_insertion_point(field_get:client.ReadStaleness.max_ms)
+  return _internal_max_ms();
+}
+inline void ReadStaleness::_internal_set_max_ms(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.max_ms_ = value;
+}
+inline void ReadStaleness::set_max_ms(int64_t value) {
+  _internal_set_max_ms(value);
+  // @@protoc_insertion_point(field_set:client.ReadStaleness.max_ms)
+}
+
+// optional int64 max_bytes = 2;
+inline bool ReadStaleness::_internal_has_max_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReadStaleness::has_max_bytes() const {
+  return _internal_has_max_bytes();
+}
+inline void ReadStaleness::clear_max_bytes() {
+  _impl_.max_bytes_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t ReadStaleness::_internal_max_bytes() const {
+  return _impl_.max_bytes_;
+}
+inline int64_t ReadStaleness::max_bytes() const {
+  // @@protoc_insertion_point(field_get:client.ReadStaleness.max_bytes)
+  return _internal_max_bytes();
+}
+inline void ReadStaleness::_internal_set_max_bytes(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_bytes_ = value;
+}
+inline void ReadStaleness::set_max_bytes(int64_t value) {
+  _internal_set_max_bytes(value);
+  // @@protoc_insertion_point(field_set:client.ReadStaleness.max_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// KeyExpire
+
+// optional int32 base = 1;
+inline bool KeyExpire::_internal_has_base() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool KeyExpire::has_base() const {
+  return _internal_has_base();
+}
+inline void KeyExpire::clear_base() {
+  _impl_.base_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t KeyExpire::_internal_base() const {
+  return _impl_.base_;
+}
+inline int32_t KeyExpire::base() const {
+  // @@protoc_insertion_point(field_get:client.KeyExpire.base)
+  return _internal_base();
+}
+inline void KeyExpire::_internal_set_base(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.base_ = value;
+}
+inline void KeyExpire::set_base(int32_t value) {
+  _internal_set_base(value);
+  // @@protoc_insertion_point(field_set:client.KeyExpire.base)
+}
+
+// required int32 ttl = 2;
+inline bool KeyExpire::_internal_has_ttl() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool KeyExpire::has_ttl() const {
+  return _internal_has_ttl();
+}
+inline void KeyExpire::clear_ttl() {
+  _impl_.ttl_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t KeyExpire::_internal_ttl() const {
+  return _impl_.ttl_;
+}
+inline int32_t KeyExpire::ttl() const {
+  // @@protoc_insertion_point(field_get:client.KeyExpire.ttl)
+  return _internal_ttl();
+}
+inline void KeyExpire::_internal_set_ttl(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ttl_ = value;
+}
+inline void KeyExpire::set_ttl(int32_t value) {
+  _internal_set_ttl(value);
+  // @@protoc_insertion_point(field_set:client.KeyExpire.ttl)
+}
+
+// -------------------------------------------------------------------
+
+// PartitionState_SlaveLag
+
+// required .client.Node node = 1;
+inline bool PartitionState_SlaveLag::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.node_ != nullptr);
+  return value;
+}
+inline bool PartitionState_SlaveLag::has_node() const {
+  return _internal_has_node();
+}
+inline void PartitionState_SlaveLag::clear_node() {
+  if (_impl_.node_ != nullptr) _impl_.node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::client::Node& PartitionState_SlaveLag::_internal_node() const {
+  const ::client::Node* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
+}
+inline const ::client::Node& PartitionState_SlaveLag::node() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.SlaveLag.node)
+  return _internal_node();
+}
+inline void PartitionState_SlaveLag::unsafe_arena_set_allocated_node(
+    ::client::Node* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
+  if (node) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.PartitionState.SlaveLag.node)
+}
+inline ::client::Node* PartitionState_SlaveLag::release_node() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::Node* PartitionState_SlaveLag::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:client.PartitionState.SlaveLag.node)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+  return temp;
+}
+inline ::client::Node* PartitionState_SlaveLag::_internal_mutable_node() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.node_ = p;
+  }
+  return _impl_.node_;
+}
+inline ::client::Node* PartitionState_SlaveLag::mutable_node() {
+  ::client::Node* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.SlaveLag.node)
+  return _msg;
+}
+inline void PartitionState_SlaveLag::set_allocated_node(::client::Node* node) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
+  }
+  if (node) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:client.PartitionState.SlaveLag.node)
+}
+
+// required int64 lag_bytes = 2;
+inline bool PartitionState_SlaveLag::_internal_has_lag_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PartitionState_SlaveLag::has_lag_bytes() const {
+  return _internal_has_lag_bytes();
+}
+inline void PartitionState_SlaveLag::clear_lag_bytes() {
+  _impl_.lag_bytes_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t PartitionState_SlaveLag::_internal_lag_bytes() const {
+  return _impl_.lag_bytes_;
+}
+inline int64_t PartitionState_SlaveLag::lag_bytes() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.SlaveLag.lag_bytes)
+  return _internal_lag_bytes();
+}
+inline void PartitionState_SlaveLag::_internal_set_lag_bytes(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.lag_bytes_ = value;
+}
+inline void PartitionState_SlaveLag::set_lag_bytes(int64_t value) {
+  _internal_set_lag_bytes(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.SlaveLag.lag_bytes)
+}
+
+// required int32 unacked_records = 3;
+inline bool PartitionState_SlaveLag::_internal_has_unacked_records() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PartitionState_SlaveLag::has_unacked_records() const {
+  return _internal_has_unacked_records();
+}
+inline void PartitionState_SlaveLag::clear_unacked_records() {
+  _impl_.unacked_records_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t PartitionState_SlaveLag::_internal_unacked_records() const {
+  return _impl_.unacked_records_;
+}
+inline int32_t PartitionState_SlaveLag::unacked_records() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.SlaveLag.unacked_records)
+  return _internal_unacked_records();
+}
+inline void PartitionState_SlaveLag::_internal_set_unacked_records(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.unacked_records_ = value;
+}
+inline void PartitionState_SlaveLag::set_unacked_records(int32_t value) {
+  _internal_set_unacked_records(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.SlaveLag.unacked_records)
+}
+
+// required int64 send_bytes_per_sec = 4;
+inline bool PartitionState_SlaveLag::_internal_has_send_bytes_per_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PartitionState_SlaveLag::has_send_bytes_per_sec() const {
+  return _internal_has_send_bytes_per_sec();
+}
+inline void PartitionState_SlaveLag::clear_send_bytes_per_sec() {
+  _impl_.send_bytes_per_sec_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t PartitionState_SlaveLag::_internal_send_bytes_per_sec() const {
+  return _impl_.send_bytes_per_sec_;
+}
+inline int64_t PartitionState_SlaveLag::send_bytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.SlaveLag.send_bytes_per_sec)
+  return _internal_send_bytes_per_sec();
+}
+inline void PartitionState_SlaveLag::_internal_set_send_bytes_per_sec(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.send_bytes_per_sec_ = value;
+}
+inline void PartitionState_SlaveLag::set_send_bytes_per_sec(int64_t value) {
+  _internal_set_send_bytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.SlaveLag.send_bytes_per_sec)
+}
+
+// required int64 since_last_send_ms = 5;
+inline bool PartitionState_SlaveLag::_internal_has_since_last_send_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PartitionState_SlaveLag::has_since_last_send_ms() const {
+  return _internal_has_since_last_send_ms();
+}
+inline void PartitionState_SlaveLag::clear_since_last_send_ms() {
+  _impl_.since_last_send_ms_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t PartitionState_SlaveLag::_internal_since_last_send_ms() const {
+  return _impl_.since_last_send_ms_;
+}
+inline int64_t PartitionState_SlaveLag::since_last_send_ms() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.SlaveLag.since_last_send_ms)
+  return _internal_since_last_send_ms();
+}
+inline void PartitionState_SlaveLag::_internal_set_since_last_send_ms(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.since_last_send_ms_ = value;
+}
+inline void PartitionState_SlaveLag::set_since_last_send_ms(int64_t value) {
+  _internal_set_since_last_send_ms(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.SlaveLag.since_last_send_ms)
+}
+
+// -------------------------------------------------------------------
+
+// PartitionState
+
+// required int32 partition_id = 1;
+inline bool PartitionState::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PartitionState::has_partition_id() const {
+  return _internal_has_partition_id();
+}
+inline void PartitionState::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t PartitionState::_internal_partition_id() const {
+  return _impl_.partition_id_;
+}
+inline int32_t PartitionState::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.partition_id)
+  return _internal_partition_id();
+}
+inline void PartitionState::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.partition_id_ = value;
+}
+inline void PartitionState::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.partition_id)
+}
+
+// required string role = 2;
+inline bool PartitionState::_internal_has_role() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PartitionState::has_role() const {
+  return _internal_has_role();
+}
+inline void PartitionState::clear_role() {
+  _impl_.role_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PartitionState::role() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.role)
+  return _internal_role();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PartitionState::set_role(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.role_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.PartitionState.role)
+}
+inline std::string* PartitionState::mutable_role() {
+  std::string* _s = _internal_mutable_role();
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.role)
+  return _s;
+}
+inline const std::string& PartitionState::_internal_role() const {
+  return _impl_.role_.Get();
+}
+inline void PartitionState::_internal_set_role(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.role_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PartitionState::_internal_mutable_role() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.role_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PartitionState::release_role() {
+  // @@protoc_insertion_point(field_release:client.PartitionState.role)
+  if (!_internal_has_role()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.role_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.role_.IsDefault()) {
+    _impl_.role_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PartitionState::set_allocated_role(std::string* role) {
+  if (role != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.role_.SetAllocated(role, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.role_.IsDefault()) {
+    _impl_.role_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.PartitionState.role)
+}
+
+// required string repl_state = 3;
+inline bool PartitionState::_internal_has_repl_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PartitionState::has_repl_state() const {
+  return _internal_has_repl_state();
+}
+inline void PartitionState::clear_repl_state() {
+  _impl_.repl_state_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PartitionState::repl_state() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.repl_state)
+  return _internal_repl_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PartitionState::set_repl_state(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.repl_state_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.PartitionState.repl_state)
+}
+inline std::string* PartitionState::mutable_repl_state() {
+  std::string* _s = _internal_mutable_repl_state();
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.repl_state)
+  return _s;
+}
+inline const std::string& PartitionState::_internal_repl_state() const {
+  return _impl_.repl_state_.Get();
+}
+inline void PartitionState::_internal_set_repl_state(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.repl_state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PartitionState::_internal_mutable_repl_state() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.repl_state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PartitionState::release_repl_state() {
+  // @@protoc_insertion_point(field_release:client.PartitionState.repl_state)
+  if (!_internal_has_repl_state()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.repl_state_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.repl_state_.IsDefault()) {
+    _impl_.repl_state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PartitionState::set_allocated_repl_state(std::string* repl_state) {
+  if (repl_state != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.repl_state_.SetAllocated(repl_state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.repl_state_.IsDefault()) {
+    _impl_.repl_state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.PartitionState.repl_state)
+}
+
+// required .client.Node master = 4;
+inline bool PartitionState::_internal_has_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.master_ != nullptr);
+  return value;
+}
+inline bool PartitionState::has_master() const {
+  return _internal_has_master();
+}
+inline void PartitionState::clear_master() {
+  if (_impl_.master_ != nullptr) _impl_.master_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::client::Node& PartitionState::_internal_master() const {
+  const ::client::Node* p = _impl_.master_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
+}
+inline const ::client::Node& PartitionState::master() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.master)
+  return _internal_master();
+}
+inline void PartitionState::unsafe_arena_set_allocated_master(
+    ::client::Node* master) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_);
+  }
+  _impl_.master_ = master;
+  if (master) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.PartitionState.master)
+}
+inline ::client::Node* PartitionState::release_master() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::Node* temp = _impl_.master_;
+  _impl_.master_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::Node* PartitionState::unsafe_arena_release_master() {
+  // @@protoc_insertion_point(field_release:client.PartitionState.master)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::Node* temp = _impl_.master_;
+  _impl_.master_ = nullptr;
+  return temp;
+}
+inline ::client::Node* PartitionState::_internal_mutable_master() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.master_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.master_ = p;
+  }
+  return _impl_.master_;
+}
+inline ::client::Node* PartitionState::mutable_master() {
+  ::client::Node* _msg = _internal_mutable_master();
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.master)
+  return _msg;
+}
+inline void PartitionState::set_allocated_master(::client::Node* master) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.master_;
+  }
+  if (master) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(master);
+    if (message_arena != submessage_arena) {
+      master = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, master, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.master_ = master;
+  // @@protoc_insertion_point(field_set_allocated:client.PartitionState.master)
+}
+
+// repeated .client.Node slaves = 5;
+inline int PartitionState::_internal_slaves_size() const {
+  return _impl_.slaves_.size();
+}
+inline int PartitionState::slaves_size() const {
+  return _internal_slaves_size();
+}
+inline void PartitionState::clear_slaves() {
+  _impl_.slaves_.Clear();
+}
+inline ::client::Node* PartitionState::mutable_slaves(int index) {
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.slaves)
+  return _impl_.slaves_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::Node >*
+PartitionState::mutable_slaves() {
+  // @@protoc_insertion_point(field_mutable_list:client.PartitionState.slaves)
+  return &_impl_.slaves_;
+}
+inline const ::client::Node& PartitionState::_internal_slaves(int index) const {
+  return _impl_.slaves_.Get(index);
+}
+inline const ::client::Node& PartitionState::slaves(int index) const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.slaves)
+  return _internal_slaves(index);
+}
+inline ::client::Node* PartitionState::_internal_add_slaves() {
+  return _impl_.slaves_.Add();
+}
+inline ::client::Node* PartitionState::add_slaves() {
+  ::client::Node* _add = _internal_add_slaves();
+  // @@protoc_insertion_point(field_add:client.PartitionState.slaves)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::Node >&
+PartitionState::slaves() const {
+  // @@protoc_insertion_point(field_list:client.PartitionState.slaves)
+  return _impl_.slaves_;
+}
+
+// required .client.SyncOffset sync_offset = 6;
+inline bool PartitionState::_internal_has_sync_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sync_offset_ != nullptr);
+  return value;
+}
+inline bool PartitionState::has_sync_offset() const {
+  return _internal_has_sync_offset();
+}
+inline void PartitionState::clear_sync_offset() {
+  if (_impl_.sync_offset_ != nullptr) _impl_.sync_offset_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::client::SyncOffset& PartitionState::_internal_sync_offset() const {
+  const ::client::SyncOffset* p = _impl_.sync_offset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
+}
+inline const ::client::SyncOffset& PartitionState::sync_offset() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.sync_offset)
+  return _internal_sync_offset();
+}
+inline void PartitionState::unsafe_arena_set_allocated_sync_offset(
+    ::client::SyncOffset* sync_offset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sync_offset_);
+  }
+  _impl_.sync_offset_ = sync_offset;
+  if (sync_offset) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.PartitionState.sync_offset)
+}
+inline ::client::SyncOffset* PartitionState::release_sync_offset() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::SyncOffset* PartitionState::unsafe_arena_release_sync_offset() {
+  // @@protoc_insertion_point(field_release:client.PartitionState.sync_offset)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+  return temp;
+}
+inline ::client::SyncOffset* PartitionState::_internal_mutable_sync_offset() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.sync_offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.sync_offset_ = p;
+  }
+  return _impl_.sync_offset_;
+}
+inline ::client::SyncOffset* PartitionState::mutable_sync_offset() {
+  ::client::SyncOffset* _msg = _internal_mutable_sync_offset();
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.sync_offset)
+  return _msg;
+}
+inline void PartitionState::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sync_offset_;
+  }
+  if (sync_offset) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_offset);
+    if (message_arena != submessage_arena) {
+      sync_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_offset, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.sync_offset_ = sync_offset;
+  // @@protoc_insertion_point(field_set_allocated:client.PartitionState.sync_offset)
+}
+
+// repeated .client.PartitionState.SlaveLag slave_lags = 7;
+inline int PartitionState::_internal_slave_lags_size() const {
+  return _impl_.slave_lags_.size();
+}
+inline int PartitionState::slave_lags_size() const {
+  return _internal_slave_lags_size();
+}
+inline void PartitionState::clear_slave_lags() {
+  _impl_.slave_lags_.Clear();
+}
+inline ::client::PartitionState_SlaveLag* PartitionState::mutable_slave_lags(int index) {
+  // @@protoc_insertion_point(field_mutable:client.PartitionState.slave_lags)
+  return _impl_.slave_lags_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState_SlaveLag >*
+PartitionState::mutable_slave_lags() {
+  // @@protoc_insertion_point(field_mutable_list:client.PartitionState.slave_lags)
+  return &_impl_.slave_lags_;
+}
+inline const ::client::PartitionState_SlaveLag& PartitionState::_internal_slave_lags(int index) const {
+  return _impl_.slave_lags_.Get(index);
+}
+inline const ::client::PartitionState_SlaveLag& PartitionState::slave_lags(int index) const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.slave_lags)
+  return _internal_slave_lags(index);
+}
+inline ::client::PartitionState_SlaveLag* PartitionState::_internal_add_slave_lags() {
+  return _impl_.slave_lags_.Add();
+}
+inline ::client::PartitionState_SlaveLag* PartitionState::add_slave_lags() {
+  ::client::PartitionState_SlaveLag* _add = _internal_add_slave_lags();
+  // @@protoc_insertion_point(field_add:client.PartitionState.slave_lags)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState_SlaveLag >&
+PartitionState::slave_lags() const {
+  // @@protoc_insertion_point(field_list:client.PartitionState.slave_lags)
+  return _impl_.slave_lags_;
+}
+
+// optional int64 apply_lag_bytes = 8;
+inline bool PartitionState::_internal_has_apply_lag_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PartitionState::has_apply_lag_bytes() const {
+  return _internal_has_apply_lag_bytes();
+}
+inline void PartitionState::clear_apply_lag_bytes() {
+  _impl_.apply_lag_bytes_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t PartitionState::_internal_apply_lag_bytes() const {
+  return _impl_.apply_lag_bytes_;
+}
+inline int64_t PartitionState::apply_lag_bytes() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.apply_lag_bytes)
+  return _internal_apply_lag_bytes();
+}
+inline void PartitionState::_internal_set_apply_lag_bytes(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.apply_lag_bytes_ = value;
+}
+inline void PartitionState::set_apply_lag_bytes(int64_t value) {
+  _internal_set_apply_lag_bytes(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.apply_lag_bytes)
+}
+
+// optional int64 apply_lag_ms = 9;
+inline bool PartitionState::_internal_has_apply_lag_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PartitionState::has_apply_lag_ms() const {
+  return _internal_has_apply_lag_ms();
+}
+inline void PartitionState::clear_apply_lag_ms() {
+  _impl_.apply_lag_ms_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int64_t PartitionState::_internal_apply_lag_ms() const {
+  return _impl_.apply_lag_ms_;
+}
+inline int64_t PartitionState::apply_lag_ms() const {
+  // @@protoc_insertion_point(field_get:client.PartitionState.apply_lag_ms)
+  return _internal_apply_lag_ms();
+}
+inline void PartitionState::_internal_set_apply_lag_ms(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.apply_lag_ms_ = value;
+}
+inline void PartitionState::set_apply_lag_ms(int64_t value) {
+  _internal_set_apply_lag_ms(value);
+  // @@protoc_insertion_point(field_set:client.PartitionState.apply_lag_ms)
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Sync
+
+// required .client.Node node = 1;
+inline bool CmdRequest_Sync::_internal_has_node() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.node_ != nullptr);
+  return value;
+}
+inline bool CmdRequest_Sync::has_node() const {
+  return _internal_has_node();
+}
+inline void CmdRequest_Sync::clear_node() {
+  if (_impl_.node_ != nullptr) _impl_.node_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::client::Node& CmdRequest_Sync::_internal_node() const {
+  const ::client::Node* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
+}
+inline const ::client::Node& CmdRequest_Sync::node() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Sync.node)
+  return _internal_node();
+}
+inline void CmdRequest_Sync::unsafe_arena_set_allocated_node(
+    ::client::Node* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
+  if (node) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.Sync.node)
+}
+inline ::client::Node* CmdRequest_Sync::release_node() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::Node* CmdRequest_Sync::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Sync.node)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::Node* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+  return temp;
+}
+inline ::client::Node* CmdRequest_Sync::_internal_mutable_node() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.node_ = p;
+  }
+  return _impl_.node_;
+}
+inline ::client::Node* CmdRequest_Sync::mutable_node() {
+  ::client::Node* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Sync.node)
+  return _msg;
+}
+inline void CmdRequest_Sync::set_allocated_node(::client::Node* node) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
+  }
+  if (node) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Sync.node)
+}
+
+// required string table_name = 2;
+inline bool CmdRequest_Sync::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Sync::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Sync::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Sync::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Sync.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Sync::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Sync.table_name)
+}
+inline std::string* CmdRequest_Sync::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Sync.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Sync::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Sync::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Sync::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Sync::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Sync.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Sync::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Sync.table_name)
+}
+
+// required .client.SyncOffset sync_offset = 3;
+inline bool CmdRequest_Sync::_internal_has_sync_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sync_offset_ != nullptr);
+  return value;
+}
+inline bool CmdRequest_Sync::has_sync_offset() const {
+  return _internal_has_sync_offset();
+}
+inline void CmdRequest_Sync::clear_sync_offset() {
+  if (_impl_.sync_offset_ != nullptr) _impl_.sync_offset_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::client::SyncOffset& CmdRequest_Sync::_internal_sync_offset() const {
+  const ::client::SyncOffset* p = _impl_.sync_offset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
+}
+inline const ::client::SyncOffset& CmdRequest_Sync::sync_offset() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Sync.sync_offset)
+  return _internal_sync_offset();
+}
+inline void CmdRequest_Sync::unsafe_arena_set_allocated_sync_offset(
+    ::client::SyncOffset* sync_offset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sync_offset_);
+  }
+  _impl_.sync_offset_ = sync_offset;
+  if (sync_offset) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.Sync.sync_offset)
+}
+inline ::client::SyncOffset* CmdRequest_Sync::release_sync_offset() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::SyncOffset* CmdRequest_Sync::unsafe_arena_release_sync_offset() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Sync.sync_offset)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+  return temp;
+}
+inline ::client::SyncOffset* CmdRequest_Sync::_internal_mutable_sync_offset() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.sync_offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.sync_offset_ = p;
+  }
+  return _impl_.sync_offset_;
+}
+inline ::client::SyncOffset* CmdRequest_Sync::mutable_sync_offset() {
+  ::client::SyncOffset* _msg = _internal_mutable_sync_offset();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Sync.sync_offset)
+  return _msg;
+}
+inline void CmdRequest_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sync_offset_;
+  }
+  if (sync_offset) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_offset);
+    if (message_arena != submessage_arena) {
+      sync_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_offset, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.sync_offset_ = sync_offset;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Sync.sync_offset)
+}
+
+// optional string repl_id = 4;
+inline bool CmdRequest_Sync::_internal_has_repl_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Sync::has_repl_id() const {
+  return _internal_has_repl_id();
+}
+inline void CmdRequest_Sync::clear_repl_id() {
+  _impl_.repl_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Sync::repl_id() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Sync.repl_id)
+  return _internal_repl_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Sync::set_repl_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.repl_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Sync.repl_id)
+}
+inline std::string* CmdRequest_Sync::mutable_repl_id() {
+  std::string* _s = _internal_mutable_repl_id();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Sync.repl_id)
+  return _s;
+}
+inline const std::string& CmdRequest_Sync::_internal_repl_id() const {
+  return _impl_.repl_id_.Get();
+}
+inline void CmdRequest_Sync::_internal_set_repl_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.repl_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Sync::_internal_mutable_repl_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.repl_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Sync::release_repl_id() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Sync.repl_id)
+  if (!_internal_has_repl_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.repl_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.repl_id_.IsDefault()) {
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Sync::set_allocated_repl_id(std::string* repl_id) {
+  if (repl_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.repl_id_.SetAllocated(repl_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.repl_id_.IsDefault()) {
+    _impl_.repl_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Sync.repl_id)
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Set
+
+// required string table_name = 1;
+inline bool CmdRequest_Set::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Set::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Set::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Set::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Set.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Set::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Set.table_name)
+}
+inline std::string* CmdRequest_Set::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Set.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Set::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Set::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Set.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Set::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Set.table_name)
+}
+
+// required string key = 2;
+inline bool CmdRequest_Set::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Set::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdRequest_Set::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Set::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Set.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Set::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Set.key)
+}
+inline std::string* CmdRequest_Set::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Set.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Set::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Set::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Set.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Set::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Set.key)
+}
+
+// required bytes value = 3;
+inline bool CmdRequest_Set::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdRequest_Set::has_value() const {
+  return _internal_has_value();
+}
+inline void CmdRequest_Set::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CmdRequest_Set::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Set.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Set::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Set.value)
+}
+inline std::string* CmdRequest_Set::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Set.value)
+  return _s;
+}
+inline const std::string& CmdRequest_Set::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdRequest_Set::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::release_value() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Set.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Set::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Set.value)
+}
+
+// optional string uuid = 4;
+inline bool CmdRequest_Set::_internal_has_uuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CmdRequest_Set::has_uuid() const {
+  return _internal_has_uuid();
+}
+inline void CmdRequest_Set::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& CmdRequest_Set::uuid() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Set.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Set::set_uuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Set.uuid)
+}
+inline std::string* CmdRequest_Set::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Set.uuid)
+  return _s;
+}
+inline const std::string& CmdRequest_Set::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void CmdRequest_Set::_internal_set_uuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::_internal_mutable_uuid() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Set::release_uuid() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Set.uuid)
+  if (!_internal_has_uuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.uuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Set::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Set.uuid)
+}
+
+// optional .client.KeyExpire expire = 5;
+inline bool CmdRequest_Set::_internal_has_expire() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.expire_ != nullptr);
+  return value;
+}
+inline bool CmdRequest_Set::has_expire() const {
+  return _internal_has_expire();
+}
+inline void CmdRequest_Set::clear_expire() {
+  if (_impl_.expire_ != nullptr) _impl_.expire_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::client::KeyExpire& CmdRequest_Set::_internal_expire() const {
+  const ::client::KeyExpire* p = _impl_.expire_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::KeyExpire&>(
+      ::client::_KeyExpire_default_instance_);
+}
+inline const ::client::KeyExpire& CmdRequest_Set::expire() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Set.expire)
+  return _internal_expire();
+}
+inline void CmdRequest_Set::unsafe_arena_set_allocated_expire(
+    ::client::KeyExpire* expire) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.expire_);
+  }
+  _impl_.expire_ = expire;
+  if (expire) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.Set.expire)
+}
+inline ::client::KeyExpire* CmdRequest_Set::release_expire() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::KeyExpire* temp = _impl_.expire_;
+  _impl_.expire_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::KeyExpire* CmdRequest_Set::unsafe_arena_release_expire() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Set.expire)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::KeyExpire* temp = _impl_.expire_;
+  _impl_.expire_ = nullptr;
+  return temp;
+}
+inline ::client::KeyExpire* CmdRequest_Set::_internal_mutable_expire() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.expire_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::KeyExpire>(GetArenaForAllocation());
+    _impl_.expire_ = p;
+  }
+  return _impl_.expire_;
+}
+inline ::client::KeyExpire* CmdRequest_Set::mutable_expire() {
+  ::client::KeyExpire* _msg = _internal_mutable_expire();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Set.expire)
+  return _msg;
+}
+inline void CmdRequest_Set::set_allocated_expire(::client::KeyExpire* expire) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.expire_;
+  }
+  if (expire) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(expire);
+    if (message_arena != submessage_arena) {
+      expire = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, expire, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.expire_ = expire;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Set.expire)
+}
 
-  void InitAsDefaultInstance();
-  static BinlogSkip* default_instance_;
-};
 // -------------------------------------------------------------------
 
-class SyncRequest : public ::google::protobuf::Message {
- public:
-  SyncRequest();
-  virtual ~SyncRequest();
-
-  SyncRequest(const SyncRequest& from);
+// CmdRequest_Get
 
-  inline SyncRequest& operator=(const SyncRequest& from) {
-    CopyFrom(from);
-    return *this;
+// required string table_name = 1;
+inline bool CmdRequest_Get::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Get::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Get::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Get::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Get.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Get::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Get.table_name)
+}
+inline std::string* CmdRequest_Get::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Get.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Get::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Get::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Get::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Get::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Get.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Get::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Get.table_name)
+}
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+// required string key = 2;
+inline bool CmdRequest_Get::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Get::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdRequest_Get::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Get::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Get.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Get::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Get.key)
+}
+inline std::string* CmdRequest_Get::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Get.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Get::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Get::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Get::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Get::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Get.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Get::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Get.key)
+}
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SyncRequest& default_instance();
-
-  void Swap(SyncRequest* other);
-
-  // implements Message ----------------------------------------------
-
-  SyncRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SyncRequest& from);
-  void MergeFrom(const SyncRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // required .client.SyncType sync_type = 1;
-  inline bool has_sync_type() const;
-  inline void clear_sync_type();
-  static const int kSyncTypeFieldNumber = 1;
-  inline ::client::SyncType sync_type() const;
-  inline void set_sync_type(::client::SyncType value);
-
-  // required int64 epoch = 2;
-  inline bool has_epoch() const;
-  inline void clear_epoch();
-  static const int kEpochFieldNumber = 2;
-  inline ::google::protobuf::int64 epoch() const;
-  inline void set_epoch(::google::protobuf::int64 value);
-
-  // required .client.Node from = 3;
-  inline bool has_from() const;
-  inline void clear_from();
-  static const int kFromFieldNumber = 3;
-  inline const ::client::Node& from() const;
-  inline ::client::Node* mutable_from();
-  inline ::client::Node* release_from();
-  inline void set_allocated_from(::client::Node* from);
-
-  // required .client.SyncOffset sync_offset = 4;
-  inline bool has_sync_offset() const;
-  inline void clear_sync_offset();
-  static const int kSyncOffsetFieldNumber = 4;
-  inline const ::client::SyncOffset& sync_offset() const;
-  inline ::client::SyncOffset* mutable_sync_offset();
-  inline ::client::SyncOffset* release_sync_offset();
-  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
-
-  // optional .client.CmdRequest request = 5;
-  inline bool has_request() const;
-  inline void clear_request();
-  static const int kRequestFieldNumber = 5;
-  inline const ::client::CmdRequest& request() const;
-  inline ::client::CmdRequest* mutable_request();
-  inline ::client::CmdRequest* release_request();
-  inline void set_allocated_request(::client::CmdRequest* request);
-
-  // optional .client.BinlogSkip binlog_skip = 6;
-  inline bool has_binlog_skip() const;
-  inline void clear_binlog_skip();
-  static const int kBinlogSkipFieldNumber = 6;
-  inline const ::client::BinlogSkip& binlog_skip() const;
-  inline ::client::BinlogSkip* mutable_binlog_skip();
-  inline ::client::BinlogSkip* release_binlog_skip();
-  inline void set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip);
-
-  // @@protoc_insertion_point(class_scope:client.SyncRequest)
- private:
-  inline void set_has_sync_type();
-  inline void clear_has_sync_type();
-  inline void set_has_epoch();
-  inline void clear_has_epoch();
-  inline void set_has_from();
-  inline void clear_has_from();
-  inline void set_has_sync_offset();
-  inline void clear_has_sync_offset();
-  inline void set_has_request();
-  inline void clear_has_request();
-  inline void set_has_binlog_skip();
-  inline void clear_has_binlog_skip();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int64 epoch_;
-  ::client::Node* from_;
-  ::client::SyncOffset* sync_offset_;
-  ::client::CmdRequest* request_;
-  ::client::BinlogSkip* binlog_skip_;
-  int sync_type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_client_2eproto();
-  friend void protobuf_AssignDesc_client_2eproto();
-  friend void protobuf_ShutdownFile_client_2eproto();
-
-  void InitAsDefaultInstance();
-  static SyncRequest* default_instance_;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-// Node
+// optional string uuid = 3;
+inline bool CmdRequest_Get::_internal_has_uuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdRequest_Get::has_uuid() const {
+  return _internal_has_uuid();
+}
+inline void CmdRequest_Get::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CmdRequest_Get::uuid() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Get.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Get::set_uuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Get.uuid)
+}
+inline std::string* CmdRequest_Get::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Get.uuid)
+  return _s;
+}
+inline const std::string& CmdRequest_Get::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void CmdRequest_Get::_internal_set_uuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Get::_internal_mutable_uuid() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Get::release_uuid() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Get.uuid)
+  if (!_internal_has_uuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.uuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Get::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Get.uuid)
+}
 
-// required string ip = 1;
-inline bool Node::has_ip() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.ReadStaleness staleness = 4;
+inline bool CmdRequest_Get::_internal_has_staleness() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.staleness_ != nullptr);
+  return value;
 }
-inline void Node::set_has_ip() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest_Get::has_staleness() const {
+  return _internal_has_staleness();
 }
-inline void Node::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_Get::clear_staleness() {
+  if (_impl_.staleness_ != nullptr) _impl_.staleness_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Node::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
+inline const ::client::ReadStaleness& CmdRequest_Get::_internal_staleness() const {
+  const ::client::ReadStaleness* p = _impl_.staleness_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::ReadStaleness&>(
+      ::client::_ReadStaleness_default_instance_);
 }
-inline const ::std::string& Node::ip() const {
-  return *ip_;
+inline const ::client::ReadStaleness& CmdRequest_Get::staleness() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Get.staleness)
+  return _internal_staleness();
 }
-inline void Node::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
+inline void CmdRequest_Get::unsafe_arena_set_allocated_staleness(
+    ::client::ReadStaleness* staleness) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.staleness_);
   }
-  ip_->assign(value);
+  _impl_.staleness_ = staleness;
+  if (staleness) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.Get.staleness)
+}
+inline ::client::ReadStaleness* CmdRequest_Get::release_staleness() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::ReadStaleness* temp = _impl_.staleness_;
+  _impl_.staleness_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Node::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline ::client::ReadStaleness* CmdRequest_Get::unsafe_arena_release_staleness() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Get.staleness)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::ReadStaleness* temp = _impl_.staleness_;
+  _impl_.staleness_ = nullptr;
+  return temp;
 }
-inline void Node::set_ip(const char* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
+inline ::client::ReadStaleness* CmdRequest_Get::_internal_mutable_staleness() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.staleness_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::ReadStaleness>(GetArenaForAllocation());
+    _impl_.staleness_ = p;
+  }
+  return _impl_.staleness_;
+}
+inline ::client::ReadStaleness* CmdRequest_Get::mutable_staleness() {
+  ::client::ReadStaleness* _msg = _internal_mutable_staleness();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Get.staleness)
+  return _msg;
+}
+inline void CmdRequest_Get::set_allocated_staleness(::client::ReadStaleness* staleness) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.staleness_;
+  }
+  if (staleness) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(staleness);
+    if (message_arena != submessage_arena) {
+      staleness = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, staleness, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.staleness_ = staleness;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Get.staleness)
 }
-inline ::std::string* Node::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Del
+
+// required string table_name = 1;
+inline bool CmdRequest_Del::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Del::has_table_name() const {
+  return _internal_has_table_name();
 }
-inline ::std::string* Node::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdRequest_Del::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Del::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Del.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Del::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Del.table_name)
+}
+inline std::string* CmdRequest_Del::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Del.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Del::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Del::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Del::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Del::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Del.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Del::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void Node::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Del.table_name)
+}
+
+// required string key = 2;
+inline bool CmdRequest_Del::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Del::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdRequest_Del::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Del::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Del.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Del::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Del.key)
+}
+inline std::string* CmdRequest_Del::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Del.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Del::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Del::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Del::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Del::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Del.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Del::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Del.key)
 }
 
-// required int32 port = 2;
-inline bool Node::has_port() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional string uuid = 3;
+inline bool CmdRequest_Del::_internal_has_uuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Node::set_has_port() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest_Del::has_uuid() const {
+  return _internal_has_uuid();
 }
-inline void Node::clear_has_port() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_Del::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CmdRequest_Del::uuid() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Del.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Del::set_uuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Del.uuid)
+}
+inline std::string* CmdRequest_Del::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Del.uuid)
+  return _s;
+}
+inline const std::string& CmdRequest_Del::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void CmdRequest_Del::_internal_set_uuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Del::_internal_mutable_uuid() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Del::release_uuid() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Del.uuid)
+  if (!_internal_has_uuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.uuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Del::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Del.uuid)
 }
-inline void Node::clear_port() {
-  port_ = 0;
-  clear_has_port();
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Info
+
+// optional string table_name = 1;
+inline bool CmdRequest_Info::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::google::protobuf::int32 Node::port() const {
-  return port_;
+inline bool CmdRequest_Info::has_table_name() const {
+  return _internal_has_table_name();
 }
-inline void Node::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
+inline void CmdRequest_Info::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Info::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Info.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Info::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Info.table_name)
+}
+inline std::string* CmdRequest_Info::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Info.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Info::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Info::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Info::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Info::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Info.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Info::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Info.table_name)
 }
 
 // -------------------------------------------------------------------
 
-// SyncOffset
+// CmdRequest_Mget
 
-// required int32 filenum = 1;
-inline bool SyncOffset::has_filenum() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required string table_name = 1;
+inline bool CmdRequest_Mget::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void SyncOffset::set_has_filenum() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest_Mget::has_table_name() const {
+  return _internal_has_table_name();
 }
-inline void SyncOffset::clear_has_filenum() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_Mget::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Mget::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mget.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Mget::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mget.table_name)
+}
+inline std::string* CmdRequest_Mget::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mget.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Mget::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Mget::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mget::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mget::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Mget.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Mget::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Mget.table_name)
 }
-inline void SyncOffset::clear_filenum() {
-  filenum_ = 0;
-  clear_has_filenum();
+
+// repeated string keys = 2;
+inline int CmdRequest_Mget::_internal_keys_size() const {
+  return _impl_.keys_.size();
 }
-inline ::google::protobuf::int32 SyncOffset::filenum() const {
-  return filenum_;
+inline int CmdRequest_Mget::keys_size() const {
+  return _internal_keys_size();
 }
-inline void SyncOffset::set_filenum(::google::protobuf::int32 value) {
-  set_has_filenum();
-  filenum_ = value;
+inline void CmdRequest_Mget::clear_keys() {
+  _impl_.keys_.Clear();
 }
-
-// required int64 offset = 2;
-inline bool SyncOffset::has_offset() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline std::string* CmdRequest_Mget::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:client.CmdRequest.Mget.keys)
+  return _s;
 }
-inline void SyncOffset::set_has_offset() {
-  _has_bits_[0] |= 0x00000002u;
+inline const std::string& CmdRequest_Mget::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
 }
-inline void SyncOffset::clear_has_offset() {
-  _has_bits_[0] &= ~0x00000002u;
+inline const std::string& CmdRequest_Mget::keys(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mget.keys)
+  return _internal_keys(index);
 }
-inline void SyncOffset::clear_offset() {
-  offset_ = GOOGLE_LONGLONG(0);
-  clear_has_offset();
+inline std::string* CmdRequest_Mget::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mget.keys)
+  return _impl_.keys_.Mutable(index);
 }
-inline ::google::protobuf::int64 SyncOffset::offset() const {
-  return offset_;
+inline void CmdRequest_Mget::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mget.keys)
 }
-inline void SyncOffset::set_offset(::google::protobuf::int64 value) {
-  set_has_offset();
-  offset_ = value;
+inline void CmdRequest_Mget::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mget.keys)
 }
-
-// optional int32 partition = 3;
-inline bool SyncOffset::has_partition() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline void CmdRequest_Mget::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:client.CmdRequest.Mget.keys)
 }
-inline void SyncOffset::set_has_partition() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdRequest_Mget::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:client.CmdRequest.Mget.keys)
 }
-inline void SyncOffset::clear_has_partition() {
-  _has_bits_[0] &= ~0x00000004u;
+inline std::string* CmdRequest_Mget::_internal_add_keys() {
+  return _impl_.keys_.Add();
 }
-inline void SyncOffset::clear_partition() {
-  partition_ = 0;
-  clear_has_partition();
+inline void CmdRequest_Mget::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Mget.keys)
+}
+inline void CmdRequest_Mget::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Mget.keys)
 }
-inline ::google::protobuf::int32 SyncOffset::partition() const {
-  return partition_;
+inline void CmdRequest_Mget::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:client.CmdRequest.Mget.keys)
 }
-inline void SyncOffset::set_partition(::google::protobuf::int32 value) {
-  set_has_partition();
-  partition_ = value;
+inline void CmdRequest_Mget::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:client.CmdRequest.Mget.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CmdRequest_Mget::keys() const {
+  // @@protoc_insertion_point(field_list:client.CmdRequest.Mget.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CmdRequest_Mget::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdRequest.Mget.keys)
+  return &_impl_.keys_;
 }
 
-// -------------------------------------------------------------------
-
-// KeyExpire
-
-// optional int32 base = 1;
-inline bool KeyExpire::has_base() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.ReadStaleness staleness = 3;
+inline bool CmdRequest_Mget::_internal_has_staleness() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.staleness_ != nullptr);
+  return value;
 }
-inline void KeyExpire::set_has_base() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest_Mget::has_staleness() const {
+  return _internal_has_staleness();
 }
-inline void KeyExpire::clear_has_base() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_Mget::clear_staleness() {
+  if (_impl_.staleness_ != nullptr) _impl_.staleness_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void KeyExpire::clear_base() {
-  base_ = 0;
-  clear_has_base();
+inline const ::client::ReadStaleness& CmdRequest_Mget::_internal_staleness() const {
+  const ::client::ReadStaleness* p = _impl_.staleness_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::ReadStaleness&>(
+      ::client::_ReadStaleness_default_instance_);
+}
+inline const ::client::ReadStaleness& CmdRequest_Mget::staleness() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mget.staleness)
+  return _internal_staleness();
+}
+inline void CmdRequest_Mget::unsafe_arena_set_allocated_staleness(
+    ::client::ReadStaleness* staleness) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.staleness_);
+  }
+  _impl_.staleness_ = staleness;
+  if (staleness) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.Mget.staleness)
+}
+inline ::client::ReadStaleness* CmdRequest_Mget::release_staleness() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::ReadStaleness* temp = _impl_.staleness_;
+  _impl_.staleness_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::google::protobuf::int32 KeyExpire::base() const {
-  return base_;
+inline ::client::ReadStaleness* CmdRequest_Mget::unsafe_arena_release_staleness() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Mget.staleness)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::ReadStaleness* temp = _impl_.staleness_;
+  _impl_.staleness_ = nullptr;
+  return temp;
 }
-inline void KeyExpire::set_base(::google::protobuf::int32 value) {
-  set_has_base();
-  base_ = value;
+inline ::client::ReadStaleness* CmdRequest_Mget::_internal_mutable_staleness() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.staleness_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::ReadStaleness>(GetArenaForAllocation());
+    _impl_.staleness_ = p;
+  }
+  return _impl_.staleness_;
+}
+inline ::client::ReadStaleness* CmdRequest_Mget::mutable_staleness() {
+  ::client::ReadStaleness* _msg = _internal_mutable_staleness();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mget.staleness)
+  return _msg;
+}
+inline void CmdRequest_Mget::set_allocated_staleness(::client::ReadStaleness* staleness) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.staleness_;
+  }
+  if (staleness) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(staleness);
+    if (message_arena != submessage_arena) {
+      staleness = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, staleness, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.staleness_ = staleness;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Mget.staleness)
 }
 
-// required int32 ttl = 2;
-inline bool KeyExpire::has_ttl() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional int32 partition_id = 4;
+inline bool CmdRequest_Mget::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void KeyExpire::set_has_ttl() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest_Mget::has_partition_id() const {
+  return _internal_has_partition_id();
 }
-inline void KeyExpire::clear_has_ttl() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_Mget::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void KeyExpire::clear_ttl() {
-  ttl_ = 0;
-  clear_has_ttl();
+inline int32_t CmdRequest_Mget::_internal_partition_id() const {
+  return _impl_.partition_id_;
 }
-inline ::google::protobuf::int32 KeyExpire::ttl() const {
-  return ttl_;
+inline int32_t CmdRequest_Mget::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mget.partition_id)
+  return _internal_partition_id();
 }
-inline void KeyExpire::set_ttl(::google::protobuf::int32 value) {
-  set_has_ttl();
-  ttl_ = value;
+inline void CmdRequest_Mget::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.partition_id_ = value;
+}
+inline void CmdRequest_Mget::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mget.partition_id)
 }
 
 // -------------------------------------------------------------------
 
-// PartitionState
+// CmdRequest_Msync
 
-// required int32 partition_id = 1;
-inline bool PartitionState::has_partition_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// repeated .client.CmdRequest.Sync syncs = 1;
+inline int CmdRequest_Msync::_internal_syncs_size() const {
+  return _impl_.syncs_.size();
 }
-inline void PartitionState::set_has_partition_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline int CmdRequest_Msync::syncs_size() const {
+  return _internal_syncs_size();
 }
-inline void PartitionState::clear_has_partition_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_Msync::clear_syncs() {
+  _impl_.syncs_.Clear();
 }
-inline void PartitionState::clear_partition_id() {
-  partition_id_ = 0;
-  clear_has_partition_id();
+inline ::client::CmdRequest_Sync* CmdRequest_Msync::mutable_syncs(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Msync.syncs)
+  return _impl_.syncs_.Mutable(index);
 }
-inline ::google::protobuf::int32 PartitionState::partition_id() const {
-  return partition_id_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Sync >*
+CmdRequest_Msync::mutable_syncs() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdRequest.Msync.syncs)
+  return &_impl_.syncs_;
 }
-inline void PartitionState::set_partition_id(::google::protobuf::int32 value) {
-  set_has_partition_id();
-  partition_id_ = value;
+inline const ::client::CmdRequest_Sync& CmdRequest_Msync::_internal_syncs(int index) const {
+  return _impl_.syncs_.Get(index);
 }
-
-// required string role = 2;
-inline bool PartitionState::has_role() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline const ::client::CmdRequest_Sync& CmdRequest_Msync::syncs(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Msync.syncs)
+  return _internal_syncs(index);
 }
-inline void PartitionState::set_has_role() {
-  _has_bits_[0] |= 0x00000002u;
+inline ::client::CmdRequest_Sync* CmdRequest_Msync::_internal_add_syncs() {
+  return _impl_.syncs_.Add();
 }
-inline void PartitionState::clear_has_role() {
-  _has_bits_[0] &= ~0x00000002u;
+inline ::client::CmdRequest_Sync* CmdRequest_Msync::add_syncs() {
+  ::client::CmdRequest_Sync* _add = _internal_add_syncs();
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Msync.syncs)
+  return _add;
 }
-inline void PartitionState::clear_role() {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    role_->clear();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Sync >&
+CmdRequest_Msync::syncs() const {
+  // @@protoc_insertion_point(field_list:client.CmdRequest.Msync.syncs)
+  return _impl_.syncs_;
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Subscribe
+
+// required string table_name = 1;
+inline bool CmdRequest_Subscribe::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Subscribe::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Subscribe::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Subscribe::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Subscribe.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Subscribe::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Subscribe.table_name)
+}
+inline std::string* CmdRequest_Subscribe::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Subscribe.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Subscribe::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Subscribe::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Subscribe::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Subscribe::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Subscribe.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Subscribe::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  clear_has_role();
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Subscribe.table_name)
 }
-inline const ::std::string& PartitionState::role() const {
-  return *role_;
+
+// repeated .client.SyncOffset cursors = 2;
+inline int CmdRequest_Subscribe::_internal_cursors_size() const {
+  return _impl_.cursors_.size();
 }
-inline void PartitionState::set_role(const ::std::string& value) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  role_->assign(value);
+inline int CmdRequest_Subscribe::cursors_size() const {
+  return _internal_cursors_size();
 }
-inline void PartitionState::set_role(const char* value) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  role_->assign(value);
+inline void CmdRequest_Subscribe::clear_cursors() {
+  _impl_.cursors_.Clear();
 }
-inline void PartitionState::set_role(const char* value, size_t size) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  role_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::SyncOffset* CmdRequest_Subscribe::mutable_cursors(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Subscribe.cursors)
+  return _impl_.cursors_.Mutable(index);
 }
-inline ::std::string* PartitionState::mutable_role() {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  return role_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >*
+CmdRequest_Subscribe::mutable_cursors() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdRequest.Subscribe.cursors)
+  return &_impl_.cursors_;
 }
-inline ::std::string* PartitionState::release_role() {
-  clear_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = role_;
-    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::client::SyncOffset& CmdRequest_Subscribe::_internal_cursors(int index) const {
+  return _impl_.cursors_.Get(index);
 }
-inline void PartitionState::set_allocated_role(::std::string* role) {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    delete role_;
-  }
-  if (role) {
-    set_has_role();
-    role_ = role;
-  } else {
-    clear_has_role();
-    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline const ::client::SyncOffset& CmdRequest_Subscribe::cursors(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Subscribe.cursors)
+  return _internal_cursors(index);
+}
+inline ::client::SyncOffset* CmdRequest_Subscribe::_internal_add_cursors() {
+  return _impl_.cursors_.Add();
+}
+inline ::client::SyncOffset* CmdRequest_Subscribe::add_cursors() {
+  ::client::SyncOffset* _add = _internal_add_cursors();
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Subscribe.cursors)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >&
+CmdRequest_Subscribe::cursors() const {
+  // @@protoc_insertion_point(field_list:client.CmdRequest.Subscribe.cursors)
+  return _impl_.cursors_;
 }
 
-// required string repl_state = 3;
-inline bool PartitionState::has_repl_state() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional bytes key_prefix = 3;
+inline bool CmdRequest_Subscribe::_internal_has_key_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void PartitionState::set_has_repl_state() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdRequest_Subscribe::has_key_prefix() const {
+  return _internal_has_key_prefix();
 }
-inline void PartitionState::clear_has_repl_state() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_Subscribe::clear_key_prefix() {
+  _impl_.key_prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void PartitionState::clear_repl_state() {
-  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
-    repl_state_->clear();
-  }
-  clear_has_repl_state();
+inline const std::string& CmdRequest_Subscribe::key_prefix() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Subscribe.key_prefix)
+  return _internal_key_prefix();
 }
-inline const ::std::string& PartitionState::repl_state() const {
-  return *repl_state_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Subscribe::set_key_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_prefix_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Subscribe.key_prefix)
 }
-inline void PartitionState::set_repl_state(const ::std::string& value) {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
-  }
-  repl_state_->assign(value);
+inline std::string* CmdRequest_Subscribe::mutable_key_prefix() {
+  std::string* _s = _internal_mutable_key_prefix();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Subscribe.key_prefix)
+  return _s;
 }
-inline void PartitionState::set_repl_state(const char* value) {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
-  }
-  repl_state_->assign(value);
+inline const std::string& CmdRequest_Subscribe::_internal_key_prefix() const {
+  return _impl_.key_prefix_.Get();
 }
-inline void PartitionState::set_repl_state(const char* value, size_t size) {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
-  }
-  repl_state_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest_Subscribe::_internal_set_key_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_prefix_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PartitionState::mutable_repl_state() {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
-  }
-  return repl_state_;
+inline std::string* CmdRequest_Subscribe::_internal_mutable_key_prefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_prefix_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PartitionState::release_repl_state() {
-  clear_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = repl_state_;
-    repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline std::string* CmdRequest_Subscribe::release_key_prefix() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Subscribe.key_prefix)
+  if (!_internal_has_key_prefix()) {
+    return nullptr;
   }
-}
-inline void PartitionState::set_allocated_repl_state(::std::string* repl_state) {
-  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
-    delete repl_state_;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_prefix_.IsDefault()) {
+    _impl_.key_prefix_.Set("", GetArenaForAllocation());
   }
-  if (repl_state) {
-    set_has_repl_state();
-    repl_state_ = repl_state;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Subscribe::set_allocated_key_prefix(std::string* key_prefix) {
+  if (key_prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_repl_state();
-    repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_prefix_.SetAllocated(key_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_prefix_.IsDefault()) {
+    _impl_.key_prefix_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Subscribe.key_prefix)
 }
 
-// required .client.Node master = 4;
-inline bool PartitionState::has_master() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional int32 max_records = 4 [default = 1000];
+inline bool CmdRequest_Subscribe::_internal_has_max_records() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void PartitionState::set_has_master() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdRequest_Subscribe::has_max_records() const {
+  return _internal_has_max_records();
 }
-inline void PartitionState::clear_has_master() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdRequest_Subscribe::clear_max_records() {
+  _impl_.max_records_ = 1000;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void PartitionState::clear_master() {
-  if (master_ != NULL) master_->::client::Node::Clear();
-  clear_has_master();
+inline int32_t CmdRequest_Subscribe::_internal_max_records() const {
+  return _impl_.max_records_;
 }
-inline const ::client::Node& PartitionState::master() const {
-  return master_ != NULL ? *master_ : *default_instance_->master_;
+inline int32_t CmdRequest_Subscribe::max_records() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Subscribe.max_records)
+  return _internal_max_records();
 }
-inline ::client::Node* PartitionState::mutable_master() {
-  set_has_master();
-  if (master_ == NULL) master_ = new ::client::Node;
-  return master_;
+inline void CmdRequest_Subscribe::_internal_set_max_records(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_records_ = value;
 }
-inline ::client::Node* PartitionState::release_master() {
-  clear_has_master();
-  ::client::Node* temp = master_;
-  master_ = NULL;
-  return temp;
+inline void CmdRequest_Subscribe::set_max_records(int32_t value) {
+  _internal_set_max_records(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Subscribe.max_records)
 }
-inline void PartitionState::set_allocated_master(::client::Node* master) {
-  delete master_;
-  master_ = master;
-  if (master) {
-    set_has_master();
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Mset_Kv
+
+// required string key = 1;
+inline bool CmdRequest_Mset_Kv::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Mset_Kv::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdRequest_Mset_Kv::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Mset_Kv::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mset.Kv.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Mset_Kv::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mset.Kv.key)
+}
+inline std::string* CmdRequest_Mset_Kv::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mset.Kv.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Mset_Kv::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Mset_Kv::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mset_Kv::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mset_Kv::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Mset.Kv.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Mset_Kv::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_master();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Mset.Kv.key)
 }
 
-// repeated .client.Node slaves = 5;
-inline int PartitionState::slaves_size() const {
-  return slaves_.size();
+// required bytes value = 2;
+inline bool CmdRequest_Mset_Kv::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Mset_Kv::has_value() const {
+  return _internal_has_value();
+}
+inline void CmdRequest_Mset_Kv::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Mset_Kv::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mset.Kv.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Mset_Kv::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mset.Kv.value)
+}
+inline std::string* CmdRequest_Mset_Kv::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mset.Kv.value)
+  return _s;
+}
+inline const std::string& CmdRequest_Mset_Kv::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdRequest_Mset_Kv::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mset_Kv::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mset_Kv::release_value() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Mset.Kv.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Mset_Kv::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Mset.Kv.value)
 }
-inline void PartitionState::clear_slaves() {
-  slaves_.Clear();
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Mset
+
+// required string table_name = 1;
+inline bool CmdRequest_Mset::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Mset::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Mset::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Mset::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mset.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Mset::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mset.table_name)
+}
+inline std::string* CmdRequest_Mset::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mset.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Mset::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Mset::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mset::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mset::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Mset.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Mset::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Mset.table_name)
 }
-inline const ::client::Node& PartitionState::slaves(int index) const {
-  return slaves_.Get(index);
+
+// repeated .client.CmdRequest.Mset.Kv kvs = 2;
+inline int CmdRequest_Mset::_internal_kvs_size() const {
+  return _impl_.kvs_.size();
 }
-inline ::client::Node* PartitionState::mutable_slaves(int index) {
-  return slaves_.Mutable(index);
+inline int CmdRequest_Mset::kvs_size() const {
+  return _internal_kvs_size();
+}
+inline void CmdRequest_Mset::clear_kvs() {
+  _impl_.kvs_.Clear();
+}
+inline ::client::CmdRequest_Mset_Kv* CmdRequest_Mset::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mset.kvs)
+  return _impl_.kvs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Mset_Kv >*
+CmdRequest_Mset::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdRequest.Mset.kvs)
+  return &_impl_.kvs_;
+}
+inline const ::client::CmdRequest_Mset_Kv& CmdRequest_Mset::_internal_kvs(int index) const {
+  return _impl_.kvs_.Get(index);
+}
+inline const ::client::CmdRequest_Mset_Kv& CmdRequest_Mset::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mset.kvs)
+  return _internal_kvs(index);
 }
-inline ::client::Node* PartitionState::add_slaves() {
-  return slaves_.Add();
+inline ::client::CmdRequest_Mset_Kv* CmdRequest_Mset::_internal_add_kvs() {
+  return _impl_.kvs_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::Node >&
-PartitionState::slaves() const {
-  return slaves_;
+inline ::client::CmdRequest_Mset_Kv* CmdRequest_Mset::add_kvs() {
+  ::client::CmdRequest_Mset_Kv* _add = _internal_add_kvs();
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Mset.kvs)
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::Node >*
-PartitionState::mutable_slaves() {
-  return &slaves_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdRequest_Mset_Kv >&
+CmdRequest_Mset::kvs() const {
+  // @@protoc_insertion_point(field_list:client.CmdRequest.Mset.kvs)
+  return _impl_.kvs_;
 }
 
-// required .client.SyncOffset sync_offset = 6;
-inline bool PartitionState::has_sync_offset() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void PartitionState::set_has_sync_offset() {
-  _has_bits_[0] |= 0x00000020u;
+// optional int32 partition_id = 3;
+inline bool CmdRequest_Mset::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void PartitionState::clear_has_sync_offset() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CmdRequest_Mset::has_partition_id() const {
+  return _internal_has_partition_id();
 }
-inline void PartitionState::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
+inline void CmdRequest_Mset::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::client::SyncOffset& PartitionState::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+inline int32_t CmdRequest_Mset::_internal_partition_id() const {
+  return _impl_.partition_id_;
 }
-inline ::client::SyncOffset* PartitionState::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
+inline int32_t CmdRequest_Mset::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mset.partition_id)
+  return _internal_partition_id();
 }
-inline ::client::SyncOffset* PartitionState::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
-  return temp;
+inline void CmdRequest_Mset::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_id_ = value;
 }
-inline void PartitionState::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
-  if (sync_offset) {
-    set_has_sync_offset();
-  } else {
-    clear_has_sync_offset();
-  }
+inline void CmdRequest_Mset::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mset.partition_id)
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_Sync
+// CmdRequest_Mdel
 
-// required .client.Node node = 1;
-inline bool CmdRequest_Sync::has_node() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required string table_name = 1;
+inline bool CmdRequest_Mdel::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Mdel::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Mdel::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Mdel::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mdel.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Mdel::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mdel.table_name)
+}
+inline std::string* CmdRequest_Mdel::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mdel.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Mdel::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Mdel::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mdel::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Mdel::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Mdel.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Mdel::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Mdel.table_name)
 }
-inline void CmdRequest_Sync::set_has_node() {
-  _has_bits_[0] |= 0x00000001u;
+
+// repeated string keys = 2;
+inline int CmdRequest_Mdel::_internal_keys_size() const {
+  return _impl_.keys_.size();
 }
-inline void CmdRequest_Sync::clear_has_node() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int CmdRequest_Mdel::keys_size() const {
+  return _internal_keys_size();
 }
-inline void CmdRequest_Sync::clear_node() {
-  if (node_ != NULL) node_->::client::Node::Clear();
-  clear_has_node();
+inline void CmdRequest_Mdel::clear_keys() {
+  _impl_.keys_.Clear();
 }
-inline const ::client::Node& CmdRequest_Sync::node() const {
-  return node_ != NULL ? *node_ : *default_instance_->node_;
+inline std::string* CmdRequest_Mdel::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:client.CmdRequest.Mdel.keys)
+  return _s;
 }
-inline ::client::Node* CmdRequest_Sync::mutable_node() {
-  set_has_node();
-  if (node_ == NULL) node_ = new ::client::Node;
-  return node_;
+inline const std::string& CmdRequest_Mdel::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
 }
-inline ::client::Node* CmdRequest_Sync::release_node() {
-  clear_has_node();
-  ::client::Node* temp = node_;
-  node_ = NULL;
-  return temp;
+inline const std::string& CmdRequest_Mdel::keys(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mdel.keys)
+  return _internal_keys(index);
 }
-inline void CmdRequest_Sync::set_allocated_node(::client::Node* node) {
-  delete node_;
-  node_ = node;
-  if (node) {
-    set_has_node();
-  } else {
-    clear_has_node();
-  }
+inline std::string* CmdRequest_Mdel::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Mdel.keys)
+  return _impl_.keys_.Mutable(index);
 }
-
-// required string table_name = 2;
-inline bool CmdRequest_Sync::has_table_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline void CmdRequest_Mdel::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mdel.keys)
 }
-inline void CmdRequest_Sync::set_has_table_name() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdRequest_Mdel::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mdel.keys)
 }
-inline void CmdRequest_Sync::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_Mdel::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:client.CmdRequest.Mdel.keys)
 }
-inline void CmdRequest_Sync::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline void CmdRequest_Mdel::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:client.CmdRequest.Mdel.keys)
 }
-inline const ::std::string& CmdRequest_Sync::table_name() const {
-  return *table_name_;
+inline std::string* CmdRequest_Mdel::_internal_add_keys() {
+  return _impl_.keys_.Add();
 }
-inline void CmdRequest_Sync::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdRequest_Mdel::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Mdel.keys)
 }
-inline void CmdRequest_Sync::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdRequest_Mdel::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:client.CmdRequest.Mdel.keys)
 }
-inline void CmdRequest_Sync::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest_Mdel::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:client.CmdRequest.Mdel.keys)
 }
-inline ::std::string* CmdRequest_Sync::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline void CmdRequest_Mdel::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:client.CmdRequest.Mdel.keys)
 }
-inline ::std::string* CmdRequest_Sync::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CmdRequest_Mdel::keys() const {
+  // @@protoc_insertion_point(field_list:client.CmdRequest.Mdel.keys)
+  return _impl_.keys_;
 }
-inline void CmdRequest_Sync::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CmdRequest_Mdel::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdRequest.Mdel.keys)
+  return &_impl_.keys_;
 }
 
-// required .client.SyncOffset sync_offset = 3;
-inline bool CmdRequest_Sync::has_sync_offset() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional int32 partition_id = 3;
+inline bool CmdRequest_Mdel::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest_Sync::set_has_sync_offset() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdRequest_Mdel::has_partition_id() const {
+  return _internal_has_partition_id();
 }
-inline void CmdRequest_Sync::clear_has_sync_offset() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void CmdRequest_Sync::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
+inline void CmdRequest_Mdel::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::client::SyncOffset& CmdRequest_Sync::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+inline int32_t CmdRequest_Mdel::_internal_partition_id() const {
+  return _impl_.partition_id_;
 }
-inline ::client::SyncOffset* CmdRequest_Sync::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
+inline int32_t CmdRequest_Mdel::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Mdel.partition_id)
+  return _internal_partition_id();
 }
-inline ::client::SyncOffset* CmdRequest_Sync::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
-  return temp;
+inline void CmdRequest_Mdel::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_id_ = value;
 }
-inline void CmdRequest_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
-  if (sync_offset) {
-    set_has_sync_offset();
-  } else {
-    clear_has_sync_offset();
-  }
+inline void CmdRequest_Mdel::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Mdel.partition_id)
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_Set
+// CmdRequest_Incrby
 
 // required string table_name = 1;
-inline bool CmdRequest_Set::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool CmdRequest_Incrby::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Incrby::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Incrby::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Incrby::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Incrby.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Incrby::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Incrby.table_name)
+}
+inline std::string* CmdRequest_Incrby::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Incrby.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Incrby::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Incrby::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Incrby::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Incrby::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Incrby.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Incrby::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Incrby.table_name)
 }
-inline void CmdRequest_Set::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+
+// required string key = 2;
+inline bool CmdRequest_Incrby::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Incrby::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdRequest_Incrby::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Incrby::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Incrby.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Incrby::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Incrby.key)
+}
+inline std::string* CmdRequest_Incrby::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Incrby.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Incrby::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Incrby::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Incrby::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Incrby::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Incrby.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Incrby::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Incrby.key)
 }
-inline void CmdRequest_Set::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+
+// required int64 by = 3;
+inline bool CmdRequest_Incrby::_internal_has_by() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdRequest_Set::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline bool CmdRequest_Incrby::has_by() const {
+  return _internal_has_by();
 }
-inline const ::std::string& CmdRequest_Set::table_name() const {
-  return *table_name_;
+inline void CmdRequest_Incrby::clear_by() {
+  _impl_.by_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_Set::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline int64_t CmdRequest_Incrby::_internal_by() const {
+  return _impl_.by_;
 }
-inline void CmdRequest_Set::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline int64_t CmdRequest_Incrby::by() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Incrby.by)
+  return _internal_by();
 }
-inline void CmdRequest_Set::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest_Incrby::_internal_set_by(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.by_ = value;
 }
-inline ::std::string* CmdRequest_Set::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline void CmdRequest_Incrby::set_by(int64_t value) {
+  _internal_set_by(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Incrby.by)
 }
-inline ::std::string* CmdRequest_Set::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Append
+
+// required string table_name = 1;
+inline bool CmdRequest_Append::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_Append::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdRequest_Append::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Append::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Append.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Append::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Append.table_name)
+}
+inline std::string* CmdRequest_Append::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Append.table_name)
+  return _s;
+}
+inline const std::string& CmdRequest_Append::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdRequest_Append::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Append::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Append::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Append.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Append::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdRequest_Set::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Append.table_name)
 }
 
 // required string key = 2;
-inline bool CmdRequest_Set::has_key() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdRequest_Set::set_has_key() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void CmdRequest_Set::clear_has_key() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdRequest_Append::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_Append::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdRequest_Append::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Append::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Append.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Append::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Append.key)
+}
+inline std::string* CmdRequest_Append::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Append.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Append::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Append::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Append::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Append::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Append.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Append::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Append.key)
 }
-inline void CmdRequest_Set::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
+
+// required bytes value = 3;
+inline bool CmdRequest_Append::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdRequest_Append::has_value() const {
+  return _internal_has_value();
+}
+inline void CmdRequest_Append::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CmdRequest_Append::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.Append.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Append::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdRequest.Append.value)
+}
+inline std::string* CmdRequest_Append::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.Append.value)
+  return _s;
+}
+inline const std::string& CmdRequest_Append::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdRequest_Append::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Append::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Append::release_value() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.Append.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Append::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  clear_has_key();
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.Append.value)
 }
-inline const ::std::string& CmdRequest_Set::key() const {
-  return *key_;
+
+// -------------------------------------------------------------------
+
+// CmdRequest
+
+// required .client.Type type = 1;
+inline bool CmdRequest::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
 }
-inline void CmdRequest_Set::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline bool CmdRequest::has_type() const {
+  return _internal_has_type();
 }
-inline void CmdRequest_Set::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline void CmdRequest::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
 }
-inline void CmdRequest_Set::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::Type CmdRequest::_internal_type() const {
+  return static_cast< ::client::Type >(_impl_.type_);
 }
-inline ::std::string* CmdRequest_Set::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+inline ::client::Type CmdRequest::type() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.type)
+  return _internal_type();
 }
-inline ::std::string* CmdRequest_Set::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest::_internal_set_type(::client::Type value) {
+  assert(::client::Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.type_ = value;
 }
-inline void CmdRequest_Set::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (key) {
-    set_has_key();
-    key_ = key;
-  } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void CmdRequest::set_type(::client::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.type)
 }
 
-// required bytes value = 3;
-inline bool CmdRequest_Set::has_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional .client.CmdRequest.Sync sync = 2;
+inline bool CmdRequest::_internal_has_sync() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sync_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Set::set_has_value() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdRequest::has_sync() const {
+  return _internal_has_sync();
 }
-inline void CmdRequest_Set::clear_has_value() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest::clear_sync() {
+  if (_impl_.sync_ != nullptr) _impl_.sync_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest_Set::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
-  }
-  clear_has_value();
+inline const ::client::CmdRequest_Sync& CmdRequest::_internal_sync() const {
+  const ::client::CmdRequest_Sync* p = _impl_.sync_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Sync&>(
+      ::client::_CmdRequest_Sync_default_instance_);
 }
-inline const ::std::string& CmdRequest_Set::value() const {
-  return *value_;
+inline const ::client::CmdRequest_Sync& CmdRequest::sync() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.sync)
+  return _internal_sync();
 }
-inline void CmdRequest_Set::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_sync(
+    ::client::CmdRequest_Sync* sync) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sync_);
   }
-  value_->assign(value);
-}
-inline void CmdRequest_Set::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+  _impl_.sync_ = sync;
+  if (sync) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  value_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.sync)
 }
-inline void CmdRequest_Set::set_value(const void* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::CmdRequest_Sync* CmdRequest::release_sync() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::CmdRequest_Sync* temp = _impl_.sync_;
+  _impl_.sync_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdRequest_Set::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  return value_;
+inline ::client::CmdRequest_Sync* CmdRequest::unsafe_arena_release_sync() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.sync)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::CmdRequest_Sync* temp = _impl_.sync_;
+  _impl_.sync_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdRequest_Set::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::CmdRequest_Sync* CmdRequest::_internal_mutable_sync() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.sync_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Sync>(GetArenaForAllocation());
+    _impl_.sync_ = p;
   }
+  return _impl_.sync_;
+}
+inline ::client::CmdRequest_Sync* CmdRequest::mutable_sync() {
+  ::client::CmdRequest_Sync* _msg = _internal_mutable_sync();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.sync)
+  return _msg;
 }
-inline void CmdRequest_Set::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+inline void CmdRequest::set_allocated_sync(::client::CmdRequest_Sync* sync) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sync_;
   }
-  if (value) {
-    set_has_value();
-    value_ = value;
+  if (sync) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync);
+    if (message_arena != submessage_arena) {
+      sync = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.sync_ = sync;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.sync)
 }
 
-// optional string uuid = 4;
-inline bool CmdRequest_Set::has_uuid() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional .client.CmdRequest.Set set = 3;
+inline bool CmdRequest::_internal_has_set() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.set_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Set::set_has_uuid() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdRequest::has_set() const {
+  return _internal_has_set();
 }
-inline void CmdRequest_Set::clear_has_uuid() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdRequest::clear_set() {
+  if (_impl_.set_ != nullptr) _impl_.set_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_Set::clear_uuid() {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    uuid_->clear();
-  }
-  clear_has_uuid();
+inline const ::client::CmdRequest_Set& CmdRequest::_internal_set() const {
+  const ::client::CmdRequest_Set* p = _impl_.set_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Set&>(
+      ::client::_CmdRequest_Set_default_instance_);
 }
-inline const ::std::string& CmdRequest_Set::uuid() const {
-  return *uuid_;
+inline const ::client::CmdRequest_Set& CmdRequest::set() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.set)
+  return _internal_set();
 }
-inline void CmdRequest_Set::set_uuid(const ::std::string& value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_set(
+    ::client::CmdRequest_Set* set) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.set_);
   }
-  uuid_->assign(value);
-}
-inline void CmdRequest_Set::set_uuid(const char* value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+  _impl_.set_ = set;
+  if (set) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  uuid_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.set)
 }
-inline void CmdRequest_Set::set_uuid(const char* value, size_t size) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  uuid_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::CmdRequest_Set* CmdRequest::release_set() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::CmdRequest_Set* temp = _impl_.set_;
+  _impl_.set_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdRequest_Set::mutable_uuid() {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  return uuid_;
+inline ::client::CmdRequest_Set* CmdRequest::unsafe_arena_release_set() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.set)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::CmdRequest_Set* temp = _impl_.set_;
+  _impl_.set_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdRequest_Set::release_uuid() {
-  clear_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = uuid_;
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::CmdRequest_Set* CmdRequest::_internal_mutable_set() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.set_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Set>(GetArenaForAllocation());
+    _impl_.set_ = p;
   }
+  return _impl_.set_;
+}
+inline ::client::CmdRequest_Set* CmdRequest::mutable_set() {
+  ::client::CmdRequest_Set* _msg = _internal_mutable_set();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.set)
+  return _msg;
 }
-inline void CmdRequest_Set::set_allocated_uuid(::std::string* uuid) {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
+inline void CmdRequest::set_allocated_set(::client::CmdRequest_Set* set) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.set_;
   }
-  if (uuid) {
-    set_has_uuid();
-    uuid_ = uuid;
+  if (set) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set);
+    if (message_arena != submessage_arena) {
+      set = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_uuid();
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.set_ = set;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.set)
 }
 
-// optional .client.KeyExpire expire = 5;
-inline bool CmdRequest_Set::has_expire() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional .client.CmdRequest.Get get = 4;
+inline bool CmdRequest::_internal_has_get() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.get_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Set::set_has_expire() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool CmdRequest::has_get() const {
+  return _internal_has_get();
 }
-inline void CmdRequest_Set::clear_has_expire() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void CmdRequest::clear_get() {
+  if (_impl_.get_ != nullptr) _impl_.get_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_Set::clear_expire() {
-  if (expire_ != NULL) expire_->::client::KeyExpire::Clear();
-  clear_has_expire();
+inline const ::client::CmdRequest_Get& CmdRequest::_internal_get() const {
+  const ::client::CmdRequest_Get* p = _impl_.get_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Get&>(
+      ::client::_CmdRequest_Get_default_instance_);
 }
-inline const ::client::KeyExpire& CmdRequest_Set::expire() const {
-  return expire_ != NULL ? *expire_ : *default_instance_->expire_;
+inline const ::client::CmdRequest_Get& CmdRequest::get() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.get)
+  return _internal_get();
 }
-inline ::client::KeyExpire* CmdRequest_Set::mutable_expire() {
-  set_has_expire();
-  if (expire_ == NULL) expire_ = new ::client::KeyExpire;
-  return expire_;
+inline void CmdRequest::unsafe_arena_set_allocated_get(
+    ::client::CmdRequest_Get* get) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.get_);
+  }
+  _impl_.get_ = get;
+  if (get) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.get)
 }
-inline ::client::KeyExpire* CmdRequest_Set::release_expire() {
-  clear_has_expire();
-  ::client::KeyExpire* temp = expire_;
-  expire_ = NULL;
+inline ::client::CmdRequest_Get* CmdRequest::release_get() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::CmdRequest_Get* temp = _impl_.get_;
+  _impl_.get_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline void CmdRequest_Set::set_allocated_expire(::client::KeyExpire* expire) {
-  delete expire_;
-  expire_ = expire;
-  if (expire) {
-    set_has_expire();
+inline ::client::CmdRequest_Get* CmdRequest::unsafe_arena_release_get() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.get)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::CmdRequest_Get* temp = _impl_.get_;
+  _impl_.get_ = nullptr;
+  return temp;
+}
+inline ::client::CmdRequest_Get* CmdRequest::_internal_mutable_get() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.get_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Get>(GetArenaForAllocation());
+    _impl_.get_ = p;
+  }
+  return _impl_.get_;
+}
+inline ::client::CmdRequest_Get* CmdRequest::mutable_get() {
+  ::client::CmdRequest_Get* _msg = _internal_mutable_get();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.get)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_get(::client::CmdRequest_Get* get) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.get_;
+  }
+  if (get) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get);
+    if (message_arena != submessage_arena) {
+      get = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, get, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_expire();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.get_ = get;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.get)
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_Get
-
-// required string table_name = 1;
-inline bool CmdRequest_Get::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.CmdRequest.Del del = 5;
+inline bool CmdRequest::_internal_has_del() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.del_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Get::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest::has_del() const {
+  return _internal_has_del();
 }
-inline void CmdRequest_Get::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest::clear_del() {
+  if (_impl_.del_ != nullptr) _impl_.del_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdRequest_Get::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline const ::client::CmdRequest_Del& CmdRequest::_internal_del() const {
+  const ::client::CmdRequest_Del* p = _impl_.del_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Del&>(
+      ::client::_CmdRequest_Del_default_instance_);
 }
-inline const ::std::string& CmdRequest_Get::table_name() const {
-  return *table_name_;
+inline const ::client::CmdRequest_Del& CmdRequest::del() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.del)
+  return _internal_del();
 }
-inline void CmdRequest_Get::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_del(
+    ::client::CmdRequest_Del* del) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.del_);
   }
-  table_name_->assign(value);
-}
-inline void CmdRequest_Get::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+  _impl_.del_ = del;
+  if (del) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  table_name_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.del)
 }
-inline void CmdRequest_Get::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::CmdRequest_Del* CmdRequest::release_del() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::CmdRequest_Del* temp = _impl_.del_;
+  _impl_.del_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdRequest_Get::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline ::client::CmdRequest_Del* CmdRequest::unsafe_arena_release_del() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.del)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::CmdRequest_Del* temp = _impl_.del_;
+  _impl_.del_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdRequest_Get::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::CmdRequest_Del* CmdRequest::_internal_mutable_del() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.del_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Del>(GetArenaForAllocation());
+    _impl_.del_ = p;
   }
+  return _impl_.del_;
+}
+inline ::client::CmdRequest_Del* CmdRequest::mutable_del() {
+  ::client::CmdRequest_Del* _msg = _internal_mutable_del();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.del)
+  return _msg;
 }
-inline void CmdRequest_Get::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline void CmdRequest::set_allocated_del(::client::CmdRequest_Del* del) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.del_;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+  if (del) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(del);
+    if (message_arena != submessage_arena) {
+      del = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, del, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.del_ = del;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.del)
 }
 
-// required string key = 2;
-inline bool CmdRequest_Get::has_key() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional .client.CmdRequest.Info info = 6;
+inline bool CmdRequest::_internal_has_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.info_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Get::set_has_key() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest::has_info() const {
+  return _internal_has_info();
 }
-inline void CmdRequest_Get::clear_has_key() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest::clear_info() {
+  if (_impl_.info_ != nullptr) _impl_.info_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdRequest_Get::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline const ::client::CmdRequest_Info& CmdRequest::_internal_info() const {
+  const ::client::CmdRequest_Info* p = _impl_.info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Info&>(
+      ::client::_CmdRequest_Info_default_instance_);
 }
-inline const ::std::string& CmdRequest_Get::key() const {
-  return *key_;
+inline const ::client::CmdRequest_Info& CmdRequest::info() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.info)
+  return _internal_info();
 }
-inline void CmdRequest_Get::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_info(
+    ::client::CmdRequest_Info* info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.info_);
   }
-  key_->assign(value);
-}
-inline void CmdRequest_Get::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
+  _impl_.info_ = info;
+  if (info) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  key_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.info)
 }
-inline void CmdRequest_Get::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::CmdRequest_Info* CmdRequest::release_info() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::CmdRequest_Info* temp = _impl_.info_;
+  _impl_.info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdRequest_Get::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+inline ::client::CmdRequest_Info* CmdRequest::unsafe_arena_release_info() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.info)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::CmdRequest_Info* temp = _impl_.info_;
+  _impl_.info_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdRequest_Get::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::CmdRequest_Info* CmdRequest::_internal_mutable_info() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Info>(GetArenaForAllocation());
+    _impl_.info_ = p;
   }
+  return _impl_.info_;
+}
+inline ::client::CmdRequest_Info* CmdRequest::mutable_info() {
+  ::client::CmdRequest_Info* _msg = _internal_mutable_info();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.info)
+  return _msg;
 }
-inline void CmdRequest_Get::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
+inline void CmdRequest::set_allocated_info(::client::CmdRequest_Info* info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.info_;
   }
-  if (key) {
-    set_has_key();
-    key_ = key;
+  if (info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(info);
+    if (message_arena != submessage_arena) {
+      info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, info, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.info_ = info;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.info)
 }
 
-// optional string uuid = 3;
-inline bool CmdRequest_Get::has_uuid() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional .client.CmdRequest.Mget mget = 7;
+inline bool CmdRequest::_internal_has_mget() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mget_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Get::set_has_uuid() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdRequest::has_mget() const {
+  return _internal_has_mget();
 }
-inline void CmdRequest_Get::clear_has_uuid() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest::clear_mget() {
+  if (_impl_.mget_ != nullptr) _impl_.mget_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void CmdRequest_Get::clear_uuid() {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    uuid_->clear();
-  }
-  clear_has_uuid();
+inline const ::client::CmdRequest_Mget& CmdRequest::_internal_mget() const {
+  const ::client::CmdRequest_Mget* p = _impl_.mget_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Mget&>(
+      ::client::_CmdRequest_Mget_default_instance_);
 }
-inline const ::std::string& CmdRequest_Get::uuid() const {
-  return *uuid_;
+inline const ::client::CmdRequest_Mget& CmdRequest::mget() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.mget)
+  return _internal_mget();
 }
-inline void CmdRequest_Get::set_uuid(const ::std::string& value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_mget(
+    ::client::CmdRequest_Mget* mget) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mget_);
   }
-  uuid_->assign(value);
-}
-inline void CmdRequest_Get::set_uuid(const char* value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+  _impl_.mget_ = mget;
+  if (mget) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
-  uuid_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.mget)
 }
-inline void CmdRequest_Get::set_uuid(const char* value, size_t size) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  uuid_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::CmdRequest_Mget* CmdRequest::release_mget() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::client::CmdRequest_Mget* temp = _impl_.mget_;
+  _impl_.mget_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdRequest_Get::mutable_uuid() {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  return uuid_;
+inline ::client::CmdRequest_Mget* CmdRequest::unsafe_arena_release_mget() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.mget)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::client::CmdRequest_Mget* temp = _impl_.mget_;
+  _impl_.mget_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdRequest_Get::release_uuid() {
-  clear_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = uuid_;
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::CmdRequest_Mget* CmdRequest::_internal_mutable_mget() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.mget_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Mget>(GetArenaForAllocation());
+    _impl_.mget_ = p;
   }
+  return _impl_.mget_;
+}
+inline ::client::CmdRequest_Mget* CmdRequest::mutable_mget() {
+  ::client::CmdRequest_Mget* _msg = _internal_mutable_mget();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.mget)
+  return _msg;
 }
-inline void CmdRequest_Get::set_allocated_uuid(::std::string* uuid) {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
+inline void CmdRequest::set_allocated_mget(::client::CmdRequest_Mget* mget) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mget_;
   }
-  if (uuid) {
-    set_has_uuid();
-    uuid_ = uuid;
+  if (mget) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mget);
+    if (message_arena != submessage_arena) {
+      mget = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mget, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_uuid();
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
-}
-
-// -------------------------------------------------------------------
-
-// CmdRequest_Del
+  _impl_.mget_ = mget;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.mget)
+}
 
-// required string table_name = 1;
-inline bool CmdRequest_Del::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.CmdRequest.Msync msync = 8;
+inline bool CmdRequest::_internal_has_msync() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.msync_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Del::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest::has_msync() const {
+  return _internal_has_msync();
 }
-inline void CmdRequest_Del::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest::clear_msync() {
+  if (_impl_.msync_ != nullptr) _impl_.msync_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void CmdRequest_Del::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline const ::client::CmdRequest_Msync& CmdRequest::_internal_msync() const {
+  const ::client::CmdRequest_Msync* p = _impl_.msync_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Msync&>(
+      ::client::_CmdRequest_Msync_default_instance_);
 }
-inline const ::std::string& CmdRequest_Del::table_name() const {
-  return *table_name_;
+inline const ::client::CmdRequest_Msync& CmdRequest::msync() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.msync)
+  return _internal_msync();
 }
-inline void CmdRequest_Del::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_msync(
+    ::client::CmdRequest_Msync* msync) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.msync_);
   }
-  table_name_->assign(value);
+  _impl_.msync_ = msync;
+  if (msync) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.msync)
+}
+inline ::client::CmdRequest_Msync* CmdRequest::release_msync() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::client::CmdRequest_Msync* temp = _impl_.msync_;
+  _impl_.msync_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CmdRequest_Del::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline ::client::CmdRequest_Msync* CmdRequest::unsafe_arena_release_msync() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.msync)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::client::CmdRequest_Msync* temp = _impl_.msync_;
+  _impl_.msync_ = nullptr;
+  return temp;
 }
-inline void CmdRequest_Del::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline ::client::CmdRequest_Msync* CmdRequest::_internal_mutable_msync() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.msync_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Msync>(GetArenaForAllocation());
+    _impl_.msync_ = p;
+  }
+  return _impl_.msync_;
+}
+inline ::client::CmdRequest_Msync* CmdRequest::mutable_msync() {
+  ::client::CmdRequest_Msync* _msg = _internal_mutable_msync();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.msync)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_msync(::client::CmdRequest_Msync* msync) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.msync_;
+  }
+  if (msync) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(msync);
+    if (message_arena != submessage_arena) {
+      msync = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, msync, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.msync_ = msync;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.msync)
 }
-inline ::std::string* CmdRequest_Del::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+
+// optional .client.CmdRequest.Subscribe subscribe = 9;
+inline bool CmdRequest::_internal_has_subscribe() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.subscribe_ != nullptr);
+  return value;
 }
-inline ::std::string* CmdRequest_Del::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline bool CmdRequest::has_subscribe() const {
+  return _internal_has_subscribe();
+}
+inline void CmdRequest::clear_subscribe() {
+  if (_impl_.subscribe_ != nullptr) _impl_.subscribe_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::client::CmdRequest_Subscribe& CmdRequest::_internal_subscribe() const {
+  const ::client::CmdRequest_Subscribe* p = _impl_.subscribe_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Subscribe&>(
+      ::client::_CmdRequest_Subscribe_default_instance_);
 }
-inline void CmdRequest_Del::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline const ::client::CmdRequest_Subscribe& CmdRequest::subscribe() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.subscribe)
+  return _internal_subscribe();
+}
+inline void CmdRequest::unsafe_arena_set_allocated_subscribe(
+    ::client::CmdRequest_Subscribe* subscribe) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.subscribe_);
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+  _impl_.subscribe_ = subscribe;
+  if (subscribe) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.subscribe)
+}
+inline ::client::CmdRequest_Subscribe* CmdRequest::release_subscribe() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::client::CmdRequest_Subscribe* temp = _impl_.subscribe_;
+  _impl_.subscribe_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdRequest_Subscribe* CmdRequest::unsafe_arena_release_subscribe() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.subscribe)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::client::CmdRequest_Subscribe* temp = _impl_.subscribe_;
+  _impl_.subscribe_ = nullptr;
+  return temp;
+}
+inline ::client::CmdRequest_Subscribe* CmdRequest::_internal_mutable_subscribe() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.subscribe_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Subscribe>(GetArenaForAllocation());
+    _impl_.subscribe_ = p;
+  }
+  return _impl_.subscribe_;
+}
+inline ::client::CmdRequest_Subscribe* CmdRequest::mutable_subscribe() {
+  ::client::CmdRequest_Subscribe* _msg = _internal_mutable_subscribe();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.subscribe)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_subscribe(::client::CmdRequest_Subscribe* subscribe) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.subscribe_;
+  }
+  if (subscribe) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(subscribe);
+    if (message_arena != submessage_arena) {
+      subscribe = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, subscribe, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.subscribe_ = subscribe;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.subscribe)
 }
 
-// required string key = 2;
-inline bool CmdRequest_Del::has_key() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional .client.CmdRequest.Mset mset = 10;
+inline bool CmdRequest::_internal_has_mset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mset_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Del::set_has_key() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest::has_mset() const {
+  return _internal_has_mset();
 }
-inline void CmdRequest_Del::clear_has_key() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest::clear_mset() {
+  if (_impl_.mset_ != nullptr) _impl_.mset_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void CmdRequest_Del::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline const ::client::CmdRequest_Mset& CmdRequest::_internal_mset() const {
+  const ::client::CmdRequest_Mset* p = _impl_.mset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Mset&>(
+      ::client::_CmdRequest_Mset_default_instance_);
 }
-inline const ::std::string& CmdRequest_Del::key() const {
-  return *key_;
+inline const ::client::CmdRequest_Mset& CmdRequest::mset() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.mset)
+  return _internal_mset();
 }
-inline void CmdRequest_Del::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_mset(
+    ::client::CmdRequest_Mset* mset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mset_);
   }
-  key_->assign(value);
+  _impl_.mset_ = mset;
+  if (mset) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.mset)
+}
+inline ::client::CmdRequest_Mset* CmdRequest::release_mset() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::client::CmdRequest_Mset* temp = _impl_.mset_;
+  _impl_.mset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CmdRequest_Del::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline ::client::CmdRequest_Mset* CmdRequest::unsafe_arena_release_mset() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.mset)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::client::CmdRequest_Mset* temp = _impl_.mset_;
+  _impl_.mset_ = nullptr;
+  return temp;
 }
-inline void CmdRequest_Del::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
+inline ::client::CmdRequest_Mset* CmdRequest::_internal_mutable_mset() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.mset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Mset>(GetArenaForAllocation());
+    _impl_.mset_ = p;
+  }
+  return _impl_.mset_;
+}
+inline ::client::CmdRequest_Mset* CmdRequest::mutable_mset() {
+  ::client::CmdRequest_Mset* _msg = _internal_mutable_mset();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.mset)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_mset(::client::CmdRequest_Mset* mset) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mset_;
+  }
+  if (mset) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mset);
+    if (message_arena != submessage_arena) {
+      mset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mset, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
   }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.mset_ = mset;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.mset)
 }
-inline ::std::string* CmdRequest_Del::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+
+// optional .client.CmdRequest.Mdel mdel = 11;
+inline bool CmdRequest::_internal_has_mdel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mdel_ != nullptr);
+  return value;
 }
-inline ::std::string* CmdRequest_Del::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline bool CmdRequest::has_mdel() const {
+  return _internal_has_mdel();
+}
+inline void CmdRequest::clear_mdel() {
+  if (_impl_.mdel_ != nullptr) _impl_.mdel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void CmdRequest_Del::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
+inline const ::client::CmdRequest_Mdel& CmdRequest::_internal_mdel() const {
+  const ::client::CmdRequest_Mdel* p = _impl_.mdel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Mdel&>(
+      ::client::_CmdRequest_Mdel_default_instance_);
+}
+inline const ::client::CmdRequest_Mdel& CmdRequest::mdel() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.mdel)
+  return _internal_mdel();
+}
+inline void CmdRequest::unsafe_arena_set_allocated_mdel(
+    ::client::CmdRequest_Mdel* mdel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mdel_);
   }
-  if (key) {
-    set_has_key();
-    key_ = key;
+  _impl_.mdel_ = mdel;
+  if (mdel) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.mdel)
+}
+inline ::client::CmdRequest_Mdel* CmdRequest::release_mdel() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::client::CmdRequest_Mdel* temp = _impl_.mdel_;
+  _impl_.mdel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdRequest_Mdel* CmdRequest::unsafe_arena_release_mdel() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.mdel)
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::client::CmdRequest_Mdel* temp = _impl_.mdel_;
+  _impl_.mdel_ = nullptr;
+  return temp;
+}
+inline ::client::CmdRequest_Mdel* CmdRequest::_internal_mutable_mdel() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.mdel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Mdel>(GetArenaForAllocation());
+    _impl_.mdel_ = p;
+  }
+  return _impl_.mdel_;
+}
+inline ::client::CmdRequest_Mdel* CmdRequest::mutable_mdel() {
+  ::client::CmdRequest_Mdel* _msg = _internal_mutable_mdel();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.mdel)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_mdel(::client::CmdRequest_Mdel* mdel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mdel_;
+  }
+  if (mdel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mdel);
+    if (message_arena != submessage_arena) {
+      mdel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mdel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
   } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000200u;
   }
+  _impl_.mdel_ = mdel;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.mdel)
 }
 
-// optional string uuid = 3;
-inline bool CmdRequest_Del::has_uuid() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional .client.CmdRequest.Incrby incrby = 12;
+inline bool CmdRequest::_internal_has_incrby() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.incrby_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Del::set_has_uuid() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdRequest::has_incrby() const {
+  return _internal_has_incrby();
 }
-inline void CmdRequest_Del::clear_has_uuid() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest::clear_incrby() {
+  if (_impl_.incrby_ != nullptr) _impl_.incrby_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
-inline void CmdRequest_Del::clear_uuid() {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    uuid_->clear();
-  }
-  clear_has_uuid();
+inline const ::client::CmdRequest_Incrby& CmdRequest::_internal_incrby() const {
+  const ::client::CmdRequest_Incrby* p = _impl_.incrby_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Incrby&>(
+      ::client::_CmdRequest_Incrby_default_instance_);
 }
-inline const ::std::string& CmdRequest_Del::uuid() const {
-  return *uuid_;
+inline const ::client::CmdRequest_Incrby& CmdRequest::incrby() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.incrby)
+  return _internal_incrby();
 }
-inline void CmdRequest_Del::set_uuid(const ::std::string& value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+inline void CmdRequest::unsafe_arena_set_allocated_incrby(
+    ::client::CmdRequest_Incrby* incrby) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.incrby_);
   }
-  uuid_->assign(value);
+  _impl_.incrby_ = incrby;
+  if (incrby) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.incrby)
+}
+inline ::client::CmdRequest_Incrby* CmdRequest::release_incrby() {
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::client::CmdRequest_Incrby* temp = _impl_.incrby_;
+  _impl_.incrby_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CmdRequest_Del::set_uuid(const char* value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  uuid_->assign(value);
+inline ::client::CmdRequest_Incrby* CmdRequest::unsafe_arena_release_incrby() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.incrby)
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::client::CmdRequest_Incrby* temp = _impl_.incrby_;
+  _impl_.incrby_ = nullptr;
+  return temp;
 }
-inline void CmdRequest_Del::set_uuid(const char* value, size_t size) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+inline ::client::CmdRequest_Incrby* CmdRequest::_internal_mutable_incrby() {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.incrby_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Incrby>(GetArenaForAllocation());
+    _impl_.incrby_ = p;
+  }
+  return _impl_.incrby_;
+}
+inline ::client::CmdRequest_Incrby* CmdRequest::mutable_incrby() {
+  ::client::CmdRequest_Incrby* _msg = _internal_mutable_incrby();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.incrby)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_incrby(::client::CmdRequest_Incrby* incrby) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.incrby_;
+  }
+  if (incrby) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(incrby);
+    if (message_arena != submessage_arena) {
+      incrby = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, incrby, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
   }
-  uuid_->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.incrby_ = incrby;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.incrby)
 }
-inline ::std::string* CmdRequest_Del::mutable_uuid() {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  return uuid_;
+
+// optional .client.CmdRequest.Append append = 13;
+inline bool CmdRequest::_internal_has_append() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.append_ != nullptr);
+  return value;
 }
-inline ::std::string* CmdRequest_Del::release_uuid() {
-  clear_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = uuid_;
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline bool CmdRequest::has_append() const {
+  return _internal_has_append();
 }
-inline void CmdRequest_Del::set_allocated_uuid(::std::string* uuid) {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
+inline void CmdRequest::clear_append() {
+  if (_impl_.append_ != nullptr) _impl_.append_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline const ::client::CmdRequest_Append& CmdRequest::_internal_append() const {
+  const ::client::CmdRequest_Append* p = _impl_.append_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest_Append&>(
+      ::client::_CmdRequest_Append_default_instance_);
+}
+inline const ::client::CmdRequest_Append& CmdRequest::append() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.append)
+  return _internal_append();
+}
+inline void CmdRequest::unsafe_arena_set_allocated_append(
+    ::client::CmdRequest_Append* append) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.append_);
   }
-  if (uuid) {
-    set_has_uuid();
-    uuid_ = uuid;
+  _impl_.append_ = append;
+  if (append) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdRequest.append)
+}
+inline ::client::CmdRequest_Append* CmdRequest::release_append() {
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::client::CmdRequest_Append* temp = _impl_.append_;
+  _impl_.append_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdRequest_Append* CmdRequest::unsafe_arena_release_append() {
+  // @@protoc_insertion_point(field_release:client.CmdRequest.append)
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::client::CmdRequest_Append* temp = _impl_.append_;
+  _impl_.append_ = nullptr;
+  return temp;
+}
+inline ::client::CmdRequest_Append* CmdRequest::_internal_mutable_append() {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.append_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest_Append>(GetArenaForAllocation());
+    _impl_.append_ = p;
+  }
+  return _impl_.append_;
+}
+inline ::client::CmdRequest_Append* CmdRequest::mutable_append() {
+  ::client::CmdRequest_Append* _msg = _internal_mutable_append();
+  // @@protoc_insertion_point(field_mutable:client.CmdRequest.append)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_append(::client::CmdRequest_Append* append) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.append_;
+  }
+  if (append) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append);
+    if (message_arena != submessage_arena) {
+      append = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, append, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
   } else {
-    clear_has_uuid();
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000800u;
   }
+  _impl_.append_ = append;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdRequest.append)
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_Info
-
-// optional string table_name = 1;
-inline bool CmdRequest_Info::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional int64 write_us = 14;
+inline bool CmdRequest::_internal_has_write_us() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
 }
-inline void CmdRequest_Info::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest::has_write_us() const {
+  return _internal_has_write_us();
 }
-inline void CmdRequest_Info::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest::clear_write_us() {
+  _impl_.write_us_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00001000u;
 }
-inline void CmdRequest_Info::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline int64_t CmdRequest::_internal_write_us() const {
+  return _impl_.write_us_;
 }
-inline const ::std::string& CmdRequest_Info::table_name() const {
-  return *table_name_;
+inline int64_t CmdRequest::write_us() const {
+  // @@protoc_insertion_point(field_get:client.CmdRequest.write_us)
+  return _internal_write_us();
 }
-inline void CmdRequest_Info::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdRequest::_internal_set_write_us(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.write_us_ = value;
 }
-inline void CmdRequest_Info::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdRequest::set_write_us(int64_t value) {
+  _internal_set_write_us(value);
+  // @@protoc_insertion_point(field_set:client.CmdRequest.write_us)
 }
-inline void CmdRequest_Info::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+
+// -------------------------------------------------------------------
+
+// CmdResponse_Sync
+
+// required string table_name = 1;
+inline bool CmdResponse_Sync::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* CmdRequest_Info::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline bool CmdResponse_Sync::has_table_name() const {
+  return _internal_has_table_name();
 }
-inline ::std::string* CmdRequest_Info::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdResponse_Sync::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_Sync::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Sync.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Sync::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Sync.table_name)
+}
+inline std::string* CmdResponse_Sync::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Sync.table_name)
+  return _s;
+}
+inline const std::string& CmdResponse_Sync::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdResponse_Sync::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Sync::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Sync::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Sync.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Sync::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void CmdRequest_Info::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Sync.table_name)
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_Mget
-
-// required string table_name = 1;
-inline bool CmdRequest_Mget::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required .client.SyncOffset sync_offset = 2;
+inline bool CmdResponse_Sync::_internal_has_sync_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sync_offset_ != nullptr);
+  return value;
 }
-inline void CmdRequest_Mget::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse_Sync::has_sync_offset() const {
+  return _internal_has_sync_offset();
 }
-inline void CmdRequest_Mget::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_Sync::clear_sync_offset() {
+  if (_impl_.sync_offset_ != nullptr) _impl_.sync_offset_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_Mget::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline const ::client::SyncOffset& CmdResponse_Sync::_internal_sync_offset() const {
+  const ::client::SyncOffset* p = _impl_.sync_offset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
 }
-inline const ::std::string& CmdRequest_Mget::table_name() const {
-  return *table_name_;
+inline const ::client::SyncOffset& CmdResponse_Sync::sync_offset() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Sync.sync_offset)
+  return _internal_sync_offset();
 }
-inline void CmdRequest_Mget::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_Sync::unsafe_arena_set_allocated_sync_offset(
+    ::client::SyncOffset* sync_offset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sync_offset_);
   }
-  table_name_->assign(value);
-}
-inline void CmdRequest_Mget::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+  _impl_.sync_offset_ = sync_offset;
+  if (sync_offset) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  table_name_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.Sync.sync_offset)
 }
-inline void CmdRequest_Mget::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::SyncOffset* CmdResponse_Sync::release_sync_offset() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdRequest_Mget::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline ::client::SyncOffset* CmdResponse_Sync::unsafe_arena_release_sync_offset() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Sync.sync_offset)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdRequest_Mget::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::SyncOffset* CmdResponse_Sync::_internal_mutable_sync_offset() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.sync_offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.sync_offset_ = p;
   }
+  return _impl_.sync_offset_;
 }
-inline void CmdRequest_Mget::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline ::client::SyncOffset* CmdResponse_Sync::mutable_sync_offset() {
+  ::client::SyncOffset* _msg = _internal_mutable_sync_offset();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Sync.sync_offset)
+  return _msg;
+}
+inline void CmdResponse_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sync_offset_;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+  if (sync_offset) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_offset);
+    if (message_arena != submessage_arena) {
+      sync_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_offset, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.sync_offset_ = sync_offset;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Sync.sync_offset)
 }
 
-// repeated string keys = 2;
-inline int CmdRequest_Mget::keys_size() const {
-  return keys_.size();
-}
-inline void CmdRequest_Mget::clear_keys() {
-  keys_.Clear();
+// repeated .client.ReplTerm repl_history = 3;
+inline int CmdResponse_Sync::_internal_repl_history_size() const {
+  return _impl_.repl_history_.size();
 }
-inline const ::std::string& CmdRequest_Mget::keys(int index) const {
-  return keys_.Get(index);
+inline int CmdResponse_Sync::repl_history_size() const {
+  return _internal_repl_history_size();
 }
-inline ::std::string* CmdRequest_Mget::mutable_keys(int index) {
-  return keys_.Mutable(index);
+inline void CmdResponse_Sync::clear_repl_history() {
+  _impl_.repl_history_.Clear();
 }
-inline void CmdRequest_Mget::set_keys(int index, const ::std::string& value) {
-  keys_.Mutable(index)->assign(value);
-}
-inline void CmdRequest_Mget::set_keys(int index, const char* value) {
-  keys_.Mutable(index)->assign(value);
-}
-inline void CmdRequest_Mget::set_keys(int index, const char* value, size_t size) {
-  keys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
+inline ::client::ReplTerm* CmdResponse_Sync::mutable_repl_history(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Sync.repl_history)
+  return _impl_.repl_history_.Mutable(index);
 }
-inline ::std::string* CmdRequest_Mget::add_keys() {
-  return keys_.Add();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::ReplTerm >*
+CmdResponse_Sync::mutable_repl_history() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.Sync.repl_history)
+  return &_impl_.repl_history_;
 }
-inline void CmdRequest_Mget::add_keys(const ::std::string& value) {
-  keys_.Add()->assign(value);
+inline const ::client::ReplTerm& CmdResponse_Sync::_internal_repl_history(int index) const {
+  return _impl_.repl_history_.Get(index);
 }
-inline void CmdRequest_Mget::add_keys(const char* value) {
-  keys_.Add()->assign(value);
+inline const ::client::ReplTerm& CmdResponse_Sync::repl_history(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Sync.repl_history)
+  return _internal_repl_history(index);
 }
-inline void CmdRequest_Mget::add_keys(const char* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::ReplTerm* CmdResponse_Sync::_internal_add_repl_history() {
+  return _impl_.repl_history_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-CmdRequest_Mget::keys() const {
-  return keys_;
+inline ::client::ReplTerm* CmdResponse_Sync::add_repl_history() {
+  ::client::ReplTerm* _add = _internal_add_repl_history();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.Sync.repl_history)
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-CmdRequest_Mget::mutable_keys() {
-  return &keys_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::ReplTerm >&
+CmdResponse_Sync::repl_history() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.Sync.repl_history)
+  return _impl_.repl_history_;
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest
+// CmdResponse_Get
 
-// required .client.Type type = 1;
-inline bool CmdRequest::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional bytes value = 1;
+inline bool CmdResponse_Get::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdRequest::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse_Get::has_value() const {
+  return _internal_has_value();
 }
-inline void CmdRequest::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_Get::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_Get::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Get.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Get::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Get.value)
+}
+inline std::string* CmdResponse_Get::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Get.value)
+  return _s;
+}
+inline const std::string& CmdResponse_Get::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdResponse_Get::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Get::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Get::release_value() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Get.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Get::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Get.value)
 }
-inline void CmdRequest::clear_type() {
-  type_ = 0;
-  clear_has_type();
+
+// -------------------------------------------------------------------
+
+// CmdResponse_InfoStats
+
+// required string table_name = 1;
+inline bool CmdResponse_InfoStats::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::client::Type CmdRequest::type() const {
-  return static_cast< ::client::Type >(type_);
+inline bool CmdResponse_InfoStats::has_table_name() const {
+  return _internal_has_table_name();
 }
-inline void CmdRequest::set_type(::client::Type value) {
-  assert(::client::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+inline void CmdResponse_InfoStats::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_InfoStats::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoStats.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_InfoStats::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoStats.table_name)
+}
+inline std::string* CmdResponse_InfoStats::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.InfoStats.table_name)
+  return _s;
+}
+inline const std::string& CmdResponse_InfoStats::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdResponse_InfoStats::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_InfoStats::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_InfoStats::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.InfoStats.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_InfoStats::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.InfoStats.table_name)
 }
 
-// optional .client.CmdRequest.Sync sync = 2;
-inline bool CmdRequest::has_sync() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdRequest::set_has_sync() {
-  _has_bits_[0] |= 0x00000002u;
+// required int64 total_querys = 2;
+inline bool CmdResponse_InfoStats::_internal_has_total_querys() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest::clear_has_sync() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse_InfoStats::has_total_querys() const {
+  return _internal_has_total_querys();
 }
-inline void CmdRequest::clear_sync() {
-  if (sync_ != NULL) sync_->::client::CmdRequest_Sync::Clear();
-  clear_has_sync();
+inline void CmdResponse_InfoStats::clear_total_querys() {
+  _impl_.total_querys_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::client::CmdRequest_Sync& CmdRequest::sync() const {
-  return sync_ != NULL ? *sync_ : *default_instance_->sync_;
+inline int64_t CmdResponse_InfoStats::_internal_total_querys() const {
+  return _impl_.total_querys_;
 }
-inline ::client::CmdRequest_Sync* CmdRequest::mutable_sync() {
-  set_has_sync();
-  if (sync_ == NULL) sync_ = new ::client::CmdRequest_Sync;
-  return sync_;
+inline int64_t CmdResponse_InfoStats::total_querys() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoStats.total_querys)
+  return _internal_total_querys();
 }
-inline ::client::CmdRequest_Sync* CmdRequest::release_sync() {
-  clear_has_sync();
-  ::client::CmdRequest_Sync* temp = sync_;
-  sync_ = NULL;
-  return temp;
+inline void CmdResponse_InfoStats::_internal_set_total_querys(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.total_querys_ = value;
 }
-inline void CmdRequest::set_allocated_sync(::client::CmdRequest_Sync* sync) {
-  delete sync_;
-  sync_ = sync;
-  if (sync) {
-    set_has_sync();
-  } else {
-    clear_has_sync();
-  }
+inline void CmdResponse_InfoStats::set_total_querys(int64_t value) {
+  _internal_set_total_querys(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoStats.total_querys)
 }
 
-// optional .client.CmdRequest.Set set = 3;
-inline bool CmdRequest::has_set() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// required int32 qps = 3;
+inline bool CmdResponse_InfoStats::_internal_has_qps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdRequest::set_has_set() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdResponse_InfoStats::has_qps() const {
+  return _internal_has_qps();
 }
-inline void CmdRequest::clear_has_set() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdResponse_InfoStats::clear_qps() {
+  _impl_.qps_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest::clear_set() {
-  if (set_ != NULL) set_->::client::CmdRequest_Set::Clear();
-  clear_has_set();
+inline int32_t CmdResponse_InfoStats::_internal_qps() const {
+  return _impl_.qps_;
 }
-inline const ::client::CmdRequest_Set& CmdRequest::set() const {
-  return set_ != NULL ? *set_ : *default_instance_->set_;
+inline int32_t CmdResponse_InfoStats::qps() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoStats.qps)
+  return _internal_qps();
 }
-inline ::client::CmdRequest_Set* CmdRequest::mutable_set() {
-  set_has_set();
-  if (set_ == NULL) set_ = new ::client::CmdRequest_Set;
-  return set_;
+inline void CmdResponse_InfoStats::_internal_set_qps(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.qps_ = value;
 }
-inline ::client::CmdRequest_Set* CmdRequest::release_set() {
-  clear_has_set();
-  ::client::CmdRequest_Set* temp = set_;
-  set_ = NULL;
-  return temp;
+inline void CmdResponse_InfoStats::set_qps(int32_t value) {
+  _internal_set_qps(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoStats.qps)
 }
-inline void CmdRequest::set_allocated_set(::client::CmdRequest_Set* set) {
-  delete set_;
-  set_ = set;
-  if (set) {
-    set_has_set();
+
+// -------------------------------------------------------------------
+
+// CmdResponse_InfoCapacity
+
+// required string table_name = 1;
+inline bool CmdResponse_InfoCapacity::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdResponse_InfoCapacity::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdResponse_InfoCapacity::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_InfoCapacity::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoCapacity.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_InfoCapacity::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoCapacity.table_name)
+}
+inline std::string* CmdResponse_InfoCapacity::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.InfoCapacity.table_name)
+  return _s;
+}
+inline const std::string& CmdResponse_InfoCapacity::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdResponse_InfoCapacity::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_InfoCapacity::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_InfoCapacity::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.InfoCapacity.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_InfoCapacity::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_set();
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.InfoCapacity.table_name)
 }
 
-// optional .client.CmdRequest.Get get = 4;
-inline bool CmdRequest::has_get() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void CmdRequest::set_has_get() {
-  _has_bits_[0] |= 0x00000008u;
+// required int64 used = 2;
+inline bool CmdResponse_InfoCapacity::_internal_has_used() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest::clear_has_get() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CmdResponse_InfoCapacity::has_used() const {
+  return _internal_has_used();
 }
-inline void CmdRequest::clear_get() {
-  if (get_ != NULL) get_->::client::CmdRequest_Get::Clear();
-  clear_has_get();
+inline void CmdResponse_InfoCapacity::clear_used() {
+  _impl_.used_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::client::CmdRequest_Get& CmdRequest::get() const {
-  return get_ != NULL ? *get_ : *default_instance_->get_;
+inline int64_t CmdResponse_InfoCapacity::_internal_used() const {
+  return _impl_.used_;
 }
-inline ::client::CmdRequest_Get* CmdRequest::mutable_get() {
-  set_has_get();
-  if (get_ == NULL) get_ = new ::client::CmdRequest_Get;
-  return get_;
+inline int64_t CmdResponse_InfoCapacity::used() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoCapacity.used)
+  return _internal_used();
 }
-inline ::client::CmdRequest_Get* CmdRequest::release_get() {
-  clear_has_get();
-  ::client::CmdRequest_Get* temp = get_;
-  get_ = NULL;
-  return temp;
+inline void CmdResponse_InfoCapacity::_internal_set_used(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.used_ = value;
 }
-inline void CmdRequest::set_allocated_get(::client::CmdRequest_Get* get) {
-  delete get_;
-  get_ = get;
-  if (get) {
-    set_has_get();
-  } else {
-    clear_has_get();
-  }
+inline void CmdResponse_InfoCapacity::set_used(int64_t value) {
+  _internal_set_used(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoCapacity.used)
 }
 
-// optional .client.CmdRequest.Del del = 5;
-inline bool CmdRequest::has_del() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// required int64 remain = 3;
+inline bool CmdResponse_InfoCapacity::_internal_has_remain() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdResponse_InfoCapacity::has_remain() const {
+  return _internal_has_remain();
 }
-inline void CmdRequest::set_has_del() {
-  _has_bits_[0] |= 0x00000010u;
+inline void CmdResponse_InfoCapacity::clear_remain() {
+  _impl_.remain_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest::clear_has_del() {
-  _has_bits_[0] &= ~0x00000010u;
+inline int64_t CmdResponse_InfoCapacity::_internal_remain() const {
+  return _impl_.remain_;
 }
-inline void CmdRequest::clear_del() {
-  if (del_ != NULL) del_->::client::CmdRequest_Del::Clear();
-  clear_has_del();
+inline int64_t CmdResponse_InfoCapacity::remain() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoCapacity.remain)
+  return _internal_remain();
 }
-inline const ::client::CmdRequest_Del& CmdRequest::del() const {
-  return del_ != NULL ? *del_ : *default_instance_->del_;
+inline void CmdResponse_InfoCapacity::_internal_set_remain(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.remain_ = value;
 }
-inline ::client::CmdRequest_Del* CmdRequest::mutable_del() {
-  set_has_del();
-  if (del_ == NULL) del_ = new ::client::CmdRequest_Del;
-  return del_;
+inline void CmdResponse_InfoCapacity::set_remain(int64_t value) {
+  _internal_set_remain(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoCapacity.remain)
 }
-inline ::client::CmdRequest_Del* CmdRequest::release_del() {
-  clear_has_del();
-  ::client::CmdRequest_Del* temp = del_;
-  del_ = NULL;
-  return temp;
+
+// -------------------------------------------------------------------
+
+// CmdResponse_InfoRepl
+
+// required string table_name = 1;
+inline bool CmdResponse_InfoRepl::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdRequest::set_allocated_del(::client::CmdRequest_Del* del) {
-  delete del_;
-  del_ = del;
-  if (del) {
-    set_has_del();
+inline bool CmdResponse_InfoRepl::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void CmdResponse_InfoRepl::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_InfoRepl::table_name() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoRepl.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_InfoRepl::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoRepl.table_name)
+}
+inline std::string* CmdResponse_InfoRepl::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.InfoRepl.table_name)
+  return _s;
+}
+inline const std::string& CmdResponse_InfoRepl::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void CmdResponse_InfoRepl::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_InfoRepl::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_InfoRepl::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.InfoRepl.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_InfoRepl::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_del();
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.InfoRepl.table_name)
 }
 
-// optional .client.CmdRequest.Info info = 6;
-inline bool CmdRequest::has_info() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void CmdRequest::set_has_info() {
-  _has_bits_[0] |= 0x00000020u;
+// required int64 partition_cnt = 2;
+inline bool CmdResponse_InfoRepl::_internal_has_partition_cnt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest::clear_has_info() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CmdResponse_InfoRepl::has_partition_cnt() const {
+  return _internal_has_partition_cnt();
 }
-inline void CmdRequest::clear_info() {
-  if (info_ != NULL) info_->::client::CmdRequest_Info::Clear();
-  clear_has_info();
+inline void CmdResponse_InfoRepl::clear_partition_cnt() {
+  _impl_.partition_cnt_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::client::CmdRequest_Info& CmdRequest::info() const {
-  return info_ != NULL ? *info_ : *default_instance_->info_;
+inline int64_t CmdResponse_InfoRepl::_internal_partition_cnt() const {
+  return _impl_.partition_cnt_;
 }
-inline ::client::CmdRequest_Info* CmdRequest::mutable_info() {
-  set_has_info();
-  if (info_ == NULL) info_ = new ::client::CmdRequest_Info;
-  return info_;
+inline int64_t CmdResponse_InfoRepl::partition_cnt() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoRepl.partition_cnt)
+  return _internal_partition_cnt();
 }
-inline ::client::CmdRequest_Info* CmdRequest::release_info() {
-  clear_has_info();
-  ::client::CmdRequest_Info* temp = info_;
-  info_ = NULL;
-  return temp;
+inline void CmdResponse_InfoRepl::_internal_set_partition_cnt(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_cnt_ = value;
 }
-inline void CmdRequest::set_allocated_info(::client::CmdRequest_Info* info) {
-  delete info_;
-  info_ = info;
-  if (info) {
-    set_has_info();
-  } else {
-    clear_has_info();
-  }
+inline void CmdResponse_InfoRepl::set_partition_cnt(int64_t value) {
+  _internal_set_partition_cnt(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoRepl.partition_cnt)
 }
 
-// optional .client.CmdRequest.Mget mget = 7;
-inline bool CmdRequest::has_mget() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+// repeated .client.PartitionState partition_state = 3;
+inline int CmdResponse_InfoRepl::_internal_partition_state_size() const {
+  return _impl_.partition_state_.size();
 }
-inline void CmdRequest::set_has_mget() {
-  _has_bits_[0] |= 0x00000040u;
+inline int CmdResponse_InfoRepl::partition_state_size() const {
+  return _internal_partition_state_size();
 }
-inline void CmdRequest::clear_has_mget() {
-  _has_bits_[0] &= ~0x00000040u;
+inline void CmdResponse_InfoRepl::clear_partition_state() {
+  _impl_.partition_state_.Clear();
 }
-inline void CmdRequest::clear_mget() {
-  if (mget_ != NULL) mget_->::client::CmdRequest_Mget::Clear();
-  clear_has_mget();
+inline ::client::PartitionState* CmdResponse_InfoRepl::mutable_partition_state(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.InfoRepl.partition_state)
+  return _impl_.partition_state_.Mutable(index);
 }
-inline const ::client::CmdRequest_Mget& CmdRequest::mget() const {
-  return mget_ != NULL ? *mget_ : *default_instance_->mget_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState >*
+CmdResponse_InfoRepl::mutable_partition_state() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.InfoRepl.partition_state)
+  return &_impl_.partition_state_;
 }
-inline ::client::CmdRequest_Mget* CmdRequest::mutable_mget() {
-  set_has_mget();
-  if (mget_ == NULL) mget_ = new ::client::CmdRequest_Mget;
-  return mget_;
+inline const ::client::PartitionState& CmdResponse_InfoRepl::_internal_partition_state(int index) const {
+  return _impl_.partition_state_.Get(index);
 }
-inline ::client::CmdRequest_Mget* CmdRequest::release_mget() {
-  clear_has_mget();
-  ::client::CmdRequest_Mget* temp = mget_;
-  mget_ = NULL;
-  return temp;
+inline const ::client::PartitionState& CmdResponse_InfoRepl::partition_state(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoRepl.partition_state)
+  return _internal_partition_state(index);
+}
+inline ::client::PartitionState* CmdResponse_InfoRepl::_internal_add_partition_state() {
+  return _impl_.partition_state_.Add();
+}
+inline ::client::PartitionState* CmdResponse_InfoRepl::add_partition_state() {
+  ::client::PartitionState* _add = _internal_add_partition_state();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.InfoRepl.partition_state)
+  return _add;
 }
-inline void CmdRequest::set_allocated_mget(::client::CmdRequest_Mget* mget) {
-  delete mget_;
-  mget_ = mget;
-  if (mget) {
-    set_has_mget();
-  } else {
-    clear_has_mget();
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::PartitionState >&
+CmdResponse_InfoRepl::partition_state() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.InfoRepl.partition_state)
+  return _impl_.partition_state_;
 }
 
 // -------------------------------------------------------------------
 
-// CmdResponse_Sync
+// CmdResponse_Mget
 
-// required string table_name = 1;
-inline bool CmdResponse_Sync::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdResponse_Sync::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void CmdResponse_Sync::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void CmdResponse_Sync::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+// required string key = 1;
+inline bool CmdResponse_Mget::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline const ::std::string& CmdResponse_Sync::table_name() const {
-  return *table_name_;
+inline bool CmdResponse_Mget::has_key() const {
+  return _internal_has_key();
 }
-inline void CmdResponse_Sync::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_Mget::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_Mget::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Mget.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Mget::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Mget.key)
+}
+inline std::string* CmdResponse_Mget::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Mget.key)
+  return _s;
+}
+inline const std::string& CmdResponse_Mget::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdResponse_Mget::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Mget::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Mget::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Mget.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Mget::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  table_name_->assign(value);
-}
-inline void CmdResponse_Sync::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  table_name_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Mget.key)
 }
-inline void CmdResponse_Sync::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+
+// required bytes value = 2;
+inline bool CmdResponse_Mget::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::std::string* CmdResponse_Sync::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline bool CmdResponse_Mget::has_value() const {
+  return _internal_has_value();
 }
-inline ::std::string* CmdResponse_Sync::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdResponse_Mget::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdResponse_Mget::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Mget.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Mget::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Mget.value)
+}
+inline std::string* CmdResponse_Mget::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Mget.value)
+  return _s;
+}
+inline const std::string& CmdResponse_Mget::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdResponse_Mget::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Mget::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Mget::release_value() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Mget.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Mget::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdResponse_Sync::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Mget.value)
 }
 
-// required .client.SyncOffset sync_offset = 2;
-inline bool CmdResponse_Sync::has_sync_offset() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdResponse_Sync::set_has_sync_offset() {
-  _has_bits_[0] |= 0x00000002u;
+// optional .client.StatusCode code = 3 [default = kOk];
+inline bool CmdResponse_Mget::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void CmdResponse_Sync::clear_has_sync_offset() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse_Mget::has_code() const {
+  return _internal_has_code();
 }
-inline void CmdResponse_Sync::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
-}
-inline const ::client::SyncOffset& CmdResponse_Sync::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+inline void CmdResponse_Mget::clear_code() {
+  _impl_.code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::client::SyncOffset* CmdResponse_Sync::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
+inline ::client::StatusCode CmdResponse_Mget::_internal_code() const {
+  return static_cast< ::client::StatusCode >(_impl_.code_);
 }
-inline ::client::SyncOffset* CmdResponse_Sync::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
-  return temp;
+inline ::client::StatusCode CmdResponse_Mget::code() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Mget.code)
+  return _internal_code();
 }
-inline void CmdResponse_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
-  if (sync_offset) {
-    set_has_sync_offset();
+inline void CmdResponse_Mget::_internal_set_code(::client::StatusCode value) {
+  assert(::client::StatusCode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.code_ = value;
+}
+inline void CmdResponse_Mget::set_code(::client::StatusCode value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Mget.code)
+}
+
+// optional string msg = 4;
+inline bool CmdResponse_Mget::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdResponse_Mget::has_msg() const {
+  return _internal_has_msg();
+}
+inline void CmdResponse_Mget::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CmdResponse_Mget::msg() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Mget.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Mget::set_msg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Mget.msg)
+}
+inline std::string* CmdResponse_Mget::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Mget.msg)
+  return _s;
+}
+inline const std::string& CmdResponse_Mget::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void CmdResponse_Mget::_internal_set_msg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Mget::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Mget::release_msg() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Mget.msg)
+  if (!_internal_has_msg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.msg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Mget::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_sync_offset();
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Mget.msg)
 }
 
-// -------------------------------------------------------------------
-
-// CmdResponse_Get
-
-// optional bytes value = 1;
-inline bool CmdResponse_Get::has_value() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.Node redirect = 5;
+inline bool CmdResponse_Mget::_internal_has_redirect() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.redirect_ != nullptr);
+  return value;
 }
-inline void CmdResponse_Get::set_has_value() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse_Mget::has_redirect() const {
+  return _internal_has_redirect();
 }
-inline void CmdResponse_Get::clear_has_value() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_Mget::clear_redirect() {
+  if (_impl_.redirect_ != nullptr) _impl_.redirect_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdResponse_Get::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
-  }
-  clear_has_value();
+inline const ::client::Node& CmdResponse_Mget::_internal_redirect() const {
+  const ::client::Node* p = _impl_.redirect_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
 }
-inline const ::std::string& CmdResponse_Get::value() const {
-  return *value_;
-}
-inline void CmdResponse_Get::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+inline const ::client::Node& CmdResponse_Mget::redirect() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Mget.redirect)
+  return _internal_redirect();
 }
-inline void CmdResponse_Get::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline void CmdResponse_Mget::unsafe_arena_set_allocated_redirect(
+    ::client::Node* redirect) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.redirect_);
   }
-  value_->assign(value);
+  _impl_.redirect_ = redirect;
+  if (redirect) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.Mget.redirect)
+}
+inline ::client::Node* CmdResponse_Mget::release_redirect() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::Node* temp = _impl_.redirect_;
+  _impl_.redirect_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CmdResponse_Get::set_value(const void* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::Node* CmdResponse_Mget::unsafe_arena_release_redirect() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Mget.redirect)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::Node* temp = _impl_.redirect_;
+  _impl_.redirect_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdResponse_Get::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline ::client::Node* CmdResponse_Mget::_internal_mutable_redirect() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.redirect_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.redirect_ = p;
   }
-  return value_;
+  return _impl_.redirect_;
 }
-inline ::std::string* CmdResponse_Get::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::client::Node* CmdResponse_Mget::mutable_redirect() {
+  ::client::Node* _msg = _internal_mutable_redirect();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Mget.redirect)
+  return _msg;
 }
-inline void CmdResponse_Get::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+inline void CmdResponse_Mget::set_allocated_redirect(::client::Node* redirect) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.redirect_;
   }
-  if (value) {
-    set_has_value();
-    value_ = value;
+  if (redirect) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(redirect);
+    if (message_arena != submessage_arena) {
+      redirect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, redirect, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.redirect_ = redirect;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Mget.redirect)
 }
 
 // -------------------------------------------------------------------
 
-// CmdResponse_InfoStats
+// CmdResponse_InfoServer
 
-// required string table_name = 1;
-inline bool CmdResponse_InfoStats::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required int64 epoch = 1;
+inline bool CmdResponse_InfoServer::_internal_has_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdResponse_InfoStats::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse_InfoServer::has_epoch() const {
+  return _internal_has_epoch();
 }
-inline void CmdResponse_InfoStats::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_InfoServer::clear_epoch() {
+  _impl_.epoch_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_InfoStats::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline int64_t CmdResponse_InfoServer::_internal_epoch() const {
+  return _impl_.epoch_;
 }
-inline const ::std::string& CmdResponse_InfoStats::table_name() const {
-  return *table_name_;
+inline int64_t CmdResponse_InfoServer::epoch() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoServer.epoch)
+  return _internal_epoch();
 }
-inline void CmdResponse_InfoStats::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdResponse_InfoServer::_internal_set_epoch(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.epoch_ = value;
 }
-inline void CmdResponse_InfoStats::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdResponse_InfoServer::set_epoch(int64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoServer.epoch)
 }
-inline void CmdResponse_InfoStats::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+
+// repeated string table_names = 2;
+inline int CmdResponse_InfoServer::_internal_table_names_size() const {
+  return _impl_.table_names_.size();
 }
-inline ::std::string* CmdResponse_InfoStats::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline int CmdResponse_InfoServer::table_names_size() const {
+  return _internal_table_names_size();
 }
-inline ::std::string* CmdResponse_InfoStats::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdResponse_InfoServer::clear_table_names() {
+  _impl_.table_names_.Clear();
 }
-inline void CmdResponse_InfoStats::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline std::string* CmdResponse_InfoServer::add_table_names() {
+  std::string* _s = _internal_add_table_names();
+  // @@protoc_insertion_point(field_add_mutable:client.CmdResponse.InfoServer.table_names)
+  return _s;
 }
-
-// required int64 total_querys = 2;
-inline bool CmdResponse_InfoStats::has_total_querys() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline const std::string& CmdResponse_InfoServer::_internal_table_names(int index) const {
+  return _impl_.table_names_.Get(index);
 }
-inline void CmdResponse_InfoStats::set_has_total_querys() {
-  _has_bits_[0] |= 0x00000002u;
+inline const std::string& CmdResponse_InfoServer::table_names(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoServer.table_names)
+  return _internal_table_names(index);
 }
-inline void CmdResponse_InfoStats::clear_has_total_querys() {
-  _has_bits_[0] &= ~0x00000002u;
+inline std::string* CmdResponse_InfoServer::mutable_table_names(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.InfoServer.table_names)
+  return _impl_.table_names_.Mutable(index);
 }
-inline void CmdResponse_InfoStats::clear_total_querys() {
-  total_querys_ = GOOGLE_LONGLONG(0);
-  clear_has_total_querys();
+inline void CmdResponse_InfoServer::set_table_names(int index, const std::string& value) {
+  _impl_.table_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoServer.table_names)
 }
-inline ::google::protobuf::int64 CmdResponse_InfoStats::total_querys() const {
-  return total_querys_;
+inline void CmdResponse_InfoServer::set_table_names(int index, std::string&& value) {
+  _impl_.table_names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoServer.table_names)
 }
-inline void CmdResponse_InfoStats::set_total_querys(::google::protobuf::int64 value) {
-  set_has_total_querys();
-  total_querys_ = value;
+inline void CmdResponse_InfoServer::set_table_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.table_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:client.CmdResponse.InfoServer.table_names)
 }
-
-// required int32 qps = 3;
-inline bool CmdResponse_InfoStats::has_qps() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline void CmdResponse_InfoServer::set_table_names(int index, const char* value, size_t size) {
+  _impl_.table_names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:client.CmdResponse.InfoServer.table_names)
 }
-inline void CmdResponse_InfoStats::set_has_qps() {
-  _has_bits_[0] |= 0x00000004u;
+inline std::string* CmdResponse_InfoServer::_internal_add_table_names() {
+  return _impl_.table_names_.Add();
 }
-inline void CmdResponse_InfoStats::clear_has_qps() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdResponse_InfoServer::add_table_names(const std::string& value) {
+  _impl_.table_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:client.CmdResponse.InfoServer.table_names)
 }
-inline void CmdResponse_InfoStats::clear_qps() {
-  qps_ = 0;
-  clear_has_qps();
+inline void CmdResponse_InfoServer::add_table_names(std::string&& value) {
+  _impl_.table_names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:client.CmdResponse.InfoServer.table_names)
 }
-inline ::google::protobuf::int32 CmdResponse_InfoStats::qps() const {
-  return qps_;
+inline void CmdResponse_InfoServer::add_table_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.table_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:client.CmdResponse.InfoServer.table_names)
 }
-inline void CmdResponse_InfoStats::set_qps(::google::protobuf::int32 value) {
-  set_has_qps();
-  qps_ = value;
+inline void CmdResponse_InfoServer::add_table_names(const char* value, size_t size) {
+  _impl_.table_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:client.CmdResponse.InfoServer.table_names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CmdResponse_InfoServer::table_names() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.InfoServer.table_names)
+  return _impl_.table_names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CmdResponse_InfoServer::mutable_table_names() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.InfoServer.table_names)
+  return &_impl_.table_names_;
 }
 
-// -------------------------------------------------------------------
-
-// CmdResponse_InfoCapacity
-
-// required string table_name = 1;
-inline bool CmdResponse_InfoCapacity::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required .client.Node cur_meta = 3;
+inline bool CmdResponse_InfoServer::_internal_has_cur_meta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cur_meta_ != nullptr);
+  return value;
 }
-inline void CmdResponse_InfoCapacity::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse_InfoServer::has_cur_meta() const {
+  return _internal_has_cur_meta();
 }
-inline void CmdResponse_InfoCapacity::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_InfoServer::clear_cur_meta() {
+  if (_impl_.cur_meta_ != nullptr) _impl_.cur_meta_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_InfoCapacity::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline const ::client::Node& CmdResponse_InfoServer::_internal_cur_meta() const {
+  const ::client::Node* p = _impl_.cur_meta_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
 }
-inline const ::std::string& CmdResponse_InfoCapacity::table_name() const {
-  return *table_name_;
+inline const ::client::Node& CmdResponse_InfoServer::cur_meta() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoServer.cur_meta)
+  return _internal_cur_meta();
 }
-inline void CmdResponse_InfoCapacity::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_InfoServer::unsafe_arena_set_allocated_cur_meta(
+    ::client::Node* cur_meta) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cur_meta_);
   }
-  table_name_->assign(value);
-}
-inline void CmdResponse_InfoCapacity::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+  _impl_.cur_meta_ = cur_meta;
+  if (cur_meta) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  table_name_->assign(value);
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.InfoServer.cur_meta)
 }
-inline void CmdResponse_InfoCapacity::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::Node* CmdResponse_InfoServer::release_cur_meta() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::Node* temp = _impl_.cur_meta_;
+  _impl_.cur_meta_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* CmdResponse_InfoCapacity::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline ::client::Node* CmdResponse_InfoServer::unsafe_arena_release_cur_meta() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.InfoServer.cur_meta)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::Node* temp = _impl_.cur_meta_;
+  _impl_.cur_meta_ = nullptr;
+  return temp;
 }
-inline ::std::string* CmdResponse_InfoCapacity::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::client::Node* CmdResponse_InfoServer::_internal_mutable_cur_meta() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.cur_meta_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.cur_meta_ = p;
   }
+  return _impl_.cur_meta_;
 }
-inline void CmdResponse_InfoCapacity::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline ::client::Node* CmdResponse_InfoServer::mutable_cur_meta() {
+  ::client::Node* _msg = _internal_mutable_cur_meta();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.InfoServer.cur_meta)
+  return _msg;
+}
+inline void CmdResponse_InfoServer::set_allocated_cur_meta(::client::Node* cur_meta) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cur_meta_;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+  if (cur_meta) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cur_meta);
+    if (message_arena != submessage_arena) {
+      cur_meta = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cur_meta, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.cur_meta_ = cur_meta;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.InfoServer.cur_meta)
 }
 
-// required int64 used = 2;
-inline bool CmdResponse_InfoCapacity::has_used() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required bool meta_renewing = 4;
+inline bool CmdResponse_InfoServer::_internal_has_meta_renewing() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdResponse_InfoServer::has_meta_renewing() const {
+  return _internal_has_meta_renewing();
 }
-inline void CmdResponse_InfoCapacity::set_has_used() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdResponse_InfoServer::clear_meta_renewing() {
+  _impl_.meta_renewing_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdResponse_InfoCapacity::clear_has_used() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse_InfoServer::_internal_meta_renewing() const {
+  return _impl_.meta_renewing_;
 }
-inline void CmdResponse_InfoCapacity::clear_used() {
-  used_ = GOOGLE_LONGLONG(0);
-  clear_has_used();
+inline bool CmdResponse_InfoServer::meta_renewing() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.InfoServer.meta_renewing)
+  return _internal_meta_renewing();
 }
-inline ::google::protobuf::int64 CmdResponse_InfoCapacity::used() const {
-  return used_;
+inline void CmdResponse_InfoServer::_internal_set_meta_renewing(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.meta_renewing_ = value;
 }
-inline void CmdResponse_InfoCapacity::set_used(::google::protobuf::int64 value) {
-  set_has_used();
-  used_ = value;
+inline void CmdResponse_InfoServer::set_meta_renewing(bool value) {
+  _internal_set_meta_renewing(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.InfoServer.meta_renewing)
 }
 
-// required int64 remain = 3;
-inline bool CmdResponse_InfoCapacity::has_remain() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// CmdResponse_Subscribe_Record
+
+// required int32 partition = 1;
+inline bool CmdResponse_Subscribe_Record::_internal_has_partition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void CmdResponse_InfoCapacity::set_has_remain() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdResponse_Subscribe_Record::has_partition() const {
+  return _internal_has_partition();
 }
-inline void CmdResponse_InfoCapacity::clear_has_remain() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdResponse_Subscribe_Record::clear_partition() {
+  _impl_.partition_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdResponse_InfoCapacity::clear_remain() {
-  remain_ = GOOGLE_LONGLONG(0);
-  clear_has_remain();
+inline int32_t CmdResponse_Subscribe_Record::_internal_partition() const {
+  return _impl_.partition_;
 }
-inline ::google::protobuf::int64 CmdResponse_InfoCapacity::remain() const {
-  return remain_;
+inline int32_t CmdResponse_Subscribe_Record::partition() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.Record.partition)
+  return _internal_partition();
 }
-inline void CmdResponse_InfoCapacity::set_remain(::google::protobuf::int64 value) {
-  set_has_remain();
-  remain_ = value;
+inline void CmdResponse_Subscribe_Record::_internal_set_partition(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.partition_ = value;
+}
+inline void CmdResponse_Subscribe_Record::set_partition(int32_t value) {
+  _internal_set_partition(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Subscribe.Record.partition)
 }
 
-// -------------------------------------------------------------------
-
-// CmdResponse_InfoRepl
-
-// required string table_name = 1;
-inline bool CmdResponse_InfoRepl::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required .client.Type type = 2;
+inline bool CmdResponse_Subscribe_Record::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void CmdResponse_InfoRepl::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse_Subscribe_Record::has_type() const {
+  return _internal_has_type();
 }
-inline void CmdResponse_InfoRepl::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_Subscribe_Record::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdResponse_InfoRepl::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline ::client::Type CmdResponse_Subscribe_Record::_internal_type() const {
+  return static_cast< ::client::Type >(_impl_.type_);
 }
-inline const ::std::string& CmdResponse_InfoRepl::table_name() const {
-  return *table_name_;
+inline ::client::Type CmdResponse_Subscribe_Record::type() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.Record.type)
+  return _internal_type();
 }
-inline void CmdResponse_InfoRepl::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_Subscribe_Record::_internal_set_type(::client::Type value) {
+  assert(::client::Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void CmdResponse_Subscribe_Record::set_type(::client::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Subscribe.Record.type)
+}
+
+// required bytes key = 3;
+inline bool CmdResponse_Subscribe_Record::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdResponse_Subscribe_Record::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdResponse_Subscribe_Record::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_Subscribe_Record::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.Record.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Subscribe_Record::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Subscribe.Record.key)
+}
+inline std::string* CmdResponse_Subscribe_Record::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Subscribe.Record.key)
+  return _s;
+}
+inline const std::string& CmdResponse_Subscribe_Record::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdResponse_Subscribe_Record::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Subscribe_Record::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Subscribe_Record::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Subscribe.Record.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Subscribe_Record::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  table_name_->assign(value);
-}
-inline void CmdResponse_InfoRepl::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  table_name_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Subscribe.Record.key)
 }
-inline void CmdResponse_InfoRepl::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional bytes value = 4;
+inline bool CmdResponse_Subscribe_Record::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::std::string* CmdResponse_InfoRepl::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline bool CmdResponse_Subscribe_Record::has_value() const {
+  return _internal_has_value();
 }
-inline ::std::string* CmdResponse_InfoRepl::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdResponse_Subscribe_Record::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_InfoRepl::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline const std::string& CmdResponse_Subscribe_Record::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.Record.value)
+  return _internal_value();
 }
-
-// required int64 partition_cnt = 2;
-inline bool CmdResponse_InfoRepl::has_partition_cnt() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Subscribe_Record::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Subscribe.Record.value)
 }
-inline void CmdResponse_InfoRepl::set_has_partition_cnt() {
-  _has_bits_[0] |= 0x00000002u;
+inline std::string* CmdResponse_Subscribe_Record::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Subscribe.Record.value)
+  return _s;
 }
-inline void CmdResponse_InfoRepl::clear_has_partition_cnt() {
-  _has_bits_[0] &= ~0x00000002u;
+inline const std::string& CmdResponse_Subscribe_Record::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void CmdResponse_InfoRepl::clear_partition_cnt() {
-  partition_cnt_ = GOOGLE_LONGLONG(0);
-  clear_has_partition_cnt();
+inline void CmdResponse_Subscribe_Record::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Subscribe_Record::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline ::google::protobuf::int64 CmdResponse_InfoRepl::partition_cnt() const {
-  return partition_cnt_;
+inline std::string* CmdResponse_Subscribe_Record::release_value() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Subscribe.Record.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void CmdResponse_InfoRepl::set_partition_cnt(::google::protobuf::int64 value) {
-  set_has_partition_cnt();
-  partition_cnt_ = value;
+inline void CmdResponse_Subscribe_Record::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Subscribe.Record.value)
 }
 
-// repeated .client.PartitionState partition_state = 3;
-inline int CmdResponse_InfoRepl::partition_state_size() const {
-  return partition_state_.size();
+// required .client.SyncOffset cursor = 5;
+inline bool CmdResponse_Subscribe_Record::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cursor_ != nullptr);
+  return value;
 }
-inline void CmdResponse_InfoRepl::clear_partition_state() {
-  partition_state_.Clear();
+inline bool CmdResponse_Subscribe_Record::has_cursor() const {
+  return _internal_has_cursor();
 }
-inline const ::client::PartitionState& CmdResponse_InfoRepl::partition_state(int index) const {
-  return partition_state_.Get(index);
+inline void CmdResponse_Subscribe_Record::clear_cursor() {
+  if (_impl_.cursor_ != nullptr) _impl_.cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::client::PartitionState* CmdResponse_InfoRepl::mutable_partition_state(int index) {
-  return partition_state_.Mutable(index);
+inline const ::client::SyncOffset& CmdResponse_Subscribe_Record::_internal_cursor() const {
+  const ::client::SyncOffset* p = _impl_.cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
 }
-inline ::client::PartitionState* CmdResponse_InfoRepl::add_partition_state() {
-  return partition_state_.Add();
+inline const ::client::SyncOffset& CmdResponse_Subscribe_Record::cursor() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.Record.cursor)
+  return _internal_cursor();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::PartitionState >&
-CmdResponse_InfoRepl::partition_state() const {
-  return partition_state_;
+inline void CmdResponse_Subscribe_Record::unsafe_arena_set_allocated_cursor(
+    ::client::SyncOffset* cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cursor_);
+  }
+  _impl_.cursor_ = cursor;
+  if (cursor) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.Subscribe.Record.cursor)
+}
+inline ::client::SyncOffset* CmdResponse_Subscribe_Record::release_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::SyncOffset* temp = _impl_.cursor_;
+  _impl_.cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::PartitionState >*
-CmdResponse_InfoRepl::mutable_partition_state() {
-  return &partition_state_;
+inline ::client::SyncOffset* CmdResponse_Subscribe_Record::unsafe_arena_release_cursor() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.Subscribe.Record.cursor)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::SyncOffset* temp = _impl_.cursor_;
+  _impl_.cursor_ = nullptr;
+  return temp;
+}
+inline ::client::SyncOffset* CmdResponse_Subscribe_Record::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.cursor_ = p;
+  }
+  return _impl_.cursor_;
+}
+inline ::client::SyncOffset* CmdResponse_Subscribe_Record::mutable_cursor() {
+  ::client::SyncOffset* _msg = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Subscribe.Record.cursor)
+  return _msg;
+}
+inline void CmdResponse_Subscribe_Record::set_allocated_cursor(::client::SyncOffset* cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cursor_;
+  }
+  if (cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cursor);
+    if (message_arena != submessage_arena) {
+      cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.cursor_ = cursor;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.Subscribe.Record.cursor)
 }
 
 // -------------------------------------------------------------------
 
-// CmdResponse_Mget
+// CmdResponse_Subscribe
 
-// required string key = 1;
-inline bool CmdResponse_Mget::has_key() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdResponse_Mget::set_has_key() {
-  _has_bits_[0] |= 0x00000001u;
+// repeated .client.CmdResponse.Subscribe.Record records = 1;
+inline int CmdResponse_Subscribe::_internal_records_size() const {
+  return _impl_.records_.size();
 }
-inline void CmdResponse_Mget::clear_has_key() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int CmdResponse_Subscribe::records_size() const {
+  return _internal_records_size();
 }
-inline void CmdResponse_Mget::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline void CmdResponse_Subscribe::clear_records() {
+  _impl_.records_.Clear();
 }
-inline const ::std::string& CmdResponse_Mget::key() const {
-  return *key_;
+inline ::client::CmdResponse_Subscribe_Record* CmdResponse_Subscribe::mutable_records(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Subscribe.records)
+  return _impl_.records_.Mutable(index);
 }
-inline void CmdResponse_Mget::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Subscribe_Record >*
+CmdResponse_Subscribe::mutable_records() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.Subscribe.records)
+  return &_impl_.records_;
 }
-inline void CmdResponse_Mget::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline const ::client::CmdResponse_Subscribe_Record& CmdResponse_Subscribe::_internal_records(int index) const {
+  return _impl_.records_.Get(index);
 }
-inline void CmdResponse_Mget::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+inline const ::client::CmdResponse_Subscribe_Record& CmdResponse_Subscribe::records(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.records)
+  return _internal_records(index);
 }
-inline ::std::string* CmdResponse_Mget::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+inline ::client::CmdResponse_Subscribe_Record* CmdResponse_Subscribe::_internal_add_records() {
+  return _impl_.records_.Add();
 }
-inline ::std::string* CmdResponse_Mget::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::client::CmdResponse_Subscribe_Record* CmdResponse_Subscribe::add_records() {
+  ::client::CmdResponse_Subscribe_Record* _add = _internal_add_records();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.Subscribe.records)
+  return _add;
 }
-inline void CmdResponse_Mget::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (key) {
-    set_has_key();
-    key_ = key;
-  } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Subscribe_Record >&
+CmdResponse_Subscribe::records() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.Subscribe.records)
+  return _impl_.records_;
 }
 
-// required bytes value = 2;
-inline bool CmdResponse_Mget::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdResponse_Mget::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
+// repeated .client.SyncOffset cursors = 2;
+inline int CmdResponse_Subscribe::_internal_cursors_size() const {
+  return _impl_.cursors_.size();
 }
-inline void CmdResponse_Mget::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int CmdResponse_Subscribe::cursors_size() const {
+  return _internal_cursors_size();
 }
-inline void CmdResponse_Mget::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
-  }
-  clear_has_value();
+inline void CmdResponse_Subscribe::clear_cursors() {
+  _impl_.cursors_.Clear();
 }
-inline const ::std::string& CmdResponse_Mget::value() const {
-  return *value_;
+inline ::client::SyncOffset* CmdResponse_Subscribe::mutable_cursors(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.Subscribe.cursors)
+  return _impl_.cursors_.Mutable(index);
 }
-inline void CmdResponse_Mget::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >*
+CmdResponse_Subscribe::mutable_cursors() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.Subscribe.cursors)
+  return &_impl_.cursors_;
 }
-inline void CmdResponse_Mget::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+inline const ::client::SyncOffset& CmdResponse_Subscribe::_internal_cursors(int index) const {
+  return _impl_.cursors_.Get(index);
 }
-inline void CmdResponse_Mget::set_value(const void* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+inline const ::client::SyncOffset& CmdResponse_Subscribe::cursors(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Subscribe.cursors)
+  return _internal_cursors(index);
 }
-inline ::std::string* CmdResponse_Mget::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  return value_;
+inline ::client::SyncOffset* CmdResponse_Subscribe::_internal_add_cursors() {
+  return _impl_.cursors_.Add();
 }
-inline ::std::string* CmdResponse_Mget::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::client::SyncOffset* CmdResponse_Subscribe::add_cursors() {
+  ::client::SyncOffset* _add = _internal_add_cursors();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.Subscribe.cursors)
+  return _add;
 }
-inline void CmdResponse_Mget::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (value) {
-    set_has_value();
-    value_ = value;
-  } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::SyncOffset >&
+CmdResponse_Subscribe::cursors() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.Subscribe.cursors)
+  return _impl_.cursors_;
 }
 
 // -------------------------------------------------------------------
 
-// CmdResponse_InfoServer
+// CmdResponse_KeyResult
 
-// required int64 epoch = 1;
-inline bool CmdResponse_InfoServer::has_epoch() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required string key = 1;
+inline bool CmdResponse_KeyResult::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdResponse_KeyResult::has_key() const {
+  return _internal_has_key();
+}
+inline void CmdResponse_KeyResult::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_KeyResult::key() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.KeyResult.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_KeyResult::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.KeyResult.key)
+}
+inline std::string* CmdResponse_KeyResult::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.KeyResult.key)
+  return _s;
+}
+inline const std::string& CmdResponse_KeyResult::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdResponse_KeyResult::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_KeyResult::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_KeyResult::release_key() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.KeyResult.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_KeyResult::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.KeyResult.key)
 }
-inline void CmdResponse_InfoServer::set_has_epoch() {
-  _has_bits_[0] |= 0x00000001u;
+
+// required .client.StatusCode code = 2;
+inline bool CmdResponse_KeyResult::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void CmdResponse_InfoServer::clear_has_epoch() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CmdResponse_KeyResult::has_code() const {
+  return _internal_has_code();
 }
-inline void CmdResponse_InfoServer::clear_epoch() {
-  epoch_ = GOOGLE_LONGLONG(0);
-  clear_has_epoch();
+inline void CmdResponse_KeyResult::clear_code() {
+  _impl_.code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int64 CmdResponse_InfoServer::epoch() const {
-  return epoch_;
+inline ::client::StatusCode CmdResponse_KeyResult::_internal_code() const {
+  return static_cast< ::client::StatusCode >(_impl_.code_);
 }
-inline void CmdResponse_InfoServer::set_epoch(::google::protobuf::int64 value) {
-  set_has_epoch();
-  epoch_ = value;
+inline ::client::StatusCode CmdResponse_KeyResult::code() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.KeyResult.code)
+  return _internal_code();
 }
-
-// repeated string table_names = 2;
-inline int CmdResponse_InfoServer::table_names_size() const {
-  return table_names_.size();
+inline void CmdResponse_KeyResult::_internal_set_code(::client::StatusCode value) {
+  assert(::client::StatusCode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.code_ = value;
 }
-inline void CmdResponse_InfoServer::clear_table_names() {
-  table_names_.Clear();
+inline void CmdResponse_KeyResult::set_code(::client::StatusCode value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.KeyResult.code)
 }
-inline const ::std::string& CmdResponse_InfoServer::table_names(int index) const {
-  return table_names_.Get(index);
+
+// optional string msg = 3;
+inline bool CmdResponse_KeyResult::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdResponse_KeyResult::has_msg() const {
+  return _internal_has_msg();
+}
+inline void CmdResponse_KeyResult::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdResponse_KeyResult::msg() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.KeyResult.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_KeyResult::set_msg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.KeyResult.msg)
+}
+inline std::string* CmdResponse_KeyResult::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.KeyResult.msg)
+  return _s;
+}
+inline const std::string& CmdResponse_KeyResult::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void CmdResponse_KeyResult::_internal_set_msg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_KeyResult::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_KeyResult::release_msg() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.KeyResult.msg)
+  if (!_internal_has_msg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.msg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_KeyResult::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.KeyResult.msg)
 }
-inline ::std::string* CmdResponse_InfoServer::mutable_table_names(int index) {
-  return table_names_.Mutable(index);
+
+// optional .client.Node redirect = 4;
+inline bool CmdResponse_KeyResult::_internal_has_redirect() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.redirect_ != nullptr);
+  return value;
 }
-inline void CmdResponse_InfoServer::set_table_names(int index, const ::std::string& value) {
-  table_names_.Mutable(index)->assign(value);
+inline bool CmdResponse_KeyResult::has_redirect() const {
+  return _internal_has_redirect();
 }
-inline void CmdResponse_InfoServer::set_table_names(int index, const char* value) {
-  table_names_.Mutable(index)->assign(value);
+inline void CmdResponse_KeyResult::clear_redirect() {
+  if (_impl_.redirect_ != nullptr) _impl_.redirect_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdResponse_InfoServer::set_table_names(int index, const char* value, size_t size) {
-  table_names_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
+inline const ::client::Node& CmdResponse_KeyResult::_internal_redirect() const {
+  const ::client::Node* p = _impl_.redirect_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
 }
-inline ::std::string* CmdResponse_InfoServer::add_table_names() {
-  return table_names_.Add();
+inline const ::client::Node& CmdResponse_KeyResult::redirect() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.KeyResult.redirect)
+  return _internal_redirect();
 }
-inline void CmdResponse_InfoServer::add_table_names(const ::std::string& value) {
-  table_names_.Add()->assign(value);
+inline void CmdResponse_KeyResult::unsafe_arena_set_allocated_redirect(
+    ::client::Node* redirect) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.redirect_);
+  }
+  _impl_.redirect_ = redirect;
+  if (redirect) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.KeyResult.redirect)
+}
+inline ::client::Node* CmdResponse_KeyResult::release_redirect() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::Node* temp = _impl_.redirect_;
+  _impl_.redirect_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CmdResponse_InfoServer::add_table_names(const char* value) {
-  table_names_.Add()->assign(value);
+inline ::client::Node* CmdResponse_KeyResult::unsafe_arena_release_redirect() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.KeyResult.redirect)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::Node* temp = _impl_.redirect_;
+  _impl_.redirect_ = nullptr;
+  return temp;
 }
-inline void CmdResponse_InfoServer::add_table_names(const char* value, size_t size) {
-  table_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+inline ::client::Node* CmdResponse_KeyResult::_internal_mutable_redirect() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.redirect_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.redirect_ = p;
+  }
+  return _impl_.redirect_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-CmdResponse_InfoServer::table_names() const {
-  return table_names_;
+inline ::client::Node* CmdResponse_KeyResult::mutable_redirect() {
+  ::client::Node* _msg = _internal_mutable_redirect();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.KeyResult.redirect)
+  return _msg;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-CmdResponse_InfoServer::mutable_table_names() {
-  return &table_names_;
+inline void CmdResponse_KeyResult::set_allocated_redirect(::client::Node* redirect) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.redirect_;
+  }
+  if (redirect) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(redirect);
+    if (message_arena != submessage_arena) {
+      redirect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, redirect, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.redirect_ = redirect;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.KeyResult.redirect)
 }
 
-// required .client.Node cur_meta = 3;
-inline bool CmdResponse_InfoServer::has_cur_meta() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void CmdResponse_InfoServer::set_has_cur_meta() {
-  _has_bits_[0] |= 0x00000004u;
+// -------------------------------------------------------------------
+
+// CmdResponse_Incrby
+
+// required int64 value = 1;
+inline bool CmdResponse_Incrby::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdResponse_InfoServer::clear_has_cur_meta() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CmdResponse_Incrby::has_value() const {
+  return _internal_has_value();
 }
-inline void CmdResponse_InfoServer::clear_cur_meta() {
-  if (cur_meta_ != NULL) cur_meta_->::client::Node::Clear();
-  clear_has_cur_meta();
+inline void CmdResponse_Incrby::clear_value() {
+  _impl_.value_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::client::Node& CmdResponse_InfoServer::cur_meta() const {
-  return cur_meta_ != NULL ? *cur_meta_ : *default_instance_->cur_meta_;
+inline int64_t CmdResponse_Incrby::_internal_value() const {
+  return _impl_.value_;
 }
-inline ::client::Node* CmdResponse_InfoServer::mutable_cur_meta() {
-  set_has_cur_meta();
-  if (cur_meta_ == NULL) cur_meta_ = new ::client::Node;
-  return cur_meta_;
+inline int64_t CmdResponse_Incrby::value() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Incrby.value)
+  return _internal_value();
 }
-inline ::client::Node* CmdResponse_InfoServer::release_cur_meta() {
-  clear_has_cur_meta();
-  ::client::Node* temp = cur_meta_;
-  cur_meta_ = NULL;
-  return temp;
+inline void CmdResponse_Incrby::_internal_set_value(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_ = value;
 }
-inline void CmdResponse_InfoServer::set_allocated_cur_meta(::client::Node* cur_meta) {
-  delete cur_meta_;
-  cur_meta_ = cur_meta;
-  if (cur_meta) {
-    set_has_cur_meta();
-  } else {
-    clear_has_cur_meta();
-  }
+inline void CmdResponse_Incrby::set_value(int64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Incrby.value)
 }
 
-// required bool meta_renewing = 4;
-inline bool CmdResponse_InfoServer::has_meta_renewing() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// -------------------------------------------------------------------
+
+// CmdResponse_Append
+
+// required int64 length = 1;
+inline bool CmdResponse_Append::_internal_has_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdResponse_InfoServer::set_has_meta_renewing() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdResponse_Append::has_length() const {
+  return _internal_has_length();
 }
-inline void CmdResponse_InfoServer::clear_has_meta_renewing() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdResponse_Append::clear_length() {
+  _impl_.length_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_InfoServer::clear_meta_renewing() {
-  meta_renewing_ = false;
-  clear_has_meta_renewing();
+inline int64_t CmdResponse_Append::_internal_length() const {
+  return _impl_.length_;
 }
-inline bool CmdResponse_InfoServer::meta_renewing() const {
-  return meta_renewing_;
+inline int64_t CmdResponse_Append::length() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.Append.length)
+  return _internal_length();
 }
-inline void CmdResponse_InfoServer::set_meta_renewing(bool value) {
-  set_has_meta_renewing();
-  meta_renewing_ = value;
+inline void CmdResponse_Append::_internal_set_length(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.length_ = value;
+}
+inline void CmdResponse_Append::set_length(int64_t value) {
+  _internal_set_length(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.Append.length)
 }
 
 // -------------------------------------------------------------------
@@ -5252,371 +15707,999 @@ inline void CmdResponse_InfoServer::set_meta_renewing(bool value) {
 // CmdResponse
 
 // required .client.Type type = 1;
-inline bool CmdResponse::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool CmdResponse::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void CmdResponse::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void CmdResponse::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CmdResponse::has_type() const {
+  return _internal_has_type();
 }
 inline void CmdResponse::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::client::Type CmdResponse::_internal_type() const {
+  return static_cast< ::client::Type >(_impl_.type_);
 }
 inline ::client::Type CmdResponse::type() const {
-  return static_cast< ::client::Type >(type_);
+  // @@protoc_insertion_point(field_get:client.CmdResponse.type)
+  return _internal_type();
 }
-inline void CmdResponse::set_type(::client::Type value) {
+inline void CmdResponse::_internal_set_type(::client::Type value) {
   assert(::client::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.type_ = value;
+}
+inline void CmdResponse::set_type(::client::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.type)
 }
 
 // required .client.StatusCode code = 2;
-inline bool CmdResponse::has_code() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdResponse::set_has_code() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdResponse::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void CmdResponse::clear_has_code() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse::has_code() const {
+  return _internal_has_code();
 }
 inline void CmdResponse::clear_code() {
-  code_ = 0;
-  clear_has_code();
+  _impl_.code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::client::StatusCode CmdResponse::_internal_code() const {
+  return static_cast< ::client::StatusCode >(_impl_.code_);
 }
 inline ::client::StatusCode CmdResponse::code() const {
-  return static_cast< ::client::StatusCode >(code_);
+  // @@protoc_insertion_point(field_get:client.CmdResponse.code)
+  return _internal_code();
 }
-inline void CmdResponse::set_code(::client::StatusCode value) {
+inline void CmdResponse::_internal_set_code(::client::StatusCode value) {
   assert(::client::StatusCode_IsValid(value));
-  set_has_code();
-  code_ = value;
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.code_ = value;
+}
+inline void CmdResponse::set_code(::client::StatusCode value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:client.CmdResponse.code)
 }
 
 // optional string msg = 3;
-inline bool CmdResponse::has_msg() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool CmdResponse::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdResponse::set_has_msg() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void CmdResponse::clear_has_msg() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CmdResponse::has_msg() const {
+  return _internal_has_msg();
 }
 inline void CmdResponse::clear_msg() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    msg_->clear();
-  }
-  clear_has_msg();
-}
-inline const ::std::string& CmdResponse::msg() const {
-  return *msg_;
-}
-inline void CmdResponse::set_msg(const ::std::string& value) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(value);
-}
-inline void CmdResponse::set_msg(const char* value) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(value);
-}
-inline void CmdResponse::set_msg(const char* value, size_t size) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CmdResponse::mutable_msg() {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  return msg_;
-}
-inline ::std::string* CmdResponse::release_msg() {
-  clear_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.msg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse::msg() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse::set_msg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.CmdResponse.msg)
+}
+inline std::string* CmdResponse::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.msg)
+  return _s;
+}
+inline const std::string& CmdResponse::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void CmdResponse::_internal_set_msg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse::release_msg() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.msg)
+  if (!_internal_has_msg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.msg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = msg_;
-    msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdResponse::set_allocated_msg(::std::string* msg) {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (msg) {
-    set_has_msg();
-    msg_ = msg;
-  } else {
-    clear_has_msg();
-    msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.msg)
 }
 
 // optional .client.CmdResponse.Sync sync = 4;
-inline bool CmdResponse::has_sync() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void CmdResponse::set_has_sync() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdResponse::_internal_has_sync() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sync_ != nullptr);
+  return value;
 }
-inline void CmdResponse::clear_has_sync() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CmdResponse::has_sync() const {
+  return _internal_has_sync();
 }
 inline void CmdResponse::clear_sync() {
-  if (sync_ != NULL) sync_->::client::CmdResponse_Sync::Clear();
-  clear_has_sync();
+  if (_impl_.sync_ != nullptr) _impl_.sync_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::client::CmdResponse_Sync& CmdResponse::_internal_sync() const {
+  const ::client::CmdResponse_Sync* p = _impl_.sync_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdResponse_Sync&>(
+      ::client::_CmdResponse_Sync_default_instance_);
 }
 inline const ::client::CmdResponse_Sync& CmdResponse::sync() const {
-  return sync_ != NULL ? *sync_ : *default_instance_->sync_;
+  // @@protoc_insertion_point(field_get:client.CmdResponse.sync)
+  return _internal_sync();
 }
-inline ::client::CmdResponse_Sync* CmdResponse::mutable_sync() {
-  set_has_sync();
-  if (sync_ == NULL) sync_ = new ::client::CmdResponse_Sync;
-  return sync_;
+inline void CmdResponse::unsafe_arena_set_allocated_sync(
+    ::client::CmdResponse_Sync* sync) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sync_);
+  }
+  _impl_.sync_ = sync;
+  if (sync) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.sync)
 }
 inline ::client::CmdResponse_Sync* CmdResponse::release_sync() {
-  clear_has_sync();
-  ::client::CmdResponse_Sync* temp = sync_;
-  sync_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::CmdResponse_Sync* temp = _impl_.sync_;
+  _impl_.sync_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdResponse_Sync* CmdResponse::unsafe_arena_release_sync() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.sync)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::CmdResponse_Sync* temp = _impl_.sync_;
+  _impl_.sync_ = nullptr;
   return temp;
 }
+inline ::client::CmdResponse_Sync* CmdResponse::_internal_mutable_sync() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.sync_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdResponse_Sync>(GetArenaForAllocation());
+    _impl_.sync_ = p;
+  }
+  return _impl_.sync_;
+}
+inline ::client::CmdResponse_Sync* CmdResponse::mutable_sync() {
+  ::client::CmdResponse_Sync* _msg = _internal_mutable_sync();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.sync)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_sync(::client::CmdResponse_Sync* sync) {
-  delete sync_;
-  sync_ = sync;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sync_;
+  }
   if (sync) {
-    set_has_sync();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync);
+    if (message_arena != submessage_arena) {
+      sync = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_sync();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.sync_ = sync;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.sync)
 }
 
 // optional .client.CmdResponse.Get get = 5;
-inline bool CmdResponse::has_get() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void CmdResponse::set_has_get() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool CmdResponse::_internal_has_get() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.get_ != nullptr);
+  return value;
 }
-inline void CmdResponse::clear_has_get() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool CmdResponse::has_get() const {
+  return _internal_has_get();
 }
 inline void CmdResponse::clear_get() {
-  if (get_ != NULL) get_->::client::CmdResponse_Get::Clear();
-  clear_has_get();
+  if (_impl_.get_ != nullptr) _impl_.get_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::client::CmdResponse_Get& CmdResponse::_internal_get() const {
+  const ::client::CmdResponse_Get* p = _impl_.get_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdResponse_Get&>(
+      ::client::_CmdResponse_Get_default_instance_);
 }
 inline const ::client::CmdResponse_Get& CmdResponse::get() const {
-  return get_ != NULL ? *get_ : *default_instance_->get_;
+  // @@protoc_insertion_point(field_get:client.CmdResponse.get)
+  return _internal_get();
 }
-inline ::client::CmdResponse_Get* CmdResponse::mutable_get() {
-  set_has_get();
-  if (get_ == NULL) get_ = new ::client::CmdResponse_Get;
-  return get_;
+inline void CmdResponse::unsafe_arena_set_allocated_get(
+    ::client::CmdResponse_Get* get) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.get_);
+  }
+  _impl_.get_ = get;
+  if (get) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.get)
 }
 inline ::client::CmdResponse_Get* CmdResponse::release_get() {
-  clear_has_get();
-  ::client::CmdResponse_Get* temp = get_;
-  get_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::CmdResponse_Get* temp = _impl_.get_;
+  _impl_.get_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdResponse_Get* CmdResponse::unsafe_arena_release_get() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.get)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::CmdResponse_Get* temp = _impl_.get_;
+  _impl_.get_ = nullptr;
   return temp;
 }
+inline ::client::CmdResponse_Get* CmdResponse::_internal_mutable_get() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.get_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdResponse_Get>(GetArenaForAllocation());
+    _impl_.get_ = p;
+  }
+  return _impl_.get_;
+}
+inline ::client::CmdResponse_Get* CmdResponse::mutable_get() {
+  ::client::CmdResponse_Get* _msg = _internal_mutable_get();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.get)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_get(::client::CmdResponse_Get* get) {
-  delete get_;
-  get_ = get;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.get_;
+  }
   if (get) {
-    set_has_get();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get);
+    if (message_arena != submessage_arena) {
+      get = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, get, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_get();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.get_ = get;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.get)
 }
 
 // optional .client.Node redirect = 6;
-inline bool CmdResponse::has_redirect() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void CmdResponse::set_has_redirect() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool CmdResponse::_internal_has_redirect() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.redirect_ != nullptr);
+  return value;
 }
-inline void CmdResponse::clear_has_redirect() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CmdResponse::has_redirect() const {
+  return _internal_has_redirect();
 }
 inline void CmdResponse::clear_redirect() {
-  if (redirect_ != NULL) redirect_->::client::Node::Clear();
-  clear_has_redirect();
+  if (_impl_.redirect_ != nullptr) _impl_.redirect_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::client::Node& CmdResponse::_internal_redirect() const {
+  const ::client::Node* p = _impl_.redirect_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
 }
 inline const ::client::Node& CmdResponse::redirect() const {
-  return redirect_ != NULL ? *redirect_ : *default_instance_->redirect_;
+  // @@protoc_insertion_point(field_get:client.CmdResponse.redirect)
+  return _internal_redirect();
 }
-inline ::client::Node* CmdResponse::mutable_redirect() {
-  set_has_redirect();
-  if (redirect_ == NULL) redirect_ = new ::client::Node;
-  return redirect_;
+inline void CmdResponse::unsafe_arena_set_allocated_redirect(
+    ::client::Node* redirect) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.redirect_);
+  }
+  _impl_.redirect_ = redirect;
+  if (redirect) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.redirect)
 }
 inline ::client::Node* CmdResponse::release_redirect() {
-  clear_has_redirect();
-  ::client::Node* temp = redirect_;
-  redirect_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::Node* temp = _impl_.redirect_;
+  _impl_.redirect_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::Node* CmdResponse::unsafe_arena_release_redirect() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.redirect)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::Node* temp = _impl_.redirect_;
+  _impl_.redirect_ = nullptr;
   return temp;
 }
+inline ::client::Node* CmdResponse::_internal_mutable_redirect() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.redirect_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.redirect_ = p;
+  }
+  return _impl_.redirect_;
+}
+inline ::client::Node* CmdResponse::mutable_redirect() {
+  ::client::Node* _msg = _internal_mutable_redirect();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.redirect)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_redirect(::client::Node* redirect) {
-  delete redirect_;
-  redirect_ = redirect;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.redirect_;
+  }
   if (redirect) {
-    set_has_redirect();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(redirect);
+    if (message_arena != submessage_arena) {
+      redirect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, redirect, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_redirect();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.redirect_ = redirect;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.redirect)
 }
 
 // repeated .client.CmdResponse.InfoStats info_stats = 7;
+inline int CmdResponse::_internal_info_stats_size() const {
+  return _impl_.info_stats_.size();
+}
 inline int CmdResponse::info_stats_size() const {
-  return info_stats_.size();
+  return _internal_info_stats_size();
 }
 inline void CmdResponse::clear_info_stats() {
-  info_stats_.Clear();
+  _impl_.info_stats_.Clear();
+}
+inline ::client::CmdResponse_InfoStats* CmdResponse::mutable_info_stats(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.info_stats)
+  return _impl_.info_stats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
+CmdResponse::mutable_info_stats() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.info_stats)
+  return &_impl_.info_stats_;
+}
+inline const ::client::CmdResponse_InfoStats& CmdResponse::_internal_info_stats(int index) const {
+  return _impl_.info_stats_.Get(index);
 }
 inline const ::client::CmdResponse_InfoStats& CmdResponse::info_stats(int index) const {
-  return info_stats_.Get(index);
+  // @@protoc_insertion_point(field_get:client.CmdResponse.info_stats)
+  return _internal_info_stats(index);
 }
-inline ::client::CmdResponse_InfoStats* CmdResponse::mutable_info_stats(int index) {
-  return info_stats_.Mutable(index);
+inline ::client::CmdResponse_InfoStats* CmdResponse::_internal_add_info_stats() {
+  return _impl_.info_stats_.Add();
 }
 inline ::client::CmdResponse_InfoStats* CmdResponse::add_info_stats() {
-  return info_stats_.Add();
+  ::client::CmdResponse_InfoStats* _add = _internal_add_info_stats();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.info_stats)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
 CmdResponse::info_stats() const {
-  return info_stats_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
-CmdResponse::mutable_info_stats() {
-  return &info_stats_;
+  // @@protoc_insertion_point(field_list:client.CmdResponse.info_stats)
+  return _impl_.info_stats_;
 }
 
 // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+inline int CmdResponse::_internal_info_capacity_size() const {
+  return _impl_.info_capacity_.size();
+}
 inline int CmdResponse::info_capacity_size() const {
-  return info_capacity_.size();
+  return _internal_info_capacity_size();
 }
 inline void CmdResponse::clear_info_capacity() {
-  info_capacity_.Clear();
+  _impl_.info_capacity_.Clear();
+}
+inline ::client::CmdResponse_InfoCapacity* CmdResponse::mutable_info_capacity(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.info_capacity)
+  return _impl_.info_capacity_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
+CmdResponse::mutable_info_capacity() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.info_capacity)
+  return &_impl_.info_capacity_;
+}
+inline const ::client::CmdResponse_InfoCapacity& CmdResponse::_internal_info_capacity(int index) const {
+  return _impl_.info_capacity_.Get(index);
 }
 inline const ::client::CmdResponse_InfoCapacity& CmdResponse::info_capacity(int index) const {
-  return info_capacity_.Get(index);
+  // @@protoc_insertion_point(field_get:client.CmdResponse.info_capacity)
+  return _internal_info_capacity(index);
 }
-inline ::client::CmdResponse_InfoCapacity* CmdResponse::mutable_info_capacity(int index) {
-  return info_capacity_.Mutable(index);
+inline ::client::CmdResponse_InfoCapacity* CmdResponse::_internal_add_info_capacity() {
+  return _impl_.info_capacity_.Add();
 }
 inline ::client::CmdResponse_InfoCapacity* CmdResponse::add_info_capacity() {
-  return info_capacity_.Add();
+  ::client::CmdResponse_InfoCapacity* _add = _internal_add_info_capacity();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.info_capacity)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
 CmdResponse::info_capacity() const {
-  return info_capacity_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
-CmdResponse::mutable_info_capacity() {
-  return &info_capacity_;
+  // @@protoc_insertion_point(field_list:client.CmdResponse.info_capacity)
+  return _impl_.info_capacity_;
 }
 
 // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+inline int CmdResponse::_internal_info_repl_size() const {
+  return _impl_.info_repl_.size();
+}
 inline int CmdResponse::info_repl_size() const {
-  return info_repl_.size();
+  return _internal_info_repl_size();
 }
 inline void CmdResponse::clear_info_repl() {
-  info_repl_.Clear();
+  _impl_.info_repl_.Clear();
+}
+inline ::client::CmdResponse_InfoRepl* CmdResponse::mutable_info_repl(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.info_repl)
+  return _impl_.info_repl_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
+CmdResponse::mutable_info_repl() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.info_repl)
+  return &_impl_.info_repl_;
+}
+inline const ::client::CmdResponse_InfoRepl& CmdResponse::_internal_info_repl(int index) const {
+  return _impl_.info_repl_.Get(index);
 }
 inline const ::client::CmdResponse_InfoRepl& CmdResponse::info_repl(int index) const {
-  return info_repl_.Get(index);
+  // @@protoc_insertion_point(field_get:client.CmdResponse.info_repl)
+  return _internal_info_repl(index);
 }
-inline ::client::CmdResponse_InfoRepl* CmdResponse::mutable_info_repl(int index) {
-  return info_repl_.Mutable(index);
+inline ::client::CmdResponse_InfoRepl* CmdResponse::_internal_add_info_repl() {
+  return _impl_.info_repl_.Add();
 }
 inline ::client::CmdResponse_InfoRepl* CmdResponse::add_info_repl() {
-  return info_repl_.Add();
+  ::client::CmdResponse_InfoRepl* _add = _internal_add_info_repl();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.info_repl)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
 CmdResponse::info_repl() const {
-  return info_repl_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
-CmdResponse::mutable_info_repl() {
-  return &info_repl_;
+  // @@protoc_insertion_point(field_list:client.CmdResponse.info_repl)
+  return _impl_.info_repl_;
 }
 
 // repeated .client.CmdResponse.Mget mget = 10;
+inline int CmdResponse::_internal_mget_size() const {
+  return _impl_.mget_.size();
+}
 inline int CmdResponse::mget_size() const {
-  return mget_.size();
+  return _internal_mget_size();
 }
 inline void CmdResponse::clear_mget() {
-  mget_.Clear();
+  _impl_.mget_.Clear();
+}
+inline ::client::CmdResponse_Mget* CmdResponse::mutable_mget(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.mget)
+  return _impl_.mget_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Mget >*
+CmdResponse::mutable_mget() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.mget)
+  return &_impl_.mget_;
+}
+inline const ::client::CmdResponse_Mget& CmdResponse::_internal_mget(int index) const {
+  return _impl_.mget_.Get(index);
 }
 inline const ::client::CmdResponse_Mget& CmdResponse::mget(int index) const {
-  return mget_.Get(index);
+  // @@protoc_insertion_point(field_get:client.CmdResponse.mget)
+  return _internal_mget(index);
 }
-inline ::client::CmdResponse_Mget* CmdResponse::mutable_mget(int index) {
-  return mget_.Mutable(index);
+inline ::client::CmdResponse_Mget* CmdResponse::_internal_add_mget() {
+  return _impl_.mget_.Add();
 }
 inline ::client::CmdResponse_Mget* CmdResponse::add_mget() {
-  return mget_.Add();
+  ::client::CmdResponse_Mget* _add = _internal_add_mget();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.mget)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_Mget >&
 CmdResponse::mget() const {
-  return mget_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >*
-CmdResponse::mutable_mget() {
-  return &mget_;
+  // @@protoc_insertion_point(field_list:client.CmdResponse.mget)
+  return _impl_.mget_;
 }
 
 // optional .client.CmdResponse.InfoServer info_server = 11;
-inline bool CmdResponse::has_info_server() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void CmdResponse::set_has_info_server() {
-  _has_bits_[0] |= 0x00000400u;
+inline bool CmdResponse::_internal_has_info_server() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.info_server_ != nullptr);
+  return value;
 }
-inline void CmdResponse::clear_has_info_server() {
-  _has_bits_[0] &= ~0x00000400u;
+inline bool CmdResponse::has_info_server() const {
+  return _internal_has_info_server();
 }
 inline void CmdResponse::clear_info_server() {
-  if (info_server_ != NULL) info_server_->::client::CmdResponse_InfoServer::Clear();
-  clear_has_info_server();
+  if (_impl_.info_server_ != nullptr) _impl_.info_server_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::client::CmdResponse_InfoServer& CmdResponse::_internal_info_server() const {
+  const ::client::CmdResponse_InfoServer* p = _impl_.info_server_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdResponse_InfoServer&>(
+      ::client::_CmdResponse_InfoServer_default_instance_);
 }
 inline const ::client::CmdResponse_InfoServer& CmdResponse::info_server() const {
-  return info_server_ != NULL ? *info_server_ : *default_instance_->info_server_;
+  // @@protoc_insertion_point(field_get:client.CmdResponse.info_server)
+  return _internal_info_server();
 }
-inline ::client::CmdResponse_InfoServer* CmdResponse::mutable_info_server() {
-  set_has_info_server();
-  if (info_server_ == NULL) info_server_ = new ::client::CmdResponse_InfoServer;
-  return info_server_;
+inline void CmdResponse::unsafe_arena_set_allocated_info_server(
+    ::client::CmdResponse_InfoServer* info_server) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.info_server_);
+  }
+  _impl_.info_server_ = info_server;
+  if (info_server) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.info_server)
 }
 inline ::client::CmdResponse_InfoServer* CmdResponse::release_info_server() {
-  clear_has_info_server();
-  ::client::CmdResponse_InfoServer* temp = info_server_;
-  info_server_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::CmdResponse_InfoServer* temp = _impl_.info_server_;
+  _impl_.info_server_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdResponse_InfoServer* CmdResponse::unsafe_arena_release_info_server() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.info_server)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::CmdResponse_InfoServer* temp = _impl_.info_server_;
+  _impl_.info_server_ = nullptr;
   return temp;
 }
+inline ::client::CmdResponse_InfoServer* CmdResponse::_internal_mutable_info_server() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.info_server_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdResponse_InfoServer>(GetArenaForAllocation());
+    _impl_.info_server_ = p;
+  }
+  return _impl_.info_server_;
+}
+inline ::client::CmdResponse_InfoServer* CmdResponse::mutable_info_server() {
+  ::client::CmdResponse_InfoServer* _msg = _internal_mutable_info_server();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.info_server)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_info_server(::client::CmdResponse_InfoServer* info_server) {
-  delete info_server_;
-  info_server_ = info_server;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.info_server_;
+  }
   if (info_server) {
-    set_has_info_server();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(info_server);
+    if (message_arena != submessage_arena) {
+      info_server = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, info_server, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.info_server_ = info_server;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.info_server)
+}
+
+// repeated .client.CmdResponse msync = 12;
+inline int CmdResponse::_internal_msync_size() const {
+  return _impl_.msync_.size();
+}
+inline int CmdResponse::msync_size() const {
+  return _internal_msync_size();
+}
+inline void CmdResponse::clear_msync() {
+  _impl_.msync_.Clear();
+}
+inline ::client::CmdResponse* CmdResponse::mutable_msync(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.msync)
+  return _impl_.msync_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse >*
+CmdResponse::mutable_msync() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.msync)
+  return &_impl_.msync_;
+}
+inline const ::client::CmdResponse& CmdResponse::_internal_msync(int index) const {
+  return _impl_.msync_.Get(index);
+}
+inline const ::client::CmdResponse& CmdResponse::msync(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.msync)
+  return _internal_msync(index);
+}
+inline ::client::CmdResponse* CmdResponse::_internal_add_msync() {
+  return _impl_.msync_.Add();
+}
+inline ::client::CmdResponse* CmdResponse::add_msync() {
+  ::client::CmdResponse* _add = _internal_add_msync();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.msync)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse >&
+CmdResponse::msync() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.msync)
+  return _impl_.msync_;
+}
+
+// optional .client.CmdResponse.Subscribe subscribe = 13;
+inline bool CmdResponse::_internal_has_subscribe() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.subscribe_ != nullptr);
+  return value;
+}
+inline bool CmdResponse::has_subscribe() const {
+  return _internal_has_subscribe();
+}
+inline void CmdResponse::clear_subscribe() {
+  if (_impl_.subscribe_ != nullptr) _impl_.subscribe_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::client::CmdResponse_Subscribe& CmdResponse::_internal_subscribe() const {
+  const ::client::CmdResponse_Subscribe* p = _impl_.subscribe_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdResponse_Subscribe&>(
+      ::client::_CmdResponse_Subscribe_default_instance_);
+}
+inline const ::client::CmdResponse_Subscribe& CmdResponse::subscribe() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.subscribe)
+  return _internal_subscribe();
+}
+inline void CmdResponse::unsafe_arena_set_allocated_subscribe(
+    ::client::CmdResponse_Subscribe* subscribe) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.subscribe_);
+  }
+  _impl_.subscribe_ = subscribe;
+  if (subscribe) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.subscribe)
+}
+inline ::client::CmdResponse_Subscribe* CmdResponse::release_subscribe() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::client::CmdResponse_Subscribe* temp = _impl_.subscribe_;
+  _impl_.subscribe_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdResponse_Subscribe* CmdResponse::unsafe_arena_release_subscribe() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.subscribe)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::client::CmdResponse_Subscribe* temp = _impl_.subscribe_;
+  _impl_.subscribe_ = nullptr;
+  return temp;
+}
+inline ::client::CmdResponse_Subscribe* CmdResponse::_internal_mutable_subscribe() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.subscribe_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdResponse_Subscribe>(GetArenaForAllocation());
+    _impl_.subscribe_ = p;
+  }
+  return _impl_.subscribe_;
+}
+inline ::client::CmdResponse_Subscribe* CmdResponse::mutable_subscribe() {
+  ::client::CmdResponse_Subscribe* _msg = _internal_mutable_subscribe();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.subscribe)
+  return _msg;
+}
+inline void CmdResponse::set_allocated_subscribe(::client::CmdResponse_Subscribe* subscribe) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.subscribe_;
+  }
+  if (subscribe) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(subscribe);
+    if (message_arena != submessage_arena) {
+      subscribe = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, subscribe, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.subscribe_ = subscribe;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.subscribe)
+}
+
+// repeated .client.CmdResponse.KeyResult key_results = 14;
+inline int CmdResponse::_internal_key_results_size() const {
+  return _impl_.key_results_.size();
+}
+inline int CmdResponse::key_results_size() const {
+  return _internal_key_results_size();
+}
+inline void CmdResponse::clear_key_results() {
+  _impl_.key_results_.Clear();
+}
+inline ::client::CmdResponse_KeyResult* CmdResponse::mutable_key_results(int index) {
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.key_results)
+  return _impl_.key_results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_KeyResult >*
+CmdResponse::mutable_key_results() {
+  // @@protoc_insertion_point(field_mutable_list:client.CmdResponse.key_results)
+  return &_impl_.key_results_;
+}
+inline const ::client::CmdResponse_KeyResult& CmdResponse::_internal_key_results(int index) const {
+  return _impl_.key_results_.Get(index);
+}
+inline const ::client::CmdResponse_KeyResult& CmdResponse::key_results(int index) const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.key_results)
+  return _internal_key_results(index);
+}
+inline ::client::CmdResponse_KeyResult* CmdResponse::_internal_add_key_results() {
+  return _impl_.key_results_.Add();
+}
+inline ::client::CmdResponse_KeyResult* CmdResponse::add_key_results() {
+  ::client::CmdResponse_KeyResult* _add = _internal_add_key_results();
+  // @@protoc_insertion_point(field_add:client.CmdResponse.key_results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::client::CmdResponse_KeyResult >&
+CmdResponse::key_results() const {
+  // @@protoc_insertion_point(field_list:client.CmdResponse.key_results)
+  return _impl_.key_results_;
+}
+
+// optional .client.CmdResponse.Incrby incrby = 15;
+inline bool CmdResponse::_internal_has_incrby() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.incrby_ != nullptr);
+  return value;
+}
+inline bool CmdResponse::has_incrby() const {
+  return _internal_has_incrby();
+}
+inline void CmdResponse::clear_incrby() {
+  if (_impl_.incrby_ != nullptr) _impl_.incrby_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::client::CmdResponse_Incrby& CmdResponse::_internal_incrby() const {
+  const ::client::CmdResponse_Incrby* p = _impl_.incrby_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdResponse_Incrby&>(
+      ::client::_CmdResponse_Incrby_default_instance_);
+}
+inline const ::client::CmdResponse_Incrby& CmdResponse::incrby() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.incrby)
+  return _internal_incrby();
+}
+inline void CmdResponse::unsafe_arena_set_allocated_incrby(
+    ::client::CmdResponse_Incrby* incrby) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.incrby_);
+  }
+  _impl_.incrby_ = incrby;
+  if (incrby) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.incrby)
+}
+inline ::client::CmdResponse_Incrby* CmdResponse::release_incrby() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::client::CmdResponse_Incrby* temp = _impl_.incrby_;
+  _impl_.incrby_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdResponse_Incrby* CmdResponse::unsafe_arena_release_incrby() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.incrby)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::client::CmdResponse_Incrby* temp = _impl_.incrby_;
+  _impl_.incrby_ = nullptr;
+  return temp;
+}
+inline ::client::CmdResponse_Incrby* CmdResponse::_internal_mutable_incrby() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.incrby_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdResponse_Incrby>(GetArenaForAllocation());
+    _impl_.incrby_ = p;
+  }
+  return _impl_.incrby_;
+}
+inline ::client::CmdResponse_Incrby* CmdResponse::mutable_incrby() {
+  ::client::CmdResponse_Incrby* _msg = _internal_mutable_incrby();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.incrby)
+  return _msg;
+}
+inline void CmdResponse::set_allocated_incrby(::client::CmdResponse_Incrby* incrby) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.incrby_;
+  }
+  if (incrby) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(incrby);
+    if (message_arena != submessage_arena) {
+      incrby = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, incrby, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.incrby_ = incrby;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.incrby)
+}
+
+// optional .client.CmdResponse.Append append = 16;
+inline bool CmdResponse::_internal_has_append() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.append_ != nullptr);
+  return value;
+}
+inline bool CmdResponse::has_append() const {
+  return _internal_has_append();
+}
+inline void CmdResponse::clear_append() {
+  if (_impl_.append_ != nullptr) _impl_.append_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::client::CmdResponse_Append& CmdResponse::_internal_append() const {
+  const ::client::CmdResponse_Append* p = _impl_.append_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdResponse_Append&>(
+      ::client::_CmdResponse_Append_default_instance_);
+}
+inline const ::client::CmdResponse_Append& CmdResponse::append() const {
+  // @@protoc_insertion_point(field_get:client.CmdResponse.append)
+  return _internal_append();
+}
+inline void CmdResponse::unsafe_arena_set_allocated_append(
+    ::client::CmdResponse_Append* append) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.append_);
+  }
+  _impl_.append_ = append;
+  if (append) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.CmdResponse.append)
+}
+inline ::client::CmdResponse_Append* CmdResponse::release_append() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::client::CmdResponse_Append* temp = _impl_.append_;
+  _impl_.append_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdResponse_Append* CmdResponse::unsafe_arena_release_append() {
+  // @@protoc_insertion_point(field_release:client.CmdResponse.append)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::client::CmdResponse_Append* temp = _impl_.append_;
+  _impl_.append_ = nullptr;
+  return temp;
+}
+inline ::client::CmdResponse_Append* CmdResponse::_internal_mutable_append() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.append_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdResponse_Append>(GetArenaForAllocation());
+    _impl_.append_ = p;
+  }
+  return _impl_.append_;
+}
+inline ::client::CmdResponse_Append* CmdResponse::mutable_append() {
+  ::client::CmdResponse_Append* _msg = _internal_mutable_append();
+  // @@protoc_insertion_point(field_mutable:client.CmdResponse.append)
+  return _msg;
+}
+inline void CmdResponse::set_allocated_append(::client::CmdResponse_Append* append) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.append_;
+  }
+  if (append) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append);
+    if (message_arena != submessage_arena) {
+      append = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, append, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_info_server();
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.append_ = append;
+  // @@protoc_insertion_point(field_set_allocated:client.CmdResponse.append)
 }
 
 // -------------------------------------------------------------------
@@ -5624,117 +16707,455 @@ inline void CmdResponse::set_allocated_info_server(::client::CmdResponse_InfoSer
 // BinlogSkip
 
 // required string table_name = 1;
+inline bool BinlogSkip::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool BinlogSkip::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_table_name();
+}
+inline void BinlogSkip::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BinlogSkip::table_name() const {
+  // @@protoc_insertion_point(field_get:client.BinlogSkip.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BinlogSkip::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.BinlogSkip.table_name)
+}
+inline std::string* BinlogSkip::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.BinlogSkip.table_name)
+  return _s;
+}
+inline const std::string& BinlogSkip::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void BinlogSkip::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BinlogSkip::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BinlogSkip::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.BinlogSkip.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BinlogSkip::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.BinlogSkip.table_name)
+}
+
+// required int32 partition_id = 2;
+inline bool BinlogSkip::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool BinlogSkip::has_partition_id() const {
+  return _internal_has_partition_id();
+}
+inline void BinlogSkip::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t BinlogSkip::_internal_partition_id() const {
+  return _impl_.partition_id_;
+}
+inline int32_t BinlogSkip::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.BinlogSkip.partition_id)
+  return _internal_partition_id();
+}
+inline void BinlogSkip::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.partition_id_ = value;
+}
+inline void BinlogSkip::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.BinlogSkip.partition_id)
+}
+
+// required int64 gap = 3;
+inline bool BinlogSkip::_internal_has_gap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BinlogSkip::has_gap() const {
+  return _internal_has_gap();
+}
+inline void BinlogSkip::clear_gap() {
+  _impl_.gap_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t BinlogSkip::_internal_gap() const {
+  return _impl_.gap_;
+}
+inline int64_t BinlogSkip::gap() const {
+  // @@protoc_insertion_point(field_get:client.BinlogSkip.gap)
+  return _internal_gap();
+}
+inline void BinlogSkip::_internal_set_gap(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.gap_ = value;
+}
+inline void BinlogSkip::set_gap(int64_t value) {
+  _internal_set_gap(value);
+  // @@protoc_insertion_point(field_set:client.BinlogSkip.gap)
+}
+
+// -------------------------------------------------------------------
+
+// BinlogAck
+
+// required string table_name = 1;
+inline bool BinlogAck::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BinlogAck::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void BinlogAck::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BinlogAck::table_name() const {
+  // @@protoc_insertion_point(field_get:client.BinlogAck.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BinlogAck::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.BinlogAck.table_name)
+}
+inline std::string* BinlogAck::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.BinlogAck.table_name)
+  return _s;
+}
+inline const std::string& BinlogAck::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void BinlogAck::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BinlogAck::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BinlogAck::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.BinlogAck.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BinlogAck::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.BinlogAck.table_name)
+}
+
+// required int32 partition_id = 2;
+inline bool BinlogAck::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void BinlogSkip::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool BinlogAck::has_partition_id() const {
+  return _internal_has_partition_id();
 }
-inline void BinlogSkip::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void BinlogAck::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void BinlogSkip::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline int32_t BinlogAck::_internal_partition_id() const {
+  return _impl_.partition_id_;
 }
-inline const ::std::string& BinlogSkip::table_name() const {
-  return *table_name_;
+inline int32_t BinlogAck::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.BinlogAck.partition_id)
+  return _internal_partition_id();
 }
-inline void BinlogSkip::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void BinlogAck::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_id_ = value;
 }
-inline void BinlogSkip::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void BinlogAck::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.BinlogAck.partition_id)
 }
-inline void BinlogSkip::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+
+// required int32 credits = 3;
+inline bool BinlogAck::_internal_has_credits() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline ::std::string* BinlogSkip::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline bool BinlogAck::has_credits() const {
+  return _internal_has_credits();
 }
-inline ::std::string* BinlogSkip::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void BinlogAck::clear_credits() {
+  _impl_.credits_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void BinlogSkip::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+inline int32_t BinlogAck::_internal_credits() const {
+  return _impl_.credits_;
+}
+inline int32_t BinlogAck::credits() const {
+  // @@protoc_insertion_point(field_get:client.BinlogAck.credits)
+  return _internal_credits();
+}
+inline void BinlogAck::_internal_set_credits(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.credits_ = value;
+}
+inline void BinlogAck::set_credits(int32_t value) {
+  _internal_set_credits(value);
+  // @@protoc_insertion_point(field_set:client.BinlogAck.credits)
+}
+
+// -------------------------------------------------------------------
+
+// BinlogResync
+
+// required string table_name = 1;
+inline bool BinlogResync::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BinlogResync::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void BinlogResync::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BinlogResync::table_name() const {
+  // @@protoc_insertion_point(field_get:client.BinlogResync.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BinlogResync::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.BinlogResync.table_name)
+}
+inline std::string* BinlogResync::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.BinlogResync.table_name)
+  return _s;
+}
+inline const std::string& BinlogResync::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void BinlogResync::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BinlogResync::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BinlogResync::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.BinlogResync.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BinlogResync::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.BinlogResync.table_name)
 }
 
 // required int32 partition_id = 2;
-inline bool BinlogSkip::has_partition_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool BinlogResync::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void BinlogSkip::set_has_partition_id() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool BinlogResync::has_partition_id() const {
+  return _internal_has_partition_id();
 }
-inline void BinlogSkip::clear_has_partition_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void BinlogResync::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void BinlogSkip::clear_partition_id() {
-  partition_id_ = 0;
-  clear_has_partition_id();
+inline int32_t BinlogResync::_internal_partition_id() const {
+  return _impl_.partition_id_;
+}
+inline int32_t BinlogResync::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.BinlogResync.partition_id)
+  return _internal_partition_id();
 }
-inline ::google::protobuf::int32 BinlogSkip::partition_id() const {
-  return partition_id_;
+inline void BinlogResync::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_id_ = value;
 }
-inline void BinlogSkip::set_partition_id(::google::protobuf::int32 value) {
-  set_has_partition_id();
-  partition_id_ = value;
+inline void BinlogResync::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.BinlogResync.partition_id)
 }
 
-// required int64 gap = 3;
-inline bool BinlogSkip::has_gap() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// BinlogHeartbeat
+
+// required string table_name = 1;
+inline bool BinlogHeartbeat::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BinlogHeartbeat::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void BinlogHeartbeat::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BinlogHeartbeat::table_name() const {
+  // @@protoc_insertion_point(field_get:client.BinlogHeartbeat.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BinlogHeartbeat::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:client.BinlogHeartbeat.table_name)
+}
+inline std::string* BinlogHeartbeat::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:client.BinlogHeartbeat.table_name)
+  return _s;
+}
+inline const std::string& BinlogHeartbeat::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void BinlogHeartbeat::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BinlogHeartbeat::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BinlogHeartbeat::release_table_name() {
+  // @@protoc_insertion_point(field_release:client.BinlogHeartbeat.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BinlogHeartbeat::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:client.BinlogHeartbeat.table_name)
 }
-inline void BinlogSkip::set_has_gap() {
-  _has_bits_[0] |= 0x00000004u;
+
+// required int32 partition_id = 2;
+inline bool BinlogHeartbeat::_internal_has_partition_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void BinlogSkip::clear_has_gap() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool BinlogHeartbeat::has_partition_id() const {
+  return _internal_has_partition_id();
 }
-inline void BinlogSkip::clear_gap() {
-  gap_ = GOOGLE_LONGLONG(0);
-  clear_has_gap();
+inline void BinlogHeartbeat::clear_partition_id() {
+  _impl_.partition_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int64 BinlogSkip::gap() const {
-  return gap_;
+inline int32_t BinlogHeartbeat::_internal_partition_id() const {
+  return _impl_.partition_id_;
 }
-inline void BinlogSkip::set_gap(::google::protobuf::int64 value) {
-  set_has_gap();
-  gap_ = value;
+inline int32_t BinlogHeartbeat::partition_id() const {
+  // @@protoc_insertion_point(field_get:client.BinlogHeartbeat.partition_id)
+  return _internal_partition_id();
+}
+inline void BinlogHeartbeat::_internal_set_partition_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.partition_id_ = value;
+}
+inline void BinlogHeartbeat::set_partition_id(int32_t value) {
+  _internal_set_partition_id(value);
+  // @@protoc_insertion_point(field_set:client.BinlogHeartbeat.partition_id)
 }
 
 // -------------------------------------------------------------------
@@ -5742,228 +17163,915 @@ inline void BinlogSkip::set_gap(::google::protobuf::int64 value) {
 // SyncRequest
 
 // required .client.SyncType sync_type = 1;
-inline bool SyncRequest::has_sync_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SyncRequest::set_has_sync_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool SyncRequest::_internal_has_sync_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void SyncRequest::clear_has_sync_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SyncRequest::has_sync_type() const {
+  return _internal_has_sync_type();
 }
 inline void SyncRequest::clear_sync_type() {
-  sync_type_ = 0;
-  clear_has_sync_type();
+  _impl_.sync_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::client::SyncType SyncRequest::_internal_sync_type() const {
+  return static_cast< ::client::SyncType >(_impl_.sync_type_);
 }
 inline ::client::SyncType SyncRequest::sync_type() const {
-  return static_cast< ::client::SyncType >(sync_type_);
+  // @@protoc_insertion_point(field_get:client.SyncRequest.sync_type)
+  return _internal_sync_type();
 }
-inline void SyncRequest::set_sync_type(::client::SyncType value) {
+inline void SyncRequest::_internal_set_sync_type(::client::SyncType value) {
   assert(::client::SyncType_IsValid(value));
-  set_has_sync_type();
-  sync_type_ = value;
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.sync_type_ = value;
+}
+inline void SyncRequest::set_sync_type(::client::SyncType value) {
+  _internal_set_sync_type(value);
+  // @@protoc_insertion_point(field_set:client.SyncRequest.sync_type)
 }
 
 // required int64 epoch = 2;
+inline bool SyncRequest::_internal_has_epoch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
 inline bool SyncRequest::has_epoch() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_epoch();
 }
-inline void SyncRequest::set_has_epoch() {
-  _has_bits_[0] |= 0x00000002u;
+inline void SyncRequest::clear_epoch() {
+  _impl_.epoch_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void SyncRequest::clear_has_epoch() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int64_t SyncRequest::_internal_epoch() const {
+  return _impl_.epoch_;
 }
-inline void SyncRequest::clear_epoch() {
-  epoch_ = GOOGLE_LONGLONG(0);
-  clear_has_epoch();
+inline int64_t SyncRequest::epoch() const {
+  // @@protoc_insertion_point(field_get:client.SyncRequest.epoch)
+  return _internal_epoch();
 }
-inline ::google::protobuf::int64 SyncRequest::epoch() const {
-  return epoch_;
+inline void SyncRequest::_internal_set_epoch(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.epoch_ = value;
 }
-inline void SyncRequest::set_epoch(::google::protobuf::int64 value) {
-  set_has_epoch();
-  epoch_ = value;
+inline void SyncRequest::set_epoch(int64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:client.SyncRequest.epoch)
 }
 
 // required .client.Node from = 3;
-inline bool SyncRequest::has_from() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void SyncRequest::set_has_from() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool SyncRequest::_internal_has_from() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.from_ != nullptr);
+  return value;
 }
-inline void SyncRequest::clear_has_from() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool SyncRequest::has_from() const {
+  return _internal_has_from();
 }
 inline void SyncRequest::clear_from() {
-  if (from_ != NULL) from_->::client::Node::Clear();
-  clear_has_from();
+  if (_impl_.from_ != nullptr) _impl_.from_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::client::Node& SyncRequest::_internal_from() const {
+  const ::client::Node* p = _impl_.from_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::Node&>(
+      ::client::_Node_default_instance_);
 }
 inline const ::client::Node& SyncRequest::from() const {
-  return from_ != NULL ? *from_ : *default_instance_->from_;
+  // @@protoc_insertion_point(field_get:client.SyncRequest.from)
+  return _internal_from();
 }
-inline ::client::Node* SyncRequest::mutable_from() {
-  set_has_from();
-  if (from_ == NULL) from_ = new ::client::Node;
-  return from_;
+inline void SyncRequest::unsafe_arena_set_allocated_from(
+    ::client::Node* from) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.from_);
+  }
+  _impl_.from_ = from;
+  if (from) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.from)
 }
 inline ::client::Node* SyncRequest::release_from() {
-  clear_has_from();
-  ::client::Node* temp = from_;
-  from_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::Node* temp = _impl_.from_;
+  _impl_.from_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::Node* SyncRequest::unsafe_arena_release_from() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.from)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::client::Node* temp = _impl_.from_;
+  _impl_.from_ = nullptr;
   return temp;
 }
+inline ::client::Node* SyncRequest::_internal_mutable_from() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.from_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::Node>(GetArenaForAllocation());
+    _impl_.from_ = p;
+  }
+  return _impl_.from_;
+}
+inline ::client::Node* SyncRequest::mutable_from() {
+  ::client::Node* _msg = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.from)
+  return _msg;
+}
 inline void SyncRequest::set_allocated_from(::client::Node* from) {
-  delete from_;
-  from_ = from;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.from_;
+  }
   if (from) {
-    set_has_from();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(from);
+    if (message_arena != submessage_arena) {
+      from = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, from, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_from();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.from_ = from;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.from)
 }
 
 // required .client.SyncOffset sync_offset = 4;
-inline bool SyncRequest::has_sync_offset() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void SyncRequest::set_has_sync_offset() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool SyncRequest::_internal_has_sync_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sync_offset_ != nullptr);
+  return value;
 }
-inline void SyncRequest::clear_has_sync_offset() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool SyncRequest::has_sync_offset() const {
+  return _internal_has_sync_offset();
 }
 inline void SyncRequest::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
+  if (_impl_.sync_offset_ != nullptr) _impl_.sync_offset_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::client::SyncOffset& SyncRequest::_internal_sync_offset() const {
+  const ::client::SyncOffset* p = _impl_.sync_offset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
 }
 inline const ::client::SyncOffset& SyncRequest::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+  // @@protoc_insertion_point(field_get:client.SyncRequest.sync_offset)
+  return _internal_sync_offset();
 }
-inline ::client::SyncOffset* SyncRequest::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
+inline void SyncRequest::unsafe_arena_set_allocated_sync_offset(
+    ::client::SyncOffset* sync_offset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sync_offset_);
+  }
+  _impl_.sync_offset_ = sync_offset;
+  if (sync_offset) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.sync_offset)
 }
 inline ::client::SyncOffset* SyncRequest::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::SyncOffset* SyncRequest::unsafe_arena_release_sync_offset() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.sync_offset)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::client::SyncOffset* temp = _impl_.sync_offset_;
+  _impl_.sync_offset_ = nullptr;
   return temp;
 }
+inline ::client::SyncOffset* SyncRequest::_internal_mutable_sync_offset() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.sync_offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.sync_offset_ = p;
+  }
+  return _impl_.sync_offset_;
+}
+inline ::client::SyncOffset* SyncRequest::mutable_sync_offset() {
+  ::client::SyncOffset* _msg = _internal_mutable_sync_offset();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.sync_offset)
+  return _msg;
+}
 inline void SyncRequest::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sync_offset_;
+  }
   if (sync_offset) {
-    set_has_sync_offset();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sync_offset);
+    if (message_arena != submessage_arena) {
+      sync_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sync_offset, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_sync_offset();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.sync_offset_ = sync_offset;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.sync_offset)
 }
 
 // optional .client.CmdRequest request = 5;
-inline bool SyncRequest::has_request() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void SyncRequest::set_has_request() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool SyncRequest::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
 }
-inline void SyncRequest::clear_has_request() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool SyncRequest::has_request() const {
+  return _internal_has_request();
 }
 inline void SyncRequest::clear_request() {
-  if (request_ != NULL) request_->::client::CmdRequest::Clear();
-  clear_has_request();
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::client::CmdRequest& SyncRequest::_internal_request() const {
+  const ::client::CmdRequest* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::CmdRequest&>(
+      ::client::_CmdRequest_default_instance_);
 }
 inline const ::client::CmdRequest& SyncRequest::request() const {
-  return request_ != NULL ? *request_ : *default_instance_->request_;
+  // @@protoc_insertion_point(field_get:client.SyncRequest.request)
+  return _internal_request();
 }
-inline ::client::CmdRequest* SyncRequest::mutable_request() {
-  set_has_request();
-  if (request_ == NULL) request_ = new ::client::CmdRequest;
-  return request_;
+inline void SyncRequest::unsafe_arena_set_allocated_request(
+    ::client::CmdRequest* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.request)
 }
 inline ::client::CmdRequest* SyncRequest::release_request() {
-  clear_has_request();
-  ::client::CmdRequest* temp = request_;
-  request_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::CmdRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::CmdRequest* SyncRequest::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.request)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::client::CmdRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
   return temp;
 }
+inline ::client::CmdRequest* SyncRequest::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::CmdRequest>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::client::CmdRequest* SyncRequest::mutable_request() {
+  ::client::CmdRequest* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.request)
+  return _msg;
+}
 inline void SyncRequest::set_allocated_request(::client::CmdRequest* request) {
-  delete request_;
-  request_ = request;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
   if (request) {
-    set_has_request();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_request();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.request)
 }
 
 // optional .client.BinlogSkip binlog_skip = 6;
-inline bool SyncRequest::has_binlog_skip() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void SyncRequest::set_has_binlog_skip() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool SyncRequest::_internal_has_binlog_skip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.binlog_skip_ != nullptr);
+  return value;
 }
-inline void SyncRequest::clear_has_binlog_skip() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool SyncRequest::has_binlog_skip() const {
+  return _internal_has_binlog_skip();
 }
 inline void SyncRequest::clear_binlog_skip() {
-  if (binlog_skip_ != NULL) binlog_skip_->::client::BinlogSkip::Clear();
-  clear_has_binlog_skip();
+  if (_impl_.binlog_skip_ != nullptr) _impl_.binlog_skip_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::client::BinlogSkip& SyncRequest::_internal_binlog_skip() const {
+  const ::client::BinlogSkip* p = _impl_.binlog_skip_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::BinlogSkip&>(
+      ::client::_BinlogSkip_default_instance_);
 }
 inline const ::client::BinlogSkip& SyncRequest::binlog_skip() const {
-  return binlog_skip_ != NULL ? *binlog_skip_ : *default_instance_->binlog_skip_;
+  // @@protoc_insertion_point(field_get:client.SyncRequest.binlog_skip)
+  return _internal_binlog_skip();
 }
-inline ::client::BinlogSkip* SyncRequest::mutable_binlog_skip() {
-  set_has_binlog_skip();
-  if (binlog_skip_ == NULL) binlog_skip_ = new ::client::BinlogSkip;
-  return binlog_skip_;
+inline void SyncRequest::unsafe_arena_set_allocated_binlog_skip(
+    ::client::BinlogSkip* binlog_skip) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.binlog_skip_);
+  }
+  _impl_.binlog_skip_ = binlog_skip;
+  if (binlog_skip) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.binlog_skip)
 }
 inline ::client::BinlogSkip* SyncRequest::release_binlog_skip() {
-  clear_has_binlog_skip();
-  ::client::BinlogSkip* temp = binlog_skip_;
-  binlog_skip_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::BinlogSkip* temp = _impl_.binlog_skip_;
+  _impl_.binlog_skip_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::BinlogSkip* SyncRequest::unsafe_arena_release_binlog_skip() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.binlog_skip)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::client::BinlogSkip* temp = _impl_.binlog_skip_;
+  _impl_.binlog_skip_ = nullptr;
   return temp;
 }
+inline ::client::BinlogSkip* SyncRequest::_internal_mutable_binlog_skip() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.binlog_skip_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::BinlogSkip>(GetArenaForAllocation());
+    _impl_.binlog_skip_ = p;
+  }
+  return _impl_.binlog_skip_;
+}
+inline ::client::BinlogSkip* SyncRequest::mutable_binlog_skip() {
+  ::client::BinlogSkip* _msg = _internal_mutable_binlog_skip();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.binlog_skip)
+  return _msg;
+}
 inline void SyncRequest::set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip) {
-  delete binlog_skip_;
-  binlog_skip_ = binlog_skip;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.binlog_skip_;
+  }
   if (binlog_skip) {
-    set_has_binlog_skip();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(binlog_skip);
+    if (message_arena != submessage_arena) {
+      binlog_skip = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, binlog_skip, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.binlog_skip_ = binlog_skip;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.binlog_skip)
+}
+
+// optional .client.BinlogAck binlog_ack = 7;
+inline bool SyncRequest::_internal_has_binlog_ack() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.binlog_ack_ != nullptr);
+  return value;
+}
+inline bool SyncRequest::has_binlog_ack() const {
+  return _internal_has_binlog_ack();
+}
+inline void SyncRequest::clear_binlog_ack() {
+  if (_impl_.binlog_ack_ != nullptr) _impl_.binlog_ack_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::client::BinlogAck& SyncRequest::_internal_binlog_ack() const {
+  const ::client::BinlogAck* p = _impl_.binlog_ack_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::BinlogAck&>(
+      ::client::_BinlogAck_default_instance_);
+}
+inline const ::client::BinlogAck& SyncRequest::binlog_ack() const {
+  // @@protoc_insertion_point(field_get:client.SyncRequest.binlog_ack)
+  return _internal_binlog_ack();
+}
+inline void SyncRequest::unsafe_arena_set_allocated_binlog_ack(
+    ::client::BinlogAck* binlog_ack) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.binlog_ack_);
+  }
+  _impl_.binlog_ack_ = binlog_ack;
+  if (binlog_ack) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.binlog_ack)
+}
+inline ::client::BinlogAck* SyncRequest::release_binlog_ack() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::BinlogAck* temp = _impl_.binlog_ack_;
+  _impl_.binlog_ack_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::BinlogAck* SyncRequest::unsafe_arena_release_binlog_ack() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.binlog_ack)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::client::BinlogAck* temp = _impl_.binlog_ack_;
+  _impl_.binlog_ack_ = nullptr;
+  return temp;
+}
+inline ::client::BinlogAck* SyncRequest::_internal_mutable_binlog_ack() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.binlog_ack_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::BinlogAck>(GetArenaForAllocation());
+    _impl_.binlog_ack_ = p;
+  }
+  return _impl_.binlog_ack_;
+}
+inline ::client::BinlogAck* SyncRequest::mutable_binlog_ack() {
+  ::client::BinlogAck* _msg = _internal_mutable_binlog_ack();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.binlog_ack)
+  return _msg;
+}
+inline void SyncRequest::set_allocated_binlog_ack(::client::BinlogAck* binlog_ack) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.binlog_ack_;
+  }
+  if (binlog_ack) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(binlog_ack);
+    if (message_arena != submessage_arena) {
+      binlog_ack = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, binlog_ack, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.binlog_ack_ = binlog_ack;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.binlog_ack)
+}
+
+// optional .client.SyncOffset head = 8;
+inline bool SyncRequest::_internal_has_head() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.head_ != nullptr);
+  return value;
+}
+inline bool SyncRequest::has_head() const {
+  return _internal_has_head();
+}
+inline void SyncRequest::clear_head() {
+  if (_impl_.head_ != nullptr) _impl_.head_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::client::SyncOffset& SyncRequest::_internal_head() const {
+  const ::client::SyncOffset* p = _impl_.head_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::SyncOffset&>(
+      ::client::_SyncOffset_default_instance_);
+}
+inline const ::client::SyncOffset& SyncRequest::head() const {
+  // @@protoc_insertion_point(field_get:client.SyncRequest.head)
+  return _internal_head();
+}
+inline void SyncRequest::unsafe_arena_set_allocated_head(
+    ::client::SyncOffset* head) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.head_);
+  }
+  _impl_.head_ = head;
+  if (head) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.head)
+}
+inline ::client::SyncOffset* SyncRequest::release_head() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::client::SyncOffset* temp = _impl_.head_;
+  _impl_.head_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::SyncOffset* SyncRequest::unsafe_arena_release_head() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.head)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::client::SyncOffset* temp = _impl_.head_;
+  _impl_.head_ = nullptr;
+  return temp;
+}
+inline ::client::SyncOffset* SyncRequest::_internal_mutable_head() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.head_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::SyncOffset>(GetArenaForAllocation());
+    _impl_.head_ = p;
+  }
+  return _impl_.head_;
+}
+inline ::client::SyncOffset* SyncRequest::mutable_head() {
+  ::client::SyncOffset* _msg = _internal_mutable_head();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.head)
+  return _msg;
+}
+inline void SyncRequest::set_allocated_head(::client::SyncOffset* head) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.head_;
+  }
+  if (head) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(head);
+    if (message_arena != submessage_arena) {
+      head = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, head, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.head_ = head;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.head)
+}
+
+// optional int32 item_len = 9;
+inline bool SyncRequest::_internal_has_item_len() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SyncRequest::has_item_len() const {
+  return _internal_has_item_len();
+}
+inline void SyncRequest::clear_item_len() {
+  _impl_.item_len_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t SyncRequest::_internal_item_len() const {
+  return _impl_.item_len_;
+}
+inline int32_t SyncRequest::item_len() const {
+  // @@protoc_insertion_point(field_get:client.SyncRequest.item_len)
+  return _internal_item_len();
+}
+inline void SyncRequest::_internal_set_item_len(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.item_len_ = value;
+}
+inline void SyncRequest::set_item_len(int32_t value) {
+  _internal_set_item_len(value);
+  // @@protoc_insertion_point(field_set:client.SyncRequest.item_len)
+}
+
+// optional .client.BinlogResync binlog_resync = 10;
+inline bool SyncRequest::_internal_has_binlog_resync() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.binlog_resync_ != nullptr);
+  return value;
+}
+inline bool SyncRequest::has_binlog_resync() const {
+  return _internal_has_binlog_resync();
+}
+inline void SyncRequest::clear_binlog_resync() {
+  if (_impl_.binlog_resync_ != nullptr) _impl_.binlog_resync_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::client::BinlogResync& SyncRequest::_internal_binlog_resync() const {
+  const ::client::BinlogResync* p = _impl_.binlog_resync_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::BinlogResync&>(
+      ::client::_BinlogResync_default_instance_);
+}
+inline const ::client::BinlogResync& SyncRequest::binlog_resync() const {
+  // @@protoc_insertion_point(field_get:client.SyncRequest.binlog_resync)
+  return _internal_binlog_resync();
+}
+inline void SyncRequest::unsafe_arena_set_allocated_binlog_resync(
+    ::client::BinlogResync* binlog_resync) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.binlog_resync_);
+  }
+  _impl_.binlog_resync_ = binlog_resync;
+  if (binlog_resync) {
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    clear_has_binlog_skip();
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.binlog_resync)
+}
+inline ::client::BinlogResync* SyncRequest::release_binlog_resync() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::client::BinlogResync* temp = _impl_.binlog_resync_;
+  _impl_.binlog_resync_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::BinlogResync* SyncRequest::unsafe_arena_release_binlog_resync() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.binlog_resync)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::client::BinlogResync* temp = _impl_.binlog_resync_;
+  _impl_.binlog_resync_ = nullptr;
+  return temp;
+}
+inline ::client::BinlogResync* SyncRequest::_internal_mutable_binlog_resync() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.binlog_resync_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::BinlogResync>(GetArenaForAllocation());
+    _impl_.binlog_resync_ = p;
+  }
+  return _impl_.binlog_resync_;
+}
+inline ::client::BinlogResync* SyncRequest::mutable_binlog_resync() {
+  ::client::BinlogResync* _msg = _internal_mutable_binlog_resync();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.binlog_resync)
+  return _msg;
+}
+inline void SyncRequest::set_allocated_binlog_resync(::client::BinlogResync* binlog_resync) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.binlog_resync_;
+  }
+  if (binlog_resync) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(binlog_resync);
+    if (message_arena != submessage_arena) {
+      binlog_resync = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, binlog_resync, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.binlog_resync_ = binlog_resync;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.binlog_resync)
+}
+
+// optional .client.BinlogHeartbeat binlog_heartbeat = 11;
+inline bool SyncRequest::_internal_has_binlog_heartbeat() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.binlog_heartbeat_ != nullptr);
+  return value;
+}
+inline bool SyncRequest::has_binlog_heartbeat() const {
+  return _internal_has_binlog_heartbeat();
+}
+inline void SyncRequest::clear_binlog_heartbeat() {
+  if (_impl_.binlog_heartbeat_ != nullptr) _impl_.binlog_heartbeat_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::client::BinlogHeartbeat& SyncRequest::_internal_binlog_heartbeat() const {
+  const ::client::BinlogHeartbeat* p = _impl_.binlog_heartbeat_;
+  return p != nullptr ? *p : reinterpret_cast<const ::client::BinlogHeartbeat&>(
+      ::client::_BinlogHeartbeat_default_instance_);
+}
+inline const ::client::BinlogHeartbeat& SyncRequest::binlog_heartbeat() const {
+  // @@protoc_insertion_point(field_get:client.SyncRequest.binlog_heartbeat)
+  return _internal_binlog_heartbeat();
+}
+inline void SyncRequest::unsafe_arena_set_allocated_binlog_heartbeat(
+    ::client::BinlogHeartbeat* binlog_heartbeat) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.binlog_heartbeat_);
+  }
+  _impl_.binlog_heartbeat_ = binlog_heartbeat;
+  if (binlog_heartbeat) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:client.SyncRequest.binlog_heartbeat)
+}
+inline ::client::BinlogHeartbeat* SyncRequest::release_binlog_heartbeat() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::client::BinlogHeartbeat* temp = _impl_.binlog_heartbeat_;
+  _impl_.binlog_heartbeat_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::client::BinlogHeartbeat* SyncRequest::unsafe_arena_release_binlog_heartbeat() {
+  // @@protoc_insertion_point(field_release:client.SyncRequest.binlog_heartbeat)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::client::BinlogHeartbeat* temp = _impl_.binlog_heartbeat_;
+  _impl_.binlog_heartbeat_ = nullptr;
+  return temp;
+}
+inline ::client::BinlogHeartbeat* SyncRequest::_internal_mutable_binlog_heartbeat() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.binlog_heartbeat_ == nullptr) {
+    auto* p = CreateMaybeMessage<::client::BinlogHeartbeat>(GetArenaForAllocation());
+    _impl_.binlog_heartbeat_ = p;
+  }
+  return _impl_.binlog_heartbeat_;
+}
+inline ::client::BinlogHeartbeat* SyncRequest::mutable_binlog_heartbeat() {
+  ::client::BinlogHeartbeat* _msg = _internal_mutable_binlog_heartbeat();
+  // @@protoc_insertion_point(field_mutable:client.SyncRequest.binlog_heartbeat)
+  return _msg;
+}
+inline void SyncRequest::set_allocated_binlog_heartbeat(::client::BinlogHeartbeat* binlog_heartbeat) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.binlog_heartbeat_;
+  }
+  if (binlog_heartbeat) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(binlog_heartbeat);
+    if (message_arena != submessage_arena) {
+      binlog_heartbeat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, binlog_heartbeat, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.binlog_heartbeat_ = binlog_heartbeat;
+  // @@protoc_insertion_point(field_set_allocated:client.SyncRequest.binlog_heartbeat)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace client
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::client::Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::client::Type>() {
   return ::client::Type_descriptor();
 }
+template <> struct is_proto_enum< ::client::SyncType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::client::SyncType>() {
   return ::client::SyncType_descriptor();
 }
+template <> struct is_proto_enum< ::client::StatusCode> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::client::StatusCode>() {
   return ::client::StatusCode_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_client_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_client_2eproto
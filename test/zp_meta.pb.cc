@@ -1,719 +1,811 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: zp_meta.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "zp_meta.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace ZPMeta {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Node_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Node_reflection_ = NULL;
-const ::google::protobuf::Descriptor* NodeStatus_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  NodeStatus_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Nodes_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Nodes_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaNodes_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaNodes_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Partitions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Partitions_reflection_ = NULL;
-const ::google::protobuf::Descriptor* TableName_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  TableName_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Table_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Table_reflection_ = NULL;
-const ::google::protobuf::Descriptor* BasicCmdUnit_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  BasicCmdUnit_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SyncOffset_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SyncOffset_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_Ping_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_Ping_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_Pull_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_Pull_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_Init_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_Init_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_SetMaster_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_SetMaster_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_AddSlave_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_AddSlave_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_RemoveSlave_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_RemoveSlave_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmd_DropTable_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmd_DropTable_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmdResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmdResponse_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmdResponse_Ping_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmdResponse_Ping_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmdResponse_Pull_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmdResponse_Pull_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmdResponse_ListTable_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmdResponse_ListTable_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmdResponse_ListNode_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmdResponse_ListNode_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MetaCmdResponse_ListMeta_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MetaCmdResponse_ListMeta_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* Type_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* PState_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_zp_5fmeta_2eproto() {
-  protobuf_AddDesc_zp_5fmeta_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "zp_meta.proto");
-  GOOGLE_CHECK(file != NULL);
-  Node_descriptor_ = file->message_type(0);
-  static const int Node_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, port_),
+namespace ZPMeta {
+PROTOBUF_CONSTEXPR Node::Node(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.port_)*/0} {}
+struct NodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeDefaultTypeInternal() {}
+  union {
+    Node _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeDefaultTypeInternal _Node_default_instance_;
+PROTOBUF_CONSTEXPR NodeStatus::NodeStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.node_)*/nullptr
+  , /*decltype(_impl_.status_)*/0} {}
+struct NodeStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeStatusDefaultTypeInternal() {}
+  union {
+    NodeStatus _instance;
   };
-  Node_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Node_descriptor_,
-      Node::default_instance_,
-      Node_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Node, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Node));
-  NodeStatus_descriptor_ = file->message_type(1);
-  static const int NodeStatus_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStatus, node_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStatus, status_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
+PROTOBUF_CONSTEXPR Nodes::Nodes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodesDefaultTypeInternal() {}
+  union {
+    Nodes _instance;
   };
-  NodeStatus_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      NodeStatus_descriptor_,
-      NodeStatus::default_instance_,
-      NodeStatus_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStatus, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStatus, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(NodeStatus));
-  Nodes_descriptor_ = file->message_type(2);
-  static const int Nodes_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Nodes, nodes_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodesDefaultTypeInternal _Nodes_default_instance_;
+PROTOBUF_CONSTEXPR MetaNodes::MetaNodes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.followers_)*/{}
+  , /*decltype(_impl_.leader_)*/nullptr} {}
+struct MetaNodesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaNodesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaNodesDefaultTypeInternal() {}
+  union {
+    MetaNodes _instance;
   };
-  Nodes_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Nodes_descriptor_,
-      Nodes::default_instance_,
-      Nodes_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Nodes, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Nodes, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Nodes));
-  MetaNodes_descriptor_ = file->message_type(3);
-  static const int MetaNodes_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaNodes, followers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaNodes, leader_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaNodesDefaultTypeInternal _MetaNodes_default_instance_;
+PROTOBUF_CONSTEXPR Partitions::Partitions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.slaves_)*/{}
+  , /*decltype(_impl_.learners_)*/{}
+  , /*decltype(_impl_.master_)*/nullptr
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.chain_)*/false
+  , /*decltype(_impl_.state_)*/1} {}
+struct PartitionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PartitionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PartitionsDefaultTypeInternal() {}
+  union {
+    Partitions _instance;
   };
-  MetaNodes_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaNodes_descriptor_,
-      MetaNodes::default_instance_,
-      MetaNodes_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaNodes, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaNodes, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaNodes));
-  Partitions_descriptor_ = file->message_type(4);
-  static const int Partitions_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Partitions, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Partitions, state_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Partitions, master_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Partitions, slaves_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PartitionsDefaultTypeInternal _Partitions_default_instance_;
+PROTOBUF_CONSTEXPR TableName::TableName(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TableNameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableNameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableNameDefaultTypeInternal() {}
+  union {
+    TableName _instance;
   };
-  Partitions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Partitions_descriptor_,
-      Partitions::default_instance_,
-      Partitions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Partitions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Partitions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Partitions));
-  TableName_descriptor_ = file->message_type(5);
-  static const int TableName_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableName, name_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableNameDefaultTypeInternal _TableName_default_instance_;
+PROTOBUF_CONSTEXPR Table::Table(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.partitions_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct TableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableDefaultTypeInternal() {}
+  union {
+    Table _instance;
   };
-  TableName_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      TableName_descriptor_,
-      TableName::default_instance_,
-      TableName_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableName, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableName, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(TableName));
-  Table_descriptor_ = file->message_type(6);
-  static const int Table_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, partitions_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableDefaultTypeInternal _Table_default_instance_;
+PROTOBUF_CONSTEXPR BasicCmdUnit::BasicCmdUnit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_)*/nullptr
+  , /*decltype(_impl_.partition_)*/0} {}
+struct BasicCmdUnitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BasicCmdUnitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BasicCmdUnitDefaultTypeInternal() {}
+  union {
+    BasicCmdUnit _instance;
   };
-  Table_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Table_descriptor_,
-      Table::default_instance_,
-      Table_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Table));
-  BasicCmdUnit_descriptor_ = file->message_type(7);
-  static const int BasicCmdUnit_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, partition_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, node_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BasicCmdUnitDefaultTypeInternal _BasicCmdUnit_default_instance_;
+PROTOBUF_CONSTEXPR SyncOffset::SyncOffset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_)*/0
+  , /*decltype(_impl_.filenum_)*/0
+  , /*decltype(_impl_.offset_)*/int64_t{0}} {}
+struct SyncOffsetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncOffsetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncOffsetDefaultTypeInternal() {}
+  union {
+    SyncOffset _instance;
   };
-  BasicCmdUnit_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      BasicCmdUnit_descriptor_,
-      BasicCmdUnit::default_instance_,
-      BasicCmdUnit_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(BasicCmdUnit));
-  SyncOffset_descriptor_ = file->message_type(8);
-  static const int SyncOffset_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, table_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, partition_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, filenum_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, offset_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncOffsetDefaultTypeInternal _SyncOffset_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_Ping::MetaCmd_Ping(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.offset_)*/{}
+  , /*decltype(_impl_.node_)*/nullptr
+  , /*decltype(_impl_.version_)*/0} {}
+struct MetaCmd_PingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_PingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_PingDefaultTypeInternal() {}
+  union {
+    MetaCmd_Ping _instance;
   };
-  SyncOffset_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SyncOffset_descriptor_,
-      SyncOffset::default_instance_,
-      SyncOffset_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SyncOffset));
-  MetaCmd_descriptor_ = file->message_type(9);
-  static const int MetaCmd_offsets_[8] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, ping_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, pull_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, init_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, set_master_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, add_slave_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, remove_slave_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, drop_table_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_PingDefaultTypeInternal _MetaCmd_Ping_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_Pull::MetaCmd_Pull(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_)*/nullptr} {}
+struct MetaCmd_PullDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_PullDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_PullDefaultTypeInternal() {}
+  union {
+    MetaCmd_Pull _instance;
   };
-  MetaCmd_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_descriptor_,
-      MetaCmd::default_instance_,
-      MetaCmd_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd));
-  MetaCmd_Ping_descriptor_ = MetaCmd_descriptor_->nested_type(0);
-  static const int MetaCmd_Ping_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Ping, version_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Ping, node_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Ping, offset_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_PullDefaultTypeInternal _MetaCmd_Pull_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_Init::MetaCmd_Init(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_)*/0
+  , /*decltype(_impl_.learner_num_)*/0
+  , /*decltype(_impl_.replica_num_)*/3} {}
+struct MetaCmd_InitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_InitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_InitDefaultTypeInternal() {}
+  union {
+    MetaCmd_Init _instance;
   };
-  MetaCmd_Ping_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_Ping_descriptor_,
-      MetaCmd_Ping::default_instance_,
-      MetaCmd_Ping_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Ping, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Ping, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_Ping));
-  MetaCmd_Pull_descriptor_ = MetaCmd_descriptor_->nested_type(1);
-  static const int MetaCmd_Pull_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, node_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, name_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_InitDefaultTypeInternal _MetaCmd_Init_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_SetMaster::MetaCmd_SetMaster(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.basic_)*/nullptr} {}
+struct MetaCmd_SetMasterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_SetMasterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_SetMasterDefaultTypeInternal() {}
+  union {
+    MetaCmd_SetMaster _instance;
   };
-  MetaCmd_Pull_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_Pull_descriptor_,
-      MetaCmd_Pull::default_instance_,
-      MetaCmd_Pull_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_Pull));
-  MetaCmd_Init_descriptor_ = MetaCmd_descriptor_->nested_type(2);
-  static const int MetaCmd_Init_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, num_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_SetMasterDefaultTypeInternal _MetaCmd_SetMaster_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_AddSlave::MetaCmd_AddSlave(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.basic_)*/nullptr} {}
+struct MetaCmd_AddSlaveDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_AddSlaveDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_AddSlaveDefaultTypeInternal() {}
+  union {
+    MetaCmd_AddSlave _instance;
   };
-  MetaCmd_Init_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_Init_descriptor_,
-      MetaCmd_Init::default_instance_,
-      MetaCmd_Init_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_Init));
-  MetaCmd_SetMaster_descriptor_ = MetaCmd_descriptor_->nested_type(3);
-  static const int MetaCmd_SetMaster_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_SetMaster, basic_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_AddSlaveDefaultTypeInternal _MetaCmd_AddSlave_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_RemoveSlave::MetaCmd_RemoveSlave(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.basic_)*/nullptr} {}
+struct MetaCmd_RemoveSlaveDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_RemoveSlaveDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_RemoveSlaveDefaultTypeInternal() {}
+  union {
+    MetaCmd_RemoveSlave _instance;
   };
-  MetaCmd_SetMaster_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_SetMaster_descriptor_,
-      MetaCmd_SetMaster::default_instance_,
-      MetaCmd_SetMaster_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_SetMaster, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_SetMaster, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_SetMaster));
-  MetaCmd_AddSlave_descriptor_ = MetaCmd_descriptor_->nested_type(4);
-  static const int MetaCmd_AddSlave_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_AddSlave, basic_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_RemoveSlaveDefaultTypeInternal _MetaCmd_RemoveSlave_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_DropTable::MetaCmd_DropTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct MetaCmd_DropTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_DropTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_DropTableDefaultTypeInternal() {}
+  union {
+    MetaCmd_DropTable _instance;
   };
-  MetaCmd_AddSlave_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_AddSlave_descriptor_,
-      MetaCmd_AddSlave::default_instance_,
-      MetaCmd_AddSlave_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_AddSlave, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_AddSlave, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_AddSlave));
-  MetaCmd_RemoveSlave_descriptor_ = MetaCmd_descriptor_->nested_type(5);
-  static const int MetaCmd_RemoveSlave_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_RemoveSlave, basic_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_DropTableDefaultTypeInternal _MetaCmd_DropTable_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd_SetChain::MetaCmd_SetChain(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.order_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.partition_)*/0
+  , /*decltype(_impl_.enable_)*/false} {}
+struct MetaCmd_SetChainDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmd_SetChainDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmd_SetChainDefaultTypeInternal() {}
+  union {
+    MetaCmd_SetChain _instance;
   };
-  MetaCmd_RemoveSlave_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_RemoveSlave_descriptor_,
-      MetaCmd_RemoveSlave::default_instance_,
-      MetaCmd_RemoveSlave_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_RemoveSlave, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_RemoveSlave, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_RemoveSlave));
-  MetaCmd_DropTable_descriptor_ = MetaCmd_descriptor_->nested_type(6);
-  static const int MetaCmd_DropTable_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_DropTable, name_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmd_SetChainDefaultTypeInternal _MetaCmd_SetChain_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmd::MetaCmd(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ping_)*/nullptr
+  , /*decltype(_impl_.pull_)*/nullptr
+  , /*decltype(_impl_.init_)*/nullptr
+  , /*decltype(_impl_.set_master_)*/nullptr
+  , /*decltype(_impl_.add_slave_)*/nullptr
+  , /*decltype(_impl_.remove_slave_)*/nullptr
+  , /*decltype(_impl_.drop_table_)*/nullptr
+  , /*decltype(_impl_.set_chain_)*/nullptr
+  , /*decltype(_impl_.type_)*/1} {}
+struct MetaCmdDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdDefaultTypeInternal() {}
+  union {
+    MetaCmd _instance;
   };
-  MetaCmd_DropTable_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmd_DropTable_descriptor_,
-      MetaCmd_DropTable::default_instance_,
-      MetaCmd_DropTable_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_DropTable, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_DropTable, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmd_DropTable));
-  MetaCmdResponse_descriptor_ = file->message_type(10);
-  static const int MetaCmdResponse_offsets_[8] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, code_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, msg_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, ping_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, pull_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, list_table_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, list_node_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, list_meta_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdDefaultTypeInternal _MetaCmd_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmdResponse_Ping::MetaCmdResponse_Ping(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/0} {}
+struct MetaCmdResponse_PingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdResponse_PingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdResponse_PingDefaultTypeInternal() {}
+  union {
+    MetaCmdResponse_Ping _instance;
   };
-  MetaCmdResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmdResponse_descriptor_,
-      MetaCmdResponse::default_instance_,
-      MetaCmdResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmdResponse));
-  MetaCmdResponse_Ping_descriptor_ = MetaCmdResponse_descriptor_->nested_type(0);
-  static const int MetaCmdResponse_Ping_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Ping, version_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdResponse_PingDefaultTypeInternal _MetaCmdResponse_Ping_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmdResponse_Pull::MetaCmdResponse_Pull(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.info_)*/{}
+  , /*decltype(_impl_.version_)*/0} {}
+struct MetaCmdResponse_PullDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdResponse_PullDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdResponse_PullDefaultTypeInternal() {}
+  union {
+    MetaCmdResponse_Pull _instance;
   };
-  MetaCmdResponse_Ping_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmdResponse_Ping_descriptor_,
-      MetaCmdResponse_Ping::default_instance_,
-      MetaCmdResponse_Ping_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Ping, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Ping, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmdResponse_Ping));
-  MetaCmdResponse_Pull_descriptor_ = MetaCmdResponse_descriptor_->nested_type(1);
-  static const int MetaCmdResponse_Pull_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, version_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, info_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdResponse_PullDefaultTypeInternal _MetaCmdResponse_Pull_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmdResponse_ListTable::MetaCmdResponse_ListTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tables_)*/nullptr} {}
+struct MetaCmdResponse_ListTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdResponse_ListTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdResponse_ListTableDefaultTypeInternal() {}
+  union {
+    MetaCmdResponse_ListTable _instance;
   };
-  MetaCmdResponse_Pull_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmdResponse_Pull_descriptor_,
-      MetaCmdResponse_Pull::default_instance_,
-      MetaCmdResponse_Pull_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmdResponse_Pull));
-  MetaCmdResponse_ListTable_descriptor_ = MetaCmdResponse_descriptor_->nested_type(2);
-  static const int MetaCmdResponse_ListTable_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListTable, tables_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdResponse_ListTableDefaultTypeInternal _MetaCmdResponse_ListTable_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmdResponse_ListNode::MetaCmdResponse_ListNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.nodes_)*/nullptr} {}
+struct MetaCmdResponse_ListNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdResponse_ListNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdResponse_ListNodeDefaultTypeInternal() {}
+  union {
+    MetaCmdResponse_ListNode _instance;
   };
-  MetaCmdResponse_ListTable_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmdResponse_ListTable_descriptor_,
-      MetaCmdResponse_ListTable::default_instance_,
-      MetaCmdResponse_ListTable_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListTable, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListTable, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmdResponse_ListTable));
-  MetaCmdResponse_ListNode_descriptor_ = MetaCmdResponse_descriptor_->nested_type(3);
-  static const int MetaCmdResponse_ListNode_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListNode, nodes_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdResponse_ListNodeDefaultTypeInternal _MetaCmdResponse_ListNode_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmdResponse_ListMeta::MetaCmdResponse_ListMeta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.nodes_)*/nullptr} {}
+struct MetaCmdResponse_ListMetaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdResponse_ListMetaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdResponse_ListMetaDefaultTypeInternal() {}
+  union {
+    MetaCmdResponse_ListMeta _instance;
   };
-  MetaCmdResponse_ListNode_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmdResponse_ListNode_descriptor_,
-      MetaCmdResponse_ListNode::default_instance_,
-      MetaCmdResponse_ListNode_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListNode, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListNode, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmdResponse_ListNode));
-  MetaCmdResponse_ListMeta_descriptor_ = MetaCmdResponse_descriptor_->nested_type(4);
-  static const int MetaCmdResponse_ListMeta_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListMeta, nodes_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdResponse_ListMetaDefaultTypeInternal _MetaCmdResponse_ListMeta_default_instance_;
+PROTOBUF_CONSTEXPR MetaCmdResponse::MetaCmdResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ping_)*/nullptr
+  , /*decltype(_impl_.pull_)*/nullptr
+  , /*decltype(_impl_.list_table_)*/nullptr
+  , /*decltype(_impl_.list_node_)*/nullptr
+  , /*decltype(_impl_.list_meta_)*/nullptr
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_.type_)*/1} {}
+struct MetaCmdResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaCmdResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaCmdResponseDefaultTypeInternal() {}
+  union {
+    MetaCmdResponse _instance;
   };
-  MetaCmdResponse_ListMeta_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MetaCmdResponse_ListMeta_descriptor_,
-      MetaCmdResponse_ListMeta::default_instance_,
-      MetaCmdResponse_ListMeta_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListMeta, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_ListMeta, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MetaCmdResponse_ListMeta));
-  StatusCode_descriptor_ = file->enum_type(0);
-  Type_descriptor_ = file->enum_type(1);
-  PState_descriptor_ = file->enum_type(2);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_zp_5fmeta_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Node_descriptor_, &Node::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    NodeStatus_descriptor_, &NodeStatus::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Nodes_descriptor_, &Nodes::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaNodes_descriptor_, &MetaNodes::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Partitions_descriptor_, &Partitions::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    TableName_descriptor_, &TableName::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Table_descriptor_, &Table::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    BasicCmdUnit_descriptor_, &BasicCmdUnit::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SyncOffset_descriptor_, &SyncOffset::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_descriptor_, &MetaCmd::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_Ping_descriptor_, &MetaCmd_Ping::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_Pull_descriptor_, &MetaCmd_Pull::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_Init_descriptor_, &MetaCmd_Init::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_SetMaster_descriptor_, &MetaCmd_SetMaster::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_AddSlave_descriptor_, &MetaCmd_AddSlave::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_RemoveSlave_descriptor_, &MetaCmd_RemoveSlave::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmd_DropTable_descriptor_, &MetaCmd_DropTable::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmdResponse_descriptor_, &MetaCmdResponse::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmdResponse_Ping_descriptor_, &MetaCmdResponse_Ping::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmdResponse_Pull_descriptor_, &MetaCmdResponse_Pull::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmdResponse_ListTable_descriptor_, &MetaCmdResponse_ListTable::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmdResponse_ListNode_descriptor_, &MetaCmdResponse_ListNode::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MetaCmdResponse_ListMeta_descriptor_, &MetaCmdResponse_ListMeta::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_zp_5fmeta_2eproto() {
-  delete Node::default_instance_;
-  delete Node_reflection_;
-  delete NodeStatus::default_instance_;
-  delete NodeStatus_reflection_;
-  delete Nodes::default_instance_;
-  delete Nodes_reflection_;
-  delete MetaNodes::default_instance_;
-  delete MetaNodes_reflection_;
-  delete Partitions::default_instance_;
-  delete Partitions_reflection_;
-  delete TableName::default_instance_;
-  delete TableName_reflection_;
-  delete Table::default_instance_;
-  delete Table_reflection_;
-  delete BasicCmdUnit::default_instance_;
-  delete BasicCmdUnit_reflection_;
-  delete SyncOffset::default_instance_;
-  delete SyncOffset_reflection_;
-  delete MetaCmd::default_instance_;
-  delete MetaCmd_reflection_;
-  delete MetaCmd_Ping::default_instance_;
-  delete MetaCmd_Ping_reflection_;
-  delete MetaCmd_Pull::default_instance_;
-  delete MetaCmd_Pull_reflection_;
-  delete MetaCmd_Init::default_instance_;
-  delete MetaCmd_Init_reflection_;
-  delete MetaCmd_SetMaster::default_instance_;
-  delete MetaCmd_SetMaster_reflection_;
-  delete MetaCmd_AddSlave::default_instance_;
-  delete MetaCmd_AddSlave_reflection_;
-  delete MetaCmd_RemoveSlave::default_instance_;
-  delete MetaCmd_RemoveSlave_reflection_;
-  delete MetaCmd_DropTable::default_instance_;
-  delete MetaCmd_DropTable_reflection_;
-  delete MetaCmdResponse::default_instance_;
-  delete MetaCmdResponse_reflection_;
-  delete MetaCmdResponse_Ping::default_instance_;
-  delete MetaCmdResponse_Ping_reflection_;
-  delete MetaCmdResponse_Pull::default_instance_;
-  delete MetaCmdResponse_Pull_reflection_;
-  delete MetaCmdResponse_ListTable::default_instance_;
-  delete MetaCmdResponse_ListTable_reflection_;
-  delete MetaCmdResponse_ListNode::default_instance_;
-  delete MetaCmdResponse_ListNode_reflection_;
-  delete MetaCmdResponse_ListMeta::default_instance_;
-  delete MetaCmdResponse_ListMeta_reflection_;
-}
-
-void protobuf_AddDesc_zp_5fmeta_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\rzp_meta.proto\022\006ZPMeta\" \n\004Node\022\n\n\002ip\030\001 "
-    "\002(\t\022\014\n\004port\030\002 \002(\005\"8\n\nNodeStatus\022\032\n\004node\030"
-    "\001 \002(\0132\014.ZPMeta.Node\022\016\n\006status\030\002 \002(\005\"*\n\005N"
-    "odes\022!\n\005nodes\030\001 \003(\0132\022.ZPMeta.NodeStatus\""
-    "J\n\tMetaNodes\022\037\n\tfollowers\030\001 \003(\0132\014.ZPMeta"
-    ".Node\022\034\n\006leader\030\002 \001(\0132\014.ZPMeta.Node\"s\n\nP"
-    "artitions\022\n\n\002id\030\001 \002(\005\022\035\n\005state\030\002 \002(\0162\016.Z"
-    "PMeta.PState\022\034\n\006master\030\003 \002(\0132\014.ZPMeta.No"
-    "de\022\034\n\006slaves\030\004 \003(\0132\014.ZPMeta.Node\"\031\n\tTabl"
-    "eName\022\014\n\004name\030\001 \003(\t\"=\n\005Table\022\014\n\004name\030\001 \002"
-    "(\t\022&\n\npartitions\030\002 \003(\0132\022.ZPMeta.Partitio"
-    "ns\"K\n\014BasicCmdUnit\022\014\n\004name\030\001 \002(\t\022\021\n\tpart"
-    "ition\030\002 \002(\005\022\032\n\004node\030\003 \002(\0132\014.ZPMeta.Node\""
-    "T\n\nSyncOffset\022\022\n\ntable_name\030\001 \002(\t\022\021\n\tpar"
-    "tition\030\002 \002(\005\022\017\n\007filenum\030\003 \001(\005\022\016\n\006offset\030"
-    "\004 \001(\003\"\257\005\n\007MetaCmd\022\032\n\004type\030\001 \002(\0162\014.ZPMeta"
-    ".Type\022\"\n\004ping\030\002 \001(\0132\024.ZPMeta.MetaCmd.Pin"
-    "g\022\"\n\004pull\030\003 \001(\0132\024.ZPMeta.MetaCmd.Pull\022\"\n"
-    "\004init\030\004 \001(\0132\024.ZPMeta.MetaCmd.Init\022-\n\nset"
-    "_master\030\005 \001(\0132\031.ZPMeta.MetaCmd.SetMaster"
-    "\022+\n\tadd_slave\030\006 \001(\0132\030.ZPMeta.MetaCmd.Add"
-    "Slave\0221\n\014remove_slave\030\007 \001(\0132\033.ZPMeta.Met"
-    "aCmd.RemoveSlave\022-\n\ndrop_table\030\010 \001(\0132\031.Z"
-    "PMeta.MetaCmd.DropTable\032W\n\004Ping\022\017\n\007versi"
-    "on\030\001 \002(\005\022\032\n\004node\030\002 \002(\0132\014.ZPMeta.Node\022\"\n\006"
-    "offset\030\003 \003(\0132\022.ZPMeta.SyncOffset\0320\n\004Pull"
-    "\022\032\n\004node\030\001 \001(\0132\014.ZPMeta.Node\022\014\n\004name\030\002 \001"
-    "(\t\032!\n\004Init\022\014\n\004name\030\001 \002(\t\022\013\n\003num\030\002 \002(\005\0320\n"
-    "\tSetMaster\022#\n\005basic\030\001 \002(\0132\024.ZPMeta.Basic"
-    "CmdUnit\032/\n\010AddSlave\022#\n\005basic\030\001 \002(\0132\024.ZPM"
-    "eta.BasicCmdUnit\0322\n\013RemoveSlave\022#\n\005basic"
-    "\030\001 \002(\0132\024.ZPMeta.BasicCmdUnit\032\031\n\tDropTabl"
-    "e\022\014\n\004name\030\001 \002(\t\"\254\004\n\017MetaCmdResponse\022\032\n\004t"
-    "ype\030\001 \002(\0162\014.ZPMeta.Type\022 \n\004code\030\002 \002(\0162\022."
-    "ZPMeta.StatusCode\022\013\n\003msg\030\003 \001(\t\022*\n\004ping\030\004"
-    " \001(\0132\034.ZPMeta.MetaCmdResponse.Ping\022*\n\004pu"
-    "ll\030\005 \001(\0132\034.ZPMeta.MetaCmdResponse.Pull\0225"
-    "\n\nlist_table\030\006 \001(\0132!.ZPMeta.MetaCmdRespo"
-    "nse.ListTable\0223\n\tlist_node\030\007 \001(\0132 .ZPMet"
-    "a.MetaCmdResponse.ListNode\0223\n\tlist_meta\030"
-    "\010 \001(\0132 .ZPMeta.MetaCmdResponse.ListMeta\032"
-    "\027\n\004Ping\022\017\n\007version\030\001 \002(\005\0324\n\004Pull\022\017\n\007vers"
-    "ion\030\001 \002(\005\022\033\n\004info\030\002 \003(\0132\r.ZPMeta.Table\032."
-    "\n\tListTable\022!\n\006tables\030\001 \001(\0132\021.ZPMeta.Tab"
-    "leName\032(\n\010ListNode\022\034\n\005nodes\030\001 \001(\0132\r.ZPMe"
-    "ta.Nodes\032,\n\010ListMeta\022 \n\005nodes\030\001 \002(\0132\021.ZP"
-    "Meta.MetaNodes*-\n\nStatusCode\022\006\n\002OK\020\000\022\014\n\010"
-    "NOTFOUND\020\001\022\t\n\005ERROR\020\002*\214\001\n\004Type\022\010\n\004PING\020\001"
-    "\022\010\n\004PULL\020\002\022\010\n\004INIT\020\003\022\r\n\tSETMASTER\020\004\022\014\n\010A"
-    "DDSLAVE\020\005\022\017\n\013REMOVESLAVE\020\006\022\r\n\tLISTTABLE\020"
-    "\007\022\014\n\010LISTNODE\020\010\022\014\n\010LISTMETA\020\t\022\r\n\tDROPTAB"
-    "LE\020\n*\037\n\006PState\022\n\n\006ACTIVE\020\001\022\t\n\005STUCK\020\002", 2077);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "zp_meta.proto", &protobuf_RegisterTypes);
-  Node::default_instance_ = new Node();
-  NodeStatus::default_instance_ = new NodeStatus();
-  Nodes::default_instance_ = new Nodes();
-  MetaNodes::default_instance_ = new MetaNodes();
-  Partitions::default_instance_ = new Partitions();
-  TableName::default_instance_ = new TableName();
-  Table::default_instance_ = new Table();
-  BasicCmdUnit::default_instance_ = new BasicCmdUnit();
-  SyncOffset::default_instance_ = new SyncOffset();
-  MetaCmd::default_instance_ = new MetaCmd();
-  MetaCmd_Ping::default_instance_ = new MetaCmd_Ping();
-  MetaCmd_Pull::default_instance_ = new MetaCmd_Pull();
-  MetaCmd_Init::default_instance_ = new MetaCmd_Init();
-  MetaCmd_SetMaster::default_instance_ = new MetaCmd_SetMaster();
-  MetaCmd_AddSlave::default_instance_ = new MetaCmd_AddSlave();
-  MetaCmd_RemoveSlave::default_instance_ = new MetaCmd_RemoveSlave();
-  MetaCmd_DropTable::default_instance_ = new MetaCmd_DropTable();
-  MetaCmdResponse::default_instance_ = new MetaCmdResponse();
-  MetaCmdResponse_Ping::default_instance_ = new MetaCmdResponse_Ping();
-  MetaCmdResponse_Pull::default_instance_ = new MetaCmdResponse_Pull();
-  MetaCmdResponse_ListTable::default_instance_ = new MetaCmdResponse_ListTable();
-  MetaCmdResponse_ListNode::default_instance_ = new MetaCmdResponse_ListNode();
-  MetaCmdResponse_ListMeta::default_instance_ = new MetaCmdResponse_ListMeta();
-  Node::default_instance_->InitAsDefaultInstance();
-  NodeStatus::default_instance_->InitAsDefaultInstance();
-  Nodes::default_instance_->InitAsDefaultInstance();
-  MetaNodes::default_instance_->InitAsDefaultInstance();
-  Partitions::default_instance_->InitAsDefaultInstance();
-  TableName::default_instance_->InitAsDefaultInstance();
-  Table::default_instance_->InitAsDefaultInstance();
-  BasicCmdUnit::default_instance_->InitAsDefaultInstance();
-  SyncOffset::default_instance_->InitAsDefaultInstance();
-  MetaCmd::default_instance_->InitAsDefaultInstance();
-  MetaCmd_Ping::default_instance_->InitAsDefaultInstance();
-  MetaCmd_Pull::default_instance_->InitAsDefaultInstance();
-  MetaCmd_Init::default_instance_->InitAsDefaultInstance();
-  MetaCmd_SetMaster::default_instance_->InitAsDefaultInstance();
-  MetaCmd_AddSlave::default_instance_->InitAsDefaultInstance();
-  MetaCmd_RemoveSlave::default_instance_->InitAsDefaultInstance();
-  MetaCmd_DropTable::default_instance_->InitAsDefaultInstance();
-  MetaCmdResponse::default_instance_->InitAsDefaultInstance();
-  MetaCmdResponse_Ping::default_instance_->InitAsDefaultInstance();
-  MetaCmdResponse_Pull::default_instance_->InitAsDefaultInstance();
-  MetaCmdResponse_ListTable::default_instance_->InitAsDefaultInstance();
-  MetaCmdResponse_ListNode::default_instance_->InitAsDefaultInstance();
-  MetaCmdResponse_ListMeta::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_zp_5fmeta_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_zp_5fmeta_2eproto {
-  StaticDescriptorInitializer_zp_5fmeta_2eproto() {
-    protobuf_AddDesc_zp_5fmeta_2eproto();
-  }
-} static_descriptor_initializer_zp_5fmeta_2eproto_;
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return StatusCode_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaCmdResponseDefaultTypeInternal _MetaCmdResponse_default_instance_;
+}  // namespace ZPMeta
+static ::_pb::Metadata file_level_metadata_zp_5fmeta_2eproto[24];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_zp_5fmeta_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_zp_5fmeta_2eproto = nullptr;
+
+const uint32_t TableStruct_zp_5fmeta_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Node, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Node, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Node, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Node, _impl_.port_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::NodeStatus, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::NodeStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::NodeStatus, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::NodeStatus, _impl_.status_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Nodes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Nodes, _impl_.nodes_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaNodes, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaNodes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaNodes, _impl_.followers_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaNodes, _impl_.leader_),
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_.master_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_.slaves_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_.chain_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Partitions, _impl_.learners_),
+  1,
+  3,
+  0,
+  ~0u,
+  2,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::TableName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::TableName, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Table, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Table, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Table, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::Table, _impl_.partitions_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::BasicCmdUnit, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::BasicCmdUnit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::BasicCmdUnit, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::BasicCmdUnit, _impl_.partition_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::BasicCmdUnit, _impl_.node_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::SyncOffset, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::SyncOffset, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::SyncOffset, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::SyncOffset, _impl_.partition_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::SyncOffset, _impl_.filenum_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::SyncOffset, _impl_.offset_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Ping, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Ping, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Ping, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Ping, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Ping, _impl_.offset_),
+  1,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Pull, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Pull, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Pull, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Pull, _impl_.name_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Init, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Init, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Init, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Init, _impl_.num_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Init, _impl_.replica_num_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_Init, _impl_.learner_num_),
+  0,
+  1,
+  3,
+  2,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetMaster, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetMaster, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetMaster, _impl_.basic_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_AddSlave, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_AddSlave, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_AddSlave, _impl_.basic_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_RemoveSlave, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_RemoveSlave, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_RemoveSlave, _impl_.basic_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_DropTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_DropTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_DropTable, _impl_.name_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetChain, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetChain, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetChain, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetChain, _impl_.partition_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetChain, _impl_.enable_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd_SetChain, _impl_.order_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.ping_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.pull_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.init_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.set_master_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.add_slave_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.remove_slave_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.drop_table_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmd, _impl_.set_chain_),
+  8,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Ping, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Ping, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Ping, _impl_.version_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Pull, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Pull, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Pull, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_Pull, _impl_.info_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListTable, _impl_.tables_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListNode, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListNode, _impl_.nodes_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListMeta, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListMeta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse_ListMeta, _impl_.nodes_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.ping_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.pull_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.list_table_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.list_node_),
+  PROTOBUF_FIELD_OFFSET(::ZPMeta::MetaCmdResponse, _impl_.list_meta_),
+  7,
+  6,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::ZPMeta::Node)},
+  { 10, 18, -1, sizeof(::ZPMeta::NodeStatus)},
+  { 20, -1, -1, sizeof(::ZPMeta::Nodes)},
+  { 27, 35, -1, sizeof(::ZPMeta::MetaNodes)},
+  { 37, 49, -1, sizeof(::ZPMeta::Partitions)},
+  { 55, -1, -1, sizeof(::ZPMeta::TableName)},
+  { 62, 70, -1, sizeof(::ZPMeta::Table)},
+  { 72, 81, -1, sizeof(::ZPMeta::BasicCmdUnit)},
+  { 84, 94, -1, sizeof(::ZPMeta::SyncOffset)},
+  { 98, 107, -1, sizeof(::ZPMeta::MetaCmd_Ping)},
+  { 110, 118, -1, sizeof(::ZPMeta::MetaCmd_Pull)},
+  { 120, 130, -1, sizeof(::ZPMeta::MetaCmd_Init)},
+  { 134, 141, -1, sizeof(::ZPMeta::MetaCmd_SetMaster)},
+  { 142, 149, -1, sizeof(::ZPMeta::MetaCmd_AddSlave)},
+  { 150, 157, -1, sizeof(::ZPMeta::MetaCmd_RemoveSlave)},
+  { 158, 165, -1, sizeof(::ZPMeta::MetaCmd_DropTable)},
+  { 166, 176, -1, sizeof(::ZPMeta::MetaCmd_SetChain)},
+  { 180, 195, -1, sizeof(::ZPMeta::MetaCmd)},
+  { 204, 211, -1, sizeof(::ZPMeta::MetaCmdResponse_Ping)},
+  { 212, 220, -1, sizeof(::ZPMeta::MetaCmdResponse_Pull)},
+  { 222, 229, -1, sizeof(::ZPMeta::MetaCmdResponse_ListTable)},
+  { 230, 237, -1, sizeof(::ZPMeta::MetaCmdResponse_ListNode)},
+  { 238, 245, -1, sizeof(::ZPMeta::MetaCmdResponse_ListMeta)},
+  { 246, 260, -1, sizeof(::ZPMeta::MetaCmdResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ZPMeta::_Node_default_instance_._instance,
+  &::ZPMeta::_NodeStatus_default_instance_._instance,
+  &::ZPMeta::_Nodes_default_instance_._instance,
+  &::ZPMeta::_MetaNodes_default_instance_._instance,
+  &::ZPMeta::_Partitions_default_instance_._instance,
+  &::ZPMeta::_TableName_default_instance_._instance,
+  &::ZPMeta::_Table_default_instance_._instance,
+  &::ZPMeta::_BasicCmdUnit_default_instance_._instance,
+  &::ZPMeta::_SyncOffset_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_Ping_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_Pull_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_Init_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_SetMaster_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_AddSlave_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_RemoveSlave_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_DropTable_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_SetChain_default_instance_._instance,
+  &::ZPMeta::_MetaCmd_default_instance_._instance,
+  &::ZPMeta::_MetaCmdResponse_Ping_default_instance_._instance,
+  &::ZPMeta::_MetaCmdResponse_Pull_default_instance_._instance,
+  &::ZPMeta::_MetaCmdResponse_ListTable_default_instance_._instance,
+  &::ZPMeta::_MetaCmdResponse_ListNode_default_instance_._instance,
+  &::ZPMeta::_MetaCmdResponse_ListMeta_default_instance_._instance,
+  &::ZPMeta::_MetaCmdResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_zp_5fmeta_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rzp_meta.proto\022\006ZPMeta\" \n\004Node\022\n\n\002ip\030\001 "
+  "\002(\t\022\014\n\004port\030\002 \002(\005\"8\n\nNodeStatus\022\032\n\004node\030"
+  "\001 \002(\0132\014.ZPMeta.Node\022\016\n\006status\030\002 \002(\005\"*\n\005N"
+  "odes\022!\n\005nodes\030\001 \003(\0132\022.ZPMeta.NodeStatus\""
+  "J\n\tMetaNodes\022\037\n\tfollowers\030\001 \003(\0132\014.ZPMeta"
+  ".Node\022\034\n\006leader\030\002 \001(\0132\014.ZPMeta.Node\"\242\001\n\n"
+  "Partitions\022\n\n\002id\030\001 \002(\005\022\035\n\005state\030\002 \002(\0162\016."
+  "ZPMeta.PState\022\034\n\006master\030\003 \002(\0132\014.ZPMeta.N"
+  "ode\022\034\n\006slaves\030\004 \003(\0132\014.ZPMeta.Node\022\r\n\005cha"
+  "in\030\005 \001(\010\022\036\n\010learners\030\006 \003(\0132\014.ZPMeta.Node"
+  "\"\031\n\tTableName\022\014\n\004name\030\001 \003(\t\"=\n\005Table\022\014\n\004"
+  "name\030\001 \002(\t\022&\n\npartitions\030\002 \003(\0132\022.ZPMeta."
+  "Partitions\"K\n\014BasicCmdUnit\022\014\n\004name\030\001 \002(\t"
+  "\022\021\n\tpartition\030\002 \002(\005\022\032\n\004node\030\003 \002(\0132\014.ZPMe"
+  "ta.Node\"T\n\nSyncOffset\022\022\n\ntable_name\030\001 \002("
+  "\t\022\021\n\tpartition\030\002 \002(\005\022\017\n\007filenum\030\003 \001(\005\022\016\n"
+  "\006offset\030\004 \001(\003\"\346\006\n\007MetaCmd\022\032\n\004type\030\001 \002(\0162"
+  "\014.ZPMeta.Type\022\"\n\004ping\030\002 \001(\0132\024.ZPMeta.Met"
+  "aCmd.Ping\022\"\n\004pull\030\003 \001(\0132\024.ZPMeta.MetaCmd"
+  ".Pull\022\"\n\004init\030\004 \001(\0132\024.ZPMeta.MetaCmd.Ini"
+  "t\022-\n\nset_master\030\005 \001(\0132\031.ZPMeta.MetaCmd.S"
+  "etMaster\022+\n\tadd_slave\030\006 \001(\0132\030.ZPMeta.Met"
+  "aCmd.AddSlave\0221\n\014remove_slave\030\007 \001(\0132\033.ZP"
+  "Meta.MetaCmd.RemoveSlave\022-\n\ndrop_table\030\010"
+  " \001(\0132\031.ZPMeta.MetaCmd.DropTable\022+\n\tset_c"
+  "hain\030\t \001(\0132\030.ZPMeta.MetaCmd.SetChain\032W\n\004"
+  "Ping\022\017\n\007version\030\001 \002(\005\022\032\n\004node\030\002 \002(\0132\014.ZP"
+  "Meta.Node\022\"\n\006offset\030\003 \003(\0132\022.ZPMeta.SyncO"
+  "ffset\0320\n\004Pull\022\032\n\004node\030\001 \001(\0132\014.ZPMeta.Nod"
+  "e\022\014\n\004name\030\002 \001(\t\032Q\n\004Init\022\014\n\004name\030\001 \002(\t\022\013\n"
+  "\003num\030\002 \002(\005\022\026\n\013replica_num\030\003 \001(\005:\0013\022\026\n\013le"
+  "arner_num\030\004 \001(\005:\0010\0320\n\tSetMaster\022#\n\005basic"
+  "\030\001 \002(\0132\024.ZPMeta.BasicCmdUnit\032/\n\010AddSlave"
+  "\022#\n\005basic\030\001 \002(\0132\024.ZPMeta.BasicCmdUnit\0322\n"
+  "\013RemoveSlave\022#\n\005basic\030\001 \002(\0132\024.ZPMeta.Bas"
+  "icCmdUnit\032\031\n\tDropTable\022\014\n\004name\030\001 \002(\t\032X\n\010"
+  "SetChain\022\014\n\004name\030\001 \002(\t\022\021\n\tpartition\030\002 \002("
+  "\005\022\016\n\006enable\030\003 \002(\010\022\033\n\005order\030\004 \003(\0132\014.ZPMet"
+  "a.Node\"\254\004\n\017MetaCmdResponse\022\032\n\004type\030\001 \002(\016"
+  "2\014.ZPMeta.Type\022 \n\004code\030\002 \002(\0162\022.ZPMeta.St"
+  "atusCode\022\013\n\003msg\030\003 \001(\t\022*\n\004ping\030\004 \001(\0132\034.ZP"
+  "Meta.MetaCmdResponse.Ping\022*\n\004pull\030\005 \001(\0132"
+  "\034.ZPMeta.MetaCmdResponse.Pull\0225\n\nlist_ta"
+  "ble\030\006 \001(\0132!.ZPMeta.MetaCmdResponse.ListT"
+  "able\0223\n\tlist_node\030\007 \001(\0132 .ZPMeta.MetaCmd"
+  "Response.ListNode\0223\n\tlist_meta\030\010 \001(\0132 .Z"
+  "PMeta.MetaCmdResponse.ListMeta\032\027\n\004Ping\022\017"
+  "\n\007version\030\001 \002(\005\0324\n\004Pull\022\017\n\007version\030\001 \002(\005"
+  "\022\033\n\004info\030\002 \003(\0132\r.ZPMeta.Table\032.\n\tListTab"
+  "le\022!\n\006tables\030\001 \001(\0132\021.ZPMeta.TableName\032(\n"
+  "\010ListNode\022\034\n\005nodes\030\001 \001(\0132\r.ZPMeta.Nodes\032"
+  ",\n\010ListMeta\022 \n\005nodes\030\001 \002(\0132\021.ZPMeta.Meta"
+  "Nodes*-\n\nStatusCode\022\006\n\002OK\020\000\022\014\n\010NOTFOUND\020"
+  "\001\022\t\n\005ERROR\020\002*\252\001\n\004Type\022\010\n\004PING\020\001\022\010\n\004PULL\020"
+  "\002\022\010\n\004INIT\020\003\022\r\n\tSETMASTER\020\004\022\014\n\010ADDSLAVE\020\005"
+  "\022\017\n\013REMOVESLAVE\020\006\022\r\n\tLISTTABLE\020\007\022\014\n\010LIST"
+  "NODE\020\010\022\014\n\010LISTMETA\020\t\022\r\n\tDROPTABLE\020\n\022\016\n\nM"
+  "ETASTATUS\020\013\022\014\n\010SETCHAIN\020\014*\037\n\006PState\022\n\n\006A"
+  "CTIVE\020\001\022\t\n\005STUCK\020\002"
+  ;
+static ::_pbi::once_flag descriptor_table_zp_5fmeta_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_zp_5fmeta_2eproto = {
+    false, false, 2338, descriptor_table_protodef_zp_5fmeta_2eproto,
+    "zp_meta.proto",
+    &descriptor_table_zp_5fmeta_2eproto_once, nullptr, 0, 24,
+    schemas, file_default_instances, TableStruct_zp_5fmeta_2eproto::offsets,
+    file_level_metadata_zp_5fmeta_2eproto, file_level_enum_descriptors_zp_5fmeta_2eproto,
+    file_level_service_descriptors_zp_5fmeta_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_zp_5fmeta_2eproto_getter() {
+  return &descriptor_table_zp_5fmeta_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_zp_5fmeta_2eproto(&descriptor_table_zp_5fmeta_2eproto);
+namespace ZPMeta {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_zp_5fmeta_2eproto);
+  return file_level_enum_descriptors_zp_5fmeta_2eproto[0];
 }
 bool StatusCode_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -723,12 +815,12 @@ bool StatusCode_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Type_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_zp_5fmeta_2eproto);
+  return file_level_enum_descriptors_zp_5fmeta_2eproto[1];
 }
 bool Type_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 1:
     case 2:
     case 3:
@@ -739,18 +831,20 @@ bool Type_IsValid(int value) {
     case 8:
     case 9:
     case 10:
+    case 11:
+    case 12:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* PState_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PState_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_zp_5fmeta_2eproto);
+  return file_level_enum_descriptors_zp_5fmeta_2eproto[2];
 }
 bool PState_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 1:
     case 2:
       return true;
@@ -762,6410 +856,6967 @@ bool PState_IsValid(int value) {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Node::kIpFieldNumber;
-const int Node::kPortFieldNumber;
-#endif  // !_MSC_VER
-
-Node::Node()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Node::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Node>()._impl_._has_bits_);
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void Node::InitAsDefaultInstance() {
+Node::Node(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.Node)
 }
-
 Node::Node(const Node& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Node::SharedCtor() {
-  _cached_size_ = 0;
-  ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  port_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Node* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.port_ = from._impl_.port_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.Node)
+}
+
+inline void Node::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){0}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Node::~Node() {
+  // @@protoc_insertion_point(destructor:ZPMeta.Node)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Node::SharedDtor() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Node::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
 void Node::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Node::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Node_descriptor_;
-}
-
-const Node& Node::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-Node* Node::default_instance_ = NULL;
-
-Node* Node::New() const {
-  return new Node;
+  _impl_._cached_size_.Set(size);
 }
 
 void Node::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_ip()) {
-      if (ip_ != &::google::protobuf::internal::kEmptyString) {
-        ip_->clear();
-      }
-    }
-    port_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Node::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.Node)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.ip_.ClearNonDefaultToEmpty();
+  }
+  _impl_.port_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Node::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string ip = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_ip()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->ip().data(), this->ip().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_port;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.Node.ip");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 port = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-          set_has_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Node::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Node::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.Node)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string ip = 1;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->ip().data(), this->ip().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->ip(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.Node.ip");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_ip(), target);
   }
 
   // required int32 port = 2;
-  if (has_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->port(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_port(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.Node)
+  return target;
 }
 
-::google::protobuf::uint8* Node::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string ip = 1;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->ip().data(), this->ip().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->ip(), target);
-  }
+size_t Node::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.Node)
+  size_t total_size = 0;
 
-  // required int32 port = 2;
-  if (has_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->port(), target);
+  if (_internal_has_ip()) {
+    // required string ip = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_port()) {
+    // required int32 port = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
-  return target;
-}
 
-int Node::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t Node::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.Node)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string ip = 1;
-    if (has_ip()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->ip());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
 
     // required int32 port = 2;
-    if (has_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->port());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
 
-void Node::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Node* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Node*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Node::MergeFrom(const Node& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_ip()) {
-      set_ip(from.ip());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Node::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Node::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Node::GetClassData() const { return &_class_data_; }
+
+
+void Node::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Node*>(&to_msg);
+  auto& from = static_cast<const Node&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.Node)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
     }
-    if (from.has_port()) {
-      set_port(from.port());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.port_ = from._impl_.port_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Node::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Node::CopyFrom(const Node& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.Node)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Node::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Node::Swap(Node* other) {
-  if (other != this) {
-    std::swap(ip_, other->ip_);
-    std::swap(port_, other->port_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Node::InternalSwap(Node* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  swap(_impl_.port_, other->_impl_.port_);
 }
 
-::google::protobuf::Metadata Node::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Node_descriptor_;
-  metadata.reflection = Node_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Node::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int NodeStatus::kNodeFieldNumber;
-const int NodeStatus::kStatusFieldNumber;
-#endif  // !_MSC_VER
+class NodeStatus::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NodeStatus>()._impl_._has_bits_);
+  static const ::ZPMeta::Node& node(const NodeStatus* msg);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-NodeStatus::NodeStatus()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Node&
+NodeStatus::_Internal::node(const NodeStatus* msg) {
+  return *msg->_impl_.node_;
 }
-
-void NodeStatus::InitAsDefaultInstance() {
-  node_ = const_cast< ::ZPMeta::Node*>(&::ZPMeta::Node::default_instance());
+NodeStatus::NodeStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.NodeStatus)
 }
-
 NodeStatus::NodeStatus(const NodeStatus& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void NodeStatus::SharedCtor() {
-  _cached_size_ = 0;
-  node_ = NULL;
-  status_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::ZPMeta::Node(*from._impl_.node_);
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.NodeStatus)
+}
+
+inline void NodeStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.status_){0}
+  };
 }
 
 NodeStatus::~NodeStatus() {
+  // @@protoc_insertion_point(destructor:ZPMeta.NodeStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NodeStatus::SharedDtor() {
-  if (this != default_instance_) {
-    delete node_;
-  }
+inline void NodeStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.node_;
 }
 
 void NodeStatus::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* NodeStatus::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NodeStatus_descriptor_;
-}
-
-const NodeStatus& NodeStatus::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-NodeStatus* NodeStatus::default_instance_ = NULL;
-
-NodeStatus* NodeStatus::New() const {
-  return new NodeStatus;
+  _impl_._cached_size_.Set(size);
 }
 
 void NodeStatus::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_node()) {
-      if (node_ != NULL) node_->::ZPMeta::Node::Clear();
-    }
-    status_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool NodeStatus::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.NodeStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.node_ != nullptr);
+    _impl_.node_->Clear();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.Node node = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_node()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_status;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 status = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_status:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &status_)));
-          set_has_status();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void NodeStatus::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_status(&has_bits);
+          _impl_.status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.NodeStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.Node node = 1;
-  if (has_node()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->node(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
   }
 
   // required int32 status = 2;
-  if (has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->status(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_status(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.NodeStatus)
+  return target;
 }
 
-::google::protobuf::uint8* NodeStatus::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .ZPMeta.Node node = 1;
-  if (has_node()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->node(), target);
-  }
+size_t NodeStatus::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.NodeStatus)
+  size_t total_size = 0;
 
-  // required int32 status = 2;
-  if (has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->status(), target);
+  if (_internal_has_node()) {
+    // required .ZPMeta.Node node = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_status()) {
+    // required int32 status = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_status());
   }
-  return target;
-}
 
-int NodeStatus::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t NodeStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.NodeStatus)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required .ZPMeta.Node node = 1;
-    if (has_node()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->node());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
 
     // required int32 status = 2;
-    if (has_status()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->status());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_status());
 
-void NodeStatus::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const NodeStatus* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const NodeStatus*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NodeStatus::MergeFrom(const NodeStatus& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_node()) {
-      mutable_node()->::ZPMeta::Node::MergeFrom(from.node());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeStatus::GetClassData() const { return &_class_data_; }
+
+
+void NodeStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeStatus*>(&to_msg);
+  auto& from = static_cast<const NodeStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.NodeStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_node()->::ZPMeta::Node::MergeFrom(
+          from._internal_node());
     }
-    if (from.has_status()) {
-      set_status(from.status());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.status_ = from._impl_.status_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void NodeStatus::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NodeStatus::CopyFrom(const NodeStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.NodeStatus)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool NodeStatus::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
-  if (has_node()) {
-    if (!this->node().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_node()) {
+    if (!_impl_.node_->IsInitialized()) return false;
   }
   return true;
 }
 
-void NodeStatus::Swap(NodeStatus* other) {
-  if (other != this) {
-    std::swap(node_, other->node_);
-    std::swap(status_, other->status_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void NodeStatus::InternalSwap(NodeStatus* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.status_)
+      + sizeof(NodeStatus::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.node_)>(
+          reinterpret_cast<char*>(&_impl_.node_),
+          reinterpret_cast<char*>(&other->_impl_.node_));
 }
 
-::google::protobuf::Metadata NodeStatus::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = NodeStatus_descriptor_;
-  metadata.reflection = NodeStatus_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata NodeStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Nodes::kNodesFieldNumber;
-#endif  // !_MSC_VER
-
-Nodes::Nodes()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Nodes::_Internal {
+ public:
+};
 
-void Nodes::InitAsDefaultInstance() {
+Nodes::Nodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.Nodes)
 }
-
 Nodes::Nodes(const Nodes& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Nodes::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Nodes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){from._impl_.nodes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.Nodes)
+}
+
+inline void Nodes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Nodes::~Nodes() {
+  // @@protoc_insertion_point(destructor:ZPMeta.Nodes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Nodes::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Nodes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
 }
 
 void Nodes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Nodes::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Nodes_descriptor_;
-}
-
-const Nodes& Nodes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-Nodes* Nodes::default_instance_ = NULL;
-
-Nodes* Nodes::New() const {
-  return new Nodes;
+  _impl_._cached_size_.Set(size);
 }
 
 void Nodes::Clear() {
-  nodes_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
+// @@protoc_insertion_point(message_clear_start:ZPMeta.Nodes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool Nodes::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .ZPMeta.NodeStatus nodes = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_nodes:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_nodes()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_nodes;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+  _impl_.nodes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Nodes::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated .ZPMeta.NodeStatus nodes = 1;
-  for (int i = 0; i < this->nodes_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->nodes(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+const char* Nodes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ZPMeta.NodeStatus nodes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Nodes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.Nodes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* Nodes::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
   // repeated .ZPMeta.NodeStatus nodes = 1;
-  for (int i = 0; i < this->nodes_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->nodes(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.Nodes)
   return target;
 }
 
-int Nodes::ByteSize() const {
-  int total_size = 0;
+size_t Nodes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.Nodes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .ZPMeta.NodeStatus nodes = 1;
-  total_size += 1 * this->nodes_size();
-  for (int i = 0; i < this->nodes_size(); i++) {
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->nodes(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Nodes::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Nodes* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Nodes*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Nodes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Nodes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Nodes::GetClassData() const { return &_class_data_; }
 
-void Nodes::MergeFrom(const Nodes& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  nodes_.MergeFrom(from.nodes_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void Nodes::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Nodes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Nodes*>(&to_msg);
+  auto& from = static_cast<const Nodes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.Nodes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Nodes::CopyFrom(const Nodes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.Nodes)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Nodes::IsInitialized() const {
-
-  for (int i = 0; i < nodes_size(); i++) {
-    if (!this->nodes(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.nodes_))
+    return false;
   return true;
 }
 
-void Nodes::Swap(Nodes* other) {
-  if (other != this) {
-    nodes_.Swap(&other->nodes_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Nodes::InternalSwap(Nodes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
 }
 
-::google::protobuf::Metadata Nodes::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Nodes_descriptor_;
-  metadata.reflection = Nodes_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Nodes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[2]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int MetaNodes::kFollowersFieldNumber;
-const int MetaNodes::kLeaderFieldNumber;
-#endif  // !_MSC_VER
+class MetaNodes::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaNodes>()._impl_._has_bits_);
+  static const ::ZPMeta::Node& leader(const MetaNodes* msg);
+  static void set_has_leader(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-MetaNodes::MetaNodes()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Node&
+MetaNodes::_Internal::leader(const MetaNodes* msg) {
+  return *msg->_impl_.leader_;
 }
-
-void MetaNodes::InitAsDefaultInstance() {
-  leader_ = const_cast< ::ZPMeta::Node*>(&::ZPMeta::Node::default_instance());
+MetaNodes::MetaNodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaNodes)
 }
-
 MetaNodes::MetaNodes(const MetaNodes& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaNodes::SharedCtor() {
-  _cached_size_ = 0;
-  leader_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaNodes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.followers_){from._impl_.followers_}
+    , decltype(_impl_.leader_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_leader()) {
+    _this->_impl_.leader_ = new ::ZPMeta::Node(*from._impl_.leader_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaNodes)
+}
+
+inline void MetaNodes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.followers_){arena}
+    , decltype(_impl_.leader_){nullptr}
+  };
 }
 
 MetaNodes::~MetaNodes() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaNodes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaNodes::SharedDtor() {
-  if (this != default_instance_) {
-    delete leader_;
-  }
+inline void MetaNodes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.followers_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.leader_;
 }
 
 void MetaNodes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaNodes::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaNodes_descriptor_;
-}
-
-const MetaNodes& MetaNodes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaNodes* MetaNodes::default_instance_ = NULL;
-
-MetaNodes* MetaNodes::New() const {
-  return new MetaNodes;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaNodes::Clear() {
-  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (has_leader()) {
-      if (leader_ != NULL) leader_->::ZPMeta::Node::Clear();
-    }
-  }
-  followers_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaNodes::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaNodes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.followers_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.leader_ != nullptr);
+    _impl_.leader_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaNodes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .ZPMeta.Node followers = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_followers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_followers()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_followers;
-        if (input->ExpectTag(18)) goto parse_leader;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_followers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.Node leader = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_leader:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_leader()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_leader(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaNodes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaNodes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaNodes::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .ZPMeta.Node followers = 1;
-  for (int i = 0; i < this->followers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->followers(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_followers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_followers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .ZPMeta.Node leader = 2;
-  if (has_leader()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->leader(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::leader(this),
+        _Internal::leader(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* MetaNodes::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .ZPMeta.Node followers = 1;
-  for (int i = 0; i < this->followers_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->followers(i), target);
-  }
-
-  // optional .ZPMeta.Node leader = 2;
-  if (has_leader()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->leader(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaNodes)
   return target;
 }
 
-int MetaNodes::ByteSize() const {
-  int total_size = 0;
+size_t MetaNodes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaNodes)
+  size_t total_size = 0;
 
-  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    // optional .ZPMeta.Node leader = 2;
-    if (has_leader()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->leader());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  }
   // repeated .ZPMeta.Node followers = 1;
-  total_size += 1 * this->followers_size();
-  for (int i = 0; i < this->followers_size(); i++) {
+  total_size += 1UL * this->_internal_followers_size();
+  for (const auto& msg : this->_impl_.followers_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->followers(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional .ZPMeta.Node leader = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.leader_);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MetaNodes::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaNodes* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaNodes*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaNodes::MergeFrom(const MetaNodes& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  followers_.MergeFrom(from.followers_);
-  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (from.has_leader()) {
-      mutable_leader()->::ZPMeta::Node::MergeFrom(from.leader());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaNodes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaNodes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaNodes::GetClassData() const { return &_class_data_; }
 
-void MetaNodes::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void MetaNodes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaNodes*>(&to_msg);
+  auto& from = static_cast<const MetaNodes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaNodes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.followers_.MergeFrom(from._impl_.followers_);
+  if (from._internal_has_leader()) {
+    _this->_internal_mutable_leader()->::ZPMeta::Node::MergeFrom(
+        from._internal_leader());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaNodes::CopyFrom(const MetaNodes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaNodes)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaNodes::IsInitialized() const {
-
-  for (int i = 0; i < followers_size(); i++) {
-    if (!this->followers(i).IsInitialized()) return false;
-  }
-  if (has_leader()) {
-    if (!this->leader().IsInitialized()) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.followers_))
+    return false;
+  if (_internal_has_leader()) {
+    if (!_impl_.leader_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaNodes::Swap(MetaNodes* other) {
-  if (other != this) {
-    followers_.Swap(&other->followers_);
-    std::swap(leader_, other->leader_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaNodes::InternalSwap(MetaNodes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.followers_.InternalSwap(&other->_impl_.followers_);
+  swap(_impl_.leader_, other->_impl_.leader_);
 }
 
-::google::protobuf::Metadata MetaNodes::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaNodes_descriptor_;
-  metadata.reflection = MetaNodes_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaNodes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[3]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Partitions::kIdFieldNumber;
-const int Partitions::kStateFieldNumber;
-const int Partitions::kMasterFieldNumber;
-const int Partitions::kSlavesFieldNumber;
-#endif  // !_MSC_VER
+class Partitions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Partitions>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::ZPMeta::Node& master(const Partitions* msg);
+  static void set_has_master(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_chain(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000b) ^ 0x0000000b) != 0;
+  }
+};
 
-Partitions::Partitions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Node&
+Partitions::_Internal::master(const Partitions* msg) {
+  return *msg->_impl_.master_;
 }
-
-void Partitions::InitAsDefaultInstance() {
-  master_ = const_cast< ::ZPMeta::Node*>(&::ZPMeta::Node::default_instance());
+Partitions::Partitions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.Partitions)
 }
-
 Partitions::Partitions(const Partitions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Partitions::SharedCtor() {
-  _cached_size_ = 0;
-  id_ = 0;
-  state_ = 1;
-  master_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Partitions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slaves_){from._impl_.slaves_}
+    , decltype(_impl_.learners_){from._impl_.learners_}
+    , decltype(_impl_.master_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.chain_){}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_master()) {
+    _this->_impl_.master_ = new ::ZPMeta::Node(*from._impl_.master_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.state_));
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.Partitions)
+}
+
+inline void Partitions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slaves_){arena}
+    , decltype(_impl_.learners_){arena}
+    , decltype(_impl_.master_){nullptr}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.chain_){false}
+    , decltype(_impl_.state_){1}
+  };
 }
 
 Partitions::~Partitions() {
+  // @@protoc_insertion_point(destructor:ZPMeta.Partitions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Partitions::SharedDtor() {
-  if (this != default_instance_) {
-    delete master_;
-  }
+inline void Partitions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slaves_.~RepeatedPtrField();
+  _impl_.learners_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.master_;
 }
 
 void Partitions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Partitions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Partitions_descriptor_;
-}
-
-const Partitions& Partitions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-Partitions* Partitions::default_instance_ = NULL;
-
-Partitions* Partitions::New() const {
-  return new Partitions;
+  _impl_._cached_size_.Set(size);
 }
 
 void Partitions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    id_ = 0;
-    state_ = 1;
-    if (has_master()) {
-      if (master_ != NULL) master_->::ZPMeta::Node::Clear();
-    }
-  }
-  slaves_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Partitions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.Partitions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slaves_.Clear();
+  _impl_.learners_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.master_ != nullptr);
+    _impl_.master_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.chain_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.chain_));
+    _impl_.state_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Partitions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_state;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .ZPMeta.PState state = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_state:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::ZPMeta::PState_IsValid(value)) {
-            set_state(static_cast< ::ZPMeta::PState >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ZPMeta::PState_IsValid(val))) {
+            _internal_set_state(static_cast<::ZPMeta::PState>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_master;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required .ZPMeta.Node master = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_master:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_master()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_slaves;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_master(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .ZPMeta.Node slaves = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_slaves:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_slaves()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_slaves;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Partitions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slaves(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool chain = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_chain(&has_bits);
+          _impl_.chain_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ZPMeta.Node learners = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_learners(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Partitions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.Partitions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 id = 1;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
   // required .ZPMeta.PState state = 2;
-  if (has_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->state(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_state(), target);
   }
 
   // required .ZPMeta.Node master = 3;
-  if (has_master()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->master(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::master(this),
+        _Internal::master(this).GetCachedSize(), target, stream);
   }
 
   // repeated .ZPMeta.Node slaves = 4;
-  for (int i = 0; i < this->slaves_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->slaves(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slaves_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slaves(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional bool chain = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_chain(), target);
   }
-}
 
-::google::protobuf::uint8* Partitions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 id = 1;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->id(), target);
+  // repeated .ZPMeta.Node learners = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_learners_size()); i < n; i++) {
+    const auto& repfield = this->_internal_learners(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // required .ZPMeta.PState state = 2;
-  if (has_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->state(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.Partitions)
+  return target;
+}
 
-  // required .ZPMeta.Node master = 3;
-  if (has_master()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->master(), target);
+size_t Partitions::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.Partitions)
+  size_t total_size = 0;
+
+  if (_internal_has_master()) {
+    // required .ZPMeta.Node master = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_);
   }
 
-  // repeated .ZPMeta.Node slaves = 4;
-  for (int i = 0; i < this->slaves_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->slaves(i), target);
+  if (_internal_has_id()) {
+    // required int32 id = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_state()) {
+    // required .ZPMeta.PState state = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
   }
-  return target;
+
+  return total_size;
 }
+size_t Partitions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.Partitions)
+  size_t total_size = 0;
 
-int Partitions::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x0000000b) ^ 0x0000000b) == 0) {  // All required fields are present.
+    // required .ZPMeta.Node master = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_);
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required int32 id = 1;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->id());
-    }
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
 
     // required .ZPMeta.PState state = 2;
-    if (has_state()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->state());
-    }
-
-    // required .ZPMeta.Node master = 3;
-    if (has_master()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->master());
-    }
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .ZPMeta.Node slaves = 4;
-  total_size += 1 * this->slaves_size();
-  for (int i = 0; i < this->slaves_size(); i++) {
+  total_size += 1UL * this->_internal_slaves_size();
+  for (const auto& msg : this->_impl_.slaves_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->slaves(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
+  // repeated .ZPMeta.Node learners = 6;
+  total_size += 1UL * this->_internal_learners_size();
+  for (const auto& msg : this->_impl_.learners_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Partitions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Partitions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Partitions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // optional bool chain = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Partitions::MergeFrom(const Partitions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  slaves_.MergeFrom(from.slaves_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_id()) {
-      set_id(from.id());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Partitions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Partitions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Partitions::GetClassData() const { return &_class_data_; }
+
+
+void Partitions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Partitions*>(&to_msg);
+  auto& from = static_cast<const Partitions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.Partitions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slaves_.MergeFrom(from._impl_.slaves_);
+  _this->_impl_.learners_.MergeFrom(from._impl_.learners_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_master()->::ZPMeta::Node::MergeFrom(
+          from._internal_master());
     }
-    if (from.has_state()) {
-      set_state(from.state());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
-    if (from.has_master()) {
-      mutable_master()->::ZPMeta::Node::MergeFrom(from.master());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.chain_ = from._impl_.chain_;
     }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Partitions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Partitions::CopyFrom(const Partitions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.Partitions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Partitions::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
-  if (has_master()) {
-    if (!this->master().IsInitialized()) return false;
-  }
-  for (int i = 0; i < slaves_size(); i++) {
-    if (!this->slaves(i).IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.slaves_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.learners_))
+    return false;
+  if (_internal_has_master()) {
+    if (!_impl_.master_->IsInitialized()) return false;
   }
   return true;
 }
 
-void Partitions::Swap(Partitions* other) {
-  if (other != this) {
-    std::swap(id_, other->id_);
-    std::swap(state_, other->state_);
-    std::swap(master_, other->master_);
-    slaves_.Swap(&other->slaves_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Partitions::InternalSwap(Partitions* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.slaves_.InternalSwap(&other->_impl_.slaves_);
+  _impl_.learners_.InternalSwap(&other->_impl_.learners_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Partitions, _impl_.chain_)
+      + sizeof(Partitions::_impl_.chain_)
+      - PROTOBUF_FIELD_OFFSET(Partitions, _impl_.master_)>(
+          reinterpret_cast<char*>(&_impl_.master_),
+          reinterpret_cast<char*>(&other->_impl_.master_));
+  swap(_impl_.state_, other->_impl_.state_);
 }
 
-::google::protobuf::Metadata Partitions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Partitions_descriptor_;
-  metadata.reflection = Partitions_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Partitions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[4]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int TableName::kNameFieldNumber;
-#endif  // !_MSC_VER
+class TableName::_Internal {
+ public:
+};
 
-TableName::TableName()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+TableName::TableName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.TableName)
 }
-
-void TableName::InitAsDefaultInstance() {
-}
-
 TableName::TableName(const TableName& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void TableName::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableName* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){from._impl_.name_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.TableName)
+}
+
+inline void TableName::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TableName::~TableName() {
+  // @@protoc_insertion_point(destructor:ZPMeta.TableName)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TableName::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void TableName::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.~RepeatedPtrField();
 }
 
 void TableName::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* TableName::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return TableName_descriptor_;
-}
-
-const TableName& TableName::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-TableName* TableName::default_instance_ = NULL;
-
-TableName* TableName::New() const {
-  return new TableName;
+  _impl_._cached_size_.Set(size);
 }
 
 void TableName::Clear() {
-  name_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
+// @@protoc_insertion_point(message_clear_start:ZPMeta.TableName)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool TableName::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name(this->name_size() - 1).data(),
-            this->name(this->name_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_name;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+  _impl_.name_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TableName::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated string name = 1;
-  for (int i = 0; i < this->name_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->name(i).data(), this->name(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+const char* TableName::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "ZPMeta.TableName.name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TableName::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.TableName)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* TableName::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
   // repeated string name = 1;
-  for (int i = 0; i < this->name_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name(i).data(), this->name(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(1, this->name(i), target);
+  for (int i = 0, n = this->_internal_name_size(); i < n; i++) {
+    const auto& s = this->_internal_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.TableName.name");
+    target = stream->WriteString(1, s, target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.TableName)
   return target;
 }
 
-int TableName::ByteSize() const {
-  int total_size = 0;
+size_t TableName::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.TableName)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated string name = 1;
-  total_size += 1 * this->name_size();
-  for (int i = 0; i < this->name_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->name(i));
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.name_.size());
+  for (int i = 0, n = _impl_.name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.name_.Get(i));
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TableName::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const TableName* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const TableName*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableName::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TableName::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableName::GetClassData() const { return &_class_data_; }
 
-void TableName::MergeFrom(const TableName& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  name_.MergeFrom(from.name_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void TableName::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void TableName::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TableName*>(&to_msg);
+  auto& from = static_cast<const TableName&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.TableName)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.name_.MergeFrom(from._impl_.name_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TableName::CopyFrom(const TableName& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.TableName)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool TableName::IsInitialized() const {
-
   return true;
 }
 
-void TableName::Swap(TableName* other) {
-  if (other != this) {
-    name_.Swap(&other->name_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void TableName::InternalSwap(TableName* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.name_.InternalSwap(&other->_impl_.name_);
 }
 
-::google::protobuf::Metadata TableName::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = TableName_descriptor_;
-  metadata.reflection = TableName_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata TableName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Table::kNameFieldNumber;
-const int Table::kPartitionsFieldNumber;
-#endif  // !_MSC_VER
-
-Table::Table()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Table::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void Table::InitAsDefaultInstance() {
+Table::Table(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.Table)
 }
-
 Table::Table(const Table& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Table::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.partitions_){from._impl_.partitions_}
+    , decltype(_impl_.name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.Table)
+}
+
+inline void Table::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.partitions_){arena}
+    , decltype(_impl_.name_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Table::~Table() {
+  // @@protoc_insertion_point(destructor:ZPMeta.Table)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Table::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Table::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.partitions_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
 void Table::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Table::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Table_descriptor_;
-}
-
-const Table& Table::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-Table* Table::default_instance_ = NULL;
-
-Table* Table::New() const {
-  return new Table;
+  _impl_._cached_size_.Set(size);
 }
 
 void Table::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-  }
-  partitions_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Table::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.Table)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.partitions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_partitions;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.Table.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .ZPMeta.Partitions partitions = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_partitions:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_partitions()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_partitions;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Table::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_partitions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.Table)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.Table.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // repeated .ZPMeta.Partitions partitions = 2;
-  for (int i = 0; i < this->partitions_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->partitions(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_partitions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_partitions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.Table)
+  return target;
 }
 
-::google::protobuf::uint8* Table::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t Table::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.Table)
+  size_t total_size = 0;
+
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .ZPMeta.Partitions partitions = 2;
-  for (int i = 0; i < this->partitions_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->partitions(i), target);
+  total_size += 1UL * this->_internal_partitions_size();
+  for (const auto& msg : this->_impl_.partitions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int Table::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
-
-  }
-  // repeated .ZPMeta.Partitions partitions = 2;
-  total_size += 1 * this->partitions_size();
-  for (int i = 0; i < this->partitions_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->partitions(i));
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table::GetClassData() const { return &_class_data_; }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Table::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Table* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Table*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void Table::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table*>(&to_msg);
+  auto& from = static_cast<const Table&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.Table)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Table::MergeFrom(const Table& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  partitions_.MergeFrom(from.partitions_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
-    }
+  _this->_impl_.partitions_.MergeFrom(from._impl_.partitions_);
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Table::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Table::CopyFrom(const Table& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.Table)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Table::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  for (int i = 0; i < partitions_size(); i++) {
-    if (!this->partitions(i).IsInitialized()) return false;
-  }
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.partitions_))
+    return false;
   return true;
 }
 
-void Table::Swap(Table* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    partitions_.Swap(&other->partitions_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Table::InternalSwap(Table* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.partitions_.InternalSwap(&other->_impl_.partitions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata Table::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Table_descriptor_;
-  metadata.reflection = Table_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Table::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[6]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int BasicCmdUnit::kNameFieldNumber;
-const int BasicCmdUnit::kPartitionFieldNumber;
-const int BasicCmdUnit::kNodeFieldNumber;
-#endif  // !_MSC_VER
+class BasicCmdUnit::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BasicCmdUnit>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::ZPMeta::Node& node(const BasicCmdUnit* msg);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-BasicCmdUnit::BasicCmdUnit()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Node&
+BasicCmdUnit::_Internal::node(const BasicCmdUnit* msg) {
+  return *msg->_impl_.node_;
 }
-
-void BasicCmdUnit::InitAsDefaultInstance() {
-  node_ = const_cast< ::ZPMeta::Node*>(&::ZPMeta::Node::default_instance());
+BasicCmdUnit::BasicCmdUnit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.BasicCmdUnit)
 }
-
 BasicCmdUnit::BasicCmdUnit(const BasicCmdUnit& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void BasicCmdUnit::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_ = 0;
-  node_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BasicCmdUnit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.partition_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::ZPMeta::Node(*from._impl_.node_);
+  }
+  _this->_impl_.partition_ = from._impl_.partition_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.BasicCmdUnit)
+}
+
+inline void BasicCmdUnit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.partition_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BasicCmdUnit::~BasicCmdUnit() {
+  // @@protoc_insertion_point(destructor:ZPMeta.BasicCmdUnit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BasicCmdUnit::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-    delete node_;
-  }
+inline void BasicCmdUnit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.node_;
 }
 
 void BasicCmdUnit::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* BasicCmdUnit::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return BasicCmdUnit_descriptor_;
-}
-
-const BasicCmdUnit& BasicCmdUnit::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-BasicCmdUnit* BasicCmdUnit::default_instance_ = NULL;
-
-BasicCmdUnit* BasicCmdUnit::New() const {
-  return new BasicCmdUnit;
+  _impl_._cached_size_.Set(size);
 }
 
 void BasicCmdUnit::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:ZPMeta.BasicCmdUnit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
     }
-    partition_ = 0;
-    if (has_node()) {
-      if (node_ != NULL) node_->::ZPMeta::Node::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.node_ != nullptr);
+      _impl_.node_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_.partition_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool BasicCmdUnit::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* BasicCmdUnit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_partition;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.BasicCmdUnit.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 partition = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_)));
-          set_has_partition();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_node;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition(&has_bits);
+          _impl_.partition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .ZPMeta.Node node = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_node:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_node()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void BasicCmdUnit::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BasicCmdUnit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.BasicCmdUnit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.BasicCmdUnit.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // required int32 partition = 2;
-  if (has_partition()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition(), target);
   }
 
   // required .ZPMeta.Node node = 3;
-  if (has_node()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->node(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.BasicCmdUnit)
+  return target;
 }
 
-::google::protobuf::uint8* BasicCmdUnit::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
+size_t BasicCmdUnit::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.BasicCmdUnit)
+  size_t total_size = 0;
 
-  // required int32 partition = 2;
-  if (has_partition()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition(), target);
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // required .ZPMeta.Node node = 3;
-  if (has_node()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->node(), target);
+  if (_internal_has_node()) {
+    // required .ZPMeta.Node node = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_partition()) {
+    // required int32 partition = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
   }
-  return target;
-}
 
-int BasicCmdUnit::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t BasicCmdUnit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.BasicCmdUnit)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
     // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
-
-    // required int32 partition = 2;
-    if (has_partition()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
 
     // required .ZPMeta.Node node = 3;
-    if (has_node()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->node());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // required int32 partition = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
 
-void BasicCmdUnit::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const BasicCmdUnit* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const BasicCmdUnit*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BasicCmdUnit::MergeFrom(const BasicCmdUnit& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BasicCmdUnit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BasicCmdUnit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BasicCmdUnit::GetClassData() const { return &_class_data_; }
+
+
+void BasicCmdUnit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BasicCmdUnit*>(&to_msg);
+  auto& from = static_cast<const BasicCmdUnit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.BasicCmdUnit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_partition()) {
-      set_partition(from.partition());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_node()->::ZPMeta::Node::MergeFrom(
+          from._internal_node());
     }
-    if (from.has_node()) {
-      mutable_node()->::ZPMeta::Node::MergeFrom(from.node());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.partition_ = from._impl_.partition_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void BasicCmdUnit::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BasicCmdUnit::CopyFrom(const BasicCmdUnit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.BasicCmdUnit)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool BasicCmdUnit::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
-  if (has_node()) {
-    if (!this->node().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_node()) {
+    if (!_impl_.node_->IsInitialized()) return false;
   }
   return true;
 }
 
-void BasicCmdUnit::Swap(BasicCmdUnit* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(partition_, other->partition_);
-    std::swap(node_, other->node_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void BasicCmdUnit::InternalSwap(BasicCmdUnit* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BasicCmdUnit, _impl_.partition_)
+      + sizeof(BasicCmdUnit::_impl_.partition_)
+      - PROTOBUF_FIELD_OFFSET(BasicCmdUnit, _impl_.node_)>(
+          reinterpret_cast<char*>(&_impl_.node_),
+          reinterpret_cast<char*>(&other->_impl_.node_));
 }
 
-::google::protobuf::Metadata BasicCmdUnit::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = BasicCmdUnit_descriptor_;
-  metadata.reflection = BasicCmdUnit_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata BasicCmdUnit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[7]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SyncOffset::kTableNameFieldNumber;
-const int SyncOffset::kPartitionFieldNumber;
-const int SyncOffset::kFilenumFieldNumber;
-const int SyncOffset::kOffsetFieldNumber;
-#endif  // !_MSC_VER
-
-SyncOffset::SyncOffset()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class SyncOffset::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncOffset>()._impl_._has_bits_);
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_filenum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void SyncOffset::InitAsDefaultInstance() {
+SyncOffset::SyncOffset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.SyncOffset)
 }
-
 SyncOffset::SyncOffset(const SyncOffset& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SyncOffset::SharedCtor() {
-  _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_ = 0;
-  filenum_ = 0;
-  offset_ = GOOGLE_LONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncOffset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_){}
+    , decltype(_impl_.filenum_){}
+    , decltype(_impl_.offset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.partition_, &from._impl_.partition_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.partition_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.SyncOffset)
+}
+
+inline void SyncOffset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.partition_){0}
+    , decltype(_impl_.filenum_){0}
+    , decltype(_impl_.offset_){int64_t{0}}
+  };
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SyncOffset::~SyncOffset() {
+  // @@protoc_insertion_point(destructor:ZPMeta.SyncOffset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SyncOffset::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void SyncOffset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_name_.Destroy();
 }
 
 void SyncOffset::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SyncOffset::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SyncOffset_descriptor_;
-}
-
-const SyncOffset& SyncOffset::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-SyncOffset* SyncOffset::default_instance_ = NULL;
-
-SyncOffset* SyncOffset::New() const {
-  return new SyncOffset;
+  _impl_._cached_size_.Set(size);
 }
 
 void SyncOffset::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
-    }
-    partition_ = 0;
-    filenum_ = 0;
-    offset_ = GOOGLE_LONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SyncOffset::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.SyncOffset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.table_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.partition_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.offset_) -
+        reinterpret_cast<char*>(&_impl_.partition_)) + sizeof(_impl_.offset_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncOffset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string table_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_partition;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.SyncOffset.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 partition = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_)));
-          set_has_partition();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_filenum;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition(&has_bits);
+          _impl_.partition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 filenum = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_filenum:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &filenum_)));
-          set_has_filenum();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_offset;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_filenum(&has_bits);
+          _impl_.filenum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int64 offset = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_offset:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &offset_)));
-          set_has_offset();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SyncOffset::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncOffset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.SyncOffset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.SyncOffset.table_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_table_name(), target);
   }
 
   // required int32 partition = 2;
-  if (has_partition()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition(), target);
   }
 
   // optional int32 filenum = 3;
-  if (has_filenum()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->filenum(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_filenum(), target);
   }
 
   // optional int64 offset = 4;
-  if (has_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(4, this->offset(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_offset(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.SyncOffset)
+  return target;
 }
 
-::google::protobuf::uint8* SyncOffset::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
-  }
-
-  // required int32 partition = 2;
-  if (has_partition()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition(), target);
-  }
+size_t SyncOffset::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.SyncOffset)
+  size_t total_size = 0;
 
-  // optional int32 filenum = 3;
-  if (has_filenum()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->filenum(), target);
+  if (_internal_has_table_name()) {
+    // required string table_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
   }
 
-  // optional int64 offset = 4;
-  if (has_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(4, this->offset(), target);
+  if (_internal_has_partition()) {
+    // required int32 partition = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t SyncOffset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.SyncOffset)
+  size_t total_size = 0;
 
-int SyncOffset::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required string table_name = 1;
-    if (has_table_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
 
     // required int32 partition = 2;
-    if (has_partition()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition());
-    }
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
     // optional int32 filenum = 3;
-    if (has_filenum()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->filenum());
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_filenum());
     }
 
     // optional int64 offset = 4;
-    if (has_offset()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->offset());
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SyncOffset::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SyncOffset* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SyncOffset*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncOffset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncOffset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncOffset::GetClassData() const { return &_class_data_; }
+
 
-void SyncOffset::MergeFrom(const SyncOffset& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+void SyncOffset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncOffset*>(&to_msg);
+  auto& from = static_cast<const SyncOffset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.SyncOffset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_table_name(from._internal_table_name());
     }
-    if (from.has_partition()) {
-      set_partition(from.partition());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_ = from._impl_.partition_;
     }
-    if (from.has_filenum()) {
-      set_filenum(from.filenum());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.filenum_ = from._impl_.filenum_;
     }
-    if (from.has_offset()) {
-      set_offset(from.offset());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SyncOffset::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SyncOffset::CopyFrom(const SyncOffset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.SyncOffset)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SyncOffset::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SyncOffset::Swap(SyncOffset* other) {
-  if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(partition_, other->partition_);
-    std::swap(filenum_, other->filenum_);
-    std::swap(offset_, other->offset_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SyncOffset::InternalSwap(SyncOffset* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncOffset, _impl_.offset_)
+      + sizeof(SyncOffset::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(SyncOffset, _impl_.partition_)>(
+          reinterpret_cast<char*>(&_impl_.partition_),
+          reinterpret_cast<char*>(&other->_impl_.partition_));
 }
 
-::google::protobuf::Metadata SyncOffset::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SyncOffset_descriptor_;
-  metadata.reflection = SyncOffset_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SyncOffset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[8]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int MetaCmd_Ping::kVersionFieldNumber;
-const int MetaCmd_Ping::kNodeFieldNumber;
-const int MetaCmd_Ping::kOffsetFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd_Ping::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_Ping>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::ZPMeta::Node& node(const MetaCmd_Ping* msg);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-MetaCmd_Ping::MetaCmd_Ping()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Node&
+MetaCmd_Ping::_Internal::node(const MetaCmd_Ping* msg) {
+  return *msg->_impl_.node_;
 }
-
-void MetaCmd_Ping::InitAsDefaultInstance() {
-  node_ = const_cast< ::ZPMeta::Node*>(&::ZPMeta::Node::default_instance());
+MetaCmd_Ping::MetaCmd_Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.Ping)
 }
-
 MetaCmd_Ping::MetaCmd_Ping(const MetaCmd_Ping& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmd_Ping::SharedCtor() {
-  _cached_size_ = 0;
-  version_ = 0;
-  node_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_Ping* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){from._impl_.offset_}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::ZPMeta::Node(*from._impl_.node_);
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.Ping)
+}
+
+inline void MetaCmd_Ping::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){arena}
+    , decltype(_impl_.node_){nullptr}
+    , decltype(_impl_.version_){0}
+  };
 }
 
 MetaCmd_Ping::~MetaCmd_Ping() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.Ping)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmd_Ping::SharedDtor() {
-  if (this != default_instance_) {
-    delete node_;
-  }
+inline void MetaCmd_Ping::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.offset_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.node_;
 }
 
 void MetaCmd_Ping::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmd_Ping::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_Ping_descriptor_;
-}
-
-const MetaCmd_Ping& MetaCmd_Ping::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmd_Ping* MetaCmd_Ping::default_instance_ = NULL;
-
-MetaCmd_Ping* MetaCmd_Ping::New() const {
-  return new MetaCmd_Ping;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmd_Ping::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    version_ = 0;
-    if (has_node()) {
-      if (node_ != NULL) node_->::ZPMeta::Node::Clear();
-    }
-  }
-  offset_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmd_Ping::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.Ping)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.offset_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.node_ != nullptr);
+    _impl_.node_->Clear();
+  }
+  _impl_.version_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd_Ping::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 version = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &version_)));
-          set_has_version();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_node;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .ZPMeta.Node node = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_node:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_node()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_offset;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .ZPMeta.SyncOffset offset = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_offset()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_offset;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd_Ping::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_offset(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_Ping::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.Ping)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 version = 1;
-  if (has_version()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->version(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
   }
 
   // required .ZPMeta.Node node = 2;
-  if (has_node()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->node(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
   }
 
   // repeated .ZPMeta.SyncOffset offset = 3;
-  for (int i = 0; i < this->offset_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->offset(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_offset_size()); i < n; i++) {
+    const auto& repfield = this->_internal_offset(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.Ping)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmd_Ping::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 version = 1;
-  if (has_version()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->version(), target);
-  }
+size_t MetaCmd_Ping::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.MetaCmd.Ping)
+  size_t total_size = 0;
 
-  // required .ZPMeta.Node node = 2;
-  if (has_node()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->node(), target);
+  if (_internal_has_node()) {
+    // required .ZPMeta.Node node = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
   }
 
-  // repeated .ZPMeta.SyncOffset offset = 3;
-  for (int i = 0; i < this->offset_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->offset(i), target);
+  if (_internal_has_version()) {
+    // required int32 version = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t MetaCmd_Ping::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.Ping)
+  size_t total_size = 0;
 
-int MetaCmd_Ping::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .ZPMeta.Node node = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required int32 version = 1;
-    if (has_version()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->version());
-    }
-
-    // required .ZPMeta.Node node = 2;
-    if (has_node()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->node());
-    }
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .ZPMeta.SyncOffset offset = 3;
-  total_size += 1 * this->offset_size();
-  for (int i = 0; i < this->offset_size(); i++) {
+  total_size += 1UL * this->_internal_offset_size();
+  for (const auto& msg : this->_impl_.offset_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->offset(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaCmd_Ping::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_Ping* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_Ping*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_Ping::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_Ping::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_Ping::GetClassData() const { return &_class_data_; }
+
+
+void MetaCmd_Ping::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_Ping*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_Ping&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.Ping)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmd_Ping::MergeFrom(const MetaCmd_Ping& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  offset_.MergeFrom(from.offset_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_version()) {
-      set_version(from.version());
+  _this->_impl_.offset_.MergeFrom(from._impl_.offset_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_node()->::ZPMeta::Node::MergeFrom(
+          from._internal_node());
     }
-    if (from.has_node()) {
-      mutable_node()->::ZPMeta::Node::MergeFrom(from.node());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmd_Ping::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd_Ping::CopyFrom(const MetaCmd_Ping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.Ping)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd_Ping::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
-  if (has_node()) {
-    if (!this->node().IsInitialized()) return false;
-  }
-  for (int i = 0; i < offset_size(); i++) {
-    if (!this->offset(i).IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.offset_))
+    return false;
+  if (_internal_has_node()) {
+    if (!_impl_.node_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmd_Ping::Swap(MetaCmd_Ping* other) {
-  if (other != this) {
-    std::swap(version_, other->version_);
-    std::swap(node_, other->node_);
-    offset_.Swap(&other->offset_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_Ping::InternalSwap(MetaCmd_Ping* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.offset_.InternalSwap(&other->_impl_.offset_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetaCmd_Ping, _impl_.version_)
+      + sizeof(MetaCmd_Ping::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(MetaCmd_Ping, _impl_.node_)>(
+          reinterpret_cast<char*>(&_impl_.node_),
+          reinterpret_cast<char*>(&other->_impl_.node_));
 }
 
-::google::protobuf::Metadata MetaCmd_Ping::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_Ping_descriptor_;
-  metadata.reflection = MetaCmd_Ping_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_Ping::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[9]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd_Pull::kNodeFieldNumber;
-const int MetaCmd_Pull::kNameFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd_Pull::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_Pull>()._impl_._has_bits_);
+  static const ::ZPMeta::Node& node(const MetaCmd_Pull* msg);
+  static void set_has_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-MetaCmd_Pull::MetaCmd_Pull()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Node&
+MetaCmd_Pull::_Internal::node(const MetaCmd_Pull* msg) {
+  return *msg->_impl_.node_;
 }
-
-void MetaCmd_Pull::InitAsDefaultInstance() {
-  node_ = const_cast< ::ZPMeta::Node*>(&::ZPMeta::Node::default_instance());
+MetaCmd_Pull::MetaCmd_Pull(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.Pull)
 }
-
 MetaCmd_Pull::MetaCmd_Pull(const MetaCmd_Pull& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmd_Pull::SharedCtor() {
-  _cached_size_ = 0;
-  node_ = NULL;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_Pull* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.node_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::ZPMeta::Node(*from._impl_.node_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.Pull)
+}
+
+inline void MetaCmd_Pull::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.node_){nullptr}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MetaCmd_Pull::~MetaCmd_Pull() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.Pull)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmd_Pull::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-    delete node_;
-  }
+inline void MetaCmd_Pull::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.node_;
 }
 
 void MetaCmd_Pull::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmd_Pull::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_Pull_descriptor_;
-}
-
-const MetaCmd_Pull& MetaCmd_Pull::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmd_Pull* MetaCmd_Pull::default_instance_ = NULL;
-
-MetaCmd_Pull* MetaCmd_Pull::New() const {
-  return new MetaCmd_Pull;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmd_Pull::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_node()) {
-      if (node_ != NULL) node_->::ZPMeta::Node::Clear();
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.Pull)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
     }
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.node_ != nullptr);
+      _impl_.node_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool MetaCmd_Pull::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* MetaCmd_Pull::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .ZPMeta.Node node = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_node()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_name;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string name = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd_Pull::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional .ZPMeta.Node node = 1;
-  if (has_node()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->node(), output);
-  }
-
-  // optional string name = 2;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->name(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* MetaCmd_Pull::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.MetaCmd.Pull.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_Pull::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.Pull)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .ZPMeta.Node node = 1;
-  if (has_node()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->node(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
   }
 
   // optional string name = 2;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.MetaCmd.Pull.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.Pull)
   return target;
 }
 
-int MetaCmd_Pull::ByteSize() const {
-  int total_size = 0;
+size_t MetaCmd_Pull::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.Pull)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .ZPMeta.Node node = 1;
-    if (has_node()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 2;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->node());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
     }
 
-    // optional string name = 2;
-    if (has_name()) {
+    // optional .ZPMeta.Node node = 1;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.node_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaCmd_Pull::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_Pull* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_Pull*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_Pull::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_Pull::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_Pull::GetClassData() const { return &_class_data_; }
+
+
+void MetaCmd_Pull::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_Pull*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_Pull&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.Pull)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmd_Pull::MergeFrom(const MetaCmd_Pull& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_node()) {
-      mutable_node()->::ZPMeta::Node::MergeFrom(from.node());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_name()) {
-      set_name(from.name());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_node()->::ZPMeta::Node::MergeFrom(
+          from._internal_node());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmd_Pull::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd_Pull::CopyFrom(const MetaCmd_Pull& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.Pull)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd_Pull::IsInitialized() const {
-
-  if (has_node()) {
-    if (!this->node().IsInitialized()) return false;
+  if (_internal_has_node()) {
+    if (!_impl_.node_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmd_Pull::Swap(MetaCmd_Pull* other) {
-  if (other != this) {
-    std::swap(node_, other->node_);
-    std::swap(name_, other->name_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_Pull::InternalSwap(MetaCmd_Pull* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.node_, other->_impl_.node_);
 }
 
-::google::protobuf::Metadata MetaCmd_Pull::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_Pull_descriptor_;
-  metadata.reflection = MetaCmd_Pull_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_Pull::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[10]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd_Init::kNameFieldNumber;
-const int MetaCmd_Init::kNumFieldNumber;
-#endif  // !_MSC_VER
-
-MetaCmd_Init::MetaCmd_Init()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class MetaCmd_Init::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_Init>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_replica_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_learner_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void MetaCmd_Init::InitAsDefaultInstance() {
+MetaCmd_Init::MetaCmd_Init(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.Init)
 }
-
 MetaCmd_Init::MetaCmd_Init(const MetaCmd_Init& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmd_Init::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  num_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_Init* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.num_){}
+    , decltype(_impl_.learner_num_){}
+    , decltype(_impl_.replica_num_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.num_, &from._impl_.num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_num_) -
+    reinterpret_cast<char*>(&_impl_.num_)) + sizeof(_impl_.replica_num_));
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.Init)
+}
+
+inline void MetaCmd_Init::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.num_){0}
+    , decltype(_impl_.learner_num_){0}
+    , decltype(_impl_.replica_num_){3}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MetaCmd_Init::~MetaCmd_Init() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.Init)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmd_Init::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void MetaCmd_Init::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void MetaCmd_Init::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmd_Init::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_Init_descriptor_;
-}
-
-const MetaCmd_Init& MetaCmd_Init::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmd_Init* MetaCmd_Init::default_instance_ = NULL;
-
-MetaCmd_Init* MetaCmd_Init::New() const {
-  return new MetaCmd_Init;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmd_Init::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    num_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmd_Init::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.Init)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.learner_num_) -
+        reinterpret_cast<char*>(&_impl_.num_)) + sizeof(_impl_.learner_num_));
+    _impl_.replica_num_ = 3;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd_Init::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_num;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.MetaCmd.Init.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 num = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_num:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &num_)));
-          set_has_num();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd_Init::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num(&has_bits);
+          _impl_.num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 replica_num = 3 [default = 3];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_replica_num(&has_bits);
+          _impl_.replica_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 learner_num = 4 [default = 0];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_learner_num(&has_bits);
+          _impl_.learner_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_Init::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.Init)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.MetaCmd.Init.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // required int32 num = 2;
-  if (has_num()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->num(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* MetaCmd_Init::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  // optional int32 replica_num = 3 [default = 3];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_replica_num(), target);
   }
 
-  // required int32 num = 2;
-  if (has_num()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->num(), target);
+  // optional int32 learner_num = 4 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_learner_num(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.Init)
   return target;
 }
 
-int MetaCmd_Init::ByteSize() const {
-  int total_size = 0;
+size_t MetaCmd_Init::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.MetaCmd.Init)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_name()) {
     // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
 
+  if (_internal_has_num()) {
     // required int32 num = 2;
-    if (has_num()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->num());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t MetaCmd_Init::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.Init)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required int32 num = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num());
 
-void MetaCmd_Init::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_Init* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_Init*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void MetaCmd_Init::MergeFrom(const MetaCmd_Init& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional int32 learner_num = 4 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_learner_num());
     }
-    if (from.has_num()) {
-      set_num(from.num());
+
+    // optional int32 replica_num = 3 [default = 3];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_num());
     }
+
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaCmd_Init::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_Init::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_Init::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_Init::GetClassData() const { return &_class_data_; }
+
+
+void MetaCmd_Init::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_Init*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_Init&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.Init)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_ = from._impl_.num_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.learner_num_ = from._impl_.learner_num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.replica_num_ = from._impl_.replica_num_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd_Init::CopyFrom(const MetaCmd_Init& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.Init)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd_Init::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void MetaCmd_Init::Swap(MetaCmd_Init* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(num_, other->num_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_Init::InternalSwap(MetaCmd_Init* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetaCmd_Init, _impl_.learner_num_)
+      + sizeof(MetaCmd_Init::_impl_.learner_num_)
+      - PROTOBUF_FIELD_OFFSET(MetaCmd_Init, _impl_.num_)>(
+          reinterpret_cast<char*>(&_impl_.num_),
+          reinterpret_cast<char*>(&other->_impl_.num_));
+  swap(_impl_.replica_num_, other->_impl_.replica_num_);
 }
 
-::google::protobuf::Metadata MetaCmd_Init::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_Init_descriptor_;
-  metadata.reflection = MetaCmd_Init_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_Init::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[11]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd_SetMaster::kBasicFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd_SetMaster::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_SetMaster>()._impl_._has_bits_);
+  static const ::ZPMeta::BasicCmdUnit& basic(const MetaCmd_SetMaster* msg);
+  static void set_has_basic(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-MetaCmd_SetMaster::MetaCmd_SetMaster()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::BasicCmdUnit&
+MetaCmd_SetMaster::_Internal::basic(const MetaCmd_SetMaster* msg) {
+  return *msg->_impl_.basic_;
 }
-
-void MetaCmd_SetMaster::InitAsDefaultInstance() {
-  basic_ = const_cast< ::ZPMeta::BasicCmdUnit*>(&::ZPMeta::BasicCmdUnit::default_instance());
+MetaCmd_SetMaster::MetaCmd_SetMaster(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.SetMaster)
 }
-
 MetaCmd_SetMaster::MetaCmd_SetMaster(const MetaCmd_SetMaster& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmd_SetMaster::SharedCtor() {
-  _cached_size_ = 0;
-  basic_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_SetMaster* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.basic_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_basic()) {
+    _this->_impl_.basic_ = new ::ZPMeta::BasicCmdUnit(*from._impl_.basic_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.SetMaster)
+}
+
+inline void MetaCmd_SetMaster::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.basic_){nullptr}
+  };
 }
 
 MetaCmd_SetMaster::~MetaCmd_SetMaster() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.SetMaster)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmd_SetMaster::SharedDtor() {
-  if (this != default_instance_) {
-    delete basic_;
-  }
+inline void MetaCmd_SetMaster::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.basic_;
 }
 
 void MetaCmd_SetMaster::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmd_SetMaster::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_SetMaster_descriptor_;
-}
-
-const MetaCmd_SetMaster& MetaCmd_SetMaster::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmd_SetMaster* MetaCmd_SetMaster::default_instance_ = NULL;
-
-MetaCmd_SetMaster* MetaCmd_SetMaster::New() const {
-  return new MetaCmd_SetMaster;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmd_SetMaster::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_basic()) {
-      if (basic_ != NULL) basic_->::ZPMeta::BasicCmdUnit::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmd_SetMaster::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.SetMaster)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.basic_ != nullptr);
+    _impl_.basic_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd_SetMaster::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.BasicCmdUnit basic = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_basic()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd_SetMaster::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_basic(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_SetMaster::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.SetMaster)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  if (has_basic()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->basic(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::basic(this),
+        _Internal::basic(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.SetMaster)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmd_SetMaster::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmd_SetMaster::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.SetMaster)
+  size_t total_size = 0;
+
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  if (has_basic()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->basic(), target);
+  if (_internal_has_basic()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.basic_);
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmd_SetMaster::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .ZPMeta.BasicCmdUnit basic = 1;
-    if (has_basic()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->basic());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_SetMaster::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_SetMaster::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_SetMaster::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MetaCmd_SetMaster::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_SetMaster* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_SetMaster*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void MetaCmd_SetMaster::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_SetMaster*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_SetMaster&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.SetMaster)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmd_SetMaster::MergeFrom(const MetaCmd_SetMaster& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_basic()) {
-      mutable_basic()->::ZPMeta::BasicCmdUnit::MergeFrom(from.basic());
-    }
+  if (from._internal_has_basic()) {
+    _this->_internal_mutable_basic()->::ZPMeta::BasicCmdUnit::MergeFrom(
+        from._internal_basic());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmd_SetMaster::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd_SetMaster::CopyFrom(const MetaCmd_SetMaster& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.SetMaster)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd_SetMaster::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_basic()) {
-    if (!this->basic().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_basic()) {
+    if (!_impl_.basic_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmd_SetMaster::Swap(MetaCmd_SetMaster* other) {
-  if (other != this) {
-    std::swap(basic_, other->basic_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_SetMaster::InternalSwap(MetaCmd_SetMaster* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.basic_, other->_impl_.basic_);
 }
 
-::google::protobuf::Metadata MetaCmd_SetMaster::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_SetMaster_descriptor_;
-  metadata.reflection = MetaCmd_SetMaster_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_SetMaster::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[12]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd_AddSlave::kBasicFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd_AddSlave::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_AddSlave>()._impl_._has_bits_);
+  static const ::ZPMeta::BasicCmdUnit& basic(const MetaCmd_AddSlave* msg);
+  static void set_has_basic(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-MetaCmd_AddSlave::MetaCmd_AddSlave()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::BasicCmdUnit&
+MetaCmd_AddSlave::_Internal::basic(const MetaCmd_AddSlave* msg) {
+  return *msg->_impl_.basic_;
 }
-
-void MetaCmd_AddSlave::InitAsDefaultInstance() {
-  basic_ = const_cast< ::ZPMeta::BasicCmdUnit*>(&::ZPMeta::BasicCmdUnit::default_instance());
+MetaCmd_AddSlave::MetaCmd_AddSlave(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.AddSlave)
 }
-
 MetaCmd_AddSlave::MetaCmd_AddSlave(const MetaCmd_AddSlave& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmd_AddSlave::SharedCtor() {
-  _cached_size_ = 0;
-  basic_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_AddSlave* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.basic_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_basic()) {
+    _this->_impl_.basic_ = new ::ZPMeta::BasicCmdUnit(*from._impl_.basic_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.AddSlave)
+}
+
+inline void MetaCmd_AddSlave::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.basic_){nullptr}
+  };
 }
 
 MetaCmd_AddSlave::~MetaCmd_AddSlave() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.AddSlave)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmd_AddSlave::SharedDtor() {
-  if (this != default_instance_) {
-    delete basic_;
-  }
+inline void MetaCmd_AddSlave::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.basic_;
 }
 
 void MetaCmd_AddSlave::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmd_AddSlave::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_AddSlave_descriptor_;
-}
-
-const MetaCmd_AddSlave& MetaCmd_AddSlave::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmd_AddSlave* MetaCmd_AddSlave::default_instance_ = NULL;
-
-MetaCmd_AddSlave* MetaCmd_AddSlave::New() const {
-  return new MetaCmd_AddSlave;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmd_AddSlave::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_basic()) {
-      if (basic_ != NULL) basic_->::ZPMeta::BasicCmdUnit::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmd_AddSlave::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.AddSlave)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.basic_ != nullptr);
+    _impl_.basic_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd_AddSlave::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.BasicCmdUnit basic = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_basic()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd_AddSlave::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_basic(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_AddSlave::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.AddSlave)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  if (has_basic()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->basic(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::basic(this),
+        _Internal::basic(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.AddSlave)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmd_AddSlave::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmd_AddSlave::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.AddSlave)
+  size_t total_size = 0;
+
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  if (has_basic()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->basic(), target);
+  if (_internal_has_basic()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.basic_);
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmd_AddSlave::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_AddSlave::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_AddSlave::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_AddSlave::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .ZPMeta.BasicCmdUnit basic = 1;
-    if (has_basic()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->basic());
-    }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void MetaCmd_AddSlave::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_AddSlave* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_AddSlave*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void MetaCmd_AddSlave::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_AddSlave*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_AddSlave&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.AddSlave)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmd_AddSlave::MergeFrom(const MetaCmd_AddSlave& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_basic()) {
-      mutable_basic()->::ZPMeta::BasicCmdUnit::MergeFrom(from.basic());
-    }
+  if (from._internal_has_basic()) {
+    _this->_internal_mutable_basic()->::ZPMeta::BasicCmdUnit::MergeFrom(
+        from._internal_basic());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmd_AddSlave::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd_AddSlave::CopyFrom(const MetaCmd_AddSlave& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.AddSlave)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd_AddSlave::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_basic()) {
-    if (!this->basic().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_basic()) {
+    if (!_impl_.basic_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmd_AddSlave::Swap(MetaCmd_AddSlave* other) {
-  if (other != this) {
-    std::swap(basic_, other->basic_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_AddSlave::InternalSwap(MetaCmd_AddSlave* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.basic_, other->_impl_.basic_);
 }
 
-::google::protobuf::Metadata MetaCmd_AddSlave::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_AddSlave_descriptor_;
-  metadata.reflection = MetaCmd_AddSlave_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_AddSlave::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[13]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd_RemoveSlave::kBasicFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd_RemoveSlave::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_RemoveSlave>()._impl_._has_bits_);
+  static const ::ZPMeta::BasicCmdUnit& basic(const MetaCmd_RemoveSlave* msg);
+  static void set_has_basic(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-MetaCmd_RemoveSlave::MetaCmd_RemoveSlave()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::BasicCmdUnit&
+MetaCmd_RemoveSlave::_Internal::basic(const MetaCmd_RemoveSlave* msg) {
+  return *msg->_impl_.basic_;
 }
-
-void MetaCmd_RemoveSlave::InitAsDefaultInstance() {
-  basic_ = const_cast< ::ZPMeta::BasicCmdUnit*>(&::ZPMeta::BasicCmdUnit::default_instance());
+MetaCmd_RemoveSlave::MetaCmd_RemoveSlave(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.RemoveSlave)
 }
-
 MetaCmd_RemoveSlave::MetaCmd_RemoveSlave(const MetaCmd_RemoveSlave& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmd_RemoveSlave::SharedCtor() {
-  _cached_size_ = 0;
-  basic_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_RemoveSlave* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.basic_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_basic()) {
+    _this->_impl_.basic_ = new ::ZPMeta::BasicCmdUnit(*from._impl_.basic_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.RemoveSlave)
+}
+
+inline void MetaCmd_RemoveSlave::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.basic_){nullptr}
+  };
 }
 
 MetaCmd_RemoveSlave::~MetaCmd_RemoveSlave() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.RemoveSlave)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmd_RemoveSlave::SharedDtor() {
-  if (this != default_instance_) {
-    delete basic_;
-  }
+inline void MetaCmd_RemoveSlave::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.basic_;
 }
 
 void MetaCmd_RemoveSlave::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmd_RemoveSlave::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_RemoveSlave_descriptor_;
-}
-
-const MetaCmd_RemoveSlave& MetaCmd_RemoveSlave::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmd_RemoveSlave* MetaCmd_RemoveSlave::default_instance_ = NULL;
-
-MetaCmd_RemoveSlave* MetaCmd_RemoveSlave::New() const {
-  return new MetaCmd_RemoveSlave;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmd_RemoveSlave::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_basic()) {
-      if (basic_ != NULL) basic_->::ZPMeta::BasicCmdUnit::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmd_RemoveSlave::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.RemoveSlave)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.basic_ != nullptr);
+    _impl_.basic_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd_RemoveSlave::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.BasicCmdUnit basic = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_basic()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd_RemoveSlave::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_basic(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_RemoveSlave::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.RemoveSlave)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  if (has_basic()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->basic(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::basic(this),
+        _Internal::basic(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.RemoveSlave)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmd_RemoveSlave::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmd_RemoveSlave::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.RemoveSlave)
+  size_t total_size = 0;
+
   // required .ZPMeta.BasicCmdUnit basic = 1;
-  if (has_basic()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->basic(), target);
+  if (_internal_has_basic()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.basic_);
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmd_RemoveSlave::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_RemoveSlave::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_RemoveSlave::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_RemoveSlave::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .ZPMeta.BasicCmdUnit basic = 1;
-    if (has_basic()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->basic());
-    }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void MetaCmd_RemoveSlave::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_RemoveSlave* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_RemoveSlave*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void MetaCmd_RemoveSlave::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_RemoveSlave*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_RemoveSlave&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.RemoveSlave)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmd_RemoveSlave::MergeFrom(const MetaCmd_RemoveSlave& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_basic()) {
-      mutable_basic()->::ZPMeta::BasicCmdUnit::MergeFrom(from.basic());
-    }
+  if (from._internal_has_basic()) {
+    _this->_internal_mutable_basic()->::ZPMeta::BasicCmdUnit::MergeFrom(
+        from._internal_basic());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmd_RemoveSlave::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd_RemoveSlave::CopyFrom(const MetaCmd_RemoveSlave& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.RemoveSlave)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd_RemoveSlave::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_basic()) {
-    if (!this->basic().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_basic()) {
+    if (!_impl_.basic_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmd_RemoveSlave::Swap(MetaCmd_RemoveSlave* other) {
-  if (other != this) {
-    std::swap(basic_, other->basic_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_RemoveSlave::InternalSwap(MetaCmd_RemoveSlave* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.basic_, other->_impl_.basic_);
 }
 
-::google::protobuf::Metadata MetaCmd_RemoveSlave::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_RemoveSlave_descriptor_;
-  metadata.reflection = MetaCmd_RemoveSlave_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_RemoveSlave::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[14]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd_DropTable::kNameFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd_DropTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_DropTable>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-MetaCmd_DropTable::MetaCmd_DropTable()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+MetaCmd_DropTable::MetaCmd_DropTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.DropTable)
+}
+MetaCmd_DropTable::MetaCmd_DropTable(const MetaCmd_DropTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_DropTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.DropTable)
+}
+
+inline void MetaCmd_DropTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void MetaCmd_DropTable::InitAsDefaultInstance() {
+MetaCmd_DropTable::~MetaCmd_DropTable() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.DropTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-MetaCmd_DropTable::MetaCmd_DropTable(const MetaCmd_DropTable& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+inline void MetaCmd_DropTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void MetaCmd_DropTable::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void MetaCmd_DropTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-MetaCmd_DropTable::~MetaCmd_DropTable() {
-  SharedDtor();
+void MetaCmd_DropTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.DropTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd_DropTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.MetaCmd.DropTable.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_DropTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.DropTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.MetaCmd.DropTable.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.DropTable)
+  return target;
 }
 
-void MetaCmd_DropTable::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+size_t MetaCmd_DropTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.DropTable)
+  size_t total_size = 0;
+
+  // required string name = 1;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
-  if (this != default_instance_) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_DropTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_DropTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_DropTable::GetClassData() const { return &_class_data_; }
+
+
+void MetaCmd_DropTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_DropTable*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_DropTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.DropTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void MetaCmd_DropTable::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+void MetaCmd_DropTable::CopyFrom(const MetaCmd_DropTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.DropTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::google::protobuf::Descriptor* MetaCmd_DropTable::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_DropTable_descriptor_;
+
+bool MetaCmd_DropTable::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-const MetaCmd_DropTable& MetaCmd_DropTable::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
+void MetaCmd_DropTable::InternalSwap(MetaCmd_DropTable* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-MetaCmd_DropTable* MetaCmd_DropTable::default_instance_ = NULL;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_DropTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[15]);
+}
 
-MetaCmd_DropTable* MetaCmd_DropTable::New() const {
-  return new MetaCmd_DropTable;
+// ===================================================================
+
+class MetaCmd_SetChain::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd_SetChain>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_partition(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_enable(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+MetaCmd_SetChain::MetaCmd_SetChain(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd.SetChain)
+}
+MetaCmd_SetChain::MetaCmd_SetChain(const MetaCmd_SetChain& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd_SetChain* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.order_){from._impl_.order_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.partition_){}
+    , decltype(_impl_.enable_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.partition_, &from._impl_.partition_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.enable_) -
+    reinterpret_cast<char*>(&_impl_.partition_)) + sizeof(_impl_.enable_));
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd.SetChain)
+}
+
+inline void MetaCmd_SetChain::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.order_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.partition_){0}
+    , decltype(_impl_.enable_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void MetaCmd_DropTable::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
+MetaCmd_SetChain::~MetaCmd_SetChain() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd.SetChain)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  SharedDtor();
 }
 
-bool MetaCmd_DropTable::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+inline void MetaCmd_SetChain::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.order_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void MetaCmd_SetChain::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetaCmd_SetChain::Clear() {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd.SetChain)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.order_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
   }
-  return true;
-#undef DO_
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.partition_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.enable_) -
+        reinterpret_cast<char*>(&_impl_.partition_)) + sizeof(_impl_.enable_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void MetaCmd_DropTable::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+const char* MetaCmd_SetChain::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.MetaCmd.SetChain.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 partition = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_partition(&has_bits);
+          _impl_.partition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool enable = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_enable(&has_bits);
+          _impl_.enable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ZPMeta.Node order = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_order(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd_SetChain::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd.SetChain)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.MetaCmd.SetChain.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // required int32 partition = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_partition(), target);
   }
-}
 
-::google::protobuf::uint8* MetaCmd_DropTable::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  // required bool enable = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_enable(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated .ZPMeta.Node order = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_order_size()); i < n; i++) {
+    const auto& repfield = this->_internal_order(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd.SetChain)
   return target;
 }
 
-int MetaCmd_DropTable::ByteSize() const {
-  int total_size = 0;
+size_t MetaCmd_SetChain::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.MetaCmd.SetChain)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_name()) {
     // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
 
+  if (_internal_has_partition()) {
+    // required int32 partition = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_enable()) {
+    // required bool enable = 3;
+    total_size += 1 + 1;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t MetaCmd_SetChain::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd.SetChain)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required int32 partition = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_partition());
+
+    // required bool enable = 3;
+    total_size += 1 + 1;
 
-void MetaCmd_DropTable::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd_DropTable* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd_DropTable*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void MetaCmd_DropTable::MergeFrom(const MetaCmd_DropTable& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
-    }
+  // repeated .ZPMeta.Node order = 4;
+  total_size += 1UL * this->_internal_order_size();
+  for (const auto& msg : this->_impl_.order_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaCmd_DropTable::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd_SetChain::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd_SetChain::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd_SetChain::GetClassData() const { return &_class_data_; }
+
+
+void MetaCmd_SetChain::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd_SetChain*>(&to_msg);
+  auto& from = static_cast<const MetaCmd_SetChain&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd.SetChain)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.order_.MergeFrom(from._impl_.order_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.partition_ = from._impl_.partition_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.enable_ = from._impl_.enable_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void MetaCmd_DropTable::CopyFrom(const MetaCmd_DropTable& from) {
+void MetaCmd_SetChain::CopyFrom(const MetaCmd_SetChain& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd.SetChain)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MetaCmd_DropTable::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+bool MetaCmd_SetChain::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.order_))
+    return false;
   return true;
 }
 
-void MetaCmd_DropTable::Swap(MetaCmd_DropTable* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd_SetChain::InternalSwap(MetaCmd_SetChain* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.order_.InternalSwap(&other->_impl_.order_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetaCmd_SetChain, _impl_.enable_)
+      + sizeof(MetaCmd_SetChain::_impl_.enable_)
+      - PROTOBUF_FIELD_OFFSET(MetaCmd_SetChain, _impl_.partition_)>(
+          reinterpret_cast<char*>(&_impl_.partition_),
+          reinterpret_cast<char*>(&other->_impl_.partition_));
 }
 
-::google::protobuf::Metadata MetaCmd_DropTable::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_DropTable_descriptor_;
-  metadata.reflection = MetaCmd_DropTable_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd_SetChain::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[16]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmd::kTypeFieldNumber;
-const int MetaCmd::kPingFieldNumber;
-const int MetaCmd::kPullFieldNumber;
-const int MetaCmd::kInitFieldNumber;
-const int MetaCmd::kSetMasterFieldNumber;
-const int MetaCmd::kAddSlaveFieldNumber;
-const int MetaCmd::kRemoveSlaveFieldNumber;
-const int MetaCmd::kDropTableFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmd::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmd>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::ZPMeta::MetaCmd_Ping& ping(const MetaCmd* msg);
+  static void set_has_ping(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::ZPMeta::MetaCmd_Pull& pull(const MetaCmd* msg);
+  static void set_has_pull(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::ZPMeta::MetaCmd_Init& init(const MetaCmd* msg);
+  static void set_has_init(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::ZPMeta::MetaCmd_SetMaster& set_master(const MetaCmd* msg);
+  static void set_has_set_master(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::ZPMeta::MetaCmd_AddSlave& add_slave(const MetaCmd* msg);
+  static void set_has_add_slave(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::ZPMeta::MetaCmd_RemoveSlave& remove_slave(const MetaCmd* msg);
+  static void set_has_remove_slave(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::ZPMeta::MetaCmd_DropTable& drop_table(const MetaCmd* msg);
+  static void set_has_drop_table(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::ZPMeta::MetaCmd_SetChain& set_chain(const MetaCmd* msg);
+  static void set_has_set_chain(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000100) ^ 0x00000100) != 0;
+  }
+};
 
-MetaCmd::MetaCmd()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::MetaCmd_Ping&
+MetaCmd::_Internal::ping(const MetaCmd* msg) {
+  return *msg->_impl_.ping_;
 }
-
-void MetaCmd::InitAsDefaultInstance() {
-  ping_ = const_cast< ::ZPMeta::MetaCmd_Ping*>(&::ZPMeta::MetaCmd_Ping::default_instance());
-  pull_ = const_cast< ::ZPMeta::MetaCmd_Pull*>(&::ZPMeta::MetaCmd_Pull::default_instance());
-  init_ = const_cast< ::ZPMeta::MetaCmd_Init*>(&::ZPMeta::MetaCmd_Init::default_instance());
-  set_master_ = const_cast< ::ZPMeta::MetaCmd_SetMaster*>(&::ZPMeta::MetaCmd_SetMaster::default_instance());
-  add_slave_ = const_cast< ::ZPMeta::MetaCmd_AddSlave*>(&::ZPMeta::MetaCmd_AddSlave::default_instance());
-  remove_slave_ = const_cast< ::ZPMeta::MetaCmd_RemoveSlave*>(&::ZPMeta::MetaCmd_RemoveSlave::default_instance());
-  drop_table_ = const_cast< ::ZPMeta::MetaCmd_DropTable*>(&::ZPMeta::MetaCmd_DropTable::default_instance());
+const ::ZPMeta::MetaCmd_Pull&
+MetaCmd::_Internal::pull(const MetaCmd* msg) {
+  return *msg->_impl_.pull_;
 }
-
-MetaCmd::MetaCmd(const MetaCmd& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::ZPMeta::MetaCmd_Init&
+MetaCmd::_Internal::init(const MetaCmd* msg) {
+  return *msg->_impl_.init_;
 }
-
-void MetaCmd::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 1;
-  ping_ = NULL;
-  pull_ = NULL;
-  init_ = NULL;
-  set_master_ = NULL;
-  add_slave_ = NULL;
-  remove_slave_ = NULL;
-  drop_table_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::ZPMeta::MetaCmd_SetMaster&
+MetaCmd::_Internal::set_master(const MetaCmd* msg) {
+  return *msg->_impl_.set_master_;
 }
-
-MetaCmd::~MetaCmd() {
-  SharedDtor();
+const ::ZPMeta::MetaCmd_AddSlave&
+MetaCmd::_Internal::add_slave(const MetaCmd* msg) {
+  return *msg->_impl_.add_slave_;
 }
-
-void MetaCmd::SharedDtor() {
-  if (this != default_instance_) {
-    delete ping_;
-    delete pull_;
-    delete init_;
-    delete set_master_;
-    delete add_slave_;
-    delete remove_slave_;
-    delete drop_table_;
-  }
+const ::ZPMeta::MetaCmd_RemoveSlave&
+MetaCmd::_Internal::remove_slave(const MetaCmd* msg) {
+  return *msg->_impl_.remove_slave_;
 }
-
-void MetaCmd::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::ZPMeta::MetaCmd_DropTable&
+MetaCmd::_Internal::drop_table(const MetaCmd* msg) {
+  return *msg->_impl_.drop_table_;
 }
-const ::google::protobuf::Descriptor* MetaCmd::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmd_descriptor_;
+const ::ZPMeta::MetaCmd_SetChain&
+MetaCmd::_Internal::set_chain(const MetaCmd* msg) {
+  return *msg->_impl_.set_chain_;
 }
-
-const MetaCmd& MetaCmd::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
+MetaCmd::MetaCmd(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmd)
+}
+MetaCmd::MetaCmd(const MetaCmd& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmd* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.pull_){nullptr}
+    , decltype(_impl_.init_){nullptr}
+    , decltype(_impl_.set_master_){nullptr}
+    , decltype(_impl_.add_slave_){nullptr}
+    , decltype(_impl_.remove_slave_){nullptr}
+    , decltype(_impl_.drop_table_){nullptr}
+    , decltype(_impl_.set_chain_){nullptr}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_ping()) {
+    _this->_impl_.ping_ = new ::ZPMeta::MetaCmd_Ping(*from._impl_.ping_);
+  }
+  if (from._internal_has_pull()) {
+    _this->_impl_.pull_ = new ::ZPMeta::MetaCmd_Pull(*from._impl_.pull_);
+  }
+  if (from._internal_has_init()) {
+    _this->_impl_.init_ = new ::ZPMeta::MetaCmd_Init(*from._impl_.init_);
+  }
+  if (from._internal_has_set_master()) {
+    _this->_impl_.set_master_ = new ::ZPMeta::MetaCmd_SetMaster(*from._impl_.set_master_);
+  }
+  if (from._internal_has_add_slave()) {
+    _this->_impl_.add_slave_ = new ::ZPMeta::MetaCmd_AddSlave(*from._impl_.add_slave_);
+  }
+  if (from._internal_has_remove_slave()) {
+    _this->_impl_.remove_slave_ = new ::ZPMeta::MetaCmd_RemoveSlave(*from._impl_.remove_slave_);
+  }
+  if (from._internal_has_drop_table()) {
+    _this->_impl_.drop_table_ = new ::ZPMeta::MetaCmd_DropTable(*from._impl_.drop_table_);
+  }
+  if (from._internal_has_set_chain()) {
+    _this->_impl_.set_chain_ = new ::ZPMeta::MetaCmd_SetChain(*from._impl_.set_chain_);
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmd)
+}
+
+inline void MetaCmd::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.pull_){nullptr}
+    , decltype(_impl_.init_){nullptr}
+    , decltype(_impl_.set_master_){nullptr}
+    , decltype(_impl_.add_slave_){nullptr}
+    , decltype(_impl_.remove_slave_){nullptr}
+    , decltype(_impl_.drop_table_){nullptr}
+    , decltype(_impl_.set_chain_){nullptr}
+    , decltype(_impl_.type_){1}
+  };
 }
 
-MetaCmd* MetaCmd::default_instance_ = NULL;
+MetaCmd::~MetaCmd() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmd)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-MetaCmd* MetaCmd::New() const {
-  return new MetaCmd;
+inline void MetaCmd::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.ping_;
+  if (this != internal_default_instance()) delete _impl_.pull_;
+  if (this != internal_default_instance()) delete _impl_.init_;
+  if (this != internal_default_instance()) delete _impl_.set_master_;
+  if (this != internal_default_instance()) delete _impl_.add_slave_;
+  if (this != internal_default_instance()) delete _impl_.remove_slave_;
+  if (this != internal_default_instance()) delete _impl_.drop_table_;
+  if (this != internal_default_instance()) delete _impl_.set_chain_;
 }
 
-void MetaCmd::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 1;
-    if (has_ping()) {
-      if (ping_ != NULL) ping_->::ZPMeta::MetaCmd_Ping::Clear();
-    }
-    if (has_pull()) {
-      if (pull_ != NULL) pull_->::ZPMeta::MetaCmd_Pull::Clear();
-    }
-    if (has_init()) {
-      if (init_ != NULL) init_->::ZPMeta::MetaCmd_Init::Clear();
-    }
-    if (has_set_master()) {
-      if (set_master_ != NULL) set_master_->::ZPMeta::MetaCmd_SetMaster::Clear();
-    }
-    if (has_add_slave()) {
-      if (add_slave_ != NULL) add_slave_->::ZPMeta::MetaCmd_AddSlave::Clear();
-    }
-    if (has_remove_slave()) {
-      if (remove_slave_ != NULL) remove_slave_->::ZPMeta::MetaCmd_RemoveSlave::Clear();
-    }
-    if (has_drop_table()) {
-      if (drop_table_ != NULL) drop_table_->::ZPMeta::MetaCmd_DropTable::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void MetaCmd::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool MetaCmd::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void MetaCmd::Clear() {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmd)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.ping_ != nullptr);
+      _impl_.ping_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.pull_ != nullptr);
+      _impl_.pull_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.init_ != nullptr);
+      _impl_.init_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.set_master_ != nullptr);
+      _impl_.set_master_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.add_slave_ != nullptr);
+      _impl_.add_slave_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.remove_slave_ != nullptr);
+      _impl_.remove_slave_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.drop_table_ != nullptr);
+      _impl_.drop_table_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.set_chain_ != nullptr);
+      _impl_.set_chain_->Clear();
+    }
+  }
+  _impl_.type_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmd::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::ZPMeta::Type_IsValid(value)) {
-            set_type(static_cast< ::ZPMeta::Type >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ZPMeta::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::ZPMeta::Type>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_ping;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.Ping ping = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ping:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_ping()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_pull;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.Pull pull = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pull:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_pull()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_init;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pull(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.Init init = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_init:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_init()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_set_master;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_init(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.SetMaster set_master = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_set_master:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_set_master()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_add_slave;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_master(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.AddSlave add_slave = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_add_slave:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_add_slave()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_remove_slave;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_add_slave(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.RemoveSlave remove_slave = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_remove_slave:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_remove_slave()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_drop_table;
-        break;
-      }
-
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_remove_slave(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmd.DropTable drop_table = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_drop_table:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_drop_table()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmd::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drop_table(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ZPMeta.MetaCmd.SetChain set_chain = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_chain(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmd::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmd)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // optional .ZPMeta.MetaCmd.Ping ping = 2;
-  if (has_ping()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->ping(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::ping(this),
+        _Internal::ping(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmd.Pull pull = 3;
-  if (has_pull()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->pull(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::pull(this),
+        _Internal::pull(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmd.Init init = 4;
-  if (has_init()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->init(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::init(this),
+        _Internal::init(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmd.SetMaster set_master = 5;
-  if (has_set_master()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->set_master(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::set_master(this),
+        _Internal::set_master(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmd.AddSlave add_slave = 6;
-  if (has_add_slave()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->add_slave(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::add_slave(this),
+        _Internal::add_slave(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmd.RemoveSlave remove_slave = 7;
-  if (has_remove_slave()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->remove_slave(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::remove_slave(this),
+        _Internal::remove_slave(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmd.DropTable drop_table = 8;
-  if (has_drop_table()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->drop_table(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* MetaCmd::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .ZPMeta.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // optional .ZPMeta.MetaCmd.Ping ping = 2;
-  if (has_ping()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->ping(), target);
-  }
-
-  // optional .ZPMeta.MetaCmd.Pull pull = 3;
-  if (has_pull()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->pull(), target);
-  }
-
-  // optional .ZPMeta.MetaCmd.Init init = 4;
-  if (has_init()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->init(), target);
-  }
-
-  // optional .ZPMeta.MetaCmd.SetMaster set_master = 5;
-  if (has_set_master()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->set_master(), target);
-  }
-
-  // optional .ZPMeta.MetaCmd.AddSlave add_slave = 6;
-  if (has_add_slave()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->add_slave(), target);
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::drop_table(this),
+        _Internal::drop_table(this).GetCachedSize(), target, stream);
   }
 
-  // optional .ZPMeta.MetaCmd.RemoveSlave remove_slave = 7;
-  if (has_remove_slave()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->remove_slave(), target);
+  // optional .ZPMeta.MetaCmd.SetChain set_chain = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::set_chain(this),
+        _Internal::set_chain(this).GetCachedSize(), target, stream);
   }
 
-  // optional .ZPMeta.MetaCmd.DropTable drop_table = 8;
-  if (has_drop_table()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        8, this->drop_table(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmd)
   return target;
 }
 
-int MetaCmd::ByteSize() const {
-  int total_size = 0;
+size_t MetaCmd::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmd)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .ZPMeta.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+  // required .ZPMeta.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
     // optional .ZPMeta.MetaCmd.Ping ping = 2;
-    if (has_ping()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->ping());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ping_);
     }
 
     // optional .ZPMeta.MetaCmd.Pull pull = 3;
-    if (has_pull()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->pull());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pull_);
     }
 
     // optional .ZPMeta.MetaCmd.Init init = 4;
-    if (has_init()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->init());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.init_);
     }
 
     // optional .ZPMeta.MetaCmd.SetMaster set_master = 5;
-    if (has_set_master()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->set_master());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.set_master_);
     }
 
     // optional .ZPMeta.MetaCmd.AddSlave add_slave = 6;
-    if (has_add_slave()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->add_slave());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.add_slave_);
     }
 
     // optional .ZPMeta.MetaCmd.RemoveSlave remove_slave = 7;
-    if (has_remove_slave()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->remove_slave());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.remove_slave_);
     }
 
     // optional .ZPMeta.MetaCmd.DropTable drop_table = 8;
-    if (has_drop_table()) {
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->drop_table());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.drop_table_);
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional .ZPMeta.MetaCmd.SetChain set_chain = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.set_chain_);
+    }
 
-void MetaCmd::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmd* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmd*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaCmd::MergeFrom(const MetaCmd& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmd::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmd::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmd::GetClassData() const { return &_class_data_; }
+
+
+void MetaCmd::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmd*>(&to_msg);
+  auto& from = static_cast<const MetaCmd&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmd)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_ping()->::ZPMeta::MetaCmd_Ping::MergeFrom(
+          from._internal_ping());
     }
-    if (from.has_ping()) {
-      mutable_ping()->::ZPMeta::MetaCmd_Ping::MergeFrom(from.ping());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_pull()->::ZPMeta::MetaCmd_Pull::MergeFrom(
+          from._internal_pull());
     }
-    if (from.has_pull()) {
-      mutable_pull()->::ZPMeta::MetaCmd_Pull::MergeFrom(from.pull());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_init()->::ZPMeta::MetaCmd_Init::MergeFrom(
+          from._internal_init());
     }
-    if (from.has_init()) {
-      mutable_init()->::ZPMeta::MetaCmd_Init::MergeFrom(from.init());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_set_master()->::ZPMeta::MetaCmd_SetMaster::MergeFrom(
+          from._internal_set_master());
     }
-    if (from.has_set_master()) {
-      mutable_set_master()->::ZPMeta::MetaCmd_SetMaster::MergeFrom(from.set_master());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_add_slave()->::ZPMeta::MetaCmd_AddSlave::MergeFrom(
+          from._internal_add_slave());
     }
-    if (from.has_add_slave()) {
-      mutable_add_slave()->::ZPMeta::MetaCmd_AddSlave::MergeFrom(from.add_slave());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_remove_slave()->::ZPMeta::MetaCmd_RemoveSlave::MergeFrom(
+          from._internal_remove_slave());
     }
-    if (from.has_remove_slave()) {
-      mutable_remove_slave()->::ZPMeta::MetaCmd_RemoveSlave::MergeFrom(from.remove_slave());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_drop_table()->::ZPMeta::MetaCmd_DropTable::MergeFrom(
+          from._internal_drop_table());
     }
-    if (from.has_drop_table()) {
-      mutable_drop_table()->::ZPMeta::MetaCmd_DropTable::MergeFrom(from.drop_table());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_set_chain()->::ZPMeta::MetaCmd_SetChain::MergeFrom(
+          from._internal_set_chain());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmd::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmd::CopyFrom(const MetaCmd& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmd)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmd::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_ping()) {
-    if (!this->ping().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_ping()) {
+    if (!_impl_.ping_->IsInitialized()) return false;
   }
-  if (has_pull()) {
-    if (!this->pull().IsInitialized()) return false;
+  if (_internal_has_pull()) {
+    if (!_impl_.pull_->IsInitialized()) return false;
   }
-  if (has_init()) {
-    if (!this->init().IsInitialized()) return false;
+  if (_internal_has_init()) {
+    if (!_impl_.init_->IsInitialized()) return false;
   }
-  if (has_set_master()) {
-    if (!this->set_master().IsInitialized()) return false;
+  if (_internal_has_set_master()) {
+    if (!_impl_.set_master_->IsInitialized()) return false;
   }
-  if (has_add_slave()) {
-    if (!this->add_slave().IsInitialized()) return false;
+  if (_internal_has_add_slave()) {
+    if (!_impl_.add_slave_->IsInitialized()) return false;
   }
-  if (has_remove_slave()) {
-    if (!this->remove_slave().IsInitialized()) return false;
+  if (_internal_has_remove_slave()) {
+    if (!_impl_.remove_slave_->IsInitialized()) return false;
   }
-  if (has_drop_table()) {
-    if (!this->drop_table().IsInitialized()) return false;
+  if (_internal_has_drop_table()) {
+    if (!_impl_.drop_table_->IsInitialized()) return false;
+  }
+  if (_internal_has_set_chain()) {
+    if (!_impl_.set_chain_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmd::Swap(MetaCmd* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(ping_, other->ping_);
-    std::swap(pull_, other->pull_);
-    std::swap(init_, other->init_);
-    std::swap(set_master_, other->set_master_);
-    std::swap(add_slave_, other->add_slave_);
-    std::swap(remove_slave_, other->remove_slave_);
-    std::swap(drop_table_, other->drop_table_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmd::InternalSwap(MetaCmd* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetaCmd, _impl_.set_chain_)
+      + sizeof(MetaCmd::_impl_.set_chain_)
+      - PROTOBUF_FIELD_OFFSET(MetaCmd, _impl_.ping_)>(
+          reinterpret_cast<char*>(&_impl_.ping_),
+          reinterpret_cast<char*>(&other->_impl_.ping_));
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::google::protobuf::Metadata MetaCmd::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmd_descriptor_;
-  metadata.reflection = MetaCmd_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmd::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[17]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int MetaCmdResponse_Ping::kVersionFieldNumber;
-#endif  // !_MSC_VER
-
-MetaCmdResponse_Ping::MetaCmdResponse_Ping()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class MetaCmdResponse_Ping::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmdResponse_Ping>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void MetaCmdResponse_Ping::InitAsDefaultInstance() {
+MetaCmdResponse_Ping::MetaCmdResponse_Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmdResponse.Ping)
 }
-
 MetaCmdResponse_Ping::MetaCmdResponse_Ping(const MetaCmdResponse_Ping& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmdResponse_Ping::SharedCtor() {
-  _cached_size_ = 0;
-  version_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmdResponse_Ping* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmdResponse.Ping)
+}
+
+inline void MetaCmdResponse_Ping::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){0}
+  };
 }
 
 MetaCmdResponse_Ping::~MetaCmdResponse_Ping() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmdResponse.Ping)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmdResponse_Ping::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void MetaCmdResponse_Ping::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void MetaCmdResponse_Ping::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmdResponse_Ping::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmdResponse_Ping_descriptor_;
-}
-
-const MetaCmdResponse_Ping& MetaCmdResponse_Ping::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmdResponse_Ping* MetaCmdResponse_Ping::default_instance_ = NULL;
-
-MetaCmdResponse_Ping* MetaCmdResponse_Ping::New() const {
-  return new MetaCmdResponse_Ping;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmdResponse_Ping::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    version_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmdResponse_Ping::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmdResponse.Ping)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.version_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmdResponse_Ping::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 version = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &version_)));
-          set_has_version();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmdResponse_Ping::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmdResponse_Ping::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmdResponse.Ping)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 version = 1;
-  if (has_version()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->version(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmdResponse.Ping)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmdResponse_Ping::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmdResponse_Ping::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmdResponse.Ping)
+  size_t total_size = 0;
+
   // required int32 version = 1;
-  if (has_version()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->version(), target);
+  if (_internal_has_version()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmdResponse_Ping::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmdResponse_Ping::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmdResponse_Ping::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmdResponse_Ping::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 version = 1;
-    if (has_version()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->version());
-    }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+void MetaCmdResponse_Ping::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmdResponse_Ping*>(&to_msg);
+  auto& from = static_cast<const MetaCmdResponse_Ping&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmdResponse.Ping)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmdResponse_Ping::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmdResponse_Ping* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmdResponse_Ping*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
-
-void MetaCmdResponse_Ping::MergeFrom(const MetaCmdResponse_Ping& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_version()) {
-      set_version(from.version());
-    }
+  if (from._internal_has_version()) {
+    _this->_internal_set_version(from._internal_version());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmdResponse_Ping::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmdResponse_Ping::CopyFrom(const MetaCmdResponse_Ping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmdResponse.Ping)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmdResponse_Ping::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void MetaCmdResponse_Ping::Swap(MetaCmdResponse_Ping* other) {
-  if (other != this) {
-    std::swap(version_, other->version_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmdResponse_Ping::InternalSwap(MetaCmdResponse_Ping* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.version_, other->_impl_.version_);
 }
 
-::google::protobuf::Metadata MetaCmdResponse_Ping::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmdResponse_Ping_descriptor_;
-  metadata.reflection = MetaCmdResponse_Ping_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmdResponse_Ping::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[18]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmdResponse_Pull::kVersionFieldNumber;
-const int MetaCmdResponse_Pull::kInfoFieldNumber;
-#endif  // !_MSC_VER
-
-MetaCmdResponse_Pull::MetaCmdResponse_Pull()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class MetaCmdResponse_Pull::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmdResponse_Pull>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void MetaCmdResponse_Pull::InitAsDefaultInstance() {
+MetaCmdResponse_Pull::MetaCmdResponse_Pull(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmdResponse.Pull)
 }
-
 MetaCmdResponse_Pull::MetaCmdResponse_Pull(const MetaCmdResponse_Pull& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmdResponse_Pull::SharedCtor() {
-  _cached_size_ = 0;
-  version_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmdResponse_Pull* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.info_){from._impl_.info_}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmdResponse.Pull)
+}
+
+inline void MetaCmdResponse_Pull::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.info_){arena}
+    , decltype(_impl_.version_){0}
+  };
 }
 
 MetaCmdResponse_Pull::~MetaCmdResponse_Pull() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmdResponse.Pull)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmdResponse_Pull::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void MetaCmdResponse_Pull::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.info_.~RepeatedPtrField();
 }
 
 void MetaCmdResponse_Pull::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmdResponse_Pull::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmdResponse_Pull_descriptor_;
-}
-
-const MetaCmdResponse_Pull& MetaCmdResponse_Pull::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmdResponse_Pull* MetaCmdResponse_Pull::default_instance_ = NULL;
-
-MetaCmdResponse_Pull* MetaCmdResponse_Pull::New() const {
-  return new MetaCmdResponse_Pull;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmdResponse_Pull::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    version_ = 0;
-  }
-  info_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmdResponse_Pull::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmdResponse.Pull)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.info_.Clear();
+  _impl_.version_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmdResponse_Pull::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 version = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &version_)));
-          set_has_version();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_info;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .ZPMeta.Table info = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_info;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmdResponse_Pull::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmdResponse_Pull::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmdResponse.Pull)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 version = 1;
-  if (has_version()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->version(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
   }
 
   // repeated .ZPMeta.Table info = 2;
-  for (int i = 0; i < this->info_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->info(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmdResponse.Pull)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmdResponse_Pull::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmdResponse_Pull::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmdResponse.Pull)
+  size_t total_size = 0;
+
   // required int32 version = 1;
-  if (has_version()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->version(), target);
+  if (_internal_has_version()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .ZPMeta.Table info = 2;
-  for (int i = 0; i < this->info_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->info(i), target);
+  total_size += 1UL * this->_internal_info_size();
+  for (const auto& msg : this->_impl_.info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmdResponse_Pull::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmdResponse_Pull::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmdResponse_Pull::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmdResponse_Pull::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 version = 1;
-    if (has_version()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->version());
-    }
 
-  }
-  // repeated .ZPMeta.Table info = 2;
-  total_size += 1 * this->info_size();
-  for (int i = 0; i < this->info_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info(i));
-  }
+void MetaCmdResponse_Pull::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmdResponse_Pull*>(&to_msg);
+  auto& from = static_cast<const MetaCmdResponse_Pull&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmdResponse.Pull)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void MetaCmdResponse_Pull::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmdResponse_Pull* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmdResponse_Pull*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  _this->_impl_.info_.MergeFrom(from._impl_.info_);
+  if (from._internal_has_version()) {
+    _this->_internal_set_version(from._internal_version());
   }
-}
-
-void MetaCmdResponse_Pull::MergeFrom(const MetaCmdResponse_Pull& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  info_.MergeFrom(from.info_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_version()) {
-      set_version(from.version());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmdResponse_Pull::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmdResponse_Pull::CopyFrom(const MetaCmdResponse_Pull& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmdResponse.Pull)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmdResponse_Pull::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  for (int i = 0; i < info_size(); i++) {
-    if (!this->info(i).IsInitialized()) return false;
-  }
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.info_))
+    return false;
   return true;
 }
 
-void MetaCmdResponse_Pull::Swap(MetaCmdResponse_Pull* other) {
-  if (other != this) {
-    std::swap(version_, other->version_);
-    info_.Swap(&other->info_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmdResponse_Pull::InternalSwap(MetaCmdResponse_Pull* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.info_.InternalSwap(&other->_impl_.info_);
+  swap(_impl_.version_, other->_impl_.version_);
 }
 
-::google::protobuf::Metadata MetaCmdResponse_Pull::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmdResponse_Pull_descriptor_;
-  metadata.reflection = MetaCmdResponse_Pull_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmdResponse_Pull::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[19]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmdResponse_ListTable::kTablesFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmdResponse_ListTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmdResponse_ListTable>()._impl_._has_bits_);
+  static const ::ZPMeta::TableName& tables(const MetaCmdResponse_ListTable* msg);
+  static void set_has_tables(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-MetaCmdResponse_ListTable::MetaCmdResponse_ListTable()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::TableName&
+MetaCmdResponse_ListTable::_Internal::tables(const MetaCmdResponse_ListTable* msg) {
+  return *msg->_impl_.tables_;
 }
-
-void MetaCmdResponse_ListTable::InitAsDefaultInstance() {
-  tables_ = const_cast< ::ZPMeta::TableName*>(&::ZPMeta::TableName::default_instance());
+MetaCmdResponse_ListTable::MetaCmdResponse_ListTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmdResponse.ListTable)
 }
-
 MetaCmdResponse_ListTable::MetaCmdResponse_ListTable(const MetaCmdResponse_ListTable& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmdResponse_ListTable::SharedCtor() {
-  _cached_size_ = 0;
-  tables_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-MetaCmdResponse_ListTable::~MetaCmdResponse_ListTable() {
-  SharedDtor();
-}
-
-void MetaCmdResponse_ListTable::SharedDtor() {
-  if (this != default_instance_) {
-    delete tables_;
-  }
-}
-
-void MetaCmdResponse_ListTable::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmdResponse_ListTable::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmdResponse_ListTable_descriptor_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmdResponse_ListTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tables_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_tables()) {
+    _this->_impl_.tables_ = new ::ZPMeta::TableName(*from._impl_.tables_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmdResponse.ListTable)
+}
+
+inline void MetaCmdResponse_ListTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tables_){nullptr}
+  };
 }
 
-const MetaCmdResponse_ListTable& MetaCmdResponse_ListTable::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
+MetaCmdResponse_ListTable::~MetaCmdResponse_ListTable() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmdResponse.ListTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-MetaCmdResponse_ListTable* MetaCmdResponse_ListTable::default_instance_ = NULL;
-
-MetaCmdResponse_ListTable* MetaCmdResponse_ListTable::New() const {
-  return new MetaCmdResponse_ListTable;
+inline void MetaCmdResponse_ListTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.tables_;
 }
 
-void MetaCmdResponse_ListTable::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_tables()) {
-      if (tables_ != NULL) tables_->::ZPMeta::TableName::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void MetaCmdResponse_ListTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool MetaCmdResponse_ListTable::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void MetaCmdResponse_ListTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmdResponse.ListTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.tables_ != nullptr);
+    _impl_.tables_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmdResponse_ListTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .ZPMeta.TableName tables = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_tables()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmdResponse_ListTable::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tables(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmdResponse_ListTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmdResponse.ListTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .ZPMeta.TableName tables = 1;
-  if (has_tables()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->tables(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::tables(this),
+        _Internal::tables(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmdResponse.ListTable)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmdResponse_ListTable::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmdResponse_ListTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmdResponse.ListTable)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // optional .ZPMeta.TableName tables = 1;
-  if (has_tables()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->tables(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.tables_);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmdResponse_ListTable::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .ZPMeta.TableName tables = 1;
-    if (has_tables()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->tables());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmdResponse_ListTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmdResponse_ListTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmdResponse_ListTable::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MetaCmdResponse_ListTable::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmdResponse_ListTable* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmdResponse_ListTable*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void MetaCmdResponse_ListTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmdResponse_ListTable*>(&to_msg);
+  auto& from = static_cast<const MetaCmdResponse_ListTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmdResponse.ListTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmdResponse_ListTable::MergeFrom(const MetaCmdResponse_ListTable& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_tables()) {
-      mutable_tables()->::ZPMeta::TableName::MergeFrom(from.tables());
-    }
+  if (from._internal_has_tables()) {
+    _this->_internal_mutable_tables()->::ZPMeta::TableName::MergeFrom(
+        from._internal_tables());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmdResponse_ListTable::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmdResponse_ListTable::CopyFrom(const MetaCmdResponse_ListTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmdResponse.ListTable)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmdResponse_ListTable::IsInitialized() const {
-
   return true;
 }
 
-void MetaCmdResponse_ListTable::Swap(MetaCmdResponse_ListTable* other) {
-  if (other != this) {
-    std::swap(tables_, other->tables_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmdResponse_ListTable::InternalSwap(MetaCmdResponse_ListTable* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.tables_, other->_impl_.tables_);
 }
 
-::google::protobuf::Metadata MetaCmdResponse_ListTable::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmdResponse_ListTable_descriptor_;
-  metadata.reflection = MetaCmdResponse_ListTable_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmdResponse_ListTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[20]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmdResponse_ListNode::kNodesFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmdResponse_ListNode::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmdResponse_ListNode>()._impl_._has_bits_);
+  static const ::ZPMeta::Nodes& nodes(const MetaCmdResponse_ListNode* msg);
+  static void set_has_nodes(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-MetaCmdResponse_ListNode::MetaCmdResponse_ListNode()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::Nodes&
+MetaCmdResponse_ListNode::_Internal::nodes(const MetaCmdResponse_ListNode* msg) {
+  return *msg->_impl_.nodes_;
 }
-
-void MetaCmdResponse_ListNode::InitAsDefaultInstance() {
-  nodes_ = const_cast< ::ZPMeta::Nodes*>(&::ZPMeta::Nodes::default_instance());
+MetaCmdResponse_ListNode::MetaCmdResponse_ListNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmdResponse.ListNode)
 }
-
 MetaCmdResponse_ListNode::MetaCmdResponse_ListNode(const MetaCmdResponse_ListNode& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmdResponse_ListNode::SharedCtor() {
-  _cached_size_ = 0;
-  nodes_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmdResponse_ListNode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_nodes()) {
+    _this->_impl_.nodes_ = new ::ZPMeta::Nodes(*from._impl_.nodes_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmdResponse.ListNode)
+}
+
+inline void MetaCmdResponse_ListNode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_){nullptr}
+  };
 }
 
 MetaCmdResponse_ListNode::~MetaCmdResponse_ListNode() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmdResponse.ListNode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmdResponse_ListNode::SharedDtor() {
-  if (this != default_instance_) {
-    delete nodes_;
-  }
+inline void MetaCmdResponse_ListNode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.nodes_;
 }
 
 void MetaCmdResponse_ListNode::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmdResponse_ListNode::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmdResponse_ListNode_descriptor_;
-}
-
-const MetaCmdResponse_ListNode& MetaCmdResponse_ListNode::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmdResponse_ListNode* MetaCmdResponse_ListNode::default_instance_ = NULL;
-
-MetaCmdResponse_ListNode* MetaCmdResponse_ListNode::New() const {
-  return new MetaCmdResponse_ListNode;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmdResponse_ListNode::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_nodes()) {
-      if (nodes_ != NULL) nodes_->::ZPMeta::Nodes::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmdResponse_ListNode::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmdResponse.ListNode)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.nodes_ != nullptr);
+    _impl_.nodes_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmdResponse_ListNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .ZPMeta.Nodes nodes = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_nodes()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmdResponse_ListNode::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nodes(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmdResponse_ListNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmdResponse.ListNode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .ZPMeta.Nodes nodes = 1;
-  if (has_nodes()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->nodes(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::nodes(this),
+        _Internal::nodes(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmdResponse.ListNode)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmdResponse_ListNode::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmdResponse_ListNode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmdResponse.ListNode)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // optional .ZPMeta.Nodes nodes = 1;
-  if (has_nodes()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->nodes(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.nodes_);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmdResponse_ListNode::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .ZPMeta.Nodes nodes = 1;
-    if (has_nodes()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->nodes());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmdResponse_ListNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmdResponse_ListNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmdResponse_ListNode::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MetaCmdResponse_ListNode::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmdResponse_ListNode* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmdResponse_ListNode*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void MetaCmdResponse_ListNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmdResponse_ListNode*>(&to_msg);
+  auto& from = static_cast<const MetaCmdResponse_ListNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmdResponse.ListNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmdResponse_ListNode::MergeFrom(const MetaCmdResponse_ListNode& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_nodes()) {
-      mutable_nodes()->::ZPMeta::Nodes::MergeFrom(from.nodes());
-    }
+  if (from._internal_has_nodes()) {
+    _this->_internal_mutable_nodes()->::ZPMeta::Nodes::MergeFrom(
+        from._internal_nodes());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmdResponse_ListNode::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmdResponse_ListNode::CopyFrom(const MetaCmdResponse_ListNode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmdResponse.ListNode)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmdResponse_ListNode::IsInitialized() const {
-
-  if (has_nodes()) {
-    if (!this->nodes().IsInitialized()) return false;
+  if (_internal_has_nodes()) {
+    if (!_impl_.nodes_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmdResponse_ListNode::Swap(MetaCmdResponse_ListNode* other) {
-  if (other != this) {
-    std::swap(nodes_, other->nodes_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmdResponse_ListNode::InternalSwap(MetaCmdResponse_ListNode* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.nodes_, other->_impl_.nodes_);
 }
 
-::google::protobuf::Metadata MetaCmdResponse_ListNode::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmdResponse_ListNode_descriptor_;
-  metadata.reflection = MetaCmdResponse_ListNode_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmdResponse_ListNode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[21]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmdResponse_ListMeta::kNodesFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmdResponse_ListMeta::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmdResponse_ListMeta>()._impl_._has_bits_);
+  static const ::ZPMeta::MetaNodes& nodes(const MetaCmdResponse_ListMeta* msg);
+  static void set_has_nodes(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-MetaCmdResponse_ListMeta::MetaCmdResponse_ListMeta()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::MetaNodes&
+MetaCmdResponse_ListMeta::_Internal::nodes(const MetaCmdResponse_ListMeta* msg) {
+  return *msg->_impl_.nodes_;
 }
-
-void MetaCmdResponse_ListMeta::InitAsDefaultInstance() {
-  nodes_ = const_cast< ::ZPMeta::MetaNodes*>(&::ZPMeta::MetaNodes::default_instance());
+MetaCmdResponse_ListMeta::MetaCmdResponse_ListMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmdResponse.ListMeta)
 }
-
 MetaCmdResponse_ListMeta::MetaCmdResponse_ListMeta(const MetaCmdResponse_ListMeta& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MetaCmdResponse_ListMeta::SharedCtor() {
-  _cached_size_ = 0;
-  nodes_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmdResponse_ListMeta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_nodes()) {
+    _this->_impl_.nodes_ = new ::ZPMeta::MetaNodes(*from._impl_.nodes_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmdResponse.ListMeta)
+}
+
+inline void MetaCmdResponse_ListMeta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_){nullptr}
+  };
 }
 
 MetaCmdResponse_ListMeta::~MetaCmdResponse_ListMeta() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmdResponse.ListMeta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmdResponse_ListMeta::SharedDtor() {
-  if (this != default_instance_) {
-    delete nodes_;
-  }
+inline void MetaCmdResponse_ListMeta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.nodes_;
 }
 
 void MetaCmdResponse_ListMeta::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmdResponse_ListMeta::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmdResponse_ListMeta_descriptor_;
-}
-
-const MetaCmdResponse_ListMeta& MetaCmdResponse_ListMeta::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmdResponse_ListMeta* MetaCmdResponse_ListMeta::default_instance_ = NULL;
-
-MetaCmdResponse_ListMeta* MetaCmdResponse_ListMeta::New() const {
-  return new MetaCmdResponse_ListMeta;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmdResponse_ListMeta::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_nodes()) {
-      if (nodes_ != NULL) nodes_->::ZPMeta::MetaNodes::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MetaCmdResponse_ListMeta::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmdResponse.ListMeta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.nodes_ != nullptr);
+    _impl_.nodes_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaCmdResponse_ListMeta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.MetaNodes nodes = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_nodes()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmdResponse_ListMeta::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nodes(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmdResponse_ListMeta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmdResponse.ListMeta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.MetaNodes nodes = 1;
-  if (has_nodes()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->nodes(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::nodes(this),
+        _Internal::nodes(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmdResponse.ListMeta)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmdResponse_ListMeta::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t MetaCmdResponse_ListMeta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmdResponse.ListMeta)
+  size_t total_size = 0;
+
   // required .ZPMeta.MetaNodes nodes = 1;
-  if (has_nodes()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->nodes(), target);
+  if (_internal_has_nodes()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.nodes_);
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int MetaCmdResponse_ListMeta::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .ZPMeta.MetaNodes nodes = 1;
-    if (has_nodes()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->nodes());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmdResponse_ListMeta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmdResponse_ListMeta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmdResponse_ListMeta::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MetaCmdResponse_ListMeta::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmdResponse_ListMeta* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmdResponse_ListMeta*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void MetaCmdResponse_ListMeta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmdResponse_ListMeta*>(&to_msg);
+  auto& from = static_cast<const MetaCmdResponse_ListMeta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmdResponse.ListMeta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MetaCmdResponse_ListMeta::MergeFrom(const MetaCmdResponse_ListMeta& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_nodes()) {
-      mutable_nodes()->::ZPMeta::MetaNodes::MergeFrom(from.nodes());
-    }
+  if (from._internal_has_nodes()) {
+    _this->_internal_mutable_nodes()->::ZPMeta::MetaNodes::MergeFrom(
+        from._internal_nodes());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmdResponse_ListMeta::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmdResponse_ListMeta::CopyFrom(const MetaCmdResponse_ListMeta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmdResponse.ListMeta)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmdResponse_ListMeta::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_nodes()) {
-    if (!this->nodes().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_nodes()) {
+    if (!_impl_.nodes_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmdResponse_ListMeta::Swap(MetaCmdResponse_ListMeta* other) {
-  if (other != this) {
-    std::swap(nodes_, other->nodes_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmdResponse_ListMeta::InternalSwap(MetaCmdResponse_ListMeta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.nodes_, other->_impl_.nodes_);
 }
 
-::google::protobuf::Metadata MetaCmdResponse_ListMeta::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmdResponse_ListMeta_descriptor_;
-  metadata.reflection = MetaCmdResponse_ListMeta_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmdResponse_ListMeta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[22]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int MetaCmdResponse::kTypeFieldNumber;
-const int MetaCmdResponse::kCodeFieldNumber;
-const int MetaCmdResponse::kMsgFieldNumber;
-const int MetaCmdResponse::kPingFieldNumber;
-const int MetaCmdResponse::kPullFieldNumber;
-const int MetaCmdResponse::kListTableFieldNumber;
-const int MetaCmdResponse::kListNodeFieldNumber;
-const int MetaCmdResponse::kListMetaFieldNumber;
-#endif  // !_MSC_VER
+class MetaCmdResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaCmdResponse>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::ZPMeta::MetaCmdResponse_Ping& ping(const MetaCmdResponse* msg);
+  static void set_has_ping(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::ZPMeta::MetaCmdResponse_Pull& pull(const MetaCmdResponse* msg);
+  static void set_has_pull(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::ZPMeta::MetaCmdResponse_ListTable& list_table(const MetaCmdResponse* msg);
+  static void set_has_list_table(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::ZPMeta::MetaCmdResponse_ListNode& list_node(const MetaCmdResponse* msg);
+  static void set_has_list_node(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::ZPMeta::MetaCmdResponse_ListMeta& list_meta(const MetaCmdResponse* msg);
+  static void set_has_list_meta(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000000c0) ^ 0x000000c0) != 0;
+  }
+};
 
-MetaCmdResponse::MetaCmdResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::ZPMeta::MetaCmdResponse_Ping&
+MetaCmdResponse::_Internal::ping(const MetaCmdResponse* msg) {
+  return *msg->_impl_.ping_;
 }
-
-void MetaCmdResponse::InitAsDefaultInstance() {
-  ping_ = const_cast< ::ZPMeta::MetaCmdResponse_Ping*>(&::ZPMeta::MetaCmdResponse_Ping::default_instance());
-  pull_ = const_cast< ::ZPMeta::MetaCmdResponse_Pull*>(&::ZPMeta::MetaCmdResponse_Pull::default_instance());
-  list_table_ = const_cast< ::ZPMeta::MetaCmdResponse_ListTable*>(&::ZPMeta::MetaCmdResponse_ListTable::default_instance());
-  list_node_ = const_cast< ::ZPMeta::MetaCmdResponse_ListNode*>(&::ZPMeta::MetaCmdResponse_ListNode::default_instance());
-  list_meta_ = const_cast< ::ZPMeta::MetaCmdResponse_ListMeta*>(&::ZPMeta::MetaCmdResponse_ListMeta::default_instance());
+const ::ZPMeta::MetaCmdResponse_Pull&
+MetaCmdResponse::_Internal::pull(const MetaCmdResponse* msg) {
+  return *msg->_impl_.pull_;
 }
-
-MetaCmdResponse::MetaCmdResponse(const MetaCmdResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::ZPMeta::MetaCmdResponse_ListTable&
+MetaCmdResponse::_Internal::list_table(const MetaCmdResponse* msg) {
+  return *msg->_impl_.list_table_;
 }
-
-void MetaCmdResponse::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 1;
-  code_ = 0;
-  msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ping_ = NULL;
-  pull_ = NULL;
-  list_table_ = NULL;
-  list_node_ = NULL;
-  list_meta_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::ZPMeta::MetaCmdResponse_ListNode&
+MetaCmdResponse::_Internal::list_node(const MetaCmdResponse* msg) {
+  return *msg->_impl_.list_node_;
+}
+const ::ZPMeta::MetaCmdResponse_ListMeta&
+MetaCmdResponse::_Internal::list_meta(const MetaCmdResponse* msg) {
+  return *msg->_impl_.list_meta_;
+}
+MetaCmdResponse::MetaCmdResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ZPMeta.MetaCmdResponse)
+}
+MetaCmdResponse::MetaCmdResponse(const MetaCmdResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaCmdResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.pull_){nullptr}
+    , decltype(_impl_.list_table_){nullptr}
+    , decltype(_impl_.list_node_){nullptr}
+    , decltype(_impl_.list_meta_){nullptr}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_ping()) {
+    _this->_impl_.ping_ = new ::ZPMeta::MetaCmdResponse_Ping(*from._impl_.ping_);
+  }
+  if (from._internal_has_pull()) {
+    _this->_impl_.pull_ = new ::ZPMeta::MetaCmdResponse_Pull(*from._impl_.pull_);
+  }
+  if (from._internal_has_list_table()) {
+    _this->_impl_.list_table_ = new ::ZPMeta::MetaCmdResponse_ListTable(*from._impl_.list_table_);
+  }
+  if (from._internal_has_list_node()) {
+    _this->_impl_.list_node_ = new ::ZPMeta::MetaCmdResponse_ListNode(*from._impl_.list_node_);
+  }
+  if (from._internal_has_list_meta()) {
+    _this->_impl_.list_meta_ = new ::ZPMeta::MetaCmdResponse_ListMeta(*from._impl_.list_meta_);
+  }
+  ::memcpy(&_impl_.code_, &from._impl_.code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:ZPMeta.MetaCmdResponse)
+}
+
+inline void MetaCmdResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.pull_){nullptr}
+    , decltype(_impl_.list_table_){nullptr}
+    , decltype(_impl_.list_node_){nullptr}
+    , decltype(_impl_.list_meta_){nullptr}
+    , decltype(_impl_.code_){0}
+    , decltype(_impl_.type_){1}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MetaCmdResponse::~MetaCmdResponse() {
+  // @@protoc_insertion_point(destructor:ZPMeta.MetaCmdResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MetaCmdResponse::SharedDtor() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
-  }
-  if (this != default_instance_) {
-    delete ping_;
-    delete pull_;
-    delete list_table_;
-    delete list_node_;
-    delete list_meta_;
-  }
+inline void MetaCmdResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.ping_;
+  if (this != internal_default_instance()) delete _impl_.pull_;
+  if (this != internal_default_instance()) delete _impl_.list_table_;
+  if (this != internal_default_instance()) delete _impl_.list_node_;
+  if (this != internal_default_instance()) delete _impl_.list_meta_;
 }
 
 void MetaCmdResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MetaCmdResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MetaCmdResponse_descriptor_;
-}
-
-const MetaCmdResponse& MetaCmdResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
-  return *default_instance_;
-}
-
-MetaCmdResponse* MetaCmdResponse::default_instance_ = NULL;
-
-MetaCmdResponse* MetaCmdResponse::New() const {
-  return new MetaCmdResponse;
+  _impl_._cached_size_.Set(size);
 }
 
 void MetaCmdResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 1;
-    code_ = 0;
-    if (has_msg()) {
-      if (msg_ != &::google::protobuf::internal::kEmptyString) {
-        msg_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:ZPMeta.MetaCmdResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.msg_.ClearNonDefaultToEmpty();
     }
-    if (has_ping()) {
-      if (ping_ != NULL) ping_->::ZPMeta::MetaCmdResponse_Ping::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.ping_ != nullptr);
+      _impl_.ping_->Clear();
     }
-    if (has_pull()) {
-      if (pull_ != NULL) pull_->::ZPMeta::MetaCmdResponse_Pull::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.pull_ != nullptr);
+      _impl_.pull_->Clear();
     }
-    if (has_list_table()) {
-      if (list_table_ != NULL) list_table_->::ZPMeta::MetaCmdResponse_ListTable::Clear();
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.list_table_ != nullptr);
+      _impl_.list_table_->Clear();
     }
-    if (has_list_node()) {
-      if (list_node_ != NULL) list_node_->::ZPMeta::MetaCmdResponse_ListNode::Clear();
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.list_node_ != nullptr);
+      _impl_.list_node_->Clear();
     }
-    if (has_list_meta()) {
-      if (list_meta_ != NULL) list_meta_->::ZPMeta::MetaCmdResponse_ListMeta::Clear();
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.list_meta_ != nullptr);
+      _impl_.list_meta_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x000000c0u) {
+    _impl_.code_ = 0;
+    _impl_.type_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool MetaCmdResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* MetaCmdResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .ZPMeta.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::ZPMeta::Type_IsValid(value)) {
-            set_type(static_cast< ::ZPMeta::Type >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ZPMeta::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::ZPMeta::Type>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_code;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required .ZPMeta.StatusCode code = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_code:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::ZPMeta::StatusCode_IsValid(value)) {
-            set_code(static_cast< ::ZPMeta::StatusCode >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ZPMeta::StatusCode_IsValid(val))) {
+            _internal_set_code(static_cast<::ZPMeta::StatusCode>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_msg;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional string msg = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_msg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_ping;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ZPMeta.MetaCmdResponse.msg");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmdResponse.Ping ping = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ping:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_ping()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_pull;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmdResponse.Pull pull = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pull:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_pull()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_list_table;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pull(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmdResponse.ListTable list_table = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_list_table:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_list_table()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_list_node;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_table(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmdResponse.ListNode list_node = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_list_node:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_list_node()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_list_meta;
-        break;
-      }
-
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_list_meta:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_list_meta()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void MetaCmdResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_meta(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaCmdResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ZPMeta.MetaCmdResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .ZPMeta.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // required .ZPMeta.StatusCode code = 2;
-  if (has_code()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->code(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_code(), target);
   }
 
   // optional string msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->msg(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_msg().data(), static_cast<int>(this->_internal_msg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ZPMeta.MetaCmdResponse.msg");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_msg(), target);
   }
 
   // optional .ZPMeta.MetaCmdResponse.Ping ping = 4;
-  if (has_ping()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->ping(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::ping(this),
+        _Internal::ping(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmdResponse.Pull pull = 5;
-  if (has_pull()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->pull(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::pull(this),
+        _Internal::pull(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmdResponse.ListTable list_table = 6;
-  if (has_list_table()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->list_table(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::list_table(this),
+        _Internal::list_table(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmdResponse.ListNode list_node = 7;
-  if (has_list_node()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->list_node(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::list_node(this),
+        _Internal::list_node(this).GetCachedSize(), target, stream);
   }
 
   // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
-  if (has_list_meta()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->list_meta(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::list_meta(this),
+        _Internal::list_meta(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ZPMeta.MetaCmdResponse)
+  return target;
 }
 
-::google::protobuf::uint8* MetaCmdResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .ZPMeta.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // required .ZPMeta.StatusCode code = 2;
-  if (has_code()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->code(), target);
-  }
-
-  // optional string msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->msg(), target);
-  }
-
-  // optional .ZPMeta.MetaCmdResponse.Ping ping = 4;
-  if (has_ping()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->ping(), target);
-  }
-
-  // optional .ZPMeta.MetaCmdResponse.Pull pull = 5;
-  if (has_pull()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->pull(), target);
-  }
-
-  // optional .ZPMeta.MetaCmdResponse.ListTable list_table = 6;
-  if (has_list_table()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->list_table(), target);
-  }
+size_t MetaCmdResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ZPMeta.MetaCmdResponse)
+  size_t total_size = 0;
 
-  // optional .ZPMeta.MetaCmdResponse.ListNode list_node = 7;
-  if (has_list_node()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->list_node(), target);
+  if (_internal_has_code()) {
+    // required .ZPMeta.StatusCode code = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
   }
 
-  // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
-  if (has_list_meta()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        8, this->list_meta(), target);
+  if (_internal_has_type()) {
+    // required .ZPMeta.Type type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t MetaCmdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ZPMeta.MetaCmdResponse)
+  size_t total_size = 0;
 
-int MetaCmdResponse::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x000000c0) ^ 0x000000c0) == 0) {  // All required fields are present.
+    // required .ZPMeta.StatusCode code = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required .ZPMeta.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
 
-    // required .ZPMeta.StatusCode code = 2;
-    if (has_code()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->code());
-    }
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
     // optional string msg = 3;
-    if (has_msg()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->msg());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_msg());
     }
 
     // optional .ZPMeta.MetaCmdResponse.Ping ping = 4;
-    if (has_ping()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->ping());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ping_);
     }
 
     // optional .ZPMeta.MetaCmdResponse.Pull pull = 5;
-    if (has_pull()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->pull());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pull_);
     }
 
     // optional .ZPMeta.MetaCmdResponse.ListTable list_table = 6;
-    if (has_list_table()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->list_table());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.list_table_);
     }
 
     // optional .ZPMeta.MetaCmdResponse.ListNode list_node = 7;
-    if (has_list_node()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->list_node());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.list_node_);
     }
 
     // optional .ZPMeta.MetaCmdResponse.ListMeta list_meta = 8;
-    if (has_list_meta()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->list_meta());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.list_meta_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MetaCmdResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MetaCmdResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MetaCmdResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaCmdResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaCmdResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaCmdResponse::GetClassData() const { return &_class_data_; }
+
 
-void MetaCmdResponse::MergeFrom(const MetaCmdResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+void MetaCmdResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaCmdResponse*>(&to_msg);
+  auto& from = static_cast<const MetaCmdResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ZPMeta.MetaCmdResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_msg(from._internal_msg());
     }
-    if (from.has_code()) {
-      set_code(from.code());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_ping()->::ZPMeta::MetaCmdResponse_Ping::MergeFrom(
+          from._internal_ping());
     }
-    if (from.has_msg()) {
-      set_msg(from.msg());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_pull()->::ZPMeta::MetaCmdResponse_Pull::MergeFrom(
+          from._internal_pull());
     }
-    if (from.has_ping()) {
-      mutable_ping()->::ZPMeta::MetaCmdResponse_Ping::MergeFrom(from.ping());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_list_table()->::ZPMeta::MetaCmdResponse_ListTable::MergeFrom(
+          from._internal_list_table());
     }
-    if (from.has_pull()) {
-      mutable_pull()->::ZPMeta::MetaCmdResponse_Pull::MergeFrom(from.pull());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_list_node()->::ZPMeta::MetaCmdResponse_ListNode::MergeFrom(
+          from._internal_list_node());
     }
-    if (from.has_list_table()) {
-      mutable_list_table()->::ZPMeta::MetaCmdResponse_ListTable::MergeFrom(from.list_table());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_list_meta()->::ZPMeta::MetaCmdResponse_ListMeta::MergeFrom(
+          from._internal_list_meta());
     }
-    if (from.has_list_node()) {
-      mutable_list_node()->::ZPMeta::MetaCmdResponse_ListNode::MergeFrom(from.list_node());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.code_ = from._impl_.code_;
     }
-    if (from.has_list_meta()) {
-      mutable_list_meta()->::ZPMeta::MetaCmdResponse_ListMeta::MergeFrom(from.list_meta());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MetaCmdResponse::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MetaCmdResponse::CopyFrom(const MetaCmdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ZPMeta.MetaCmdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MetaCmdResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
-  if (has_ping()) {
-    if (!this->ping().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_ping()) {
+    if (!_impl_.ping_->IsInitialized()) return false;
   }
-  if (has_pull()) {
-    if (!this->pull().IsInitialized()) return false;
+  if (_internal_has_pull()) {
+    if (!_impl_.pull_->IsInitialized()) return false;
   }
-  if (has_list_node()) {
-    if (!this->list_node().IsInitialized()) return false;
+  if (_internal_has_list_node()) {
+    if (!_impl_.list_node_->IsInitialized()) return false;
   }
-  if (has_list_meta()) {
-    if (!this->list_meta().IsInitialized()) return false;
+  if (_internal_has_list_meta()) {
+    if (!_impl_.list_meta_->IsInitialized()) return false;
   }
   return true;
 }
 
-void MetaCmdResponse::Swap(MetaCmdResponse* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(code_, other->code_);
-    std::swap(msg_, other->msg_);
-    std::swap(ping_, other->ping_);
-    std::swap(pull_, other->pull_);
-    std::swap(list_table_, other->list_table_);
-    std::swap(list_node_, other->list_node_);
-    std::swap(list_meta_, other->list_meta_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MetaCmdResponse::InternalSwap(MetaCmdResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetaCmdResponse, _impl_.code_)
+      + sizeof(MetaCmdResponse::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(MetaCmdResponse, _impl_.ping_)>(
+          reinterpret_cast<char*>(&_impl_.ping_),
+          reinterpret_cast<char*>(&other->_impl_.ping_));
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::google::protobuf::Metadata MetaCmdResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MetaCmdResponse_descriptor_;
-  metadata.reflection = MetaCmdResponse_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MetaCmdResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_zp_5fmeta_2eproto_getter, &descriptor_table_zp_5fmeta_2eproto_once,
+      file_level_metadata_zp_5fmeta_2eproto[23]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace ZPMeta
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ZPMeta::Node*
+Arena::CreateMaybeMessage< ::ZPMeta::Node >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::Node >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::NodeStatus*
+Arena::CreateMaybeMessage< ::ZPMeta::NodeStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::NodeStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::Nodes*
+Arena::CreateMaybeMessage< ::ZPMeta::Nodes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::Nodes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaNodes*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaNodes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaNodes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::Partitions*
+Arena::CreateMaybeMessage< ::ZPMeta::Partitions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::Partitions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::TableName*
+Arena::CreateMaybeMessage< ::ZPMeta::TableName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::TableName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::Table*
+Arena::CreateMaybeMessage< ::ZPMeta::Table >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::Table >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::BasicCmdUnit*
+Arena::CreateMaybeMessage< ::ZPMeta::BasicCmdUnit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::BasicCmdUnit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::SyncOffset*
+Arena::CreateMaybeMessage< ::ZPMeta::SyncOffset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::SyncOffset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_Ping*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_Ping >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_Ping >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_Pull*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_Pull >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_Pull >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_Init*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_Init >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_Init >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_SetMaster*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_SetMaster >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_SetMaster >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_AddSlave*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_AddSlave >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_AddSlave >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_RemoveSlave*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_RemoveSlave >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_RemoveSlave >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_DropTable*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_DropTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_DropTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd_SetChain*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd_SetChain >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd_SetChain >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmd*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmd >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmd >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmdResponse_Ping*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmdResponse_Ping >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmdResponse_Ping >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmdResponse_Pull*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmdResponse_Pull >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmdResponse_Pull >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmdResponse_ListTable*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmdResponse_ListTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmdResponse_ListTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmdResponse_ListNode*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmdResponse_ListNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmdResponse_ListNode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmdResponse_ListMeta*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmdResponse_ListMeta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmdResponse_ListMeta >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ZPMeta::MetaCmdResponse*
+Arena::CreateMaybeMessage< ::ZPMeta::MetaCmdResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ZPMeta::MetaCmdResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>